@@ -140,6 +140,40 @@ extern const uint8_t FfxDisplayFragmentWidth;
  */
 extern const uint8_t FfxDisplayFragmentCount;
 
+/**
+ *  The number of fragment buffers in the ring. While a fragment is
+ *  rendered, up to one less than this are queued to the display; once
+ *  it is queued, up to all of them are.
+ */
+extern const uint8_t FfxDisplayFragmentBuffers;
+
+/**
+ *  Statistics for tuning the fragment ring, accumulated since init.
+ *  All times are in microseconds.
+ */
+typedef struct FfxDisplayStats {
+    // The number of fragments rendered and sent, and the number of
+    // SPI transactions used to send them
+    uint32_t fragments;
+    uint32_t transactions;
+
+    // Time spent in the renderFunc
+    uint64_t renderTime;
+
+    // Time the bus had nothing to send, waiting on a render (this
+    // includes any time the caller spends between fragments)
+    uint64_t busIdleTime;
+
+    // The number of fragments which had to wait for a buffer, as
+    // every buffer was still being sent, and the time spent waiting
+    uint32_t renderStalls;
+    uint64_t renderStallTime;
+
+    // Time spent queueing transactions and collecting their results,
+    // not counting any time stalled
+    uint64_t submitTime;
+} FfxDisplayStats;
+
 /**
  *  The callback function called per fragment to render to the buffer.
  *
@@ -182,6 +216,9 @@ void ffx_display_free(FfxDisplayContext context);
  *  Renders the next fragment, blocking the current task until
  *  complete, calling the [[RenderFunc]] with the fragment buffer.
  *
+ *  The fragment is then sent asynchronously; this only blocks
+ *  beforehand if every fragment buffer is still being sent.
+ *
  *  Returns 1 if the last fragment of the frame was rendered,
  *  otherwise returns 0.
  */
@@ -192,6 +229,12 @@ uint32_t ffx_display_renderFragment(FfxDisplayContext context);
  */
 uint16_t ffx_display_fps(FfxDisplayContext context);
 
+/**
+ *  Copies the fragment ring statistics into %%stats%%.
+ */
+void ffx_display_getStats(FfxDisplayContext context,
+    FfxDisplayStats *stats);
+
 
 #ifdef __cplusplus
 }
@@ -6,6 +6,7 @@
 
 
 
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -13,11 +14,13 @@
 #include <freertos/task.h>
 #include <driver/spi_master.h>
 #include <driver/gpio.h>
+#include <esp_timer.h>
 #include <hal/gpio_ll.h>
 #include "soc/gpio_struct.h"
 
 #include "firefly-display.h"
 #include "commands.h"
+#include "transactions.h"
 
 // If using a display with the CS pin pulled low;
 // this is now managed by the bus encoding
@@ -33,12 +36,25 @@
 #error "Fragment Height is not a factor of 240"
 #endif
 
+// The number of fragment buffers in the ring; while one is rendered the
+// rest may be in flight, so a slow fragment can be covered by the ones
+// rendered ahead of it (see: tools/fragment-sim.c to choose this)
+#ifndef FRAGMENT_BUFFERS
+#define FRAGMENT_BUFFERS  3
+#endif
+
+#if FRAGMENT_BUFFERS < 2
+#error "At least 2 fragment buffers are required"
+#endif
+
 // The height of each fragment; this **MUST** be a factor of 240 (or there will be infinite loops)
 const uint8_t FfxDisplayFragmentHeight = FRAGMENT_HEIGHT;
 const uint8_t FfxDisplayFragmentWidth = DISPLAY_WIDTH;
 
 const uint8_t FfxDisplayFragmentCount = DISPLAY_HEIGHT / FRAGMENT_HEIGHT;
 
+const uint8_t FfxDisplayFragmentBuffers = FRAGMENT_BUFFERS;
+
 
 // ST7789 Initialization Sequence
 // Place data into DRAM. Constant data gets placed into DROM by default, which is not accessible by DMA.
@@ -81,14 +97,31 @@ DRAM_ATTR static const uint8_t st7789_init_sequence[] = {
       (0 & 0xff),
       ((DISPLAY_WIDTH - 1) >> 8),
       ((DISPLAY_WIDTH - 1) & 0xff),
+    CommandRASET,      4,
+      (0 >> 8),
+      (0 & 0xff),
+      ((DISPLAY_HEIGHT - 1) >> 8),
+      ((DISPLAY_HEIGHT - 1) & 0xff),
     CommandDone
 };
 
-typedef enum MessageType {
-    MessageTypeCommand      = 0,
-    MessageTypeData         = 1
-} MessageType;
+typedef struct _Slot {
+    // The fragment buffer (DMA-compatible)
+    uint8_t *fragment;
+
+    // The SPI transactions for sending this fragment and how many of
+    // them (the last ones) were queued (see: transactions.h)
+    spi_transaction_t transactions[FRAGMENT_TRANSACTIONS];
+    uint8_t transactionCount;
 
+    // Set by the ISR once the last transaction completes. The time is
+    // latched as the low 32 bits of esp_timer_get_time, which the ISR
+    // stores in one write; an int64_t takes two, so a task reading it
+    // between them would see a torn value. Intervals wrap safely for
+    // about 71 minutes.
+    volatile uint32_t doneTime;
+    volatile bool done;
+} _Slot;
 
 typedef struct _Context {
     // The render function to use when rendering a fragment to the buffer
@@ -98,14 +131,26 @@ typedef struct _Context {
     // The SPI device (low-speed during initialization, then upgraded to high-speed)
     spi_device_handle_t spi;
 
-    // The prepared SPI transactions for sending fragments
-    spi_transaction_t transactions[4];
+    // The ring of fragment buffers, each with its own transactions
+    _Slot slots[FRAGMENT_BUFFERS];
+
+    // The next slot to render into and the number of slots in flight
+    // (queued and not yet awaited), which are the ones before it
+    uint8_t nextSlot;
+    uint8_t inflightCount;
 
-    // Two fragments, one for inflight data to the SPI hardware and one for a backbuffer
-    uint8_t *fragments[2];
+    // The most recently queued slot (-1 for none; first round)
+    int8_t lastSlot;
 
-    // The currently inflight fragment (-1 for none; first round)
-    int8_t inflightFragment;
+    // The row the display continues its memory write at, once all the
+    // data queued has been sent, and the first row of its row window;
+    // -1 if unknown (e.g. a transaction failed to queue), so the next
+    // fragment restarts the write (see: st7789_asend_fragment)
+    int16_t writeY;
+    int16_t windowTop;
+
+    // Statistics for tuning the ring
+    FfxDisplayStats stats;
 
     // The pins for D/C (Data/Contral) and Reset
     uint8_t pinDC;
@@ -129,10 +174,6 @@ static uint32_t ticks() {
     return xTaskGetTickCount();
 }
 
-static void* st7789_wrapTransaction(_Context *context, MessageType dc) {
-    return (void*)((dc << 7) | context->pinDC);
-}
-
 // This is only used during initialization
 static void st7789_send(_Context *context, MessageType dc, const uint8_t *data, int length) {
     if (length == 0) { return; }
@@ -142,7 +183,7 @@ static void st7789_send(_Context *context, MessageType dc, const uint8_t *data,
     memset(&transaction, 0, sizeof(spi_transaction_t));
     transaction.tx_buffer = data;
     transaction.length = 8 * length;
-    transaction.user = st7789_wrapTransaction(context, dc);
+    transaction.user = st7789_wrapTransaction(context->pinDC, dc);
 
     // Send and wait for completion
     esp_err_t result = spi_device_polling_transmit(context->spi, &transaction);
@@ -152,17 +193,29 @@ static void st7789_send(_Context *context, MessageType dc, const uint8_t *data,
 // The ST7789 requires a GPIO pin to be set high for data and low
 // for commands. Before each transaction this is called, which
 // determines the transaxction type from the user data, which is
-// set using the st7789_wrapTransaction function.
+// set using the st7789_wrapTransaction function (see: transactions.c).
 static void IRAM_ATTR st7789_spi_pre_transfer_callback(spi_transaction_t *txn) {
     int user = (int)(txn->user);
 
     // We manage GPIO directly to keep it in IRAM, so we can call it from an ISR
-    uint32_t level = (user >> 7);
+    uint32_t level = (user >> 7) & 0x01;
     gpio_num_t gpio_num = (user & 0x7f);
 
     gpio_ll_set_level(&GPIO, gpio_num, level);
 }
 
+// After the last transaction of a fragment, note when its slot finished
+// so the time the bus then sits idle can be measured.
+static void IRAM_ATTR st7789_spi_post_transfer_callback(spi_transaction_t *txn) {
+    int user = (int)(txn->user);
+    if ((user & MESSAGE_LAST_OF_FRAGMENT) == 0) { return; }
+
+    _Slot *slot = (_Slot*)((uint8_t*)txn - offsetof(_Slot,
+      transactions[FRAGMENT_TRANSACTION_DATA]));
+    slot->doneTime = esp_timer_get_time();
+    slot->done = true;
+}
+
 // Initialize all pins and send the initialization sequence to the display
 static void st7789_init(_Context *context, FfxDisplayRotation rotation) {
     // Initialize non-SPI GPIOs (this is critical, especially if one of these pins is
@@ -227,41 +280,79 @@ static void st7789_init(_Context *context, FfxDisplayRotation rotation) {
     }
 }
 
-// Asynchronously send a fragment (240 x FRAGMENT_HEIGHT) to the
-// display using DMA. This will return immediately, and a call to
-// the st7789_await_fragment function is required to the wait
+// Asynchronously send the fragment in %%slot%% (240 x FRAGMENT_HEIGHT)
+// to the display using DMA. This will return immediately, and a call
+// to the st7789_await_fragment function is required to the wait
 // for these transactions to complete. Between the calls to
 // st7789_asend_fragment and st7789_await_fragment the CPU is
 // free to perform other tasks.
-static void st7789_asend_fragment(_Context *context) {
+static void st7789_asend_fragment(_Context *context, _Slot *slot) {
+    uint16_t y = context->currentY;
+
+    // Invariant: a fragment is sent as only its data when the display
+    // will continue its memory write at the fragment's row, which is
+    // only the case directly after the fragment above it was queued
+    // in full. Otherwise the write is restarted; the first fragment of
+    // a frame at the top of the window (set up once, during init) and
+    // any other by first moving the window to start at its row. This
+    // recovers from a broken sequence (e.g. a failed queue) rather
+    // than sending the rest of the frame to the wrong rows.
+    FragmentStart start = FragmentStartContinue;
+    if (y == 0) {
+        start = (context->windowTop == 0) ? FragmentStartWrite:
+          FragmentStartWindow;
+    } else if (context->writeY != y) {
+        start = FragmentStartWindow;
+    }
 
-    // The current y position
-    uint32_t y = context->currentY;
-    context->transactions[1].tx_data[0] = y >> 8;                           // Start row (high)
-    context->transactions[1].tx_data[1] = y & 0xff;                         // start row (low)
-    context->transactions[1].tx_data[2] = (y + FfxDisplayFragmentHeight - 1) >> 8;    // End row (high)
-    context->transactions[1].tx_data[3] = (y + FfxDisplayFragmentHeight - 1) & 0xff;  // End row (low)
+    // Past the top of a frame, there is always an earlier fragment
+    assert(context->currentY == 0 || context->lastSlot != -1);
 
-    // Fragment data
-    context->transactions[3].tx_buffer = context->fragments[context->inflightFragment];
+    size_t count = st7789_buildFragment(slot->transactions, context->pinDC,
+      slot->fragment, DISPLAY_WIDTH * 2 * FfxDisplayFragmentHeight,
+      start, y, DISPLAY_HEIGHT - 1);
+
+    slot->transactionCount = 0;
+    slot->done = false;
+
+    if (start == FragmentStartWindow) { context->windowTop = y; }
+    context->writeY = y + FfxDisplayFragmentHeight;
 
     // Queue and send (asynchronously) all command and data transactions for this fragment
-    for (int i = 0; i < 4; i++) {
-       esp_err_t result = spi_device_queue_trans(context->spi, &(context->transactions[i]), portMAX_DELAY);
-       assert(result == ESP_OK);
+    spi_transaction_t *transactions =
+      &slot->transactions[FRAGMENT_TRANSACTIONS - count];
+    for (int i = 0; i < count; i++) {
+        esp_err_t result = spi_device_queue_trans(context->spi,
+          &(transactions[i]), portMAX_DELAY);
+        if (result != ESP_OK) {
+            printf("[display] failed to queue fragment: y=%d result=%d\n",
+              y, result);
+
+            // The display is no longer where the next fragment expects
+            context->writeY = -1;
+            context->windowTop = -1;
+            break;
+        }
+
         // DEBUG: SYNC; comment onut await calls
-        //esp_err_t result = spi_device_polling_transmit(context->spi, &(context->transactions[i]));
+        //esp_err_t result = spi_device_polling_transmit(context->spi, &(transactions[i]));
         //assert(result == ESP_OK);
+
+        slot->transactionCount++;
     }
+
+    context->stats.transactions += slot->transactionCount;
 }
 
-// Wait for all the asynchronously sent transactions to complete.
+// Wait for the asynchronously sent transactions of the oldest
+// fragment in flight, %%slot%%, to complete; transactions complete
+// in the order they were queued.
 // See: st7789_asend_fragment
-static void st7789_await_fragment(_Context *context) {
+static void st7789_await_fragment(_Context *context, _Slot *slot) {
 
-    // Wait for all in-flight transactions are done
+    // Wait for all its transactions are done
     spi_transaction_t *transaction;
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < slot->transactionCount; i++) {
         esp_err_t result = spi_device_get_trans_result(context->spi, &transaction, portMAX_DELAY);
         assert(result == ESP_OK);
     }
@@ -279,18 +370,23 @@ FfxDisplayContext ffx_display_init(FfxDisplaySpiBus spiBus, uint8_t pinDC,
 
     _Context *context = malloc(sizeof(_Context));
     memset(context, 0, sizeof(_Context));
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < FRAGMENT_BUFFERS; i++) {
         size_t byteCount = DISPLAY_WIDTH * FfxDisplayFragmentHeight * 2;
         uint8_t *data = heap_caps_malloc(byteCount, MALLOC_CAP_DMA);
         assert(data != NULL && (((int)(data)) % 4) == 0);
         memset(data, 0, byteCount);
-        context->fragments[i] = data;
+        context->slots[i].fragment = data;
     }
 
     context->renderFunc = renderFunc;
     context->context = renderContext;
 
-    context->inflightFragment = -1;
+    context->lastSlot = -1;
+
+    // The init sequence sets the window to the whole display, but does
+    // not start a memory write
+    context->writeY = -1;
+    context->windowTop = 0;
 
     // GPIO pins
     context->pinDC = pinDC;
@@ -299,32 +395,6 @@ FfxDisplayContext ffx_display_init(FfxDisplaySpiBus spiBus, uint8_t pinDC,
     // Current top Y coordinate to render
     context->currentY = 0;
 
-    // Setup the Transaction parameters that are the same (ish) for all display updates
-    for (uint32_t i = 0; i < 4; i++) {
-        memset(&(context->transactions[i]), 0, sizeof(spi_transaction_t));
-        context->transactions[i].rx_buffer = NULL;
-        context->transactions[i].flags = SPI_TRANS_USE_TXDATA;
-    }
-
-    // Page Address Set - Command
-    context->transactions[0].length = 8;
-    context->transactions[0].tx_data[0] = CommandRASET;
-    context->transactions[0].user = st7789_wrapTransaction(context, MessageTypeCommand);
-
-    // Page Address Set - Value
-    context->transactions[1].length = 8 * 4;
-    context->transactions[1].user = st7789_wrapTransaction(context, MessageTypeData);
-
-    // Memory Write - Command
-    context->transactions[2].length = 8;
-    context->transactions[2].tx_data[0] = CommandRAMWR;
-    context->transactions[2].user = st7789_wrapTransaction(context, MessageTypeCommand);
-
-    // Memory Write - Value (remove the SPI_TRANS_USE_TXDATA flag)
-    context->transactions[3].length = DISPLAY_WIDTH * 8 * 2 * FfxDisplayFragmentHeight;
-    context->transactions[3].user = st7789_wrapTransaction(context, MessageTypeData);
-    context->transactions[3].flags = 0;
-
     // Get the selected device macro; @TODO: encode this into SPI_BUS
     spi_host_device_t hostDevice = _DECODE_SPI_BUS_HOST(spiBus);
 
@@ -354,8 +424,9 @@ FfxDisplayContext ffx_display_init(FfxDisplaySpiBus spiBus, uint8_t pinDC,
         .mode = 0,                                       // SPI mode 0 (CPOL = 0, CPHA = 0)
         .spics_io_num = _DECODE_SPI_BUS_CS0(spiBus),     // CS pin (Chip Select)
 
-        .queue_size = 7,                                 // Allow 7 in-flight transactions
+        .queue_size = FRAGMENT_TRANSACTIONS * FRAGMENT_BUFFERS, // Allow every slot in flight
         .pre_cb = st7789_spi_pre_transfer_callback,      // Handles the D/C gpio (Data/Command)
+        .post_cb = st7789_spi_post_transfer_callback,    // Notes when each fragment is done
         .flags = 0 //SPI_DEVICE_NO_DUMMY,
     };
 
@@ -409,9 +480,21 @@ FfxDisplayContext ffx_display_init(FfxDisplaySpiBus spiBus, uint8_t pinDC,
 //#define RGB_LO(V)  ((((V) & 0xfc) << 3) | ((V) & 0xf8) >> 3)
 
 // Release the resources for this display driver
-void ffx_display_free(FfxDisplayContext context) {
-    heap_caps_free(((_Context*)context)->fragments[0]);
-    heap_caps_free(((_Context*)context)->fragments[1]);
+void ffx_display_free(FfxDisplayContext _context) {
+    _Context *context = _context;
+
+    // The DMA may still be reading any fragment in flight
+    while (context->inflightCount) {
+        int oldest = context->nextSlot + FRAGMENT_BUFFERS -
+          context->inflightCount;
+        st7789_await_fragment(context,
+          &context->slots[oldest % FRAGMENT_BUFFERS]);
+        context->inflightCount--;
+    }
+
+    for (int i = 0; i < FRAGMENT_BUFFERS; i++) {
+        heap_caps_free(context->slots[i].fragment);
+    }
     free(context);
 }
 
@@ -421,6 +504,12 @@ uint16_t ffx_display_fps(FfxDisplayContext _context) {
     return context->fps;
 }
 
+void ffx_display_getStats(FfxDisplayContext _context,
+        FfxDisplayStats *stats) {
+    _Context *context = _context;
+    *stats = context->stats;
+}
+
 // Render a fragment against the scene graph. This and the scene graph handles
 // snapshots of its state so it can be updated freely.
 uint32_t ffx_display_renderFragment(FfxDisplayContext _context) {
@@ -432,22 +521,51 @@ uint32_t ffx_display_renderFragment(FfxDisplayContext _context) {
     // Advance the fragment starting Y
     uint32_t y0 = context->currentY;
 
-    // Select the free fragment (keep in mind inflightFragment can be -1, 0, or 1)
-    uint8_t backbufferFragment = (context->inflightFragment == 0) ? 1: 0;
+    _Slot *slot = &context->slots[context->nextSlot];
+
+    // Every slot is in flight, so wait for the oldest, which is the next
+    // slot; if the bus has not finished it yet, rendering has stalled
+    if (context->inflightCount == FRAGMENT_BUFFERS) {
+        int64_t t0 = esp_timer_get_time();
+        bool stalled = !slot->done;
 
-    //scene_render(scene, context->fragments[backbufferFragment], y0, DisplayFragmentHeight);
-    context->renderFunc(context->fragments[backbufferFragment], y0, context->context);
+        st7789_await_fragment(context, slot);
+        context->inflightCount--;
 
-    // Wait for the previous (if any; first time does not) transactions to complete
-    if (context->inflightFragment != -1) {
-        st7789_await_fragment(context);
+        int64_t dt = esp_timer_get_time() - t0;
+        if (stalled) {
+            context->stats.renderStalls++;
+            context->stats.renderStallTime += dt;
+        } else {
+            context->stats.submitTime += dt;
+        }
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    context->renderFunc(slot->fragment, y0, context->context);
+    int64_t now = esp_timer_get_time();
+    context->stats.renderTime += now - t0;
+
+    // If the last fragment queued has already finished, the bus has had
+    // nothing to send since; transactions complete in order, so nothing
+    // else is in flight
+    if (context->lastSlot != -1) {
+        _Slot *lastSlot = &context->slots[context->lastSlot];
+        if (lastSlot->done) {
+            context->stats.busIdleTime += (uint32_t)now -
+              lastSlot->doneTime;
+        }
     }
 
-    // Swap inflight with backbuffer fragments
-    context->inflightFragment = backbufferFragment;
+    // Send the new fragment (asynchronously); it is only waited on once
+    // its slot comes around again
+    st7789_asend_fragment(context, slot);
+    context->stats.submitTime += esp_timer_get_time() - now;
 
-    // Send the new fragment we just generated in the backbuffer (asynchronously)
-    st7789_asend_fragment(context);
+    context->lastSlot = context->nextSlot;
+    context->nextSlot = (context->nextSlot + 1) % FRAGMENT_BUFFERS;
+    context->inflightCount++;
+    context->stats.fragments++;
 
     context->currentY += FfxDisplayFragmentHeight;
 
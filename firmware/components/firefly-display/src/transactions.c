@@ -0,0 +1,60 @@
+#include <string.h>
+
+#include "commands.h"
+#include "transactions.h"
+
+
+void* st7789_wrapTransaction(uint8_t pinDC, MessageType dc) {
+    return (void*)((dc << 7) | pinDC);
+}
+
+size_t st7789_buildFragment(spi_transaction_t *transactions, uint8_t pinDC,
+  const uint8_t *fragment, size_t length, FragmentStart start,
+  uint16_t top, uint16_t bottom) {
+
+    spi_transaction_t *windowCommand = &transactions[0];
+    spi_transaction_t *window = &transactions[1];
+    spi_transaction_t *command = &transactions[2];
+    spi_transaction_t *data = &transactions[FRAGMENT_TRANSACTION_DATA];
+
+    memset(transactions, 0,
+      FRAGMENT_TRANSACTIONS * sizeof(spi_transaction_t));
+
+    // Row Address Set - Command
+    windowCommand->length = 8;
+    windowCommand->tx_data[0] = CommandRASET;
+    windowCommand->user = st7789_wrapTransaction(pinDC, MessageTypeCommand);
+    windowCommand->flags = SPI_TRANS_USE_TXDATA;
+
+    // Row Address Set - Value; the first and last rows
+    window->length = 8 * 4;
+    window->tx_data[0] = top >> 8;
+    window->tx_data[1] = top & 0xff;
+    window->tx_data[2] = bottom >> 8;
+    window->tx_data[3] = bottom & 0xff;
+    window->user = st7789_wrapTransaction(pinDC, MessageTypeData);
+    window->flags = SPI_TRANS_USE_TXDATA;
+
+    // Memory Write - Command; restarts at the top-left of the window
+    command->length = 8;
+    command->tx_data[0] = CommandRAMWR;
+    command->user = st7789_wrapTransaction(pinDC, MessageTypeCommand);
+    command->flags = SPI_TRANS_USE_TXDATA;
+
+    // Memory Write - Value
+    data->length = 8 * length;
+    data->tx_buffer = fragment;
+    data->user = (void*)((int)st7789_wrapTransaction(pinDC,
+      MessageTypeData) | MESSAGE_LAST_OF_FRAGMENT);
+
+    switch (start) {
+        case FragmentStartContinue:
+            return 1;
+        case FragmentStartWrite:
+            return 2;
+        case FragmentStartWindow:
+            break;
+    }
+
+    return FRAGMENT_TRANSACTIONS;
+}
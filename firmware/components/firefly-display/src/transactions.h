@@ -0,0 +1,63 @@
+#ifndef __FIREFLY_DISPLAY_TRANSACTIONS_H__
+#define __FIREFLY_DISPLAY_TRANSACTIONS_H__
+
+// Builds the SPI transactions which send fragments to the ST7789. This
+// only fills in transactions and makes no driver calls, so it can be
+// built and tested on a host against a stub of driver/spi_master.h.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <driver/spi_master.h>
+
+
+typedef enum MessageType {
+    MessageTypeCommand      = 0,
+    MessageTypeData         = 1
+} MessageType;
+
+// Marks the last transaction of a fragment, so its completion is noted
+#define MESSAGE_LAST_OF_FRAGMENT    (1 << 8)
+
+// The transactions a fragment may need; moving the top of the row
+// window (RASET command and data), restarting the memory write (RAMWR
+// command) and then the pixel data
+#define FRAGMENT_TRANSACTIONS       (4)
+#define FRAGMENT_TRANSACTION_DATA   (FRAGMENT_TRANSACTIONS - 1)
+
+// How a fragment starts its memory write
+typedef enum FragmentStart {
+    // Continue where the previous fragment left off; only the data
+    FragmentStartContinue   = 0,
+
+    // Restart at the top-left of the window (RAMWR)
+    FragmentStartWrite      = 1,
+
+    // Set the window to begin at the fragment's row, then restart there
+    // (RASET and RAMWR)
+    FragmentStartWindow     = 2,
+} FragmentStart;
+
+
+// Returns the user data for a transaction, which the pre-transfer
+// callback uses to set the D/C pin to %%dc%%.
+void* st7789_wrapTransaction(uint8_t pinDC, MessageType dc);
+
+// Fills %%transactions%% (FRAGMENT_TRANSACTIONS long) to send the
+// %%length%% bytes of %%fragment%%, returning the number to queue,
+// which are the last ones, so the data is always the final transaction.
+//
+// Without another command in between, the display keeps writing the
+// data of each fragment where the previous one left off, so a fragment
+// which directly follows the one queued before it needs only its data
+// (FragmentStartContinue). Otherwise the write is restarted, either at
+// the top of the window (FragmentStartWrite) or, with the window moved
+// to rows %%top%% through %%bottom%% first, at %%top%%
+// (FragmentStartWindow); %%top%% and %%bottom%% are ignored for the
+// others.
+size_t st7789_buildFragment(spi_transaction_t *transactions, uint8_t pinDC,
+  const uint8_t *fragment, size_t length, FragmentStart start,
+  uint16_t top, uint16_t bottom);
+
+#endif /* __FIREFLY_DISPLAY_TRANSACTIONS_H__ */
@@ -0,0 +1,391 @@
+/**
+ *  Host simulation of the fragment ring (see: src/display.c), used to
+ *  choose the number of fragment buffers and the fragment height for a
+ *  given render cost profile.
+ *
+ *  Build and run:
+ *    cc -O2 -o fragment-sim fragment-sim.c
+ *    ./fragment-sim [ uniform | light | labels | spiky | FILE ]
+ *      [ -c CLOCK_MHZ ] [ -t TRANSACTION_US ] [ -f FRAGMENT_US ]
+ *      [ -w WAKE_US ] [ -m MEMORY_KB ]
+ *
+ *  A FILE profile holds 240 numbers, the render cost (in microseconds)
+ *  of each row of the screen.
+ *
+ *  The model is deliberately simple:
+ *    - the ring sends each fragment as a single data transaction, with a
+ *      RAMWR command before the first fragment of each frame, while the
+ *      double buffer sent 4 (RASET command and data, RAMWR command and
+ *      data); each costs a fixed overhead for the queue, ISR and D/C
+ *      toggle on top of its bits at the clock
+ *    - rendering a fragment costs a fixed amount plus the sum of its rows
+ *    - a task blocked on the bus takes a moment to wake once it frees
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define DISPLAY_HEIGHT    (240)
+#define DISPLAY_WIDTH     (240)
+
+#define MAX_BUFFERS       (8)
+
+#define COUNT(v)          ((int)(sizeof(v) / sizeof((v)[0])))
+
+// Frames to settle before measuring, then frames measured
+#define WARMUP_FRAMES     (4)
+#define MEASURE_FRAMES    (16)
+
+
+typedef struct Model {
+    // Render cost of each row (us)
+    double rowCost[DISPLAY_HEIGHT];
+
+    // Fixed render cost of each fragment (us)
+    double fragmentCost;
+
+    // Bus clock (MHz) and the overhead of each transaction (us)
+    double clock;
+    double transactionCost;
+
+    // Latency for a blocked task to resume (us)
+    double wakeCost;
+} Model;
+
+typedef struct Result {
+    // Per frame, once settled (us)
+    double frameTime;
+    double busIdle;
+    double stallTime;
+    double stalls;
+
+    // Fraction of the frame the bus is sending
+    double utilization;
+} Result;
+
+
+//////////////////////////
+// Profiles
+
+static bool loadProfile(Model *model, const char *name) {
+    double base = 0, heavy = 0;
+    int heavyStart = 0, heavyEnd = 0;
+
+    if (strcmp(name, "uniform") == 0) {
+        // A busy scene; about as long to render as to send at 40MHz
+        base = 80;
+
+    } else if (strcmp(name, "light") == 0) {
+        // A few boxes and an image
+        base = 20;
+
+    } else if (strcmp(name, "labels") == 0) {
+        // A band of outlined text across the middle of the screen
+        base = 30;
+        heavy = 250;
+        heavyStart = 96;
+        heavyEnd = 144;
+
+    } else if (strcmp(name, "spiky") == 0) {
+        // A single expensive strip (such as a rotated sprite)
+        base = 40;
+        heavy = 400;
+        heavyStart = 200;
+        heavyEnd = 224;
+
+    } else {
+        FILE *file = fopen(name, "r");
+        if (file == NULL) {
+            printf("unknown profile: %s\n", name);
+            return false;
+        }
+
+        for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+            if (fscanf(file, "%lf", &model->rowCost[y]) != 1) {
+                printf("profile needs %d rows: %s\n", DISPLAY_HEIGHT, name);
+                fclose(file);
+                return false;
+            }
+        }
+
+        fclose(file);
+        return true;
+    }
+
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        bool isHeavy = (y >= heavyStart && y < heavyEnd);
+        model->rowCost[y] = isHeavy ? heavy: base;
+    }
+
+    return true;
+}
+
+
+//////////////////////////
+// Simulation
+
+static double getBusTime(const Model *model, int height, int transactions,
+  int commandBytes) {
+    double bits = 8 * (commandBytes + DISPLAY_WIDTH * height * 2);
+    return (transactions * model->transactionCost) + (bits / model->clock);
+}
+
+// The first fragment of a frame starts the memory write (RAMWR) and
+// every other fragment continues it with only its data
+static double getRingBusTime(const Model *model, int height, bool first) {
+    if (first) { return getBusTime(model, height, 2, 1); }
+    return getBusTime(model, height, 1, 0);
+}
+
+// Each fragment set its rows (RASET, 1 + 4 bytes) and then wrote them
+// (RAMWR, 1 byte + pixels)
+static double getDoubleBusTime(const Model *model, int height) {
+    return getBusTime(model, height, 4, 6);
+}
+
+static double getRenderTime(const Model *model, int y0, int height) {
+    double result = model->fragmentCost;
+    for (int y = y0; y < y0 + height; y++) { result += model->rowCost[y]; }
+    return result;
+}
+
+// Simulates the ring of %%count%% buffers; each buffer is waited for
+// only once the next fragment needs it, and is queued as soon as it
+// is rendered
+static Result simulateRing(const Model *model, int count, int height) {
+    int fragments = DISPLAY_HEIGHT / height;
+    double busTotal = getRingBusTime(model, height, true) +
+      (fragments - 1) * getRingBusTime(model, height, false);
+
+    // The time each buffer in flight completes, oldest first
+    double done[MAX_BUFFERS];
+    int inflight = 0;
+
+    double now = 0, busFree = 0, frameStart = 0;
+    bool sent = false;
+
+    Result result = { 0 };
+
+    for (int frame = 0; frame < WARMUP_FRAMES + MEASURE_FRAMES; frame++) {
+        bool measure = (frame >= WARMUP_FRAMES);
+
+        for (int f = 0; f < fragments; f++) {
+
+            // Every buffer is in flight; wait for the oldest
+            if (inflight == count) {
+                if (done[0] > now) {
+                    if (measure) {
+                        result.stalls++;
+                        result.stallTime += done[0] - now + model->wakeCost;
+                    }
+                    now = done[0] + model->wakeCost;
+                }
+
+                memmove(&done[0], &done[1], (count - 1) * sizeof(double));
+                inflight--;
+            }
+
+            now += getRenderTime(model, f * height, height);
+
+            double start = (busFree > now) ? busFree: now;
+            if (sent && measure) { result.busIdle += start - busFree; }
+
+            busFree = start + getRingBusTime(model, height, f == 0);
+            done[inflight++] = busFree;
+            sent = true;
+        }
+
+        // Frames are measured by when their last fragment is sent
+        if (frame == WARMUP_FRAMES - 1) { frameStart = busFree; }
+    }
+
+    result.frameTime = (busFree - frameStart) / MEASURE_FRAMES;
+    result.busIdle /= MEASURE_FRAMES;
+    result.stallTime /= MEASURE_FRAMES;
+    result.stalls /= MEASURE_FRAMES;
+    result.utilization = busTotal / result.frameTime;
+
+    return result;
+}
+
+// Simulates the previous double buffer, which rendered the next fragment
+// and then waited for the one in flight before queueing it
+static Result simulateDouble(const Model *model, int height) {
+    double busTime = getDoubleBusTime(model, height);
+    int fragments = DISPLAY_HEIGHT / height;
+
+    double now = 0, busFree = 0, frameStart = 0;
+    bool sent = false;
+
+    Result result = { 0 };
+
+    for (int frame = 0; frame < WARMUP_FRAMES + MEASURE_FRAMES; frame++) {
+        bool measure = (frame >= WARMUP_FRAMES);
+
+        for (int f = 0; f < fragments; f++) {
+            now += getRenderTime(model, f * height, height);
+
+            if (sent && busFree > now) {
+                if (measure) {
+                    result.stalls++;
+                    result.stallTime += busFree - now + model->wakeCost;
+                }
+                now = busFree + model->wakeCost;
+            }
+
+            if (sent && measure) { result.busIdle += now - busFree; }
+
+            busFree = now + busTime;
+            sent = true;
+        }
+
+        if (frame == WARMUP_FRAMES - 1) { frameStart = busFree; }
+    }
+
+    result.frameTime = (busFree - frameStart) / MEASURE_FRAMES;
+    result.busIdle /= MEASURE_FRAMES;
+    result.stallTime /= MEASURE_FRAMES;
+    result.stalls /= MEASURE_FRAMES;
+    result.utilization = (fragments * busTime) / result.frameTime;
+
+    return result;
+}
+
+
+//////////////////////////
+// Report
+
+static void printResult(const char *name, int count, int height,
+  Result result) {
+
+    size_t memory = count * DISPLAY_WIDTH * height * 2;
+
+    printf("%-7s %3d %7.1f %6.1f %8.2f %8.2f %6.1f %6.1f%%\n", name,
+      height, memory / 1024.0f, 1000000 / result.frameTime,
+      result.frameTime / 1000, result.busIdle / 1000, result.stalls,
+      100 * result.utilization);
+}
+
+int main(int argc, char **argv) {
+    static const int heights[] = { 8, 10, 12, 15, 16, 20, 24, 30, 40, 48 };
+    static const int counts[] = { 2, 3, 4, 6 };
+
+    Model model = {
+        .fragmentCost = 100,
+        .clock = 40,
+        .transactionCost = 15,
+        .wakeCost = 20
+    };
+
+    const char *profile = "uniform";
+
+    // The fragment buffer budget (KB) to suggest the fastest for
+    double memoryBudget = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            profile = argv[i];
+            continue;
+        }
+
+        if (i + 1 == argc) {
+            printf("missing value: %s\n", argv[i]);
+            return 1;
+        }
+
+        double value = atof(argv[++i]);
+        switch (argv[i - 1][1]) {
+            case 'c': model.clock = value; break;
+            case 't': model.transactionCost = value; break;
+            case 'f': model.fragmentCost = value; break;
+            case 'w': model.wakeCost = value; break;
+            case 'm': memoryBudget = value; break;
+            default:
+                printf("unknown option: %s\n", argv[i - 1]);
+                return 1;
+        }
+    }
+
+    if (!loadProfile(&model, profile)) { return 1; }
+
+    double renderTotal = 0;
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        renderTotal += model.rowCost[y];
+    }
+
+    printf("profile=%s rows=%.2fms clock=%.0fMHz transaction=%.0fus "
+      "fragment=%.0fus wake=%.0fus\n\n", profile, renderTotal / 1000,
+      model.clock, model.transactionCost, model.fragmentCost,
+      model.wakeCost);
+
+    printf("buffers height  mem-KB    fps frame-ms  idle-ms stalls   "
+      "bus\n");
+
+    // The best rate at any configuration, to suggest the smallest
+    // configuration which comes close
+    double best = 0;
+    Result results[COUNT(counts)][COUNT(heights)];
+
+    for (int h = 0; h < COUNT(heights); h++) {
+        if (DISPLAY_HEIGHT % heights[h]) { continue; }
+        printResult("double", 2, heights[h],
+          simulateDouble(&model, heights[h]));
+    }
+
+    for (int c = 0; c < COUNT(counts); c++) {
+        printf("\n");
+        for (int h = 0; h < COUNT(heights); h++) {
+            Result result = simulateRing(&model, counts[c], heights[h]);
+            results[c][h] = result;
+
+            char name[8];
+            snprintf(name, sizeof(name), "ring-%d", counts[c]);
+            printResult(name, counts[c], heights[h], result);
+
+            if (1 / result.frameTime > best) { best = 1 / result.frameTime; }
+        }
+    }
+
+    int smallCount = 0, smallHeight = 0;
+    int fastCount = 0, fastHeight = 0;
+    double fastRate = 0;
+
+    for (int c = 0; c < COUNT(counts); c++) {
+        for (int h = 0; h < COUNT(heights); h++) {
+            double rate = 1 / results[c][h].frameTime;
+            int rows = counts[c] * heights[h];
+
+            if (rate >= 0.98 * best && (smallCount == 0 ||
+              rows < smallCount * smallHeight)) {
+                smallCount = counts[c];
+                smallHeight = heights[h];
+            }
+
+            double memory = rows * DISPLAY_WIDTH * 2 / 1024.0f;
+            if (memoryBudget && memory > memoryBudget) { continue; }
+
+            if (rate > fastRate || (rate == fastRate &&
+              rows < fastCount * fastHeight)) {
+                fastRate = rate;
+                fastCount = counts[c];
+                fastHeight = heights[h];
+            }
+        }
+    }
+
+    printf("\nsmallest within 2%% of the best rate: %d buffers of %d rows "
+      "(%.1f KB)\n", smallCount, smallHeight,
+      smallCount * DISPLAY_WIDTH * smallHeight * 2 / 1024.0f);
+
+    if (memoryBudget && fastCount) {
+        printf("fastest within %.1f KB: %d buffers of %d rows (%.1f KB)\n",
+          memoryBudget, fastCount, fastHeight,
+          fastCount * DISPLAY_WIDTH * fastHeight * 2 / 1024.0f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include "test.h"
+
+#include "commands.h"
+#include "transactions.h"
+
+// Fragment transactions (see: ../../src/transactions.c)
+//
+// - a continued fragment is only its data, a restarted one is RAMWR
+//   then the data, and one which moves the window is RASET (with its
+//   rows) and RAMWR then the data; the data is always last and is the
+//   only transaction marked as the last of its fragment
+// - each transaction sets the D/C pin for its type
+// - sent to a panel, a frame of one restart and continued fragments
+//   lands row for row, a continued fragment after a lost one lands on
+//   the wrong rows and moving the window puts it back on the right ones
+
+
+#define PIN_DC           (4)
+
+#define FRAGMENT_HEIGHT  (24)
+#define FRAGMENT_COUNT   (PANEL_HEIGHT / FRAGMENT_HEIGHT)
+#define FRAGMENT_LENGTH  (PANEL_WIDTH * FRAGMENT_HEIGHT * 2)
+
+static uint16_t fragments[FRAGMENT_COUNT][PANEL_WIDTH * FRAGMENT_HEIGHT];
+static spi_transaction_t transactions[FRAGMENT_COUNT][FRAGMENT_TRANSACTIONS];
+
+static uint32_t getLevel(spi_transaction_t *transaction) {
+    return ((int)transaction->user >> 7) & 0x01;
+}
+
+static uint32_t getPin(spi_transaction_t *transaction) {
+    return (int)transaction->user & 0x7f;
+}
+
+static bool isLast(spi_transaction_t *transaction) {
+    return ((int)transaction->user & MESSAGE_LAST_OF_FRAGMENT) != 0;
+}
+
+
+//////////////////////////
+// Transactions
+
+static void checkCommand(spi_transaction_t *transaction, uint8_t command) {
+    checkEqual(transaction->length, 8);
+    check(transaction->flags & SPI_TRANS_USE_TXDATA);
+    checkEqual(transaction->tx_data[0], command);
+    checkEqual(getLevel(transaction), MessageTypeCommand);
+    checkEqual(getPin(transaction), PIN_DC);
+    check(!isLast(transaction));
+}
+
+static void checkData(spi_transaction_t *transaction) {
+    checkEqual(transaction->length, 8 * FRAGMENT_LENGTH);
+    check(!(transaction->flags & SPI_TRANS_USE_TXDATA));
+    check(transaction->tx_buffer == fragments[0]);
+    checkEqual(getLevel(transaction), MessageTypeData);
+    checkEqual(getPin(transaction), PIN_DC);
+    check(isLast(transaction));
+}
+
+static void testBuild(void) {
+    spi_transaction_t *built = transactions[0];
+    const uint8_t *fragment = (uint8_t*)fragments[0];
+
+    size_t count = st7789_buildFragment(built, PIN_DC, fragment,
+      FRAGMENT_LENGTH, FragmentStartContinue, 0, 0);
+    checkEqual(count, 1);
+    checkData(&built[FRAGMENT_TRANSACTION_DATA]);
+
+    count = st7789_buildFragment(built, PIN_DC, fragment, FRAGMENT_LENGTH,
+      FragmentStartWrite, 0, 0);
+    checkEqual(count, 2);
+    checkCommand(&built[FRAGMENT_TRANSACTIONS - 2], CommandRAMWR);
+    checkData(&built[FRAGMENT_TRANSACTION_DATA]);
+
+    // The rows are big-endian and inclusive
+    count = st7789_buildFragment(built, PIN_DC, fragment, FRAGMENT_LENGTH,
+      FragmentStartWindow, 0x0148, 0x013f);
+    checkEqual(count, FRAGMENT_TRANSACTIONS);
+    checkEqual(count, 4);
+    checkCommand(&built[0], CommandRASET);
+
+    spi_transaction_t *window = &built[1];
+    checkEqual(window->length, 32);
+    check(window->flags & SPI_TRANS_USE_TXDATA);
+    check(memcmp(window->tx_data, "\x01\x48\x01\x3f", 4) == 0);
+    checkEqual(getLevel(window), MessageTypeData);
+    check(!isLast(window));
+
+    checkCommand(&built[2], CommandRAMWR);
+    checkData(&built[FRAGMENT_TRANSACTION_DATA]);
+
+    checkEqual((int)st7789_wrapTransaction(0x2a, MessageTypeData), 0xaa);
+    checkEqual((int)st7789_wrapTransaction(0x2a, MessageTypeCommand), 0x2a);
+}
+
+
+//////////////////////////
+// Panel
+
+static spi_device_handle_t device;
+
+// The same as the display driver's
+static void preTransfer(spi_transaction_t *transaction) {
+    bus_setLevel(getPin(transaction), getLevel(transaction));
+}
+
+static void render(uint32_t frame) {
+    for (int f = 0; f < FRAGMENT_COUNT; f++) {
+        for (int i = 0; i < PANEL_WIDTH * FRAGMENT_HEIGHT; i++) {
+            fragments[f][i] = testPixel(frame, i % PANEL_WIDTH,
+              f * FRAGMENT_HEIGHT + i / PANEL_WIDTH);
+        }
+    }
+}
+
+static void queue(int f, FragmentStart start, uint16_t top) {
+    spi_transaction_t *built = transactions[f];
+    size_t count = st7789_buildFragment(built, PIN_DC,
+      (uint8_t*)fragments[f], FRAGMENT_LENGTH, start, top,
+      PANEL_HEIGHT - 1);
+
+    for (int i = FRAGMENT_TRANSACTIONS - count; i < FRAGMENT_TRANSACTIONS;
+      i++) {
+        checkEqual(spi_device_queue_trans(device, &built[i], portMAX_DELAY),
+          ESP_OK);
+    }
+}
+
+static void drain(void) {
+    spi_transaction_t *transaction;
+    while (bus_pending()) {
+        checkEqual(spi_device_get_trans_result(device, &transaction,
+          portMAX_DELAY), ESP_OK);
+    }
+}
+
+static void testPanel(void) {
+    bus_reset();
+
+    spi_device_interface_config_t config = {
+        .clock_speed_hz = SPI_MASTER_FREQ_80M,
+        .queue_size = FRAGMENT_COUNT * FRAGMENT_TRANSACTIONS,
+        .pre_cb = preTransfer
+    };
+    checkEqual(spi_bus_add_device(SPI2_HOST, &config, &device), ESP_OK);
+
+    // One restart, then continued
+    render(1);
+    queue(0, FragmentStartWrite, 0);
+    for (int f = 1; f < FRAGMENT_COUNT; f++) {
+        queue(f, FragmentStartContinue, 0);
+    }
+    drain();
+    checkEqual(testPanelFrame(1), -1);
+
+    BusStats stats;
+    bus_getStats(&stats);
+    checkEqual(stats.transactions, FRAGMENT_COUNT + 1);
+    checkEqual(stats.memoryWrites, 1);
+    checkEqual(stats.rowSets, 0);
+
+    // A lost fragment shifts every continued one after it up
+    render(2);
+    queue(0, FragmentStartWrite, 0);
+    for (int f = 1; f < FRAGMENT_COUNT; f++) {
+        if (f != 4) { queue(f, FragmentStartContinue, 0); }
+    }
+    drain();
+    check(testPanelFrame(2) == 4 * FRAGMENT_HEIGHT);
+    checkEqual(bus_panel()[4 * FRAGMENT_HEIGHT * PANEL_WIDTH],
+      testPixel(2, 0, 5 * FRAGMENT_HEIGHT));
+
+    // Moving the window to the next fragment's row puts it back; only
+    // the lost rows keep what was there before
+    render(3);
+    queue(0, FragmentStartWrite, 0);
+    for (int f = 1; f < FRAGMENT_COUNT; f++) {
+        if (f == 4) { continue; }
+        if (f == 5) {
+            queue(f, FragmentStartWindow, f * FRAGMENT_HEIGHT);
+        } else {
+            queue(f, FragmentStartContinue, 0);
+        }
+    }
+    drain();
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        bool lost = (y >= 4 * FRAGMENT_HEIGHT && y < 5 * FRAGMENT_HEIGHT);
+        checkEqual(testPanelRow(3, y), !lost);
+    }
+
+    // With the window moved, a restart at the top must move it back
+    render(4);
+    queue(0, FragmentStartWindow, 0);
+    for (int f = 1; f < FRAGMENT_COUNT; f++) {
+        queue(f, FragmentStartContinue, 0);
+    }
+    drain();
+    checkEqual(testPanelFrame(4), -1);
+
+    bus_getStats(&stats);
+    checkEqual(stats.rowSets, 2);
+}
+
+
+int main(void) {
+    testBuild();
+    testPanel();
+    return 0;
+}
@@ -0,0 +1,284 @@
+#include "test.h"
+
+// The fragment ring (see: ../../src/display.c)
+//
+// - every frame lands on the panel row for row, with one RAMWR per
+//   frame and every other fragment sent as only its data
+// - a buffer is never rendered while the bus may still read it, and
+//   up to every buffer is queued at once
+// - a fragment which fails to queue leaves only its own rows behind;
+//   the next fragment moves the window to its row, and the next frame
+//   moves it back
+// - the statistics account for the render time, stalls and bus idle
+// - freeing the display waits for the fragments in flight
+// - frame time, bus utilization and driver CPU per frame, for the
+//   render cost profiles of tools/fragment-sim.c
+
+
+#define PIN_DC           (4)
+#define PIN_RESET        (5)
+
+typedef struct Ring {
+    FfxDisplayContext display;
+
+    // The frame being rendered, starting at 1 (the panel starts at 0)
+    uint32_t frame;
+
+    // Render cost of each row and of each fragment (us)
+    double rowCost[PANEL_HEIGHT];
+    double fragmentCost;
+} Ring;
+
+static void render(uint8_t *buffer, uint32_t y0, void *context) {
+    Ring *ring = context;
+
+    check(!bus_inFlight(buffer));
+
+    if (y0 == 0) { ring->frame++; }
+
+    uint16_t *pixels = (uint16_t*)buffer;
+    double cost = ring->fragmentCost;
+    for (int y = 0; y < FfxDisplayFragmentHeight; y++) {
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            *pixels++ = testPixel(ring->frame, x, y0 + y);
+        }
+        cost += ring->rowCost[y0 + y];
+    }
+
+    bus_advance(cost);
+}
+
+static void createRing(Ring *ring, double rowCost) {
+    memset(ring, 0, sizeof(Ring));
+    for (int y = 0; y < PANEL_HEIGHT; y++) { ring->rowCost[y] = rowCost; }
+
+    bus_reset();
+    ring->display = ffx_display_init(FfxDisplaySpiBus2_nocs, PIN_DC,
+      PIN_RESET, FfxDisplayRotationRibbonRight, render, ring);
+    check(ring->display != NULL);
+}
+
+static void renderFrame(Ring *ring) {
+    for (int i = 0; i < FfxDisplayFragmentCount; i++) {
+        uint32_t done = ffx_display_renderFragment(ring->display);
+        checkEqual(done, (i == FfxDisplayFragmentCount - 1));
+    }
+}
+
+static uint32_t getTransactions(Ring *ring) {
+    FfxDisplayStats stats;
+    ffx_display_getStats(ring->display, &stats);
+    return stats.transactions;
+}
+
+
+//////////////////////////
+// Frames
+
+static void testFrames(void) {
+    Ring ring;
+    createRing(&ring, 0);
+
+    BusStats init;
+    bus_getStats(&init);
+
+    for (int f = 1; f <= 5; f++) {
+        uint32_t transactions = getTransactions(&ring);
+        renderFrame(&ring);
+        checkEqual(getTransactions(&ring) - transactions,
+          FfxDisplayFragmentCount + 1);
+
+        // The last fragments are still in flight
+        check(testPanelFrame(f) != -1);
+        bus_flush();
+        checkEqual(testPanelFrame(f), -1);
+    }
+
+    BusStats stats;
+    bus_getStats(&stats);
+    checkEqual(stats.memoryWrites - init.memoryWrites, 5);
+    checkEqual(stats.rowSets, init.rowSets);
+    checkEqual(stats.transactions - init.transactions, getTransactions(&ring));
+
+    // Rendering is free, so the ring fills; each buffer's data and the
+    // frame's RAMWR
+    checkEqual(stats.maxQueued, FfxDisplayFragmentBuffers + 1);
+
+    ffx_display_free(ring.display);
+    checkEqual(bus_pending(), 0);
+}
+
+
+//////////////////////////
+// Failures
+
+static void testFailure(void) {
+    Ring ring;
+    createRing(&ring, 10);
+
+    renderFrame(&ring);
+
+    // The data of the fifth fragment; the first is RAMWR and its data
+    bus_failIn(6);
+    uint32_t transactions = getTransactions(&ring);
+    renderFrame(&ring);
+    bus_flush();
+
+    int lost = 4 * FfxDisplayFragmentHeight;
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        bool isLost = (y >= lost && y < lost + FfxDisplayFragmentHeight);
+        checkEqual(testPanelRow(isLost ? 1: 2, y), true);
+    }
+
+    // Less the lost data, plus RASET and RAMWR for the next fragment
+    checkEqual(getTransactions(&ring) - transactions,
+      FfxDisplayFragmentCount + 1 - 1 + 3);
+
+    // The next frame moves the window back to the top
+    transactions = getTransactions(&ring);
+    renderFrame(&ring);
+    bus_flush();
+    checkEqual(testPanelFrame(3), -1);
+    checkEqual(getTransactions(&ring) - transactions,
+      FfxDisplayFragmentCount + 3);
+
+    // And the one after is back to a single RAMWR
+    transactions = getTransactions(&ring);
+    renderFrame(&ring);
+    bus_flush();
+    checkEqual(testPanelFrame(4), -1);
+    checkEqual(getTransactions(&ring) - transactions,
+      FfxDisplayFragmentCount + 1);
+
+    // A failed RAMWR at the top of a frame loses the first fragment
+    bus_failIn(1);
+    renderFrame(&ring);
+    bus_flush();
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        bool isLost = (y < FfxDisplayFragmentHeight);
+        checkEqual(testPanelRow(isLost ? 4: 5, y), true);
+    }
+
+    renderFrame(&ring);
+    bus_flush();
+    checkEqual(testPanelFrame(6), -1);
+
+    ffx_display_free(ring.display);
+    checkEqual(bus_pending(), 0);
+}
+
+
+//////////////////////////
+// Statistics
+
+static void testStats(void) {
+    Ring ring;
+
+    // Rendering is free, so every fragment once the ring is full waits
+    // for a buffer, and the bus is never idle
+    createRing(&ring, 0);
+    for (int f = 0; f < 4; f++) { renderFrame(&ring); }
+
+    FfxDisplayStats stats;
+    ffx_display_getStats(ring.display, &stats);
+    checkEqual(stats.fragments, 4 * FfxDisplayFragmentCount);
+    checkEqual(stats.renderStalls,
+      4 * FfxDisplayFragmentCount - FfxDisplayFragmentBuffers);
+    check(stats.renderStallTime > 0);
+    checkEqual(stats.busIdleTime, 0);
+    checkEqual(stats.renderTime, 0);
+    ffx_display_free(ring.display);
+
+    // Rendering is far slower than sending; nothing stalls and the bus
+    // idles for the rest of each render
+    createRing(&ring, 200);
+    ring.fragmentCost = 100;
+    for (int f = 0; f < 4; f++) { renderFrame(&ring); }
+
+    ffx_display_getStats(ring.display, &stats);
+    checkEqual(stats.renderStalls, 0);
+
+    // The timer is in whole microseconds
+    int renderTime = 4 * FfxDisplayFragmentCount *
+      (100 + 200 * FfxDisplayFragmentHeight);
+    check(abs((int)stats.renderTime - renderTime) <= stats.fragments);
+    check(stats.busIdleTime > stats.renderTime / 2);
+    check(stats.busIdleTime < stats.renderTime);
+    check(stats.submitTime > 0);
+    ffx_display_free(ring.display);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static void testFree(void) {
+    Ring ring;
+    createRing(&ring, 0);
+
+    // Mid-frame, with every buffer in flight
+    renderFrame(&ring);
+    for (int i = 0; i < 3; i++) { ffx_display_renderFragment(ring.display); }
+    check(bus_pending() > 0);
+
+    ffx_display_free(ring.display);
+    checkEqual(bus_pending(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define WARMUP_FRAMES    (4)
+#define MEASURE_FRAMES   (16)
+
+static void benchmarkProfile(const char *name, double base, double heavy,
+  int heavyStart, int heavyEnd) {
+
+    Ring ring;
+    createRing(&ring, base);
+    ring.fragmentCost = 100;
+    for (int y = heavyStart; y < heavyEnd; y++) { ring.rowCost[y] = heavy; }
+
+    for (int f = 0; f < WARMUP_FRAMES; f++) { renderFrame(&ring); }
+
+    BusStats start;
+    bus_getStats(&start);
+    double t0 = bus_now();
+
+    for (int f = 0; f < MEASURE_FRAMES; f++) { renderFrame(&ring); }
+
+    BusStats end;
+    bus_getStats(&end);
+    double frameTime = (bus_now() - t0) / MEASURE_FRAMES;
+    double busy = (end.busyTime - start.busyTime) / MEASURE_FRAMES;
+    double cpu = (end.driverTime - start.driverTime) / MEASURE_FRAMES;
+    double transactions = (double)(end.transactions - start.transactions) /
+      MEASURE_FRAMES;
+
+    printf("bench:   %-8s %6.2fms (%4.1ffps) bus %5.1f%% driver CPU "
+      "%3.0fus/frame %4.1f transactions/frame\n", name, frameTime / 1000,
+      1e6 / frameTime, 100 * busy / frameTime, cpu, transactions);
+
+    ffx_display_free(ring.display);
+}
+
+static void benchmark(void) {
+    printf("bench: %d buffers of 240x%d at 80MHz, in virtual time\n",
+      FfxDisplayFragmentBuffers, FfxDisplayFragmentHeight);
+
+    benchmarkProfile("light", 20, 0, 0, 0);
+    benchmarkProfile("uniform", 80, 0, 0, 0);
+    benchmarkProfile("labels", 30, 250, 96, 144);
+    benchmarkProfile("spiky", 40, 400, 200, 224);
+}
+
+
+int main(void) {
+    testFrames();
+    testFailure();
+    testStats();
+    testFree();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,58 @@
+#!/bin/sh
+
+# Builds and runs the host tests against the firefly-display sources,
+# with the ESP-IDF drivers replaced by a mock SPI bus (see: shim/bus.c).
+#
+# Usage (from any folder):
+#   ./run.sh [ TEST ... ]
+#
+# Each TEST is a file in this folder, without the .c (e.g. builder); by
+# default every test is run. Tests are built with ASan, LSan and UBSan
+# and stop at the first failed check, which fails the run.
+#
+# Tests which include a benchmark print their figures, which are in the
+# bus's virtual time, so they do not depend on the host.
+
+cd "$(dirname "$0")" || exit 1
+
+BUILD=build
+INCLUDES="-I shim -I ../../include -I ../../src"
+
+FLAGS="-O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all"
+
+# The sources pack the D/C pin into each transaction's user pointer,
+# as an int (which is pointer-sized on the device)
+CFLAGS="-std=gnu17 -DCONFIG_IDF_TARGET_ESP32C3=1 $FLAGS $INCLUDES \
+  -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast"
+
+if [ $# -eq 0 ]; then
+    set -- $(ls *.c | sed 's/\.c$//')
+fi
+
+mkdir -p "$BUILD/obj"
+
+# The display sources are built once and shared by every test
+for source in ../../src/*.c shim/bus.c; do
+    object="$BUILD/obj/$(basename "$source" .c).o"
+    gcc $CFLAGS -c -o "$object" "$source" || exit 1
+done
+
+failed=""
+for test in "$@"; do
+    echo "== $test"
+    if ! gcc $CFLAGS -Wall -o "$BUILD/$test" "$test.c" "$BUILD"/obj/*.o; then
+        failed="$failed $test"
+        continue
+    fi
+
+    if ! "./$BUILD/$test"; then
+        failed="$failed $test"
+    fi
+done
+
+if [ -n "$failed" ]; then
+    echo "FAILED:$failed"
+    exit 1
+fi
+
+echo "PASSED"
@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/spi_master.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "soc/gpio_struct.h"
+
+#include "bus.h"
+
+// Transactions are sent one after another, each taking a fixed overhead
+// plus its bits at the device clock. A transaction completes once the
+// virtual clock passes its end; the pre- and post-transfer callbacks
+// then run (as the ISR would), and its bytes are applied to the panel.
+//
+// The panel follows the ST7789: RASET and CASET set the window, RAMWR
+// starts writing at its top-left, and the data which follows fills the
+// window row by row, wrapping back to the top. Any other command ends
+// the write, and data outside a write is ignored.
+//
+// Anything the real driver would block on forever (a full queue, or a
+// result with nothing queued) is fatal.
+
+
+#define MAX_QUEUED           (64)
+
+#define COMMAND_CASET        (0x2a)
+#define COMMAND_RASET        (0x2b)
+#define COMMAND_RAMWR        (0x2c)
+
+struct gpio_dev_t {
+    int unused;
+};
+
+gpio_dev_t GPIO;
+
+BusModel busModel = {
+    .transactionCost = 15,
+    .queueCost = 8,
+    .resultCost = 3,
+    .wakeCost = 20
+};
+
+typedef struct Queued {
+    spi_transaction_t *transaction;
+    double end;
+} Queued;
+
+typedef struct Panel {
+    uint16_t pixels[PANEL_WIDTH * PANEL_HEIGHT];
+
+    // The D/C level, set by the pre-transfer callback
+    uint32_t level;
+
+    uint8_t command;
+    uint8_t params[4];
+    int paramCount;
+
+    // The window (inclusive) and the write position within it
+    int left, right, top, bottom;
+    int x, y;
+    bool writing;
+} Panel;
+
+static struct {
+    double now;
+    double end;
+
+    double clock;
+    int queueSize;
+    transaction_cb_t preCallback;
+    transaction_cb_t postCallback;
+
+    // Sent are [head, sent), queued and unsent are [sent, tail)
+    Queued queue[MAX_QUEUED];
+    uint32_t head, sent, tail;
+    bool sending;
+
+    uint32_t failIn;
+
+    BusStats stats;
+    Panel panel;
+} bus;
+
+
+static void fatal(const char *message) {
+    printf("bus: %s\n", message);
+    exit(1);
+}
+
+
+//////////////////////////
+// Panel
+
+static void writePixels(Panel *panel, const uint8_t *data, size_t length) {
+    if (length % 2) { fatal("odd pixel data"); }
+
+    for (size_t i = 0; i < length; i += 2) {
+        if (panel->x < PANEL_WIDTH && panel->y < PANEL_HEIGHT) {
+            memcpy(&panel->pixels[panel->y * PANEL_WIDTH + panel->x],
+              &data[i], 2);
+        }
+
+        if (panel->x++ < panel->right) { continue; }
+        panel->x = panel->left;
+        if (panel->y++ < panel->bottom) { continue; }
+        panel->y = panel->top;
+    }
+}
+
+static void applyParams(Panel *panel) {
+    int first = (panel->params[0] << 8) | panel->params[1];
+    int last = (panel->params[2] << 8) | panel->params[3];
+
+    if (panel->command == COMMAND_CASET) {
+        panel->left = first;
+        panel->right = last;
+    } else {
+        panel->top = first;
+        panel->bottom = last;
+    }
+}
+
+static void applyTransaction(spi_transaction_t *transaction) {
+    Panel *panel = &bus.panel;
+
+    const uint8_t *data = transaction->tx_buffer;
+    if (transaction->flags & SPI_TRANS_USE_TXDATA) {
+        data = transaction->tx_data;
+    }
+    size_t length = transaction->length / 8;
+
+    if (panel->level == 0) {
+        if (length != 1) { fatal("command of more than one byte"); }
+
+        panel->command = data[0];
+        panel->paramCount = 0;
+        panel->writing = (panel->command == COMMAND_RAMWR);
+
+        if (panel->command == COMMAND_RASET) { bus.stats.rowSets++; }
+        if (panel->writing) {
+            bus.stats.memoryWrites++;
+            panel->x = panel->left;
+            panel->y = panel->top;
+        }
+        return;
+    }
+
+    if (panel->writing) {
+        writePixels(panel, data, length);
+        return;
+    }
+
+    if (panel->command == COMMAND_CASET || panel->command == COMMAND_RASET) {
+        for (size_t i = 0; i < length && panel->paramCount < 4; i++) {
+            panel->params[panel->paramCount++] = data[i];
+        }
+        if (panel->paramCount == 4) { applyParams(panel); }
+    }
+}
+
+void bus_setLevel(int pin, uint32_t level) {
+    bus.panel.level = level;
+}
+
+
+//////////////////////////
+// Clock
+
+static double duration(spi_transaction_t *transaction) {
+    return busModel.transactionCost + transaction->length / bus.clock;
+}
+
+// Completes, in order, every transaction which ends by %%now%%
+static void process(void) {
+    if (bus.sending) { return; }
+    bus.sending = true;
+
+    double now = bus.now;
+    while (bus.sent != bus.tail) {
+        Queued *queued = &bus.queue[bus.sent % MAX_QUEUED];
+        if (queued->end > now) { break; }
+
+        // The callbacks run at the end of the transaction
+        bus.now = queued->end;
+        if (bus.preCallback) { bus.preCallback(queued->transaction); }
+        applyTransaction(queued->transaction);
+        if (bus.postCallback) { bus.postCallback(queued->transaction); }
+
+        bus.sent++;
+    }
+    bus.now = now;
+
+    bus.sending = false;
+}
+
+void bus_reset(void) {
+    memset(&bus, 0, sizeof(bus));
+    bus.panel.right = PANEL_WIDTH - 1;
+    bus.panel.bottom = PANEL_HEIGHT - 1;
+}
+
+double bus_now(void) {
+    return bus.now;
+}
+
+void bus_advance(double duration) {
+    bus.now += duration;
+    process();
+}
+
+void bus_flush(void) {
+    if (bus.sent != bus.tail) {
+        bus.now = bus.queue[(bus.tail - 1) % MAX_QUEUED].end;
+    }
+    process();
+}
+
+bool bus_inFlight(const void *buffer) {
+    process();
+    for (uint32_t i = bus.sent; i != bus.tail; i++) {
+        spi_transaction_t *transaction = bus.queue[i % MAX_QUEUED].transaction;
+        if (transaction->flags & SPI_TRANS_USE_TXDATA) { continue; }
+        if (transaction->tx_buffer == buffer) { return true; }
+    }
+    return false;
+}
+
+uint32_t bus_pending(void) {
+    return bus.tail - bus.head;
+}
+
+void bus_failIn(uint32_t count) {
+    bus.failIn = count;
+}
+
+const uint16_t* bus_panel(void) {
+    return bus.panel.pixels;
+}
+
+void bus_getStats(BusStats *stats) {
+    *stats = bus.stats;
+}
+
+int64_t esp_timer_get_time(void) {
+    process();
+    return (int64_t)bus.now;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return bus.now / 1000;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    bus_advance(ticks * 1000.0);
+}
+
+
+//////////////////////////
+// SPI master
+
+esp_err_t spi_bus_initialize(spi_host_device_t host,
+  const spi_bus_config_t *config, int dmaChannel) {
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host,
+  const spi_device_interface_config_t *config, spi_device_handle_t *handle) {
+
+    if (config->queue_size > MAX_QUEUED) { fatal("queue too deep"); }
+
+    // In MHz, so bits / clock is microseconds
+    bus.clock = config->clock_speed_hz / 1e6;
+    bus.queueSize = config->queue_size;
+    bus.preCallback = config->pre_cb;
+    bus.postCallback = config->post_cb;
+
+    *handle = (spi_device_handle_t)&bus;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+    if (bus.head != bus.tail) { fatal("device removed while busy"); }
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+  spi_transaction_t *transaction, uint32_t ticksToWait) {
+
+    if (bus.failIn && --bus.failIn == 0) { return ESP_ERR_NO_MEM; }
+
+    bus.now += busModel.queueCost;
+    bus.stats.driverTime += busModel.queueCost;
+    process();
+
+    if (bus.tail - bus.head >= bus.queueSize) {
+        fatal("queue full; would block forever");
+    }
+
+    double start = (bus.end > bus.now) ? bus.end: bus.now;
+    bus.end = start + duration(transaction);
+
+    bus.queue[bus.tail % MAX_QUEUED] = (Queued){
+        .transaction = transaction,
+        .end = bus.end
+    };
+    bus.tail++;
+
+    bus.stats.transactions++;
+    bus.stats.busyTime += transaction->length / bus.clock;
+    if (bus.tail - bus.head > bus.stats.maxQueued) {
+        bus.stats.maxQueued = bus.tail - bus.head;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+  spi_transaction_t **transaction, uint32_t ticksToWait) {
+
+    if (bus.head == bus.tail) { fatal("no result; would block forever"); }
+
+    // Block until the oldest is sent
+    process();
+    if (bus.head == bus.sent) {
+        bus.now = bus.queue[bus.head % MAX_QUEUED].end + busModel.wakeCost;
+        process();
+    }
+
+    *transaction = bus.queue[bus.head % MAX_QUEUED].transaction;
+    bus.head++;
+
+    bus.now += busModel.resultCost;
+    bus.stats.driverTime += busModel.resultCost;
+
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+  spi_transaction_t *transaction) {
+
+    if (bus.head != bus.tail) { fatal("polling while transactions queued"); }
+
+    bus.now += duration(transaction);
+    if (bus.preCallback) { bus.preCallback(transaction); }
+    applyTransaction(transaction);
+    if (bus.postCallback) { bus.postCallback(transaction); }
+
+    return ESP_OK;
+}
@@ -0,0 +1,72 @@
+#ifndef __HOST_SHIM_BUS_H__
+#define __HOST_SHIM_BUS_H__
+
+// A mock SPI bus with an ST7789 on it, in virtual time (see: bus.c)
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#define PANEL_WIDTH          (240)
+#define PANEL_HEIGHT         (240)
+
+// The costs of the bus and driver, in microseconds; the defaults match
+// tools/fragment-sim.c
+typedef struct BusModel {
+    // Each transaction on the bus (setup, ISR and D/C toggle), on top
+    // of its bits at the device clock
+    double transactionCost;
+
+    // CPU time to queue a transaction and to collect its result
+    double queueCost;
+    double resultCost;
+
+    // Latency for a task blocked on a result to resume
+    double wakeCost;
+} BusModel;
+
+typedef struct BusStats {
+    // Transactions sent, and how many were RASET and RAMWR commands
+    uint32_t transactions;
+    uint32_t rowSets;
+    uint32_t memoryWrites;
+
+    // The most transactions queued at once
+    uint32_t maxQueued;
+
+    // Time the bus spent clocking bits and the CPU time in the driver
+    double busyTime;
+    double driverTime;
+} BusStats;
+
+extern BusModel busModel;
+
+// Resets the bus, the panel (to 0) and the clock
+void bus_reset(void);
+
+// The virtual clock; rendering advances it by its cost
+double bus_now(void);
+void bus_advance(double duration);
+
+// Advances the clock until every queued transaction has been sent
+void bus_flush(void);
+
+// Whether any transaction queued and not yet sent reads %%buffer%%
+bool bus_inFlight(const void *buffer);
+
+// Transactions queued, or sent with their result not yet collected
+uint32_t bus_pending(void);
+
+// Fails the %%count%%-th call to spi_device_queue_trans from now
+// (1 for the next), with ESP_ERR_NO_MEM
+void bus_failIn(uint32_t count);
+
+// Sets the D/C level (see: hal/gpio_ll.h)
+void bus_setLevel(int pin, uint32_t level);
+
+// The panel memory, PANEL_WIDTH x PANEL_HEIGHT pixels as sent
+const uint16_t* bus_panel(void);
+
+void bus_getStats(BusStats *stats);
+
+#endif /* __HOST_SHIM_BUS_H__ */
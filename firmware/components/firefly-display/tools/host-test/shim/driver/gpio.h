@@ -0,0 +1,17 @@
+#ifndef __HOST_SHIM_GPIO_H__
+#define __HOST_SHIM_GPIO_H__
+
+// Only the D/C pin is modelled, through gpio_ll_set_level (see: bus.c);
+// the rest is only used during init
+
+typedef int gpio_num_t;
+
+typedef enum gpio_mode_t {
+    GPIO_MODE_OUTPUT     = 2
+} gpio_mode_t;
+
+static inline void gpio_reset_pin(gpio_num_t pin) { }
+static inline void gpio_set_direction(gpio_num_t pin, gpio_mode_t mode) { }
+static inline void gpio_set_level(gpio_num_t pin, uint32_t level) { }
+
+#endif /* __HOST_SHIM_GPIO_H__ */
@@ -0,0 +1,96 @@
+#ifndef __HOST_SHIM_SPI_MASTER_H__
+#define __HOST_SHIM_SPI_MASTER_H__
+
+// Just enough of the ESP-IDF SPI master driver to build firefly-display
+// on the host. The field names and flags match ESP-IDF, so the sources
+// build unchanged; the functions are the mock bus (see: bus.c).
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+
+typedef enum spi_host_device_t {
+    SPI1_HOST       = 0,
+    SPI2_HOST       = 1,
+    SPI3_HOST       = 2,
+} spi_host_device_t;
+
+#define SPI_DMA_CH_AUTO              (3)
+
+#define SPI_MASTER_FREQ_40M          (80 * 1000 * 1000 / 2)
+#define SPI_MASTER_FREQ_80M          (80 * 1000 * 1000 / 1)
+
+#define SPI_TRANS_USE_RXDATA         (1 << 2)
+#define SPI_TRANS_USE_TXDATA         (1 << 3)
+
+typedef struct spi_transaction_t spi_transaction_t;
+
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+struct spi_transaction_t {
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+
+    // In bits
+    size_t length;
+    size_t rxlength;
+
+    void *user;
+
+    union {
+        const void *tx_buffer;
+        uint8_t tx_data[4];
+    };
+
+    union {
+        void *rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+typedef struct spi_bus_config_t {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+} spi_bus_config_t;
+
+typedef struct spi_device_interface_config_t {
+    uint8_t command_bits;
+    uint8_t address_bits;
+    uint8_t dummy_bits;
+    uint8_t mode;
+    int clock_speed_hz;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+typedef struct spi_device_t* spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host,
+  const spi_bus_config_t *config, int dmaChannel);
+
+esp_err_t spi_bus_add_device(spi_host_device_t host,
+  const spi_device_interface_config_t *config, spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+  spi_transaction_t *transaction, uint32_t ticksToWait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+  spi_transaction_t **transaction, uint32_t ticksToWait);
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+  spi_transaction_t *transaction);
+
+#endif /* __HOST_SHIM_SPI_MASTER_H__ */
@@ -0,0 +1,7 @@
+#ifndef __HOST_SHIM_ESP_ATTR_H__
+#define __HOST_SHIM_ESP_ATTR_H__
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif /* __HOST_SHIM_ESP_ATTR_H__ */
@@ -0,0 +1,13 @@
+#ifndef __HOST_SHIM_ESP_ERR_H__
+#define __HOST_SHIM_ESP_ERR_H__
+
+#include <assert.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK               (0)
+#define ESP_FAIL             (-1)
+#define ESP_ERR_NO_MEM       (0x101)
+#define ESP_ERR_INVALID_ARG  (0x102)
+
+#endif /* __HOST_SHIM_ESP_ERR_H__ */
@@ -0,0 +1,19 @@
+#ifndef __HOST_SHIM_ESP_HEAP_CAPS_H__
+#define __HOST_SHIM_ESP_HEAP_CAPS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA       (1 << 3)
+
+// DMA buffers must be word-aligned
+static inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return aligned_alloc(4, (size + 3) & ~3);
+}
+
+static inline void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+#endif /* __HOST_SHIM_ESP_HEAP_CAPS_H__ */
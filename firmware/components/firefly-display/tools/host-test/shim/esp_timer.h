@@ -0,0 +1,9 @@
+#ifndef __HOST_SHIM_ESP_TIMER_H__
+#define __HOST_SHIM_ESP_TIMER_H__
+
+#include <stdint.h>
+
+// Microseconds of the bus's virtual clock (see: bus.c)
+int64_t esp_timer_get_time(void);
+
+#endif /* __HOST_SHIM_ESP_TIMER_H__ */
@@ -0,0 +1,21 @@
+#ifndef __HOST_SHIM_FREERTOS_H__
+#define __HOST_SHIM_FREERTOS_H__
+
+// Just enough of FreeRTOS to build firefly-display on the host; time is
+// the bus's virtual clock (see: bus.c), at 1 tick per millisecond
+
+#include <stdint.h>
+
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY        ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS   (1)
+
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+
+#endif /* __HOST_SHIM_FREERTOS_H__ */
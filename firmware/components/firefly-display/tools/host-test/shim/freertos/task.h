@@ -0,0 +1,6 @@
+#ifndef __HOST_SHIM_FREERTOS_TASK_H__
+#define __HOST_SHIM_FREERTOS_TASK_H__
+
+#include "FreeRTOS.h"
+
+#endif /* __HOST_SHIM_FREERTOS_TASK_H__ */
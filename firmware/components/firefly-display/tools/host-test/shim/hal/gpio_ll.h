@@ -0,0 +1,12 @@
+#ifndef __HOST_SHIM_GPIO_LL_H__
+#define __HOST_SHIM_GPIO_LL_H__
+
+#include <stdint.h>
+
+#include "soc/gpio_struct.h"
+
+void bus_setLevel(int pin, uint32_t level);
+
+#define gpio_ll_set_level(hw, pin, level)   bus_setLevel((pin), (level))
+
+#endif /* __HOST_SHIM_GPIO_LL_H__ */
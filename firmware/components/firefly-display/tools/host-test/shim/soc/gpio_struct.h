@@ -0,0 +1,8 @@
+#ifndef __HOST_SHIM_GPIO_STRUCT_H__
+#define __HOST_SHIM_GPIO_STRUCT_H__
+
+typedef struct gpio_dev_t gpio_dev_t;
+
+extern gpio_dev_t GPIO;
+
+#endif /* __HOST_SHIM_GPIO_STRUCT_H__ */
@@ -0,0 +1,11 @@
+#ifndef __HOST_SHIM_SPI_PINS_H__
+#define __HOST_SHIM_SPI_PINS_H__
+
+// The ESP32-C3 pins (see: run.sh, which selects that target)
+
+#define SPI2_IOMUX_PIN_NUM_CS        (10)
+#define SPI2_IOMUX_PIN_NUM_CLK       (6)
+#define SPI2_IOMUX_PIN_NUM_MISO      (2)
+#define SPI2_IOMUX_PIN_NUM_MOSI      (7)
+
+#endif /* __HOST_SHIM_SPI_PINS_H__ */
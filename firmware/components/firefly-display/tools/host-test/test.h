@@ -0,0 +1,66 @@
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+// Helpers shared by the host tests. Each test is a single file, built
+// with every display source and the mock bus (see: run.sh).
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+
+#include "firefly-display.h"
+
+#include "bus.h"
+
+
+//////////////////////////
+// Checks
+
+#define check(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        exit(1); \
+    } \
+} while (0)
+
+#define checkEqual(a, b) do { \
+    long long _a = (long long)(a), _b = (long long)(b); \
+    if (_a != _b) { \
+        printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", \
+          __FILE__, __LINE__, #a, #b, _a, _b); \
+        exit(1); \
+    } \
+} while (0)
+
+
+//////////////////////////
+// Pixels
+
+// A pixel unique to its %%frame%% and position, which is never 0 (the
+// panel's initial value)
+static inline uint16_t testPixel(uint32_t frame, uint32_t x, uint32_t y) {
+    return (((frame * 7 + y) * 241 + x) % 0xffff) + 1;
+}
+
+// Whether row %%y%% of the panel shows %%frame%%
+static inline bool testPanelRow(uint32_t frame, int y) {
+    const uint16_t *pixels = &bus_panel()[y * PANEL_WIDTH];
+    for (int x = 0; x < PANEL_WIDTH; x++) {
+        if (pixels[x] != testPixel(frame, x, y)) { return false; }
+    }
+    return true;
+}
+
+// The first row of the panel which does not show %%frame%%, or -1
+static inline int testPanelFrame(uint32_t frame) {
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        if (!testPanelRow(frame, y)) { return y; }
+    }
+    return -1;
+}
+
+#endif /* __HOST_TEST_H__ */
@@ -85,6 +85,9 @@ void ffx_demo_backgroundPixies(FfxNode root, void *arg) {
       sizeof(image_background));
     ffx_sceneGroup_appendChild(root, bg);
 
+    // Every pixie is drawn from the same small image, so keep it in RAM
+    ffx_scene_registerImage(scene, image_pixie, sizeof(image_pixie), 1);
+
     // Field of pixies
     FfxNode pixies = ffx_scene_createGroup(scene);
     ffx_sceneGroup_appendChild(root, pixies);
@@ -214,29 +214,47 @@ static void initFunc(void *_arg) {
     // Initialize the Panel with the callback
     panelInit->init(scene, panel.node, panel.state, panelInit->arg);
 
-    ffx_sceneGroup_appendChild(canvas, node);
+    // The IO task may be sequencing the scene at any moment, so the
+    // panel is attached and its transition started as a single batch
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+
+    ffx_sceneBatch_appendChild(batch, canvas, node);
 
     if (oldPanel && (pOldEnd.x != 0 || pOldEnd.y != 0)) {
         if (style == FfxPanelStyleInstant) {
-            ffx_sceneNode_setPosition(oldPanel->node, pOldEnd);
+            ffx_sceneBatch_setPosition(batch, oldPanel->node, pOldEnd);
         } else {
-            ffx_sceneNode_animatePosition(oldPanel->node, pOldEnd, 0, 300,
-              FfxCurveEaseOutQuad, NULL, NULL);
+            ffx_sceneBatch_animatePosition(batch, oldPanel->node, pOldEnd,
+              0, 300, FfxCurveEaseOutQuad, NULL, NULL);
         }
     }
 
+    bool focus = true;
     if (pNewStart.x != pNewEnd.x || pNewStart.y != pNewEnd.y) {
         if (style == FfxPanelStyleInstant) {
-            ffx_sceneNode_setPosition(node, pNewEnd);
-            _panelFirstFocus(NULL, FfxSceneActionStopFinal, NULL);
+            ffx_sceneBatch_setPosition(batch, node, pNewEnd);
         } else {
-            ffx_sceneNode_animatePosition(node, pNewEnd, 0, 300,
+            ffx_sceneBatch_animatePosition(batch, node, pNewEnd, 0, 300,
               FfxCurveEaseOutQuad, _panelFirstFocus, NULL);
+            focus = false;
         }
-    } else {
-        _panelFirstFocus(NULL, FfxSceneActionStopFinal, NULL);
     }
 
+    // Out of memory (including a NULL batch, which records nothing);
+    // place the panels directly, without a transition, rather than
+    // leaving the new panel detached
+    if (!ffx_sceneBatch_commit(batch)) {
+        printf("[panel] push batch failed; attaching panel directly\n");
+        ffx_sceneGroup_appendChild(canvas, node);
+        if (oldPanel && (pOldEnd.x != 0 || pOldEnd.y != 0)) {
+            ffx_sceneNode_setPosition(oldPanel->node, pOldEnd);
+        }
+        ffx_sceneNode_setPosition(node, pNewEnd);
+        focus = true;
+    }
+
+    if (focus) { _panelFirstFocus(NULL, FfxSceneActionStopFinal, NULL); }
+
     // Begin the event loop
     EventDispatch dispatch = { 0 };
     while (1) {
@@ -299,11 +317,13 @@ void ffx_popPanel(int result) {
     // Store the result of the panel on the Panel owner's stack
     *(panel->result) = result;
 
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+
     if (panel->style == FfxPanelStyleInstant) {
-        ffx_sceneNode_setPosition(active->node, (FfxPoint){
+        ffx_sceneBatch_setPosition(batch, active->node, (FfxPoint){
             .x = 0, .y = 0
         });
-        _panelBlur(scene, FfxSceneActionStopFinal, panel->node);
+        ffx_sceneBatch_remove(batch, panel->node);
 
     } else {
         FfxPoint pNewStart = ffx_sceneNode_getPosition(active->node);
@@ -324,18 +344,26 @@ void ffx_popPanel(int result) {
         // Animate the popped active reverse how it arrived
         FfxPoint pOldStart = ffx_sceneNode_getPosition(panel->node);
         if (pOldStart.x != pOldEnd.x || pOldStart.y != pOldEnd.y) {
-            ffx_sceneNode_animatePosition(panel->node, pOldEnd, 0, 300,
-              FfxCurveEaseInQuad, _panelBlur, NULL);
+            ffx_sceneBatch_animatePosition(batch, panel->node, pOldEnd, 0,
+              300, FfxCurveEaseInQuad, _panelBlur, NULL);
         } else {
-            _panelBlur(scene, FfxSceneActionStopFinal, panel->node);
+            ffx_sceneBatch_remove(batch, panel->node);
         }
 
         if (pNewStart.x != 0 || pNewStart.y != 0) {
-            ffx_sceneNode_animatePosition(active->node, ffx_point(0, 0),
-              0, 300, FfxCurveEaseInQuad, NULL, NULL);
+            ffx_sceneBatch_animatePosition(batch, active->node,
+              ffx_point(0, 0), 0, 300, FfxCurveEaseInQuad, NULL, NULL);
         }
     }
 
+    // Out of memory; remove the panel directly, without a transition,
+    // rather than leaving it in the scene forever
+    if (!ffx_sceneBatch_commit(batch)) {
+        printf("[panel] pop batch failed; removing panel directly\n");
+        ffx_sceneNode_setPosition(active->node, ffx_point(0, 0));
+        ffx_sceneNode_remove(panel->node);
+    }
+
     // Unblock the parent Panel
     xSemaphoreGive(panel->done);
 
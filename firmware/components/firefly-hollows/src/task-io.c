@@ -16,6 +16,11 @@
 #include "utils.h"
 
 
+// Bytes of RAM for copies of small images drawn often (see:
+// ffx_scene_registerImage)
+#define IMAGE_CACHE_BUDGET     (16 * 1024)
+
+
 ///////////////////////////////
 // Keypad
 
@@ -194,6 +199,7 @@ void taskIoFunc(void* pvParameter) {
     }
 
     scene = ffx_scene_init(allocSpace, freeSpace, NULL, NULL, NULL);
+    ffx_scene_setImageCacheBudget(scene, IMAGE_CACHE_BUDGET);
 
 
     KeypadContext keypad = { 0 };
@@ -219,6 +219,28 @@ typedef struct FfxColorHSV {
 
 FfxColorHSV ffx_color_parseHSV(color_ffxt color);
 
+
+/**
+ *  A color prepared for rendering onto an RGB565 fragment, so render
+ *  kernels need no conversion per-fragment.
+ */
+typedef struct FfxColorRGB565 {
+    rgb16_ffxt rgb16;
+
+    // Opacity; [0, 32]
+    uint8_t opacity;
+
+    // The channels (in RGB565 depth) premultiplied by the opacity and
+    // the inverse opacity (ufixed:1.16), for blending with a background
+    // channel as ((red + alpha_1 * bgRed) >> 16)
+    int32_t red;
+    int32_t green;
+    int32_t blue;
+    int32_t alpha_1;
+} FfxColorRGB565;
+
+FfxColorRGB565 ffx_color_parseRGB565(color_ffxt color);
+
 uint8_t ffx_color_getOpacity(color_ffxt color);
 
 bool ffx_color_isTransparent(color_ffxt color);
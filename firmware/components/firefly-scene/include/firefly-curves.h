@@ -53,13 +53,29 @@ fixed_ffxt FfxCurveEaseOutBack(fixed_ffxt t);
 
 fixed_ffxt FfxCurveEaseInElastic(fixed_ffxt t);
 fixed_ffxt FfxCurveEaseOutElastic(fixed_ffxt t);
-// fixed_ffxt CurveEaseInOutElastic(fixed_ffxt t)
+fixed_ffxt FfxCurveEaseInOutElastic(fixed_ffxt t);
 
 fixed_ffxt FfxCurveEaseInBounce(fixed_ffxt t);
 fixed_ffxt FfxCurveEaseOutBounce(fixed_ffxt t);
 fixed_ffxt FfxCurveEaseInOutBounce(fixed_ffxt t);
 
 
+/**
+ *  Returns a curve matching the CSS ``cubic-bezier(x1, y1, x2, y2)``
+ *  timing function, with the control points %%x1%%, %%y1%%, %%x2%%
+ *  and %%y2%%. The x values must be within [0, 1], while the y values
+ *  may overshoot (within (-2, 2)).
+ *
+ *  The curve is solved once, here, into a lookup table, so it costs
+ *  the same as any other curve to evaluate. Curves with the same
+ *  control points are shared. At most 8 distinct curves can be
+ *  created, after which NULL is returned; create curves during setup.
+ *  This is safe to call from any task.
+ */
+FfxCurveFunc ffx_curve_createCubicBezier(fixed_ffxt x1, fixed_ffxt y1,
+  fixed_ffxt x2, fixed_ffxt y2);
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -110,7 +110,8 @@ fixed_ffxt powfx(fixed_ffxt x, fixed_ffxt y);
 /**
  *  Returns the sine of %%x%%.
  *
- *  A third-order approximation is used and the values of 0
+ *  A quarter-wave table is linearly interpolated, which is within
+ *  about 1 ULP for any %%x%%.
  */
 fixed_ffxt sinfx(fixed_ffxt x);
 
@@ -119,6 +120,62 @@ fixed_ffxt sinfx(fixed_ffxt x);
  */
 fixed_ffxt cosfx(fixed_ffxt x);
 
+/**
+ *  Returns the angle of the point (%%x%%, %%y%%), within [-pi, pi].
+ */
+fixed_ffxt atan2fx(fixed_ffxt y, fixed_ffxt x);
+
+/**
+ *  Returns the square root of %%x%%, correctly rounded (or 0 if %%x%%
+ *  is not positive).
+ */
+fixed_ffxt sqrtfx(fixed_ffxt x);
+
+/**
+ *  Returns floor(sqrt(%%value%%)) of an integer, exactly.
+ */
+uint32_t isqrt32(uint32_t value);
+
+/**
+ *  Returns the value %%t%% of the way from %%a%% to %%b%%.
+ */
+fixed_ffxt lerpfx(fixed_ffxt a, fixed_ffxt b, fixed_ffxt t);
+
+
+/**
+ *  A 2D vector of fixed:15.16 values.
+ */
+typedef struct vec2_ffxt {
+    fixed_ffxt x;
+    fixed_ffxt y;
+} vec2_ffxt;
+
+/**
+ *  Returns the vector (%%x%%, %%y%%).
+ */
+vec2_ffxt vec2fx(fixed_ffxt x, fixed_ffxt y);
+
+/**
+ *  Returns the vector %%t%% of the way from %%a%% to %%b%%.
+ */
+vec2_ffxt lerp2fx(vec2_ffxt a, vec2_ffxt b, fixed_ffxt t);
+
+/**
+ *  Returns the dot product of %%a%% and %%b%%.
+ */
+fixed_ffxt dot2fx(vec2_ffxt a, vec2_ffxt b);
+
+/**
+ *  Returns the length of %%v%%, which is scaled to avoid overflow for
+ *  any vector whose length fits.
+ */
+fixed_ffxt length2fx(vec2_ffxt v);
+
+/**
+ *  Returns %%v%% rotated by %%angle%% radians.
+ */
+vec2_ffxt rotate2fx(vec2_ffxt v, fixed_ffxt angle);
+
 
 #ifdef __cplusplus
 }
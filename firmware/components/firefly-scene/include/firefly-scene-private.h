@@ -12,6 +12,12 @@ extern "C" {
 #include "firefly-scene.h"
 
 
+// The panel size. Nodes entirely outside it are culled at sequence
+// time, whatever the fragment geometry they are later rendered with.
+#define FFX_SCENE_WIDTH       (240)
+#define FFX_SCENE_HEIGHT      (240)
+
+
 //////////////////////////////
 // Methods (via vtable)
 
@@ -61,6 +67,16 @@ void ffx_scene_memFree(FfxScene scene, void *ptr);
 void* ffx_sceneNode_memAlloc(FfxNode node, size_t size);
 void ffx_sceneNode_memFree(FfxNode node, void *ptr);
 
+/**
+ *  Returns the image to read %%data%% from in the renders created by
+ *  this sequence; the resident copy if it is registered and fits the
+ *  budget (see: ffx_scene_registerImage), otherwise %%data%%.
+ *
+ *  Only call from a sequenceFunc.
+ */
+const uint16_t* ffx_sceneNode_acquireImage(FfxNode node,
+  const uint16_t *data);
+
 
 //////////////////////////////
 // Life-cycle
@@ -88,8 +104,10 @@ bool ffx_scene_isNode(FfxNode node, const FfxNodeVTable *vtable);
 void* ffx_sceneNode_getState(FfxNode node, const FfxNodeVTable *vtable);
 
 /**
- *  Frees a Node. This should only be used internally when actually
- *  freeing a node that was removed.
+ *  Frees a Node and all its children immediately, detaching it from
+ *  its parent and releasing it from any animations, tracks or batches.
+ *  This should only be used internally when actually freeing a node
+ *  that was removed, or a detached node which will not be added back.
  *
  *  Generally, the [[ffx_sceneNode_remove]] should be used, which will
  *  schedule the node for freeing on the next sequence.
@@ -151,6 +169,12 @@ bool ffx_sceneNode_createSizeAction(FfxNode node, FfxSize s0, FfxSize s1,
   FfxNodeActionSetSizeFunc setSizeFunc);
 
 
+typedef void (*FfxNodeActionSetFixedFunc)(FfxNode node, fixed_ffxt value);
+
+bool ffx_sceneNode_createFixedAction(FfxNode node, fixed_ffxt v0,
+  fixed_ffxt v1, FfxNodeActionSetFixedFunc setFixedFunc);
+
+
 //////////////////////////////
 // Debugging
 
@@ -126,7 +126,10 @@ typedef bool (*FfxNodeVisitFunc)(FfxNode node, void* arg);
 FfxFontMetrics ffx_scene_getFontMetrics(FfxFont font);
 
 /**
- *  Compute the image dimensions for %%data%% (with %%length%%).
+ *  Compute the image dimensions for %%data%%, which is %%length%% bytes.
+ *
+ *  Returns a size of 0x0 if the format is unsupported or %%length%% is
+ *  shorter than the header implies.
  */
 FfxSize ffx_scene_getImageSize(const uint16_t *data, size_t length);
 
@@ -211,6 +214,13 @@ typedef void (*FfxSceneFreeFunc)(uint8_t* pointer, void* initArg);
 typedef void* (*FfxSceneAnimationSetupFunc)(FfxNode node,
   FfxNodeAnimation animation, void *initArg);
 
+/**
+ *  Called with the %%setupArg%% returned by the setupFunc once its
+ *  animation is done. The %%callFunc%% should be called with the
+ *  remaining arguments, on the appropriate task; it is NULL if there is
+ *  nothing to call (e.g. the animation was dropped), in which case only
+ *  %%setupArg%% should be released.
+ */
 typedef void (*FfxSceneAnimationDispatchFunc)(void *setupArg,
   FfxNodeAnimationCompletionFunc callFunc, FfxNode node,
   FfxSceneActionStop stopType, void *arg, void *initArg);
@@ -243,7 +253,7 @@ FfxScene ffx_scene_init(FfxSceneAllocFunc allocFunc,
   void *initArg);
 
 /**
- *  Free %%scene%%.
+ *  Free %%scene%%, along with every node attached to it.
  */
 void ffx_scene_free(FfxScene scene);
 
@@ -281,14 +291,36 @@ FfxNode ffx_scene_root(FfxScene scene);
 // Node
 
 /**
- * Schedule the %%node%% to be removed on the next sequence. If
- * %%dealloc%% the node will also have its destructor called and
- * be freed. Otherwise, it may be added back to the scene after
- * the next sequence. @TODO: allow this? Adding it before would
- * be catastoropic.
+ *  Schedule the %%node%% to be removed on the next sequence, which
+ *  frees it along with all its children, animations and tracks.
+ *
+ *  To remove a node that will be added back later, use
+ *  [[ffx_sceneNode_detach]] instead.
  */
 void ffx_sceneNode_remove(FfxNode node);
 
+/**
+ *  Detach %%node%% from its parent immediately, without freeing it.
+ *
+ *  The node keeps its children, animations, tracks and any cached
+ *  state, so may be parked and later added back, to any group, with
+ *  [[ffx_sceneGroup_appendChild]] or [[ffx_sceneGroup_insertBefore]].
+ *  Detaching cancels any pending [[ffx_sceneNode_remove]].
+ *
+ *  A detached node is not freed with the scene, so must be added back
+ *  (or freed) first. A node from a blob must not outlive the blob
+ *  root.
+ *
+ *  Like the other structural changes, this must be called on the task
+ *  sequencing the scene; use [[ffx_sceneBatch_detach]] elsewhere.
+ */
+void ffx_sceneNode_detach(FfxNode node);
+
+/**
+ *  Get the parent of %%node%%, or NULL if it is detached.
+ */
+FfxNode ffx_sceneNode_getParent(FfxNode node);
+
 /**
  *  Get the scene that created %%node%%.
  */
@@ -327,8 +359,38 @@ FfxNode ffx_scene_createGroup(FfxScene scene);
 bool ffx_scene_isGroup(FfxScene scene);
 
 FfxNode ffx_sceneGroup_getFirstChild(FfxNode node);
+
+/**
+ *  Add %%child%% as the last child of the group %%node%%. If %%child%%
+ *  is already a child of %%node%%, it is moved to the end.
+ */
 void ffx_sceneGroup_appendChild(FfxNode node, FfxNode child);
 
+/**
+ *  Add %%child%% to the group %%node%% before %%sibling%%, which must
+ *  be a child of %%node%% (or NULL to add it last). If %%child%% is
+ *  already a child of %%node%%, it is moved, so children can be
+ *  reordered without being removed.
+ */
+void ffx_sceneGroup_insertBefore(FfxNode node, FfxNode child,
+  FfxNode sibling);
+
+/**
+ *  Get the group opacity, from 0 to MAX_OPACITY.
+ */
+uint8_t ffx_sceneGroup_getOpacity(FfxNode node);
+
+/**
+ *  Set the group %%opacity%%, from 0 (hidden) to MAX_OPACITY (the
+ *  default). This property can be **animated**.
+ *
+ *  Below MAX_OPACITY, the children are composited as a single layer,
+ *  so overlapping children do not show through each other. This uses
+ *  a fragment-sized buffer, allocated once and reused, per level of
+ *  nested layer.
+ */
+void ffx_sceneGroup_setOpacity(FfxNode node, uint8_t opacity);
+
 
 ///////////////////////////////
 // Node: Animations
@@ -378,6 +440,227 @@ void ffx_sceneNode_advanceAnimations(FfxNode node, uint32_t advance);
 void ffx_sceneNode_stopAnimations(FfxNode node, bool completeAnimations);
 
 
+///////////////////////////////
+// Node: Keyframe Tracks
+
+typedef enum FfxTrackMode {
+    // Play once, then hold the final values
+    FfxTrackModeOnce         = 0,
+
+    // Restart from the first keyframe after the last
+    FfxTrackModeLoop         = 1,
+
+    // Alternate between playing forward and backward
+    FfxTrackModePingPong     = 2,
+} FfxTrackMode;
+
+typedef enum FfxTrackType {
+    FfxTrackTypeFixed        = 0,
+    FfxTrackTypePoint        = 1,
+    FfxTrackTypeSize         = 2,
+    FfxTrackTypeColor        = 3,
+} FfxTrackType;
+
+/**
+ *  A keyframe of a track; the %%value%% reached at %%time%% (in ms),
+ *  which eases to the next keyframe using %%curve%%.
+ */
+typedef struct FfxKeyframe {
+    uint32_t time;
+    FfxCurveFunc curve;                         // Default: Linear
+    union {
+        fixed_ffxt fixed;
+        FfxPoint point;
+        FfxSize size;
+        color_ffxt color;
+    } value;
+} FfxKeyframe;
+
+/**
+ *  A track animates a single property, by calling the setter for the
+ *  track %%type%% (e.g. ``.setFunc.point = ffx_sceneNode_setPosition``)
+ *  with the value at the current time.
+ *
+ *  The %%keyframes%% must be ordered by time.
+ */
+typedef struct FfxTrack {
+    FfxTrackType type;
+    union {
+        void (*fixed)(FfxNode node, fixed_ffxt value);
+        void (*point)(FfxNode node, FfxPoint point);
+        void (*size)(FfxNode node, FfxSize size);
+        void (*color)(FfxNode node, color_ffxt color);
+    } setFunc;
+    const FfxKeyframe *keyframes;
+    size_t count;
+} FfxTrack;
+
+/**
+ *  Play the %%tracks%% on %%node%% with %%mode%%, starting %%offset%% ms
+ *  into them, replacing any tracks already playing on %%node%%.
+ *
+ *  The tracks and their keyframes are copied into a single allocation
+ *  and evaluated each sequence, without any further allocation. All
+ *  tracks share the period of the latest keyframe; a shorter track
+ *  holds its final value. For a seamless loop, the last keyframe of a
+ *  track should match its first.
+ *
+ *  Unlike chaining animations with onComplete, looping tracks never
+ *  drift and do not pass through the animation queue.
+ */
+bool ffx_sceneNode_setTracks(FfxNode node, const FfxTrack *tracks,
+  size_t count, FfxTrackMode mode, uint32_t offset);
+
+/**
+ *  Stop the tracks on %%node%%, leaving each property at its current
+ *  value.
+ */
+void ffx_sceneNode_clearTracks(FfxNode node);
+
+
+///////////////////////////////
+// Batch
+
+/**
+ *  Batch object (opaque; do not inspect or rely on internals).
+ */
+typedef void* FfxSceneBatch;
+
+/**
+ *  Begin recording a batch of mutations on %%scene%%, or NULL if out
+ *  of memory.
+ *
+ *  Nothing recorded is applied until the batch is committed with
+ *  [[ffx_sceneBatch_commit]]. The entire batch is then applied, in
+ *  order, at the start of the next [[ffx_scene_sequence]], so a frame
+ *  never observes a partially applied batch.
+ *
+ *  Batches may be recorded and committed from any task without
+ *  blocking the task sequencing the scene.
+ */
+FfxSceneBatch ffx_scene_beginBatch(FfxScene scene);
+
+/**
+ *  Commit %%batch%%. The batch must not be used after this call.
+ *
+ *  If any command could not be recorded (out of memory), nothing in
+ *  the batch is applied; it is freed and false is returned. A NULL
+ *  %%batch%% also returns false.
+ */
+bool ffx_sceneBatch_commit(FfxSceneBatch batch);
+
+void ffx_sceneBatch_setPosition(FfxSceneBatch batch, FfxNode node,
+  FfxPoint position);
+
+/**
+ *  Set the color of %%node%%, which is the color of a Box or Fill,
+ *  the text color of a Label or the tint of an Image.
+ */
+void ffx_sceneBatch_setColor(FfxSceneBatch batch, FfxNode node,
+  color_ffxt color);
+
+/**
+ *  Set the text of the label %%node%%. The %%text%% is copied.
+ */
+void ffx_sceneBatch_setText(FfxSceneBatch batch, FfxNode node,
+  const char *text);
+
+void ffx_sceneBatch_appendChild(FfxSceneBatch batch, FfxNode node,
+  FfxNode child);
+
+void ffx_sceneBatch_insertBefore(FfxSceneBatch batch, FfxNode node,
+  FfxNode child, FfxNode sibling);
+
+void ffx_sceneBatch_detach(FfxSceneBatch batch, FfxNode node);
+
+void ffx_sceneBatch_remove(FfxSceneBatch batch, FfxNode node);
+
+/**
+ *  Animate %%node%% with the %%setupFunc%% and %%arg%%.
+ *
+ *  The %%setupFunc%% is called immediately, but the animation does not
+ *  begin until the batch is applied.
+ */
+void ffx_sceneBatch_animate(FfxSceneBatch batch, FfxNode node,
+  FfxNodeAnimationSetupFunc setupFunc, void *arg);
+
+void ffx_sceneBatch_animatePosition(FfxSceneBatch batch, FfxNode node,
+  FfxPoint position, uint32_t delay, uint32_t duration, FfxCurveFunc curve,
+  FfxNodeAnimationCompletionFunc onComplete, void* arg);
+
+void ffx_sceneBatch_stopAnimations(FfxSceneBatch batch, FfxNode node,
+  bool completeAnimations);
+
+
+///////////////////////////////
+// Blob
+
+typedef struct FfxSceneBlobImage {
+    const uint16_t *data;
+
+    // In bytes
+    size_t length;
+} FfxSceneBlobImage;
+
+/**
+ *  Create the subtree described by the compiled %%blob%% (see:
+ *  tools/src.ts/scene-blob.ts) using a single allocation. The root is
+ *  always a Group, which owns the allocation; the entire subtree is
+ *  released once it is freed.
+ *
+ *  Image nodes refer to %%images%% by slot, and each Anchor is written
+ *  to %%anchors%% in the order assigned by the compiler, which must
+ *  match %%anchorCount%%.
+ *
+ *  Returns NULL if the blob is invalid.
+ */
+FfxNode ffx_scene_createBlob(FfxScene scene, const uint8_t *blob,
+  size_t length, const FfxSceneBlobImage *images, size_t imageCount,
+  FfxNode *anchors, size_t anchorCount);
+
+
+///////////////////////////////
+// Trace
+
+/**
+ *  Returns the data to use when replaying a node which drew the data
+ *  recorded as %%ref%% (its address), setting %%length%% (in bytes).
+ *  The %%header%% holds the first %%headerLength%% words of the
+ *  original data (its format and dimensions), so matching data can be
+ *  substituted. Return NULL to skip the node.
+ */
+typedef const uint16_t* (*FfxTraceDataFunc)(uint64_t ref,
+  const uint16_t *header, size_t headerLength, size_t *length, void *arg);
+
+/**
+ *  Begin recording the render list of each sequenced frame into
+ *  %%buffer%%. Once the buffer is full, further frames are dropped.
+ *
+ *  This must be called from the task which sequences the scene.
+ */
+void ffx_scene_startTrace(FfxScene scene, uint8_t *buffer, size_t length);
+
+/**
+ *  Stop recording, returning the length of the trace.
+ */
+size_t ffx_scene_stopTrace(FfxScene scene);
+
+/**
+ *  Dump %%trace%% as hex, suitable for capturing over a serial console
+ *  (see: tools/replay).
+ */
+void ffx_scene_dumpTrace(const uint8_t *trace, size_t length);
+
+/**
+ *  Create a Group containing the nodes recorded in %%frame%% of the
+ *  %%trace%%, which sequences to the same render list as the original.
+ *
+ *  Returns NULL if the frame does not exist or the trace is invalid.
+ */
+FfxNode ffx_scene_createTraceFrame(FfxScene scene, const uint8_t *trace,
+  size_t length, size_t frame, FfxTraceDataFunc dataFunc, void *arg);
+
+
 ///////////////////////////////
 // Fill
 
@@ -507,6 +790,10 @@ void ffx_sceneLabel_setOutlineColor(FfxNode node, color_ffxt color);
 ///////////////////////////////
 // Image
 
+/**
+ *  Create an image, which draws %%data%% at its position. The
+ *  %%length%% is in bytes.
+ */
 FfxNode ffx_scene_createImage(FfxScene scene, const uint16_t *data,
   size_t length);
 bool ffx_scene_isImage(FfxNode node);
@@ -518,6 +805,657 @@ const uint16_t* ffx_sceneImage_getData(FfxNode node);
 void ffx_sceneImage_setData(FfxNode node, const uint16_t* data, size_t length);
 
 
+///////////////////////////////
+// Image Cache
+
+typedef struct FfxImageCacheStats {
+    // Renders of a registered image read from its resident copy, or
+    // from the original data as it could not be made resident
+    uint32_t hits;
+    uint32_t misses;
+
+    // Images copied into and dropped from the cache
+    uint32_t loads;
+    uint32_t evictions;
+
+    // Bytes of resident copies, and the budget for them
+    uint32_t used;
+    uint32_t budget;
+
+    uint32_t registered;
+    uint32_t resident;
+} FfxImageCacheStats;
+
+/**
+ *  Set the bytes of RAM that copies of registered images may use. The
+ *  default is 0, which keeps every image where it is.
+ *
+ *  Images are usually read straight from memory-mapped flash, through
+ *  a small cache which a large image drawn every frame evicts, so a
+ *  sprite drawn in every fragment is slow to read. Taking effect on
+ *  the next sequence, the cache copies each registered image into RAM
+ *  the first time it is drawn, while the budget allows.
+ */
+void ffx_scene_setImageCacheBudget(FfxScene scene, size_t budget);
+
+/**
+ *  Register the image %%data%% to be copied into RAM while it is
+ *  being drawn. Registering an image again changes its %%priority%%.
+ *
+ *  The %%length%% is in bytes; data shorter than its header implies
+ *  is refused.
+ *
+ *  When the budget is full, the least recently drawn image of the
+ *  lowest priority (no higher than the image being loaded) is evicted;
+ *  an image drawn in the current frame is never evicted, so images
+ *  which do not fit together are not swapped every frame.
+ *
+ *  Image, sprite, flipbook, tile map and particle nodes read from the
+ *  copy without any change.
+ */
+bool ffx_scene_registerImage(FfxScene scene, const uint16_t *data,
+  size_t length, uint8_t priority);
+
+/**
+ *  Unregister the image %%data%%, freeing its copy on the next
+ *  sequence. Images must be unregistered before their data is freed.
+ */
+void ffx_scene_unregisterImage(FfxScene scene, const uint16_t *data);
+
+/**
+ *  Get the cache statistics, as of the last sequence. The counts are
+ *  since the scene was created.
+ */
+void ffx_scene_getImageCacheStats(FfxScene scene,
+  FfxImageCacheStats *stats);
+
+
+///////////////////////////////
+// Sprite
+
+typedef enum FfxSpriteSampling {
+    FfxSpriteSamplingNearest    = 0,
+
+    // Only supported for RGB565 images; others use nearest
+    FfxSpriteSamplingBilinear   = 1,
+} FfxSpriteSampling;
+
+/**
+ *  Create a sprite, which draws an image scaled and rotated about its
+ *  center. The node position is where the center of the image is placed.
+ *  The %%length%% is in bytes.
+ */
+FfxNode ffx_scene_createSprite(FfxScene scene, const uint16_t *data,
+  size_t length);
+bool ffx_scene_isSprite(FfxNode node);
+
+const uint16_t* ffx_sceneSprite_getData(FfxNode node);
+void ffx_sceneSprite_setData(FfxNode node, const uint16_t* data,
+  size_t length);
+
+/**
+ *  Get the sprite scale.
+ *
+ *  The default is FM_1.
+ */
+fixed_ffxt ffx_sceneSprite_getScale(FfxNode node);
+
+/**
+ *  Set the sprite %%scale%%, in the range [1 / 16, 64]; outside this
+ *  range the sprite is not drawn. This property can be **animated**.
+ */
+void ffx_sceneSprite_setScale(FfxNode node, fixed_ffxt scale);
+
+/**
+ *  Get the sprite rotation, in radians clockwise.
+ */
+fixed_ffxt ffx_sceneSprite_getAngle(FfxNode node);
+
+/**
+ *  Set the sprite rotation %%angle%%, in radians clockwise. This
+ *  property can be **animated**.
+ */
+void ffx_sceneSprite_setAngle(FfxNode node, fixed_ffxt angle);
+
+/**
+ *  Get the sprite sampling.
+ *
+ *  The default is FfxSpriteSamplingNearest.
+ */
+FfxSpriteSampling ffx_sceneSprite_getSampling(FfxNode node);
+void ffx_sceneSprite_setSampling(FfxNode node, FfxSpriteSampling sampling);
+
+
+///////////////////////////////
+// Flipbook
+
+/**
+ *  Create a flipbook, which plays the frames of %%data%% (see:
+ *  tools/src.ts/cli-flipbook.ts) on its own timer. The %%length%% is
+ *  in bytes.
+ *
+ *  The frame advances while sequencing, so no animations or property
+ *  changes are needed to play it.
+ */
+FfxNode ffx_scene_createFlipbook(FfxScene scene, const uint16_t *data,
+  size_t length);
+bool ffx_scene_isFlipbook(FfxNode node);
+
+const uint16_t* ffx_sceneFlipbook_getData(FfxNode node);
+
+size_t ffx_sceneFlipbook_getFrameCount(FfxNode node);
+
+size_t ffx_sceneFlipbook_getFrame(FfxNode node);
+
+/**
+ *  Show %%frame%%, restarting its duration on the next sequence.
+ */
+void ffx_sceneFlipbook_setFrame(FfxNode node, size_t frame);
+
+/**
+ *  Get whether the flipbook is advancing frames.
+ *
+ *  The default is true.
+ */
+bool ffx_sceneFlipbook_getPlaying(FfxNode node);
+void ffx_sceneFlipbook_setPlaying(FfxNode node, bool playing);
+
+/**
+ *  Get the region (in world coordinates) which changed during the last
+ *  sequence, returning false if nothing changed.
+ */
+bool ffx_sceneFlipbook_getDamage(FfxNode node, FfxPoint *origin,
+  FfxSize *size);
+
+
+///////////////////////////////
+// Tile Map
+
+/**
+ *  Create a tile map, which draws a grid of tiles from %%data%% (see:
+ *  tools/src.ts/cli-tilemap.ts). The %%length%% is in bytes.
+ */
+FfxNode ffx_scene_createTileMap(FfxScene scene, const uint16_t *data,
+  size_t length);
+bool ffx_scene_isTileMap(FfxNode node);
+
+const uint16_t* ffx_sceneTileMap_getData(FfxNode node);
+
+/**
+ *  Get the size of the region the tile map is drawn into.
+ *
+ *  The default is the size of the entire map.
+ */
+FfxSize ffx_sceneTileMap_getSize(FfxNode node);
+
+/**
+ *  Set the %%size%% of the region the tile map is drawn into. This
+ *  property can be **animated**.
+ */
+void ffx_sceneTileMap_setSize(FfxNode node, FfxSize size);
+
+/**
+ *  Get the map coordinate drawn at the top-left of the tile map.
+ */
+FfxPoint ffx_sceneTileMap_getScroll(FfxNode node);
+
+/**
+ *  Set the map coordinate drawn at the top-left of the tile map. This
+ *  property can be **animated**.
+ */
+void ffx_sceneTileMap_setScroll(FfxNode node, FfxPoint scroll);
+
+/**
+ *  Get whether the map repeats beyond its edges; otherwise nothing is
+ *  drawn outside the map.
+ *
+ *  The default is false.
+ */
+bool ffx_sceneTileMap_getWrap(FfxNode node);
+void ffx_sceneTileMap_setWrap(FfxNode node, bool wrap);
+
+
+///////////////////////////////
+// Particles
+
+typedef struct FfxParticleEmitter {
+    // Particles emitted per second (see also: ffx_sceneParticles_emit)
+    uint16_t rate;
+
+    // The life of each particle (ms), plus up to lifeJitter more
+    uint16_t life;
+    uint16_t lifeJitter;
+
+    // Particles are emitted anywhere within this area, centered on the
+    // node position
+    FfxSize area;
+
+    // The initial velocity (pixels per second), plus or minus up to
+    // velocityJitter on each axis
+    FfxPoint velocity;
+    FfxPoint velocityJitter;
+
+    // The acceleration (pixels per second per second)
+    FfxPoint gravity;
+
+    // Particles fade from startColor to endColor (including opacity)
+    // over their life
+    color_ffxt startColor;
+    color_ffxt endColor;
+
+    // The width and height of each point, [1, 4]; unused with a sprite
+    uint8_t pointSize;
+} FfxParticleEmitter;
+
+/**
+ *  Create a particle system, which simulates up to %%capacity%%
+ *  particles on its own, each drawn as a small point or a shared
+ *  sprite.
+ *
+ *  Particles are emitted at the node position, but then move in world
+ *  space, so moving the node leaves a trail. Nothing is simulated
+ *  while the node is hidden.
+ */
+FfxNode ffx_scene_createParticles(FfxScene scene, size_t capacity);
+bool ffx_scene_isParticles(FfxNode node);
+
+/**
+ *  Get the emitter settings.
+ *
+ *  The default emits nothing, and fades 1px white points out over 1s.
+ */
+void ffx_sceneParticles_getEmitter(FfxNode node,
+  FfxParticleEmitter *emitter);
+
+/**
+ *  Set the emitter settings, which are copied. Particles already
+ *  emitted keep their velocity and life, but change color.
+ */
+void ffx_sceneParticles_setEmitter(FfxNode node,
+  const FfxParticleEmitter *emitter);
+
+/**
+ *  Get the sprite drawn for each particle, or NULL for points.
+ */
+const uint16_t* ffx_sceneParticles_getSprite(FfxNode node);
+
+/**
+ *  Draw each particle as the image %%data%% (RGB565 or RGB565 with a
+ *  4-bit alpha), centered, with the opacity of the particle color; or
+ *  NULL to draw points. The %%length%% is in bytes.
+ */
+void ffx_sceneParticles_setSprite(FfxNode node, const uint16_t *data,
+  size_t length);
+
+/**
+ *  Emit %%count%% particles at once on the next sequence, in addition
+ *  to those emitted by the rate.
+ */
+void ffx_sceneParticles_emit(FfxNode node, size_t count);
+
+/**
+ *  Get the number of live particles.
+ */
+size_t ffx_sceneParticles_getCount(FfxNode node);
+
+
+///////////////////////////////
+// Chart
+
+typedef enum FfxChartStyle {
+    FfxChartStyleLine     = 0,
+    FfxChartStyleColumn   = 1
+} FfxChartStyle;
+
+/**
+ *  Create a chart node of %%size%%, which keeps the last %%capacity%%
+ *  samples and scales them to fit its height.
+ *
+ *  The samples fill the width, oldest on the left, with the newest
+ *  always at the right edge.
+ */
+FfxNode ffx_scene_createChart(FfxScene scene, FfxSize size,
+  size_t capacity);
+bool ffx_scene_isChart(FfxNode node);
+
+/**
+ *  Append a sample, dropping the oldest once the chart is full. This
+ *  is O(1), so it is fine to call for every sample as it arrives.
+ */
+void ffx_sceneChart_append(FfxNode node, int32_t value);
+
+/**
+ *  Remove every sample.
+ */
+void ffx_sceneChart_clear(FfxNode node);
+
+/**
+ *  Get the number of samples.
+ */
+size_t ffx_sceneChart_getCount(FfxNode node);
+
+/**
+ *  Get the smallest and largest sample, which the chart is scaled to,
+ *  returning false if there are no samples.
+ */
+bool ffx_sceneChart_getRange(FfxNode node, int32_t *min, int32_t *max);
+
+/**
+ *  Get the chart size.
+ */
+FfxSize ffx_sceneChart_getSize(FfxNode node);
+
+/**
+ *  Get the chart style.
+ */
+FfxChartStyle ffx_sceneChart_getStyle(FfxNode node);
+
+/**
+ *  Set the chart %%style%%; a line joining the samples, or a column
+ *  for each sample.
+ */
+void ffx_sceneChart_setStyle(FfxNode node, FfxChartStyle style);
+
+/**
+ *  Get the chart color.
+ */
+color_ffxt ffx_sceneChart_getColor(FfxNode node);
+
+/**
+ *  Set the chart %%color%%. This property can be **animated**.
+ */
+void ffx_sceneChart_setColor(FfxNode node, color_ffxt color);
+
+
+///////////////////////////////
+// Gradient
+
+/**
+ *  The most color stops a gradient can have.
+ */
+#define FFX_GRADIENT_MAX_COLORS      (8)
+
+typedef enum FfxGradientType {
+    // Colors change along the line from start to end
+    FfxGradientTypeLinear       = 0,
+
+    // Colors change with the distance from start, reaching the last
+    // color at the distance of end (precise for radii up to about 2000)
+    FfxGradientTypeRadial       = 1,
+} FfxGradientType;
+
+/**
+ *  Create a gradient, which fills %%size%% with colors interpolated
+ *  across its color stops (see: [[ffx_color_lerpColorRamp]]). Past
+ *  either end, the first or last color is used.
+ *
+ *  Color opacity is ignored; gradients are always opaque.
+ */
+FfxNode ffx_scene_createGradient(FfxScene scene, FfxSize size,
+  FfxGradientType type);
+bool ffx_scene_isGradient(FfxNode node);
+
+FfxGradientType ffx_sceneGradient_getType(FfxNode node);
+void ffx_sceneGradient_setType(FfxNode node, FfxGradientType type);
+
+FfxSize ffx_sceneGradient_getSize(FfxNode node);
+
+/**
+ *  Set the gradient %%size%%. This property can be **animated**.
+ */
+void ffx_sceneGradient_setSize(FfxNode node, FfxSize size);
+
+/**
+ *  Get the point (relative to the node) where the first color is drawn.
+ *
+ *  The default is (0, 0).
+ */
+FfxPoint ffx_sceneGradient_getStart(FfxNode node);
+
+/**
+ *  Set the %%start%% point. This property can be **animated**.
+ */
+void ffx_sceneGradient_setStart(FfxNode node, FfxPoint start);
+
+/**
+ *  Get the point (relative to the node) where the last color is drawn.
+ *
+ *  The default is (0, height), a vertical gradient.
+ */
+FfxPoint ffx_sceneGradient_getEnd(FfxNode node);
+
+/**
+ *  Set the %%end%% point. This property can be **animated**.
+ */
+void ffx_sceneGradient_setEnd(FfxNode node, FfxPoint end);
+
+/**
+ *  Copy up to %%count%% color stops into %%colors%%, returning the
+ *  number of color stops.
+ *
+ *  The default is black to white.
+ */
+size_t ffx_sceneGradient_getColors(FfxNode node, color_ffxt *colors,
+  size_t count);
+
+/**
+ *  Set the %%count%% evenly spaced color stops %%colors%%, returning
+ *  false if there are none or more than [[FFX_GRADIENT_MAX_COLORS]].
+ */
+bool ffx_sceneGradient_setColors(FfxNode node, const color_ffxt *colors,
+  size_t count);
+
+/**
+ *  Get whether an ordered dither is applied when reducing colors to
+ *  RGB565, which hides banding.
+ *
+ *  The default is true.
+ */
+bool ffx_sceneGradient_getDither(FfxNode node);
+void ffx_sceneGradient_setDither(FfxNode node, bool dither);
+
+
+///////////////////////////////
+// Shape
+
+typedef enum FfxShapeType {
+    // A line from the node position to end, with round caps
+    FfxShapeTypeLine            = 0,
+
+    // The largest circle centered within the size
+    FfxShapeTypeCircle          = 1,
+
+    // The stroke of a circle, from the start angle to the end angle
+    FfxShapeTypeArc             = 2,
+
+    // A rectangle with rounded corners
+    FfxShapeTypeRoundRect       = 3,
+} FfxShapeType;
+
+/**
+ *  Create an anti-aliased vector shape of %%type%% within %%size%%.
+ *
+ *  Strokes are drawn inside the edge of the shape, with the fill inside
+ *  the stroke. Lines and arcs only have a stroke. Shapes larger than
+ *  2047 pixels are not drawn.
+ */
+FfxNode ffx_scene_createShape(FfxScene scene, FfxShapeType type,
+  FfxSize size);
+bool ffx_scene_isShape(FfxNode node);
+
+FfxShapeType ffx_sceneShape_getType(FfxNode node);
+
+FfxSize ffx_sceneShape_getSize(FfxNode node);
+
+/**
+ *  Set the shape %%size%%. This property can be **animated**.
+ */
+void ffx_sceneShape_setSize(FfxNode node, FfxSize size);
+
+/**
+ *  Get the end of a line, relative to the node position.
+ *
+ *  The default is (width, height).
+ */
+FfxPoint ffx_sceneShape_getEnd(FfxNode node);
+
+/**
+ *  Set the %%end%% of a line. This property can be **animated**.
+ */
+void ffx_sceneShape_setEnd(FfxNode node, FfxPoint end);
+
+/**
+ *  Get the fill color.
+ *
+ *  The default is COLOR_BLACK.
+ */
+color_ffxt ffx_sceneShape_getFillColor(FfxNode node);
+
+/**
+ *  Set the fill %%color%%. This property can be **animated**.
+ */
+void ffx_sceneShape_setFillColor(FfxNode node, color_ffxt color);
+
+/**
+ *  Get the stroke color.
+ *
+ *  The default is COLOR_BLACK.
+ */
+color_ffxt ffx_sceneShape_getStrokeColor(FfxNode node);
+
+/**
+ *  Set the stroke %%color%%. This property can be **animated**.
+ */
+void ffx_sceneShape_setStrokeColor(FfxNode node, color_ffxt color);
+
+/**
+ *  Get the stroke width.
+ *
+ *  The default is 1 for lines and arcs, otherwise 0 (no stroke).
+ */
+uint16_t ffx_sceneShape_getStrokeWidth(FfxNode node);
+void ffx_sceneShape_setStrokeWidth(FfxNode node, uint16_t width);
+
+/**
+ *  Get the corner radius of a rounded rectangle.
+ *
+ *  The default is 0.
+ */
+uint16_t ffx_sceneShape_getCornerRadius(FfxNode node);
+void ffx_sceneShape_setCornerRadius(FfxNode node, uint16_t radius);
+
+/**
+ *  Get the start angle of an arc, in radians clockwise from the top.
+ *
+ *  The default is 0.
+ */
+fixed_ffxt ffx_sceneShape_getStartAngle(FfxNode node);
+
+/**
+ *  Set the start %%angle%% of an arc. This property can be **animated**.
+ */
+void ffx_sceneShape_setStartAngle(FfxNode node, fixed_ffxt angle);
+
+/**
+ *  Get the end angle of an arc, in radians clockwise from the top.
+ *
+ *  The default is FM_2PI (a full circle).
+ */
+fixed_ffxt ffx_sceneShape_getEndAngle(FfxNode node);
+
+/**
+ *  Set the end %%angle%% of an arc. This property can be **animated**.
+ */
+void ffx_sceneShape_setEndAngle(FfxNode node, fixed_ffxt angle);
+
+
+///////////////////////////////
+// Paragraph
+
+/**
+ *  How a paragraph breaks lines which are wider than its width.
+ */
+typedef enum FfxTextWrap {
+    // Break between words, splitting words longer than a line
+    FfxTextWrapWord        = 0,
+
+    // Break after the last character which fits
+    FfxTextWrapCharacter   = 1,
+} FfxTextWrap;
+
+/**
+ *  Create a paragraph of %%text%%, wrapped to %%size%%; the position is
+ *  the top-left corner.
+ *
+ *  Lines which do not fit within the size height are dropped, and the
+ *  last visible line ends with an ellipsis. Line breaks are cached until
+ *  the text is set, or the wrap mode or the number of characters which
+ *  fit change.
+ */
+FfxNode ffx_scene_createParagraph(FfxScene scene, FfxFont font,
+  FfxSize size, const char* text);
+bool ffx_scene_isParagraph(FfxNode node);
+
+size_t ffx_sceneParagraph_getTextLength(FfxNode node);
+size_t ffx_sceneParagraph_copyText(FfxNode node, char* output,
+  size_t length);
+
+/**
+ *  Set the paragraph %%text%%, which may contain newlines. Setting the
+ *  same text again keeps the cached line breaks.
+ */
+void ffx_sceneParagraph_setText(FfxNode node, const char* text);
+void ffx_sceneParagraph_setTextFormat(FfxNode node, const char* format,
+  ...);
+
+FfxFont ffx_sceneParagraph_getFont(FfxNode node);
+void ffx_sceneParagraph_setFont(FfxNode node, FfxFont font);
+
+FfxSize ffx_sceneParagraph_getSize(FfxNode node);
+void ffx_sceneParagraph_setSize(FfxNode node, FfxSize size);
+
+/**
+ *  Get the horizontal alignment of each line within the width.
+ */
+FfxTextAlign ffx_sceneParagraph_getAlign(FfxNode node);
+
+/**
+ *  Set the horizontal alignment of each line within the width; one of
+ *  FfxTextAlignLeft (the default), FfxTextAlignCenter or
+ *  FfxTextAlignRight.
+ */
+void ffx_sceneParagraph_setAlign(FfxNode node, FfxTextAlign align);
+
+FfxTextWrap ffx_sceneParagraph_getWrap(FfxNode node);
+void ffx_sceneParagraph_setWrap(FfxNode node, FfxTextWrap wrap);
+
+/**
+ *  Get the number of lines drawn, after wrapping and truncating, as of
+ *  the most recent sequence.
+ */
+size_t ffx_sceneParagraph_getLineCount(FfxNode node);
+
+/**
+ *  Get whether the text did not fit and ends with an ellipsis, as of the
+ *  most recent sequence.
+ */
+bool ffx_sceneParagraph_getTruncated(FfxNode node);
+
+color_ffxt ffx_sceneParagraph_getTextColor(FfxNode node);
+
+/**
+ *  Set the paragraph text %%color%%. This property can be **animated**.
+ */
+void ffx_sceneParagraph_setTextColor(FfxNode node, color_ffxt color);
+
+color_ffxt ffx_sceneParagraph_getOutlineColor(FfxNode node);
+
+/**
+ *  Set the paragraph outline %%color%%. This property can be **animated**.
+ */
+void ffx_sceneParagraph_setOutlineColor(FfxNode node, color_ffxt color);
+
+
 ///////////////////////////////
 // Anchor
 
@@ -548,6 +1486,7 @@ FfxNode ffx_scene_createQR(FfxScene scene, const char* text,
  */
 FfxNode ffx_scene_createQRData(FfxScene scene, const uint8_t* data,
   size_t length, FfxQRCorrection minLevel);
+bool ffx_scene_isQR(FfxNode node);
 
 /**
  *  Get the size of the QR Code, in pixels, including the quiet zone and
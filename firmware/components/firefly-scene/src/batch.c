@@ -0,0 +1,294 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+
+//////////////////////////
+// Recording
+
+static Command* addCommand(FfxSceneBatch _batch, CommandType type,
+  FfxNode node, size_t payloadSize) {
+
+    Batch *batch = _batch;
+    if (batch == NULL || node == NULL) { return NULL; }
+
+    Command *command = ffx_scene_memAlloc(batch->scene,
+      sizeof(Command) + payloadSize);
+    if (command == NULL) {
+        batch->failed = true;
+        return NULL;
+    }
+
+    command->type = type;
+    command->node = node;
+
+    // Prepend; the batch is stored most-recent first, which is reversed
+    // (along with every other batch) when applied
+    command->nextCommand = batch->head;
+    batch->head = command;
+    if (batch->tail == NULL) { batch->tail = command; }
+
+    return command;
+}
+
+FfxSceneBatch ffx_scene_beginBatch(FfxScene scene) {
+    Batch *batch = ffx_scene_memAlloc(scene, sizeof(Batch));
+    if (batch == NULL) { return NULL; }
+
+    batch->scene = scene;
+
+    return batch;
+}
+
+void ffx_sceneBatch_setPosition(FfxSceneBatch batch, FfxNode node,
+  FfxPoint position) {
+
+    Command *command = addCommand(batch, CommandTypeSetPosition, node, 0);
+    if (command == NULL) { return; }
+    command->value.position = position;
+}
+
+void ffx_sceneBatch_setColor(FfxSceneBatch batch, FfxNode node,
+  color_ffxt color) {
+
+    Command *command = addCommand(batch, CommandTypeSetColor, node, 0);
+    if (command == NULL) { return; }
+    command->value.color = color;
+}
+
+void ffx_sceneBatch_setText(FfxSceneBatch batch, FfxNode node,
+  const char *text) {
+
+    if (text == NULL) { text = ""; }
+
+    size_t length = strlen(text);
+
+    Command *command = addCommand(batch, CommandTypeSetText, node,
+      length + 1);
+    if (command == NULL) { return; }
+    strcpy((char*)&command[1], text);
+}
+
+void ffx_sceneBatch_appendChild(FfxSceneBatch batch, FfxNode node,
+  FfxNode child) {
+
+    Command *command = addCommand(batch, CommandTypeAppendChild, node, 0);
+    if (command == NULL) { return; }
+    command->value.child = child;
+}
+
+void ffx_sceneBatch_insertBefore(FfxSceneBatch batch, FfxNode node,
+  FfxNode child, FfxNode sibling) {
+
+    Command *command = addCommand(batch, CommandTypeInsertBefore, node, 0);
+    if (command == NULL) { return; }
+    command->value.insert.child = child;
+    command->value.insert.sibling = sibling;
+}
+
+void ffx_sceneBatch_detach(FfxSceneBatch batch, FfxNode node) {
+    addCommand(batch, CommandTypeDetach, node, 0);
+}
+
+void ffx_sceneBatch_remove(FfxSceneBatch batch, FfxNode node) {
+    addCommand(batch, CommandTypeRemove, node, 0);
+}
+
+void ffx_sceneBatch_animate(FfxSceneBatch _batch, FfxNode node,
+  FfxNodeAnimationSetupFunc setupFunc, void *arg) {
+
+    Batch *batch = _batch;
+    if (batch == NULL || node == NULL) { return; }
+
+    // Capture now, while %%arg%% is still valid; it is only started
+    // once the batch is applied
+    Animation *animation = ffx_sceneNode_captureAnimation(node, setupFunc,
+      arg);
+    if (animation == NULL) {
+        batch->failed = true;
+        return;
+    }
+
+    Command *command = addCommand(batch, CommandTypeAnimate, node, 0);
+    if (command == NULL) {
+        ffx_scene_freeAnimation(batch->scene, animation);
+        return;
+    }
+    command->value.animation = animation;
+}
+
+typedef struct PositionRunner {
+    FfxPoint position;
+    FfxNodeAnimation animation;
+} PositionRunner;
+
+static void setupPosition(FfxNode node, FfxNodeAnimation *animation,
+  void *arg) {
+
+    PositionRunner *runner = arg;
+    *animation = runner->animation;
+
+    ffx_sceneNode_setPosition(node, runner->position);
+}
+
+void ffx_sceneBatch_animatePosition(FfxSceneBatch batch, FfxNode node,
+  FfxPoint position, uint32_t delay, uint32_t duration, FfxCurveFunc curve,
+  FfxNodeAnimationCompletionFunc onComplete, void* arg) {
+
+    PositionRunner runner = {
+        .position = position,
+        .animation = {
+            .delay = delay,
+            .duration = duration,
+            .curve = curve,
+            .onComplete = onComplete,
+            .arg = arg
+        }
+    };
+
+    ffx_sceneBatch_animate(batch, node, setupPosition, &runner);
+}
+
+void ffx_sceneBatch_stopAnimations(FfxSceneBatch batch, FfxNode node,
+  bool completeAnimations) {
+
+    Command *command = addCommand(batch, CommandTypeStop, node, 0);
+    if (command == NULL) { return; }
+    command->value.stop = completeAnimations ? FfxSceneActionStopFinal:
+      FfxSceneActionStopCurrent;
+}
+
+static void freeCommands(Scene *scene, Command *command) {
+    while (command) {
+        Command *nextCommand = command->nextCommand;
+        if (command->type == CommandTypeAnimate) {
+            ffx_scene_freeAnimation(scene, command->value.animation);
+        }
+        ffx_scene_memFree(scene, command);
+        command = nextCommand;
+    }
+}
+
+bool ffx_sceneBatch_commit(FfxSceneBatch _batch) {
+    Batch *batch = _batch;
+    if (batch == NULL) { return false; }
+
+    Scene *scene = batch->scene;
+
+    // Applying what was recorded would leave the scene in a state the
+    // producer never asked for (e.g. a node added, but never removed)
+    if (batch->failed) {
+        printf("batch: a command could not be recorded; dropped\n");
+        freeCommands(scene, batch->head);
+        ffx_scene_memFree(scene, batch);
+        return false;
+    }
+
+    if (batch->head) {
+        // Splice the entire batch onto the committed stack in one step;
+        // a producer never blocks the IO task (or another producer)
+        Command *head = atomic_load_explicit(&scene->commands,
+          memory_order_relaxed);
+        do {
+            batch->tail->nextCommand = head;
+        } while (!atomic_compare_exchange_weak_explicit(&scene->commands,
+          &head, batch->head, memory_order_release, memory_order_relaxed));
+    }
+
+    ffx_scene_memFree(scene, batch);
+
+    return true;
+}
+
+
+//////////////////////////
+// Applying
+
+static void setColor(FfxNode node, color_ffxt color) {
+    if (ffx_scene_isBox(node)) {
+        ffx_sceneBox_setColor(node, color);
+    } else if (ffx_scene_isLabel(node)) {
+        ffx_sceneLabel_setTextColor(node, color);
+    } else if (ffx_scene_isFill(node)) {
+        ffx_sceneFill_setColor(node, color);
+    } else if (ffx_scene_isImage(node)) {
+        ffx_sceneImage_setTint(node, color);
+    } else {
+        printf("batch: %s has no color\n", ffx_sceneNode_getName(node));
+    }
+}
+
+static void applyCommand(Scene *scene, Command *command) {
+    Node *node = command->node;
+
+    // A node involved was freed since the command was committed (see:
+    // ffx_scene_releaseNodes); only an animation still needs completing
+    if (node == NULL && command->type != CommandTypeAnimate) { return; }
+
+    switch (command->type) {
+        case CommandTypeSetPosition:
+            ffx_sceneNode_setPosition(node, command->value.position);
+            break;
+
+        case CommandTypeSetColor:
+            setColor(node, command->value.color);
+            break;
+
+        case CommandTypeSetText:
+            ffx_sceneLabel_setText(node, (char*)&command[1]);
+            break;
+
+        case CommandTypeAppendChild:
+            ffx_sceneGroup_appendChild(node, command->value.child);
+            break;
+
+        case CommandTypeInsertBefore:
+            ffx_sceneGroup_insertBefore(node, command->value.insert.child,
+              command->value.insert.sibling);
+            break;
+
+        case CommandTypeDetach:
+            ffx_sceneNode_detach(node);
+            break;
+
+        case CommandTypeRemove:
+            ffx_sceneNode_remove(node);
+            break;
+
+        case CommandTypeAnimate:
+            ffx_scene_appendAnimation(scene, command->value.animation);
+            break;
+
+        case CommandTypeStop:
+            ffx_scene_stopAnimations(scene, node, command->value.stop);
+            break;
+    }
+}
+
+void ffx_scene_applyBatches(Scene *scene) {
+
+    // Take every committed batch at once; anything committed after this
+    // is picked up by the next sequence
+    Command *command = atomic_exchange_explicit(&scene->commands, NULL,
+      memory_order_acquire);
+    if (command == NULL) { return; }
+
+    // The stack is most-recent first; reverse it into commit order
+    Command *ordered = NULL;
+    while (command) {
+        Command *nextCommand = command->nextCommand;
+        command->nextCommand = ordered;
+        ordered = command;
+        command = nextCommand;
+    }
+
+    command = ordered;
+    while (command) {
+        Command *nextCommand = command->nextCommand;
+        applyCommand(scene, command);
+        ffx_scene_memFree(scene, command);
+        command = nextCommand;
+    }
+}
@@ -0,0 +1,325 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+// Blob format (multi-byte values are big-endian):
+//   - Header: version (0x01), format (0x53), nodeCount (u16),
+//     anchorCount (u16)
+//   - Nodes, depth-first, each: type (u8), flags (u8), x (i16), y (i16)
+//     followed by its payload (see: tools/src.ts/scene-blob.ts)
+
+#define VERSION_TAG        (0x01)
+#define FORMAT_SCENE       (0x53)
+
+#define HEADER_SIZE        (6)
+
+#define FLAG_HIDDEN        (1 << 0)
+
+// Limits the recursion on a malformed blob
+#define MAX_DEPTH          (32)
+
+#define ARENA_ALIGN(v)     (((v) + 7) & ~7)
+
+typedef enum BlobType {
+    BlobTypeGroup   = 1,
+    BlobTypeBox     = 2,
+    BlobTypeFill    = 3,
+    BlobTypeLabel   = 4,
+    BlobTypeImage   = 5,
+    BlobTypeAnchor  = 6,
+} BlobType;
+
+typedef struct Reader {
+    const uint8_t *data;
+    size_t offset;
+    size_t length;
+    bool error;
+} Reader;
+
+size_t _ffx_sceneAnchor_stateSize();
+size_t _ffx_sceneBox_stateSize();
+size_t _ffx_sceneFill_stateSize();
+size_t _ffx_sceneGroup_stateSize();
+size_t _ffx_sceneImage_stateSize();
+size_t _ffx_sceneLabel_stateSize();
+
+
+static uint32_t readValue(Reader *reader, size_t width) {
+    if (reader->offset + width > reader->length) {
+        reader->error = true;
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (int i = 0; i < width; i++) {
+        value = (value << 8) | reader->data[reader->offset++];
+    }
+
+    return value;
+}
+
+static uint32_t readU8(Reader *reader) { return readValue(reader, 1); }
+static uint32_t readU16(Reader *reader) { return readValue(reader, 2); }
+static uint32_t readU32(Reader *reader) { return readValue(reader, 4); }
+static int16_t readI16(Reader *reader) { return readValue(reader, 2); }
+
+static const uint8_t* readBytes(Reader *reader, size_t length) {
+    if (reader->offset + length > reader->length) {
+        reader->error = true;
+        return NULL;
+    }
+
+    const uint8_t *result = &reader->data[reader->offset];
+    reader->offset += length;
+    return result;
+}
+
+
+//////////////////////////
+// Validation
+
+static bool isFont(uint32_t font) {
+    switch (font) {
+        case FfxFontLarge: case FfxFontLargeBold:
+        case FfxFontMedium: case FfxFontMediumBold:
+        case FfxFontSmall: case FfxFontSmallBold:
+            return true;
+    }
+    return false;
+}
+
+// At most one vertical and one horizontal alignment (0 is the default)
+static bool isAlign(uint32_t align) {
+    uint32_t vertical = align & 0x1f, horizontal = align & 0xe0;
+    return ((vertical & (vertical - 1)) == 0 &&
+      (horizontal & (horizontal - 1)) == 0);
+}
+
+// Validates a node record (and its children), accumulating the arena
+// size required and the anchor count
+static bool measureNode(Reader *reader, int depth,
+  const FfxSceneBlobImage *images, size_t imageCount, size_t *size,
+  size_t *anchorCount) {
+
+    if (depth > MAX_DEPTH) { return false; }
+
+    uint32_t type = readU8(reader);
+    readBytes(reader, 5);
+
+    size_t stateSize = 0;
+
+    switch (type) {
+        case BlobTypeGroup: {
+            stateSize = _ffx_sceneGroup_stateSize();
+            uint32_t count = readU16(reader);
+            for (int i = 0; i < count && !reader->error; i++) {
+                if (!measureNode(reader, depth + 1, images, imageCount, size,
+                  anchorCount)) {
+                    return false;
+                }
+            }
+            break;
+        }
+
+        case BlobTypeBox:
+            stateSize = _ffx_sceneBox_stateSize();
+            readBytes(reader, 8);
+            break;
+
+        case BlobTypeFill:
+            stateSize = _ffx_sceneFill_stateSize();
+            readBytes(reader, 4);
+            break;
+
+        case BlobTypeLabel: {
+            stateSize = _ffx_sceneLabel_stateSize();
+            uint32_t font = readU8(reader), align = readU8(reader);
+            if (reader->error) { return false; }
+            if (!isFont(font) || !isAlign(align)) {
+                printf("blob: invalid label font 0x%02x or align 0x%02x\n",
+                  (int)font, (int)align);
+                return false;
+            }
+            readBytes(reader, 8);
+            readBytes(reader, readU8(reader));
+            break;
+        }
+
+        case BlobTypeImage: {
+            stateSize = _ffx_sceneImage_stateSize();
+            uint32_t index = readU8(reader);
+            if (reader->error || index >= imageCount) { return false; }
+            FfxSize imageSize = ffx_scene_getImageSize(images[index].data,
+              images[index].length);
+            if (imageSize.width == 0 || imageSize.height == 0) {
+                printf("blob: invalid image %d\n", (int)index);
+                return false;
+            }
+            readBytes(reader, 4);
+            break;
+        }
+
+        case BlobTypeAnchor:
+            readBytes(reader, 4);
+            stateSize = _ffx_sceneAnchor_stateSize() + readU16(reader);
+            (*anchorCount)++;
+            if (!measureNode(reader, depth + 1, images, imageCount, size,
+              anchorCount)) {
+                return false;
+            }
+            break;
+
+        default:
+            printf("blob: unknown node type %d\n", (int)type);
+            return false;
+    }
+
+    *size += ARENA_ALIGN(sizeof(Node) + stateSize);
+
+    return !reader->error;
+}
+
+
+//////////////////////////
+// Instantiation
+
+typedef struct Context {
+    Scene *scene;
+    const FfxSceneBlobImage *images;
+    FfxNode *anchors;
+    size_t anchorIndex;
+} Context;
+
+// Only called on a validated blob
+static FfxNode createNode(Reader *reader, Context *context) {
+    Scene *scene = context->scene;
+
+    uint32_t type = readU8(reader);
+    uint32_t flags = readU8(reader);
+    FfxPoint position = { .x = 0, .y = 0 };
+    position.x = readI16(reader);
+    position.y = readI16(reader);
+
+    FfxNode node = NULL;
+
+    switch (type) {
+        case BlobTypeGroup: {
+            node = ffx_scene_createGroup(scene);
+            uint32_t count = readU16(reader);
+            for (int i = 0; i < count; i++) {
+                ffx_sceneGroup_appendChild(node, createNode(reader, context));
+            }
+            break;
+        }
+
+        case BlobTypeBox: {
+            FfxSize size = { .width = 0, .height = 0 };
+            size.width = readU16(reader);
+            size.height = readU16(reader);
+            node = ffx_scene_createBox(scene, size);
+            ffx_sceneBox_setColor(node, readU32(reader));
+            break;
+        }
+
+        case BlobTypeFill:
+            node = ffx_scene_createFill(scene, readU32(reader));
+            break;
+
+        case BlobTypeLabel: {
+            FfxFont font = readU8(reader);
+            FfxTextAlign align = readU8(reader);
+            color_ffxt textColor = readU32(reader);
+            color_ffxt outlineColor = readU32(reader);
+
+            size_t length = readU8(reader);
+            char text[256];
+            memcpy(text, readBytes(reader, length), length);
+            text[length] = 0;
+
+            node = ffx_scene_createLabel(scene, font, text);
+            if (align) { ffx_sceneLabel_setAlign(node, align); }
+            ffx_sceneLabel_setTextColor(node, textColor);
+            ffx_sceneLabel_setOutlineColor(node, outlineColor);
+            break;
+        }
+
+        case BlobTypeImage: {
+            const FfxSceneBlobImage *image = &context->images[readU8(reader)];
+            node = ffx_scene_createImage(scene, image->data, image->length);
+            ffx_sceneImage_setTint(node, readU32(reader));
+            break;
+        }
+
+        case BlobTypeAnchor: {
+            // Reserve the slot now, so anchors are in document order
+            size_t index = context->anchorIndex++;
+
+            FfxNodeTag tag = readU32(reader);
+            size_t dataSize = readU16(reader);
+            FfxNode child = createNode(reader, context);
+
+            node = ffx_scene_createAnchor(scene, tag, dataSize, child);
+            context->anchors[index] = node;
+            break;
+        }
+    }
+
+    ffx_sceneNode_setPosition(node, position);
+    if (flags & FLAG_HIDDEN) { ffx_sceneNode_setHidden(node, true); }
+
+    return node;
+}
+
+FfxNode ffx_scene_createBlob(FfxScene _scene, const uint8_t *blob,
+  size_t length, const FfxSceneBlobImage *images, size_t imageCount,
+  FfxNode *anchors, size_t anchorCount) {
+
+    Scene *scene = _scene;
+
+    Reader reader = { .data = blob, .offset = 0, .length = length };
+
+    if (readU8(&reader) != VERSION_TAG || readU8(&reader) != FORMAT_SCENE) {
+        printf("blob: unsupported format\n");
+        return NULL;
+    }
+
+    readU16(&reader);
+    if (readU16(&reader) != anchorCount) {
+        printf("blob: anchor count mismatch\n");
+        return NULL;
+    }
+
+    // The root must be a group, which owns the arena
+    if (reader.offset >= length || blob[reader.offset] != BlobTypeGroup) {
+        printf("blob: root must be a group\n");
+        return NULL;
+    }
+
+    size_t size = 0, count = 0;
+    if (!measureNode(&reader, 0, images, imageCount, &size, &count) ||
+      count != anchorCount) {
+        printf("blob: invalid blob\n");
+        return NULL;
+    }
+
+    Arena arena = { .offset = 0, .size = size };
+    arena.data = ffx_scene_memAlloc(scene, size);
+    if (arena.data == NULL) { return NULL; }
+
+    Context context = {
+        .scene = scene,
+        .images = images,
+        .anchors = anchors,
+        .anchorIndex = 0
+    };
+
+    reader.offset = HEADER_SIZE;
+
+    ffx_scene_setArena(&arena);
+    FfxNode root = createNode(&reader, &context);
+    ffx_scene_setArena(NULL);
+
+    return root;
+}
@@ -67,15 +67,17 @@ color_ffxt ffx_color_gray(uint8_t lum) {
 
 #define B6        (0x3f)
 #define B8        (0xff)
-#define B11      (0x7ff)
-#define B17    (0x1ffff)
 
-#define B11_6    (0x7ff / 6)
+// The rising channel across each 60 degree hue region; round(i * 255 / 60)
+static const uint8_t hueRamp[60] = {
+      0,   4,   8,  13,  17,  21,  26,  30,  34,  38,  42,  47,
+     51,  55,  60,  64,  68,  72,  76,  81,  85,  89,  94,  98,
+    102, 106, 110, 115, 119, 123, 128, 132, 136, 140, 144, 149,
+    153, 157, 162, 166, 170, 174, 178, 183, 187, 191, 196, 200,
+    204, 208, 212, 217, 221, 225, 230, 234, 238, 242, 246, 251
+};
 
-// @TODO: This an be optimized using only multiply and keeping the
-//        result in a fixed notation, like fixed 12:20.
-
-// Heavily inspired by: https://stackoverflow.com/questions/3018313/algorithm-to-convert-rgb-to-hsv-and-hsv-to-rgb-in-range-0-255-for-both
+// Only divides by constants, which compile to multiplies
 static color_ffxt _fromHSV(color_ffxt color) {
 
     // Mask out the HSV-specific bits; keep the alpha
@@ -92,16 +94,15 @@ static color_ffxt _fromHSV(color_ffxt color) {
         return result;
     }
 
-    // Normalize s to [0, 2047] (11-bits); which has an error of 0.1666
-    int32_t h = ((_getH(color) % 360) * B11) / 360;
-
-    // Normalized to [0, 2047] (11-bits)
-    int32_t region = h / B11_6;
-    int32_t rem = (h - (region * B11_6)) * 6;
+    int32_t h = _getH(color) % 360;
+    int32_t region = h / 60;
+    int32_t rise = hueRamp[h - (region * 60)];
 
-    int32_t p = (v * (B6 - s)) >> 6;
-    int32_t t = (v * (B17 - (s * (B11 - rem)))) >> 17;
-    int32_t q = (v * (B17 - (s * rem))) >> 17;
+    // The fully-saturated channels are 255, 0 and the rising (or falling)
+    // ramp; desaturate each toward v
+    int32_t p = (v * (B6 - s)) / B6;
+    int32_t t = (v * ((B6 * B8) - (s * (B8 - rise)))) / (B6 * B8);
+    int32_t q = (v * ((B6 * B8) - (s * rise))) / (B6 * B8);
 
     // Map the RGB value based on the region
     switch (region) {
@@ -125,8 +126,6 @@ static color_ffxt _fromHSV(color_ffxt color) {
             break;
     }
 
-    //printf("h=%ld s=%ld v=%ld region=%ld rem=%ld p=%ld qt=%ld\n", h, s, v, region, rem, p, qt);
-
     return result;
 }
 
@@ -142,22 +141,28 @@ static color_ffxt _fromRGB(color_ffxt color) {
     int32_t v = rgbMax;
     if (v == 0) { return result; }
 
+    // Greys still carry their value
+    result |= (v >> 2);
+
     int32_t rgbDelta = rgbMax - rgbMin;
 
     int32_t s = 255 * rgbDelta / v;
     if (s == 0) { return result; }
 
     result |= (s & 0xfc) << 4;
-    result |= (v >> 2);;
 
+    int32_t h;
     if (rgbMax == r) {
-        result |= (0 + 60 * (g - b) / rgbDelta) << 12;
+        h = 60 * (g - b) / rgbDelta;
+        if (h < 0) { h += 360; }
     } else if (rgbMax == g) {
-        result |= (120 + 60 * (g - b) / rgbDelta) << 12;
+        h = 120 + 60 * (b - r) / rgbDelta;
     } else {
-        result |= (240 + 60 * (g - b) / rgbDelta) << 12;
+        h = 240 + 60 * (r - g) / rgbDelta;
     }
 
+    result |= h << 12;
+
     return result;
 }
 
@@ -302,6 +307,27 @@ FfxColorRGB ffx_color_parseRGB(color_ffxt color) {
     return rgb;
 }
 
+FfxColorRGB565 ffx_color_parseRGB565(color_ffxt color) {
+    if (color & COLOR_HSV) { color = _fromHSV(color); }
+
+    int32_t opacity = _getO(color);
+
+    // Pad alpha with 11 zeros (i.e. 0x20 => 0x10000; 1 in fixed-point)
+    fixed_ffxt alpha = opacity << 11;
+
+    FfxColorRGB565 result;
+    result.rgb16 = RGB16(_getR(color), _getG(color), _getB(color));
+    result.opacity = opacity;
+
+    // The 8-bit channels scaled to RGB565 depth, keeping the fraction
+    result.red = (_getR(color) * alpha) >> 3;
+    result.green = (_getG(color) * alpha) >> 2;
+    result.blue = (_getB(color) * alpha) >> 3;
+    result.alpha_1 = FM_1 - alpha;
+
+    return result;
+}
+
 uint8_t ffx_color_getOpacity(color_ffxt color) {
     return _getO(color);
 }
@@ -0,0 +1,278 @@
+#ifndef __CURVE_TABLES_H__
+#define __CURVE_TABLES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+#include <stdint.h>
+
+// Generated by: tools/reference/generate-curves.c
+
+#define CURVE_SEGMENTS    (256)
+
+static const int16_t curve_easeInSine[] = {
+      0,      0,      1,      3,      5,      8,     11,     15,     20,     25,
+     31,     37,     44,     52,     60,     69,     79,     89,    100,    111,
+    123,    136,    149,    163,    177,    192,    208,    224,    241,    259,
+    277,    296,    315,    335,    355,    376,    398,    420,    443,    467,
+    491,    516,    541,    567,    593,    621,    648,    677,    705,    735,
+    765,    796,    827,    859,    891,    924,    958,    992,   1027,   1062,
+   1098,   1134,   1171,   1209,   1247,   1286,   1325,   1365,   1406,   1447,
+   1488,   1530,   1573,   1616,   1660,   1704,   1749,   1795,   1841,   1887,
+   1935,   1982,   2030,   2079,   2128,   2178,   2229,   2280,   2331,   2383,
+   2435,   2488,   2542,   2596,   2651,   2706,   2761,   2817,   2874,   2931,
+   2989,   3047,   3105,   3165,   3224,   3284,   3345,   3406,   3468,   3530,
+   3592,   3655,   3719,   3783,   3847,   3912,   3978,   4044,   4110,   4177,
+   4244,   4312,   4380,   4449,   4518,   4587,   4657,   4728,   4799,   4870,
+   4942,   5014,   5087,   5160,   5233,   5307,   5381,   5456,   5531,   5606,
+   5682,   5759,   5835,   5913,   5990,   6068,   6146,   6225,   6304,   6383,
+   6463,   6543,   6624,   6705,   6786,   6868,   6950,   7032,   7115,   7198,
+   7282,   7365,   7449,   7534,   7619,   7704,   7789,   7875,   7961,   8047,
+   8134,   8221,   8308,   8396,   8484,   8572,   8661,   8749,   8839,   8928,
+   9018,   9108,   9198,   9288,   9379,   9470,   9561,   9653,   9745,   9837,
+   9929,  10021,  10114,  10207,  10300,  10394,  10487,  10581,  10676,  10770,
+  10864,  10959,  11054,  11149,  11245,  11340,  11436,  11532,  11628,  11724,
+  11821,  11917,  12014,  12111,  12208,  12306,  12403,  12501,  12598,  12696,
+  12794,  12892,  12991,  13089,  13188,  13286,  13385,  13484,  13583,  13682,
+  13781,  13881,  13980,  14079,  14179,  14279,  14378,  14478,  14578,  14678,
+  14778,  14878,  14978,  15078,  15179,  15279,  15379,  15480,  15580,  15680,
+  15781,  15881,  15982,  16082,  16183,  16283,  16384,
+};
+
+static const int16_t curve_easeOutSine[] = {
+      0,    101,    201,    302,    402,    503,    603,    704,    804,    904,
+   1005,   1105,   1205,   1306,   1406,   1506,   1606,   1706,   1806,   1906,
+   2006,   2105,   2205,   2305,   2404,   2503,   2603,   2702,   2801,   2900,
+   2999,   3098,   3196,   3295,   3393,   3492,   3590,   3688,   3786,   3883,
+   3981,   4078,   4176,   4273,   4370,   4467,   4563,   4660,   4756,   4852,
+   4948,   5044,   5139,   5235,   5330,   5425,   5520,   5614,   5708,   5803,
+   5897,   5990,   6084,   6177,   6270,   6363,   6455,   6547,   6639,   6731,
+   6823,   6914,   7005,   7096,   7186,   7276,   7366,   7456,   7545,   7635,
+   7723,   7812,   7900,   7988,   8076,   8163,   8250,   8337,   8423,   8509,
+   8595,   8680,   8765,   8850,   8935,   9019,   9102,   9186,   9269,   9352,
+   9434,   9516,   9598,   9679,   9760,   9841,   9921,  10001,  10080,  10159,
+  10238,  10316,  10394,  10471,  10549,  10625,  10702,  10778,  10853,  10928,
+  11003,  11077,  11151,  11224,  11297,  11370,  11442,  11514,  11585,  11656,
+  11727,  11797,  11866,  11935,  12004,  12072,  12140,  12207,  12274,  12340,
+  12406,  12472,  12537,  12601,  12665,  12729,  12792,  12854,  12916,  12978,
+  13039,  13100,  13160,  13219,  13279,  13337,  13395,  13453,  13510,  13567,
+  13623,  13678,  13733,  13788,  13842,  13896,  13949,  14001,  14053,  14104,
+  14155,  14206,  14256,  14305,  14354,  14402,  14449,  14497,  14543,  14589,
+  14635,  14680,  14724,  14768,  14811,  14854,  14896,  14937,  14978,  15019,
+  15059,  15098,  15137,  15175,  15213,  15250,  15286,  15322,  15357,  15392,
+  15426,  15460,  15493,  15525,  15557,  15588,  15619,  15649,  15679,  15707,
+  15736,  15763,  15791,  15817,  15843,  15868,  15893,  15917,  15941,  15964,
+  15986,  16008,  16029,  16049,  16069,  16088,  16107,  16125,  16143,  16160,
+  16176,  16192,  16207,  16221,  16235,  16248,  16261,  16273,  16284,  16295,
+  16305,  16315,  16324,  16332,  16340,  16347,  16353,  16359,  16364,  16369,
+  16373,  16376,  16379,  16381,  16383,  16384,  16384,
+};
+
+static const int16_t curve_easeInOutSine[] = {
+      0,      1,      2,      6,     10,     15,     22,     30,     39,     50,
+     62,     75,     89,    104,    121,    138,    157,    178,    199,    222,
+    246,    271,    297,    324,    353,    383,    413,    446,    479,    513,
+    549,    586,    624,    663,    703,    744,    787,    830,    875,    920,
+    967,   1015,   1064,   1114,   1165,   1218,   1271,   1325,   1381,   1437,
+   1494,   1553,   1612,   1673,   1734,   1796,   1859,   1924,   1989,   2055,
+   2122,   2190,   2259,   2329,   2399,   2471,   2543,   2617,   2691,   2765,
+   2841,   2918,   2995,   3073,   3152,   3232,   3312,   3393,   3475,   3558,
+   3641,   3725,   3809,   3895,   3980,   4067,   4154,   4242,   4330,   4419,
+   4509,   4599,   4689,   4781,   4872,   4964,   5057,   5150,   5244,   5338,
+   5432,   5527,   5622,   5718,   5814,   5910,   6007,   6104,   6202,   6299,
+   6397,   6495,   6594,   6693,   6791,   6891,   6990,   7090,   7189,   7289,
+   7389,   7489,   7589,   7690,   7790,   7890,   7991,   8091,   8192,   8293,
+   8393,   8494,   8594,   8694,   8795,   8895,   8995,   9095,   9195,   9294,
+   9394,   9493,   9593,   9691,   9790,   9889,   9987,  10085,  10182,  10280,
+  10377,  10474,  10570,  10666,  10762,  10857,  10952,  11046,  11140,  11234,
+  11327,  11420,  11512,  11603,  11695,  11785,  11875,  11965,  12054,  12142,
+  12230,  12317,  12404,  12489,  12575,  12659,  12743,  12826,  12909,  12991,
+  13072,  13152,  13232,  13311,  13389,  13466,  13543,  13619,  13693,  13767,
+  13841,  13913,  13985,  14055,  14125,  14194,  14262,  14329,  14395,  14460,
+  14525,  14588,  14650,  14711,  14772,  14831,  14890,  14947,  15003,  15059,
+  15113,  15166,  15219,  15270,  15320,  15369,  15417,  15464,  15509,  15554,
+  15597,  15640,  15681,  15721,  15760,  15798,  15835,  15871,  15905,  15938,
+  15971,  16001,  16031,  16060,  16087,  16113,  16138,  16162,  16185,  16206,
+  16227,  16246,  16263,  16280,  16295,  16309,  16322,  16334,  16345,  16354,
+  16362,  16369,  16374,  16378,  16382,  16383,  16384,
+};
+
+static const int16_t curve_easeInExpo[] = {
+      0,     16,     17,     17,     18,     18,     19,     19,     20,     20,
+     21,     22,     22,     23,     23,     24,     25,     25,     26,     27,
+     27,     28,     29,     30,     31,     31,     32,     33,     34,     35,
+     36,     37,     38,     39,     40,     41,     42,     44,     45,     46,
+     47,     49,     50,     51,     53,     54,     56,     57,     59,     60,
+     62,     64,     65,     67,     69,     71,     73,     75,     77,     79,
+     81,     83,     86,     88,     91,     93,     96,     98,    101,    104,
+    106,    109,    112,    115,    119,    122,    125,    129,    132,    136,
+    140,    143,    147,    151,    156,    160,    164,    169,    173,    178,
+    183,    188,    193,    198,    204,    210,    215,    221,    227,    233,
+    240,    246,    253,    260,    267,    275,    282,    290,    298,    306,
+    314,    323,    332,    341,    350,    360,    370,    380,    391,    401,
+    412,    424,    435,    447,    459,    472,    485,    498,    512,    526,
+    540,    555,    571,    586,    602,    619,    636,    653,    671,    690,
+    709,    728,    748,    769,    790,    811,    834,    856,    880,    904,
+    929,    954,    981,   1007,   1035,   1064,   1093,   1123,   1154,   1185,
+   1218,   1251,   1286,   1321,   1357,   1394,   1433,   1472,   1512,   1554,
+   1596,   1640,   1685,   1732,   1779,   1828,   1878,   1930,   1983,   2037,
+   2093,   2150,   2209,   2270,   2332,   2396,   2462,   2530,   2599,   2670,
+   2744,   2819,   2896,   2976,   3057,   3141,   3228,   3316,   3407,   3501,
+   3597,   3696,   3797,   3901,   4008,   4118,   4231,   4347,   4467,   4589,
+   4715,   4845,   4978,   5114,   5255,   5399,   5547,   5699,   5856,   6016,
+   6182,   6351,   6526,   6705,   6889,   7078,   7272,   7472,   7677,   7887,
+   8104,   8326,   8555,   8789,   9031,   9279,   9533,   9795,  10064,  10340,
+  10624,  10915,  11215,  11523,  11839,  12164,  12498,  12841,  13193,  13555,
+  13927,  14310,  14702,  15106,  15520,  15946,  16384,
+};
+
+static const int16_t curve_easeOutExpo[] = {
+      0,    438,    864,   1278,   1682,   2074,   2457,   2829,   3191,   3543,
+   3886,   4220,   4545,   4861,   5169,   5469,   5760,   6044,   6320,   6589,
+   6851,   7105,   7353,   7595,   7829,   8058,   8280,   8497,   8707,   8912,
+   9112,   9306,   9495,   9679,   9858,  10033,  10202,  10368,  10528,  10685,
+  10837,  10985,  11129,  11270,  11406,  11539,  11669,  11795,  11917,  12037,
+  12153,  12266,  12376,  12483,  12587,  12688,  12787,  12883,  12977,  13068,
+  13156,  13243,  13327,  13408,  13488,  13565,  13640,  13714,  13785,  13854,
+  13922,  13988,  14052,  14114,  14175,  14234,  14291,  14347,  14401,  14454,
+  14506,  14556,  14605,  14652,  14699,  14744,  14788,  14830,  14872,  14912,
+  14951,  14990,  15027,  15063,  15098,  15133,  15166,  15199,  15230,  15261,
+  15291,  15320,  15349,  15377,  15403,  15430,  15455,  15480,  15504,  15528,
+  15550,  15573,  15594,  15615,  15636,  15656,  15675,  15694,  15713,  15731,
+  15748,  15765,  15782,  15798,  15813,  15829,  15844,  15858,  15872,  15886,
+  15899,  15912,  15925,  15937,  15949,  15960,  15972,  15983,  15993,  16004,
+  16014,  16024,  16034,  16043,  16052,  16061,  16070,  16078,  16086,  16094,
+  16102,  16109,  16117,  16124,  16131,  16138,  16144,  16151,  16157,  16163,
+  16169,  16174,  16180,  16186,  16191,  16196,  16201,  16206,  16211,  16215,
+  16220,  16224,  16228,  16233,  16237,  16241,  16244,  16248,  16252,  16255,
+  16259,  16262,  16265,  16269,  16272,  16275,  16278,  16280,  16283,  16286,
+  16288,  16291,  16293,  16296,  16298,  16301,  16303,  16305,  16307,  16309,
+  16311,  16313,  16315,  16317,  16319,  16320,  16322,  16324,  16325,  16327,
+  16328,  16330,  16331,  16333,  16334,  16335,  16337,  16338,  16339,  16340,
+  16342,  16343,  16344,  16345,  16346,  16347,  16348,  16349,  16350,  16351,
+  16352,  16353,  16353,  16354,  16355,  16356,  16357,  16357,  16358,  16359,
+  16359,  16360,  16361,  16361,  16362,  16362,  16363,  16364,  16364,  16365,
+  16365,  16366,  16366,  16367,  16367,  16368,  16384,
+};
+
+static const int16_t curve_easeInOutExpo[] = {
+      0,      8,      9,      9,     10,     10,     11,     12,     12,     13,
+     14,     15,     15,     16,     17,     18,     19,     20,     21,     22,
+     24,     25,     26,     28,     29,     31,     33,     35,     36,     38,
+     41,     43,     45,     48,     50,     53,     56,     59,     63,     66,
+     70,     74,     78,     82,     87,     91,     97,    102,    108,    114,
+    120,    127,    134,    141,    149,    157,    166,    175,    185,    195,
+    206,    218,    230,    243,    256,    270,    285,    301,    318,    336,
+    354,    374,    395,    417,    440,    464,    490,    518,    546,    577,
+    609,    643,    679,    716,    756,    798,    843,    890,    939,    991,
+   1046,   1105,   1166,   1231,   1300,   1372,   1448,   1529,   1614,   1704,
+   1798,   1898,   2004,   2116,   2233,   2358,   2489,   2627,   2774,   2928,
+   3091,   3263,   3444,   3636,   3838,   4052,   4277,   4515,   4767,   5032,
+   5312,   5607,   5919,   6249,   6597,   6964,   7351,   7760,   8192,   8624,
+   9033,   9420,   9787,  10135,  10465,  10777,  11072,  11352,  11617,  11869,
+  12107,  12332,  12546,  12748,  12940,  13121,  13293,  13456,  13610,  13757,
+  13895,  14026,  14151,  14268,  14380,  14486,  14586,  14680,  14770,  14855,
+  14936,  15012,  15084,  15153,  15218,  15279,  15338,  15393,  15445,  15494,
+  15541,  15586,  15628,  15668,  15705,  15741,  15775,  15807,  15838,  15866,
+  15894,  15920,  15944,  15967,  15989,  16010,  16030,  16048,  16066,  16083,
+  16099,  16114,  16128,  16141,  16154,  16166,  16178,  16189,  16199,  16209,
+  16218,  16227,  16235,  16243,  16250,  16257,  16264,  16270,  16276,  16282,
+  16287,  16293,  16297,  16302,  16306,  16310,  16314,  16318,  16321,  16325,
+  16328,  16331,  16334,  16336,  16339,  16341,  16343,  16346,  16348,  16349,
+  16351,  16353,  16355,  16356,  16358,  16359,  16360,  16362,  16363,  16364,
+  16365,  16366,  16367,  16368,  16369,  16369,  16370,  16371,  16372,  16372,
+  16373,  16374,  16374,  16375,  16375,  16376,  16384,
+};
+
+static const int16_t curve_easeInElastic[] = {
+      0,     -7,     -6,     -5,     -3,     -2,     -1,      1,      3,      4,
+      6,      8,     10,     12,     14,     16,     17,     19,     21,     23,
+     25,     26,     28,     29,     30,     31,     32,     33,     33,     34,
+     34,     33,     33,     32,     31,     30,     28,     26,     24,     21,
+     18,     15,     11,      8,      3,     -1,     -5,    -10,    -15,    -20,
+    -26,    -31,    -36,    -42,    -47,    -53,    -58,    -63,    -68,    -73,
+    -77,    -81,    -85,    -88,    -91,    -93,    -94,    -95,    -96,    -95,
+    -94,    -92,    -89,    -86,    -81,    -76,    -70,    -63,    -55,    -46,
+    -36,    -26,    -14,     -2,     10,     23,     37,     52,     66,     81,
+     97,    112,    127,    143,    158,    172,    186,    200,    213,    225,
+    235,    245,    253,    260,    265,    268,    270,    270,    267,    263,
+    256,    246,    235,    221,    204,    185,    164,    140,    113,     85,
+     54,     21,    -14,    -51,    -90,   -130,   -171,   -213,   -256,   -299,
+   -343,   -386,   -429,   -471,   -511,   -550,   -587,   -622,   -654,   -682,
+   -707,   -728,   -744,   -756,   -763,   -764,   -759,   -749,   -732,   -708,
+   -678,   -641,   -597,   -546,   -488,   -423,   -351,   -273,   -188,    -97,
+      0,    102,    209,    321,    436,    555,    675,    798,    921,   1043,
+   1165,   1285,   1401,   1513,   1620,   1721,   1814,   1898,   1973,   2037,
+   2088,   2127,   2152,   2161,   2155,   2132,   2091,   2032,   1954,   1857,
+   1741,   1604,   1448,   1272,   1077,    863,    630,    379,    111,   -172,
+   -469,   -780,  -1102,  -1434,  -1773,  -2117,  -2465,  -2813,  -3158,  -3499,
+  -3833,  -4155,  -4464,  -4756,  -5028,  -5277,  -5500,  -5692,  -5853,  -5977,
+  -6063,  -6107,  -6107,  -6061,  -5966,  -5820,  -5621,  -5369,  -5062,  -4698,
+  -4279,  -3804,  -3274,  -2689,  -2051,  -1361,   -624,    160,    986,   1851,
+   2750,   3677,   4628,   5597,   6577,   7562,   8543,   9514,  10467,  11392,
+  12283,  13129,  13922,  14653,  15313,  15893,  16384,
+};
+
+static const int16_t curve_easeOutElastic[] = {
+      0,    491,   1071,   1731,   2462,   3255,   4101,   4992,   5917,   6870,
+   7841,   8822,   9807,  10787,  11756,  12707,  13634,  14533,  15398,  16224,
+  17008,  17745,  18435,  19073,  19658,  20188,  20663,  21082,  21446,  21753,
+  22005,  22204,  22350,  22445,  22491,  22491,  22447,  22361,  22237,  22076,
+  21884,  21661,  21412,  21140,  20848,  20539,  20217,  19883,  19542,  19197,
+  18849,  18501,  18157,  17818,  17486,  17164,  16853,  16556,  16273,  16005,
+  15754,  15521,  15307,  15112,  14936,  14780,  14643,  14527,  14430,  14352,
+  14293,  14252,  14229,  14223,  14232,  14257,  14296,  14347,  14411,  14486,
+  14570,  14663,  14764,  14871,  14983,  15099,  15219,  15341,  15463,  15586,
+  15709,  15829,  15948,  16063,  16175,  16282,  16384,  16481,  16572,  16657,
+  16735,  16807,  16872,  16930,  16981,  17025,  17062,  17092,  17116,  17133,
+  17143,  17148,  17147,  17140,  17128,  17112,  17091,  17066,  17038,  17006,
+  16971,  16934,  16895,  16855,  16813,  16770,  16727,  16683,  16640,  16597,
+  16555,  16514,  16474,  16435,  16398,  16363,  16330,  16299,  16271,  16244,
+  16220,  16199,  16180,  16163,  16149,  16138,  16128,  16121,  16117,  16114,
+  16114,  16116,  16119,  16124,  16131,  16139,  16149,  16159,  16171,  16184,
+  16198,  16212,  16226,  16241,  16257,  16272,  16287,  16303,  16318,  16332,
+  16347,  16361,  16374,  16386,  16398,  16410,  16420,  16430,  16439,  16447,
+  16454,  16460,  16465,  16470,  16473,  16476,  16478,  16479,  16480,  16479,
+  16478,  16477,  16475,  16472,  16469,  16465,  16461,  16457,  16452,  16447,
+  16442,  16437,  16431,  16426,  16420,  16415,  16410,  16404,  16399,  16394,
+  16389,  16385,  16381,  16376,  16373,  16369,  16366,  16363,  16360,  16358,
+  16356,  16354,  16353,  16352,  16351,  16351,  16350,  16350,  16351,  16351,
+  16352,  16353,  16354,  16355,  16356,  16358,  16359,  16361,  16363,  16365,
+  16367,  16368,  16370,  16372,  16374,  16376,  16378,  16380,  16381,  16383,
+  16385,  16386,  16387,  16389,  16390,  16391,  16384,
+};
+
+static const int16_t curve_easeInOutElastic[] = {
+      0,      2,      3,      5,      6,      7,      8,      9,     11,     12,
+     13,     14,     15,     16,     17,     18,     18,     18,     18,     17,
+     17,     16,     14,     12,     10,      7,      4,      1,     -3,     -8,
+    -12,    -17,    -23,    -28,    -34,    -40,    -46,    -52,    -58,    -63,
+    -69,    -74,    -78,    -81,    -84,    -85,    -86,    -85,    -82,    -79,
+    -73,    -66,    -56,    -45,    -32,    -17,      0,     19,     40,     63,
+     87,    113,    140,    168,    196,    225,    253,    281,    307,    332,
+    354,    373,    389,    400,    406,    407,    402,    389,    369,    341,
+    304,    259,    204,    140,     66,    -17,   -110,   -211,   -321,   -438,
+   -562,   -691,   -825,   -960,  -1096,  -1230,  -1361,  -1485,  -1600,  -1703,
+  -1792,  -1862,  -1911,  -1936,  -1934,  -1901,  -1835,  -1732,  -1591,  -1408,
+  -1183,   -913,   -598,   -238,    167,    616,   1107,   1637,   2201,   2796,
+   3414,   4051,   4696,   5342,   5979,   6594,   7177,   7714,   8192,   8670,
+   9207,   9790,  10405,  11042,  11688,  12333,  12970,  13588,  14183,  14747,
+  15277,  15768,  16217,  16622,  16982,  17297,  17567,  17792,  17975,  18116,
+  18219,  18285,  18318,  18320,  18295,  18246,  18176,  18087,  17984,  17869,
+  17745,  17614,  17480,  17344,  17209,  17075,  16946,  16822,  16705,  16595,
+  16494,  16401,  16318,  16244,  16180,  16125,  16080,  16043,  16015,  15995,
+  15982,  15977,  15978,  15984,  15995,  16011,  16030,  16052,  16077,  16103,
+  16131,  16159,  16188,  16216,  16244,  16271,  16297,  16321,  16344,  16365,
+  16384,  16401,  16416,  16429,  16440,  16450,  16457,  16463,  16466,  16469,
+  16470,  16469,  16468,  16465,  16462,  16458,  16453,  16447,  16442,  16436,
+  16430,  16424,  16418,  16412,  16407,  16401,  16396,  16392,  16387,  16383,
+  16380,  16377,  16374,  16372,  16370,  16368,  16367,  16367,  16366,  16366,
+  16366,  16366,  16367,  16368,  16369,  16370,  16371,  16372,  16373,  16375,
+  16376,  16377,  16378,  16379,  16381,  16382,  16384,
+};
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* __CURVE_TABLES_H__ */
@@ -3,12 +3,35 @@
 // See: https://easings.net/
 
 
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
 #include "firefly-curves.h"
 
+#include "curve-tables.h"
+
 
 static const fixed_ffxt FM_2      =    0x20000;
-static const fixed_ffxt FM_10     =    0xa0000;
-static const fixed_ffxt FM_20     =   0x140000;
+
+
+// Interpolates the 2.14 samples in %%table%% at %%t%%; curves which
+// are expensive to evaluate in fixed-point are sampled ahead of time
+// (see: tools/reference/generate-curves.c)
+static fixed_ffxt lookup(const int16_t *table, fixed_ffxt t) {
+    if (t <= 0) { return table[0] * 4; }
+    if (t >= FM_1) { return table[CURVE_SEGMENTS] * 4; }
+
+    // The top 8 bits of the fraction select the segment and the
+    // bottom 8 bits are the position within it
+    int32_t index = t >> 8;
+    int32_t v0 = table[index];
+    int32_t v1 = table[index + 1];
+
+    // Samples may be negative (e.g. Elastic), so scale by multiplying
+    return v0 * 4 + (((v1 - v0) * (t & 0xff)) >> 6);
+}
 
 
 fixed_ffxt FfxCurveLinear(fixed_ffxt t) { return t; }
@@ -16,17 +39,17 @@ fixed_ffxt FfxCurveLinear(fixed_ffxt t) { return t; }
 
 fixed_ffxt FfxCurveEaseInSine(fixed_ffxt t) {
     // return 1.0f - cosf((t * M_PI) / 2.0f);
-    return FM_1 - cosfx(mulfx(t, FM_PI) >> 1);
+    return lookup(curve_easeInSine, t);
 }
 
 fixed_ffxt FfxCurveEaseOutSine(fixed_ffxt t) {
     // return sinf((t * M_PI) / 2.0f);
-    return sinfx(mulfx(t, FM_PI) >> 1);
+    return lookup(curve_easeOutSine, t);
 }
 
 fixed_ffxt FfxCurveEaseInOutSine(fixed_ffxt t) {
     // return -(cosf(M_PI * t) - 1.0f) / 2.0f;
-    return -(cosfx(mulfx(FM_PI, t) - FM_1) >> 1);
+    return lookup(curve_easeInOutSine, t);
 }
 
 
@@ -108,14 +131,12 @@ fixed_ffxt FfxCurveEaseInOutQuint(fixed_ffxt t) {
 
 fixed_ffxt FfxCurveEaseInExpo(fixed_ffxt t) {
     // return (t == 0.0f) ? 0.0f: powf(2.0f, 10.0f * t - 10.0f);
-    if (t == 0) { return 0; }
-    return powfx(FM_2, mulfx(FM_10, t - FM_10));
+    return lookup(curve_easeInExpo, t);
 }
 
 fixed_ffxt FfxCurveEaseOutExpo(fixed_ffxt t) {
     // return (t == 1.0f) ? 1.0f: 1.0f - powf(2.0f, -10.0f * t);
-    if (t == FM_1) { return FM_1; }
-    return FM_1 - powfx(FM_2, mulfx(-FM_10, t));
+    return lookup(curve_easeOutExpo, t);
 }
 
 fixed_ffxt FfxCurveEaseInOutExpo(fixed_ffxt t) {
@@ -123,10 +144,7 @@ fixed_ffxt FfxCurveEaseInOutExpo(fixed_ffxt t) {
     //     (t == 1.0f) ? 1.0f:
     //     (t < 0.5f) ? powf(2.0f, 20.0f * t - 10.0f) / 2.0f:
     //     (2.0f - powf(2.0f, -20.0f * t + 10.0f)) / 2.0f;
-    if (t == 0) { return 0; }
-    if (t == FM_1) { return FM_1; }
-    if (t < FM_1_2) { return powfx(FM_2, mulfx(-FM_20, t) + FM_10) >> 1; }
-    return (FM_2 - powfx(FM_2, mulfx(-FM_20, t) + FM_10)) >> 1;
+    return lookup(curve_easeInOutExpo, t);
 }
 
 // float FfxCurveEaseInCirc(float t) { return 1.0f - sqrtf(1.0f - powf(t, 2.0f)); }
@@ -160,7 +178,7 @@ fixed_ffxt FfxCurveEaseOutBack(fixed_ffxt t) {
     const fixed_ffxt t_1 = t - FM_1;
     const fixed_ffxt t2 = mulfx(t_1, t_1);
 
-    return FM_1 + mulfx(c3, mulfx(t_1, t2)) - mulfx(c1, t2);
+    return FM_1 + mulfx(c3, mulfx(t_1, t2)) + mulfx(c1, t2);
 }
 
 // fixed_ffxt FfxCurveEaseInOutBack(fixed_ffxt t) {
@@ -180,11 +198,7 @@ fixed_ffxt FfxCurveEaseInElastic(fixed_ffxt t) {
     // return (t == 0.0f) ? 0.0f:
     //     (t == 1.0f) ? 1.0f:
     //     -powf(2.0f, 10.0f * t - 10.0f) * sinf((t * 10.0f - 10.75f) * c4);
-
-    const fixed_ffxt c4 = 0x2182a;
-    if (t == 0) { return 0; }
-    if (t == 1) { return 1; }
-    return -mulfx(powfx(FM_2, mulfx(FM_10, t) - FM_10), sinfx(mulfx(mulfx(FM_10, t) - 0xac000, c4)));
+    return lookup(curve_easeInElastic, t);
 }
 
 fixed_ffxt FfxCurveEaseOutElastic(fixed_ffxt t) {
@@ -192,20 +206,17 @@ fixed_ffxt FfxCurveEaseOutElastic(fixed_ffxt t) {
     // return (t == 0) ? 0.0f:
     //     (t == 1) ? 1.0f:
     //     powf(2.0f, -10.0f * t) * sinf((t * 10.0f - 0.75f) * c4) + 1.0f;
-
-    const fixed_ffxt c4 = 0x2182a;
-    if (t == 0) { return 0; }
-    if (t == 1) { return 1; }
-    return mulfx(powfx(FM_2, mulfx(-FM_10, t)), sinfx(mulfx(mulfx(FM_10, t) - 0xc000, c4))) + FM_1;
+    return lookup(curve_easeOutElastic, t);
 }
 
-// float FfxCurveEaseInOutElastic(float t) {
-//     const float c5 = (2.0f * M_PI) / 4.5f;
-//     return (t == 0.0f) ? 0.0f:
-//         (t == 1.0f) ? 1.0f:
-//         (t < 0.5f) ? -(powf(2.0f, 20.0f * t - 10.0f) * sinf((20.0f * t - 11.125f) * c5)) / 2.0f:
-//         (pow(2.0f, -20.0f * t + 10.0f) * sinf((20.0f * t - 11.125f) * c5)) / 2.0f + 1.0f;
-// }
+fixed_ffxt FfxCurveEaseInOutElastic(fixed_ffxt t) {
+    // const float c5 = (2.0f * M_PI) / 4.5f;
+    // return (t == 0.0f) ? 0.0f:
+    //     (t == 1.0f) ? 1.0f:
+    //     (t < 0.5f) ? -(powf(2.0f, 20.0f * t - 10.0f) * sinf((20.0f * t - 11.125f) * c5)) / 2.0f:
+    //         (pow(2.0f, -20.0f * t + 10.0f) * sinf((20.0f * t - 11.125f) * c5)) / 2.0f + 1.0f;
+    return lookup(curve_easeInOutElastic, t);
+}
 
 fixed_ffxt FfxCurveEaseInBounce(fixed_ffxt t) {
     // return 1.0f - FfxCurveEaseOutBounce(1.0f - t);
@@ -225,25 +236,29 @@ fixed_ffxt FfxCurveEaseOutBounce(fixed_ffxt t) {
     //     return n1 * (t -= 2.625f / d1) * t + 0.984375f;
     // }
 
-    const fixed_ffxt n1 = 0x78ff8;
-    const fixed_ffxt d1 = 0x2bffd;
+    // The bounces have kinks that a lookup table would round off
+
+    // The rounded constants land the last bounce just short of 1
+    if (t >= FM_1) { return FM_1; }
+
+    const fixed_ffxt n1 = 0x79000;
+    const fixed_ffxt d1 = 0x2c000;
     const fixed_ffxt d1t = mulfx(d1, t);
 
     if (d1t < FM_1) { return mulfx(n1, mulfx(t, t)); }
 
     if (d1t < FM_2) {
-        t -= (FM_1 + FM_1_2);
-        return mulfx(n1 * t / d1, t) + 0xc000;
+        t -= 0x8ba3;
+        return mulfx(n1, mulfx(t, t)) + 0xc000;
     }
 
     if (d1t < (FM_2 + FM_1_2)) {
-        t -= (FM_2 + FM_1_4);
-        return mulfx(n1 * t / d1, t) + 0xf000;
+        t -= 0xd174;
+        return mulfx(n1, mulfx(t, t)) + 0xf000;
     }
 
-    t -= 0x2a000;
-    return mulfx(n1 * t / d1, t) + 0xfc00;
-
+    t -= 0xf45d;
+    return mulfx(n1, mulfx(t, t)) + 0xfc00;
 }
 
 fixed_ffxt FfxCurveEaseInOutBounce(fixed_ffxt t) {
@@ -252,3 +267,150 @@ fixed_ffxt FfxCurveEaseInOutBounce(fixed_ffxt t) {
     if (t < FM_1_2) { return (FM_1 - FfxCurveEaseOutBounce(FM_1 - (t << 1))) >> 1; }
     return (FM_1 + FfxCurveEaseOutBounce((t << 1) - FM_1)) >> 1;
 }
+
+
+//////////////////////////
+// Cubic-Bezier
+
+#define MAX_BEZIER_CURVES     (8)
+
+// Curves may be created from any task; a slot is claimed by bumping
+// bezierCount, then filled and published by setting ready, so a lookup
+// only compares slots that are ready
+typedef struct Bezier {
+    fixed_ffxt x1, y1, x2, y2;
+    int16_t *table;
+    atomic_bool ready;
+} Bezier;
+
+static Bezier beziers[MAX_BEZIER_CURVES];
+static atomic_int bezierCount = 0;
+
+// Each curve needs its own function, since a curve has no state
+static fixed_ffxt bezier0(fixed_ffxt t) { return lookup(beziers[0].table, t); }
+static fixed_ffxt bezier1(fixed_ffxt t) { return lookup(beziers[1].table, t); }
+static fixed_ffxt bezier2(fixed_ffxt t) { return lookup(beziers[2].table, t); }
+static fixed_ffxt bezier3(fixed_ffxt t) { return lookup(beziers[3].table, t); }
+static fixed_ffxt bezier4(fixed_ffxt t) { return lookup(beziers[4].table, t); }
+static fixed_ffxt bezier5(fixed_ffxt t) { return lookup(beziers[5].table, t); }
+static fixed_ffxt bezier6(fixed_ffxt t) { return lookup(beziers[6].table, t); }
+static fixed_ffxt bezier7(fixed_ffxt t) { return lookup(beziers[7].table, t); }
+
+static const FfxCurveFunc bezierFuncs[MAX_BEZIER_CURVES] = {
+    bezier0, bezier1, bezier2, bezier3, bezier4, bezier5, bezier6, bezier7
+};
+
+// The polynomial coefficients of one axis of the curve, which has its
+// end points at 0 and 1
+typedef struct Cubic {
+    fixed_ffxt a, b, c;
+} Cubic;
+
+static Cubic getCubic(fixed_ffxt p1, fixed_ffxt p2) {
+    Cubic cubic;
+    cubic.c = 3 * p1;
+    cubic.b = 3 * (p2 - p1) - cubic.c;
+    cubic.a = FM_1 - cubic.c - cubic.b;
+    return cubic;
+}
+
+static fixed_ffxt evalCubic(const Cubic *cubic, fixed_ffxt s) {
+    return mulfx(mulfx(mulfx(cubic->a, s) + cubic->b, s) + cubic->c, s);
+}
+
+static fixed_ffxt evalSlope(const Cubic *cubic, fixed_ffxt s) {
+    return mulfx(mulfx(3 * cubic->a, s) + 2 * cubic->b, s) + cubic->c;
+}
+
+// Returns the curve parameter s where the x-axis reaches %%x%%, starting
+// from the %%guess%% (usually the previous sample's s)
+static fixed_ffxt solveCubic(const Cubic *cubic, fixed_ffxt x,
+  fixed_ffxt guess) {
+
+    // Newton's method converges in a few steps for most curves...
+    fixed_ffxt s = guess;
+    for (int i = 0; i < 8; i++) {
+        fixed_ffxt error = evalCubic(cubic, s) - x;
+        if (error >= -1 && error <= 1) { return s; }
+
+        fixed_ffxt slope = evalSlope(cubic, s);
+        if (slope > -0x100 && slope < 0x100) { break; }
+
+        s -= divfx(error, slope);
+        if (s < 0 || s > FM_1) { break; }
+    }
+
+    // ...but a flat slope needs bisection; x is monotonic in s
+    fixed_ffxt lo = 0, hi = FM_1;
+    while (lo < hi) {
+        s = (lo + hi) >> 1;
+        if (evalCubic(cubic, s) < x) {
+            lo = s + 1;
+        } else {
+            hi = s;
+        }
+    }
+
+    return lo;
+}
+
+FfxCurveFunc ffx_curve_createCubicBezier(fixed_ffxt x1, fixed_ffxt y1,
+  fixed_ffxt x2, fixed_ffxt y2) {
+
+    if (x1 < 0 || x1 > FM_1 || x2 < 0 || x2 > FM_1) {
+        printf("cubic-bezier x must be within [0, 1]\n");
+        return NULL;
+    }
+
+    int count = atomic_load(&bezierCount);
+    for (int i = 0; i < count; i++) {
+        Bezier *bezier = &beziers[i];
+        if (!atomic_load_explicit(&bezier->ready, memory_order_acquire)) {
+            continue;
+        }
+        if (bezier->x1 == x1 && bezier->y1 == y1 && bezier->x2 == x2 &&
+          bezier->y2 == y2) {
+            return bezierFuncs[i];
+        }
+    }
+
+    // Two tasks racing on the same new curve may each claim a slot,
+    // which only costs a slot
+    int index = count;
+    do {
+        if (index == MAX_BEZIER_CURVES) {
+            printf("too many cubic-bezier curves\n");
+            return NULL;
+        }
+    } while (!atomic_compare_exchange_weak(&bezierCount, &index, index + 1));
+
+    // The claimed slot is never published if this fails
+    int16_t *table = malloc((CURVE_SEGMENTS + 1) * sizeof(int16_t));
+    if (table == NULL) { return NULL; }
+
+    // Sample the curve at evenly spaced x, solving for the curve
+    // parameter once here, so each evaluation is only a lookup
+    Cubic cx = getCubic(x1, x2);
+    Cubic cy = getCubic(y1, y2);
+
+    fixed_ffxt s = 0;
+    for (int i = 0; i <= CURVE_SEGMENTS; i++) {
+        fixed_ffxt x = (i * FM_1) / CURVE_SEGMENTS;
+        s = solveCubic(&cx, x, s);
+
+        int32_t y = (evalCubic(&cy, s) + 2) >> 2;
+        if (y < -32768) { y = -32768; }
+        if (y > 32767) { y = 32767; }
+        table[i] = y;
+    }
+
+    Bezier *bezier = &beziers[index];
+    bezier->x1 = x1;
+    bezier->y1 = y1;
+    bezier->x2 = x2;
+    bezier->y2 = y2;
+    bezier->table = table;
+    atomic_store_explicit(&bezier->ready, true, memory_order_release);
+
+    return bezierFuncs[index];
+}
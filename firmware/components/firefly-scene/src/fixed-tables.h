@@ -0,0 +1,145 @@
+#ifndef __FIXED_TABLES_H__
+#define __FIXED_TABLES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+#include <stdint.h>
+
+// Generated by: tools/reference/generate-fixed.c
+
+static const uint32_t sineTable[] = {
+  0x00000000, 0x00000192, 0x00000324, 0x000004b6, 0x00000648, 0x000007da,
+  0x0000096c, 0x00000afe, 0x00000c90, 0x00000e21, 0x00000fb3, 0x00001144,
+  0x000012d5, 0x00001466, 0x000015f7, 0x00001787, 0x00001918, 0x00001aa8,
+  0x00001c38, 0x00001dc7, 0x00001f56, 0x000020e5, 0x00002274, 0x00002402,
+  0x00002590, 0x0000271e, 0x000028ab, 0x00002a38, 0x00002bc4, 0x00002d50,
+  0x00002edc, 0x00003067, 0x000031f1, 0x0000337c, 0x00003505, 0x0000368e,
+  0x00003817, 0x0000399f, 0x00003b27, 0x00003cae, 0x00003e34, 0x00003fba,
+  0x0000413f, 0x000042c3, 0x00004447, 0x000045cb, 0x0000474d, 0x000048cf,
+  0x00004a50, 0x00004bd1, 0x00004d50, 0x00004ecf, 0x0000504d, 0x000051cb,
+  0x00005348, 0x000054c3, 0x0000563e, 0x000057b9, 0x00005932, 0x00005aaa,
+  0x00005c22, 0x00005d99, 0x00005f0f, 0x00006084, 0x000061f8, 0x0000636b,
+  0x000064dd, 0x0000664e, 0x000067be, 0x0000692d, 0x00006a9b, 0x00006c08,
+  0x00006d74, 0x00006edf, 0x00007049, 0x000071b2, 0x0000731a, 0x00007480,
+  0x000075e6, 0x0000774a, 0x000078ad, 0x00007a10, 0x00007b70, 0x00007cd0,
+  0x00007e2f, 0x00007f8c, 0x000080e8, 0x00008243, 0x0000839c, 0x000084f5,
+  0x0000864c, 0x000087a1, 0x000088f6, 0x00008a49, 0x00008b9a, 0x00008ceb,
+  0x00008e3a, 0x00008f88, 0x000090d4, 0x0000921f, 0x00009368, 0x000094b0,
+  0x000095f7, 0x0000973c, 0x00009880, 0x000099c2, 0x00009b03, 0x00009c42,
+  0x00009d80, 0x00009ebc, 0x00009ff7, 0x0000a130, 0x0000a268, 0x0000a39e,
+  0x0000a4d2, 0x0000a605, 0x0000a736, 0x0000a866, 0x0000a994, 0x0000aac1,
+  0x0000abeb, 0x0000ad14, 0x0000ae3c, 0x0000af62, 0x0000b086, 0x0000b1a8,
+  0x0000b2c9, 0x0000b3e8, 0x0000b505, 0x0000b620, 0x0000b73a, 0x0000b852,
+  0x0000b968, 0x0000ba7d, 0x0000bb8f, 0x0000bca0, 0x0000bdaf, 0x0000bebc,
+  0x0000bfc7, 0x0000c0d1, 0x0000c1d8, 0x0000c2de, 0x0000c3e2, 0x0000c4e4,
+  0x0000c5e4, 0x0000c6e2, 0x0000c7de, 0x0000c8d9, 0x0000c9d1, 0x0000cac7,
+  0x0000cbbc, 0x0000ccae, 0x0000cd9f, 0x0000ce8e, 0x0000cf7a, 0x0000d065,
+  0x0000d14d, 0x0000d234, 0x0000d318, 0x0000d3fb, 0x0000d4db, 0x0000d5ba,
+  0x0000d696, 0x0000d770, 0x0000d848, 0x0000d91e, 0x0000d9f2, 0x0000dac4,
+  0x0000db94, 0x0000dc62, 0x0000dd2d, 0x0000ddf7, 0x0000debe, 0x0000df83,
+  0x0000e046, 0x0000e107, 0x0000e1c6, 0x0000e282, 0x0000e33c, 0x0000e3f4,
+  0x0000e4aa, 0x0000e55e, 0x0000e610, 0x0000e6bf, 0x0000e76c, 0x0000e817,
+  0x0000e8bf, 0x0000e966, 0x0000ea0a, 0x0000eaab, 0x0000eb4b, 0x0000ebe8,
+  0x0000ec83, 0x0000ed1c, 0x0000edb3, 0x0000ee47, 0x0000eed9, 0x0000ef68,
+  0x0000eff5, 0x0000f080, 0x0000f109, 0x0000f18f, 0x0000f213, 0x0000f295,
+  0x0000f314, 0x0000f391, 0x0000f40c, 0x0000f484, 0x0000f4fa, 0x0000f56e,
+  0x0000f5df, 0x0000f64e, 0x0000f6ba, 0x0000f724, 0x0000f78c, 0x0000f7f1,
+  0x0000f854, 0x0000f8b4, 0x0000f913, 0x0000f96e, 0x0000f9c8, 0x0000fa1f,
+  0x0000fa73, 0x0000fac5, 0x0000fb15, 0x0000fb62, 0x0000fbad, 0x0000fbf5,
+  0x0000fc3b, 0x0000fc7f, 0x0000fcc0, 0x0000fcfe, 0x0000fd3b, 0x0000fd74,
+  0x0000fdac, 0x0000fde1, 0x0000fe13, 0x0000fe43, 0x0000fe71, 0x0000fe9c,
+  0x0000fec4, 0x0000feeb, 0x0000ff0e, 0x0000ff30, 0x0000ff4e, 0x0000ff6b,
+  0x0000ff85, 0x0000ff9c, 0x0000ffb1, 0x0000ffc4, 0x0000ffd4, 0x0000ffe1,
+  0x0000ffec, 0x0000fff5, 0x0000fffb, 0x0000ffff, 0x00010000,
+};
+
+static const uint32_t atanTable[] = {
+  0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500,
+  0x00000600, 0x00000700, 0x000007ff, 0x000008ff, 0x000009ff, 0x00000afe,
+  0x00000bfe, 0x00000cfd, 0x00000dfc, 0x00000efc, 0x00000ffb, 0x000010fa,
+  0x000011f8, 0x000012f7, 0x000013f6, 0x000014f4, 0x000015f2, 0x000016f0,
+  0x000017ee, 0x000018ec, 0x000019e9, 0x00001ae7, 0x00001be4, 0x00001ce0,
+  0x00001ddd, 0x00001eda, 0x00001fd6, 0x000020d2, 0x000021cd, 0x000022c9,
+  0x000023c4, 0x000024bf, 0x000025b9, 0x000026b4, 0x000027ae, 0x000028a8,
+  0x000029a1, 0x00002a9a, 0x00002b93, 0x00002c8b, 0x00002d84, 0x00002e7b,
+  0x00002f73, 0x0000306a, 0x00003161, 0x00003257, 0x0000334d, 0x00003443,
+  0x00003538, 0x0000362d, 0x00003722, 0x00003816, 0x00003909, 0x000039fd,
+  0x00003af0, 0x00003be2, 0x00003cd4, 0x00003dc6, 0x00003eb7, 0x00003fa8,
+  0x00004098, 0x00004188, 0x00004277, 0x00004366, 0x00004454, 0x00004542,
+  0x00004630, 0x0000471d, 0x00004809, 0x000048f5, 0x000049e1, 0x00004acc,
+  0x00004bb6, 0x00004ca0, 0x00004d8a, 0x00004e73, 0x00004f5b, 0x00005043,
+  0x0000512b, 0x00005211, 0x000052f8, 0x000053dd, 0x000054c3, 0x000055a7,
+  0x0000568c, 0x0000576f, 0x00005852, 0x00005934, 0x00005a16, 0x00005af8,
+  0x00005bd8, 0x00005cb9, 0x00005d98, 0x00005e77, 0x00005f56, 0x00006033,
+  0x00006111, 0x000061ed, 0x000062c9, 0x000063a5, 0x0000647f, 0x0000655a,
+  0x00006633, 0x0000670c, 0x000067e5, 0x000068bd, 0x00006994, 0x00006a6a,
+  0x00006b40, 0x00006c16, 0x00006cea, 0x00006dbe, 0x00006e92, 0x00006f65,
+  0x00007037, 0x00007108, 0x000071d9, 0x000072aa, 0x00007379, 0x00007448,
+  0x00007517, 0x000075e4, 0x000076b2, 0x0000777e, 0x0000784a, 0x00007915,
+  0x000079e0, 0x00007aaa, 0x00007b73, 0x00007c3b, 0x00007d03, 0x00007dcb,
+  0x00007e91, 0x00007f58, 0x0000801d, 0x000080e2, 0x000081a6, 0x00008269,
+  0x0000832c, 0x000083ee, 0x000084b0, 0x00008570, 0x00008631, 0x000086f0,
+  0x000087af, 0x0000886d, 0x0000892b, 0x000089e8, 0x00008aa4, 0x00008b60,
+  0x00008c1b, 0x00008cd5, 0x00008d8f, 0x00008e48, 0x00008f00, 0x00008fb8,
+  0x0000906f, 0x00009126, 0x000091dc, 0x00009291, 0x00009345, 0x000093f9,
+  0x000094ac, 0x0000955f, 0x00009611, 0x000096c2, 0x00009773, 0x00009823,
+  0x000098d3, 0x00009981, 0x00009a30, 0x00009add, 0x00009b8a, 0x00009c36,
+  0x00009ce2, 0x00009d8d, 0x00009e37, 0x00009ee1, 0x00009f8a, 0x0000a032,
+  0x0000a0da, 0x0000a182, 0x0000a228, 0x0000a2ce, 0x0000a374, 0x0000a418,
+  0x0000a4bc, 0x0000a560, 0x0000a603, 0x0000a6a5, 0x0000a747, 0x0000a7e8,
+  0x0000a889, 0x0000a928, 0x0000a9c8, 0x0000aa66, 0x0000ab04, 0x0000aba2,
+  0x0000ac3f, 0x0000acdb, 0x0000ad77, 0x0000ae12, 0x0000aeac, 0x0000af46,
+  0x0000afe0, 0x0000b078, 0x0000b110, 0x0000b1a8, 0x0000b23f, 0x0000b2d5,
+  0x0000b36b, 0x0000b400, 0x0000b495, 0x0000b529, 0x0000b5bd, 0x0000b650,
+  0x0000b6e2, 0x0000b774, 0x0000b805, 0x0000b896, 0x0000b926, 0x0000b9b6,
+  0x0000ba45, 0x0000bad3, 0x0000bb61, 0x0000bbef, 0x0000bc7b, 0x0000bd08,
+  0x0000bd93, 0x0000be1f, 0x0000bea9, 0x0000bf33, 0x0000bfbd, 0x0000c046,
+  0x0000c0cf, 0x0000c157, 0x0000c1de, 0x0000c265, 0x0000c2eb, 0x0000c371,
+  0x0000c3f7, 0x0000c47b, 0x0000c500, 0x0000c583, 0x0000c607, 0x0000c68a,
+  0x0000c70c, 0x0000c78e, 0x0000c80f, 0x0000c890, 0x0000c910,
+};
+
+static const uint32_t exp2Table[] = {
+  0x80000000, 0x82cd8699, 0x85aac368, 0x88980e81, 0x8b95c1e4, 0x8ea4398b,
+  0x91c3d374, 0x94f4efa9, 0x9837f052, 0x9b8d39ba, 0x9ef53261, 0xa2704303,
+  0xa5fed6aa, 0xa9a15ab5, 0xad583eea, 0xb123f582, 0xb504f334, 0xb8fbaf47,
+  0xbd08a39f, 0xc12c4cca, 0xc5672a11, 0xc9b9bd86, 0xce248c15, 0xd2a81d92,
+  0xd744fccb, 0xdbfbb798, 0xe0ccdeec, 0xe5b906e7, 0xeac0c6e8, 0xefe4b99c,
+  0xf5257d15, 0xfa83b2db,
+};
+
+static const uint32_t log2Table[] = {
+  0x00000000, 0x0b5d69bb, 0x1663f6fb, 0x2118b11a, 0x2b803474, 0x359ebc5b,
+  0x3f782d72, 0x49101eac, 0x5269e12f, 0x5b888736, 0x646eea24, 0x6d1fafdd,
+  0x759d4f81, 0x7dea15a3, 0x86082807, 0x8df988f5, 0x95c01a3a, 0x9d5d9fd5,
+  0xa4d3c25e, 0xac241135, 0xb3500472, 0xba58feb2, 0xc1404eae, 0xc80730b0,
+  0xceaecfeb, 0xd53847ac, 0xdba4a47b, 0xe1f4e517, 0xe829fb69, 0xee44cd5a,
+  0xf446359b, 0xfa2f045e,
+};
+
+static const uint32_t recipTable[] = {
+  0xffffffff, 0xf83e0f84, 0xf0f0f0f1, 0xea0ea0ea, 0xe38e38e4, 0xdd67c8a6,
+  0xd79435e5, 0xd20d20d2, 0xcccccccd, 0xc7ce0c7d, 0xc30c30c3, 0xbe82fa0c,
+  0xba2e8ba3, 0xb60b60b6, 0xb21642c8, 0xae4c415d, 0xaaaaaaab, 0xa72f0539,
+  0xa3d70a3d, 0xa0a0a0a1, 0x9d89d89e, 0x9a90e7d9, 0x97b425ed, 0x94f2094f,
+  0x92492492, 0x8fb823ee, 0x8d3dcb09, 0x8ad8f2fc, 0x88888889, 0x864b8a7e,
+  0x84210842, 0x82082082,
+};
+
+static const uint32_t rsqrtTable[] = {
+  0x7e0bb221, 0x7a64336b, 0x77099efb, 0x73f1f68d, 0x7114f644, 0x6e6bb6e9,
+  0x6bf06762, 0x699e16d0, 0x67708af9, 0x65641fae, 0x6375ad16, 0x61a27320,
+  0x5fe808fc, 0x5e444faf, 0x5cb56711, 0x5b39a4c7, 0x59cf8cbc, 0x5875cade,
+  0x572b2de0, 0x55eea2c4, 0x54bf311a, 0x539bf7cd, 0x52842a5f, 0x51770e8f,
+  0x5073fa50, 0x4f7a5202, 0x4e8986ea, 0x4da115da, 0x4cc08605, 0x4be767f5,
+  0x4b1554a6, 0x4a49ecb3, 0x4984d7a4, 0x48c5c34b, 0x480c6332, 0x4758701c,
+  0x46a9a794, 0x45ffcb80, 0x455aa1cb, 0x44b9f40b, 0x441d8f3b, 0x43854374,
+  0x42f0e3ae, 0x4260458e, 0x41d3412a, 0x4149b0e5, 0x40c3713b, 0x404060a1,
+};
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* __FIXED_TABLES_H__ */
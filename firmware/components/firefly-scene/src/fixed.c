@@ -1,6 +1,10 @@
 
+#include <stdbool.h>
+
 #include "firefly-fixed.h"
 
+#include "fixed-tables.h"
+
 
 const fixed_ffxt FM_PI_2   = 0x19220;
 const fixed_ffxt FM_PI     = 2 * FM_PI_2;
@@ -19,7 +23,7 @@ const fixed_ffxt FM_1_8    =     0x2000;
 const fixed_ffxt FM_1_16   =     0x1000;
 
 fixed_ffxt tofx(int32_t value) {
-    return value << 16;
+    return value * 65536;
 }
 
 static void reverseBytes(char *output, size_t length) {
@@ -82,75 +86,69 @@ char* ffx_sprintfx(fixed_ffxt _value, char *output) {
 }
 
 fixed_ffxt ratiofx(int32_t top, int32_t bottom) {
-    return (top << 16) / bottom;
+    return (top * 65536) / bottom;
 }
 
 static uint32_t umul32hi(uint32_t a, uint32_t b) {
     return (uint32_t)(((uint64_t)a * b) >> 32);
 }
 
+// The tables and polynomials below need only 32-bit multiplies (the
+// high word of which is a single mulhu on RV32IM) and no division.
+
 /* compute log2() with s15.16 fixed-point argument and result */
 fixed_ffxt log2fx(fixed_ffxt arg) {
-    const uint32_t a0 = (uint32_t)((1.44269476063 - 1)* (1LL << 32) + 0.5);
-    const uint32_t a1 = (uint32_t)(7.2131008654833e-1 * (1LL << 32) + 0.5);
-    const uint32_t a2 = (uint32_t)(4.8006370104849e-1 * (1LL << 32) + 0.5);
-    const uint32_t a3 = (uint32_t)(3.5339481476694e-1 * (1LL << 32) + 0.5);
-    const uint32_t a4 = (uint32_t)(2.5600972794928e-1 * (1LL << 32) + 0.5);
-    const uint32_t a5 = (uint32_t)(1.5535182948224e-1 * (1LL << 32) + 0.5);
-    const uint32_t a6 = (uint32_t)(6.3607925549150e-2 * (1LL << 32) + 0.5);
-    const uint32_t a7 = (uint32_t)(1.2319647939876e-2 * (1LL << 32) + 0.5);
-    int32_t lz;
-    uint32_t approx, h, m, l, z, y, x = arg;
-    lz = __builtin_clz(x);
-
-    // Shift off integer bits and normalize fraction 0 <= f <= 1
-    x = x << (lz + 1);
-    y = umul32hi(x, x); // f**2
-    z = umul32hi(y, y); // f**4
-
-    // Evaluate minimax polynomial to compute log2(1+f)
-    h = a0 - umul32hi(a1, x);
-    m = umul32hi(a2 - umul32hi(a3, x), y);
-    l = umul32hi(a4 - umul32hi(a5, x) + umul32hi(a6 - umul32hi(a7, x), y), z);
-    approx = x + umul32hi (x, h + m + l);
+    if (arg <= 0) { return FM_MIN; }
+
+    uint32_t x = arg;
+    int32_t lz = __builtin_clz(x);
+
+    // Normalize to 1 + f, with 0 <= f < 1 (Q32); in two steps, as lz
+    // may be 31 and a 32-bit shift is undefined
+    uint32_t f = (x << lz) << 1;
+
+    // Split 1 + f = (1 + k / 32) * (1 + r), with 0 <= r < 1/32
+    int32_t k = f >> 27;
+    uint32_t r = umul32hi(f & 0x07ffffff, recipTable[k]);
+
+    // ln(1 + r) = r - r**2 / 2 + r**3 / 3; the next term is < 2**-22
+    uint32_t r2 = umul32hi(r, r);
+    uint32_t ln = r - (r2 >> 1) + umul32hi(r2, r) / 3;
+
+    // Scale by 1 / ln(2) (which is 1 + 0x71547653 / 2**32)
+    uint32_t frac = log2Table[k] + ln + umul32hi(ln, 0x71547653);
+
+    // The fraction is below 1, but rounding may carry into it
+    if (frac < log2Table[k]) { frac = 0xffffffff; }
 
     // Combine integer and fractional parts of result; round result
-    approx = ((15 - lz) << 16) + ((((approx) >> 15) + 1) >> 1);
-    return approx;
+    return (15 - lz) * 65536 + (((frac >> 15) + 1) >> 1);
 }
 
 /* compute exp2() with s15.16 fixed-point argument and result */
 fixed_ffxt exp2fx(fixed_ffxt arg) {
-    const uint32_t a0 = (uint32_t)(6.9314718107e-1 * (1LL << 32) + 0.5);
-    const uint32_t a1 = (uint32_t)(2.4022648809e-1 * (1LL << 32) + 0.5);
-    const uint32_t a2 = (uint32_t)(5.5504413787e-2 * (1LL << 32) + 0.5);
-    const uint32_t a3 = (uint32_t)(9.6162736882e-3 * (1LL << 32) + 0.5);
-    const uint32_t a4 = (uint32_t)(1.3386828359e-3 * (1LL << 32) + 0.5);
-    const uint32_t a5 = (uint32_t)(1.4629773796e-4 * (1LL << 32) + 0.5);
-    const uint32_t a6 = (uint32_t)(2.0663021132e-5 * (1LL << 32) + 0.5);
-    int32_t i;
-    uint32_t approx, h, m, l, s, q, f, x = arg;
+    uint32_t x = arg;
 
     // Extract integer portion; 2**i is realized as a shift at the end
-    i = ((x >> 16) ^ 0x8000) - 0x8000;
+    int32_t i = ((x >> 16) ^ 0x8000) - 0x8000;
+    if (i < -16) { return 0; }
+    if (i > 14) { return FM_MAX; }
 
-    // Extract and normalize fraction f to compute 2**(f)-1, 0 <= f < 1
-    f = x << 16;
+    // Split the fraction into k / 32 + r, with 0 <= r < 1/32 (Q32)
+    uint32_t f = x << 16;
+    int32_t k = f >> 27;
 
-    // Evaluate minimax polynomial to compute exp2(f)-1
-    s = umul32hi(f, f); // f**2
-    q = umul32hi(s, s); // f**4
-    h = a0 + umul32hi(a1, f);
-    m = umul32hi(a2 + umul32hi(a3, f), s);
-    l = umul32hi(a4 + umul32hi(a5, f) + umul32hi(a6, s), q);
-    approx = umul32hi(f, h + m + l);
+    // 2**r - 1 = s + s**2 / 2 + s**3 / 6 + s**4 / 24, with s = r * ln(2)
+    uint32_t s = umul32hi(f & 0x07ffffff, 0xb17217f8);
+    uint32_t s2 = umul32hi(s, s);
+    uint32_t e = s + (s2 >> 1) + umul32hi(s2, s) / 6 + umul32hi(s2, s2) / 24;
 
-    // combine integer and fractional parts of result; round result
-    approx = ((approx >> (15 - i)) + (0x80000000 >> (14 - i)) + 1) >> 1;
+    // 2**(k / 32) * 2**r (Q31)
+    uint32_t approx = exp2Table[k] + umul32hi(exp2Table[k], e);
 
-    // handle underflow to 0
-    approx = ((i < -16) ? 0: approx);
-    return approx;
+    // Scale by 2**i and round
+    approx >>= (14 - i);
+    return (approx >> 1) + (approx & 1);
 }
 
 /* s15.16 division without rounding */
@@ -177,37 +175,172 @@ fixed_ffxt powfx(fixed_ffxt a, fixed_ffxt b) {
     return exp2fx(mulfx(b, log2fx(a)));
 }
 
-// See: http://www.coranac.com/2009/07/sines/
-fixed_ffxt sinfx(fixed_ffxt x) {
+// Returns sin(2 * pi * turn / 2**32)
+static fixed_ffxt sinTurn(uint32_t turn) {
+
+    // Position within the quadrant, reflected for the falling quadrants
+    uint32_t pos = turn & 0x3fffffff;
+    if (turn & 0x40000000) { pos = 0x40000000 - pos; }
 
-    // Normalize i to [0, 2pi)
-    x = (((x % FM_2PI) + FM_2PI) % FM_2PI);
-
-    // Account for the quadrant reflecting in the x or y axis
-    int32_t ymul = 1;
-    if (x >= FM_3PI_2) {
-        x -= FM_3PI_2;
-        x = FM_PI_2 - x;
-        ymul = -1;
-    } else if (x >= FM_PI) {
-        x -= FM_PI;
-        ymul = -1;
-    } else if (x >= FM_PI_2) {
-        x -= FM_PI_2;
-        x = FM_PI_2 - x;
+    fixed_ffxt result = FM_1;
+    if (pos < 0x40000000) {
+        // The top 8 bits select the step and the next 16 interpolate it
+        int32_t index = pos >> 22;
+        uint32_t frac = (pos >> 6) & 0xffff;
+        uint32_t v0 = sineTable[index];
+        result = v0 + (((sineTable[index + 1] - v0) * frac + 0x8000) >> 16);
     }
 
-    // 3rd order approximation;
-    // Note: tweaked 0xf476 to 0xf475 so that FM_PI and FM_3PI_2
-    // line up perfectly with 1 and -1 respectively.
-    fixed_ffxt result = mulfx(0xf475, x) - mulfx(0x2106, mulfx(mulfx(x, x), x));
+    return (turn & 0x80000000) ? -result: result;
+}
 
-    return ymul * result;
+// Returns %%x%% radians as a fraction of a turn; the product wrapping
+// to 32 bits reduces the angle into [0, 2pi) for free
+static uint32_t toTurn(fixed_ffxt x) {
+    // 2**32 / (2 * pi)
+    return (uint32_t)(((int64_t)x * 0x28be60dc) >> 16);
+}
+
+fixed_ffxt sinfx(fixed_ffxt x) {
+    return sinTurn(toTurn(x));
 }
 
 fixed_ffxt cosfx(fixed_ffxt x) {
-    return sinfx(x + FM_PI_2);
+    return sinTurn(toTurn(x) + 0x40000000);
 }
+
+fixed_ffxt atan2fx(fixed_ffxt y, fixed_ffxt x) {
+    if (x == 0 && y == 0) { return 0; }
+
+    uint32_t ax = (x < 0) ? -(uint32_t)x: x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y: y;
+
+    // Reduce to the first octant, so the ratio is within [0, 1]
+    bool swap = (ay > ax);
+    uint32_t num = swap ? ax: ay;
+    uint32_t den = swap ? ay: ax;
+
+    // Bring the denominator into 23 bits, so the ratio can be divided
+    // (and rounded) in two 32-bit steps
+    int32_t shift = 9 - __builtin_clz(den);
+    if (shift > 0) {
+        num >>= shift;
+        den >>= shift;
+    } else {
+        num <<= -shift;
+        den <<= -shift;
+    }
+
+    uint32_t n = num << 9;
+    uint32_t ratio = ((n / den) << 7) + ((((n % den) << 7) + (den >> 1)) / den);
+
+    int32_t index = ratio >> 8;
+    fixed_ffxt result = atanTable[index];
+    if (index < 256) {
+        uint32_t frac = ratio & 0xff;
+        result += ((atanTable[index + 1] - result) * frac + 0x80) >> 8;
+    }
+
+    if (swap) { result = FM_PI_2 - result; }
+    if (x < 0) { result = FM_PI - result; }
+    return (y < 0) ? -result: result;
+}
+
+fixed_ffxt sqrtfx(fixed_ffxt x) {
+    if (x <= 0) { return 0; }
+
+    // Normalize by an even shift, to m within [1/4, 1) (Q32)
+    int32_t lz = __builtin_clz(x) & ~1;
+    uint32_t m = (uint32_t)x << lz;
+
+    // Refine the tabled 1 / sqrt(m) with Newton's method (Q30), using
+    // y += y * (1 - m * y**2) / 2, which roughly doubles the bits each
+    // step, from about 6 bits
+    uint32_t y = rsqrtTable[(m >> 26) - 16];
+    for (int i = 0; i < 3; i++) {
+        uint32_t my2 = umul32hi(m, umul32hi(y, y));
+        int32_t error = (1 << 28) - (int32_t)my2;
+        y += (int32_t)(((int64_t)y * error) >> 29);
+    }
+
+    // sqrt(m) = m / sqrt(m) (Q30), then undo the normalization
+    uint32_t root = umul32hi(m, y);
+    uint32_t result = ((root >> (5 + lz / 2)) + 1) >> 1;
+
+    // Correct the final rounding against the exact square
+    uint64_t square = (uint64_t)x << 16;
+    uint64_t r2 = (uint64_t)result * result;
+    if (r2 + result < square) {
+        result++;
+    } else if (r2 >= square + result) {
+        result--;
+    }
+
+    return result;
+}
+
+// Digit by digit, two bits of the value per step
+uint32_t isqrt32(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = 1 << 30;
+    while (bit > value) { bit >>= 2; }
+
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+fixed_ffxt lerpfx(fixed_ffxt a, fixed_ffxt b, fixed_ffxt t) {
+    return a + mulfx(b - a, t);
+}
+
+vec2_ffxt vec2fx(fixed_ffxt x, fixed_ffxt y) {
+    return (vec2_ffxt){ .x = x, .y = y };
+}
+
+vec2_ffxt lerp2fx(vec2_ffxt a, vec2_ffxt b, fixed_ffxt t) {
+    return (vec2_ffxt){
+        .x = a.x + mulfx(b.x - a.x, t),
+        .y = a.y + mulfx(b.y - a.y, t)
+    };
+}
+
+fixed_ffxt dot2fx(vec2_ffxt a, vec2_ffxt b) {
+    return mulfx(a.x, b.x) + mulfx(a.y, b.y);
+}
+
+fixed_ffxt length2fx(vec2_ffxt v) {
+    uint32_t ax = (v.x < 0) ? -(uint32_t)v.x: v.x;
+    uint32_t ay = (v.y < 0) ? -(uint32_t)v.y: v.y;
+
+    // Scale down so the squares cannot overflow, and back up after
+    int32_t shift = 0;
+    while ((ax | ay) >= 0x400000) {
+        ax >>= 1;
+        ay >>= 1;
+        shift++;
+    }
+
+    return sqrtfx(mulfx(ax, ax) + mulfx(ay, ay)) << shift;
+}
+
+vec2_ffxt rotate2fx(vec2_ffxt v, fixed_ffxt angle) {
+    uint32_t turn = toTurn(angle);
+    fixed_ffxt s = sinTurn(turn), c = sinTurn(turn + 0x40000000);
+    return (vec2_ffxt){
+        .x = mulfx(v.x, c) - mulfx(v.y, s),
+        .y = mulfx(v.x, s) + mulfx(v.y, c)
+    };
+}
+
 /*
 #include <stdio.h>
 
@@ -67,120 +67,205 @@ const uint32_t font_small_normal[] = {
   0x00000000
 };
 
-// Font: small-normal-outline (neep-alt-iso8859-1-08x15.bdf)
-const uint32_t font_small_normal_outline[] = {
+// Font: small-normal-combined (neep-alt-iso8859-1-08x15.bdf)
+const uint32_t font_small_normal_combined[] = {
 
   // Font Info: width=8 height=15 descent=3
   0x00030f08,
 
   // Glyph Info:
-  0x3c18a000, 0x4a94a004, 0x6390c007, 0x5bd0c00d, 0x6410a013, 0x63d0c019,
-  0x5294a01f, 0x54d88023, 0x54d08029, 0x62d1002f, 0x6b50e034, 0x5291a03a,
-  0x61d1403e, 0x4a55a041, 0x64908044, 0x6410a04b, 0x5410a051, 0x6410a056,
-  0x6410a05c, 0x6410a062, 0x6410a068, 0x6410a06e, 0x6410a074, 0x6410a07a,
-  0x6410a080, 0x4bd4e086, 0x5410e08b, 0x5bd0c090, 0x62912096, 0x5bd4c09a,
-  0x5c10a0a0, 0x6410a0a6, 0x6410a0ac, 0x6410a0b2, 0x6410a0b8, 0x6410a0be,
-  0x6410a0c4, 0x6410a0ca, 0x6410a0d0, 0x6410a0d6, 0x5c10a0dc, 0x6410a0e2,
-  0x6410a0e8, 0x6410a0ee, 0x6c10a0f4, 0x6410a0fb, 0x6410a101, 0x6410a107,
-  0x6450a10d, 0x6410a114, 0x6410a11a, 0x6c10a120, 0x6410a127, 0x6410a12d,
-  0x6c10a133, 0x6410a13a, 0x6410a140, 0x6410a146, 0x54d8814c, 0x64908152,
-  0x54d08159, 0x6250a15f, 0x61d20163, 0x5294a166, 0x6351016a, 0x6410a16f,
-  0x63510175, 0x6410a17a, 0x63510180, 0x6410a185, 0x6411018b, 0x6410a191,
-  0x4c14a197, 0x5c90a19c, 0x6410a1a3, 0x5414a1a9, 0x6b5101ae, 0x635101b4,
-  0x635101b9, 0x641101be, 0x641101c4, 0x635101ca, 0x635101cf, 0x63d0c1d4,
-  0x635101da, 0x635101df, 0x6b5101e4, 0x635101ea, 0x641101ef, 0x635101f5,
-  0x5cd481fa, 0x3c988201, 0x5cd08205, 0x6a50c20c,
+  0x3c18a000, 0x4a94a007, 0x6390c00d, 0x5bd0c018, 0x6410a023, 0x63d0c02f,
+  0x5294a03b, 0x54d88042, 0x54d0804e, 0x62d1005a, 0x6b50e063, 0x5291a06e,
+  0x61d14075, 0x4a55a07b, 0x64908081, 0x6410a08f, 0x5410a09b, 0x6410a0a5,
+  0x6410a0b1, 0x6410a0bd, 0x6410a0c9, 0x6410a0d5, 0x6410a0e1, 0x6410a0ed,
+  0x6410a0f9, 0x4bd4e105, 0x5410e10e, 0x5bd0c118, 0x62912123, 0x5bd4c12b,
+  0x5c10a136, 0x6410a141, 0x6410a14d, 0x6410a159, 0x6410a165, 0x6410a171,
+  0x6410a17d, 0x6410a189, 0x6410a195, 0x6410a1a1, 0x5c10a1ad, 0x6410a1b8,
+  0x6410a1c4, 0x6410a1d0, 0x6c10a1dc, 0x6410a1e9, 0x6410a1f5, 0x6410a201,
+  0x6450a20d, 0x6410a21a, 0x6410a226, 0x6c10a232, 0x6410a23f, 0x6410a24b,
+  0x6c10a257, 0x6410a264, 0x6410a270, 0x6410a27c, 0x54d88288, 0x64908294,
+  0x54d082a2, 0x6250a2ae, 0x61d202b5, 0x5294a2bb, 0x635102c2, 0x6410a2cc,
+  0x635102d8, 0x6410a2e2, 0x635102ee, 0x6410a2f8, 0x64110304, 0x6410a310,
+  0x4c14a31c, 0x5c90a325, 0x6410a332, 0x5414a33e, 0x6b510348, 0x63510353,
+  0x6351035d, 0x64110367, 0x64110373, 0x6351037f, 0x63510389, 0x63d0c393,
+  0x6351039f, 0x635103a9, 0x6b5103b3, 0x635103be, 0x641103c8, 0x635103d4,
+  0x5cd483de, 0x3c9883ec, 0x5cd083f4, 0x6a50c402,
 
   // Bitmap Data:
-  0x38fbff7e, 0xfdfbf7ef, 0xdfff7eff, 0xdf1c0000, 0x3e3fbffd, 0x7ebf5faf,
-  0xff7f1f00, 0x1f83fc7f, 0xe76ef6fe, 0x07f6ff6f, 0xe07f6f76, 0xe7fe3fc1,
-  0xf8000000, 0x0e03f0ff, 0x3dff0fd7, 0xfaf78f7a, 0xff5f87fd, 0xe7f87e03,
-  0x80000000, 0x1dc3fe7f, 0xff77eb7e, 0xaff5e7dc, 0x3be7aff5, 0x7ed7eeff,
-  0xfe7fc3b8, 0x1e03f07f, 0x8f3cedce, 0xdcf3ef3f, 0xed7eefe6, 0xff177ff3,
-  0xfe1fc000, 0x0f07e3fd, 0xe773fdee, 0xf3f87c0e, 0x00000000, 0x0703e1fc,
-  0xf77bddef, 0x73bcee3b, 0x8ee3bcf7, 0x1de7bcf7, 0x1fc3e070, 0x381f0fe3,
-  0xbcf79ee3, 0xbcf71dc7, 0x71dcf73b, 0xdeef7bbc, 0xfe1f0380, 0x1f83fc7f,
-  0xe76ef9fe, 0x07f9f76e, 0x7fe3fc1f, 0x80000000, 0x07007c07, 0xf07bc7df,
-  0x7eff80ff, 0xbf7df1ef, 0x07f01f00, 0x70000000, 0x0f07e3fd, 0xe773fdee,
-  0xf3f87c0e, 0x00000000, 0x3fc7feff, 0xfe07fff7, 0xfe3fc000, 0x1c1f1fde,
-  0xfe3fbdfc, 0x7c1c0000, 0x01c03e07, 0xf0770f70, 0xef1ee1de, 0x3dc3bc7b,
-  0x8778f70e, 0xf0ee0fe0, 0x7c038000, 0x0f01f83f, 0xc79ef6fe, 0xf7ef7ed7,
-  0xeb7ef7ef, 0x7f6f79e3, 0xfc1f80f0, 0x0703e1fc, 0xf779fd7e, 0xdff77dcf,
-  0x71dc771d, 0xc7f0f81c, 0x1f83fc7f, 0xef0fe67e, 0xf7ff77ef, 0x3de7bcf7,
-  0xeeffe07f, 0xff7fe3fc, 0x3fc7feff, 0xfe07ff77, 0xef3de38f, 0x7e7ff7ef,
-  0x7e67f0f7, 0xfe3fc1f8, 0x0780fc1f, 0xe3ce3ae7, 0xae76ef6e, 0xeefe07fe,
-  0xf7ee3ee0, 0xfe07c038, 0x3fc7feff, 0xfe07effe, 0xfee0fee7, 0xff7ff7ef,
-  0x7e67f0f7, 0xfe3fc1f8, 0x1f83fc7f, 0xef0fe67e, 0xf7effe8f, 0xe67ef7ef,
-  0x7e67f0f7, 0xfe3fc1f8, 0x3fc7feff, 0xfe07ff77, 0xef3ee1de, 0x3dc3bc7b,
-  0x87787707, 0xf03e01c0, 0x1f83fc7f, 0xef0fe67e, 0xf7ef7f0f, 0xe67ef7ef,
-  0x7e67f0f7, 0xfe3fc1f8, 0x1f83fc7f, 0xef0fe67e, 0xf7ef7e67, 0xf17ff7ef,
-  0x7e67f0f7, 0xfe3fc1f8, 0x1c1f1fde, 0xfe3fbdfc, 0x7c7f7bf8, 0xfef7f1f0,
-  0x70000000, 0x0e07c3f9, 0xef71def3, 0xf87e3fde, 0x773fdeef, 0x3f87c0e0,
-  0x0380f83f, 0x8f73def7, 0xbde778f7, 0x8f78f78f, 0x70fe0f80, 0xe0000000,
-  0x3fc7feff, 0xfe07ffff, 0xffe07fff, 0x7fe3fc00, 0x380f83f8, 0x778f78f7,
-  0x8f78f73d, 0xef7bde77, 0x8fe0f80e, 0x00000000, 0x3f0ff3ff, 0x70ffcefd,
-  0xcf7bde77, 0x8ee1fc3b, 0x8770fe0f, 0x80e00000, 0x0f81fc3f, 0xe78ff67e,
-  0xf7ee7ed7, 0xed7ed7ee, 0x7f7f78e3, 0xfe1fc0f8, 0x1f83fc7f, 0xef0fe67e,
-  0xf7ef7ef7, 0xe07ef7ef, 0x7ef7ef7f, 0xff7fe39c, 0x3f07f8ff, 0xce1eecee,
-  0xeeeeee0f, 0xee7ef7ef, 0x7ee7e0ff, 0xfe7fc3f8, 0x1f83fc7f, 0xef0fe67e,
-  0xf7effefe, 0xefeeffef, 0x7e67f0f7, 0xfe3fc1f8, 0x3f07f8ff, 0xce1eeefe,
-  0xf7ef7ef7, 0xef7ef7ef, 0x7eefe1ef, 0xfc7f83f0, 0x3fc7feff, 0xfe07effe,
-  0xfeefee0e, 0xefeefcef, 0xeeffe07f, 0xff7fe3fc, 0x3fc7feff, 0xfe07effe,
-  0xfeefee0e, 0xefeefcef, 0x8ee0ee0f, 0xe07c0380, 0x1f83fc7f, 0xef0fe67e,
-  0xf7effeff, 0xec7ef7ef, 0x7e67f0f7, 0xfe3fc1f8, 0x39c7feff, 0xfef7ef7e,
-  0xf7ef7e07, 0xef7ef7ef, 0x7ef7ef7f, 0xff7fe39c, 0x3f8ffbff, 0xf07fbef7,
-  0x8ee1dc3b, 0x8771ef7d, 0xfe0fffdf, 0xf1fc0000, 0x0fc1fe3f, 0xf3873f71,
-  0xf70f73f7, 0x7f7ff7ef, 0x7e67f0f7, 0xfe3fc1f8, 0x39c7feff, 0xfef7eefe,
-  0xdeebce5c, 0xedeeeeee, 0xfef7ef7f, 0xff7fe39c, 0x3807c0fe, 0x0ee0ee0e,
-  0xe0ee0ee0, 0xee0efcef, 0xeeffe07f, 0xff7fe3fc, 0x38e3efbf, 0xffdf7e73,
-  0xf39faafd, 0x57edbf6d, 0xfbefdf7e, 0xfbfffdf7, 0xc71c0000, 0x39c7feff,
-  0xfef7e77e, 0x77eb7eb7, 0xed7ed7ee, 0x7ee7ef7f, 0xff7fe39c, 0x1f83fc7f,
-  0xef0fe67e, 0xf7ef7ef7, 0xef7ef7ef, 0x7e67f0f7, 0xfe3fc1f8, 0x3f87fcff,
-  0xee0fee7e, 0xf7ef7ee7, 0xe0fefeef, 0xcef8ee0f, 0xe07c0380, 0x1f83fc7f,
-  0xef0fe67e, 0xf7ef7ef7, 0xef7ef7ed, 0x7e47f0f7, 0xe73ff1fe, 0x03c00000,
-  0x3f87fcff, 0xee0fee7e, 0xf7ef7ee7, 0xe0febeed, 0xeeefef7f, 0xff7fe39c,
-  0x1f83fc7f, 0xef0fe67e, 0xf7efff3e, 0x7cfff7ef, 0x7e67f0f7, 0xfe3fc1f8,
-  0x3fe3ffbf, 0xffc07fdf, 0xbef8f783, 0xb81dc0ee, 0x07703b81, 0xdc0fe03e,
-  0x00e00000, 0x39c7feff, 0xfef7ef7e, 0xf7ef7ef7, 0xef7ef7ef, 0x7e67f0f7,
-  0xfe3fc1f8, 0x39c7feff, 0xfef7ef7e, 0xf7ef7ef7, 0xef7f6f76, 0xe79e39c3,
-  0xfc1f80f0, 0x38e3efbf, 0xffdf7efb, 0xf7dfbefd, 0xb7edbf55, 0xfaafeef7,
-  0x773ff8ff, 0x83b80000, 0x39c7feff, 0xfef7ef7f, 0x6f76e79e, 0x79e76ef6,
-  0xfef7ef7f, 0xff7fe39c, 0x39c7feff, 0xfef7ef7e, 0xf7ef7e67, 0xf0f7de3d,
-  0xc1dc1dc1, 0xfc0f8070, 0x3fc7feff, 0xfe07ff77, 0xef3ee3de, 0x3bc7bcf7,
-  0xeeffe07f, 0xff7fe3fc, 0x3f1fefff, 0x87effbee, 0xf3b8ee3b, 0x8ee3b8ef,
-  0x3beeff87, 0xffdfe3f0, 0x3807c0fe, 0x0ee0ef0f, 0x707787b8, 0x3bc3dc1d,
-  0xe1ee0ef0, 0xf707707f, 0x03e01c00, 0x3f1fefff, 0x87fddf73, 0xdc771dc7,
-  0x71dc773d, 0xdf7fdf87, 0xffdfe3f0, 0x0f01f83f, 0xc79ef6fe, 0xf7fff7fe,
-  0x39c00000, 0x3fc7feff, 0xfe07fff7, 0xfe3fc000, 0x3c1f8ff3, 0x9ef39ef3,
-  0xdc7f0f81, 0xc0000000, 0x1f83fc7f, 0xe70f7f7f, 0x07e77ef7, 0xe67f177f,
-  0xf3fe1fc0, 0x3807c0fe, 0x0ef8efce, 0xfee8fe67, 0xef7ef7ef, 0x7e67e8ff,
-  0xfe7fc3f8, 0x1f83fc7f, 0xef0fe77e, 0xffefeeff, 0xe77f0f7f, 0xe3fc1f80,
-  0x01c03e07, 0xf1f73f77, 0xf7f17e67, 0xef7ef7ef, 0x7e67f177, 0xff3fe1fc,
-  0x1f83fc7f, 0xef0fe67e, 0xf7e07eff, 0xe77f0f7f, 0xe3fc1f80, 0x0f81fc3f,
-  0xe78f7377, 0x7f77ef7e, 0xe0ef7e77, 0xc7787707, 0xf03e01c0, 0x1fc3fe7f,
-  0xff17e67e, 0xf7ef7e67, 0xf17ff7ef, 0x7e67f0f7, 0xfe3fc1f8, 0x3807c0fe,
-  0x0ef8efce, 0xfee8fe67, 0xef7ef7ef, 0x7ef7ef7f, 0xff7fe39c, 0x0e0f8fe7,
-  0x77bfff8f, 0xf77b9dce, 0xe773b9fc, 0x7c1c0000, 0x0380f83f, 0x8771ee7f,
-  0xce39f71e, 0xe1dcfbbf, 0x7fefd9fc, 0x7bfe3f83, 0xe0000000, 0x3807c0fe,
-  0x0ef8efce, 0xfeeeeede, 0xebce3ced, 0xeeefef7f, 0xff7fe39c, 0x381f0fe3,
-  0xb8ee3b8e, 0xe3b8ee3b, 0xcefb9ff1, 0xdff3f87c, 0x3fc3ff3f, 0xfdc4fedb,
-  0xf6dfb6fd, 0xb7edbf7d, 0xfffeffe3, 0x8e000000, 0x3f87fcff, 0xee8fe67e,
-  0xf7ef7ef7, 0xef7ef7ff, 0xf7fe39c0, 0x1f83fc7f, 0xef0fe67e, 0xf7ef7ef7,
-  0xe67f0f7f, 0xe3fc1f80, 0x3f87fcff, 0xee8fe67e, 0xf7ef7e67, 0xe8fefeef,
-  0xcef8ee0f, 0xe07c0380, 0x1fc3fe7f, 0xff17e67e, 0xf7ef7e67, 0xf177f73f,
-  0x71f70770, 0x7f03e01c, 0x3f87fcff, 0xee8fe77e, 0xffefeefc, 0xee0ee0fe,
-  0x07c03800, 0x1f83fc7f, 0xef0fe77e, 0xfff0fff7, 0xee7f0f7f, 0xe3fc1f80,
-  0x1c03e07f, 0x877cf7ee, 0x0ef7e77c, 0x77e77f73, 0x778f3fe1, 0xfc0f8000,
-  0x39c7feff, 0xfef7ef7e, 0xf7ef7ef7, 0xe67f177f, 0xf3fe1fc0, 0x39c7feff,
-  0xfef7ef7e, 0xf7f6f76e, 0x79e39c3f, 0xc1f80f00, 0x38e3efbf, 0xffdf7efb,
-  0xf6dfb6fd, 0xb7eabfbb, 0xdffc7fc1, 0xdc000000, 0x39c7feff, 0xfef7f6f7,
-  0x9e39c79e, 0xf6fef7ff, 0xf7fe39c0, 0x39c7feff, 0xfef7ef7e, 0xf7ef7e67,
-  0xf17ff7ef, 0x7e67f0f7, 0xfe3fc1f8, 0x3fc7feff, 0xfe07ff77, 0xef3de7be,
-  0xf7fe07ff, 0xf7fe3fc0, 0x0781f87f, 0x9e73be77, 0x8ee3dcfb, 0x9cf3ee3d,
-  0xc3b8778e, 0xf9e71fe1, 0xf81e0000, 0x38fbff7e, 0xfdfbf7ef, 0xdfbf7efd,
-  0xfbff7c70, 0x3c0fc3fc, 0x73cfb8f7, 0x0ee1de3b, 0xe79cef9d, 0xe3b8f73e,
-  0xe73cff0f, 0xc0f00000, 0x1ee1ff9f, 0xffe77edb, 0xf73fffcf, 0xfc3bc000,
-  // Font Bytes: 2112
+  0x05405545, 0x55559556, 0x55595565, 0x55955655, 0x59555555, 0x95565555,
+  0x51550150, 0x05540555, 0x45555559, 0x95566555, 0x99556655, 0x55551555,
+  0x01550000, 0x01554005, 0x55501555, 0x54159654, 0x55965556, 0xaa955596,
+  0x55559655, 0x56aa9555, 0x96551596, 0x54155554, 0x05555001, 0x55400000,
+  0x00540005, 0x55005555, 0x05595555, 0xaa555995, 0x55665515, 0x6a551566,
+  0x55559955, 0x6a955559, 0x54155540, 0x15540005, 0x40000000, 0x01515005,
+  0x55541555, 0x55559595, 0x56659556, 0x66555599, 0x54155950, 0x05655415,
+  0x66555599, 0x95565995, 0x56565555, 0x55541555, 0x50054540, 0x01540005,
+  0x55001555, 0x4055a550, 0x56595056, 0x595055a5, 0x5455a555, 0x56599556,
+  0x56555696, 0x5555a995, 0x15555505, 0x55540155, 0x50000000, 0x00550015,
+  0x54055551, 0x569515a5, 0x55595456, 0x55055540, 0x15500054, 0x00000000,
+  0x00150005, 0x54015550, 0x55951565, 0x51595455, 0x95056550, 0x56540565,
+  0x40565405, 0x65505595, 0x01595415, 0x65505595, 0x01555005, 0x54001500,
+  0x05400155, 0x00555405, 0x65505595, 0x41565405, 0x65505595, 0x01595015,
+  0x95015950, 0x55950565, 0x51565455, 0x95456550, 0x55540155, 0x00054000,
+  0x01554005, 0x55501555, 0x54159654, 0x55695556, 0xaa955569, 0x55159654,
+  0x15555405, 0x55500155, 0x40000000, 0x00150000, 0x15500015, 0x55001565,
+  0x50155955, 0x15565555, 0x6aaa5555, 0x65551559, 0x55015655, 0x00155500,
+  0x01550000, 0x15000000, 0x00550015, 0x54055551, 0x569515a5, 0x55595456,
+  0x55055540, 0x15500054, 0x00000000, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55555515, 0x55540555, 0x50000000, 0x01500155, 0x01555156, 0x5556a555,
+  0x65515550, 0x15500150, 0x00000000, 0x00015000, 0x05540015, 0x55001595,
+  0x00559500, 0x56550156, 0x54015954, 0x05595005, 0x65501565, 0x40159540,
+  0x55950056, 0x55005654, 0x00555400, 0x15500005, 0x40000000, 0x00550001,
+  0x55400555, 0x50156954, 0x55965556, 0x55955655, 0x95565995, 0x56659556,
+  0x55955655, 0x95559655, 0x15695405, 0x55500155, 0x40005500, 0x00150005,
+  0x54015550, 0x55951569, 0x55599556, 0x59555595, 0x15595055, 0x95015950,
+  0x15950159, 0x50155500, 0x55400150, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955555, 0x95155655, 0x05595415, 0x65505595, 0x54565555,
+  0x56aa9555, 0x55551555, 0x54055550, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55559515, 0x56550559, 0x54056a55, 0x15569555, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x00154000, 0x55500155, 0x54055a54,
+  0x05665415, 0x66541596, 0x54559654, 0x56565556, 0xaa955556, 0x55155654,
+  0x05565400, 0x55540015, 0x50000540, 0x05555015, 0x55545555, 0x5556aa95,
+  0x56555556, 0x555456aa, 0x55565695, 0x55559555, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x55566a55, 0x56969556, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55559515, 0x56550556, 0x54015954, 0x05595005, 0x65501565, 0x40159540,
+  0x15950015, 0x55000554, 0x00015000, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x9555aa55, 0x56969556, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x95569695, 0x55a99555, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x01500155, 0x01555156, 0x5556a555,
+  0x65515550, 0x15501555, 0x1565556a, 0x55565515, 0x55015500, 0x15000000,
+  0x00540015, 0x50055541, 0x565515a9, 0x51565505, 0x55401554, 0x05555156,
+  0x9515a555, 0x59545655, 0x05554015, 0x50005400, 0x00054000, 0x55400555,
+  0x40559505, 0x59545595, 0x45595415, 0x95405595, 0x40559540, 0x55954055,
+  0x95005554, 0x00554000, 0x54000000, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55555555, 0x555556aa, 0x95555555, 0x15555405, 0x55500000, 0x05400055,
+  0x40055540, 0x15954055, 0x95405595, 0x40559540, 0x55950559, 0x54559545,
+  0x59541595, 0x40555400, 0x55400054, 0x00000000, 0x05550055, 0x55055555,
+  0x15aa5555, 0x5a545559, 0x50559545, 0x59541595, 0x40565401, 0x55500565,
+  0x40159500, 0x55540055, 0x40005400, 0x00554001, 0x55500555, 0x54156a55,
+  0x55969556, 0x55955656, 0x95565995, 0x56599556, 0x59955656, 0x95559555,
+  0x156a5405, 0x55540155, 0x50005540, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x95565595, 0x56aa9556, 0x55955655, 0x95565595,
+  0x56559555, 0x55551555, 0x54054150, 0x05550015, 0x55405555, 0x5056a954,
+  0x565a5456, 0x56545656, 0x5456aa55, 0x56569556, 0x55955655, 0x95565695,
+  0x56aa5555, 0x55541555, 0x50055540, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x55565554, 0x56555456, 0x55555655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x05550015, 0x55405555, 0x5056a954,
+  0x56565556, 0x55955655, 0x95565595, 0x56559556, 0x55955655, 0x95565655,
+  0x56a95455, 0x55501555, 0x40055500, 0x05555015, 0x55545555, 0x5556aa95,
+  0x56555556, 0x55545655, 0x5456aa54, 0x56555456, 0x55505655, 0x54565555,
+  0x56aa9555, 0x55551555, 0x54055550, 0x05555015, 0x55545555, 0x5556aa95,
+  0x56555556, 0x55545655, 0x5456aa54, 0x56555456, 0x55505655, 0x40565400,
+  0x56540055, 0x54001550, 0x00054000, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x55565555, 0x565a9556, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x05415015, 0x55545555, 0x55565595,
+  0x56559556, 0x55955655, 0x9556aa95, 0x56559556, 0x55955655, 0x95565595,
+  0x56559555, 0x55551555, 0x54054150, 0x05554055, 0x55455555, 0x55aa9555,
+  0x65545595, 0x40565401, 0x59500565, 0x40159501, 0x56551559, 0x5556aa55,
+  0x55555155, 0x55015550, 0x00555001, 0x55540555, 0x55056a95, 0x05559501,
+  0x55950055, 0x95055595, 0x15559555, 0x55955655, 0x95569695, 0x55aa5515,
+  0x55540555, 0x50015540, 0x05415015, 0x55545555, 0x55565595, 0x56565556,
+  0x59545665, 0x50569950, 0x56595456, 0x56545656, 0x55565595, 0x56559555,
+  0x55551555, 0x54054150, 0x05400015, 0x50005554, 0x00565400, 0x56540056,
+  0x54005654, 0x00565400, 0x56540056, 0x55505655, 0x54565555, 0x56aa9555,
+  0x55551555, 0x54055550, 0x05405405, 0x54554555, 0x55555955, 0x955695a5,
+  0x55a56955, 0x66665559, 0x99955659, 0x65559659, 0x55655655, 0x59559556,
+  0x55655555, 0x55515515, 0x50150150, 0x05415015, 0x55545555, 0x55565595,
+  0x56959556, 0x95955665, 0x95566595, 0x56599556, 0x59955656, 0x95565695,
+  0x56559555, 0x55551555, 0x54054150, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x95565595, 0x56559556, 0x55955655, 0x95569695,
+  0x55aa5515, 0x55540555, 0x50015540, 0x05554015, 0x55505555, 0x5456aa55,
+  0x56569556, 0x55955655, 0x95565695, 0x56aa5556, 0x55545655, 0x50565540,
+  0x56540055, 0x54001550, 0x00054000, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x95565595, 0x56559556, 0x55955659, 0x95569a95,
+  0x55aa5515, 0x56950555, 0x55015554, 0x00055000, 0x05554015, 0x55505555,
+  0x5456aa55, 0x56569556, 0x55955655, 0x95565695, 0x56aa5556, 0x65545659,
+  0x54565655, 0x56559555, 0x55551555, 0x54054150, 0x01554005, 0x55501555,
+  0x5455aa55, 0x56969556, 0x55955655, 0x5555a554, 0x155a5555, 0x55955655,
+  0x95569695, 0x55aa5515, 0x55540555, 0x50015540, 0x05555405, 0x55554555,
+  0x55555aaa, 0x95555955, 0x45565540, 0x55954005, 0x65400159, 0x50005654,
+  0x00159500, 0x05654001, 0x59500055, 0x54000554, 0x00005400, 0x05415015,
+  0x55545555, 0x55565595, 0x56559556, 0x55955655, 0x95565595, 0x56559556,
+  0x55955655, 0x95569695, 0x55aa5515, 0x55540555, 0x50015540, 0x05415015,
+  0x55545555, 0x55565595, 0x56559556, 0x55955655, 0x95565595, 0x56559555,
+  0x96551596, 0x54156954, 0x05695005, 0x55500155, 0x40005500, 0x05405405,
+  0x54554555, 0x55555955, 0x95565565, 0x55955955, 0x65565559, 0x65955659,
+  0x65559999, 0x55666655, 0x56565515, 0x95950555, 0x55405555, 0x40054540,
+  0x05415015, 0x55545555, 0x55565595, 0x56559555, 0x96551596, 0x54156954,
+  0x15695415, 0x96545596, 0x55565595, 0x56559555, 0x55551555, 0x54054150,
+  0x05415015, 0x55545555, 0x55565595, 0x56559556, 0x55955655, 0x95569695,
+  0x55aa5515, 0x59540559, 0x50015950, 0x01595001, 0x55500055, 0x40001500,
+  0x05555015, 0x55545555, 0x5556aa95, 0x55559515, 0x56550556, 0x54055954,
+  0x05655015, 0x65505595, 0x54565555, 0x56aa9555, 0x55551555, 0x54055550,
+  0x05550155, 0x54555555, 0x6a955655, 0x55655456, 0x55056540, 0x56540565,
+  0x40565405, 0x65405655, 0x05655456, 0x55556a95, 0x55555155, 0x54055500,
+  0x05400015, 0x50005554, 0x00565400, 0x56550055, 0x95001595, 0x40156540,
+  0x05655005, 0x59500159, 0x54015654, 0x00565500, 0x55950015, 0x95001555,
+  0x00055400, 0x01500000, 0x05550155, 0x54555555, 0x6a955559, 0x51559505,
+  0x59501595, 0x01595015, 0x95015950, 0x15950559, 0x51559555, 0x59556a95,
+  0x55555155, 0x54055500, 0x00550001, 0x55400555, 0x50156954, 0x55965556,
+  0x55955555, 0x55155554, 0x05415000, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55555515, 0x55540555, 0x50000000, 0x05500155, 0x40555505, 0x695455a5,
+  0x41565505, 0x59501555, 0x00554001, 0x50000000, 0x01554005, 0x55501555,
+  0x5415aa55, 0x15559555, 0xaa955695, 0x95565595, 0x56969555, 0xa9951555,
+  0x55055554, 0x01555000, 0x05400015, 0x50005554, 0x00565540, 0x56555056,
+  0x5554566a, 0x55569695, 0x56559556, 0x55955655, 0x95569695, 0x566a5555,
+  0x55541555, 0x50055540, 0x01554005, 0x55501555, 0x5455aa55, 0x56959556,
+  0x55555655, 0x54565555, 0x56959555, 0xaa551555, 0x54055550, 0x01554000,
+  0x00015000, 0x05540015, 0x55015595, 0x05559515, 0x559555a9, 0x95569695,
+  0x56559556, 0x55955655, 0x95569695, 0x55a99515, 0x55550555, 0x54015550,
+  0x01554005, 0x55501555, 0x5455aa55, 0x56969556, 0x559556aa, 0x95565555,
+  0x56959555, 0xaa551555, 0x54055550, 0x01554000, 0x00554001, 0x55500555,
+  0x54156a55, 0x15a59515, 0x95551595, 0x54559554, 0x56aa5455, 0x95541595,
+  0x50159540, 0x15950015, 0x55000554, 0x00015000, 0x01555005, 0x55541555,
+  0x5555a995, 0x56969556, 0x55955655, 0x95569695, 0x55a99555, 0x55955655,
+  0x95569695, 0x55aa5515, 0x55540555, 0x50015540, 0x05400015, 0x50005554,
+  0x00565540, 0x56555056, 0x5554566a, 0x55569695, 0x56559556, 0x55955655,
+  0x95565595, 0x56559555, 0x55551555, 0x54054150, 0x00540055, 0x40555415,
+  0x95156555, 0x55556a55, 0x55951565, 0x41595056, 0x54159505, 0x65415550,
+  0x15500150, 0x00054000, 0x55400555, 0x40159501, 0x56541555, 0x5056a541,
+  0x55950156, 0x54015950, 0x55654555, 0x95555655, 0x5969555a, 0x95455554,
+  0x05554005, 0x54000000, 0x05400015, 0x50005554, 0x00565540, 0x56555056,
+  0x55545656, 0x54565954, 0x56655056, 0xa5505659, 0x54565655, 0x56559555,
+  0x55551555, 0x54054150, 0x05400155, 0x00555405, 0x65405654, 0x05654056,
+  0x54056540, 0x56540565, 0x50565545, 0x695555a9, 0x51555505, 0x55401550,
+  0x05555005, 0x55550555, 0x55515a9a, 0x55565965, 0x55965955, 0x65965559,
+  0x65955659, 0x65559559, 0x55555554, 0x55555405, 0x40540000, 0x05554015,
+  0x55505555, 0x54566a55, 0x56969556, 0x55955655, 0x95565595, 0x56559556,
+  0x55955555, 0x55155554, 0x05415000, 0x01554005, 0x55501555, 0x5455aa55,
+  0x56969556, 0x55955655, 0x95565595, 0x56969555, 0xaa551555, 0x54055550,
+  0x01554000, 0x05554015, 0x55505555, 0x54566a55, 0x56969556, 0x55955655,
+  0x95569695, 0x566a5556, 0x55545655, 0x50565540, 0x56540055, 0x54001550,
+  0x00054000, 0x01555005, 0x55541555, 0x5555a995, 0x56969556, 0x55955655,
+  0x95569695, 0x55a99515, 0x55950555, 0x95015595, 0x00159500, 0x15550005,
+  0x54000150, 0x05554015, 0x55505555, 0x54566a55, 0x56959556, 0x55555655,
+  0x54565550, 0x56540056, 0x54005554, 0x00155000, 0x05400000, 0x01554005,
+  0x55501555, 0x5455aa55, 0x56959556, 0x555555aa, 0x55555595, 0x56569555,
+  0xaa551555, 0x54055550, 0x01554000, 0x01500005, 0x54001555, 0x40159550,
+  0x55955456, 0xaa545595, 0x54159550, 0x15955415, 0x955515a5, 0x95156a55,
+  0x05555401, 0x55500055, 0x40000000, 0x05415015, 0x55545555, 0x55565595,
+  0x56559556, 0x55955655, 0x95565595, 0x56969555, 0xa9951555, 0x55055554,
+  0x01555000, 0x05415015, 0x55545555, 0x55565595, 0x56559556, 0x55955596,
+  0x55159654, 0x15695405, 0x69500555, 0x50015540, 0x00550000, 0x05405405,
+  0x54554555, 0x55555955, 0x95565565, 0x55965955, 0x65965559, 0x65955666,
+  0x65556565, 0x51555550, 0x15555001, 0x51500000, 0x05415015, 0x55545555,
+  0x55565595, 0x55965515, 0x69540569, 0x50156954, 0x55965556, 0x55955555,
+  0x55155554, 0x05415000, 0x05415015, 0x55545555, 0x55565595, 0x56559556,
+  0x55955655, 0x95569695, 0x55a99555, 0x55955655, 0x95569695, 0x55aa5515,
+  0x55540555, 0x50015540, 0x05555015, 0x55545555, 0x5556aa95, 0x55559515,
+  0x56550559, 0x54156554, 0x55955556, 0xaa955555, 0x55155554, 0x05555000,
+  0x00154001, 0x55401555, 0x41569505, 0x65541595, 0x40565405, 0x59505565,
+  0x415a5505, 0x56540559, 0x50056540, 0x15954056, 0x55415695, 0x01555401,
+  0x55400154, 0x00000000, 0x05405545, 0x55559556, 0x55595565, 0x55955655,
+  0x59556555, 0x95565559, 0x55655555, 0x15501500, 0x05500055, 0x50055550,
+  0x15a55055, 0x65405595, 0x00565401, 0x59540565, 0x54156950, 0x56554159,
+  0x54056540, 0x55950556, 0x5415a550, 0x55550055, 0x50005500, 0x00000000,
+  0x01545401, 0x55554155, 0x55555695, 0x95565965, 0x5595a555, 0x55555055,
+  0x55500545, 0x50000000,
+  // Font Bytes: 4136
 
   0x00000000
 };
@@ -254,162 +339,280 @@ const uint32_t font_small_bold[] = {
   0x00000000
 };
 
-// Font: small-bold-outline (neep-alt-iso8859-1-08x15-bold.bdf)
-const uint32_t font_small_bold_outline[] = {
+// Font: small-bold-combined (neep-alt-iso8859-1-08x15-bold.bdf)
+const uint32_t font_small_bold_combined[] = {
 
   // Font Info: width=8 height=15 descent=3
   0x00030f08,
 
   // Glyph Info:
-  0x54948000, 0x6b108006, 0x7c4ca00b, 0x748c8013, 0x7c8c801b, 0x7c4ca024,
-  0x6b0c802c, 0x6d506031, 0x6d50603a, 0x7b4ce043, 0x8408c04a, 0x6b0d8052,
-  0x728d2057, 0x62d1805c, 0x7d0c6061, 0x7c8c806b, 0x64908074, 0x7c8c807b,
-  0x7c8c8084, 0x7c8c808d, 0x7c8c8096, 0x7c8c809f, 0x7c8c80a8, 0x7c8c80b1,
-  0x7c8c80ba, 0x6450c0c3, 0x6c8cc0ca, 0x744ca0d2, 0x734d00da, 0x744ca0e0,
-  0x748c80e8, 0x7c8c80f0, 0x7c8c80f9, 0x7c8c8102, 0x7c8c810b, 0x7c8c8114,
-  0x7c8c811d, 0x7c8c8126, 0x7c8c812f, 0x7c8c8138, 0x748c8141, 0x7c8c8149,
-  0x7c8c8152, 0x7c8c815b, 0x7c8c8164, 0x7c8c816d, 0x7c8c8176, 0x7c8c817f,
-  0x7d4c8188, 0x7c8c8192, 0x7c8c819b, 0x848881a4, 0x7c8c81ad, 0x7c8c81b6,
-  0x7c8c81bf, 0x7c8c81c8, 0x7c8c81d1, 0x7c8c81da, 0x6d5061e3, 0x7d0c61ec,
-  0x6d5061f6, 0x730c81ff, 0x7a8dc205, 0x6b10820a, 0x7bcce20f, 0x7c8c8217,
-  0x7bcce220, 0x7c8c8228, 0x7bcce231, 0x7c8c8239, 0x7c8ce242, 0x7c8c824b,
-  0x64908254, 0x750c825b, 0x7c8c8264, 0x6494826d, 0x7bcce274, 0x7bcce27c,
-  0x7bcce284, 0x7c8ce28c, 0x7c8ce295, 0x7bcce29e, 0x7bcce2a6, 0x7c4ca2ae,
-  0x7bcce2b6, 0x7bcce2be, 0x7bcce2c6, 0x7bcce2ce, 0x7c8ce2d6, 0x7bcce2df,
-  0x754c62e7, 0x551462f1, 0x754c62f8, 0x7b0ca302,
+  0x54948000, 0x6b10800c, 0x7c4ca016, 0x748c8026, 0x7c8c8036, 0x7c4ca047,
+  0x6b0c8057, 0x6d506061, 0x6d506073, 0x7b4ce085, 0x8408c092, 0x6b0d80a2,
+  0x728d20ac, 0x62d180b5, 0x7d0c60be, 0x7c8c80d1, 0x649080e2, 0x7c8c80f0,
+  0x7c8c8101, 0x7c8c8112, 0x7c8c8123, 0x7c8c8134, 0x7c8c8145, 0x7c8c8156,
+  0x7c8c8167, 0x6450c178, 0x6c8cc185, 0x744ca194, 0x734d01a3, 0x744ca1af,
+  0x748c81be, 0x7c8c81ce, 0x7c8c81df, 0x7c8c81f0, 0x7c8c8201, 0x7c8c8212,
+  0x7c8c8223, 0x7c8c8234, 0x7c8c8245, 0x7c8c8256, 0x748c8267, 0x7c8c8277,
+  0x7c8c8288, 0x7c8c8299, 0x7c8c82aa, 0x7c8c82bb, 0x7c8c82cc, 0x7c8c82dd,
+  0x7d4c82ee, 0x7c8c8302, 0x7c8c8313, 0x84888324, 0x7c8c8336, 0x7c8c8347,
+  0x7c8c8358, 0x7c8c8369, 0x7c8c837a, 0x7c8c838b, 0x6d50639c, 0x7d0c63ae,
+  0x6d5063c1, 0x730c83d3, 0x7a8dc3de, 0x6b1083e8, 0x7bcce3f2, 0x7c8c8401,
+  0x7bcce412, 0x7c8c8421, 0x7bcce432, 0x7c8c8441, 0x7c8ce452, 0x7c8c8463,
+  0x64908474, 0x750c8482, 0x7c8c8494, 0x649484a5, 0x7bcce4b3, 0x7bcce4c2,
+  0x7bcce4d1, 0x7c8ce4e0, 0x7c8ce4f1, 0x7bcce502, 0x7bcce511, 0x7c4ca520,
+  0x7bcce530, 0x7bcce53f, 0x7bcce54e, 0x7bcce55d, 0x7c8ce56c, 0x7bcce57d,
+  0x754c658c, 0x5514659f, 0x754c65ac, 0x7b0ca5bf,
 
   // Bitmap Data:
-  0x1e1fe7fb, 0xfff3fcff, 0x3fcff3fc, 0xff3ffff3, 0xfcfffdfe, 0x7f878000,
-  0x1fc3ff9f, 0xfdffff27, 0xf93fc9fe, 0x4ffffbff, 0x9ffc3f80, 0x0fe07ff0,
-  0xffe3ffe7, 0x93df27fc, 0x07f80ff9, 0x3fe03fc0, 0x7fc9f793, 0xcfff8ffe,
-  0x1ffc0fe0, 0x03803f83, 0xff9ffe7e, 0xffe0ff03, 0xfcbff07f, 0xe0ffe3fc,
-  0x0ff07ffb, 0xe7ff9ffc, 0x1fe00e00, 0x0ef07ff9, 0xfff3ffff, 0xb9fe33fc,
-  0x4ffd3e7e, 0x7cf9f9f2, 0xffc8ff31, 0xfe77ffff, 0x3ffe7ff8, 0x3dc00000,
-  0x0f807fc1, 0xffc3ff8f, 0x8f9e0fbc, 0x9f7c7ff8, 0x9fe43fcc, 0xff80ff89,
-  0xefffdfff, 0x1ffe0ff0, 0x07c0ff8f, 0xfc7ff7c7, 0xbc7fe7de, 0x7effe3fe,
-  0x1fe03c00, 0x03c07f87, 0xfc7ff3e7, 0xbe7de7df, 0x3ef3e79e, 0x3cf1e78f,
-  0x3e7cf9e7, 0xcf9f3e79, 0xffc7fc1f, 0xe03c0000, 0x1e03fc1f, 0xf1ffcf3e,
-  0x7cf9f3cf, 0x9f3e78f3, 0xc79e3cf3, 0xe7be7df3, 0xdf3ef3e7, 0xff1ff0ff,
-  0x01e00000, 0x0fe07ff0, 0xffe3ffe7, 0x93df8ffc, 0x07fe3f79, 0x3cfff8ff,
-  0xe1ffc0fe, 0x00000000, 0x03c00ff0, 0x0ff01ff8, 0x7e7e7e7e, 0xfe7ff00f,
-  0xf00ffe7f, 0x7e7e7e7e, 0x1ff80ff0, 0x0ff003c0, 0x07c0ff8f, 0xfc7ff7c7,
-  0xbc7fe7de, 0x7effe3fe, 0x1fe03c00, 0x1fe1ffe7, 0xffbffff0, 0x3fc0ffff,
-  0xdffe7ff8, 0x7f800000, 0x0f03fc7f, 0xe7fef9ff, 0x0ff9f7fe, 0x7fe3fc0f,
-  0x00000000, 0x00f007f8, 0x0ff03ff0, 0x79e1f3c3, 0xcf8f9e1e, 0x7c7cf0f3,
-  0xe3e7879f, 0x1f3c3cf8, 0x79e0ffc0, 0xff01fe00, 0xf0000000, 0x07c03fe0,
-  0xffe3ffe7, 0xc7df07fc, 0xe7f9cff2, 0x9fe53fce, 0x7f9cff83, 0xef8f9fff,
-  0x1ffc1ff0, 0x0f800000, 0x0380fe1f, 0xe3ff7ef7, 0xcff8ff0f, 0xfcf7cf7c,
-  0xf3cf3cf3, 0xcf3ff1fe, 0x1fe07800, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7ffcf7f, 0x3efcf9f3, 0xf7cfff01, 0xfe03ffff, 0xbffe7ffc, 0x3fe00000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0xcfbf3e7c, 0x3ef83ffe, 0x7f9cff01,
-  0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x03e01ff0, 0x7fe0ffe3, 0xe3c7879f,
-  0x0f3c9ef9, 0x3de67fc0, 0x7f80fff3, 0xefe79fff, 0x0ffc07f8, 0x03c00000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03fc, 0xfff81ff0, 0x1fff3ffe, 0x7f9cff01,
-  0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f9fff2, 0x3fe03fce, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0xe7bf9f7f, 0x3c3cf8f9, 0xe1e7c7cf,
-  0x0f3e1ff8, 0x1ff03fc0, 0x1e000000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f9cff8, 0x3fe03fce, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000,
-  0x0fe07ff1, 0xfff3ffef, 0x83fe03fc, 0xe7f9cff0, 0x1ff13ffe, 0x7f9cff01,
-  0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x0f03fc7f, 0xe7fef9ff, 0x0ff9f7fe,
-  0x7fe7fef9, 0xff0ff9f7, 0xfe7fe3fc, 0x0f000000, 0x0780ff0f, 0xfc7fe7cf,
-  0xbc3df3e7, 0xfe3ff1ff, 0xdf1ef1ff, 0x9f79fbff, 0x8ff87f80, 0xf0000000,
-  0x01e01fe0, 0xff87ff3f, 0x3df9f7cf, 0xbe7ef3f3, 0xe7e7cf9f, 0x9f3f3c7f,
-  0xf0ff81fe, 0x01e00000, 0x1fe1ffe7, 0xffbffff0, 0x3fc0ffff, 0xfc0ff03f,
-  0xfff7ff9f, 0xfe1fe000, 0x1e01fe07, 0xfc3ff8f3, 0xf3e7e7cf, 0x9f9f3f3d,
-  0xf9f7cfbe, 0x7ef3f3ff, 0x87fc1fe0, 0x1e000000, 0x1fc1ffc7, 0xffbffef0,
-  0x7fc0fff3, 0xdf9f7cf9, 0xe7e79f1f, 0xf879e1e7, 0x87fe0ff0, 0x3fc03c00,
-  0x07e03ff0, 0xfff3ffe7, 0xc3ff03fc, 0xf7fb8ff6, 0x1fedbfd8, 0x7f98ff9f,
-  0xef8f9fff, 0x1ff81ff0, 0x0f800000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f9cff0, 0x1fe03fce, 0x7f9cff39, 0xfe73ffff, 0xbffe7ffc, 0x3de00000,
-  0x1fc0ffe1, 0xffe7ffcf, 0x07de07bc, 0xcf799ef0, 0x3fe03fce, 0x7f9cff01,
-  0xfe07ffff, 0x3ffe7ff8, 0x3fc00000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f9fff3, 0xfde7fbcf, 0xff9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000,
-  0x1fc0ffe1, 0xffe7ffef, 0x07de07fc, 0xc7f9cff3, 0x9fe73fce, 0x7f98ff03,
-  0xfe0fbfff, 0x3ffc7ff0, 0x3f800000, 0x1ff0fff9, 0xfff7ffff, 0x01fe03fc,
-  0xfff9fef0, 0x3de07bcf, 0xf79fff01, 0xfe03ffff, 0xbffe7ffc, 0x3fe00000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03fc, 0xfff9fef0, 0x3de07bcf, 0xf79fcf3f,
-  0x9e7c3ff0, 0x3fc07f80, 0x3c000000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f9fff2, 0x1fe43fce, 0x7f9cff01, 0xff03dfff, 0xbffe3ffc, 0x1fe00000,
-  0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0xe7f9cff0, 0x1fe03fce, 0x7f9cff39,
-  0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x1fe1ffe7, 0xffbffff0, 0x3fc0ffcf,
-  0xdf3e7cf9, 0xf3e7cfbf, 0x3ff03fc0, 0xffffdffe, 0x7ff87f80, 0x07f03ff8,
-  0x7ff1fff3, 0xc1e783cf, 0xe78fcf7f, 0x9eff3ffe, 0x7f9cff01, 0xff07dfff,
-  0x3ffe3ff8, 0x1fc00000, 0x1ef0fff9, 0xfff7ffff, 0x39fe67fc, 0x9f787ef0,
-  0x79e4fbcc, 0xf799ff39, 0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x1e00ff01,
-  0xfe07fe0f, 0x3c1e783c, 0xf079e0f3, 0xf1e7fbcf, 0xf79fff01, 0xfe03ffff,
-  0xbffe7ffc, 0x3fe00000, 0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0x47f88ff0,
-  0x1fe53fca, 0x7f9cff39, 0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x1ef0fff9,
-  0xfff7ffff, 0x39fe73fc, 0x67f8cff0, 0x9fe43fcc, 0x7f98ff39, 0xfe73ffff,
-  0xbffe7ffc, 0x3de00000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc, 0xe7f9cff3,
-  0x9fe73fce, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x1fe0fff1,
-  0xfff7ffef, 0x03fe03fc, 0xe7f9cff0, 0x1fe07fcf, 0xf79fef3f, 0x9e7c3ff0,
-  0x3fc07f80, 0x3c000000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc, 0xe7f9cff3,
-  0x9fe73fce, 0x7f9cff01, 0xff07df1f, 0xbf0f3f1e, 0x3ffc3ff0, 0x3fe01f00,
-  0x1fe0fff1, 0xfff7ffef, 0x03fe03fc, 0xe7f9cff0, 0x3fe0fbcc, 0xf799ff39,
-  0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f8fff8, 0x7cf87ffc, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000,
-  0x1ff87ffe, 0x7ffeffff, 0xf00ff00f, 0xfe7f7e7e, 0x7e7e1e78, 0x1e781e78,
-  0x1e781e78, 0x1ff80ff0, 0x0ff003c0, 0x1ef0fff9, 0xfff7ffff, 0x39fe73fc,
-  0xe7f9cff3, 0x9fe73fce, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000,
-  0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0xe7f9cff3, 0x9fe73fe4, 0xfbc9e7c7,
-  0xc78f0ffe, 0x0ff81ff0, 0x0f800000, 0x1ef0fff9, 0xfff7ffff, 0x39fe73fc,
-  0xe7f9cff3, 0x9fe53fca, 0x7f80ff11, 0xff77dfff, 0x3ffe3ff8, 0x1dc00000,
-  0x1ef0fff9, 0xfff7ffff, 0x39fe73fe, 0x4fbc9e7c, 0x7cf8f9e4, 0xf7c9ff39,
-  0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x1ef0fff9, 0xfff7ffff, 0x39fe73fc,
-  0xe7f9cff0, 0x1ff07df9, 0xf3f3e3e7, 0x83cf07fe, 0x07f80ff0, 0x07800000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0xe7bf9f7e, 0x7cf9fbe7, 0xf79fff01,
-  0xfe03ffff, 0xbffe7ffc, 0x3fe00000, 0x1fc3ff9f, 0xfdffff07, 0xf83fcffe,
-  0x7ef3f79e, 0x3cf1e78f, 0x3f79fbcf, 0xfe0ff07f, 0xffdffcff, 0xe1fc0000,
-  0x1e00ff01, 0xfe07fe0f, 0x3c1e7c3e, 0x783cf87c, 0xf079f0f9, 0xe0f3e1f3,
-  0xc1e7c3e7, 0x83cf07fe, 0x07f80ff0, 0x07800000, 0x1fc3ff9f, 0xfdffff07,
-  0xf83ff9ef, 0xcf7e78f3, 0xc79e3cf7, 0xe7bf3ff9, 0xfe0ff07f, 0xffdffcff,
-  0xe1fc0000, 0x07807f83, 0xff1ffe7c, 0xfbe1ff33, 0xfdeffffd, 0xffe7ff87,
-  0x38000000, 0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0xffbffe7f, 0xfc3fe000,
-  0x1f03fe1f, 0xf9ffcf1f, 0x7c79f3ef, 0xcf3ff8ff, 0x83fc0780, 0x0fe07ff0,
-  0xfff3ffe7, 0x83ef03df, 0xe7fc0ff3, 0x9fe03fe2, 0x7bfff7ff, 0xc7ff83fc,
-  0x00000000, 0x1e00ff01, 0xfe07ff0f, 0x3f9e7fbc, 0xff791ff0, 0x1fe73fce,
-  0x7f9cff01, 0xfe47ffff, 0x3ffe7ff8, 0x3fc00000, 0x0fe07ff1, 0xfff3ffef,
-  0x83fe03fc, 0xe7f9fff3, 0x9fe03fe0, 0xfbffe7ff, 0xc7ff03f8, 0x00000000,
-  0x00f007f8, 0x0ff07ff3, 0xf9eff3df, 0xe7fc4ff0, 0x1fe73fce, 0x7f9cff01,
-  0xff13dfff, 0xbffe3ffc, 0x1fe00000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc,
-  0xe7f80ff3, 0xffe07be0, 0xf3ffe7ff, 0x87ff03f8, 0x00000000, 0x07e03ff0,
-  0xfff1ffe7, 0xc3ef03de, 0x67fcfff0, 0x3de07be7, 0xf3cfc79f, 0x8f3c1ff8,
-  0x1fe03fc0, 0x1e000000, 0x0ff07ff9, 0xfff3ffff, 0x89fe03fc, 0xe7f9cff0,
-  0x1ff13ffe, 0x7f9cff01, 0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x1e00ff01,
-  0xfe07ff0f, 0x3f9e7fbc, 0xff791ff0, 0x1fe73fce, 0x7f9cff39, 0xfe73ffff,
-  0xbffe7ffc, 0x3de00000, 0x0781fe1f, 0xe3ff7cf7, 0xcfffff0f, 0xf0ffcf7c,
-  0xf7cf3cf3, 0xcf3ff1fe, 0x1fe07800, 0x01e01fe0, 0x7f83ff1f, 0x3c7cf3ff,
-  0xcf0f3c3c, 0xfcf7f3df, 0xcfff3fcc, 0xff03fe1f, 0x7ff9ffe3, 0xff03f000,
-  0x1e00ff01, 0xfe07ff0f, 0x3f9e7f3c, 0xff799ef2, 0x7de1f3c3, 0xf793ef33,
-  0xfe73ffff, 0xbffe7ffc, 0x3de00000, 0x1e07f87f, 0x8ffcf3cf, 0x3cf3cf3c,
-  0xf3cf3ef3, 0xef3ff0ff, 0x8f7ff7fe, 0x3fe0f800, 0x1fe0fff1, 0xfff7ffef,
-  0x13fe03fc, 0xa7f94ff2, 0x9fe53fce, 0x7ffff7ff, 0xcfff87bc, 0x00000000,
-  0x1fe0fff1, 0xfff7ffef, 0x23fe03fc, 0xe7f9cff3, 0x9fe73fce, 0x7ffff7ff,
-  0xcfff87bc, 0x00000000, 0x0fe07ff1, 0xfff3ffef, 0x83fe03fc, 0xe7f9cff3,
-  0x9fe03fe0, 0xfbffe7ff, 0xc7ff03f8, 0x00000000, 0x1fe0fff1, 0xfff7ffef,
-  0x23fe03fc, 0xe7f9cff0, 0x1fe47fcf, 0xf79fef3f, 0x9e7c3ff0, 0x3fc07f80,
-  0x3c000000, 0x0ff07ff9, 0xfff3ffff, 0x89fe03fc, 0xe7f9cff0, 0x1ff13dfe,
-  0x7bfcf3f9, 0xe1f3c1ff, 0x81fe03fc, 0x01e00000, 0x1fe0fff1, 0xfff7ffef,
-  0x23fe03fc, 0xe7f9fff3, 0xfde7fbcf, 0xc7fe07f8, 0x0ff00780, 0x00000000,
-  0x0ff07ff9, 0xfff3ffff, 0x81fe03fc, 0xfffc1fff, 0x9fe03fc0, 0xffffe7ff,
-  0xcfff07f8, 0x00000000, 0x0f007f80, 0xff83ffc7, 0x9f9f3fbc, 0x0f781ef9,
-  0xfcf3fde6, 0x7bc0f7c3, 0xe7ff8fff, 0x0ffc07e0, 0x1ef0fff9, 0xfff7ffff,
-  0x39fe73fc, 0xe7f9cff3, 0x9fe03fe2, 0x7bfff7ff, 0xc7ff83fc, 0x00000000,
-  0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0xe7fc9f79, 0x3cf8f8f1, 0xe1ffc1ff,
-  0x03fe01f0, 0x00000000, 0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0xa7f94ff0,
-  0x1fe23fee, 0xfbffe7ff, 0xc7ff03b8, 0x00000000, 0x1ef0fff9, 0xfff7ffff,
-  0x39ff27df, 0x1f3e3e7c, 0x7df27fce, 0x7ffff7ff, 0xcfff87bc, 0x00000000,
-  0x1ef0fff9, 0xfff7ffff, 0x39fe73fc, 0xe7f9cff0, 0x1ff13ffe, 0x7f9cff01,
-  0xff07dfff, 0x3ffe3ff8, 0x1fc00000, 0x1ff0fff9, 0xfff7ffff, 0x01fe03ff,
-  0xcfbe3ef9, 0xffe03fc0, 0x7ffff7ff, 0xcfff87fc, 0x00000000, 0x03e03fe1,
-  0xff87ff3e, 0x3cf0f3cf, 0xdf3e7cfb, 0xe3cf1f3e, 0x3c7cf9f3, 0xe3cfcf0f,
-  0x3e3c7ff1, 0xff83fe03, 0xe0000000, 0x1e1fe7fb, 0xfff3fcff, 0x3fcff3fc,
-  0xff3fcff3, 0xfcff3fcf, 0xffdfe7f8, 0x78000000, 0x1f01ff07, 0xfe3ff8f1,
-  0xf3c3cfcf, 0x1f3e7cf8, 0xf1f3e3cf, 0x1f7cf9f3, 0xefcf3c3c, 0xf1f3ff87,
-  0xfe1ff01f, 0x00000000, 0x0ff07ff9, 0xfff3ffff, 0x99fe13fc, 0x87f99fff,
-  0xfcfff9ff, 0xe0ff0000,
-  // Font Bytes: 3104
+  0x01540155, 0x54155545, 0x555555a5, 0x555a5555, 0xa5555a55, 0x55a5555a,
+  0x5555a555, 0x555555a5, 0x555a5555, 0x55515554, 0x15554015, 0x40000000,
+  0x01555005, 0x55554155, 0x55515555, 0x5555a695, 0x5569a555, 0x5a695556,
+  0x9a555555, 0x55455555, 0x41555550, 0x05554000, 0x00555400, 0x15555500,
+  0x55555405, 0x55555415, 0x69a55155, 0xa695555a, 0xaa95556a, 0xaa555569,
+  0xa55556aa, 0xa5555aaa, 0x95555a69, 0x551569a5, 0x50555555, 0x40555554,
+  0x01555550, 0x00555400, 0x00054000, 0x05554005, 0x55554155, 0x55541556,
+  0x555556aa, 0x5555aaa5, 0x555a6555, 0x55aa9555, 0x56aa5555, 0x56a5555a,
+  0xaa5555aa, 0x95555565, 0x54155555, 0x41555550, 0x01555400, 0x00540000,
+  0x00545500, 0x15555541, 0x55555505, 0x55555555, 0x65695556, 0xa5a5555a,
+  0x9a555559, 0xa5541556, 0x95505569, 0x554155a6, 0x55555a6a, 0x5555a5a9,
+  0x55569595, 0x55555555, 0x05555554, 0x15555540, 0x05515000, 0x00554000,
+  0x15555001, 0x55555005, 0x55554055, 0x6a554156, 0xaa55455a, 0x6955155a,
+  0x9555556a, 0x6955569a, 0xa5555a5a, 0x55556aaa, 0x55556a69, 0x54555555,
+  0x51555555, 0x01555554, 0x00555500, 0x00155000, 0x55554055, 0x55501555,
+  0x55155a95, 0x455a9555, 0x56955156, 0x95545555, 0x54055554, 0x01555400,
+  0x05500000, 0x00055000, 0x15554015, 0x55501555, 0x55055695, 0x45569551,
+  0x56955155, 0xa55455a5, 0x54156954, 0x055a5501, 0x56954055, 0xa554155a,
+  0x55415695, 0x50556955, 0x05569541, 0x55555015, 0x55500155, 0x54000550,
+  0x00000000, 0x01540005, 0x55500155, 0x55015555, 0x5055a554, 0x155a5541,
+  0x55a55055, 0x69550556, 0x954055a5, 0x50156954, 0x055a5505, 0x56954556,
+  0x955155a5, 0x5155a554, 0x55a55415, 0x55550155, 0x55005555, 0x00015400,
+  0x00000000, 0x00555400, 0x15555500, 0x55555405, 0x55555415, 0x69a55155,
+  0x6a55555a, 0xaa955556, 0xa5551569, 0xa5505555, 0x55405555, 0x54015555,
+  0x50005554, 0x00000000, 0x00055000, 0x00555500, 0x00555500, 0x01555540,
+  0x15569554, 0x15569554, 0x55569555, 0x55aaaa55, 0x55aaaa55, 0x55569555,
+  0x15569554, 0x15569554, 0x01555540, 0x00555500, 0x00555500, 0x00055000,
+  0x00155000, 0x55554055, 0x55501555, 0x55155a95, 0x455a9555, 0x56955156,
+  0x95545555, 0x54055554, 0x01555400, 0x05500000, 0x01555401, 0x55555415,
+  0x55554555, 0x555555aa, 0xa5555aaa, 0x55555555, 0x51555554, 0x15555540,
+  0x15554000, 0x00550005, 0x55501555, 0x54155554, 0x55695555, 0xaa555569,
+  0x55155554, 0x15555405, 0x55500055, 0x00000000, 0x00005500, 0x00155540,
+  0x00555500, 0x05555500, 0x15695401, 0x55a55005, 0x5a554055, 0x69540156,
+  0x9550155a, 0x550055a5, 0x54055695, 0x40156955, 0x0155a550, 0x055a5540,
+  0x15695400, 0x55555000, 0x55550001, 0x55540000, 0x55000000, 0x00155000,
+  0x05555400, 0x55555405, 0x55555415, 0x5a955155, 0xaa95555a, 0x56955569,
+  0x5a5555a6, 0x69555699, 0xa5555a56, 0x9555695a, 0x55556aa5, 0x54556a55,
+  0x41555555, 0x01555550, 0x01555500, 0x00554000, 0x00054000, 0x55540155,
+  0x54055555, 0x15565515, 0x5a55556a, 0x5555aa55, 0x555a5515, 0x5a55155a,
+  0x55055a55, 0x055a5505, 0x5a550555, 0x55015554, 0x01555400, 0x15400000,
+  0x00555400, 0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a,
+  0x56955555, 0x5a551555, 0xa554555a, 0x554155a5, 0x55155a55, 0x5555aaa9,
+  0x5556aaa5, 0x55555555, 0x45555554, 0x15555550, 0x05555400, 0x01555500,
+  0x55555541, 0x55555515, 0x55555555, 0xaaa95556, 0xaaa55555, 0x5a554555,
+  0xa554155a, 0xa554556a, 0xa5555556, 0x9555695a, 0x5555aaa9, 0x5555aa95,
+  0x51555555, 0x05555554, 0x05555540, 0x01555000, 0x00055400, 0x01555500,
+  0x15555400, 0x55555405, 0x56a55015, 0x6a954155, 0xaa55055a, 0x69545569,
+  0xa5515696, 0x95555aaa, 0x95556aaa, 0x555555a5, 0x54555695, 0x41555555,
+  0x00555550, 0x00155540, 0x00055000, 0x01555500, 0x55555541, 0x55555515,
+  0x55555555, 0xaaa95556, 0xaaa5555a, 0x5555556a, 0xa95555aa, 0xa9555555,
+  0xa5555556, 0x9555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554,
+  0x05555540, 0x01555000, 0x00555400, 0x15555501, 0x55555505, 0x55555455,
+  0x6aa55556, 0xaaa5555a, 0x56955569, 0x555555a6, 0xa55556aa, 0xa5555a56,
+  0x9555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540,
+  0x01555000, 0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556,
+  0xaaa55555, 0x56954555, 0x69551555, 0xa550055a, 0x55405569, 0x54015695,
+  0x50155a55, 0x0055a554, 0x01555540, 0x01555500, 0x05555000, 0x01540000,
+  0x00555400, 0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a,
+  0x56955569, 0x5a55556a, 0xa55556aa, 0xa5555a56, 0x9555695a, 0x5555aaa9,
+  0x5555aa95, 0x51555555, 0x05555554, 0x05555540, 0x01555000, 0x00555400,
+  0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569,
+  0x5a5555aa, 0xa95555a9, 0xa5555556, 0x9555695a, 0x5555aaa9, 0x5555aa95,
+  0x51555555, 0x05555554, 0x05555540, 0x01555000, 0x00550005, 0x55501555,
+  0x54155554, 0x55695555, 0xaa555569, 0x55155554, 0x15555415, 0x55545569,
+  0x5555aa55, 0x55695515, 0x55541555, 0x54055550, 0x00550000, 0x00154000,
+  0x55550055, 0x55501555, 0x54155a55, 0x455aa551, 0x55a55415, 0x55540555,
+  0x55015555, 0x5155a954, 0x55a95555, 0x69551569, 0x55455555, 0x40555540,
+  0x15554000, 0x55000000, 0x00015400, 0x01555400, 0x55554015, 0x55550555,
+  0xa5515569, 0x55155a55, 0x45569554, 0x55a55505, 0x56955415, 0x5a554155,
+  0x69550555, 0xa5501555, 0x55005555, 0x40015554, 0x00015400, 0x01555401,
+  0x55555415, 0x55554555, 0x555555aa, 0xa5555aaa, 0x55555555, 0x555aaa55,
+  0x55aaa555, 0x55555515, 0x55554155, 0x55540155, 0x54000000, 0x01540001,
+  0x55540015, 0x55500555, 0x554055a5, 0x55055695, 0x54155a55, 0x41556955,
+  0x0555a551, 0x55695515, 0x5a554556, 0x955455a5, 0x55055555, 0x40155550,
+  0x01555400, 0x01540000, 0x01555001, 0x55555015, 0x55554555, 0x555455aa,
+  0x95555aaa, 0x555555a5, 0x51556955, 0x155a5541, 0x56955415, 0x69550155,
+  0x55401569, 0x54015695, 0x40155554, 0x00555500, 0x05555000, 0x05500000,
+  0x00155400, 0x05555500, 0x55555505, 0x55555415, 0x5aa55555, 0xaaa5555a,
+  0x55955565, 0x6a555596, 0xa9555659, 0x6555596a, 0x9555696a, 0x55556955,
+  0x54556a55, 0x41555555, 0x01555540, 0x01555500, 0x00554000, 0x00555400,
+  0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569,
+  0x5a5555aa, 0xa95556aa, 0xa5555a56, 0x9555695a, 0x5555a569, 0x555695a5,
+  0x55555555, 0x45555554, 0x15555550, 0x05515400, 0x01555000, 0x55555401,
+  0x55555415, 0x55555055, 0xaa955156, 0xaa95455a, 0x5a551569, 0x695455aa,
+  0xa55556aa, 0xa5555a56, 0x9555695a, 0x5555aaa9, 0x5556aa95, 0x55555555,
+  0x05555554, 0x15555540, 0x05555000, 0x00555400, 0x15555501, 0x55555505,
+  0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569, 0x555555a5, 0x55515695,
+  0x55455a55, 0x5555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554,
+  0x05555540, 0x01555000, 0x01555000, 0x55555401, 0x55555415, 0x55555455,
+  0xaa955156, 0xaa95555a, 0x5a955569, 0x5a5555a5, 0x69555695, 0xa5555a56,
+  0x9555696a, 0x5555aaa5, 0x5556aa55, 0x45555555, 0x05555550, 0x15555500,
+  0x05554000, 0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556,
+  0xaaa5555a, 0x55555569, 0x555455aa, 0xa55156aa, 0x95455a55, 0x55156955,
+  0x5555aaa9, 0x5556aaa5, 0x55555555, 0x45555554, 0x15555550, 0x05555400,
+  0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556, 0xaaa5555a,
+  0x55555569, 0x555455aa, 0xa55156aa, 0x95455a55, 0x55156955, 0x5055a555,
+  0x41569550, 0x05555500, 0x05555000, 0x15554000, 0x05500000, 0x00555400,
+  0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569,
+  0x555555a6, 0xa955569a, 0xa5555a56, 0x9555695a, 0x5555aaa9, 0x5555aaa5,
+  0x51555555, 0x45555554, 0x05555550, 0x01555400, 0x01545500, 0x55555541,
+  0x55555515, 0x55555555, 0xa5695556, 0x95a5555a, 0x56955569, 0x5a5555aa,
+  0xa95556aa, 0xa5555a56, 0x9555695a, 0x5555a569, 0x555695a5, 0x55555555,
+  0x45555554, 0x15555550, 0x05515400, 0x01555401, 0x55555415, 0x55554555,
+  0x555555aa, 0xa5555aaa, 0x55555a55, 0x5155a554, 0x155a5541, 0x55a55415,
+  0x5a554555, 0xa55555aa, 0xa5555aaa, 0x55555555, 0x51555554, 0x15555540,
+  0x15554000, 0x00155500, 0x05555540, 0x15555501, 0x55555505, 0x5aa95415,
+  0x6aa55055, 0x56954055, 0x5a551555, 0x69545555, 0xa5555556, 0x9555695a,
+  0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540, 0x01555000,
+  0x01545500, 0x55555541, 0x55555515, 0x55555555, 0xa5695556, 0x9695555a,
+  0x6955156a, 0x955455aa, 0x9541569a, 0x55455a5a, 0x55156969, 0x5555a569,
+  0x555695a5, 0x55555555, 0x45555554, 0x15555550, 0x05515400, 0x01540000,
+  0x55550001, 0x55540015, 0x55540055, 0xa5500156, 0x9540055a, 0x55001569,
+  0x540055a5, 0x55015695, 0x55455a55, 0x55156955, 0x5555aaa9, 0x5556aaa5,
+  0x55555555, 0x45555554, 0x15555550, 0x05555400, 0x01545500, 0x55555541,
+  0x55555515, 0x55555555, 0xa5695556, 0x95a5555a, 0x9a95556a, 0x6a5555aa,
+  0xa9555699, 0xa5555a66, 0x9555695a, 0x5555a569, 0x555695a5, 0x55555555,
+  0x45555554, 0x15555550, 0x05515400, 0x01545500, 0x55555541, 0x55555515,
+  0x55555555, 0xa5695556, 0x95a5555a, 0x9695556a, 0x5a5555aa, 0x6955569a,
+  0xa5555a5a, 0x9555696a, 0x5555a569, 0x555695a5, 0x55555555, 0x45555554,
+  0x15555550, 0x05515400, 0x00555400, 0x15555501, 0x55555505, 0x55555455,
+  0x6aa55556, 0xaaa5555a, 0x56955569, 0x5a5555a5, 0x69555695, 0xa5555a56,
+  0x9555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540,
+  0x01555000, 0x01555400, 0x55555501, 0x55555515, 0x55555455, 0xaaa55556,
+  0xaaa5555a, 0x56955569, 0x5a5555aa, 0xa95556aa, 0x95555a55, 0x55156955,
+  0x5455a555, 0x41569550, 0x05555500, 0x05555000, 0x15554000, 0x05500000,
+  0x00555400, 0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a,
+  0x56955569, 0x5a5555a5, 0x69555695, 0xa5555a56, 0x9555695a, 0x5555aaa9,
+  0x5555aa95, 0x5155a955, 0x4555aa55, 0x0555a954, 0x05555550, 0x05555500,
+  0x05555400, 0x01550000, 0x01555400, 0x55555501, 0x55555515, 0x55555455,
+  0xaaa55556, 0xaaa5555a, 0x56955569, 0x5a5555aa, 0xa55556aa, 0x55455a5a,
+  0x55156969, 0x5555a569, 0x555695a5, 0x55555555, 0x45555554, 0x15555550,
+  0x05515400, 0x00555400, 0x15555501, 0x55555505, 0x55555455, 0x6aa55556,
+  0xaaa5555a, 0x5695556a, 0x5555556a, 0x9550556a, 0x9555555a, 0x9555695a,
+  0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540, 0x01555000,
+  0x01555540, 0x15555554, 0x15555554, 0x55555555, 0x55aaaa55, 0x55aaaa55,
+  0x55569555, 0x15569554, 0x15569554, 0x01569540, 0x01569540, 0x01569540,
+  0x01569540, 0x01569540, 0x01555540, 0x00555500, 0x00555500, 0x00055000,
+  0x01545500, 0x55555541, 0x55555515, 0x55555555, 0xa5695556, 0x95a5555a,
+  0x56955569, 0x5a5555a5, 0x69555695, 0xa5555a56, 0x9555695a, 0x5555aaa9,
+  0x5555aa95, 0x51555555, 0x05555554, 0x05555540, 0x01555000, 0x01545500,
+  0x55555541, 0x55555515, 0x55555555, 0xa5695556, 0x95a5555a, 0x56955569,
+  0x5a5555a5, 0x69555695, 0xa555569a, 0x55455a69, 0x54155a95, 0x50156a55,
+  0x00555554, 0x00555540, 0x01555500, 0x00554000, 0x01545500, 0x55555541,
+  0x55555515, 0x55555555, 0xa5695556, 0x95a5555a, 0x56955569, 0x5a5555a5,
+  0x69555699, 0xa5555a66, 0x95556aaa, 0x5555a9a9, 0x55559595, 0x51555555,
+  0x05555554, 0x05555540, 0x01515000, 0x01545500, 0x55555541, 0x55555515,
+  0x55555555, 0xa5695556, 0x95a55556, 0x9a55455a, 0x6954155a, 0x9550556a,
+  0x5541569a, 0x55155a69, 0x5555a569, 0x555695a5, 0x55555555, 0x45555554,
+  0x15555550, 0x05515400, 0x01545500, 0x55555541, 0x55555515, 0x55555555,
+  0xa5695556, 0x95a5555a, 0x56955569, 0x5a5555aa, 0xa95555aa, 0x95515569,
+  0x550555a5, 0x54055695, 0x40055a55, 0x00155554, 0x00155540, 0x00555500,
+  0x00154000, 0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556,
+  0xaaa55555, 0x56954555, 0x69551556, 0x95505569, 0x55455695, 0x55156955,
+  0x5555aaa9, 0x5556aaa5, 0x55555555, 0x45555554, 0x15555550, 0x05555400,
+  0x01555005, 0x55554155, 0x55515555, 0x5555aa95, 0x556aa555, 0x5a555556,
+  0x955455a5, 0x55156954, 0x055a5501, 0x56954055, 0xa5551569, 0x55455a55,
+  0x5556aa55, 0x55aa9555, 0x55555155, 0x55505555, 0x54015550, 0x00000000,
+  0x01540000, 0x55550001, 0x55540015, 0x55540055, 0xa5500156, 0x95500556,
+  0x9540055a, 0x5540155a, 0x55001569, 0x55005569, 0x540055a5, 0x540155a5,
+  0x50015695, 0x50055695, 0x40055a55, 0x00155554, 0x00155540, 0x00555500,
+  0x00154000, 0x01555005, 0x55554155, 0x55515555, 0x5555aa95, 0x556aa555,
+  0x55695455, 0x5a551556, 0x954055a5, 0x50156954, 0x055a5515, 0x56954555,
+  0xa5555569, 0x5556aa55, 0x55aa9555, 0x55555155, 0x55505555, 0x54015550,
+  0x00000000, 0x00154000, 0x15554005, 0x55550155, 0x5554155a, 0x554556a9,
+  0x5555a5a5, 0x55595655, 0x55555551, 0x55555415, 0x55554015, 0x05400000,
+  0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556, 0xaaa55555,
+  0x55554555, 0x55541555, 0x55500555, 0x54000000, 0x01550005, 0x55540155,
+  0x55415555, 0x5055a955, 0x155a9541, 0x55a55455, 0x5a550555, 0x55405555,
+  0x40055550, 0x00154000, 0x00555400, 0x15555500, 0x55555505, 0x55555415,
+  0x6aa55455, 0xaaa55155, 0x5695555a, 0xaa5555a5, 0x695556aa, 0xa55556a6,
+  0x95455555, 0x55155555, 0x50155555, 0x40055550, 0x00000000, 0x01540000,
+  0x55550001, 0x55540015, 0x55550055, 0xa5554156, 0x9555455a, 0x55551569,
+  0xa95555aa, 0xa9555695, 0xa5555a56, 0x9555695a, 0x5555aaa9, 0x55569a95,
+  0x55555555, 0x05555554, 0x15555540, 0x05555000, 0x00555400, 0x15555501,
+  0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569, 0x555555a5,
+  0x695556aa, 0xa55556aa, 0x55455555, 0x54155555, 0x50155555, 0x00055540,
+  0x00000000, 0x00005500, 0x00155540, 0x00555500, 0x15555505, 0x55695455,
+  0x55a55155, 0x5695555a, 0x9a5555aa, 0xa9555695, 0xa5555a56, 0x9555695a,
+  0x5555aaa9, 0x5555a9a5, 0x51555555, 0x45555554, 0x05555550, 0x01555400,
+  0x00555400, 0x15555501, 0x55555505, 0x55555455, 0x6aa55556, 0xaaa5555a,
+  0x5695556a, 0xaa5555a5, 0x555556aa, 0x954556aa, 0x55055555, 0x54155555,
+  0x40155555, 0x00055540, 0x00000000, 0x00155400, 0x05555500, 0x55555501,
+  0x55555415, 0x5aa55455, 0xaaa55156, 0x9695555a, 0x555555aa, 0xa55156aa,
+  0x95455695, 0x55055a55, 0x50156955, 0x4055a550, 0x01555540, 0x01555400,
+  0x05555000, 0x01540000, 0x00555500, 0x15555541, 0x55555505, 0x55555555,
+  0x6a695556, 0xaaa5555a, 0x56955569, 0x5a5555aa, 0xa95555a9, 0xa5555556,
+  0x9555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540,
+  0x01555000, 0x01540000, 0x55550001, 0x55540015, 0x55550055, 0xa5554156,
+  0x9555455a, 0x55551569, 0xa95555aa, 0xa9555695, 0xa5555a56, 0x9555695a,
+  0x5555a569, 0x555695a5, 0x55555555, 0x45555554, 0x15555550, 0x05515400,
+  0x00154001, 0x55540155, 0x54055555, 0x155a5515, 0x5a555555, 0x5555aa55,
+  0x55aa5555, 0x5a55155a, 0x55155a55, 0x055a5505, 0x5a550555, 0x55015554,
+  0x01555400, 0x15400000, 0x00015400, 0x01555400, 0x15554005, 0x55550155,
+  0xa550155a, 0x55055555, 0x5055aa55, 0x055aa550, 0x555a5515, 0x55a55155,
+  0x5a555555, 0xa5555a5a, 0x5555aaa5, 0x5556a955, 0x15555541, 0x55555405,
+  0x55550005, 0x55000000, 0x01540000, 0x55550001, 0x55540015, 0x55550055,
+  0xa5554156, 0x9555055a, 0x55551569, 0x695455a6, 0x955156a9, 0x55055aa5,
+  0x551569a5, 0x5455a5a5, 0x555695a5, 0x55555555, 0x45555554, 0x15555550,
+  0x05515400, 0x01540015, 0x55401555, 0x40555550, 0x55a55055, 0xa55055a5,
+  0x5055a550, 0x55a55055, 0xa55455a5, 0x5455a555, 0x55aa5555, 0x6a551555,
+  0x55155554, 0x05555400, 0x55400000, 0x01555400, 0x55555501, 0x55555515,
+  0x55555455, 0xa9a55556, 0xaaa5555a, 0x66955569, 0x9a5555a6, 0x69555699,
+  0xa5555a56, 0x95555555, 0x55155555, 0x50555555, 0x40154550, 0x00000000,
+  0x01555400, 0x55555501, 0x55555515, 0x55555455, 0xa6a55556, 0xaaa5555a,
+  0x56955569, 0x5a5555a5, 0x69555695, 0xa5555a56, 0x95555555, 0x55155555,
+  0x50555555, 0x40154550, 0x00000000, 0x00555400, 0x15555501, 0x55555505,
+  0x55555455, 0x6aa55556, 0xaaa5555a, 0x56955569, 0x5a5555a5, 0x695556aa,
+  0xa55556aa, 0x55455555, 0x54155555, 0x50155555, 0x00055540, 0x00000000,
+  0x01555400, 0x55555501, 0x55555515, 0x55555455, 0xa6a55556, 0xaaa5555a,
+  0x56955569, 0x5a5555aa, 0xa955569a, 0x95555a55, 0x55156955, 0x5455a555,
+  0x41569550, 0x05555500, 0x05555000, 0x15554000, 0x05500000, 0x00555500,
+  0x15555541, 0x55555505, 0x55555555, 0x6a695556, 0xaaa5555a, 0x56955569,
+  0x5a5555aa, 0xa95555a9, 0xa5515556, 0x9545555a, 0x55055569, 0x540155a5,
+  0x50015555, 0x40015554, 0x00055550, 0x00015400, 0x01555400, 0x55555501,
+  0x55555515, 0x55555455, 0xa6a55556, 0xaaa5555a, 0x56955569, 0x555555a5,
+  0x55515695, 0x55455a55, 0x50155554, 0x00155540, 0x00555500, 0x00154000,
+  0x00000000, 0x00555500, 0x15555541, 0x55555505, 0x55555555, 0x6aa95556,
+  0xaaa5555a, 0x5555555a, 0xa9555555, 0x695556aa, 0xa5555aaa, 0x55555555,
+  0x54155555, 0x50555555, 0x00155540, 0x00000000, 0x00550000, 0x15554000,
+  0x55554005, 0x55555015, 0x69554155, 0xa555455a, 0xaa55156a, 0xa9545569,
+  0x555055a5, 0x55515696, 0x95455aaa, 0x55155aa5, 0x54155555, 0x40555555,
+  0x00555550, 0x00155400, 0x01545500, 0x55555541, 0x55555515, 0x55555555,
+  0xa5695556, 0x95a5555a, 0x56955569, 0x5a5555a5, 0x695556aa, 0xa55556a6,
+  0x95455555, 0x55155555, 0x50155555, 0x40055550, 0x00000000, 0x01545500,
+  0x55555541, 0x55555515, 0x55555555, 0xa5695556, 0x95a5555a, 0x5695555a,
+  0x69551569, 0xa550556a, 0x554055a9, 0x54015555, 0x50015555, 0x00055554,
+  0x00015500, 0x00000000, 0x01545500, 0x55555541, 0x55555515, 0x55555555,
+  0xa5695556, 0x95a5555a, 0x66955569, 0x9a5555aa, 0xa95556a6, 0xa5555656,
+  0x55455555, 0x54155555, 0x50155555, 0x00054540, 0x00000000, 0x01545500,
+  0x55555541, 0x55555515, 0x55555555, 0xa5695555, 0xa6955155, 0xa9550556,
+  0xa554155a, 0x955155a6, 0x95555a56, 0x95555555, 0x55155555, 0x50555555,
+  0x40154550, 0x00000000, 0x01545500, 0x55555541, 0x55555515, 0x55555555,
+  0xa5695556, 0x95a5555a, 0x56955569, 0x5a5555aa, 0xa95555a9, 0xa5555556,
+  0x9555695a, 0x5555aaa9, 0x5555aa95, 0x51555555, 0x05555554, 0x05555540,
+  0x01555000, 0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556,
+  0xaaa55555, 0x5a554556, 0xa5545569, 0x555556aa, 0xa5555aaa, 0x95555555,
+  0x55155555, 0x50555555, 0x40155550, 0x00000000, 0x00055400, 0x05555401,
+  0x55554015, 0x55550556, 0xa55055aa, 0x55055a55, 0x5155a554, 0x155a5545,
+  0x56a55055, 0xa9550556, 0xa550155a, 0x554155a5, 0x54055a55, 0x5055aa55,
+  0x0556a550, 0x15555501, 0x55554005, 0x55540005, 0x54000000, 0x01540155,
+  0x54155545, 0x555555a5, 0x555a5555, 0xa5555a55, 0x55a5555a, 0x5555a555,
+  0x5a5555a5, 0x555a5555, 0xa5555a55, 0x55555155, 0x54155540, 0x15400000,
+  0x01550001, 0x55550015, 0x55540555, 0x554055a9, 0x55055aa5, 0x50555a55,
+  0x0155a554, 0x155a5540, 0x55a95505, 0x56a55055, 0xa955155a, 0x554155a5,
+  0x54555a55, 0x055aa550, 0x55a95505, 0x55554015, 0x55540155, 0x55000155,
+  0x00000000, 0x00555500, 0x15555541, 0x55555505, 0x55555555, 0x69695556,
+  0xa9a5555a, 0x6a955569, 0x69555555, 0x55505555, 0x55415555, 0x54005555,
+  0x00000000,
+  // Font Bytes: 5932
 
   0x00000000
 };
@@ -496,156 +699,270 @@ const uint32_t font_medium_normal[] = {
   0x00000000
 };
 
-// Font: medium-normal-outline (neep-alt-iso8859-1-10x20.bdf)
-const uint32_t font_medium_normal_outline[] = {
+// Font: medium-normal-combined (neep-alt-iso8859-1-10x20.bdf)
+const uint32_t font_medium_normal_combined[] = {
 
   // Font Info: width=10 height=20 descent=4
   0x0004140a,
 
   // Glyph Info:
-  0x44dcc000, 0x62d4a005, 0x7490e00a, 0x6cd0c012, 0x74d0c01a, 0x7490e023,
-  0x5ad4a02b, 0x5dd8a02f, 0x5dd4a037, 0x6b51403f, 0x73514045, 0x5ad2204b,
-  0x6a11804f, 0x4a9a0053, 0x7590a056, 0x74d0c060, 0x5cd4c069, 0x74d0c070,
-  0x74d0c079, 0x74d0c082, 0x74d0c08b, 0x74d0c094, 0x74d0c09d, 0x74d0c0a6,
-  0x74d0c0af, 0x4c5920b8, 0x5cd120bd, 0x645500c4, 0x731140cb, 0x645500d1,
-  0x64d4c0d8, 0x6cd0c0e0, 0x74d0c0e8, 0x74d0c0f1, 0x74d0c0fa, 0x74d0c103,
-  0x74d0c10c, 0x74d0c115, 0x74d0c11e, 0x74d0c127, 0x64d4c130, 0x74d0c138,
-  0x74d0c141, 0x74d0c14a, 0x74d0c153, 0x74d0c15c, 0x74d0c165, 0x74d0c16e,
-  0x7550c177, 0x74d0c181, 0x74d0c18a, 0x74d0c193, 0x74d0c19c, 0x74d0c1a5,
-  0x74d0c1ae, 0x74d0c1b7, 0x74d0c1c0, 0x74d0c1c9, 0x65d4a1d2, 0x7590a1db,
-  0x65d4a1e5, 0x72d0c1ee, 0x721281f3, 0x5ad4a1f7, 0x73d141fb, 0x74d0c202,
-  0x73d1420b, 0x74d0c212, 0x73d1421b, 0x74d0c222, 0x74d1422b, 0x74d0c234,
-  0x54d4c23d, 0x6dd0c243, 0x74d0c24d, 0x5cd8c256, 0x73d1425d, 0x73d14264,
-  0x73d1426b, 0x74d14272, 0x74d1427b, 0x73d14284, 0x73d1428b, 0x7490e292,
-  0x73d1429a, 0x73d142a1, 0x73d142a8, 0x73d142af, 0x74d142b6, 0x73d142bf,
-  0x6dd0a2c6, 0x459ca2d0, 0x6dd4a2d6, 0x7290e2e0,
+  0x44dcc000, 0x62d4a00a, 0x7490e013, 0x6cd0c023, 0x74d0c033, 0x7490e044,
+  0x5ad4a054, 0x5dd8a05c, 0x5dd4a06c, 0x6b51407c, 0x73514087, 0x5ad22093,
+  0x6a11809b, 0x4a9a00a2, 0x7590a0a8, 0x74d0c0bc, 0x5cd4c0cd, 0x74d0c0db,
+  0x74d0c0ec, 0x74d0c0fd, 0x74d0c10e, 0x74d0c11f, 0x74d0c130, 0x74d0c141,
+  0x74d0c152, 0x4c592163, 0x5cd1216d, 0x6455017b, 0x73114188, 0x64550193,
+  0x64d4c1a0, 0x6cd0c1af, 0x74d0c1bf, 0x74d0c1d0, 0x74d0c1e1, 0x74d0c1f2,
+  0x74d0c203, 0x74d0c214, 0x74d0c225, 0x74d0c236, 0x64d4c247, 0x74d0c256,
+  0x74d0c267, 0x74d0c278, 0x74d0c289, 0x74d0c29a, 0x74d0c2ab, 0x74d0c2bc,
+  0x7550c2cd, 0x74d0c2e0, 0x74d0c2f1, 0x74d0c302, 0x74d0c313, 0x74d0c324,
+  0x74d0c335, 0x74d0c346, 0x74d0c357, 0x74d0c368, 0x65d4a379, 0x7590a38b,
+  0x65d4a39f, 0x72d0c3b1, 0x721283bb, 0x5ad4a3c2, 0x73d143ca, 0x74d0c3d8,
+  0x73d143e9, 0x74d0c3f7, 0x73d14408, 0x74d0c416, 0x74d14427, 0x74d0c438,
+  0x54d4c449, 0x6dd0c455, 0x74d0c468, 0x5cd8c479, 0x73d14487, 0x73d14495,
+  0x73d144a3, 0x74d144b1, 0x74d144c2, 0x73d144d3, 0x73d144e1, 0x7490e4ef,
+  0x73d144ff, 0x73d1450d, 0x73d1451b, 0x73d14529, 0x74d14537, 0x73d14548,
+  0x6dd0a556, 0x459ca569, 0x6dd4a574, 0x7290e587,
 
   // Bitmap Data:
-  0x3c7effe7, 0xe7e7e7e7, 0xe7e7e7e7, 0xffe7e7e7, 0xff7e3c00, 0x3fc7feff,
-  0xfe67e67e, 0x67e67e67, 0xfff7fe3f, 0xc0000000, 0x0fc07f83, 0xff0edc7b,
-  0x7bedfe01, 0xf807fb7f, 0xedfe01f8, 0x07fb7ded, 0xe3b70ffc, 0x1fe03f00,
-  0x07007c07, 0xf07bc7df, 0x783f94fc, 0xbff1f3c7, 0x9f1ffa7e, 0x53f83df7,
-  0xc7bc1fc0, 0x7c01c000, 0x1e70ffe7, 0xfffcf7e1, 0x9fb6fe13, 0xbc9e7ef0,
-  0xf3c3df9e, 0x4f721fdb, 0x7e61fbcf, 0xfff9ffc3, 0x9e000000, 0x1f80ff07,
-  0xfe3c3ce6, 0x7399ce4f, 0x3c7ef1ff, 0x927e61f9, 0xcfe73fc8, 0x7789cfff,
-  0x1ff83fc0, 0x0f83f8ff, 0x9c779ee7, 0xbde778fe, 0x0f80e000, 0x0380f83f,
-  0x8f73cef3, 0xdcf79ce7, 0x9ce39c73, 0x8e71ce39, 0xe79c73cf, 0x3cf38f70,
-  0xfe0f80e0, 0x380f83f8, 0x778e79e7, 0x9e71cf3c, 0xe39c738e, 0x71ce39cf,
-  0x39cf79de, 0x7b9e778f, 0xe0f80e00, 0x1dc1ff1f, 0xfceee727, 0x7c7f80ff,
-  0x1f7273bb, 0x9ffc7fc1, 0xdc000000, 0x07803f01, 0xfe0f3c7c, 0xfbf3fe01,
-  0xff3f7cf8, 0xf3c1fe03, 0xf0078000, 0x0f83f8ff, 0x9c779ee7, 0xbde778fe,
-  0x0f80e000, 0x3fe3ffbf, 0xffc07e03, 0xfffdffc7, 0xfc000000, 0x1c1f1fde,
-  0xfe3f1fde, 0xfe3e0e00, 0x007003e0, 0x1fc0f703, 0x9c1ef073, 0x83de0e70,
-  0x7bc1ce0f, 0x7839c1ef, 0x07383de0, 0xe703bc0e, 0xe03f807c, 0x00e00000,
-  0x07803f01, 0xfe0f3c78, 0x7bccfe79, 0xf9e7e79f, 0x927e79f9, 0xe7e79fcc,
-  0xf7878f3c, 0x1fe03f00, 0x78000000, 0x0380f83f, 0x8f73cef1, 0xfc3f27fc,
-  0xef9cf38e, 0x71ce39c7, 0x38e71fe1, 0xf81e0000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7ff9, 0xdfe73f3c, 0x79e3cf1e, 0x78f3f39f, 0xee7ff807, 0xfffdffe3,
-  0xff000000, 0x3ff1ffef, 0xfff807ff, 0x9dfcf3e7, 0x8f3c3878, 0xfcf3f9df,
-  0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80, 0xfc000000, 0x03e01fc0, 0xff878e1c,
-  0x38f4e393, 0x9ece733b, 0xdcee73f8, 0x07ff3dfc, 0xe3f381ce, 0x07f80fc0,
-  0x1e000000, 0x3ff1ffef, 0xfff807e7, 0xff9fee7f, 0x381ee73f, 0xfe77f9df,
-  0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80, 0xfc000000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e7f, 0xf9fee47b, 0x8cfe79f9, 0xe7e79f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3ff1ffef, 0xfff807ff, 0x9dfe73f3, 0xc3ce0e78, 0x79c1cf0f,
-  0x3839e1e7, 0x073c1ce0, 0x7f80fc01, 0xe0000000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e79, 0xf9e7f33d, 0xe1ef33f9, 0xe7e79f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x0fc07f83, 0xff1e1ef3, 0x3f9e7e79, 0xf9e7e79f, 0xcc7789df,
-  0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80, 0xfc000000, 0x1c1f1fde, 0xfe3f1fde,
-  0xfe3e3fbd, 0xfc7e3fbd, 0xfc7c1c00, 0x0701f07f, 0x1ef38e71, 0xcf78fe0f,
-  0x83f8ff9c, 0x779ee7bd, 0xe778fe0f, 0x80e00000, 0x01c03e07, 0xf0f71e73,
-  0xcf79ef3c, 0xe78f3c79, 0xe3cf1e70, 0xf707f03e, 0x01c00000, 0x3ff1ffef,
-  0xfff807e0, 0x1fffffff, 0xf807e01f, 0xfff7ff8f, 0xfc000000, 0x3807c0fe,
-  0x0ef0e78f, 0x3c79e3cf, 0x1e73cf79, 0xef3ce78e, 0xf0fe07c0, 0x38000000,
-  0x3f87fcff, 0xee0ffe77, 0xe73cf79e, 0x73c73873, 0x87387f87, 0x38738738,
-  0x7f83f01e, 0x00000000, 0x0fc0ff0f, 0xfcf0ff33, 0xf3dfbefd, 0xc7ecbf6d,
-  0xfb6fd97e, 0xe3f3ffcf, 0xcf0e3ff0, 0xff03f000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e79, 0xf9e7e79f, 0x807e79f9, 0xe7e79f9e, 0x7e79f9e7, 0xfffdffe3,
-  0xcf000000, 0x3f81ff0f, 0xfe383ce6, 0x7b9cee73, 0xb9cee67b, 0x81ee73f9,
-  0xe7e79f9e, 0x7e73f81e, 0xfff1ff83, 0xfc000000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e7f, 0xf9fee7f3, 0x9c0e7f39, 0xfee7ff9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3f81ff0f, 0xfe383ce6, 0x7b9cfe79, 0xf9e7e79f, 0x9e7e79f9,
-  0xe7e79f9c, 0xfe67b83c, 0xffe1ff03, 0xf8000000, 0x3ff1ffef, 0xfff807e7,
-  0xff9fee7f, 0x39f8e7f3, 0x81ce7f39, 0xf8e7f39f, 0xee7ff807, 0xfffdffe3,
-  0xff000000, 0x3ff1ffef, 0xfff807e7, 0xff9fee7f, 0x39f8e7f3, 0x81ce7f39,
-  0xf8e7c39c, 0x0e7039c0, 0xff01f803, 0xc0000000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e7f, 0xf9fee7ff, 0x987e79f9, 0xe7e79f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3cf1ffef, 0xfff9e7e7, 0x9f9e7e79, 0xf9e7e79f, 0x807e79f9,
-  0xe7e79f9e, 0x7e79f9e7, 0xfffdffe3, 0xcf000000, 0x3fc7feff, 0xfe07f9f7,
-  0x9e39c39c, 0x39c39c39, 0xc39c39c7, 0x9ef9fe07, 0xfff7fe3f, 0xc0000000,
-  0x07f03fe1, 0xffc7071f, 0x9c3e7079, 0xc0e7039c, 0x0e73f9df, 0xe7ff9f9e,
-  0x7f33de1e, 0x3ff07f80, 0xfc000000, 0x3cf1ffef, 0xfff9e7e7, 0x3f99ee4f,
-  0x3878e0e3, 0x93ce6739, 0x9ee73b9c, 0xfe79f9e7, 0xfffdffe3, 0xcf000000,
-  0x3c01f80f, 0xf039c0e7, 0x039c0e70, 0x39c0e703, 0x9c0e7039, 0xc0e7f39f,
-  0xee7ff807, 0xfffdffe3, 0xff000000, 0x3cf1ffef, 0xfff9e7e7, 0x9f8c7e31,
-  0xf807e49f, 0x927e79f9, 0xe7e79f9e, 0x7e79f9e7, 0xfffdffe3, 0xcf000000,
-  0x3cf1ffef, 0xfff9e7e7, 0x9f8e7e39, 0xf867e59f, 0x927e69f9, 0x87e71f9c,
-  0x7e79f9e7, 0xfffdffe3, 0xcf000000, 0x0fc07f83, 0xff1e1ef3, 0x3f9e7e79,
-  0xf9e7e79f, 0x9e7e79f9, 0xe7e79f9e, 0x7f33de1e, 0x3ff07f80, 0xfc000000,
-  0x3fc1ff8f, 0xff381ee7, 0x3f9e7e79, 0xf9e7e79f, 0x9cfe07b9, 0xfce7e39f,
-  0x0e7039c0, 0xff01f803, 0xc0000000, 0x0fc07f83, 0xff1e1ef3, 0x3f9e7e79,
-  0xf9e7e79f, 0x9e7e79f9, 0xe7e79f92, 0x7f03de1e, 0x3e7c7c70, 0xffc0fe01,
-  0xf0000000, 0x3fc1ff8f, 0xff381ee7, 0x3f9e7e79, 0xf9e7e79f, 0x9cfe07b8,
-  0x7ce4f399, 0xee73f9e7, 0xfffdffe3, 0xcf000000, 0x0fc07f83, 0xff1e1ef3,
-  0x3f9e7e7f, 0xf9fef3f1, 0xe1e3f3df, 0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3ff1ffef, 0xfff807fc, 0xfdf3e3cf, 0x07381ce0, 0x7381ce07,
-  0x381ce073, 0x81ce0738, 0x1fe03f00, 0x78000000, 0x3cf1ffef, 0xfff9e7e7,
-  0x9f9e7e79, 0xf9e7e79f, 0x9e7e79f9, 0xe7e79f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3cf1ffef, 0xfff9e7e7, 0x9f9e7e79, 0xf9e7e79f, 0x9e7f7bdc,
-  0xce7b78e1, 0xc3cf0738, 0x1fe03f00, 0x78000000, 0x3cf1ffef, 0xfff9e7e7,
-  0x9f9e7e79, 0xf9e7e79f, 0x927e49f9, 0x27e49f80, 0x7e31fdef, 0x7ff8ffc1,
-  0xce000000, 0x3cf1ffef, 0xfff9e7e7, 0x9fccf733, 0x9e1e3870, 0xf3c3871e,
-  0x1e733bcc, 0xfe79f9e7, 0xfffdffe3, 0xcf000000, 0x3cf1ffef, 0xfff9e7e7,
-  0x9f9e7e79, 0xf9e7f33d, 0xe1e3cf07, 0x381ce073, 0x81ce0738, 0x1fe03f00,
-  0x78000000, 0x3ff1ffef, 0xfff807ff, 0x9dfcf3f3, 0x839e1e70, 0xf3c39e1e,
-  0x7073f3cf, 0xee7ff807, 0xfffdffe3, 0xff000000, 0x3fc7feff, 0xfe07e7fe,
-  0x7ee7ce70, 0xe70e70e7, 0x0e70e70e, 0x70e70e70, 0xe7ce7ee7, 0xfe07fff7,
-  0xfe3fc000, 0x3801f00f, 0xe03bc0e7, 0x03de0738, 0x1ef039c0, 0xf781ce07,
-  0xbc0e703d, 0xe07381ef, 0x039c0f70, 0x1dc07f00, 0xf801c000, 0x3fc7feff,
-  0xfe07fe77, 0xe73e70e7, 0x0e70e70e, 0x70e70e70, 0xe70e70e7, 0x3e77e7fe,
-  0x7e07fff7, 0xfe3fc000, 0x07803f01, 0xfe0f3c78, 0x7bccfe79, 0xfbf7fffd,
-  0xf3e38700, 0x3ff1ffef, 0xfff807e0, 0x1ffff7ff, 0x8ffc0000, 0x3e0fe3fe,
-  0x71cf3cf3, 0x8f78f70f, 0xe0f80e00, 0x1fc0ff87, 0xff1c1e7f, 0x3cfe7781,
-  0xfce7e79f, 0x9e7e71fc, 0x277ffcff, 0xe1ff0000, 0x3c01f80f, 0xf039c0e7,
-  0xc39f8e7f, 0x391ee33f, 0x9e7e79f9, 0xe7e79f9e, 0x7e33f91e, 0xfff1ff83,
-  0xfc000000, 0x0fe07fc3, 0xff9e0ff3, 0x9f9ffe7f, 0xb9fce7fb, 0x9fff39de,
-  0x0f3ff87f, 0xc0fe0000, 0x00f007e0, 0x3fc0e70f, 0x9c7e73f9, 0xde27f31f,
-  0x9e7e79f9, 0xe7e79f9e, 0x7f31de27, 0x3ffc7fe0, 0xff000000, 0x0fc07f83,
-  0xff1e1ef3, 0x3f9e7e79, 0xf807e7ff, 0x9fff39de, 0x0f3ff87f, 0xc0fe0000,
-  0x07e03fc1, 0xff8f0f79, 0x9dcff73f, 0x9cfcf3fb, 0x80ef3f9c, 0xfc73e1ce,
-  0x07381ce0, 0x7f80fc01, 0xe0000000, 0x0ff07fe3, 0xffde27f3, 0x1f9e7e79,
-  0xf9e7e79f, 0xcc7789df, 0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80, 0xfc000000,
-  0x3c01f80f, 0xf039c0e7, 0xc39f8e7f, 0x391ee33f, 0x9e7e79f9, 0xe7e79f9e,
-  0x7e79f9e7, 0xfffdffe3, 0xcf000000, 0x0f07e3fc, 0xe739de7f, 0xff87f9de,
-  0x739ce739, 0xce739ce7, 0x3fc7e0f0, 0x01e01f81, 0xfe0e7073, 0x879c7fe3,
-  0x871f3879, 0xc1ce0e70, 0x73839cfc, 0xefe7ff3f, 0x39fc9ef1, 0xe3fe0fe0,
-  0x3e000000, 0x3c01f80f, 0xf039c0e7, 0xe39fce7f, 0xb9cee67b, 0x93ce1e38,
-  0x78e4f399, 0xee73f9e7, 0xfffdffe3, 0xcf000000, 0x3c0fc3fc, 0x738e71ce,
-  0x39c738e7, 0x1ce39c73, 0x8e79cfbc, 0xfbc73fe3, 0xf83e0000, 0x3fe1ffcf,
-  0xffba4fe4, 0x9f927e49, 0xf927e49f, 0x927e49f9, 0xe7fffdff, 0xe3cf0000,
-  0x3fc1ff8f, 0xff391ee3, 0x3f9e7e79, 0xf9e7e79f, 0x9e7e79f9, 0xe7fffdff,
-  0xe3cf0000, 0x0fc07f83, 0xff1e1ef3, 0x3f9e7e79, 0xf9e7e79f, 0x9e7f33de,
-  0x1e3ff07f, 0x80fc0000, 0x3fc1ff8f, 0xff391ee3, 0x3f9e7e79, 0xf9e7e79f,
-  0x8cfe47b9, 0xfce7e39f, 0x0e7039c0, 0xff01f803, 0xc0000000, 0x0ff07fe3,
-  0xffde27f3, 0x1f9e7e79, 0xf9e7e79f, 0xcc7789cf, 0xe71f9c3e, 0x7039c0e7,
-  0x03fc07e0, 0x0f000000, 0x3fe1ffcf, 0xffb90fe3, 0x9f9ffe7f, 0xb9fce703,
-  0x9c0e7039, 0xc0ff01f8, 0x03c00000, 0x1fe0ffc7, 0xffbc0fe7, 0x9f9fff1f,
-  0x9f1e7f3f, 0xfe7e79fc, 0x0f7ff8ff, 0xc1fe0000, 0x1e00fc07, 0xf81cf873,
-  0xf3cfee03, 0xbcfe73f1, 0xcf873f1c, 0xfe73fde6, 0x73c3c7fe, 0x0ff01f80,
-  0x3cf1ffef, 0xfff9e7e7, 0x9f9e7e79, 0xf9e7e79f, 0x9e7f31de, 0x273ffc7f,
-  0xe0ff0000, 0x3cf1ffef, 0xfff9e7e7, 0x9f9e7f7b, 0xdcce7b78, 0xe1c3cf07,
-  0x381fe03f, 0x00780000, 0x3cf1ffef, 0xfff9e7e7, 0x9f9e7e49, 0xf927e49f,
-  0x807e31fd, 0xef7ff8ff, 0xc1ce0000, 0x3cf1ffef, 0xfff9e7e7, 0x9fccf787,
-  0x8f3c787b, 0xccfe79f9, 0xe7fffdff, 0xe3cf0000, 0x3cf1ffef, 0xfff9e7e7,
-  0x9f9e7e79, 0xf9e7e79f, 0xcc7789df, 0xe7ff9f9e, 0x7f33de1e, 0x3ff07f80,
-  0xfc000000, 0x3ff1ffef, 0xfff807ff, 0x9dfcf3e7, 0x8f3c79f3, 0xcfee7ff8,
-  0x07fffdff, 0xe3ff0000, 0x03e03f83, 0xfe3c71cf, 0x8e787383, 0x9c3ce3e7,
-  0x3e79c78f, 0x9e3e70f3, 0x839c1ce0, 0xe7873e3c, 0x70ff83f8, 0x0f800000,
-  0x3c7effe7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7ff, 0x7e3c0000,
-  0x3e03f83f, 0xe1c78f9c, 0x3ce0e707, 0x3839e1cf, 0x8f3e3c73, 0xcf9cf8e7,
-  0x873839c3, 0xce3e71c7, 0x8ff83f80, 0xf8000000, 0x1ef0ffe7, 0xfffce7e5,
-  0x9f9a7e73, 0xfffe7ff0, 0xf7800000,
-  // Font Bytes: 2964
+  0x05501554, 0x55555695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x55555695, 0x56955695, 0x55551554, 0x05500000, 0x05555015, 0x55545555,
+  0x55569695, 0x56969556, 0x96955696, 0x95569695, 0x55555515, 0x55540555,
+  0x50000000, 0x00555000, 0x15554005, 0x55550056, 0x59501565, 0x95455659,
+  0x5556aaa9, 0x556aaa95, 0x55659555, 0x56595556, 0xaaa9556a, 0xaa955565,
+  0x95515659, 0x54056595, 0x00555550, 0x01555400, 0x05550000, 0x00150000,
+  0x15500015, 0x55001565, 0x50155955, 0x156aa555, 0x699a555a, 0x655555a9,
+  0x55055a95, 0x4155a955, 0x55669556, 0x99a5556a, 0xa5515595, 0x50156550,
+  0x01555000, 0x15500001, 0x50000000, 0x01541500, 0x55555415, 0x5555555a,
+  0x559556a9, 0x69556596, 0x5556a9a5, 0x455a6954, 0x15565500, 0x55a55005,
+  0x59554156, 0x9a5515a6, 0xa9555965, 0x955696a9, 0x55655a55, 0x55555541,
+  0x55555005, 0x41540000, 0x01554000, 0x55550015, 0x5554055a, 0xa5505696,
+  0x95056969, 0x50569a55, 0x055a9554, 0x55a95555, 0x69a69556, 0x96a95569,
+  0x5a555695, 0xa5555a6a, 0x95156a69, 0x50555555, 0x01555540, 0x05555000,
+  0x00554005, 0x55405555, 0x415a9515, 0x69545695, 0x45595415, 0x95405554,
+  0x00554000, 0x54000000, 0x00054000, 0x55400555, 0x40559505, 0x5a5455a5,
+  0x515a5515, 0x69505695, 0x415a5405, 0x695015a5, 0x40569501, 0x5a540569,
+  0x54156950, 0x15a55055, 0xa55055a5, 0x40559500, 0x55540055, 0x40005400,
+  0x05400055, 0x40055540, 0x15954056, 0x95415695, 0x41569501, 0x5a55055a,
+  0x54056950, 0x15a54056, 0x95015a54, 0x05695055, 0xa5415a55, 0x15695156,
+  0x95456954, 0x15954055, 0x54005540, 0x00540000, 0x01515001, 0x55550155,
+  0x55505656, 0x5415a695, 0x155a9555, 0x6aaa5555, 0xa95515a6, 0x95056565,
+  0x41555550, 0x15555001, 0x51500000, 0x00154000, 0x05550001, 0x55540055,
+  0xa550155a, 0x554555a5, 0x5556aaa9, 0x5555a555, 0x155a5540, 0x55a55001,
+  0x55540005, 0x55000015, 0x40000000, 0x00554005, 0x55405555, 0x415a9515,
+  0x69545695, 0x45595415, 0x95405554, 0x00554000, 0x54000000, 0x05555405,
+  0x55554555, 0x55555aaa, 0x9556aaa5, 0x55555551, 0x55555015, 0x55500000,
+  0x01500155, 0x01555156, 0x5556a555, 0xa9555954, 0x55540554, 0x00540000,
+  0x00001500, 0x00055400, 0x01555000, 0x55950005, 0x69500156, 0x550015a5,
+  0x40055954, 0x00569500, 0x15655001, 0x5a540055, 0x95400569, 0x50015655,
+  0x0015a540, 0x05595400, 0x56950005, 0x65500056, 0x54000555, 0x40001550,
+  0x00005400, 0x00000000, 0x00154000, 0x05550001, 0x55540055, 0xa550156a,
+  0x95455a5a, 0x55569569, 0x55695695, 0x56956955, 0x69a69556, 0x95695569,
+  0x56955695, 0x69555a5a, 0x55156a95, 0x4055a550, 0x01555400, 0x05550000,
+  0x15400000, 0x00054000, 0x55400555, 0x40559505, 0x5a5455a9, 0x555aa555,
+  0xa695555a, 0x54556950, 0x55a54056, 0x95015a54, 0x05695015, 0xa5405695,
+  0x01555401, 0x55400154, 0x00000000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95555569, 0x51555695, 0x0555a550, 0x15695405,
+  0x5a550156, 0x954055a5, 0x55056955, 0x54569555, 0x556aaa95, 0x55555551,
+  0x55555405, 0x55550000, 0x05555501, 0x55555455, 0x5555556a, 0xaa955555,
+  0x6951555a, 0x55055695, 0x4055a550, 0x056a9540, 0x555a5505, 0x55695155,
+  0x56955555, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000,
+  0x55500000, 0x00055400, 0x01555000, 0x55554015, 0x6a54015a, 0xa540559a,
+  0x540569a5, 0x41565a54, 0x15a5a545, 0x595a5456, 0x95a5556a, 0xaa955555,
+  0xa551555a, 0x540555a5, 0x40015a54, 0x00155540, 0x00555000, 0x01540000,
+  0x05555501, 0x55555455, 0x5555556a, 0xaa955695, 0x55556955, 0x54569555,
+  0x056aa954, 0x5695a555, 0x55569515, 0x55695155, 0x56955555, 0x69556956,
+  0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000, 0x55500000, 0x00555000,
+  0x15554005, 0x55550156, 0xa95455a5, 0xa5556956, 0x95569555, 0x55695554,
+  0x569a9545, 0x6a5a5556, 0x95695569, 0x56955695, 0x69556956, 0x9555a5a5,
+  0x5156a954, 0x05555500, 0x15554000, 0x55500000, 0x05555501, 0x55555455,
+  0x5555556a, 0xaa955555, 0x69515556, 0x950555a5, 0x50055a54, 0x00569540,
+  0x15695001, 0x5a550055, 0xa5400569, 0x54015695, 0x0015a550, 0x015a5400,
+  0x15554000, 0x55500001, 0x54000000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95569569, 0x55695695, 0x55a5a551, 0x56a95455,
+  0xa5a55569, 0x56955695, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500,
+  0x15554000, 0x55500000, 0x00555000, 0x15554005, 0x55550156, 0xa95455a5,
+  0xa5556956, 0x95569569, 0x55695695, 0x56956955, 0x5a5a9515, 0x6a695155,
+  0x56955555, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000,
+  0x55500000, 0x01500155, 0x01555156, 0x5556a555, 0xa9555954, 0x55540554,
+  0x05554559, 0x555a9556, 0xa5556551, 0x55501550, 0x01500000, 0x00150001,
+  0x55001555, 0x01565505, 0x6a5415a9, 0x50559540, 0x55540055, 0x40055540,
+  0x5555415a, 0x95156954, 0x56954559, 0x54159540, 0x55540055, 0x40005400,
+  0x00000000, 0x00015000, 0x05540015, 0x55005595, 0x01569505, 0x5a551569,
+  0x5455a550, 0x56954055, 0xa5501569, 0x54055a55, 0x01569500, 0x55950015,
+  0x55000554, 0x00015000, 0x05555501, 0x55555455, 0x5555556a, 0xaa9556aa,
+  0xa9555555, 0x55555555, 0x556aaa95, 0x56aaa955, 0x55555515, 0x55554055,
+  0x55500000, 0x05400015, 0x50005554, 0x00565500, 0x56954055, 0xa5501569,
+  0x54055a55, 0x01569505, 0x5a551569, 0x5455a550, 0x56954056, 0x55005554,
+  0x00155000, 0x05400000, 0x05554015, 0x55505555, 0x5456aa55, 0x55569515,
+  0x5695055a, 0x55156954, 0x15a55015, 0xa54015a5, 0x4015a540, 0x15554015,
+  0xa54015a5, 0x4015a540, 0x15554005, 0x55000154, 0x00000000, 0x00555000,
+  0x55550055, 0x555055aa, 0x5555a5a5, 0x55a55955, 0x65565559, 0x5a95565a,
+  0x65559659, 0x55659655, 0x59699556, 0x56a555a5, 0x55555a55, 0x5055aa54,
+  0x05555500, 0x55550005, 0x55000000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95569569, 0x55695695, 0x56956955, 0x6aaa9556,
+  0x95695569, 0x56955695, 0x69556956, 0x95569569, 0x55695695, 0x55555551,
+  0x55555405, 0x50550000, 0x05554001, 0x55550055, 0x5554056a, 0xa5505696,
+  0x9545695a, 0x545695a5, 0x45695a54, 0x56969545, 0x6aa95456, 0x95a55569,
+  0x56955695, 0x69556956, 0x955695a5, 0x556aa954, 0x55555501, 0x55554005,
+  0x55500000, 0x00555000, 0x15554005, 0x55550156, 0xa95455a5, 0xa5556956,
+  0x95569555, 0x55695554, 0x56955505, 0x69500056, 0x95550569, 0x55545695,
+  0x55556956, 0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000, 0x55500000,
+  0x05554001, 0x55550055, 0x5554056a, 0xa5505696, 0x9545695a, 0x55569569,
+  0x55695695, 0x56956955, 0x69569556, 0x95695569, 0x56955695, 0x6955695a,
+  0x55569695, 0x456aa550, 0x55555401, 0x55550005, 0x55400000, 0x05555501,
+  0x55555455, 0x5555556a, 0xaa955695, 0x55556955, 0x54569555, 0x05695540,
+  0x56955505, 0x6aa95056, 0x95550569, 0x55405695, 0x55056955, 0x54569555,
+  0x556aaa95, 0x55555551, 0x55555405, 0x55550000, 0x05555501, 0x55555455,
+  0x5555556a, 0xaa955695, 0x55556955, 0x54569555, 0x05695540, 0x56955505,
+  0x6aa95056, 0x95550569, 0x55405695, 0x50056950, 0x00569500, 0x05695000,
+  0x55550001, 0x55400005, 0x50000000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95569555, 0x55695554, 0x56955555, 0x696a9556,
+  0x95695569, 0x56955695, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500,
+  0x15554000, 0x55500000, 0x05505501, 0x55555455, 0x55555569, 0x56955695,
+  0x69556956, 0x95569569, 0x55695695, 0x56956955, 0x6aaa9556, 0x95695569,
+  0x56955695, 0x69556956, 0x95569569, 0x55695695, 0x55555551, 0x55555405,
+  0x50550000, 0x05555015, 0x55545555, 0x5556aa95, 0x55695515, 0x69540569,
+  0x50056950, 0x05695005, 0x69500569, 0x50056950, 0x05695015, 0x69545569,
+  0x5556aa95, 0x55555515, 0x55540555, 0x50000000, 0x00155500, 0x05555401,
+  0x55555015, 0xaa950155, 0x69500556, 0x95001569, 0x50005695, 0x00056950,
+  0x00569505, 0x55695155, 0x56955555, 0x69556956, 0x9555a5a5, 0x5156a954,
+  0x05555500, 0x15554000, 0x55500000, 0x05505501, 0x55555455, 0x55555569,
+  0x56955695, 0xa5556969, 0x54569a55, 0x056a9540, 0x56aa5405, 0x69a55056,
+  0x96950569, 0x69545695, 0xa545695a, 0x55569569, 0x55695695, 0x55555551,
+  0x55555405, 0x50550000, 0x05500001, 0x55400055, 0x55000569, 0x50005695,
+  0x00056950, 0x00569500, 0x05695000, 0x56950005, 0x69500056, 0x95000569,
+  0x50005695, 0x55056955, 0x54569555, 0x556aaa95, 0x55555551, 0x55555405,
+  0x55550000, 0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69556a5a,
+  0x9556a5a9, 0x556aaa95, 0x569a6955, 0x69a69556, 0x95695569, 0x56955695,
+  0x69556956, 0x95569569, 0x55695695, 0x55555551, 0x55555405, 0x50550000,
+  0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69556a56, 0x9556a569,
+  0x556a9695, 0x56996955, 0x69a69556, 0x96695569, 0x6a955695, 0xa955695a,
+  0x95569569, 0x55695695, 0x55555551, 0x55555405, 0x50550000, 0x00555000,
+  0x15554005, 0x55550156, 0xa95455a5, 0xa5556956, 0x95569569, 0x55695695,
+  0x56956955, 0x69569556, 0x95695569, 0x56955695, 0x69556956, 0x9555a5a5,
+  0x5156a954, 0x05555500, 0x15554000, 0x55500000, 0x05555001, 0x55554055,
+  0x5555056a, 0xa9545695, 0xa5556956, 0x95569569, 0x55695695, 0x56956955,
+  0x695a5556, 0xaa954569, 0x55505695, 0x54056955, 0x00569500, 0x05695000,
+  0x55550001, 0x55400005, 0x50000000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95569569, 0x55695695, 0x56956955, 0x69569556,
+  0x95695569, 0x56955695, 0x695569a6, 0x9555aaa5, 0x5156a954, 0x05569550,
+  0x155a9500, 0x55555000, 0x55540001, 0x55000000, 0x05555001, 0x55554055,
+  0x5555056a, 0xa9545695, 0xa5556956, 0x95569569, 0x55695695, 0x56956955,
+  0x695a5556, 0xaa95456a, 0x9550569a, 0x55056969, 0x545695a5, 0x55695695,
+  0x55555551, 0x55555405, 0x50550000, 0x00555000, 0x15554005, 0x55550156,
+  0xa95455a5, 0xa5556956, 0x95569555, 0x55695554, 0x55a55501, 0x56a95405,
+  0x55a55155, 0x56955555, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500,
+  0x15554000, 0x55500000, 0x05555501, 0x55555455, 0x5555556a, 0xaa95555a,
+  0x555155a5, 0x54055a55, 0x0015a540, 0x015a5400, 0x15a54001, 0x5a540015,
+  0xa540015a, 0x540015a5, 0x40015a54, 0x0015a540, 0x01555400, 0x05550000,
+  0x15400000, 0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69556956,
+  0x95569569, 0x55695695, 0x56956955, 0x69569556, 0x95695569, 0x56955695,
+  0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000, 0x55500000,
+  0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69556956, 0x95569569,
+  0x55695695, 0x56956955, 0x69569555, 0x9565515a, 0x5a541565, 0x954056a9,
+  0x50055a55, 0x0015a540, 0x01555400, 0x05550000, 0x15400000, 0x05505501,
+  0x55555455, 0x55555569, 0x56955695, 0x69556956, 0x95569569, 0x55695695,
+  0x56956955, 0x69a69556, 0x9a695569, 0xa695569a, 0x69556aaa, 0x9556a5a9,
+  0x55595655, 0x15555540, 0x55555001, 0x50540000, 0x05505501, 0x55555455,
+  0x55555569, 0x56955695, 0x69555a5a, 0x5515a5a5, 0x4156a954, 0x056a9500,
+  0x55a55005, 0x6a950156, 0xa95415a5, 0xa5455a5a, 0x55569569, 0x55695695,
+  0x55555551, 0x55555405, 0x50550000, 0x05505501, 0x55555455, 0x55555569,
+  0x56955695, 0x69556956, 0x95569569, 0x55695695, 0x55a5a551, 0x56a95405,
+  0x5a550015, 0xa540015a, 0x540015a5, 0x40015a54, 0x0015a540, 0x01555400,
+  0x05550000, 0x15400000, 0x05555501, 0x55555455, 0x5555556a, 0xaa955555,
+  0x6951555a, 0x550555a5, 0x40056954, 0x01569500, 0x55a55005, 0x69540156,
+  0x950015a5, 0x55055a55, 0x54569555, 0x556aaa95, 0x55555551, 0x55555405,
+  0x55550000, 0x05555015, 0x55545555, 0x5556aa95, 0x56955556, 0x95545695,
+  0x50569500, 0x56950056, 0x95005695, 0x00569500, 0x56950056, 0x95005695,
+  0x00569500, 0x56955056, 0x95545695, 0x5556aa95, 0x55555515, 0x55540555,
+  0x50000000, 0x05400001, 0x55000055, 0x54000565, 0x50005695, 0x00055954,
+  0x0015a540, 0x01565500, 0x05695000, 0x55954001, 0x5a540015, 0x65500056,
+  0x95000559, 0x540015a5, 0x40015655, 0x00056950, 0x00559500, 0x01595000,
+  0x15550000, 0x55400001, 0x50000000, 0x05555015, 0x55545555, 0x5556aa95,
+  0x55569515, 0x56950556, 0x95005695, 0x00569500, 0x56950056, 0x95005695,
+  0x00569500, 0x56950056, 0x95005695, 0x05569515, 0x56955556, 0x9556aa95,
+  0x55555515, 0x55540555, 0x50000000, 0x00154000, 0x05550001, 0x55540055,
+  0xa550156a, 0x95455a5a, 0x55569569, 0x55655595, 0x55555551, 0x55055405,
+  0x40150000, 0x05555501, 0x55555455, 0x5555556a, 0xaa9556aa, 0xa9555555,
+  0x55155555, 0x40555550, 0x05540055, 0x54055554, 0x15a95055, 0xa55055a5,
+  0x40559540, 0x55950055, 0x54005540, 0x00540000, 0x01555000, 0x55554015,
+  0x5555015a, 0xa9541555, 0xa5505556, 0x95156aa9, 0x555a5695, 0x56956955,
+  0x69569556, 0x95a9555a, 0xa6951555, 0x55505555, 0x54015555, 0x00000000,
+  0x05500001, 0x55400055, 0x55000569, 0x50005695, 0x50056955, 0x40569555,
+  0x0569a954, 0x56a5a555, 0x69569556, 0x95695569, 0x56955695, 0x69556956,
+  0x9556a5a5, 0x5569a954, 0x55555501, 0x55554005, 0x55500000, 0x00555400,
+  0x15555005, 0x55554156, 0xaa5555a5, 0x69556955, 0x55569555, 0x45695550,
+  0x56955545, 0x69555555, 0xa5695156, 0xaa550555, 0x55401555, 0x50005554,
+  0x00000000, 0x00005500, 0x00155400, 0x05555000, 0x56950055, 0x69501556,
+  0x95055569, 0x5156a695, 0x55a5a955, 0x69569556, 0x95695569, 0x56955695,
+  0x69556956, 0x9555a5a9, 0x5156a695, 0x05555550, 0x15555400, 0x55550000,
+  0x00555000, 0x15554005, 0x55550156, 0xa95455a5, 0xa5556956, 0x95569569,
+  0x556aaa95, 0x56955555, 0x69555555, 0xa5695156, 0xaa550555, 0x55401555,
+  0x50005554, 0x00000000, 0x00155400, 0x05555001, 0x55554055, 0xaa551569,
+  0x69515a55, 0x5515a555, 0x415a5550, 0x55a55545, 0x6aaa5455, 0xa555415a,
+  0x555015a5, 0x54015a54, 0x0015a540, 0x015a5400, 0x15554000, 0x55500001,
+  0x54000000, 0x00555500, 0x15555405, 0x55555156, 0xa69555a5, 0xa9556956,
+  0x95569569, 0x55695695, 0x56956955, 0x5a5a9515, 0x6a695155, 0x56955555,
+  0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500, 0x15554000, 0x55500000,
+  0x05500001, 0x55400055, 0x55000569, 0x50005695, 0x50056955, 0x40569555,
+  0x0569a954, 0x56a5a555, 0x69569556, 0x95695569, 0x56955695, 0x69556956,
+  0x95569569, 0x55695695, 0x55555551, 0x55555405, 0x50550000, 0x00550015,
+  0x54055550, 0x56950569, 0x51569555, 0x55556a95, 0x55695156, 0x95056950,
+  0x56950569, 0x50569505, 0x69505695, 0x05555015, 0x54005500, 0x00015400,
+  0x01554001, 0x55540056, 0x950015a5, 0x40156950, 0x15555405, 0x6a950155,
+  0xa5401569, 0x50015a54, 0x00569500, 0x15a54005, 0x6950555a, 0x54555695,
+  0x5555a555, 0xa569555a, 0x695455a9, 0x54055554, 0x00555400, 0x05540000,
+  0x05500001, 0x55400055, 0x55000569, 0x50005695, 0x54056955, 0x50569555,
+  0x45695a54, 0x56969545, 0x69a55056, 0xa954056a, 0x9540569a, 0x55056969,
+  0x545695a5, 0x55695695, 0x55555551, 0x55555405, 0x50550000, 0x05500055,
+  0x50055550, 0x15a54056, 0x95015a54, 0x05695015, 0xa5405695, 0x015a5405,
+  0x695015a5, 0x40569541, 0x5a55455a, 0x55455a95, 0x05555405, 0x55400554,
+  0x00000000, 0x05555401, 0x55555055, 0x55554566, 0x9a55569a, 0x695569a6,
+  0x95569a69, 0x5569a695, 0x569a6955, 0x69a69556, 0x9a695569, 0x56955555,
+  0x55515555, 0x54055055, 0x00000000, 0x05555001, 0x55554055, 0x55550569,
+  0xa95456a5, 0xa5556956, 0x95569569, 0x55695695, 0x56956955, 0x69569556,
+  0x95695569, 0x56955555, 0x55515555, 0x54055055, 0x00000000, 0x00555000,
+  0x15554005, 0x55550156, 0xa95455a5, 0xa5556956, 0x95569569, 0x55695695,
+  0x56956955, 0x69569555, 0xa5a55156, 0xa9540555, 0x55001555, 0x40005550,
+  0x00000000, 0x05555001, 0x55554055, 0x55550569, 0xa95456a5, 0xa5556956,
+  0x95569569, 0x55695695, 0x56956955, 0x6a5a5556, 0x9a954569, 0x55505695,
+  0x54056955, 0x00569500, 0x05695000, 0x55550001, 0x55400005, 0x50000000,
+  0x00555500, 0x15555405, 0x55555156, 0xa69555a5, 0xa9556956, 0x95569569,
+  0x55695695, 0x56956955, 0x5a5a9515, 0x6a695055, 0x56950155, 0x69500556,
+  0x95000569, 0x50005695, 0x00055550, 0x00155400, 0x00550000, 0x05555401,
+  0x55555055, 0x55554569, 0xaa5556a5, 0x69556955, 0x55569555, 0x45695550,
+  0x56950005, 0x69500056, 0x95000569, 0x50005555, 0x00015540, 0x00055000,
+  0x00000000, 0x01555400, 0x55555015, 0x5555455a, 0xaa555695, 0x69556955,
+  0x5555a955, 0x4155a954, 0x1555a555, 0x55569556, 0x9569555a, 0xaa551555,
+  0x55405555, 0x50015554, 0x00000000, 0x01540000, 0x55500015, 0x5540015a,
+  0x554015a5, 0x55055a55, 0x5456aaa5, 0x455a5554, 0x15a55501, 0x5a554015,
+  0xa555015a, 0x555415a5, 0x55515696, 0x95055aa5, 0x50155554, 0x00555500,
+  0x01554000, 0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69556956,
+  0x95569569, 0x55695695, 0x56956955, 0x69569555, 0xa5a95156, 0xa6950555,
+  0x55501555, 0x54005555, 0x00000000, 0x05505501, 0x55555455, 0x55555569,
+  0x56955695, 0x69556956, 0x95559565, 0x515a5a54, 0x15659540, 0x56a95005,
+  0x5a550015, 0xa5400155, 0x54000555, 0x00001540, 0x00000000, 0x05505501,
+  0x55555455, 0x55555569, 0x56955695, 0x69556956, 0x95569a69, 0x5569a695,
+  0x569a6955, 0x6aaa9556, 0xa5a95559, 0x56551555, 0x55405555, 0x50015054,
+  0x00000000, 0x05505501, 0x55555455, 0x55555569, 0x56955695, 0x69555a5a,
+  0x55156a95, 0x4055a550, 0x156a9545, 0x5a5a5556, 0x95695569, 0x56955555,
+  0x55515555, 0x54055055, 0x00000000, 0x05505501, 0x55555455, 0x55555569,
+  0x56955695, 0x69556956, 0x95569569, 0x55695695, 0x56956955, 0x5a5a9515,
+  0x6a695155, 0x56955555, 0x69556956, 0x9555a5a5, 0x5156a954, 0x05555500,
+  0x15554000, 0x55500000, 0x05555501, 0x55555455, 0x5555556a, 0xaa955555,
+  0x6951555a, 0x55055695, 0x4055a550, 0x15695505, 0x5a555456, 0x9555556a,
+  0xaa955555, 0x55515555, 0x54055555, 0x00000000, 0x00055400, 0x05554005,
+  0x5554055a, 0x95015a55, 0x40569540, 0x15a54005, 0x6950055a, 0x54055695,
+  0x05569541, 0x5a954055, 0x69540556, 0x950055a5, 0x40056950, 0x015a5400,
+  0x56954015, 0xa554055a, 0x95005555, 0x40055540, 0x00554000, 0x05501554,
+  0x55555695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955555, 0x15540550, 0x05540005, 0x55400555,
+  0x54015a95, 0x40556950, 0x055a5400, 0x56950015, 0xa5400569, 0x54015a55,
+  0x4055a554, 0x055a9505, 0x5a55415a, 0x55405695, 0x4015a540, 0x05695005,
+  0x5a540556, 0x95015a95, 0x40555540, 0x05554000, 0x55400000, 0x01545500,
+  0x55555415, 0x5555555a, 0x56955699, 0x69556966, 0x955695a5, 0x55555554,
+  0x15555500, 0x55154000,
+  // Font Bytes: 5696
 
   0x00000000
 };
@@ -735,201 +1052,357 @@ const uint32_t font_medium_bold[] = {
   0x00000000
 };
 
-// Font: medium-bold-outline (neep-alt-iso8859-1-10x20-bold.bdf)
-const uint32_t font_medium_bold_outline[] = {
+// Font: medium-bold-combined (neep-alt-iso8859-1-10x20-bold.bdf)
+const uint32_t font_medium_bold_combined[] = {
 
   // Font Info: width=10 height=20 descent=4
   0x0004140a,
 
   // Glyph Info:
-  0x5d58a000, 0x7b508008, 0x8d0cc00f, 0x854ca01a, 0x8d4ca025, 0x8d0cc031,
-  0x7350803c, 0x76508042, 0x7650804d, 0x840d0058, 0x8c0d0060, 0x734e0069,
-  0x82cd606f, 0x6315e075, 0x8e0c807a, 0x8d4ca087, 0x754ca093, 0x8d4ca09d,
-  0x8d4ca0a9, 0x8d4ca0b5, 0x8d4ca0c1, 0x8d4ca0cd, 0x8d4ca0d9, 0x8d4ca0e5,
-  0x8d4ca0f1, 0x64d500fd, 0x754d0105, 0x7cd0e10f, 0x840d0118, 0x7ccce120,
-  0x7d50a129, 0x8d4ca133, 0x8d4ca13f, 0x8d4ca14b, 0x8d4ca157, 0x8d4ca163,
-  0x8d4ca16f, 0x8d4ca17b, 0x8d4ca187, 0x8d4ca193, 0x7d50a19f, 0x8d4ca1a9,
-  0x8d4ca1b5, 0x8d4ca1c1, 0x8d4ca1cd, 0x8d4ca1d9, 0x8d4ca1e5, 0x8d4ca1f1,
-  0x8e0ca1fd, 0x8d4ca20a, 0x8d4ca216, 0x8d4ca222, 0x8d4ca22e, 0x8d4ca23a,
-  0x8d4ca246, 0x8d4ca252, 0x8d4ca25e, 0x8d4ca26a, 0x7e508276, 0x8e0c8282,
-  0x7e4c828f, 0x834ca29b, 0x8ace62a2, 0x735082a8, 0x8c4d22ae, 0x8d4ca2b8,
-  0x8c4d22c4, 0x8d4ca2ce, 0x8c4d22da, 0x8d4ca2e4, 0x8d4d22f0, 0x8d4ca2fc,
-  0x6d50a308, 0x864ca311, 0x8d4ca31e, 0x7554a32a, 0x8c4d2334, 0x8c4d233e,
-  0x8c4d2348, 0x8d4d2352, 0x8d4d235e, 0x8c4d236a, 0x8c4d2374, 0x8d0cc37e,
-  0x8c4d2389, 0x8c4d2393, 0x8c4d239d, 0x8c4d23a7, 0x8d4d23b1, 0x8c4d23bd,
-  0x864c83c7, 0x5e1883d4, 0x864c83dd, 0x8b4cc3ea,
+  0x5d58a000, 0x7b50800f, 0x8d0cc01c, 0x854ca032, 0x8d4ca047, 0x8d0cc05e,
+  0x73508074, 0x76508080, 0x76508096, 0x840d00ac, 0x8c0d00bc, 0x734e00cd,
+  0x82cd60d9, 0x6315e0e4, 0x8e0c80ed, 0x8d4ca107, 0x754ca11e, 0x8d4ca131,
+  0x8d4ca148, 0x8d4ca15f, 0x8d4ca176, 0x8d4ca18d, 0x8d4ca1a4, 0x8d4ca1bb,
+  0x8d4ca1d2, 0x64d501e9, 0x754d01f8, 0x7cd0e20b, 0x840d021d, 0x7ccce22d,
+  0x7d50a23f, 0x8d4ca253, 0x8d4ca26a, 0x8d4ca281, 0x8d4ca298, 0x8d4ca2af,
+  0x8d4ca2c6, 0x8d4ca2dd, 0x8d4ca2f4, 0x8d4ca30b, 0x7d50a322, 0x8d4ca336,
+  0x8d4ca34d, 0x8d4ca364, 0x8d4ca37b, 0x8d4ca392, 0x8d4ca3a9, 0x8d4ca3c0,
+  0x8e0ca3d7, 0x8d4ca3f1, 0x8d4ca408, 0x8d4ca41f, 0x8d4ca436, 0x8d4ca44d,
+  0x8d4ca464, 0x8d4ca47b, 0x8d4ca492, 0x8d4ca4a9, 0x7e5084c0, 0x8e0c84d8,
+  0x7e4c84f2, 0x834ca50a, 0x8ace6517, 0x73508523, 0x8c4d252f, 0x8d4ca542,
+  0x8c4d2559, 0x8d4ca56c, 0x8c4d2583, 0x8d4ca596, 0x8d4d25ad, 0x8d4ca5c4,
+  0x6d50a5db, 0x864ca5ed, 0x8d4ca606, 0x7554a61d, 0x8c4d2630, 0x8c4d2643,
+  0x8c4d2656, 0x8d4d2669, 0x8d4d2680, 0x8c4d2697, 0x8c4d26aa, 0x8d0cc6bd,
+  0x8c4d26d3, 0x8c4d26e6, 0x8c4d26f9, 0x8c4d270c, 0x8d4d271f, 0x8c4d2736,
+  0x864c8749, 0x5e188762, 0x864c8773, 0x8b4cc78c,
 
   // Bitmap Data:
-  0x1f0ff9ff, 0x7fff1fe3, 0xfc7f8ff1, 0xfe3fc7f8, 0xff1ffffc, 0x7f8ff1ff,
-  0xfdff3fe1, 0xf0000000, 0x1ff0fff9, 0xfff7ffff, 0x11fe23fc, 0x47f88ff1,
-  0x1ffffdff, 0xf3ffe1ff, 0x00000000, 0x07f00ffe, 0x07ff0fff, 0xe7c9f7e4,
-  0xffc01fe0, 0x0ff007fe, 0x4fff27fe, 0x00ff007f, 0x803ff27e, 0xf93e7fff,
-  0x0ffe07ff, 0x00fe0000, 0x03c00ff0, 0x0ff03ffc, 0x7e7e7e7e, 0xf81ff00f,
-  0xf25ff07e, 0xf81f7e0f, 0xfa4ff00f, 0xf81f7e7e, 0x7e7e3ffc, 0x0ff00ff0,
-  0x03c00000, 0x0fbc1fff, 0x9fffcfff, 0xff8e7f82, 0x3fc93fe0, 0x1ef81f3f,
-  0x9f1f8fc7, 0xcfe7c0fb, 0xc03fe49f, 0xe20ff38f, 0xffff9fff, 0xcfffc1ef,
-  0x80000000, 0x0fe01ffc, 0x1fff0fff, 0x8f83e780, 0xf3c679e2, 0x3ef83f7c,
-  0x3ffc09fe, 0x20ff18ff, 0x847fe01e, 0xf84f7fff, 0x9fff87ff, 0xc0ff8000,
-  0x07e07fe1, 0xff8fff3c, 0x3df1f78f, 0xbe7ef3f3, 0xff87fc1f, 0xe01e0000,
-  0x01e01fe0, 0xff87ff3f, 0x3cf8f7c7, 0xde3ef8fb, 0xc7cf1e3c, 0x78f1e3c7,
-  0x8f1e3c7c, 0xf8f9e3e7, 0xc7cf8f3f, 0x3c7ff0ff, 0x81fe01e0, 0x1e01fe07,
-  0xfc3ff8f3, 0xf3c7cf8f, 0x9f1e7c7c, 0xf8f1e3c7, 0x8f1e3c78, 0xf1e3cf8f,
-  0x7c7df1ef, 0x8fbc7cf3, 0xf3ff87fc, 0x1fe01e00, 0x0ff03ffc, 0x3ffc7ffe,
-  0x799e781e, 0xfc3ff00f, 0xf00ffc3f, 0x781e799e, 0x7ffe3ffc, 0x3ffc0ff0,
-  0x03e007fc, 0x03fe03ff, 0x87e3f3f1, 0xfbf8ffe0, 0x0ff007ff, 0x1fdf8fcf,
-  0xc7e1ffc0, 0x7fc03fe0, 0x07c00000, 0x07e07fe1, 0xff8fff3c, 0x3df1f78f,
-  0xbe7ef3f3, 0xff87fc1f, 0xe01e0000, 0x1ff87ffe, 0x7ffeffff, 0xf00ff00f,
-  0xf00fffff, 0x7ffe7ffe, 0x1ff80000, 0x0f03fc7f, 0xe7fef9ff, 0x0ff0ff9f,
-  0x7fe7fe3f, 0xc0f00000, 0x003c007f, 0x807fc03f, 0xf03e781e, 0x3c1f3e0f,
-  0x1e0f9f07, 0x8f07cf83, 0xc783e7c1, 0xe3c1f3e0, 0xf1e0f9f0, 0x78f03cf8,
-  0x1e780ffc, 0x03fc01fe, 0x003c0000, 0x03e007fc, 0x07ff07ff, 0xc7e3f3e0,
-  0xfbe23fe3, 0x8ff1c7f8, 0xe3fc51fe, 0x38ff1c7f, 0x8e3fe23e, 0xf83e7e3f,
-  0x1fff07ff, 0x01ff003e, 0x00000000, 0x01e01fe0, 0xff87ff3f, 0x3df8f7c3,
-  0xfe0ff23f, 0xf8f7e3df, 0x8f1e3c78, 0xf1e3c78f, 0x1e3c7ff0, 0xff83fe03,
-  0xe0000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc61ff7, 0x8f7fc7bf,
-  0xc7cfc7cf, 0xc7e7c7f7, 0xc7fbc7ff, 0xe00ff007, 0xffffdfff, 0xcfffe1ff,
-  0xc0000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3ffe3efe, 0x3e7e3f1e,
-  0x0f8f03ef, 0xf0f7fc7f, 0xde3fc61f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x01f803ff, 0x03ff81ff, 0xe1f0f0f0, 0x78f83c78, 0x1e7c8f3c,
-  0x47be63fe, 0x00ff007f, 0xfc7dfe3c, 0xff1e1f8f, 0x03ff80ff, 0x807fc00f,
-  0x80000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fc7ffe3, 0xfef01f78,
-  0x07fc61ff, 0xf8f7fc7f, 0xde3fc61f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc31fe3, 0xdff1ff78,
-  0x8fbc03fe, 0x10ff1c7f, 0x8e3fc21f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fff1eff, 0x1f7f8f0f,
-  0x8f87c783, 0xc7c3e3c1, 0xe3e1f1e0, 0xf1f078f0, 0x3ff80ff8, 0x07fc00f8,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7fc,
-  0x47df07df, 0x11ff1c7f, 0x8e3fc21f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7f8,
-  0x43fe01ef, 0x88f7fc7f, 0xde3fc61f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x0f03fc7f, 0xe7fef9ff, 0x0ff0ff9f, 0x7fe7fe7f, 0xef9ff0ff,
-  0x0ff9f7fe, 0x7fe3fc0f, 0x00000000, 0x03c03fc1, 0xff87fe3e, 0x7cf0f3c3,
-  0xcf9f1ff8, 0x7fe1ff8f, 0xff3c3df1, 0xf78fbe7e, 0xf3f3ff87, 0xfc1fe01e,
-  0x00000000, 0x00e007f0, 0x1ff07fe1, 0xfbe7e3df, 0x8fbe3ef8, 0xfde3f3e3,
-  0xf3e3e7e3, 0xe7e3c7ef, 0x87fe07fc, 0x07f00380, 0x1ff87ffe, 0x7ffeffff,
-  0xf00ff00f, 0xf00fffff, 0xfffff00f, 0xf00ff00f, 0xffff7ffe, 0x7ffe1ff8,
-  0x0e007f01, 0xff03ff0f, 0xbf1e3f3e, 0x3f3e3e7e, 0x3e7e3df8, 0xfbe3ef8f,
-  0xde3f3efc, 0x3ff07fc0, 0x7f003800, 0x1fe0fff1, 0xfff7ffef, 0x03fe03ff,
-  0xc7bf1f7c, 0x7cf1f9e3, 0xe3c7878f, 0x0ffe1e3c, 0x3c7878f0, 0xffe0ff81,
-  0xff00f800, 0x07f80fff, 0x0fffcfff, 0xe7c0ffc0, 0x3fc79fe7, 0xcff387f9,
-  0x83fcc9fe, 0x64ff307f, 0x9c3fc7ff, 0xf03e7c1f, 0x3fff0fff, 0x03ff807f,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7f8,
-  0xe3fc01fe, 0x00ff1c7f, 0x8e3fc71f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7,
-  0xc0000000, 0x1fe03ffc, 0x1fff1fff, 0xcf03e780, 0xfbc43de3, 0x1ef18f78,
-  0x8fbc03fe, 0x30ff1c7f, 0x8e3fc61f, 0xe01ff01f, 0x7fff9fff, 0x8fff81ff,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc31fe3, 0xdff1ff78,
-  0xffbc7f9e, 0x3fef1ff7, 0x8f7fc31f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f,
-  0x00000000, 0x1fe03ffc, 0x1fff1fff, 0xcf03f780, 0xfbc63fe3, 0x8ff1c7f8,
-  0xe3fc71fe, 0x38ff1c7f, 0x8e3fc63f, 0xe03ef03f, 0x7fff1fff, 0x0fff01fe,
-  0x00000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fc7ffe3, 0xfef1ff78,
-  0x0f3c079e, 0x3fcf1ff7, 0x8ffbc7ff, 0xe00ff007, 0xffffdfff, 0xcfffe1ff,
-  0xc0000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fc7ffe3, 0xfef1ff78,
-  0x0f3c079e, 0x3fcf1fc7, 0x8fe3c7c1, 0xe3c0f1e0, 0x7ff01ff0, 0x0ff801f0,
-  0x00000000, 0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc31fe3, 0xdff1ff78,
-  0xfffc61fe, 0x30ff1c7f, 0x8e3fc31f, 0xf00f7c0f, 0xbfff8fff, 0xc3ffc07f,
-  0x80000000, 0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff1c7f8,
-  0x03fc01fe, 0x38ff1c7f, 0x8e3fc71f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7,
-  0xc0000000, 0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0x1fbe3e7c, 0x7c78f0f1,
-  0xe1e3c7c7, 0xcf8fbf1f, 0xf80ff01f, 0xfffdfff3, 0xffe1ff00, 0x03fc07ff,
-  0x83ffc3ff, 0xf1e078f0, 0x3c7f1e1f, 0x8f0fc787, 0xe3cff1ef, 0xf8f7fc7f,
-  0xde3fc61f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f, 0x00000000, 0x1f7c3fff,
-  0x9fffdfff, 0xff1c7f8c, 0x7fc47de0, 0x7ef07e78, 0x1e3c0f9e, 0x23cf11f7,
-  0x8c7bc63f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7, 0xc0000000, 0x1f003fe0,
-  0x1ff01ffc, 0x0f1e078f, 0x03c781e3, 0xc0f1e078, 0xf03c781e, 0x3f8f1ff7,
-  0x8ffbc7ff, 0xe00ff007, 0xffffdfff, 0xcfffe1ff, 0xc0000000, 0x1f7c3fff,
-  0x9fffdfff, 0xff1c7f8e, 0x3fc21fe1, 0x0ff007f8, 0x03fc51fe, 0x28ff1c7f,
-  0x8e3fc71f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7, 0xc0000000, 0x1f7c3fff,
-  0x9fffdfff, 0xff1c7f8e, 0x3fc31fe1, 0x8ff047f8, 0x23fc01fe, 0x20ff107f,
-  0x8c3fc61f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7, 0xc0000000, 0x07f00ffe,
-  0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7f8, 0xe3fc71fe, 0x38ff1c7f,
-  0x8e3fc21f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f, 0x00000000, 0x1ff03ffe,
-  0x1fff9fff, 0xef01f780, 0x7fc61fe3, 0x8ff1c7f8, 0xc3fc03fe, 0x03ef1ff7,
-  0x8ff3c7f1, 0xe3e0f1e0, 0x7ff01ff0, 0x0ff801f0, 0x00000000, 0x07f00ffe,
-  0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7f8, 0xe3fc71fe, 0x38ff1c7f,
-  0x8e3fc21f, 0xf01f7c1f, 0x3f1fcfc1, 0xe3f0f0ff, 0xf83ff80f, 0xfc01f800,
-  0x1ff03ffe, 0x1fff9fff, 0xef01f780, 0x7fc61fe3, 0x8ff1c7f8, 0xc3fc03fe,
-  0x03ef03f7, 0x88fbc63f, 0xe38ff1e7, 0xffffdfff, 0xcfffe1f3, 0xc0000000,
-  0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc31fe3, 0xdff0ff7c, 0x3f9f07cf,
-  0xe1f7f87f, 0xde3fc61f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f, 0x00000000,
-  0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3ff8fefc, 0x7e7e3f0f, 0x1e078f03,
-  0xc781e3c0, 0xf1e078f0, 0x3c781e3c, 0x0ffe03fe, 0x01ff003e, 0x00000000,
-  0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff1c7f8, 0xe3fc71fe,
-  0x38ff1c7f, 0x8e3fc21f, 0xf01f7c1f, 0x3fff8fff, 0x83ff807f, 0x00000000,
-  0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff1c7f8, 0xe3fc71ff,
-  0x39f788f3, 0xe4f8f078, 0x7c7c1e3c, 0x0ffe03fe, 0x01ff003e, 0x00000000,
-  0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff1c7f8, 0xe3fc71fe,
-  0x28ff147f, 0x803fc01f, 0xe10ff9cf, 0xbfff9fff, 0xc7ffc0f7, 0x80000000,
-  0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fe23ef1, 0x1e7c1f1e, 0x0f0f8f87,
-  0x83c7c1f3, 0xc47be23f, 0xe38ff1c7, 0xffffdfff, 0xcfffe1f7, 0xc0000000,
-  0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff087fc, 0x07df07cf,
-  0xc7e3e3e0, 0xf1e078f0, 0x3c781e3c, 0x0ffe03fe, 0x01ff003e, 0x00000000,
-  0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fff1eff, 0x1f7f1f0f, 0x8f8f8f8f,
-  0x8f87c7f7, 0xc7fbc7ff, 0xe00ff007, 0xffffdfff, 0xcfffe1ff, 0xc0000000,
-  0x1ff0fff9, 0xfff7ffff, 0x01fe03fc, 0x7ff8fef1, 0xfde3e3c7, 0x878f0f1e,
-  0x1e3c3c78, 0x78f8f1fd, 0xe3fbc7ff, 0x80ff01ff, 0xffdfff3f, 0xfe1ff000,
-  0x1e003fc0, 0x1ff01ff8, 0x0f3e078f, 0x03e7c0f1, 0xe07cf81e, 0x3c0f9f03,
-  0xc781f3e0, 0x78f03e7c, 0x0f1e07cf, 0x81e3c0f9, 0xe03cf01f, 0xf807f803,
-  0xfc007800, 0x1ff0fff9, 0xfff7ffff, 0x01fe03ff, 0xc7bf8f7f, 0x1e3e3c3c,
-  0x7878f0f1, 0xe1e3c3c7, 0x8f8f7f1e, 0xfe3ffc7f, 0x80ff01ff, 0xffdfff3f,
-  0xfe1ff000, 0x03c00ff0, 0x1ff83ffc, 0x7e7e7c3e, 0xf81ff18f, 0xf3cfffff,
-  0x7ffe7ffe, 0x1e780000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fc01fff,
-  0xff7fff3f, 0xff87ff00, 0x1f81ff87, 0xfe3ffcf0, 0xf3e3e7c7, 0x9f9f3f3c,
-  0x7ff0ff81, 0xfe01e000, 0x0ff01ffe, 0x0fff8fff, 0xe781f3c0, 0x7dff1ef8,
-  0x0ff807f8, 0xe3fc61fe, 0x00ff847b, 0xfffdfffc, 0x7ffe0ffc, 0x00000000,
-  0x1f003fe0, 0x1ff01ffc, 0x0f1f078f, 0xe3c7f9e3, 0xfef11f78, 0x07fc21fe,
-  0x38ff1c7f, 0x8e3fc21f, 0xe01ff11f, 0x7fff9fff, 0x8fff81ff, 0x00000000,
-  0x07f80fff, 0x0fffcfff, 0xe7c0ffc0, 0x3fc39fe3, 0xfff1ff78, 0xfffc39ff,
-  0x00f7c0fb, 0xfff8fffc, 0x3ffc07f8, 0x00000000, 0x007c00ff, 0x807fc07f,
-  0xf07c78fe, 0x3cff1eff, 0x8f7c47fc, 0x03fc21fe, 0x38ff1c7f, 0x8e3fc21f,
-  0xf00f7c47, 0xbfffcfff, 0xc3ffe07f, 0xc0000000, 0x07f00ffe, 0x0fff8fff,
-  0xe7c1f7c0, 0x7fc71fe0, 0x0ff007f8, 0xfffc39ff, 0x00f7c0fb, 0xfff8fffc,
-  0x3ffc07f8, 0x00000000, 0x03f807ff, 0x07ffc7ff, 0xe3e0fbe0, 0x3de19ef1,
-  0xff78ff7c, 0x7fbc03de, 0x01ef8ff3, 0xc7f1e3f8, 0xf1f078f0, 0x3ff80ff8,
-  0x07fc00f8, 0x00000000, 0x07fc0fff, 0x8fffcfff, 0xf7c47fc0, 0x3fc21fe3,
-  0x8ff1c7f8, 0x43fe01ef, 0x88f7fc7f, 0xde3fc61f, 0xf01f7c1f, 0x3fff8fff,
-  0x83ff807f, 0x00000000, 0x1f003fe0, 0x1ff01ffc, 0x0f1f078f, 0xe3c7f9e3,
-  0xfef11f78, 0x07fc21fe, 0x38ff1c7f, 0x8e3fc71f, 0xe38ff1c7, 0xffffdfff,
-  0xcfffe1f7, 0xc0000000, 0x07c0ff87, 0xfc7ff3c7, 0xbe3df1ff, 0xfff07f83,
-  0xff1ef8f7, 0xc79e3cf1, 0xe78f3c79, 0xffc7fc3f, 0xe07c0000, 0x00f803fe,
-  0x03fe07ff, 0x078f0f8f, 0x0f8f1fff, 0x1e0f1e0f, 0x1f8f0f8f, 0x0f8f0f8f,
-  0x3f8f7f8f, 0x7f8ffb8f, 0xf10ff81f, 0x7c3e7ffe, 0x3ffc1ff8, 0x07e00000,
-  0x1f003fe0, 0x1ff01ffc, 0x0f1f878f, 0xf3c7f9e3, 0xfef18f78, 0x8fbc0f9e,
-  0x0fcf07e7, 0x81fbc47d, 0xe31ff1c7, 0xffffdfff, 0xcfffe1f7, 0xc0000000,
-  0x1f01ff07, 0xfc3ff8f1, 0xe3c78f1e, 0x3c78f1e3, 0xc78f1e3c, 0x78f1fbc7,
-  0xef0ffe0f, 0x7c3dfff3, 0xff87fe07, 0xe0000000, 0x1ff83fff, 0x1fffdfff,
-  0xef24ff80, 0x3fc01fe2, 0x8ff147f8, 0xa3fc51fe, 0x28ff1c7f, 0xfffdfffc,
-  0xfffe1f7c, 0x00000000, 0x1ff03ffe, 0x1fff9fff, 0xef11f780, 0x7fc21fe3,
-  0x8ff1c7f8, 0xe3fc71fe, 0x38ff1c7f, 0xfffdfffc, 0xfffe1f7c, 0x00000000,
-  0x07f00ffe, 0x0fff8fff, 0xe7c1f7c0, 0x7fc21fe3, 0x8ff1c7f8, 0xe3fc21ff,
-  0x01f7c1f3, 0xfff8fff8, 0x3ff807f0, 0x00000000, 0x1ff03ffe, 0x1fff9fff,
-  0xef11f780, 0x7fc21fe3, 0x8ff1c7f8, 0x43fc03fe, 0x23ef1ff7, 0x8ff3c7f1,
-  0xe3e0f1e0, 0x7ff01ff0, 0x0ff801f0, 0x00000000, 0x07fc0fff, 0x8fffcfff,
-  0xf7c47fc0, 0x3fc21fe3, 0x8ff1c7f8, 0x43fe01ef, 0x88f7fc79, 0xfe3c7f1e,
-  0x0f8f03c7, 0x81ffc07f, 0xc03fe007, 0xc0000000, 0x1ff83fff, 0x1fffdfff,
-  0xef10ff80, 0x3fc39fe3, 0xfff1ff78, 0xffbc7f1e, 0x3c0f1e07, 0xff01ff00,
-  0xff801f00, 0x00000000, 0x0ff81fff, 0x1fffcfff, 0xef80ff80, 0x3fc79fe0,
-  0x7ff80fff, 0x83fcf1fe, 0x00ff80fb, 0xfff9fffc, 0x7ffc0ff8, 0x00000000,
-  0x0f801ff0, 0x0ff80fff, 0x078fe3c7, 0xf3e3fde0, 0x1ef00f7c, 0x7f9e3fcf,
-  0x1fe78ffb, 0xc33df01e, 0x7c1f3fff, 0x0fff83ff, 0x807f0000, 0x1f7c3fff,
-  0x9fffdfff, 0xff1c7f8e, 0x3fc71fe3, 0x8ff1c7f8, 0xe3fc21ff, 0x00f7c47b,
-  0xfffcfffc, 0x3ffe07fc, 0x00000000, 0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e,
-  0x3fc71ff3, 0x9f788f3e, 0x4f8f0787, 0xc7c1e3c0, 0xffe03fe0, 0x1ff003e0,
-  0x00000000, 0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e, 0x3fc71fe2, 0x8ff147f8,
-  0x03fc01fe, 0x10ff9cfb, 0xfff9fffc, 0x7ffc0f78, 0x00000000, 0x1f7c3fff,
-  0x9fffdfff, 0xff1c7f8e, 0x3fe23ef8, 0x3e7e3f3e, 0x0fbe23fe, 0x38ff1c7f,
-  0xfffdfffc, 0xfffe1f7c, 0x00000000, 0x1f7c3fff, 0x9fffdfff, 0xff1c7f8e,
-  0x3fc71fe3, 0x8ff1c7f8, 0x43fe01ef, 0x88f7fc7f, 0xde3fc61f, 0xf01f7c1f,
-  0x3fff8fff, 0x83ff807f, 0x00000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80,
-  0x3ffe3efe, 0x3e7e3f3e, 0x3fbe3ffe, 0x00ff007f, 0xfffdfffc, 0xfffe1ffc,
-  0x00000000, 0x01f807fe, 0x0ffe0fff, 0x1f0f1e0f, 0x1e3f1e3e, 0x3e3e7e3c,
-  0x7e3cf87c, 0xf0f8f87c, 0x7e3c7e3c, 0x3e3e1e3e, 0x1e3f1e0f, 0x1f0f0fff,
-  0x0ffe07fe, 0x01f80000, 0x1f0ff9ff, 0x7fff1fe3, 0xfc7f8ff1, 0xfe3fc7f8,
-  0xff1fe3fc, 0x7f8ff1fe, 0x3fc7f8ff, 0xfeff9ff0, 0xf8000000, 0x1f807fe0,
-  0x7ff0fff0, 0xf0f8f078, 0xfc787c78, 0x7c7c3c7e, 0x3c7e3e1f, 0x1f0f3e1f,
-  0x3c7e3c7e, 0x7c7c7c78, 0xfc78f078, 0xf0f8fff0, 0x7ff07fe0, 0x1f800000,
-  0x0ffc1fff, 0x9fffcfff, 0xff8c7f82, 0x3fc01fe2, 0x0ff18fff, 0xff9fffcf,
-  0xffc1ff80,
-  // Font Bytes: 4036
+  0x01550055, 0x55415555, 0x15555555, 0xa95556a5, 0x555a9555, 0x6a5555a9,
+  0x5556a555, 0x5a95556a, 0x5555a955, 0x5555555a, 0x95556a55, 0x55a95555,
+  0x55515555, 0x05555401, 0x55000000, 0x01555500, 0x55555541, 0x55555515,
+  0x55555555, 0xa9a95556, 0xa6a5555a, 0x9a95556a, 0x6a5555a9, 0xa9555555,
+  0x55515555, 0x55055555, 0x54015555, 0x00000000, 0x00155500, 0x00555554,
+  0x00155555, 0x00555555, 0x54155a69, 0x5515569a, 0x55555aaa, 0xa95556aa,
+  0xaa5555aa, 0xaa955556, 0x9a555555, 0xa6955556, 0xaaaa5555, 0xaaaa9555,
+  0x6aaaa555, 0x55a69554, 0x5569a554, 0x15555555, 0x00555554, 0x00155555,
+  0x00005554, 0x00000000, 0x00055000, 0x00555500, 0x00555500, 0x05555550,
+  0x15569554, 0x15569554, 0x556aa955, 0x55aaaa55, 0x55a69955, 0x55aa9554,
+  0x556aa955, 0x1556aa55, 0x55669a55, 0x55aaaa55, 0x556aa955, 0x15569554,
+  0x15569554, 0x05555550, 0x00555500, 0x00555500, 0x00055000, 0x00554550,
+  0x01555555, 0x41555555, 0x50555555, 0x55556a56, 0x95556aa6, 0xa5555a69,
+  0xa55556aa, 0xa954556a, 0xa9550555, 0x69550155, 0x6a555015, 0x5a555415,
+  0x5aaa5545, 0x5aaaa555, 0x569a6955, 0x56a6aa55, 0x55a56a55, 0x55555555,
+  0x41555555, 0x50555555, 0x50015455, 0x40000000, 0x00555400, 0x01555550,
+  0x01555555, 0x00555555, 0x40556aa5, 0x54156aaa, 0x55055a96, 0x954156a6,
+  0xa554556a, 0xa555155a, 0xa555555a, 0xaa695556, 0xa6aa5555, 0xa96a5555,
+  0x6a9a9555, 0x56aaa954, 0x556a9a55, 0x15555555, 0x41555555, 0x40155555,
+  0x50005555, 0x40000000, 0x00155400, 0x15555401, 0x55554055, 0x5555055a,
+  0xa55155a9, 0x55156a55, 0x45569554, 0x55a55505, 0x55554015, 0x55500155,
+  0x54000154, 0x00000000, 0x00015400, 0x01555400, 0x55554015, 0x55550555,
+  0xa550556a, 0x55155a95, 0x5156a554, 0x556a5545, 0x5a955055, 0xa954055a,
+  0x954055a9, 0x54055a95, 0x4055a954, 0x055a9550, 0x556a5541, 0x56a55415,
+  0x5a955055, 0x6a550555, 0xa5501555, 0x55005555, 0x40015554, 0x00015400,
+  0x01540001, 0x55540015, 0x55500555, 0x554055a5, 0x55055a95, 0x50556a55,
+  0x4155a954, 0x155a9550, 0x556a5501, 0x56a55015, 0x6a550156, 0xa550156a,
+  0x550156a5, 0x50556a55, 0x155a9551, 0x55a95455, 0x6a55455a, 0x955055a5,
+  0x55055555, 0x40155550, 0x01555400, 0x01540000, 0x00555500, 0x05555550,
+  0x05555550, 0x15555554, 0x15696954, 0x156aa954, 0x555aa555, 0x55aaaa55,
+  0x55aaaa55, 0x555aa555, 0x156aa954, 0x15696954, 0x15555554, 0x05555550,
+  0x05555550, 0x00555500, 0x00055400, 0x00155550, 0x00055554, 0x00055555,
+  0x401556a5, 0x550555a9, 0x5545556a, 0x555556aa, 0xaa5555aa, 0xaa955555,
+  0xa9555155, 0x6a555055, 0x5a955401, 0x55555000, 0x15555000, 0x05555400,
+  0x00155000, 0x00155400, 0x15555401, 0x55554055, 0x5555055a, 0xa55155a9,
+  0x55156a55, 0x45569554, 0x55a55505, 0x55554015, 0x55500155, 0x54000154,
+  0x00000000, 0x01555540, 0x15555554, 0x15555554, 0x55555555, 0x55aaaa55,
+  0x55aaaa55, 0x55aaaa55, 0x55555555, 0x15555554, 0x15555554, 0x01555540,
+  0x00550005, 0x55501555, 0x54155554, 0x55695555, 0xaa5555aa, 0x55556955,
+  0x15555415, 0x55540555, 0x50005500, 0x00000550, 0x00001555, 0x40001555,
+  0x50000555, 0x55000556, 0x95400156, 0xa5500155, 0xa5540055, 0xa9540055,
+  0x69550015, 0x6a550015, 0x5a554005, 0x5a954005, 0x56955001, 0x56a55001,
+  0x55a55400, 0x55a95400, 0x55695500, 0x156a5500, 0x055a5540, 0x01569540,
+  0x00555550, 0x00055550, 0x00015554, 0x00000550, 0x00000000, 0x00055400,
+  0x00155550, 0x00155555, 0x00155555, 0x501556a5, 0x550556aa, 0x554556a6,
+  0xa55556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a, 0x99a95556, 0xa56a5555,
+  0xa95a9555, 0x6a56a555, 0x56a6a554, 0x556aa554, 0x1556a555, 0x01555555,
+  0x00155555, 0x00015555, 0x00000554, 0x00000000, 0x00015400, 0x01555400,
+  0x55554015, 0x55550555, 0xa551556a, 0x55155aa5, 0x5556aa55, 0x55a6a555,
+  0x556a5515, 0x56a55155, 0x6a550156, 0xa550156a, 0x550156a5, 0x50156a55,
+  0x0156a550, 0x15555500, 0x55554005, 0x55540005, 0x54000000, 0x00155500,
+  0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa, 0x95555a96,
+  0xa9555595, 0x6a551555, 0x5a954555, 0x5a955055, 0x5a955055, 0x5a955415,
+  0x5a955515, 0x5a955545, 0x5a955555, 0x56aaaa55, 0x55aaaa95, 0x55555555,
+  0x51555555, 0x50555555, 0x54015555, 0x50000000, 0x01555550, 0x05555555,
+  0x41555555, 0x51555555, 0x5555aaaa, 0x95556aaa, 0xa5555556, 0xa5545556,
+  0xa5541556, 0xa5550156, 0xaa554055, 0xaaa55455, 0x55aa5515, 0x555a9555,
+  0x5956a555, 0x5a96a955, 0x55aaa955, 0x155aa955, 0x05555555, 0x40555555,
+  0x40055555, 0x40001555, 0x00000000, 0x00015540, 0x00055555, 0x00055555,
+  0x40015555, 0x540155aa, 0x550055aa, 0x9540556a, 0xa550156a, 0xa954155a,
+  0x6a55055a, 0x9a954556, 0x96a55556, 0xaaaa5555, 0xaaaa9555, 0x555a9551,
+  0x5556a550, 0x5555a954, 0x01556a55, 0x00055555, 0x40005555, 0x40001555,
+  0x50000055, 0x40000000, 0x01555550, 0x05555555, 0x41555555, 0x51555555,
+  0x5555aaaa, 0x95556aaa, 0xa5555a95, 0x555556a5, 0x555455aa, 0xa955156a,
+  0xaa95555a, 0x96a95555, 0x556a5515, 0x555a9555, 0x5956a555, 0x5a96a955,
+  0x55aaa955, 0x155aa955, 0x05555555, 0x40555555, 0x40055555, 0x40001555,
+  0x00000000, 0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9,
+  0x55155aaa, 0x95555aa5, 0xa95556a5, 0x595555a9, 0x5555156a, 0x6a55455a,
+  0xaaa55556, 0xa9aa5555, 0xa95a9555, 0x6a56a555, 0x5aa6a955, 0x55aaa955,
+  0x155aa955, 0x05555555, 0x40555555, 0x40055555, 0x40001555, 0x00000000,
+  0x01555550, 0x05555555, 0x41555555, 0x51555555, 0x5555aaaa, 0x95556aaa,
+  0xa5555555, 0xa9545555, 0xa9551555, 0x6a550055, 0x6a554015, 0x5a954005,
+  0x5a955005, 0x56a55001, 0x56a55401, 0x55a95400, 0x55a95500, 0x156a5500,
+  0x05555540, 0x00555540, 0x00155550, 0x00005540, 0x00000000, 0x00155500,
+  0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa, 0x95555aa6,
+  0xa95556a5, 0x6a5555a9, 0x5a95555a, 0x9a955155, 0xaa955155, 0xa9a95555,
+  0xa95a9555, 0x6a56a555, 0x5aa6a955, 0x55aaa955, 0x155aa955, 0x05555555,
+  0x40555555, 0x40055555, 0x40001555, 0x00000000, 0x00155500, 0x00555554,
+  0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa, 0x95555aa6, 0xa95556a5,
+  0x6a5555a9, 0x5a95556a, 0x9aa55556, 0xaaa95455, 0x6a6a5515, 0x555a9555,
+  0x5956a555, 0x5a96a955, 0x55aaa955, 0x155aa955, 0x05555555, 0x40555555,
+  0x40055555, 0x40001555, 0x00000000, 0x00550005, 0x55501555, 0x54155554,
+  0x55695555, 0xaa5555aa, 0x55556955, 0x15555415, 0x55541555, 0x54556955,
+  0x55aa5555, 0xaa555569, 0x55155554, 0x15555405, 0x55500055, 0x00000000,
+  0x00055000, 0x05555001, 0x55554015, 0x55540556, 0x955055aa, 0x55055aa5,
+  0x50556955, 0x01555540, 0x15555401, 0x55554055, 0x5555055a, 0xa55155a9,
+  0x55156a55, 0x45569554, 0x55a55505, 0x55554015, 0x55500155, 0x54000154,
+  0x00000000, 0x00005400, 0x00155500, 0x01555500, 0x15555401, 0x55655415,
+  0x56a55155, 0x6a554556, 0xa554556a, 0x555156a5, 0x550556a5, 0x550556a5,
+  0x541556a5, 0x541556a5, 0x50155655, 0x40155554, 0x00155550, 0x00155500,
+  0x00054000, 0x01555540, 0x15555554, 0x15555554, 0x55555555, 0x55aaaa55,
+  0x55aaaa55, 0x55aaaa55, 0x55555555, 0x55555555, 0x55aaaa55, 0x55aaaa55,
+  0x55aaaa55, 0x55555555, 0x15555554, 0x15555554, 0x01555540, 0x00540000,
+  0x15550001, 0x55550005, 0x55550055, 0x65550156, 0xa5550556, 0xa5550556,
+  0xa5541556, 0xa5541556, 0xa551556a, 0x554556a5, 0x54556a55, 0x5156a555,
+  0x05565550, 0x05555500, 0x15555000, 0x15550000, 0x05400000, 0x01555400,
+  0x55555501, 0x55555515, 0x55555455, 0xaaa55556, 0xaaa55555, 0x5a954555,
+  0xa955155a, 0x955055a9, 0x554156a5, 0x54055a95, 0x40156a55, 0x00555554,
+  0x0156a550, 0x055a9540, 0x156a5500, 0x55555400, 0x55554001, 0x55550000,
+  0x55400000, 0x00155540, 0x00555555, 0x00555555, 0x50555555, 0x54155aaa,
+  0x55555aaa, 0xa5555a95, 0x69555695, 0x5a5555a5, 0x6a955569, 0x6aa5555a,
+  0x5a695556, 0x969a5555, 0xa5aa9555, 0x695aa555, 0x5a955555, 0x55aaa554,
+  0x155aa955, 0x05555555, 0x00555555, 0x00055555, 0x40001555, 0x00000000,
+  0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa,
+  0x95555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a, 0xaaa95556,
+  0xaaaa5555, 0xa95a9555, 0x6a56a555, 0x5a95a955, 0x56a56a55, 0x55a95a95,
+  0x55555555, 0x51555555, 0x50555555, 0x54015515, 0x50000000, 0x01555400,
+  0x05555550, 0x01555555, 0x01555555, 0x5055aaa5, 0x54156aaa, 0x55455a9a,
+  0xa55156a5, 0xa95455a9, 0x6a55156a, 0x6a55455a, 0xaaa55556, 0xa5aa5555,
+  0xa95a9555, 0x6a56a555, 0x5a96a955, 0x56aaa955, 0x55aaa955, 0x15555555,
+  0x41555555, 0x40555555, 0x40015555, 0x00000000, 0x00155500, 0x00555554,
+  0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa, 0x95555aa5, 0xa95556a5,
+  0x595555a9, 0x5555156a, 0x5555455a, 0x95554156, 0xa5555455, 0xa9555515,
+  0x6a559555, 0x5aa5a955, 0x55aaa955, 0x155aa955, 0x05555555, 0x40555555,
+  0x40055555, 0x40001555, 0x00000000, 0x01555400, 0x05555550, 0x01555555,
+  0x01555555, 0x5055aaa5, 0x55156aaa, 0x55455a96, 0xa55556a5, 0x6a5555a9,
+  0x5a95556a, 0x56a5555a, 0x95a95556, 0xa56a5555, 0xa95a9555, 0x6a56a555,
+  0x5a96a555, 0x56aaa554, 0x55aaa555, 0x15555555, 0x01555555, 0x00555555,
+  0x00015554, 0x00000000, 0x01555550, 0x05555555, 0x41555555, 0x51555555,
+  0x5555aaaa, 0x95556aaa, 0xa5555a95, 0x555556a5, 0x555455a9, 0x5555156a,
+  0xaa55055a, 0xaa954156, 0xa5555055, 0xa9555515, 0x6a555545, 0x5a955555,
+  0x56aaaa55, 0x55aaaa95, 0x55555555, 0x51555555, 0x50555555, 0x54015555,
+  0x50000000, 0x01555550, 0x05555555, 0x41555555, 0x51555555, 0x5555aaaa,
+  0x95556aaa, 0xa5555a95, 0x555556a5, 0x555455a9, 0x5555156a, 0xaa55055a,
+  0xaa954156, 0xa5555055, 0xa9555015, 0x6a555405, 0x5a955001, 0x56a55000,
+  0x55a95400, 0x15555500, 0x01555500, 0x00555540, 0x00015500, 0x00000000,
+  0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa,
+  0x95555aa5, 0xa95556a5, 0x595555a9, 0x5555156a, 0x5555555a, 0x96a95556,
+  0xa5aa5555, 0xa95a9555, 0x6a56a555, 0x5aa5a955, 0x55aaaa55, 0x155aaa55,
+  0x45555555, 0x40555555, 0x50055555, 0x50001555, 0x40000000, 0x01551550,
+  0x05555555, 0x41555555, 0x51555555, 0x5555a95a, 0x95556a56, 0xa5555a95,
+  0xa95556a5, 0x6a5555a9, 0x5a95556a, 0xaaa5555a, 0xaaa95556, 0xa56a5555,
+  0xa95a9555, 0x6a56a555, 0x5a95a955, 0x56a56a55, 0x55a95a95, 0x55555555,
+  0x51555555, 0x50555555, 0x54015515, 0x50000000, 0x01555500, 0x55555541,
+  0x55555515, 0x55555555, 0xaaa95556, 0xaaa55555, 0xa9554556, 0xa554155a,
+  0x9550156a, 0x550055a9, 0x540156a5, 0x50155a95, 0x50556a55, 0x4555a955,
+  0x556aaa55, 0x55aaa955, 0x55555551, 0x55555505, 0x55555401, 0x55550000,
+  0x00055550, 0x00155555, 0x40055555, 0x50055555, 0x550156aa, 0x954055aa,
+  0xa5501555, 0xa9540155, 0x6a550055, 0x5a954015, 0x56a55055, 0x55a95455,
+  0x556a5515, 0x555a9555, 0x5956a555, 0x5a96a955, 0x55aaa955, 0x155aa955,
+  0x05555555, 0x40555555, 0x40055555, 0x40001555, 0x00000000, 0x01551550,
+  0x05555555, 0x41555555, 0x51555555, 0x5555a95a, 0x95556a5a, 0x95555a9a,
+  0x955156aa, 0x955455aa, 0x9554156a, 0xa954055a, 0xaa554156, 0xa6a55055,
+  0xa9a95515, 0x6a5a9545, 0x5a96a555, 0x56a56a55, 0x55a95a95, 0x55555555,
+  0x51555555, 0x50555555, 0x54015515, 0x50000000, 0x01550000, 0x05555400,
+  0x01555500, 0x01555550, 0x0055a954, 0x00156a55, 0x00055a95, 0x400156a5,
+  0x500055a9, 0x5400156a, 0x5500055a, 0x95400156, 0xa5554055, 0xa9555515,
+  0x6a555545, 0x5a955555, 0x56aaaa55, 0x55aaaa95, 0x55555555, 0x51555555,
+  0x50555555, 0x54015555, 0x50000000, 0x01551550, 0x05555555, 0x41555555,
+  0x51555555, 0x5555a95a, 0x95556a56, 0xa5555aa6, 0xa95556a9, 0xaa5555aa,
+  0xaa95556a, 0xaaa5555a, 0x99a95556, 0xa66a5555, 0xa95a9555, 0x6a56a555,
+  0x5a95a955, 0x56a56a55, 0x55a95a95, 0x55555555, 0x51555555, 0x50555555,
+  0x54015515, 0x50000000, 0x01551550, 0x05555555, 0x41555555, 0x51555555,
+  0x5555a95a, 0x95556a56, 0xa5555aa5, 0xa95556a9, 0x6a5555aa, 0x9a95556a,
+  0xa6a5555a, 0xaaa95556, 0xa6aa5555, 0xa9aa9555, 0x6a5aa555, 0x5a96a955,
+  0x56a56a55, 0x55a95a95, 0x55555555, 0x51555555, 0x50555555, 0x54015515,
+  0x50000000, 0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9,
+  0x55155aaa, 0x95555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a,
+  0x95a95556, 0xa56a5555, 0xa95a9555, 0x6a56a555, 0x5aa6a955, 0x55aaa955,
+  0x155aa955, 0x05555555, 0x40555555, 0x40055555, 0x40001555, 0x00000000,
+  0x01555500, 0x05555554, 0x01555555, 0x41555555, 0x5455aaa9, 0x55156aaa,
+  0x95555a96, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x5aa5555a, 0xaaa55556,
+  0xaaa55455, 0xa9555515, 0x6a555505, 0x5a955501, 0x56a55400, 0x55a95400,
+  0x15555500, 0x01555500, 0x00555540, 0x00015500, 0x00000000, 0x00155500,
+  0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa, 0x95555aa6,
+  0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a, 0x95a95556, 0xa56a5555,
+  0xa95a9555, 0x6a56a555, 0x5aa6a955, 0x55aaa955, 0x155aa955, 0x0555a955,
+  0x50555aa9, 0x540555aa, 0x55005555, 0x55400555, 0x55400055, 0x55500001,
+  0x55400000, 0x01555500, 0x05555554, 0x01555555, 0x41555555, 0x5455aaa9,
+  0x55156aaa, 0x95555a96, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x5aa5555a,
+  0xaaa55556, 0xaaa55455, 0xaaa55515, 0x6a6a5545, 0x5a96a555, 0x56a56a55,
+  0x55a95695, 0x55555555, 0x51555555, 0x50555555, 0x54015505, 0x50000000,
+  0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9, 0x55155aaa,
+  0x95555aa5, 0xa95556a5, 0x595555aa, 0x5555155a, 0xa5554155, 0xaa955055,
+  0x56a95515, 0x556a9555, 0x5956a555, 0x5a96a955, 0x55aaa955, 0x155aa955,
+  0x05555555, 0x40555555, 0x40055555, 0x40001555, 0x00000000, 0x01555550,
+  0x05555555, 0x41555555, 0x51555555, 0x5555aaaa, 0x95556aaa, 0xa555556a,
+  0x5554555a, 0x95541556, 0xa5550055, 0xa9540015, 0x6a550005, 0x5a954001,
+  0x56a55000, 0x55a95400, 0x156a5500, 0x055a9540, 0x0156a550, 0x00555554,
+  0x00055554, 0x00015555, 0x00000554, 0x00000000, 0x01551550, 0x05555555,
+  0x41555555, 0x51555555, 0x5555a95a, 0x95556a56, 0xa5555a95, 0xa95556a5,
+  0x6a5555a9, 0x5a95556a, 0x56a5555a, 0x95a95556, 0xa56a5555, 0xa95a9555,
+  0x6a56a555, 0x5aa6a955, 0x55aaa955, 0x155aa955, 0x05555555, 0x40555555,
+  0x40055555, 0x40001555, 0x00000000, 0x01551550, 0x05555555, 0x41555555,
+  0x51555555, 0x5555a95a, 0x95556a56, 0xa5555a95, 0xa95556a5, 0x6a5555a9,
+  0x5a95556a, 0x56a5555a, 0x95a95555, 0xa5695515, 0x6a6a5505, 0x569a5540,
+  0x55aa9540, 0x155a9550, 0x0156a550, 0x00555554, 0x00055554, 0x00015555,
+  0x00000554, 0x00000000, 0x01551550, 0x05555555, 0x41555555, 0x51555555,
+  0x5555a95a, 0x95556a56, 0xa5555a95, 0xa95556a5, 0x6a5555a9, 0x5a95556a,
+  0x56a5555a, 0x95a95556, 0xa66a5555, 0xa99a9555, 0x6aaaa555, 0x5aaaa955,
+  0x56a9aa55, 0x55695a55, 0x45555555, 0x41555555, 0x50155555, 0x50005515,
+  0x40000000, 0x01551550, 0x05555555, 0x41555555, 0x51555555, 0x5555a95a,
+  0x95556a56, 0xa55556a6, 0xa55455a9, 0xa954155a, 0xa9550156, 0xaa550055,
+  0x6a554015, 0x6aa55015, 0x5aa95505, 0x5a9a9545, 0x56a6a555, 0x56a56a55,
+  0x55a95a95, 0x55555555, 0x51555555, 0x50555555, 0x54015515, 0x50000000,
+  0x01551550, 0x05555555, 0x41555555, 0x51555555, 0x5555a95a, 0x95556a56,
+  0xa5555a95, 0xa95556a5, 0x6a5555aa, 0x6a95555a, 0xaa955155, 0xaa955055,
+  0x5a955405, 0x56a55400, 0x55a95400, 0x156a5500, 0x055a9540, 0x0156a550,
+  0x00555554, 0x00055554, 0x00015555, 0x00000554, 0x00000000, 0x01555550,
+  0x05555555, 0x41555555, 0x51555555, 0x5555aaaa, 0x95556aaa, 0xa5555555,
+  0xa9545555, 0xa9551555, 0xa9550055, 0x6a554055, 0x6a554055, 0x6a554015,
+  0x5a955515, 0x5a955545, 0x5a955555, 0x56aaaa55, 0x55aaaa95, 0x55555555,
+  0x51555555, 0x50555555, 0x54015555, 0x50000000, 0x01555500, 0x55555541,
+  0x55555515, 0x55555555, 0xaaa95556, 0xaaa5555a, 0x9555556a, 0x555455a9,
+  0x555156a5, 0x54055a95, 0x40156a55, 0x0055a954, 0x0156a550, 0x055a9540,
+  0x156a5540, 0x55a95551, 0x56a55545, 0x5a955555, 0x6aaa5555, 0xaaa95555,
+  0x55555155, 0x55550555, 0x55540155, 0x55000000, 0x01540000, 0x05555000,
+  0x01555500, 0x01555540, 0x0055a554, 0x00156a55, 0x00055695, 0x500055a9,
+  0x5400155a, 0x55400156, 0xa5500055, 0x69550005, 0x5a954001, 0x55a55400,
+  0x156a5500, 0x05569550, 0x0055a954, 0x00155a55, 0x400156a5, 0x50005569,
+  0x5400055a, 0x55000155, 0x55400015, 0x55400005, 0x55500000, 0x15400000,
+  0x01555500, 0x55555541, 0x55555515, 0x55555555, 0xaaa95556, 0xaaa55555,
+  0x5a954555, 0x6a551555, 0xa9540556, 0xa550055a, 0x9540156a, 0x550055a9,
+  0x540156a5, 0x50055a95, 0x40556a55, 0x1555a954, 0x5556a555, 0x555a9555,
+  0x6aaa5555, 0xaaa95555, 0x55555155, 0x55550555, 0x55540155, 0x55000000,
+  0x00055000, 0x00555500, 0x01555540, 0x05555550, 0x15569554, 0x155aa554,
+  0x556aa955, 0x55a96a55, 0x55a55a55, 0x55555555, 0x15555554, 0x15555554,
+  0x01541540, 0x01555550, 0x05555555, 0x41555555, 0x51555555, 0x5555aaaa,
+  0x95556aaa, 0xa5555aaa, 0xa9555555, 0x55551555, 0x55550555, 0x55554015,
+  0x55550000, 0x01554001, 0x55554015, 0x55540555, 0x555055aa, 0x550556a5,
+  0x54155a95, 0x41556955, 0x0555a550, 0x15555500, 0x55554001, 0x55540001,
+  0x54000000, 0x00555500, 0x01555554, 0x00555555, 0x40555555, 0x54156aa9,
+  0x55055aaa, 0x95515555, 0xa954556a, 0xaa55556a, 0xaa95556a, 0x56a5555a,
+  0x96a95556, 0xaaaa5555, 0x6a9a9545, 0x55555551, 0x55555550, 0x15555554,
+  0x00555550, 0x00000000, 0x01550000, 0x05555400, 0x01555500, 0x01555550,
+  0x0055a955, 0x00156a55, 0x54055a95, 0x554156a5, 0x555455a9, 0xa955156a,
+  0xaa95555a, 0xa6a95556, 0xa56a5555, 0xa95a9555, 0x6a56a555, 0x5aa6a955,
+  0x56aaa955, 0x55a9a955, 0x15555555, 0x41555555, 0x40555555, 0x40015555,
+  0x00000000, 0x00155540, 0x00555555, 0x00555555, 0x50555555, 0x54155aaa,
+  0x55555aaa, 0xa5555aa5, 0x695556a5, 0x555555a9, 0x5555156a, 0x5555555a,
+  0xa5695555, 0xaaaa5515, 0x5aaa5545, 0x55555540, 0x55555550, 0x05555550,
+  0x00155540, 0x00000000, 0x00001550, 0x00005555, 0x40001555, 0x50001555,
+  0x5500155a, 0x95405556, 0xa5505555, 0xa9545555, 0x6a55155a, 0x9a95555a,
+  0xaaa5555a, 0xa6a95556, 0xa56a5555, 0xa95a9555, 0x6a56a555, 0x5aa6a955,
+  0x55aaaa55, 0x155a9a95, 0x45555555, 0x50555555, 0x50055555, 0x54001555,
+  0x50000000, 0x00155500, 0x00555554, 0x00555555, 0x40555555, 0x54155aa9,
+  0x55155aaa, 0x95555a95, 0xa95556aa, 0xaa5555aa, 0xaa95556a, 0x5555555a,
+  0xa5695555, 0xaaaa5515, 0x5aaa5545, 0x55555540, 0x55555550, 0x05555550,
+  0x00155540, 0x00000000, 0x00055540, 0x00155555, 0x00155555, 0x50155555,
+  0x540556aa, 0x554556aa, 0xa55156a9, 0x695455a9, 0x5555156a, 0x5555155a,
+  0x9555455a, 0xaaa55156, 0xaaa95455, 0x6a555505, 0x5a955501, 0x56a55540,
+  0x55a95500, 0x156a5500, 0x05555540, 0x00555540, 0x00155550, 0x00005540,
+  0x00000000, 0x00155550, 0x00555555, 0x40555555, 0x50555555, 0x55155a9a,
+  0x95555aaa, 0xa5555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x9aa55556,
+  0xaaa95455, 0x6a6a5515, 0x555a9555, 0x5956a555, 0x5a96a955, 0x55aaa955,
+  0x155aa955, 0x05555555, 0x40555555, 0x40055555, 0x40001555, 0x00000000,
+  0x01550000, 0x05555400, 0x01555500, 0x01555550, 0x0055a955, 0x00156a55,
+  0x54055a95, 0x554156a5, 0x555455a9, 0xa955156a, 0xaa95555a, 0xa6a95556,
+  0xa56a5555, 0xa95a9555, 0x6a56a555, 0x5a95a955, 0x56a56a55, 0x55a95a95,
+  0x55555555, 0x51555555, 0x50555555, 0x54015515, 0x50000000, 0x00155000,
+  0x55554015, 0x55501555, 0x55055a95, 0x4556a551, 0x55a95555, 0x555555aa,
+  0x95556aa5, 0x5555a954, 0x556a5515, 0x5a954156, 0xa55055a9, 0x54156a55,
+  0x055a9541, 0x55555015, 0x55500555, 0x54001550, 0x00000000, 0x00005540,
+  0x00055554, 0x00055554, 0x00155555, 0x00156a55, 0x00556a55, 0x00556a55,
+  0x01555555, 0x0156aa55, 0x0156aa55, 0x01556a55, 0x00556a55, 0x00556a55,
+  0x00556a55, 0x05556a55, 0x15556a55, 0x15556a55, 0x55656a55, 0x55a9aa55,
+  0x556aa955, 0x155aa554, 0x15555554, 0x05555550, 0x01555540, 0x00155400,
+  0x01550000, 0x05555400, 0x01555500, 0x01555550, 0x0055a955, 0x40156a55,
+  0x55055a95, 0x554156a5, 0x555455a9, 0x6a55156a, 0x6a55455a, 0xaa554156,
+  0xaa555055, 0xaa955415, 0x6aa95545, 0x5a9a9551, 0x56a5a955, 0x55a95a95,
+  0x55555555, 0x51555555, 0x50555555, 0x54015515, 0x50000000, 0x01550001,
+  0x55550015, 0x55500555, 0x554055a9, 0x54055a95, 0x4055a954, 0x055a9540,
+  0x55a95405, 0x5a954055, 0xa954055a, 0x954055a9, 0x55455a95, 0x5455aa55,
+  0x5556aa55, 0x155aa551, 0x55555505, 0x55554015, 0x55540015, 0x54000000,
+  0x01555540, 0x05555555, 0x01555555, 0x51555555, 0x5455a69a, 0x55556aaa,
+  0xa5555aaa, 0xa95556a6, 0x6a5555a9, 0x9a95556a, 0x66a5555a, 0x99a95556,
+  0xa66a5555, 0xa95a9555, 0x55555551, 0x55555550, 0x55555554, 0x01551550,
+  0x00000000, 0x01555500, 0x05555554, 0x01555555, 0x41555555, 0x5455a9a9,
+  0x55156aaa, 0x95555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a,
+  0x95a95556, 0xa56a5555, 0xa95a9555, 0x55555551, 0x55555550, 0x55555554,
+  0x01551550, 0x00000000, 0x00155500, 0x00555554, 0x00555555, 0x40555555,
+  0x54155aa9, 0x55155aaa, 0x95555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a,
+  0x56a5555a, 0xa6a95555, 0xaaa95515, 0x5aa95505, 0x55555540, 0x55555540,
+  0x05555540, 0x00155500, 0x00000000, 0x01555500, 0x05555554, 0x01555555,
+  0x41555555, 0x5455a9a9, 0x55156aaa, 0x95555aa6, 0xa95556a5, 0x6a5555a9,
+  0x5a95556a, 0x9aa5555a, 0xaaa55556, 0xa6a55455, 0xa9555515, 0x6a555505,
+  0x5a955501, 0x56a55400, 0x55a95400, 0x15555500, 0x01555500, 0x00555540,
+  0x00015500, 0x00000000, 0x00155550, 0x00555555, 0x40555555, 0x50555555,
+  0x55155a9a, 0x95555aaa, 0xa5555aa6, 0xa95556a5, 0x6a5555a9, 0x5a95556a,
+  0x9aa55556, 0xaaa95455, 0x6a6a5515, 0x555a9541, 0x5556a550, 0x1555a954,
+  0x00556a55, 0x00055a95, 0x40015555, 0x50001555, 0x50000555, 0x54000015,
+  0x50000000, 0x01555540, 0x05555555, 0x01555555, 0x51555555, 0x5455a9aa,
+  0x55556aaa, 0xa5555aa5, 0x695556a5, 0x555555a9, 0x5555156a, 0x5555455a,
+  0x95550156, 0xa5500055, 0xa9540015, 0x55550001, 0x55550000, 0x55554000,
+  0x01550000, 0x00000000, 0x00555540, 0x01555555, 0x01555555, 0x50555555,
+  0x54556aaa, 0x55556aaa, 0xa5555a95, 0x695556aa, 0x9555556a, 0xaa555555,
+  0x6aa5555a, 0x55a95556, 0xaaaa5555, 0x6aaa5545, 0x55555541, 0x55555550,
+  0x15555550, 0x00555540, 0x00000000, 0x00554000, 0x01555500, 0x00555540,
+  0x00555555, 0x00156a55, 0x54055a95, 0x550556a5, 0x555156aa, 0xa95455aa,
+  0xaa55155a, 0x95554156, 0xa5555055, 0xa9555415, 0x6a555545, 0x5aa5a551,
+  0x55aaa954, 0x155aa955, 0x05555555, 0x00555555, 0x40055555, 0x40001555,
+  0x00000000, 0x01551550, 0x05555555, 0x41555555, 0x51555555, 0x5555a95a,
+  0x95556a56, 0xa5555a95, 0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x56a5555a,
+  0xa6a95555, 0xaaaa5515, 0x5a9a9545, 0x55555550, 0x55555550, 0x05555554,
+  0x00155550, 0x00000000, 0x01551550, 0x05555555, 0x41555555, 0x51555555,
+  0x5555a95a, 0x95556a56, 0xa5555a95, 0xa95555a5, 0x6955156a, 0x6a550556,
+  0x9a554055, 0xaa954015, 0x5a955001, 0x56a55000, 0x55555400, 0x05555400,
+  0x01555500, 0x00055400, 0x00000000, 0x01551550, 0x05555555, 0x41555555,
+  0x51555555, 0x5555a95a, 0x95556a56, 0xa5555a95, 0xa95556a6, 0x6a5555a9,
+  0x9a95556a, 0xaaa5555a, 0xaaa95556, 0xa9aa5555, 0x695a5545, 0x55555541,
+  0x55555550, 0x15555550, 0x00551540, 0x00000000, 0x01551550, 0x05555555,
+  0x41555555, 0x51555555, 0x5555a95a, 0x95556a56, 0xa55556a6, 0xa554556a,
+  0xa5541556, 0xa5550556, 0xaa554556, 0xa6a55556, 0xa56a5555, 0xa95a9555,
+  0x55555551, 0x55555550, 0x55555554, 0x01551550, 0x00000000, 0x01551550,
+  0x05555555, 0x41555555, 0x51555555, 0x5555a95a, 0x95556a56, 0xa5555a95,
+  0xa95556a5, 0x6a5555a9, 0x5a95556a, 0x9aa55556, 0xaaa95455, 0x6a6a5515,
+  0x555a9555, 0x5956a555, 0x5a96a955, 0x55aaa955, 0x155aa955, 0x05555555,
+  0x40555555, 0x40055555, 0x40001555, 0x00000000, 0x01555550, 0x05555555,
+  0x41555555, 0x51555555, 0x5555aaaa, 0x95556aaa, 0xa5555556, 0xa5545556,
+  0xa5541556, 0xa5550556, 0xa5554556, 0xa5555556, 0xaaaa5555, 0xaaaa9555,
+  0x55555551, 0x55555550, 0x55555554, 0x01555550, 0x00000000, 0x00015540,
+  0x00155554, 0x00555554, 0x00555555, 0x0155aa55, 0x0156aa55, 0x0156a555,
+  0x0156a554, 0x0556a554, 0x1556a550, 0x1556a550, 0x556a9550, 0x55aa5540,
+  0x556a9550, 0x1556a550, 0x1556a550, 0x0556a554, 0x0156a554, 0x0156a555,
+  0x0156aa55, 0x0155aa55, 0x00555555, 0x00555554, 0x00155554, 0x00015540,
+  0x01550055, 0x55415555, 0x15555555, 0xa95556a5, 0x555a9555, 0x6a5555a9,
+  0x5556a555, 0x5a95556a, 0x5555a955, 0x56a5555a, 0x95556a55, 0x55a95556,
+  0xa5555a95, 0x556a5555, 0x55545555, 0x41555500, 0x55400000, 0x01554000,
+  0x15555400, 0x15555500, 0x55555500, 0x55aa5540, 0x55aa9540, 0x555a9540,
+  0x155a9540, 0x155a9550, 0x055a9554, 0x055a9554, 0x0556a955, 0x0155aa55,
+  0x0556a955, 0x055a9554, 0x055a9554, 0x155a9550, 0x155a9540, 0x555a9540,
+  0x55aa9540, 0x55aa5540, 0x55555500, 0x15555500, 0x15555400, 0x01554000,
+  0x00555550, 0x01555555, 0x41555555, 0x50555555, 0x55556a5a, 0x95556aa6,
+  0xa5555aaa, 0xa95556a6, 0xaa5555a9, 0x6a555555, 0x55554155, 0x55555055,
+  0x55555001, 0x55554000,
+  // Font Bytes: 7784
 
   0x00000000
 };
@@ -1032,186 +1505,335 @@ const uint32_t font_large_normal[] = {
   0x00000000
 };
 
-// Font: large-normal-outline (neep-alt-iso8859-1-12x24.bdf)
-const uint32_t font_large_normal_outline[] = {
+// Font: large-normal-combined (neep-alt-iso8859-1-12x24.bdf)
+const uint32_t font_large_normal_combined[] = {
 
   // Font Info: width=12 height=24 descent=5
   0x0005180c,
 
   // Glyph Info:
-  0x45a0c000, 0x6318a006, 0x8590c00b, 0x8590c016, 0x8590c021, 0x8550e02c,
-  0x5b14a037, 0x6e98a03c, 0x6e94a047, 0x7c112052, 0x8411205a, 0x63166062,
-  0x7a11a067, 0x529e606b, 0x8690a06f, 0x8590c07c, 0x6590c087, 0x8590c090,
-  0x8590c09b, 0x8590c0a6, 0x8590c0b1, 0x8590c0bc, 0x8590c0c7, 0x8590c0d2,
-  0x8590c0dd, 0x54dd40e8, 0x655540ee, 0x7554e0f6, 0x7b516100, 0x7554e107,
-  0x7594c111, 0x8590c11b, 0x8590c126, 0x8590c131, 0x8590c13c, 0x8590c147,
-  0x8590c152, 0x8590c15d, 0x8590c168, 0x8590c173, 0x7594c17e, 0x8590c188,
-  0x8590c193, 0x8590c19e, 0x8590c1a9, 0x8590c1b4, 0x8590c1bf, 0x8590c1ca,
-  0x8650c1d5, 0x8590c1e2, 0x8590c1ed, 0x8590c1f8, 0x8590c203, 0x8590c20e,
-  0x8590c219, 0x8590c224, 0x8590c22f, 0x8590c23a, 0x6e98a245, 0x8690a250,
-  0x6e94a25d, 0x7394c268, 0x8213026f, 0x5b18a273, 0x84516278, 0x8590c281,
-  0x8451628c, 0x8590c295, 0x845162a0, 0x8590c2a9, 0x859162b4, 0x8590c2bf,
-  0x5d98c2ca, 0x76d0c2d2, 0x8590c2de, 0x659cc2e9, 0x845162f2, 0x845162fb,
-  0x84516304, 0x8591630d, 0x85916318, 0x84516323, 0x8451632c, 0x85110335,
-  0x8451633f, 0x84516348, 0x84516351, 0x8451635a, 0x85916363, 0x8451636e,
-  0x7694a377, 0x46a0a383, 0x7694a38a, 0x8310e396,
+  0x45a0c000, 0x6318a00b, 0x8590c014, 0x8590c02a, 0x8590c040, 0x8550e056,
+  0x5b14a06b, 0x6e98a074, 0x6e94a08a, 0x7c1120a0, 0x841120af, 0x631660bf,
+  0x7a11a0c8, 0x529e60d0, 0x8690a0d7, 0x8590c0f1, 0x6590c107, 0x8590c118,
+  0x8590c12e, 0x8590c144, 0x8590c15a, 0x8590c170, 0x8590c186, 0x8590c19c,
+  0x8590c1b2, 0x54dd41c8, 0x655541d4, 0x7554e1e4, 0x7b5161f7, 0x7554e204,
+  0x7594c217, 0x8590c22b, 0x8590c241, 0x8590c257, 0x8590c26d, 0x8590c283,
+  0x8590c299, 0x8590c2af, 0x8590c2c5, 0x8590c2db, 0x7594c2f1, 0x8590c305,
+  0x8590c31b, 0x8590c331, 0x8590c347, 0x8590c35d, 0x8590c373, 0x8590c389,
+  0x8650c39f, 0x8590c3b8, 0x8590c3ce, 0x8590c3e4, 0x8590c3fa, 0x8590c410,
+  0x8590c426, 0x8590c43c, 0x8590c452, 0x8590c468, 0x6e98a47e, 0x8690a494,
+  0x6e94a4ae, 0x7394c4c4, 0x821304d1, 0x5b18a4d9, 0x845164e2, 0x8590c4f3,
+  0x84516509, 0x8590c51a, 0x84516530, 0x8590c541, 0x85916557, 0x8590c56d,
+  0x5d98c583, 0x76d0c593, 0x8590c5ab, 0x659cc5c1, 0x845165d2, 0x845165e3,
+  0x845165f4, 0x85916605, 0x8591661b, 0x84516631, 0x84516642, 0x85110653,
+  0x84516667, 0x84516678, 0x84516689, 0x8451669a, 0x859166ab, 0x845166c1,
+  0x7694a6d2, 0x46a0a6e9, 0x7694a6f6, 0x8310e70d,
 
   // Bitmap Data:
-  0x3c7effe7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7ffff, 0xe7e7e7ff, 0x7e3c0000,
-  0x3fc7feff, 0xfe67e67e, 0x67e67e67, 0xe67fff7f, 0xe3fc0000, 0x0ff01ff8,
-  0x3ffc399c, 0x399c799e, 0xf99fe007, 0xe007f99f, 0x799e799e, 0xf99fe007,
-  0xe007f99f, 0x799e399c, 0x399c3ffc, 0x1ff80ff0, 0x03c007e0, 0x0ff01e78,
-  0x3e7c781e, 0xf00fe247, 0xe66fe27e, 0xf01e780f, 0x7e47f667, 0xe247f00f,
-  0x781e3e7c, 0x1e780ff0, 0x07e003c0, 0x1fbc3ffe, 0x7ffff0e7, 0xe067e64f,
-  0xe64ee01e, 0xf03c7f38, 0x3e781e7c, 0x1cfe3c0f, 0x78077267, 0xf267e607,
-  0xe70ffffe, 0x7ffc3df8, 0x0f801fc0, 0x3fe078f0, 0xf078e238, 0xe738e23c,
-  0xf07e78ff, 0xf067e207, 0xe70fe79e, 0xe79ee30f, 0xf0077867, 0x3fff1ffe,
-  0x0ffc0000, 0x0f83f8ff, 0x9c778ee3, 0xfcf73cef, 0x1fc1f01c, 0x00000000,
-  0x01e01f81, 0xfe1e71e7, 0x9e78e78f, 0x3873c79c, 0x39e1ce0e, 0x7073839c,
-  0x1cf0f383, 0x9e1e7073, 0xc3cf0f3c, 0x3ce0ff03, 0xf00f0000, 0x3c03f03f,
-  0xc1cf0f3c, 0x3cf0f383, 0x9e1e7073, 0xc3ce0e70, 0x73839c1c, 0xe1e70e78,
-  0xf3873c79, 0xc79e79e3, 0x9e1fe07e, 0x01e00000, 0x0ee03fe0, 0xffe3dde7,
-  0x39cf27bf, 0x1ff007e0, 0x0ff8fde4, 0xf39ce7bb, 0xc7ff07fc, 0x07700000,
-  0x03c007e0, 0x0ff00e70, 0x3e7c7e7e, 0xfe7fe007, 0xe007fe7f, 0x7e7e3e7c,
-  0x0e700ff0, 0x07e003c0, 0x0fc1fe3f, 0xf38778f7, 0x1ef3ce78, 0xef0fe07c,
-  0x03800000, 0x3ff8fffb, 0xffff007e, 0x00ffffdf, 0xff1ffc00, 0x1e0fc7fb,
-  0xcfe1f87f, 0x3dfe3f07, 0x80000000, 0x001c003e, 0x007f00f7, 0x00e701e7,
-  0x01cf03ce, 0x039e079c, 0x073c0f38, 0x0e781e70, 0x1cf03ce0, 0x39e079c0,
-  0x73c0f380, 0xe780e700, 0xef00fe00, 0x7c003800, 0x07e00ff0, 0x1ff83c3c,
-  0x781e73ce, 0xf3cfe7e7, 0xe7e7e7e7, 0xe667e667, 0xe7e7e7e7, 0xe7e7f3cf,
-  0x73ce781e, 0x3c3c1ff8, 0x0ff007e0, 0x01c03e07, 0xf0f71e73, 0xc7787f27,
-  0xe67fe77e, 0x73e70e70, 0xe70e70e7, 0x0e70e70e, 0x70ff07e0, 0x3c000000,
-  0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xf7e77fe7, 0x3fe71fcf, 0x079e0f3c,
-  0x1e783cf0, 0x79fcf3fe, 0xe7ffe007, 0xe007ffff, 0x7ffe3ffc, 0x3ffc7ffe,
-  0xffffe007, 0xe007ffe7, 0x7fcf3f9e, 0x0f3c0e1e, 0x0e0f0fc7, 0x1fe73fe7,
-  0x7fe7f7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x03f007f8, 0x0ffc0e1c,
-  0x1e1c1c9c, 0x3c9c399c, 0x799c739c, 0xf39ce79e, 0xe79fe007, 0xe007ff9f,
-  0x7f9e3f9c, 0x039c03fc, 0x01f800f0, 0x3ff87ffc, 0xfffee00e, 0xe00ee7fe,
-  0xe7fce7fc, 0xe41ee00f, 0xe3c7e7e7, 0xffe77ee7, 0x7fe7f7e7, 0xe3c7f00f,
-  0x781e3ffc, 0x1ff80ff0, 0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7efe7fe,
-  0xe7fce41e, 0xe00fe3c7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe3c7f00f, 0x781e3ffc,
-  0x1ff80ff0, 0x3ffc7ffe, 0xffffe007, 0xe007ffe7, 0x7fe73fcf, 0x03ce039e,
-  0x079c073c, 0x0f380e78, 0x1e701cf0, 0x3ce039e0, 0x39c03fc0, 0x1f800f00,
-  0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7e7e7e7, 0xe7e7e3c7, 0xf00ff00f,
-  0xe3c7e7e7, 0xe7e7e7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x0ff01ff8,
-  0x3ffc781e, 0xf00fe3c7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe3c7f007, 0x78273fe7,
-  0x7fe7f7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x1e0fc7fb, 0xcfe1f87f,
-  0x3dfe3f07, 0x83f1fef3, 0xf87e1fcf, 0x7f8fc1e0, 0x0780fc1f, 0xe3cf3873,
-  0x873cf1fe, 0x0fc0f81f, 0xc3fe38e7, 0x8e71ef3c, 0xe78ef0fe, 0x07c03800,
-  0x007003e0, 0x1fc0f707, 0x9c3cf1e7, 0x8f3c79e3, 0xcf0e783c, 0xf079e0f3,
-  0xc1e783cf, 0x079c0f70, 0x1fc03e00, 0x70000000, 0x3ff8fffb, 0xffff007e,
-  0x00ffffdf, 0xff7fffe0, 0x0fc01fff, 0xfbffe3ff, 0x80000000, 0x3801f00f,
-  0xe03bc0e7, 0x83cf079e, 0x0f3c1e78, 0x3cf079c3, 0xcf1e78f3, 0xc79e3cf0,
-  0xe783bc0f, 0xe01f0038, 0x00000000, 0x3fe1ffcf, 0xffb80fe0, 0x1ffe77f9,
-  0xcfcf1e78, 0xf3c39e0e, 0x7039c0e7, 0x03fc0ff0, 0x39c0e703, 0x9c0ff01f,
-  0x803c0000, 0x07f00ff8, 0x1ffc3c1e, 0x780ff1c7, 0xe3e7e787, 0xe707e627,
-  0xe667e667, 0xe627e707, 0xe787e3ff, 0xf1fe780e, 0x3c0e1ffe, 0x0ffc07f8,
-  0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe007e007,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7ffff, 0x7e7e3c3c, 0x3fc07fe0,
-  0xfff0e078, 0xe03ce71c, 0xe79ce79c, 0xe79ce79c, 0xe03ce01e, 0xe7cfe7e7,
-  0xe7e7e7e7, 0xe7c7e00f, 0xe01efffc, 0x7ff83ff0, 0x0ff01ff8, 0x3ffc781e,
-  0xf00fe3c7, 0xe7efe7fe, 0xe77ce738, 0xe700e700, 0xe738e77c, 0xe7fee7ef,
-  0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x3fc07fe0, 0xfff0e078, 0xe03ce79e,
-  0xe7cfe7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7cf, 0xe79ee03c,
-  0xe078fff0, 0x7fe03fc0, 0x3ffc7ffe, 0xffffe007, 0xe007e7ff, 0xe7fee7fc,
-  0xe7f8e7fc, 0xe01ce01c, 0xe7fce7f8, 0xe7fce7fe, 0xe7ffe007, 0xe007ffff,
-  0x7ffe3ffc, 0x3ffc7ffe, 0xffffe007, 0xe007e7ff, 0xe7fee7fc, 0xe7f8e7fc,
-  0xe01ce01c, 0xe7fce7f8, 0xe7f0e700, 0xe700e700, 0xe700ff00, 0x7e003c00,
-  0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7efe7fe, 0xe7fee7ff, 0xe707e707,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x3c3c7e7e,
-  0xffffe7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe007e007, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7ffff, 0x7e7e3c3c, 0x3ff1ffef, 0xfff807e0,
-  0x1ff3f7cf, 0x8f3c1ce0, 0x7381ce07, 0x381ce073, 0x83cf1f3e, 0xfcff807e,
-  0x01ffff7f, 0xf8ffc000, 0x03fc07fe, 0x0fff0e07, 0x0e070fe7, 0x07e703e7,
-  0x00e700e7, 0x00e700e7, 0x1ce73ee7, 0x7fe7f7e7, 0xe3c7f00f, 0x781e3ffc,
-  0x1ff80ff0, 0x3c3c7e7e, 0xffffe7e7, 0xe7cfe79e, 0xe73ce678, 0xe4f0e070,
-  0xe278e738, 0xe73ce79c, 0xe79ee7ce, 0xe7cfe7e7, 0xe7e7ffff, 0x7e7e3c3c,
-  0x3c007e00, 0xff00e700, 0xe700e700, 0xe700e700, 0xe700e700, 0xe700e700,
-  0xe700e700, 0xe7fce7fe, 0xe7ffe007, 0xe007ffff, 0x7ffe3ffc, 0x3c3c7e7e,
-  0xffffe7e7, 0xe7e7e3c7, 0xe3c7e187, 0xe5a7e427, 0xe667e667, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7ffff, 0x7e7e3c3c, 0x3c3c7e7e, 0xffffe7e7,
-  0xe3e7e3e7, 0xe1e7e5e7, 0xe4e7e6e7, 0xe667e767, 0xe727e7a7, 0xe787e7c7,
-  0xe7c7e7e7, 0xe7e7ffff, 0x7e7e3c3c, 0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe3c7f00f,
-  0x781e3ffc, 0x1ff80ff0, 0x3ff07ff8, 0xfffce01e, 0xe00fe7c7, 0xe7e7e7e7,
-  0xe7e7e7c7, 0xe00fe01e, 0xe7fce7f8, 0xe7f0e700, 0xe700e700, 0xe700ff00,
-  0x7e003c00, 0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7e7e7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe667e667, 0xe247f00f, 0x781e3f1f, 0x1f870fc7,
-  0x01ff00fe, 0x007c0000, 0x3ff07ff8, 0xfffce01e, 0xe00fe7c7, 0xe7e7e7e7,
-  0xe7e7e7c7, 0xe00fe01e, 0xe0fce478, 0xe63ce71e, 0xe78fe7c7, 0xe7e7ffff,
-  0x7e7e3c3c, 0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7efe7fe, 0xe3fcf0f8,
-  0x783c3e1e, 0x1f8f3fc7, 0x7fe7f7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0,
-  0x3ffc7ffe, 0xffffe007, 0xe007fe7f, 0x7e7e3e7c, 0x0e700e70, 0x0e700e70,
-  0x0e700e70, 0x0e700e70, 0x0e700e70, 0x0e700ff0, 0x07e003c0, 0x3c3c7e7e,
-  0xffffe7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe3c7f00f, 0x781e3ffc, 0x1ff80ff0, 0x3c3c7e7e, 0xffffe7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7f3cf, 0x73ce799e, 0x399c3c3c,
-  0x1c381e78, 0x0e700ff0, 0x07e003c0, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe667e667, 0xe427e5a7, 0xe187f3cf,
-  0x73ce7ffe, 0x3ffc1e78, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7f3cf, 0x73ce799e,
-  0x399c3c3c, 0x1c381c38, 0x3c3c399c, 0x799e73ce, 0xf3cfe7e7, 0xe7e7ffff,
-  0x7e7e3c3c, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e3c7,
-  0xf00f781e, 0x3e7c1e78, 0x0e700e70, 0x0e700e70, 0x0e700ff0, 0x07e003c0,
-  0x3ffc7ffe, 0xffffe007, 0xe007ffe7, 0x7fcf3fce, 0x079e0f3c, 0x0e781e70,
-  0x3cf079e0, 0x73fcf3fe, 0xe7ffe007, 0xe007ffff, 0x7ffe3ffc, 0x3fe3ffbf,
-  0xffc07e03, 0xf3ff9fdc, 0xfce70738, 0x39c1ce0e, 0x7073839c, 0x1ce0e707,
-  0x3839f9cf, 0xee7ff01f, 0x80ffff7f, 0xf1ff0000, 0x38007c00, 0xfe00ef00,
-  0xe700e780, 0xf38073c0, 0x79c039e0, 0x3ce01cf0, 0x1e700e78, 0x0f38073c,
-  0x079c039e, 0x03ce01cf, 0x01e700e7, 0x00f7007f, 0x003e001c, 0x3fe3ffbf,
-  0xffc07e03, 0xff9dfce7, 0xe7073839, 0xc1ce0e70, 0x73839c1c, 0xe0e70738,
-  0x39cfcefe, 0x7ff3f01f, 0x80ffff7f, 0xf1ff0000, 0x07803f01, 0xfe07383c,
-  0xf0e1c787, 0x9ccef33f, 0x9e7e79ff, 0xff7ff8f3, 0xc0000000, 0x3ffc7ffe,
-  0xffffe007, 0xe007ffff, 0x7ffe3ffc, 0x3e0fe3fe, 0x71ce3de3, 0x9e79e71e,
-  0xe1fc1f01, 0xc0000000, 0x0ff01ff8, 0x3ffc381e, 0x380f3fc7, 0x3fe77807,
-  0xf007e3e7, 0xe7c7e387, 0xf0277867, 0x3fff1ffe, 0x0ffc0000, 0x3c007e00,
-  0xff00e700, 0xe700e7f0, 0xe7f8e7fc, 0xe61ee40f, 0xe1c7e3e7, 0xe7e7e7e7,
-  0xe7e7e3e7, 0xe1c7e40f, 0xe61efffc, 0x7ff83ff0, 0x0ff01ff8, 0x3ffc781e,
-  0xf00fe3c7, 0xe7efe7fe, 0xe77ce7fe, 0xe7efe3c7, 0xf00f781e, 0x3ffc1ff8,
-  0x0ff00000, 0x003c007e, 0x00ff00e7, 0x00e70fe7, 0x1fe73fe7, 0x7867f027,
-  0xe387e7c7, 0xe7e7e7e7, 0xe7e7e7c7, 0xe387f027, 0x78673fff, 0x1ffe0ffc,
-  0x0ff01ff8, 0x3ffc781e, 0xf00fe3c7, 0xe7e7e007, 0xe007e7ff, 0xe7efe3c7,
-  0xf00f781e, 0x3ffc1ff8, 0x0ff00000, 0x03f007f8, 0x0ffc1e1e, 0x3c0f38c7,
-  0x39ef39fe, 0x79fcf9fe, 0xe00ee00e, 0xf9fe79fc, 0x39f839c0, 0x39c039c0,
-  0x39c03fc0, 0x1f800f00, 0x0ffc1ffe, 0x3fff7867, 0xf027e387, 0xe7c7e7e7,
-  0xe7e7e7c7, 0xe387f027, 0x78673fe7, 0x7fe7f7e7, 0xe3c7f00f, 0x781e3ffc,
-  0x1ff80ff0, 0x3c007e00, 0xff00e700, 0xe700e7f0, 0xe7f8e7fc, 0xe61ee40f,
-  0xe1c7e3e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7ffff, 0x7e7e3c3c,
-  0x0781f87f, 0x8e71ce79, 0xdfffffe0, 0xfc1ff3be, 0x73ce39c7, 0x38e71ce3,
-  0x9c738ff0, 0xfc0f0000, 0x00f007e0, 0x3fc0e703, 0x9c1e70ff, 0xc7ff1c1c,
-  0x7071f9c3, 0xe7079c0e, 0x7039c0e7, 0x039c7e73, 0xf9dfe7f7, 0x9f8c7f03,
-  0xde1e3ff0, 0x7f80fc00, 0x3c007e00, 0xff00e700, 0xe700e778, 0xe7fce7fe,
-  0xe7cee79e, 0xe73ce678, 0xe4f0e0f0, 0xe278e73c, 0xe79ee7cf, 0xe7e7ffff,
-  0x7e7e3c3c, 0x3c07e0ff, 0x0e70e70e, 0x70e70e70, 0xe70e70e7, 0x0e70e70e,
-  0x70e7ce7e, 0xe3ff0778, 0x73ff1fe0, 0xfc000000, 0x3ff87ffc, 0xfffee4cf,
-  0xe007e227, 0xe667e667, 0xe667e667, 0xe667e667, 0xe667e7e7, 0xffff7ffe,
-  0x3c3c0000, 0x3ff07ff8, 0xfffce61e, 0xe40fe1c7, 0xe3e7e7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xffff7e7e, 0x3c3c0000, 0x0ff01ff8, 0x3ffc781e,
-  0xf00fe3c7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e3c7, 0xf00f781e, 0x3ffc1ff8,
-  0x0ff00000, 0x3ff07ff8, 0xfffce61e, 0xe40fe1c7, 0xe3e7e7e7, 0xe7e7e3e7,
-  0xe1c7e40f, 0xe61ee7fc, 0xe7f8e7f0, 0xe700e700, 0xe700ff00, 0x7e003c00,
-  0x0ffc1ffe, 0x3fff7867, 0xf027e387, 0xe7c7e7e7, 0xe7e7e7c7, 0xe387f027,
-  0x78673fe7, 0x1fe70fe7, 0x00e700e7, 0x00e700ff, 0x007e003c, 0x3ff07ff8,
-  0xfffce61e, 0xe40fe1c7, 0xe3efe7fe, 0xe77ce738, 0xe700e700, 0xe700e700,
-  0xff007e00, 0x3c000000, 0x0ff01ff8, 0x3ffc781e, 0xf00fe7c7, 0xe1eff03e,
-  0x7c0f7f87, 0xf7e7e3c7, 0xf00f781e, 0x3ffc1ff8, 0x0ff00000, 0x0f001f80,
-  0x3fc039f8, 0x79fcf9fe, 0xe00ee00e, 0xf9fe79fc, 0x39f839fc, 0x39fe39ef,
-  0x38c73c0f, 0x1e1e0ffc, 0x07f803f0, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7c7e387, 0xf0277867, 0x3fff1ffe, 0x0ffc0000,
-  0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7, 0xf3cf73ce, 0x73ce799e, 0x399c3c3c,
-  0x1c381e78, 0x0ff007e0, 0x03c00000, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7,
-  0xe7e7e667, 0xe667e427, 0xe5a7e187, 0xf3cf73ce, 0x7ffe3ffc, 0x1e780000,
-  0x3c3c7e7e, 0xffffe7e7, 0xe7e7f3cf, 0x799e3c3c, 0x1e783c3c, 0x799ef3cf,
-  0xe7e7e7e7, 0xffff7e7e, 0x3c3c0000, 0x3c3c7e7e, 0xffffe7e7, 0xe7e7e7e7,
-  0xe7e7e7e7, 0xe7e7e7c7, 0xe387f027, 0x78673fe7, 0x7fe7f7e7, 0xe3c7f00f,
-  0x781e3ffc, 0x1ff80ff0, 0x3ffc7ffe, 0xffffe007, 0xe007ffcf, 0x7f9e3f3c,
-  0x1e783cfc, 0x79fef3ff, 0xe007e007, 0xffff7ffe, 0x3ffc0000, 0x01f00fe0,
-  0x7fc3c71e, 0x1c71f1cf, 0x873c1ce0, 0xf387ce3e, 0x38e1e387, 0x8f8e1f38,
-  0x3ce07381, 0xcf073e1c, 0x7c7870f1, 0xc1ff03f8, 0x07c00000, 0x3c7effe7,
-  0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7e7, 0xe7e7e7ff, 0x7e3c0000,
-  0x3e01fc0f, 0xf838f0e1, 0xe3e387ce, 0x0f381ce0, 0x73c1cf87, 0x1f1e1c78,
-  0x71c7c73e, 0x1cf07383, 0xce1f38f8, 0xe3878e3c, 0x3fe07f00, 0xf8000000,
-  0x1f3c3ffe, 0x7ffff1e7, 0xe0e7e667, 0xe667e707, 0xe78ffffe, 0x7ffc3cf8,
-  // Font Bytes: 3696
+  0x05501554, 0x55555695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x55555555, 0x56955695, 0x56955555, 0x15540550, 0x05555015,
+  0x55545555, 0x55569695, 0x56969556, 0x96955696, 0x95569695, 0x56969555,
+  0x55551555, 0x54055550, 0x00555500, 0x01555540, 0x05555550, 0x05696950,
+  0x05696950, 0x15696954, 0x55696955, 0x56aaaa95, 0x56aaaa95, 0x55696955,
+  0x15696954, 0x15696954, 0x55696955, 0x56aaaa95, 0x56aaaa95, 0x55696955,
+  0x15696954, 0x05696950, 0x05696950, 0x05555550, 0x01555540, 0x00555500,
+  0x00055000, 0x00155400, 0x00555500, 0x01569540, 0x05569550, 0x156aa954,
+  0x55aaaa55, 0x56a69a95, 0x56969655, 0x56a69554, 0x55aaa954, 0x156aaa55,
+  0x15569a95, 0x55969695, 0x56a69a95, 0x55aaaa55, 0x156aa954, 0x05569550,
+  0x01569540, 0x00555500, 0x00155400, 0x00055000, 0x01554550, 0x05555554,
+  0x15555555, 0x55aa5695, 0x56aa9695, 0x56969a55, 0x56969a54, 0x56aaa954,
+  0x55aaa550, 0x1555a540, 0x05569540, 0x01569550, 0x015a5554, 0x055aaa55,
+  0x156aaa95, 0x15a69695, 0x55a69695, 0x5696aa95, 0x5695aa55, 0x55555554,
+  0x15555550, 0x05515540, 0x00554000, 0x01555000, 0x05555400, 0x156a5500,
+  0x55aa9540, 0x56a6a540, 0x5695a540, 0x56a6a550, 0x55aa9554, 0x156a5555,
+  0x55aa9695, 0x56a6aa95, 0x5695aa55, 0x56956954, 0x56956954, 0x56a5aa55,
+  0x55aaaa95, 0x156a9695, 0x05555555, 0x01555554, 0x00555550, 0x00554005,
+  0x55405555, 0x415a9515, 0x6a5456a5, 0x555a5515, 0xa5505655, 0x01555001,
+  0x55000150, 0x00000000, 0x00015400, 0x01554001, 0x55540156, 0x95015695,
+  0x41569540, 0x56954055, 0xa54015a5, 0x50156950, 0x05695401, 0x5a540056,
+  0x950015a5, 0x40056950, 0x015a5500, 0x55a54005, 0x69540156, 0x950015a5,
+  0x50055a55, 0x0055a550, 0x055a5400, 0x55550005, 0x55000055, 0x00000000,
+  0x05500005, 0x55000555, 0x50015a55, 0x0055a550, 0x055a5500, 0x55a54005,
+  0x69540156, 0x950015a5, 0x50055a54, 0x00569500, 0x15a54005, 0x6950015a,
+  0x54015695, 0x00569540, 0x55a54015, 0xa5501569, 0x50156954, 0x15695405,
+  0x69540155, 0x54001554, 0x00015400, 0x00000000, 0x00545400, 0x05555400,
+  0x55555405, 0x59595415, 0xa5695055, 0xa6954555, 0xa95555aa, 0xaa9556aa,
+  0xaa55556a, 0x5551569a, 0x5505695a, 0x54156565, 0x50155555, 0x00155550,
+  0x00151500, 0x00055000, 0x00155400, 0x00555500, 0x00569500, 0x05569550,
+  0x15569554, 0x55569555, 0x56aaaa95, 0x56aaaa95, 0x55569555, 0x15569554,
+  0x05569550, 0x00569500, 0x00555500, 0x00155400, 0x00055000, 0x00555001,
+  0x55540555, 0x55056a95, 0x156a5515, 0xa95455a5, 0x50569540, 0x56550055,
+  0x54001550, 0x00054000, 0x05555540, 0x55555545, 0x55555555, 0xaaaa9556,
+  0xaaaa5555, 0x55555155, 0x55550155, 0x55500000, 0x01540055, 0x50155545,
+  0x5a5556a9, 0x556a9555, 0xa5515554, 0x05550015, 0x40000000, 0x00000150,
+  0x00000554, 0x00001555, 0x00005595, 0x00005695, 0x00015695, 0x00015a55,
+  0x00055a54, 0x00056954, 0x00156950, 0x0015a550, 0x0055a540, 0x00569540,
+  0x01569500, 0x015a5500, 0x055a5400, 0x05695400, 0x15695000, 0x15a55000,
+  0x55a54000, 0x56954000, 0x56950000, 0x56550000, 0x55540000, 0x15500000,
+  0x05400000, 0x00155400, 0x00555500, 0x01555540, 0x055aa550, 0x156aa954,
+  0x15a55a54, 0x55a55a55, 0x56955695, 0x56955695, 0x56955695, 0x56969695,
+  0x56969695, 0x56955695, 0x56955695, 0x56955695, 0x55a55a55, 0x15a55a54,
+  0x156aa954, 0x055aa550, 0x01555540, 0x00555500, 0x00155400, 0x00015000,
+  0x05540015, 0x55005595, 0x01569505, 0x5a95156a, 0x9555a695, 0x56969555,
+  0x56951556, 0x95055695, 0x00569500, 0x56950056, 0x95005695, 0x00569500,
+  0x56950056, 0x95005555, 0x00155400, 0x05500000, 0x00555500, 0x01555540,
+  0x05555550, 0x156aa954, 0x55aaaa55, 0x56a55a95, 0x55955695, 0x15555695,
+  0x05555695, 0x01555a55, 0x00156954, 0x0055a550, 0x01569540, 0x055a5500,
+  0x15695550, 0x55a55554, 0x56955555, 0x56aaaa95, 0x56aaaa95, 0x55555555,
+  0x15555554, 0x05555550, 0x05555550, 0x15555554, 0x55555555, 0x56aaaa95,
+  0x56aaaa95, 0x55555695, 0x15555a55, 0x05556954, 0x0055a550, 0x0056a954,
+  0x0056aa55, 0x00555a95, 0x01555695, 0x05555695, 0x15555695, 0x55955695,
+  0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500,
+  0x00055500, 0x00155540, 0x00555550, 0x0056a950, 0x0156a950, 0x015a6950,
+  0x055a6950, 0x05696950, 0x15696950, 0x15a56950, 0x55a56950, 0x56956954,
+  0x56956955, 0x56aaaa95, 0x56aaaa95, 0x55556955, 0x15556954, 0x05556950,
+  0x00056950, 0x00055550, 0x00015540, 0x00005500, 0x05555540, 0x15555550,
+  0x55555554, 0x56aaaa54, 0x56aaaa54, 0x56955554, 0x56955550, 0x56955550,
+  0x569aa954, 0x56aaaa55, 0x56a55a95, 0x56955695, 0x55555695, 0x15545695,
+  0x15555695, 0x55955695, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550,
+  0x01555540, 0x00555500, 0x00555500, 0x01555540, 0x05555550, 0x156aa954,
+  0x55aaaa55, 0x56a55a95, 0x56955655, 0x56955554, 0x56955550, 0x569aa954,
+  0x56aaaa55, 0x56a55a95, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500,
+  0x05555550, 0x15555554, 0x55555555, 0x56aaaa95, 0x56aaaa95, 0x55555695,
+  0x15555695, 0x05555a55, 0x00055a54, 0x00056954, 0x00156950, 0x0015a550,
+  0x0055a540, 0x00569540, 0x01569500, 0x015a5500, 0x055a5400, 0x05695400,
+  0x05695000, 0x05555000, 0x01554000, 0x00550000, 0x00555500, 0x01555540,
+  0x05555550, 0x156aa954, 0x55aaaa55, 0x56a55a95, 0x56955695, 0x56955695,
+  0x56955695, 0x56a55a95, 0x55aaaa55, 0x55aaaa55, 0x56a55a95, 0x56955695,
+  0x56955695, 0x56955695, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550,
+  0x01555540, 0x00555500, 0x00555500, 0x01555540, 0x05555550, 0x156aa954,
+  0x55aaaa55, 0x56a55a95, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56a55a95, 0x55aaaa95, 0x156aa695, 0x05555695, 0x15555695, 0x55955695,
+  0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500,
+  0x01540055, 0x50155545, 0x5a5556a9, 0x556a9555, 0xa5515554, 0x05550015,
+  0x40055501, 0x555455a5, 0x556a9556, 0xa9555a55, 0x15554055, 0x50015400,
+  0x00154000, 0x55500155, 0x54055a55, 0x056a9505, 0x6a95055a, 0x55015554,
+  0x00555000, 0x55400155, 0x50055554, 0x056a5415, 0x6a5415a9, 0x5455a550,
+  0x56954056, 0x55005554, 0x00155000, 0x05400000, 0x00001500, 0x00055400,
+  0x01555000, 0x55950015, 0x6950055a, 0x55015695, 0x4055a550, 0x15695405,
+  0x5a550056, 0x9540055a, 0x55001569, 0x540055a5, 0x50015695, 0x40055a55,
+  0x00156950, 0x00559500, 0x01555000, 0x05540000, 0x15000000, 0x05555540,
+  0x55555545, 0x55555555, 0xaaaa9556, 0xaaaa5555, 0x55555155, 0x55551555,
+  0x555556aa, 0xaa555aaa, 0xa9555555, 0x55455555, 0x54055555, 0x40000000,
+  0x05400001, 0x55000055, 0x54000565, 0x50005695, 0x40055a55, 0x00156954,
+  0x0055a550, 0x01569540, 0x055a5500, 0x15695005, 0x5a550156, 0x954055a5,
+  0x50156954, 0x055a5500, 0x56954005, 0x65500055, 0x54000155, 0x00000540,
+  0x00000000, 0x05555401, 0x55555055, 0x5555456a, 0xaa5556aa, 0xa9555556,
+  0x95155569, 0x50555a55, 0x01569540, 0x55a55005, 0x69540056, 0x95000569,
+  0x50005695, 0x00055550, 0x00555500, 0x05695000, 0x56950005, 0x69500055,
+  0x55000155, 0x40000550, 0x00000000, 0x00155500, 0x00555540, 0x01555550,
+  0x055aa954, 0x156aaa55, 0x55a95a95, 0x56a55695, 0x56956a95, 0x5695aa95,
+  0x5696a695, 0x56969695, 0x56969695, 0x5696a695, 0x5695aa95, 0x56956a95,
+  0x56a55555, 0x55a95554, 0x156aaa54, 0x055aaa54, 0x01555554, 0x00555550,
+  0x00155540, 0x00555500, 0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55,
+  0x56a55a95, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56aaaa95,
+  0x56aaaa95, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x55555555, 0x15541554, 0x05500550, 0x05555000,
+  0x15555400, 0x55555500, 0x56aa9540, 0x56aaa550, 0x5695a950, 0x56956950,
+  0x56956950, 0x56956950, 0x56956950, 0x56aaa550, 0x56aaa954, 0x56955a55,
+  0x56955695, 0x56955695, 0x56955695, 0x56955a95, 0x56aaaa55, 0x56aaa954,
+  0x55555550, 0x15555540, 0x05555500, 0x00555500, 0x01555540, 0x05555550,
+  0x156aa954, 0x55aaaa55, 0x56a55a95, 0x56955655, 0x56955554, 0x56951550,
+  0x56950540, 0x56950000, 0x56950000, 0x56950540, 0x56951550, 0x56955554,
+  0x56955655, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540,
+  0x00555500, 0x05555000, 0x15555400, 0x55555500, 0x56aa9540, 0x56aaa550,
+  0x56956954, 0x56955a55, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955a55, 0x56956954,
+  0x56aaa550, 0x56aa9540, 0x55555500, 0x15555400, 0x05555000, 0x05555550,
+  0x15555554, 0x55555555, 0x56aaaa95, 0x56aaaa95, 0x56955555, 0x56955554,
+  0x56955550, 0x56955540, 0x56955550, 0x56aaa950, 0x56aaa950, 0x56955550,
+  0x56955540, 0x56955550, 0x56955554, 0x56955555, 0x56aaaa95, 0x56aaaa95,
+  0x55555555, 0x15555554, 0x05555550, 0x05555550, 0x15555554, 0x55555555,
+  0x56aaaa95, 0x56aaaa95, 0x56955555, 0x56955554, 0x56955550, 0x56955540,
+  0x56955550, 0x56aaa950, 0x56aaa950, 0x56955550, 0x56955540, 0x56955500,
+  0x56950000, 0x56950000, 0x56950000, 0x56950000, 0x55550000, 0x15540000,
+  0x05500000, 0x00555500, 0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55,
+  0x56a55a95, 0x56955655, 0x56955554, 0x56955554, 0x56955555, 0x5695aa95,
+  0x5695aa95, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56a55a95,
+  0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500, 0x05500550,
+  0x15541554, 0x55555555, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56aaaa95, 0x56aaaa95, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x55555555, 0x15541554, 0x05500550, 0x05555501, 0x55555455, 0x5555556a,
+  0xaa9556aa, 0xa95555a5, 0x55155a55, 0x4055a550, 0x015a5400, 0x15a54001,
+  0x5a540015, 0xa540015a, 0x540015a5, 0x40055a55, 0x0155a554, 0x555a5555,
+  0x6aaa9556, 0xaaa95555, 0x55551555, 0x55405555, 0x50000000, 0x00055550,
+  0x00155554, 0x00555555, 0x0056aa95, 0x0056aa95, 0x00555695, 0x00155695,
+  0x00055695, 0x00005695, 0x00005695, 0x00005695, 0x00005695, 0x01505695,
+  0x05545695, 0x15555695, 0x55955695, 0x56a55a95, 0x55aaaa55, 0x156aa954,
+  0x05555550, 0x01555540, 0x00555500, 0x05500550, 0x15541554, 0x55555555,
+  0x56955695, 0x56955a55, 0x56956954, 0x5695a550, 0x56969540, 0x569a5500,
+  0x56aa9500, 0x56a69540, 0x5695a540, 0x5695a550, 0x56956950, 0x56956954,
+  0x56955a54, 0x56955a55, 0x56955695, 0x56955695, 0x55555555, 0x15541554,
+  0x05500550, 0x05500000, 0x15540000, 0x55550000, 0x56950000, 0x56950000,
+  0x56950000, 0x56950000, 0x56950000, 0x56950000, 0x56950000, 0x56950000,
+  0x56950000, 0x56950000, 0x56950000, 0x56955550, 0x56955554, 0x56955555,
+  0x56aaaa95, 0x56aaaa95, 0x55555555, 0x15555554, 0x05555550, 0x05500550,
+  0x15541554, 0x55555555, 0x56955695, 0x56955695, 0x56a55a95, 0x56a55a95,
+  0x56a96a95, 0x56996695, 0x569aa695, 0x56969695, 0x56969695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x55555555, 0x15541554, 0x05500550, 0x05500550, 0x15541554, 0x55555555,
+  0x56955695, 0x56a55695, 0x56a55695, 0x56a95695, 0x56995695, 0x569a5695,
+  0x56965695, 0x56969695, 0x56959695, 0x5695a695, 0x56956695, 0x56956a95,
+  0x56955a95, 0x56955a95, 0x56955695, 0x56955695, 0x55555555, 0x15541554,
+  0x05500550, 0x00555500, 0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55,
+  0x56a55a95, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56a55a95,
+  0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500, 0x05555500,
+  0x15555540, 0x55555550, 0x56aaa954, 0x56aaaa55, 0x56955a95, 0x56955695,
+  0x56955695, 0x56955695, 0x56955a95, 0x56aaaa55, 0x56aaa954, 0x56955550,
+  0x56955540, 0x56955500, 0x56950000, 0x56950000, 0x56950000, 0x56950000,
+  0x55550000, 0x15540000, 0x05500000, 0x00555500, 0x01555540, 0x05555550,
+  0x156aa954, 0x55aaaa55, 0x56a55a95, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56969695,
+  0x56969695, 0x56a69a95, 0x55aaaa55, 0x156aa954, 0x0555a955, 0x01556a95,
+  0x00555a95, 0x00015555, 0x00005554, 0x00001550, 0x05555500, 0x15555540,
+  0x55555550, 0x56aaa954, 0x56aaaa55, 0x56955a95, 0x56955695, 0x56955695,
+  0x56955695, 0x56955a95, 0x56aaaa55, 0x56aaa954, 0x56aa5550, 0x569a9540,
+  0x5696a550, 0x5695a954, 0x56956a55, 0x56955a95, 0x56955695, 0x55555555,
+  0x15541554, 0x05500550, 0x00555500, 0x01555540, 0x05555550, 0x156aa954,
+  0x55aaaa55, 0x56a55a95, 0x56955655, 0x56955554, 0x56a55550, 0x55aa5540,
+  0x156aa550, 0x0556a954, 0x01556a55, 0x05555a95, 0x15555695, 0x55955695,
+  0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500,
+  0x05555550, 0x15555554, 0x55555555, 0x56aaaa95, 0x56aaaa95, 0x55569555,
+  0x15569554, 0x05569550, 0x00569500, 0x00569500, 0x00569500, 0x00569500,
+  0x00569500, 0x00569500, 0x00569500, 0x00569500, 0x00569500, 0x00569500,
+  0x00569500, 0x00555500, 0x00155400, 0x00055000, 0x05500550, 0x15541554,
+  0x55555555, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550,
+  0x01555540, 0x00555500, 0x05500550, 0x15541554, 0x55555555, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x55a55a55, 0x15a55a54, 0x15696954, 0x05696950, 0x055aa550,
+  0x015aa540, 0x01569540, 0x00569500, 0x00555500, 0x00155400, 0x00055000,
+  0x05500550, 0x15541554, 0x55555555, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56969695, 0x56969695, 0x569aa695, 0x56996695, 0x56a96a95, 0x55a55a55,
+  0x15a55a54, 0x15555554, 0x05555550, 0x01541540, 0x05500550, 0x15541554,
+  0x55555555, 0x56955695, 0x56955695, 0x55a55a55, 0x15a55a54, 0x15696954,
+  0x05696950, 0x055aa550, 0x015aa540, 0x015aa540, 0x055aa550, 0x05696950,
+  0x15696954, 0x15a55a54, 0x55a55a55, 0x56955695, 0x56955695, 0x55555555,
+  0x15541554, 0x05500550, 0x05500550, 0x15541554, 0x55555555, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56a55a95,
+  0x55aaaa55, 0x156aa954, 0x05569550, 0x01569540, 0x00569500, 0x00569500,
+  0x00569500, 0x00569500, 0x00569500, 0x00555500, 0x00155400, 0x00055000,
+  0x05555550, 0x15555554, 0x55555555, 0x56aaaa95, 0x56aaaa95, 0x55555695,
+  0x15555a55, 0x05555a54, 0x00156954, 0x0055a550, 0x00569540, 0x01569500,
+  0x055a5500, 0x15695400, 0x15a55550, 0x55a55554, 0x56955555, 0x56aaaa95,
+  0x56aaaa95, 0x55555555, 0x15555554, 0x05555550, 0x05555405, 0x55554555,
+  0x55555aaa, 0x9556aaa5, 0x55a55555, 0x6955515a, 0x55505695, 0x0015a540,
+  0x05695001, 0x5a540056, 0x950015a5, 0x40056950, 0x015a5400, 0x56950015,
+  0xa5400569, 0x55415a55, 0x54569555, 0x55aaa955, 0x6aaa5555, 0x55551555,
+  0x55015555, 0x00000000, 0x05400000, 0x15500000, 0x55540000, 0x56550000,
+  0x56950000, 0x56954000, 0x55a54000, 0x15a55000, 0x15695000, 0x05695400,
+  0x055a5400, 0x015a5500, 0x01569500, 0x00569540, 0x0055a540, 0x0015a550,
+  0x00156950, 0x00056954, 0x00055a54, 0x00015a55, 0x00015695, 0x00005695,
+  0x00005595, 0x00001555, 0x00000554, 0x00000150, 0x05555405, 0x55554555,
+  0x55555aaa, 0x9556aaa5, 0x55556951, 0x555a5415, 0x56950015, 0xa5400569,
+  0x50015a54, 0x00569500, 0x15a54005, 0x6950015a, 0x54005695, 0x0015a540,
+  0x05695055, 0x5a545556, 0x955555a5, 0x55aaa955, 0x6aaa5555, 0x55551555,
+  0x55015555, 0x00000000, 0x00154000, 0x05550001, 0x55540015, 0xa540055a,
+  0x550056a9, 0x50156a95, 0x415a5a54, 0x55a5a555, 0x69569556, 0x95695555,
+  0x55551555, 0x55405505, 0x50000000, 0x05555550, 0x15555554, 0x55555555,
+  0x56aaaa95, 0x56aaaa95, 0x55555555, 0x15555554, 0x05555550, 0x05540055,
+  0x54055554, 0x15a95056, 0xa55156a5, 0x41569541, 0x56950156, 0x54015550,
+  0x01550001, 0x50000000, 0x00555500, 0x01555540, 0x05555550, 0x056aa954,
+  0x056aaa55, 0x05555a95, 0x05555695, 0x156aaa95, 0x55aaaa95, 0x56a55695,
+  0x56955a95, 0x56a56a95, 0x55aaa695, 0x156a9695, 0x05555555, 0x01555554,
+  0x00555550, 0x05500000, 0x15540000, 0x55550000, 0x56950000, 0x56950000,
+  0x56955500, 0x56955540, 0x56955550, 0x5696a954, 0x569aaa55, 0x56a95a95,
+  0x56a55695, 0x56955695, 0x56955695, 0x56955695, 0x56a55695, 0x56a95a95,
+  0x569aaa55, 0x5696a954, 0x55555550, 0x15555540, 0x05555500, 0x00555500,
+  0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55, 0x56a55a95, 0x56955655,
+  0x56955554, 0x56951550, 0x56955554, 0x56955655, 0x56a55a95, 0x55aaaa55,
+  0x156aa954, 0x05555550, 0x01555540, 0x00555500, 0x00000550, 0x00001554,
+  0x00005555, 0x00005695, 0x00005695, 0x00555695, 0x01555695, 0x05555695,
+  0x156a9695, 0x55aaa695, 0x56a56a95, 0x56955a95, 0x56955695, 0x56955695,
+  0x56955695, 0x56955a95, 0x56a56a95, 0x55aaa695, 0x156a9695, 0x05555555,
+  0x01555554, 0x00555550, 0x00555500, 0x01555540, 0x05555550, 0x156aa954,
+  0x55aaaa55, 0x56a55a95, 0x56955695, 0x56aaaa95, 0x56aaaa95, 0x56955555,
+  0x56955655, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540,
+  0x00555500, 0x00055500, 0x00155540, 0x00555550, 0x0156a954, 0x055aaa55,
+  0x056a5a95, 0x05695655, 0x05695554, 0x15695550, 0x55695554, 0x56aaaa54,
+  0x56aaaa54, 0x55695554, 0x15695550, 0x05695540, 0x05695000, 0x05695000,
+  0x05695000, 0x05695000, 0x05555000, 0x01554000, 0x00550000, 0x00555550,
+  0x01555554, 0x05555555, 0x156a9695, 0x55aaa695, 0x56a56a95, 0x56955a95,
+  0x56955695, 0x56955695, 0x56955a95, 0x56a56a95, 0x55aaa695, 0x156a9695,
+  0x05555695, 0x15555695, 0x55955695, 0x56a55a95, 0x55aaaa55, 0x156aa954,
+  0x05555550, 0x01555540, 0x00555500, 0x05500000, 0x15540000, 0x55550000,
+  0x56950000, 0x56950000, 0x56955500, 0x56955540, 0x56955550, 0x5696a954,
+  0x569aaa55, 0x56a95a95, 0x56a55695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x55555555, 0x15541554,
+  0x05500550, 0x00154001, 0x55401555, 0x40569501, 0x5a541569, 0x51555555,
+  0x555556aa, 0x555aa955, 0x55a54556, 0x95055a54, 0x05695015, 0xa5405695,
+  0x015a5405, 0x695015a5, 0x40555500, 0x55500055, 0x00000000, 0x00005500,
+  0x00155400, 0x05555000, 0x56950005, 0x69500156, 0x95005555, 0x50155555,
+  0x015aa950, 0x15aa9501, 0x55695005, 0x56950015, 0x69500056, 0x95000569,
+  0x50005695, 0x00056950, 0x15569505, 0x55695155, 0x56955595, 0x69556a5a,
+  0x9555aaa5, 0x5156a954, 0x05555500, 0x15554000, 0x55500000, 0x05500000,
+  0x15540000, 0x55550000, 0x56950000, 0x56950000, 0x56951540, 0x56955550,
+  0x56955554, 0x56955a54, 0x56956954, 0x5695a550, 0x56969540, 0x569a5500,
+  0x56aa5500, 0x56a69540, 0x5695a550, 0x56956954, 0x56955a55, 0x56955695,
+  0x55555555, 0x15541554, 0x05500550, 0x05500015, 0x54005555, 0x00569500,
+  0x56950056, 0x95005695, 0x00569500, 0x56950056, 0x95005695, 0x00569500,
+  0x56950056, 0x95005695, 0x50569554, 0x56a55555, 0xaa95156a, 0x95055555,
+  0x01555400, 0x55500000, 0x05555540, 0x15555550, 0x55555554, 0x569a5a55,
+  0x56aaaa95, 0x56a6a695, 0x56969695, 0x56969695, 0x56969695, 0x56969695,
+  0x56969695, 0x56969695, 0x56969695, 0x56955695, 0x55555555, 0x15555554,
+  0x05500550, 0x05555500, 0x15555540, 0x55555550, 0x5696a954, 0x569aaa55,
+  0x56a95a95, 0x56a55695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x55555555, 0x15541554, 0x05500550,
+  0x00555500, 0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55, 0x56a55a95,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56a55a95,
+  0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500, 0x05555500,
+  0x15555540, 0x55555550, 0x5696a954, 0x569aaa55, 0x56a95a95, 0x56a55695,
+  0x56955695, 0x56955695, 0x56a55695, 0x56a95a95, 0x569aaa55, 0x5696a954,
+  0x56955550, 0x56955540, 0x56955500, 0x56950000, 0x56950000, 0x56950000,
+  0x55550000, 0x15540000, 0x05500000, 0x00555550, 0x01555554, 0x05555555,
+  0x156a9695, 0x55aaa695, 0x56a56a95, 0x56955a95, 0x56955695, 0x56955695,
+  0x56955a95, 0x56a56a95, 0x55aaa695, 0x156a9695, 0x05555695, 0x01555695,
+  0x00555695, 0x00005695, 0x00005695, 0x00005695, 0x00005555, 0x00001554,
+  0x00000550, 0x05555500, 0x15555540, 0x55555550, 0x5696a954, 0x569aaa55,
+  0x56a95a95, 0x56a55655, 0x56955554, 0x56951550, 0x56950540, 0x56950000,
+  0x56950000, 0x56950000, 0x56950000, 0x55550000, 0x15540000, 0x05500000,
+  0x00555500, 0x01555540, 0x05555550, 0x156aa954, 0x55aaaa55, 0x56955a95,
+  0x56a95655, 0x55aaa554, 0x155aaa55, 0x15556a95, 0x55955695, 0x56a55a95,
+  0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540, 0x00555500, 0x00550000,
+  0x01554000, 0x05555000, 0x05695540, 0x15695550, 0x55695554, 0x56aaaa54,
+  0x56aaaa54, 0x55695554, 0x15695550, 0x05695540, 0x05695550, 0x05695554,
+  0x05695655, 0x056a5a95, 0x055aaa55, 0x0156a954, 0x00555550, 0x00155540,
+  0x00055500, 0x05500550, 0x15541554, 0x55555555, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955a95,
+  0x56a56a95, 0x55aaa695, 0x156a9695, 0x05555555, 0x01555554, 0x00555550,
+  0x05500550, 0x15541554, 0x55555555, 0x56955695, 0x56955695, 0x56955695,
+  0x55a55a55, 0x15a55a54, 0x15a55a54, 0x15696954, 0x05696950, 0x055aa550,
+  0x015aa540, 0x01569540, 0x00555500, 0x00155400, 0x00055000, 0x05500550,
+  0x15541554, 0x55555555, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56969695, 0x56969695, 0x569aa695, 0x56996695, 0x56a96a95, 0x55a55a55,
+  0x15a55a54, 0x15555554, 0x05555550, 0x01541540, 0x05500550, 0x15541554,
+  0x55555555, 0x56955695, 0x56955695, 0x55a55a55, 0x15696954, 0x055aa550,
+  0x01569540, 0x055aa550, 0x15696954, 0x55a55a55, 0x56955695, 0x56955695,
+  0x55555555, 0x15541554, 0x05500550, 0x05500550, 0x15541554, 0x55555555,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955a95, 0x56a56a95, 0x55aaa695, 0x156a9695, 0x05555695, 0x15555695,
+  0x55955695, 0x56a55a95, 0x55aaaa55, 0x156aa954, 0x05555550, 0x01555540,
+  0x00555500, 0x05555550, 0x15555554, 0x55555555, 0x56aaaa95, 0x56aaaa95,
+  0x55555a55, 0x15556954, 0x0555a550, 0x01569540, 0x055a5550, 0x15695554,
+  0x55a55555, 0x56aaaa95, 0x56aaaa95, 0x55555555, 0x15555554, 0x05555550,
+  0x00015500, 0x00555400, 0x15555005, 0x5a950156, 0xa95015a9, 0x55015a55,
+  0x4015a550, 0x015a5400, 0x55a54015, 0x5a540556, 0xa54056a9, 0x54056a95,
+  0x40556a54, 0x0155a540, 0x055a5400, 0x15a54001, 0x5a550015, 0xa554015a,
+  0x9550156a, 0x950055a9, 0x50015555, 0x00055540, 0x00155000, 0x05501554,
+  0x55555695, 0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955695,
+  0x56955695, 0x56955695, 0x56955695, 0x56955695, 0x56955555, 0x15540550,
+  0x05540001, 0x55500055, 0x5540056a, 0x550056a9, 0x540556a5, 0x40155a54,
+  0x0055a540, 0x015a5400, 0x15a55001, 0x5a554015, 0xa9550156, 0xa950156a,
+  0x95015a95, 0x5015a554, 0x015a5500, 0x15a54005, 0x5a540155, 0xa540556a,
+  0x54056a95, 0x4056a550, 0x05555400, 0x15550000, 0x55400000, 0x01550550,
+  0x05555554, 0x15555555, 0x55a95695, 0x56aa5695, 0x56969695, 0x56969695,
+  0x5695aa95, 0x56956a55, 0x55555554, 0x15555550, 0x05505540,
+  // Font Bytes: 7268
 
   0x00000000
 };
@@ -1324,245 +1946,441 @@ const uint32_t font_large_bold[] = {
   0x00000000
 };
 
-// Font: large-bold-outline (neep-alt-iso8859-1-12x24-bold.bdf)
-const uint32_t font_large_bold_outline[] = {
+// Font: large-bold-combined (neep-alt-iso8859-1-12x24-bold.bdf)
+const uint32_t font_large_bold_combined[] = {
 
   // Font Info: width=12 height=24 descent=5
   0x0005180c,
 
   // Glyph Info:
-  0x5e1ca000, 0x83908009, 0x9e0ca010, 0x960ca01f, 0x9e0ca02d, 0x95ccc03c,
-  0x73908049, 0x87148050, 0x8710805e, 0x94cd006c, 0x9ccd0077, 0x73924083,
-  0x92cd808a, 0x6b1a4091, 0x9f0c8096, 0x9e0ca0a7, 0x7e0ca0b6, 0x9e0ca0c2,
-  0x9e0ca0d1, 0x9e0ca0e0, 0x9e0ca0ef, 0x9e0ca0fe, 0x9e0ca10d, 0x9e0ca11c,
-  0x9e0ca12b, 0x6d59213a, 0x7dd12143, 0x8dd0c14e, 0x940d415b, 0x8dd0c164,
-  0x8e10a171, 0x9e0ca17e, 0x9e0ca18d, 0x9e0ca19c, 0x9e0ca1ab, 0x9e0ca1ba,
-  0x9e0ca1c9, 0x9e0ca1d8, 0x9e0ca1e7, 0x9e0ca1f6, 0x8e10a205, 0x9e0ca212,
-  0x9e0ca221, 0x9e0ca230, 0x9e0ca23f, 0x9e0ca24e, 0x9e0ca25d, 0x9e0ca26c,
-  0x9f0ca27b, 0x9e0ca28c, 0x9e0ca29b, 0x9e0ca2aa, 0x9e0ca2b9, 0x9e0ca2c8,
-  0x9e0ca2d7, 0x9e0ca2e6, 0x9e0ca2f5, 0x9e0ca304, 0x87148313, 0x9f0c8321,
-  0x87108332, 0x8c10a340, 0x9acec349, 0x73988350, 0x9ccd4357, 0x9e0ca363,
-  0x9ccd4372, 0x9e0ca37e, 0x9ccd438d, 0x9e0ca399, 0x9e0d43a8, 0x9e0ca3b7,
-  0x7614a3c6, 0x8f50a3d1, 0x9e0ca3e1, 0x7e14a3f0, 0x9ccd43fc, 0x9ccd4408,
-  0x9ccd4414, 0x9e0d4420, 0x9e0d442f, 0x9ccd443e, 0x9ccd444a, 0x9d8ce456,
-  0x9ccd4464, 0x9ccd4470, 0x9ccd447c, 0x9ccd4488, 0x9e0d4494, 0x9ccd44a3,
-  0x8f1084af, 0x5f1c84be, 0x8f1084c8, 0x9b8cc4d7,
+  0x5e1ca000, 0x83908011, 0x9e0ca01f, 0x960ca03c, 0x9e0ca057, 0x95ccc074,
+  0x7390808e, 0x8714809b, 0x871080b7, 0x94cd00d3, 0x9ccd00e9, 0x73924100,
+  0x92cd810d, 0x6b1a411a, 0x9f0c8124, 0x9e0ca146, 0x7e0ca163, 0x9e0ca17a,
+  0x9e0ca197, 0x9e0ca1b4, 0x9e0ca1d1, 0x9e0ca1ee, 0x9e0ca20b, 0x9e0ca228,
+  0x9e0ca245, 0x6d592262, 0x7dd12274, 0x8dd0c28a, 0x940d42a3, 0x8dd0c2b5,
+  0x8e10a2ce, 0x9e0ca2e8, 0x9e0ca305, 0x9e0ca322, 0x9e0ca33f, 0x9e0ca35c,
+  0x9e0ca379, 0x9e0ca396, 0x9e0ca3b3, 0x9e0ca3d0, 0x8e10a3ed, 0x9e0ca407,
+  0x9e0ca424, 0x9e0ca441, 0x9e0ca45e, 0x9e0ca47b, 0x9e0ca498, 0x9e0ca4b5,
+  0x9f0ca4d2, 0x9e0ca4f4, 0x9e0ca511, 0x9e0ca52e, 0x9e0ca54b, 0x9e0ca568,
+  0x9e0ca585, 0x9e0ca5a2, 0x9e0ca5bf, 0x9e0ca5dc, 0x871485f9, 0x9f0c8615,
+  0x87108637, 0x8c10a653, 0x9acec664, 0x73988672, 0x9ccd467f, 0x9e0ca696,
+  0x9ccd46b3, 0x9e0ca6ca, 0x9ccd46e7, 0x9e0ca6fe, 0x9e0d471b, 0x9e0ca738,
+  0x7614a755, 0x8f50a76a, 0x9e0ca789, 0x7e14a7a6, 0x9ccd47bd, 0x9ccd47d4,
+  0x9ccd47eb, 0x9e0d4802, 0x9e0d481f, 0x9ccd483c, 0x9ccd4853, 0x9d8ce86a,
+  0x9ccd4885, 0x9ccd489c, 0x9ccd48b3, 0x9ccd48ca, 0x9e0d48e1, 0x9ccd48fe,
+  0x8f108915, 0x5f1c8933, 0x8f108947, 0x9b8cc965,
 
   // Bitmap Data:
-  0x1f0ff9ff, 0x7fff1fe3, 0xfc7f8ff1, 0xfe3fc7f8, 0xff1fe3fc, 0x7ffffffe,
-  0x3fc7f8ff, 0xfeff9ff0, 0xf8000000, 0x1ff87ffe, 0x7ffeffff, 0xf18ff18f,
-  0xf18ff18f, 0xf18ff18f, 0xffff7ffe, 0x7ffe1ff8, 0x07fc03ff, 0xe07ffc1f,
-  0xffc3c478, 0xf88f9f11, 0xf7e23ff0, 0x01fe003f, 0xc007fe23, 0xffc47fe0,
-  0x03fc007f, 0x800ffc47, 0xef88f9f1, 0x1f1e23c3, 0xfff83ffe, 0x07ffc03f,
-  0xe0000000, 0x01e001fe, 0x007f807f, 0xf83f3f1f, 0xcfe7c0fb, 0xe01ff003,
-  0xfc49ff03, 0xfbe03e7c, 0x07dfc0ff, 0x923fc00f, 0xf807df03, 0xe7f3f8fc,
-  0xfc1ffe01, 0xfe007f80, 0x07800000, 0x0fdf07ff, 0xf9ffff3f, 0xffff871f,
-  0xe063fc48, 0xff891ef0, 0x07df01f1, 0xfe3e3f8f, 0xc3f1fc7c, 0x7f8f80fb,
-  0xe00f7889, 0xff113fc6, 0x07f8e1ff, 0xfffcffff, 0x9fffe0fb, 0xf0000000,
-  0x07e007fe, 0x03ffc1ff, 0xf87c3e3e, 0x07cf00f3, 0xc63cf18f, 0xbe07e783,
-  0xffe08ff1, 0x03fc60ff, 0x1c7fc31f, 0xf003fe00, 0xf7c23dff, 0xff3fff87,
-  0xffe07fe0, 0x07e07fe1, 0xff8fff3c, 0x3df0f787, 0xfe3ef1fb, 0xcfcffe1f,
-  0xf07f8078, 0x00000000, 0x00f803fe, 0x07fe0fff, 0x1f8f1f1f, 0x3e3e3c7e,
-  0x7c7c78f8, 0xf8f0f1f0, 0xf1e0f1e0, 0xf1e0f1e0, 0xf1f0f8f0, 0x78f87c7c,
-  0x3c7e3e3e, 0x1f1f1f8f, 0x0fff07fe, 0x03fe00f8, 0x1f007fc0, 0x7fe0fff0,
-  0xf1f8f8f8, 0x7c7c7e3c, 0x3e3e1f1e, 0x0f1f0f8f, 0x078f078f, 0x078f078f,
-  0x0f8f0f1f, 0x1f1e3e3e, 0x7e3c7c7c, 0xf8f8f1f8, 0xfff07fe0, 0x7fc01f00,
-  0x07f807ff, 0x83fff0ff, 0xfc7ccf9e, 0x31e7c0fb, 0xf87ff003, 0xfc00ff00,
-  0x3ff87f7c, 0x0f9e31e7, 0xccf8fffc, 0x3fff07ff, 0x807f8000, 0x01f000ff,
-  0x801ff007, 0xff01f1f0, 0xfe3f9fc7, 0xf7f8fff0, 0x01fe003f, 0xc007ff8f,
-  0xf7f1fcfe, 0x3f87c7c0, 0x7ff007fc, 0x00ff8007, 0xc0000000, 0x07e07fe1,
-  0xff8fff3c, 0x3df0f787, 0xfe3ef1fb, 0xcfcffe1f, 0xf07f8078, 0x00000000,
-  0x1ffe1fff, 0xe7fffbff, 0xfff003fc, 0x00ff003f, 0xffff7fff, 0x9fffe1ff,
-  0xe0000000, 0x0f81ff1f, 0xfcffef8f, 0xf83fc1ff, 0x1f7ff3ff, 0x8ff81f00,
-  0x000f0007, 0xf801ff00, 0x3ff00f9e, 0x01e3c07c, 0x780f1f03, 0xe3c078f8,
-  0x1f1e03c7, 0xc0f8f01e, 0x3e07c780, 0xf1f03e3c, 0x078f81f1, 0xe03c7c0f,
-  0x8f01e3e0, 0x3c78079f, 0x00ffc00f, 0xf801fe00, 0x0f000000, 0x03f801ff,
-  0xc07ffc1f, 0xffc3e0f8, 0xf80f9e00, 0xf7c71ff1, 0xf1fe3e3f, 0xc7c7f888,
-  0xff111fe3, 0xe3fc7c7f, 0x8f8ff8e3, 0xef0079f0, 0x1f1f07c3, 0xfff83ffe,
-  0x03ff801f, 0xc0000000, 0x00f007f8, 0x1ff07ff1, 0xf9e7e3df, 0x87be0ff8,
-  0x1fe23ffc, 0x7bf8f7f1, 0xe3e3c3c7, 0x878f0f1e, 0x1e3c3c78, 0x78f0ffe0,
-  0xff81ff00, 0xf8000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00,
-  0x7f8f0ffb, 0xf1effc3d, 0xff0f9fc3, 0xe3f0fcfc, 0x3f1f0ff7, 0xc3fef0ff,
-  0xfe003fc0, 0x07f800ff, 0xfffeffff, 0x9ffff0ff, 0xf8000000, 0x1fff0fff,
-  0xf9ffff7f, 0xffff001f, 0xe003fc00, 0x7fff1f7f, 0xc7cff1f8, 0x7c1f0781,
-  0xf3f01eff, 0xc3dffc7f, 0xdf8ff1e1, 0xfe003fe0, 0x0fbe03e7, 0xfffc7fff,
-  0x07ffc03f, 0xe0000000, 0x01fc00ff, 0xe01ffc07, 0xffc0f078, 0x3e0f0781,
-  0xe1f03c3c, 0x478f88f1, 0xe31e7c63, 0xef1c7de3, 0x8ffc007f, 0x800ff001,
-  0xfff8fdff, 0x1f3fe3e1, 0xfff803fe, 0x007fc003, 0xe0000000, 0x1ffe0fff,
-  0xf1fffe7f, 0xffef003d, 0xe007bc00, 0xf78ffef1, 0xffde20fb, 0xc00ff800,
-  0xff1e1fff, 0xe3dffc7f, 0xdf8ff1e1, 0xfe003fe0, 0x0fbe03e7, 0xfffc7fff,
-  0x07ffc03f, 0xe0000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00,
-  0x7f878ff1, 0xfbfe3ffb, 0xc41f7801, 0xff001fe1, 0xc3fc7c7f, 0x8f8ff0e1,
-  0xfe003fe0, 0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1fff0fff,
-  0xf9ffff7f, 0xffff001f, 0xe003fc00, 0x7fff0f7f, 0xe3eff878, 0x7f1f03c3,
-  0xc0f8f81e, 0x1e07c7c0, 0xf0f03e3e, 0x078780f1, 0xf01e3c03, 0xff803fe0,
-  0x07fc003e, 0x00000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00,
-  0x7f870ff1, 0xf1fe3e3f, 0xc387fc01, 0xff803fe1, 0xc3fc7c7f, 0x8f8ff0e1,
-  0xfe003fe0, 0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x07fc03ff,
-  0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f870ff1, 0xf1fe3e3f, 0xc387f800,
-  0xff801ef8, 0x23dffc7f, 0xdf8ff1e1, 0xfe003fe0, 0x0fbe03e7, 0xfffc7fff,
-  0x07ffc03f, 0xe0000000, 0x0f81ff1f, 0xfcffef8f, 0xf83fc1ff, 0x1f7ff3ff,
-  0x8ff8ffe7, 0xff7c7fc1, 0xfe0ff8fb, 0xff9ffc7f, 0xc0f80000, 0x03e01ff0,
-  0x7ff0ffe3, 0xe3e783cf, 0x079f1f1f, 0xfc3ff87f, 0xe0ffc3ff, 0xc7879f0f,
-  0x3c3ef8f9, 0xe3f3cfc7, 0xff07fc0f, 0xf0078000, 0x0038007f, 0x007fc07f,
-  0xe07ef87e, 0x3c7e1e7e, 0x1f7e1f3e, 0x1fbe1f9e, 0x1f8f87e3, 0xe1f9f87c,
-  0x7e1f1f87, 0x87e3c1fb, 0xe07fe01f, 0xf007f000, 0xe0000000, 0x1ffe1fff,
-  0xe7fffbff, 0xfff003fc, 0x00ff003f, 0xffffffff, 0xfc00ff00, 0x3fc00fff,
-  0xffdfffe7, 0xfff87ff8, 0x0e001fc0, 0x1ff00ffc, 0x0fbf078f, 0xc3c3f1f0,
-  0xfc7c3f3f, 0x0f8fc3e3, 0xf0f3f0fb, 0xf0f9f0fd, 0xf0fcf0fc, 0x78fc3efc,
-  0x0ffc07fc, 0x01fc0038, 0x00000000, 0x1ff83fff, 0x1fffdfff, 0xef00ff80,
-  0x3fc01fff, 0x8f7f8fbf, 0x8f8f8fc7, 0x8fc3c7c1, 0xe3c0f1e0, 0x7ff03ff8,
-  0x1e3c0f1e, 0x078f03ff, 0x80ff807f, 0xc00f8000, 0x03fc01ff, 0xe07ffe1f,
-  0xffe7e07c, 0xf807fe00, 0x7f878ff1, 0xc1fe703f, 0xcc07f98c, 0xff319fe6,
-  0x03fce07f, 0x8e0ff0ff, 0xff00f9f0, 0x1f3f03c3, 0xfff83ffe, 0x03ffc01f,
-  0xe0000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f870ff1,
-  0xf1fe3e3f, 0xc7c7f800, 0xff001fe0, 0x03fc7c7f, 0x8f8ff1f1, 0xfe3e3fc7,
-  0xc7f8f8ff, 0xfffeffff, 0x9ffff0f8, 0xf8000000, 0x1ff00fff, 0x81fff87f,
-  0xff8f01f1, 0xe01f3c01, 0xe78c3cf1, 0xc79e38f3, 0xc63f7803, 0xef003fe3,
-  0xc3fc7c7f, 0x8f8ff1e1, 0xfe003fc0, 0x0ff803ef, 0xfffcffff, 0x1fffc0ff,
-  0xe0000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f878ff1,
-  0xfbfe3ffb, 0xc7ff78ff, 0xcf1ff9e3, 0xffbc7ff7, 0x8fdff0f1, 0xfe003fe0,
-  0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1ff00fff, 0x81fff87f,
-  0xff8f01f9, 0xe01fbc01, 0xf78e1ff1, 0xe1fe3e3f, 0xc7c7f8f8, 0xff1f1fe3,
-  0xe3fc7c7f, 0x8f0ff1c3, 0xfe00fbc0, 0x3f780fcf, 0xfff0fffc, 0x1fff00ff,
-  0x80000000, 0x1fff0fff, 0xf9ffff7f, 0xffff001f, 0xe003fc00, 0x7f8ffff1,
-  0xffde3ffb, 0xc01e7803, 0xcf0079e3, 0xff3c7ff7, 0x8ffef1ff, 0xfe003fc0,
-  0x07f800ff, 0xfffeffff, 0x9ffff0ff, 0xf8000000, 0x1fff0fff, 0xf9ffff7f,
-  0xffff001f, 0xe003fc00, 0x7f8ffff1, 0xffde3ffb, 0xc01e7803, 0xcf0079e3,
-  0xff3c7fc7, 0x8ff8f1fc, 0x1e3c03c7, 0x8078f00f, 0xfe00ff80, 0x1ff000f8,
-  0x00000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f878ff1,
-  0xfbfe3ffb, 0xc7fff8c0, 0xff181fe3, 0x03fc7c7f, 0x8f8ff0f1, 0xfe003fe0,
-  0x07be01f7, 0xfffc7fff, 0x87ffe03f, 0xf0000000, 0x1f1f0fff, 0xf9ffff7f,
-  0xffff1f1f, 0xe3e3fc7c, 0x7f8f8ff1, 0xf1fe3e3f, 0xc007f800, 0xff001fe3,
-  0xe3fc7c7f, 0x8f8ff1f1, 0xfe3e3fc7, 0xc7f8f8ff, 0xfffeffff, 0x9ffff0f8,
-  0xf8000000, 0x1ffc3fff, 0x9fffdfff, 0xff007f80, 0x3fc01ffc, 0x7f7e3f3f,
-  0x1f878f03, 0xc781e3c0, 0xf1e1f8fc, 0xfc7efe3f, 0xf803fc01, 0xfe00ffff,
-  0xfbfff9ff, 0xfc3ff800, 0x01ff00ff, 0xf81fff07, 0xfff0f01e, 0x1e03c3c0,
-  0x787f8f07, 0xf1e0fe3c, 0x07c78778, 0xf3ff1eff, 0xe3dffc7f, 0xdf8ff1e1,
-  0xfe003fe0, 0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1f3f0fff,
-  0xf9ffff7f, 0xffff1e1f, 0xe387fc61, 0xf7887ef0, 0x1f9e07e3, 0xc078780f,
-  0x8f00f1e3, 0x1f3c61e7, 0x8e3ef1c3, 0xde3c7fc7, 0x87f8f8ff, 0xfffeffff,
-  0x9ffff0f8, 0xf8000000, 0x1f000ff8, 0x01ff007f, 0xf00f1e01, 0xe3c03c78,
-  0x078f00f1, 0xe01e3c03, 0xc78078f0, 0x0f1e01e3, 0xfe3c7ff7, 0x8ffef1ff,
-  0xfe003fc0, 0x07f800ff, 0xfffeffff, 0x9ffff0ff, 0xf8000000, 0x1f1f0fff,
-  0xf9ffff7f, 0xffff1f1f, 0xe3e3fc38, 0x7f870ff0, 0x41fe003f, 0xc007f888,
-  0xff111fe3, 0x63fc6c7f, 0x8f8ff1f1, 0xfe3e3fc7, 0xc7f8f8ff, 0xfffeffff,
-  0x9ffff0f8, 0xf8000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc3c,
-  0x7f878ff0, 0x71fe0e3f, 0xc0c7f898, 0xff111fe3, 0x23fc607f, 0x8e0ff1c1,
-  0xfe3c3fc7, 0x87f8f8ff, 0xfffeffff, 0x9ffff0f8, 0xf8000000, 0x07fc03ff,
-  0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f870ff1, 0xf1fe3e3f, 0xc7c7f8f8,
-  0xff1f1fe3, 0xe3fc7c7f, 0x8f8ff0e1, 0xfe003fe0, 0x0fbe03e7, 0xfffc7fff,
-  0x07ffc03f, 0xe0000000, 0x1ffc0fff, 0xe1fffe7f, 0xffef007d, 0xe007fc00,
-  0x7f8f0ff1, 0xf1fe3e3f, 0xc787f800, 0xff003fe0, 0x0fbc7ff7, 0x8ffcf1ff,
-  0x1e3f83c7, 0x8078f00f, 0xfe00ff80, 0x1ff000f8, 0x00000000, 0x07fc03ff,
-  0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f870ff1, 0xf1fe3e3f, 0xc7c7f8f8,
-  0xff1f1fe3, 0xe3fc7c7f, 0x8f8ff0e1, 0xfe003fe0, 0x0fbe03e7, 0xf0fe7f03,
-  0xc7f0783f, 0x0f03ffe0, 0x3ff803ff, 0x001f8000, 0x1ffc0fff, 0xe1fffe7f,
-  0xffef007d, 0xe007fc00, 0x7f8f0ff1, 0xf1fe3e3f, 0xc787f800, 0xff003fe0,
-  0x0fbc07f7, 0x887ef187, 0xde387fc7, 0x87f8f8ff, 0xfffeffff, 0x9ffff0f8,
-  0xf8000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f878ff1,
-  0xfbfe1ffb, 0xe0ff3e07, 0xe7f07cff, 0x87dff87f, 0xdf8ff1e1, 0xfe003fe0,
-  0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1fff0fff, 0xf9ffff7f,
-  0xffff001f, 0xe003fc00, 0x7ff8ff7f, 0x1fcfe3f8, 0x7c7c078f, 0x00f1e01e,
-  0x3c03c780, 0x78f00f1e, 0x01e3c03c, 0x78078f00, 0xffe00ff8, 0x01ff000f,
-  0x80000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c, 0x7f8f8ff1,
-  0xf1fe3e3f, 0xc7c7f8f8, 0xff1f1fe3, 0xe3fc7c7f, 0x8f8ff0e1, 0xfe003fe0,
-  0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1f1f0fff, 0xf9ffff7f,
-  0xffff1f1f, 0xe3e3fc7c, 0x7f8f8ff1, 0xf1fe3e3f, 0xc7c7f870, 0xff8e3ef0,
-  0x879f11f1, 0xe03c3e0f, 0x83c1e07c, 0x7c078f00, 0xffe00ff8, 0x01ff000f,
-  0x80000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c, 0x7f8f8ff1,
-  0xf1fe3e3f, 0xc7c7f8d8, 0xff1b1fe2, 0x23fc447f, 0x800ff041, 0xfe083fe3,
-  0x8fbc71e7, 0xfffc7fff, 0x0fffe07d, 0xf0000000, 0x1f1f0fff, 0xf9ffff7f,
-  0xffff1f1f, 0xe3e3fc38, 0x7fc71f78, 0x43cf88f8, 0xf01e1f07, 0xc3e0f878,
-  0x0f1f11f3, 0xc21ef8e3, 0xfe1c3fc7, 0xc7f8f8ff, 0xfffeffff, 0x9ffff0f8,
-  0xf8000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c, 0x7f8f8ff1,
-  0xf1fe1c3f, 0xc007fc01, 0xf7c07cfe, 0x3f8fc7e0, 0xf8f80f1e, 0x01e3c03c,
-  0x78078f00, 0xffe00ff8, 0x01ff000f, 0x80000000, 0x1fff0fff, 0xf9ffff7f,
-  0xffff001f, 0xe003fc00, 0x7fff8f7f, 0xe1eff87c, 0x7e1f1f87, 0xe7e1f8f8,
-  0x7e3e1ff7, 0x87fef1ff, 0xfe003fc0, 0x07f800ff, 0xfffeffff, 0x9ffff0ff,
-  0xf8000000, 0x1ff87ffe, 0x7ffeffff, 0xf00ff00f, 0xf00ff1ff, 0xf1fef1fe,
-  0xf1f8f1e0, 0xf1e0f1e0, 0xf1e0f1e0, 0xf1e0f1f8, 0xf1fef1fe, 0xf1fff00f,
-  0xf00ff00f, 0xffff7ffe, 0x7ffe1ff8, 0x1e000ff0, 0x01ff007f, 0xe00f3e01,
-  0xe3c03c7c, 0x07c78078, 0xf80f8f00, 0xf1f01f1e, 0x01e3e03e, 0x3c03c7c0,
-  0x7c78078f, 0x80f8f00f, 0x1f01f1e0, 0x1e3e03e3, 0xc03c7807, 0xcf007fe0,
-  0x0ff800ff, 0x00078000, 0x1ff87ffe, 0x7ffeffff, 0xf00ff00f, 0xf00fff8f,
-  0x7f8f7f8f, 0x1f8f078f, 0x078f078f, 0x078f078f, 0x078f1f8f, 0x7f8f7f8f,
-  0xff8ff00f, 0xf00ff00f, 0xffff7ffe, 0x7ffe1ff8, 0x03e007fc, 0x03fe03ff,
-  0x81e3c1f1, 0xf0f078f8, 0x3e788f7c, 0x47fc71fe, 0x38fffffb, 0xfff9fffc,
-  0x3ef80000, 0x1fff0fff, 0xf9ffff7f, 0xffff001f, 0xe003fc00, 0x7fffff7f,
-  0xffcffff8, 0x7ffc0000, 0x1f81ff87, 0xfe3ffcf0, 0xf3c3ef87, 0x9f1f7e3c,
-  0xfcf1ffc3, 0xfe07f807, 0x80000000, 0x07fc03ff, 0xe07ffe1f, 0xffe3c07c,
-  0x7807cf00, 0x7bff8f7c, 0x01ff003f, 0xc007f8f8, 0xff001ff0, 0x03df047b,
-  0xffff3fff, 0xc3fff81f, 0xfc000000, 0x1f000ff8, 0x01ff007f, 0xf00f1e01,
-  0xe3f83c7f, 0xc78ffcf1, 0xffde30fb, 0xc40ff800, 0xff0e1fe3, 0xe3fc7c7f,
-  0x8f8ff0e1, 0xfe003fc4, 0x0ff8c3ef, 0xfffcffff, 0x1fffc0ff, 0xe0000000,
-  0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f879ff1, 0xffde3ffb,
-  0xc7ff7879, 0xff001ff0, 0x07df01f3, 0xfffe3fff, 0x83ffe01f, 0xf0000000,
-  0x001f000f, 0xf801ff00, 0x7ff00f1e, 0x0fe3c7fc, 0x79ff8f7f, 0xf1ef863f,
-  0xe047f800, 0xff0e1fe3, 0xe3fc7c7f, 0x8f8ff0e1, 0xfe003fe0, 0x47be18f7,
-  0xfffe7fff, 0x87fff03f, 0xf8000000, 0x07fc03ff, 0xe0fffe3f, 0xffe7c07d,
-  0xf007fc00, 0x7f8f8ff0, 0x01fe003f, 0xc007f8ff, 0xff003df0, 0x079f00f3,
-  0xfffe3fff, 0x83fff01f, 0xf8000000, 0x01fc00ff, 0xe03ffe0f, 0xffe1f07c,
-  0x7c07cf00, 0x79e19f7c, 0x7fcf8ffb, 0xf1ff7801, 0xef003de0, 0x07bf1ff3,
-  0xe3fc7c7f, 0x878fc0f1, 0xe01e3c03, 0xff803fe0, 0x07fc003e, 0x00000000,
-  0x07ff03ff, 0xf8ffff3f, 0xfff7c31f, 0xf023fc00, 0x7f870ff1, 0xf1fe3e3f,
-  0xc387f800, 0xff811ef8, 0x63dffc7f, 0xdf8ff1e1, 0xfe003fe0, 0x0fbe03e7,
-  0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1f000ff8, 0x01ff007f, 0xf00f1e01,
-  0xe3f83c7f, 0xc78ffcf1, 0xffde30fb, 0xc40ff800, 0xff0e1fe3, 0xe3fc7c7f,
-  0x8f8ff1f1, 0xfe3e3fc7, 0xc7f8f8ff, 0xfffeffff, 0x9ffff0f8, 0xf8000000,
-  0x03e03fe0, 0xff87ff1e, 0x3c78f7e3, 0xdfffffff, 0xc0ff03fc, 0x0ffe3df8,
-  0xf7e3c78f, 0x1e3c78f1, 0xe3c78f1f, 0xfc3fe0ff, 0x80f80000, 0x007c00ff,
-  0x807fc07f, 0xf03c781e, 0x3c3f1e1f, 0xff1fff8f, 0x03c781e3, 0xc0f1fc78,
-  0x7e3c3f1e, 0x078f0fc7, 0x9fe3dff1, 0xeff8ffbc, 0x7f8c3fc0, 0x1ff01f7c,
-  0x1f3fff8f, 0xff83ff80, 0x7f000000, 0x1f000ff8, 0x01ff007f, 0xf00f1e01,
-  0xe3fc3c7f, 0xe78ffcf1, 0xffde387b, 0xc61f7887, 0xcf01f9e0, 0x7e3c0fc7,
-  0x80fcf10f, 0xde30fbc7, 0x0ff8f0ff, 0xfffeffff, 0x9ffff0f9, 0xf8000000,
-  0x1f00ff81, 0xff07ff0f, 0x1e1e3c3c, 0x7878f0f1, 0xe1e3c3c7, 0x878f0f1e,
-  0x1e3e3c7f, 0x78fef0ff, 0xe03fe07b, 0xe0f7ffe7, 0xff87ff03, 0xf8000000,
-  0x1ffe0fff, 0xf1ffff7f, 0xffef223f, 0xe003fc00, 0x7f888ff1, 0x11fe223f,
-  0xc447f888, 0xff111fe2, 0x23fc7c7f, 0xffff7fff, 0xcffff87c, 0x7c000000,
-  0x1ffc0fff, 0xe1fffe7f, 0xffef187d, 0xe207fc00, 0x7f870ff1, 0xf1fe3e3f,
-  0xc7c7f8f8, 0xff1f1fe3, 0xe3fc7c7f, 0xffff7fff, 0xcffff87c, 0x7c000000,
-  0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f870ff1, 0xf1fe3e3f,
-  0xc7c7f870, 0xff001ff0, 0x07df01f3, 0xfffe3fff, 0x83ffe01f, 0xf0000000,
-  0x1ffc0fff, 0xe1fffe7f, 0xffef187d, 0xe207fc00, 0x7f870ff1, 0xf1fe3e3f,
-  0xc387f800, 0xff103fe3, 0x0fbc7ff7, 0x8ffcf1ff, 0x1e3f83c7, 0x8078f00f,
-  0xfe00ff80, 0x1ff000f8, 0x00000000, 0x07ff03ff, 0xf8ffff3f, 0xfff7c31f,
-  0xf023fc00, 0x7f870ff1, 0xf1fe3e3f, 0xc387f800, 0xff811ef8, 0x63dffc79,
-  0xff8f1ff1, 0xe0fe3c03, 0xc78078f0, 0x0ffe00ff, 0x801ff000, 0xf8000000,
-  0x1ffc0fff, 0xe1fffe7f, 0xffef187d, 0xe207fc00, 0x7f879ff1, 0xffde3ffb,
-  0xc7fe78ff, 0x0f1e01e3, 0xc03c7807, 0xff007fc0, 0x0ff8007c, 0x00000000,
-  0x07fc03ff, 0xe0fffe3f, 0xffe7c07d, 0xf007fc00, 0x7f8f9ff0, 0x1fdf007d,
-  0xfc07fcf8, 0xff001ff0, 0x07df01f3, 0xfffe3fff, 0x83ffe01f, 0xf0000000,
-  0x07c003fe, 0x007fc01f, 0xff07c7f8, 0xf8ff3f1f, 0xf7801ef0, 0x03de007b,
-  0xf1ff3e3f, 0xc7c7fc78, 0xff8f0cf9, 0xe00f3e03, 0xe3e0f87f, 0xff07ffc0,
-  0x7ff003f8, 0x00000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c,
-  0x7f8f8ff1, 0xf1fe3e3f, 0xc7c7f870, 0xff001ff0, 0x23df0c7b, 0xffff3fff,
-  0xc3fff81f, 0xfc000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc38,
-  0x7fc71f78, 0xe3cf0879, 0xf11f1e03, 0xc3e0f83c, 0x1e07c7c0, 0x7ff00ffe,
-  0x00ff8007, 0xc0000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c,
-  0x7f8d8ff1, 0x11fe223f, 0xc007f820, 0xff041ff1, 0xc7de38f3, 0xfffe3fff,
-  0x87fff03e, 0xf8000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe1c3fe10,
-  0xfbe03e7e, 0x0fc7e3f1, 0xf83f3e03, 0xef843fe1, 0xc3fc7c7f, 0xffff7fff,
-  0xcffff87c, 0x7c000000, 0x1f1f0fff, 0xf9ffff7f, 0xffff1f1f, 0xe3e3fc7c,
-  0x7f8f8ff1, 0xf1fe3e3f, 0xc387f800, 0xff811ef8, 0x63dffc7f, 0xdf8ff1e1,
-  0xfe003fe0, 0x0fbe03e7, 0xfffc7fff, 0x07ffc03f, 0xe0000000, 0x1fff0fff,
-  0xf9ffff7f, 0xffff001f, 0xe003fc00, 0x7fff0f7f, 0x83efc1fb, 0xe0ff787f,
-  0xff001fe0, 0x03fc007f, 0xffff7fff, 0xcffff87f, 0xfc000000, 0x00fc01ff,
-  0x81ffc1ff, 0xf0f878f8, 0x3c781e3c, 0x3f1e3f0f, 0x1f9f8f0f, 0xc78fc3c7,
-  0x83e3c1f1, 0xf8787e3c, 0x3f1e078f, 0xc3c7e1e1, 0xf8f03c7c, 0x1e1f0f0f,
-  0xff83ff80, 0xffc01f80, 0x1f0ff9ff, 0x7fff1fe3, 0xfc7f8ff1, 0xfe3fc7f8,
-  0xff1fe3fc, 0x7f8ff1fe, 0x3fc7f8ff, 0x1fe3fc7f, 0x8fffeff9, 0xff0f8000,
-  0x1f803ff0, 0x1ffc1fff, 0x0f0f8783, 0xe3c0f1f8, 0x787e3c3f, 0x1e078fc3,
-  0xc7e1e1f8, 0xf83c7c1e, 0x3c3f1e3f, 0x0f1f9f8f, 0x0fc78fc3, 0xc781e3c1,
-  0xf1e1f0ff, 0xf83ff81f, 0xf803f000, 0x07df03ff, 0xf8ffff3f, 0xfff7c71f,
-  0xf063fc04, 0x7f880ff1, 0x83fe38fb, 0xffff3fff, 0xc7fff03e, 0xf8000000,
-  // Font Bytes: 4992
+  0x01550055, 0x55415555, 0x15555555, 0xa95556a5, 0x555a9555, 0x6a5555a9,
+  0x5556a555, 0x5a95556a, 0x5555a955, 0x56a5555a, 0x95555555, 0x55555556,
+  0xa5555a95, 0x556a5555, 0x55545555, 0x41555500, 0x55400000, 0x01555540,
+  0x15555554, 0x15555554, 0x55555555, 0x55a96a55, 0x55a96a55, 0x55a96a55,
+  0x55a96a55, 0x55a96a55, 0x55a96a55, 0x55555555, 0x15555554, 0x15555554,
+  0x01555540, 0x00155550, 0x00055555, 0x54001555, 0x55500155, 0x55555005,
+  0x5a9a9540, 0x556a6a55, 0x4155a9a9, 0x551556a6, 0xa55555aa, 0xaaa95556,
+  0xaaaaa555, 0x5aaaaa95, 0x5556a6a5, 0x55555a9a, 0x955556aa, 0xaaa5555a,
+  0xaaaa9555, 0x6aaaaa55, 0x555a9a95, 0x54556a6a, 0x554155a9, 0xa9550156,
+  0xa6a55005, 0x55555540, 0x05555554, 0x00155555, 0x50000555, 0x54000000,
+  0x00015400, 0x00015554, 0x00001555, 0x40001555, 0x55400555, 0xa5550155,
+  0x5a555415, 0x5aaa5545, 0x56aaa955, 0x55aaaaa5, 0x555a9a69, 0x5555aaa5,
+  0x554556aa, 0xa554155a, 0xaa955155, 0x5aaa5555, 0x69a6a555, 0x5aaaaa55,
+  0x556aaa95, 0x5155aaa5, 0x541555a5, 0x5540555a, 0x55500155, 0x55540001,
+  0x55540000, 0x15554000, 0x00154000, 0x00555155, 0x00155555, 0x55415555,
+  0x55550555, 0x55555555, 0x6a95a955, 0x56aa96a5, 0x555a9a6a, 0x55556a69,
+  0xa95455aa, 0xaa955155, 0xaaa95501, 0x5556a554, 0x05556a55, 0x500555a9,
+  0x5550155a, 0x95554055, 0x6aaa5545, 0x56aaaa55, 0x156a6a69, 0x5555a9a9,
+  0xa5555a96, 0xaa95556a, 0x56a95555, 0x55555550, 0x55555555, 0x41555555,
+  0x54005545, 0x55000000, 0x00155400, 0x00155554, 0x00055555, 0x50015555,
+  0x5540155a, 0xa5540556, 0xaa955055, 0xaaaa5505, 0x5a96a550, 0x55a96a55,
+  0x4556aa95, 0x54156aa5, 0x555556aa, 0x6a5555a9, 0xaaa5555a, 0x96aa5555,
+  0xa95a9555, 0x5aa5a955, 0x55aaaaa5, 0x5556aaaa, 0x55155aa6, 0xa5515555,
+  0x55550555, 0x55554015, 0x55555400, 0x15555400, 0x00155400, 0x15555401,
+  0x55554055, 0x5555055a, 0xa55155aa, 0x55156a95, 0x5556a554, 0x55a95545,
+  0x5a555055, 0x55540155, 0x55001555, 0x40001540, 0x00000000, 0x00005540,
+  0x00055554, 0x00155554, 0x00555555, 0x01556a55, 0x0155a955, 0x0556a554,
+  0x055a9554, 0x155a9550, 0x156a5540, 0x556a5500, 0x55a95500, 0x55a95400,
+  0x55a95400, 0x55a95400, 0x55a95400, 0x55a95500, 0x556a5500, 0x156a5540,
+  0x155a9550, 0x055a9554, 0x0556a554, 0x0155a955, 0x01556a55, 0x00555555,
+  0x00155554, 0x00055554, 0x00005540, 0x01550000, 0x15555000, 0x15555400,
+  0x55555500, 0x55a95540, 0x556a5540, 0x155a9550, 0x1556a550, 0x0556a554,
+  0x0155a954, 0x0055a955, 0x00556a55, 0x00156a55, 0x00156a55, 0x00156a55,
+  0x00156a55, 0x00556a55, 0x0055a955, 0x0155a954, 0x0556a554, 0x1556a550,
+  0x155a9550, 0x556a5540, 0x55a95540, 0x55555500, 0x15555400, 0x15555000,
+  0x01550000, 0x00155540, 0x00155555, 0x40055555, 0x55005555, 0x5550155a,
+  0x5a554156, 0xa5a95415, 0x5aaa5545, 0x556a9555, 0x55aaaaa5, 0x555aaaaa,
+  0x5555aaaa, 0xa555556a, 0x9555155a, 0xaa554156, 0xa5a95415, 0x5a5a5540,
+  0x55555550, 0x05555555, 0x00155555, 0x40001555, 0x40000000, 0x00015500,
+  0x00005555, 0x40000155, 0x55000015, 0x55550001, 0x55a95500, 0x5556a555,
+  0x41555a95, 0x5515556a, 0x555555aa, 0xaaa95556, 0xaaaaa555, 0x5aaaaa95,
+  0x55556a55, 0x551555a9, 0x55505556, 0xa5554015, 0x5a955000, 0x15555500,
+  0x00155550, 0x00005555, 0x40000015, 0x50000000, 0x00155400, 0x15555401,
+  0x55554055, 0x5555055a, 0xa55155aa, 0x55156a95, 0x5556a554, 0x55a95545,
+  0x5a555055, 0x55540155, 0x55001555, 0x40001540, 0x00000000, 0x01555554,
+  0x01555555, 0x54155555, 0x55455555, 0x555555aa, 0xaaa5555a, 0xaaaa5555,
+  0xaaaaa555, 0x55555555, 0x15555555, 0x41555555, 0x54015555, 0x54000000,
+  0x00554001, 0x55550155, 0x55505555, 0x54556a55, 0x556aa555, 0x5aa95555,
+  0xa9551555, 0x55055555, 0x40555540, 0x01550000, 0x00000055, 0x00000015,
+  0x55400001, 0x55550000, 0x05555500, 0x00556954, 0x000156a5, 0x5000155a,
+  0x95400055, 0xa9550005, 0x56a55000, 0x156a5540, 0x0155a954, 0x00055a95,
+  0x5000556a, 0x55000156, 0xa5540015, 0x5a954000, 0x55a95500, 0x0556a550,
+  0x00156a55, 0x400155a9, 0x5400055a, 0x95500055, 0x6a550001, 0x56a55400,
+  0x055a9540, 0x00156955, 0x00005555, 0x50000055, 0x55400001, 0x55540000,
+  0x00550000, 0x00000000, 0x00055540, 0x00015555, 0x50001555, 0x55500155,
+  0x55555005, 0x56aa5540, 0x556aaa55, 0x4156aaaa, 0x55155a95, 0xa95555a9,
+  0x55a95556, 0xa556a555, 0x5a955a95, 0x556a6a6a, 0x5555a9a9, 0xa95556a5,
+  0x56a5555a, 0x955a9555, 0x6a556a55, 0x556a56a5, 0x5455aaaa, 0x954155aa,
+  0xa9550155, 0xaa955005, 0x55555540, 0x05555554, 0x00055555, 0x40000155,
+  0x50000000, 0x00005500, 0x00155540, 0x01555500, 0x15555501, 0x55695415,
+  0x56a55155, 0x6a954556, 0xaa55556a, 0xa95556a6, 0xa555555a, 0x9545556a,
+  0x551555a9, 0x540556a5, 0x50055a95, 0x40156a55, 0x0055a954, 0x0156a550,
+  0x055a9540, 0x156a5500, 0x55555400, 0x55554001, 0x55550000, 0x55400000,
+  0x00155550, 0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551,
+  0x55aaaa95, 0x555aaaaa, 0x95556a55, 0xaa555565, 0x55a95455, 0x555aa551,
+  0x5555aa55, 0x41555aa5, 0x540555aa, 0x5550555a, 0xa5550155, 0xaa555515,
+  0x5aa55554, 0x55aa5555, 0x5556aaaa, 0xa5555aaa, 0xaa95556a, 0xaaaa5555,
+  0x55555554, 0x55555555, 0x41555555, 0x55005555, 0x55400000, 0x01555555,
+  0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xaaaaa955, 0x56aaaaa5,
+  0x555aaaaa, 0x95555555, 0xa9551555, 0x5a955055, 0x55a95540, 0x155aa955,
+  0x00156aa9, 0x550555aa, 0xa9545555, 0x5aa55155, 0x555a9555, 0x59556a55,
+  0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550,
+  0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x00015550, 0x00005555,
+  0x54000155, 0x55500015, 0x55555000, 0x55aa9540, 0x0556aa55, 0x00156aa9,
+  0x540155aa, 0xa550055a, 0x9a954055, 0x6a6a5501, 0x56a5a954, 0x155a96a5,
+  0x5455a95a, 0x955156a5, 0x6a55555a, 0xaaaa9555, 0x6aaaaa55, 0x55aaaaa9,
+  0x5555556a, 0x55515555, 0xa9550555, 0x56a55401, 0x55555540, 0x00055554,
+  0x00001555, 0x50000005, 0x54000000, 0x01555554, 0x00555555, 0x55015555,
+  0x55541555, 0x55555455, 0xaaaaa551, 0x56aaaa95, 0x455aaaaa, 0x55156a55,
+  0x555455a9, 0x55555156, 0xa6aa5545, 0x5aaaaa55, 0x556aaaaa, 0x5555a956,
+  0xa9555555, 0x56a55155, 0x555a9555, 0x59556a55, 0x55a956a9, 0x5556aaaa,
+  0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550, 0x15555555, 0x00155555,
+  0x50000555, 0x54000000, 0x00155550, 0x00055555, 0x54005555, 0x55540555,
+  0x55555415, 0x5aaa9551, 0x55aaaa95, 0x555aaaaa, 0x95556a95, 0x6a5555a9,
+  0x55655556, 0xa5555545, 0x5a9aa955, 0x156aaaa9, 0x5555aaaa, 0xa95556a9,
+  0x5aa5555a, 0x955a9555, 0x6a556a55, 0x55aa56a9, 0x5556aaaa, 0xa55556aa,
+  0xaa554556, 0xaaa55415, 0x55555550, 0x15555555, 0x00155555, 0x50000555,
+  0x54000000, 0x01555555, 0x00555555, 0x55415555, 0x55551555, 0x55555555,
+  0xaaaaa955, 0x56aaaaa5, 0x555aaaaa, 0x95555555, 0xaa551555, 0x56a55455,
+  0x556a9540, 0x1555a955, 0x00055aa5, 0x5000556a, 0x55400156, 0xa9540015,
+  0x5a955000, 0x55aa5500, 0x0556a554, 0x00156a95, 0x400055a9, 0x55000156,
+  0xa5500005, 0x55554000, 0x05555400, 0x00155550, 0x00000554, 0x00000000,
+  0x00155550, 0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551,
+  0x55aaaa95, 0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555,
+  0x5aa56a95, 0x555aaaa9, 0x55556aaa, 0xa55556a9, 0x5aa5555a, 0x955a9555,
+  0x6a556a55, 0x55aa56a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415,
+  0x55555550, 0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x00155550,
+  0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95,
+  0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5aa56a95,
+  0x556aaaaa, 0x55556aaa, 0xa954556a, 0xa6a55155, 0x555a9555, 0x59556a55,
+  0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550,
+  0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x00554001, 0x55550155,
+  0x55505555, 0x54556a55, 0x556aa555, 0x5aa95555, 0xa9551555, 0x55055555,
+  0x40555540, 0x55555415, 0x5555155a, 0x95555aa9, 0x5556aa55, 0x556a5545,
+  0x55554155, 0x55501555, 0x50005540, 0x00000000, 0x00055400, 0x01555500,
+  0x15555500, 0x55555405, 0x56a55415, 0x6aa55055, 0xaa954155, 0xa9550155,
+  0x55500555, 0x55401555, 0x54005555, 0x50055555, 0x50156a95, 0x4155aa55,
+  0x055aa554, 0x556a5541, 0x56a55505, 0x5a555015, 0x55550015, 0x55500055,
+  0x55000015, 0x40000000, 0x00000540, 0x00001555, 0x00001555, 0x50001555,
+  0x54001556, 0x55401556, 0xa5501556, 0xa9541556, 0xa9551556, 0xa9550556,
+  0xa9554556, 0xa9554156, 0xa9554055, 0x6a955405, 0x56a95541, 0x556a9550,
+  0x1556a955, 0x01556a95, 0x401556a5, 0x50015565, 0x54001555, 0x54000155,
+  0x55000015, 0x55000000, 0x54000000, 0x01555554, 0x01555555, 0x54155555,
+  0x55455555, 0x555555aa, 0xaaa5555a, 0xaaaa5555, 0xaaaaa555, 0x55555555,
+  0x55555555, 0x555aaaaa, 0x5555aaaa, 0xa5555aaa, 0xaa555555, 0x55555155,
+  0x55555415, 0x55555540, 0x15555540, 0x00540000, 0x01555000, 0x01555500,
+  0x00555550, 0x00556555, 0x00156a55, 0x50055aa5, 0x550155aa, 0x5550155a,
+  0xa5550555, 0xaa554055, 0x5aa55405, 0x55aa5505, 0x55aa5545, 0x55aa5541,
+  0x55aa5551, 0x55aa5550, 0x55aa5550, 0x156a5550, 0x05565550, 0x00555550,
+  0x00155550, 0x00015550, 0x00000540, 0x00000000, 0x01555540, 0x05555555,
+  0x01555555, 0x51555555, 0x5455aaaa, 0x55556aaa, 0xa5555aaa, 0xa9555555,
+  0x6a551555, 0x6a554555, 0x6a554055, 0x6a555015, 0x6a555005, 0x5a955001,
+  0x56a55000, 0x55a95400, 0x15555500, 0x05555540, 0x0156a550, 0x0055a954,
+  0x00156a55, 0x00055555, 0x40005555, 0x40001555, 0x50000055, 0x40000000,
+  0x00055550, 0x00015555, 0x54001555, 0x55540155, 0x55555415, 0x56aa9550,
+  0x556aaa95, 0x5556aaaa, 0x95556a95, 0x6a5555a9, 0x5aa95556, 0x95aaa555,
+  0x5a5aaa95, 0x55696a5a, 0x5555a5a9, 0x69555696, 0xaaa5555a, 0x56aa9555,
+  0x6a56aa55, 0x55aa5555, 0x5555aaaa, 0x554155aa, 0xa9550555, 0xaaa55005,
+  0x55555540, 0x05555554, 0x00055555, 0x50000155, 0x54000000, 0x00155550,
+  0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95,
+  0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5a955a95,
+  0x556aaaaa, 0x5555aaaa, 0xa95556aa, 0xaaa5555a, 0x955a9555, 0x6a556a55,
+  0x55a955a9, 0x5556a556, 0xa5555a95, 0x5a95556a, 0x556a5555, 0x55555554,
+  0x55555555, 0x41555555, 0x55005540, 0x55400000, 0x01555500, 0x00555555,
+  0x40015555, 0x55401555, 0x55554055, 0xaaa95501, 0x56aaa955, 0x055aaaa9,
+  0x54156a5a, 0xa55055a9, 0x5a954156, 0xa56a5505, 0x5a96a555, 0x156aaaa5,
+  0x5455aaaa, 0xa55556a5, 0x5aa5555a, 0x955a9555, 0x6a556a55, 0x55a956a9,
+  0x5556aaaa, 0xa5555aaa, 0xaa55556a, 0xaaa55455, 0x55555550, 0x55555555,
+  0x01555555, 0x50005555, 0x54000000, 0x00155550, 0x00055555, 0x54005555,
+  0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95, 0x555aaaaa, 0x95556a95,
+  0x6a5555a9, 0x55655556, 0xa5555545, 0x5a955555, 0x156a5555, 0x5055a955,
+  0x554156a5, 0x5555455a, 0x95555515, 0x6a555955, 0x55aa55a9, 0x5556aaaa,
+  0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550, 0x15555555, 0x00155555,
+  0x50000555, 0x54000000, 0x01555500, 0x00555555, 0x40015555, 0x55401555,
+  0x55554055, 0xaaa95541, 0x56aaa955, 0x455aaaa9, 0x55156a56, 0xa95555a9,
+  0x56a95556, 0xa556a555, 0x5a955a95, 0x556a556a, 0x5555a955, 0xa95556a5,
+  0x56a5555a, 0x955a9555, 0x6a55aa55, 0x55a95aa5, 0x5556aaaa, 0x55455aaa,
+  0xa555156a, 0xaa555055, 0x55555500, 0x55555550, 0x01555555, 0x00005555,
+  0x40000000, 0x01555555, 0x00555555, 0x55415555, 0x55551555, 0x55555555,
+  0xaaaaa955, 0x56aaaaa5, 0x555aaaaa, 0x95556a55, 0x555555a9, 0x55555156,
+  0xa5555545, 0x5aaaa954, 0x156aaaa5, 0x5055aaaa, 0x954156a5, 0x5555055a,
+  0x95555515, 0x6a555554, 0x55a95555, 0x5556aaaa, 0xa5555aaa, 0xaa95556a,
+  0xaaaa5555, 0x55555554, 0x55555555, 0x41555555, 0x55005555, 0x55400000,
+  0x01555555, 0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xaaaaa955,
+  0x56aaaaa5, 0x555aaaaa, 0x95556a55, 0x555555a9, 0x55555156, 0xa5555545,
+  0x5aaaa954, 0x156aaaa5, 0x5055aaaa, 0x954156a5, 0x5555055a, 0x95555015,
+  0x6a555540, 0x55a95550, 0x0156a550, 0x00055a95, 0x4000156a, 0x55000055,
+  0x55540000, 0x55554000, 0x01555500, 0x00005540, 0x00000000, 0x00155550,
+  0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95,
+  0x555aaaaa, 0x95556a95, 0x6a5555a9, 0x55655556, 0xa5555545, 0x5a955555,
+  0x556a5aaa, 0x5555a96a, 0xa95556a5, 0xaaa5555a, 0x955a9555, 0x6a556a55,
+  0x55aa55a9, 0x5556aaaa, 0xa55556aa, 0xaa954556, 0xaaa95515, 0x55555550,
+  0x15555555, 0x40155555, 0x54000555, 0x55000000, 0x01550155, 0x00555555,
+  0x55415555, 0x55551555, 0x55555555, 0xa955a955, 0x56a556a5, 0x555a955a,
+  0x95556a55, 0x6a5555a9, 0x55a95556, 0xa556a555, 0x5aaaaa95, 0x556aaaaa,
+  0x5555aaaa, 0xa95556a5, 0x56a5555a, 0x955a9555, 0x6a556a55, 0x55a955a9,
+  0x5556a556, 0xa5555a95, 0x5a95556a, 0x556a5555, 0x55555554, 0x55555555,
+  0x41555555, 0x55005540, 0x55400000, 0x01555550, 0x05555555, 0x41555555,
+  0x51555555, 0x5555aaaa, 0x95556aaa, 0xa5555aaa, 0xa955555a, 0x95551556,
+  0xa5550555, 0xa9554015, 0x6a550005, 0x5a954001, 0x56a55000, 0x55a95401,
+  0x556a5550, 0x555a9554, 0x5556a555, 0x556aaaa5, 0x555aaaa9, 0x5556aaaa,
+  0x55555555, 0x55455555, 0x55415555, 0x55500555, 0x55400000, 0x00015555,
+  0x00005555, 0x55400155, 0x55550015, 0x55555500, 0x55aaa954, 0x0156aaa5,
+  0x50055aaa, 0x95401555, 0x6a550015, 0x55a95400, 0x5556a550, 0x00155a95,
+  0x4015156a, 0x55055555, 0xa9545555, 0x56a55155, 0x555a9555, 0x59556a55,
+  0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550,
+  0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x01550555, 0x00555555,
+  0x55415555, 0x55551555, 0x55555555, 0xa956a955, 0x56a56a95, 0x555a96a9,
+  0x55156a6a, 0x955455aa, 0xa9554156, 0xaa955405, 0x5aaa9540, 0x156aaa55,
+  0x4055aaaa, 0x550156a5, 0xa955055a, 0x96a95415, 0x6a56a554, 0x55a95aa5,
+  0x5156a55a, 0x95555a95, 0x6a95556a, 0x556a5555, 0x55555554, 0x55555555,
+  0x41555555, 0x55005540, 0x55400000, 0x01550000, 0x00555540, 0x00015555,
+  0x00001555, 0x55000055, 0xa9540001, 0x56a55000, 0x055a9540, 0x00156a55,
+  0x000055a9, 0x54000156, 0xa5500005, 0x5a954000, 0x156a5500, 0x0055a954,
+  0x000156a5, 0x5554055a, 0x95555515, 0x6a555554, 0x55a95555, 0x5556aaaa,
+  0xa5555aaa, 0xaa95556a, 0xaaaa5555, 0x55555554, 0x55555555, 0x41555555,
+  0x55005555, 0x55400000, 0x01550155, 0x00555555, 0x55415555, 0x55551555,
+  0x55555555, 0xa955a955, 0x56a556a5, 0x555aa56a, 0x95556a95, 0xaa5555aa,
+  0x9aa95556, 0xaaaaa555, 0x5aaaaa95, 0x556a6a6a, 0x5555a9a9, 0xa95556a5,
+  0x96a5555a, 0x965a9555, 0x6a556a55, 0x55a955a9, 0x5556a556, 0xa5555a95,
+  0x5a95556a, 0x556a5555, 0x55555554, 0x55555555, 0x41555555, 0x55005540,
+  0x55400000, 0x01550155, 0x00555555, 0x55415555, 0x55551555, 0x55555555,
+  0xa955a955, 0x56a556a5, 0x555aa55a, 0x95556a95, 0x6a5555aa, 0x95a95556,
+  0xaa56a555, 0x5aaa5a95, 0x556a696a, 0x5555a9a9, 0xa95556a5, 0xa6a5555a,
+  0x96aa9555, 0x6a56aa55, 0x55a95aa9, 0x5556a55a, 0xa5555a95, 0x6a95556a,
+  0x556a5555, 0x55555554, 0x55555555, 0x41555555, 0x55005540, 0x55400000,
+  0x00155550, 0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551,
+  0x55aaaa95, 0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555,
+  0x5a955a95, 0x556a556a, 0x5555a955, 0xa95556a5, 0x56a5555a, 0x955a9555,
+  0x6a556a55, 0x55aa56a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415,
+  0x55555550, 0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x01555550,
+  0x00555555, 0x54015555, 0x55541555, 0x55555455, 0xaaaa9551, 0x56aaaa95,
+  0x555aaaaa, 0x95556a55, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5a956a95,
+  0x556aaaaa, 0x5555aaaa, 0xa55556aa, 0xaa55455a, 0x95555515, 0x6a555550,
+  0x55a95555, 0x0156a555, 0x40055a95, 0x4000156a, 0x55000055, 0x55540000,
+  0x55554000, 0x01555500, 0x00005540, 0x00000000, 0x00155550, 0x00055555,
+  0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95, 0x555aaaaa,
+  0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5a955a95, 0x556a556a,
+  0x5555a955, 0xa95556a5, 0x56a5555a, 0x955a9555, 0x6a556a55, 0x55aa56a9,
+  0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55aa5554, 0x1555aaa5,
+  0x501555aa, 0x95400555, 0xaa550005, 0x55555400, 0x05555540, 0x00055555,
+  0x00000155, 0x40000000, 0x01555550, 0x00555555, 0x54015555, 0x55541555,
+  0x55555455, 0xaaaa9551, 0x56aaaa95, 0x555aaaaa, 0x95556a55, 0xaa5555a9,
+  0x55a95556, 0xa556a555, 0x5a956a95, 0x556aaaaa, 0x5555aaaa, 0xa55556aa,
+  0xaa55455a, 0xaa955515, 0x6a6a9554, 0x55a96a95, 0x5156a56a, 0x95555a95,
+  0x6a95556a, 0x556a5555, 0x55555554, 0x55555555, 0x41555555, 0x55005540,
+  0x55400000, 0x00155550, 0x00055555, 0x54005555, 0x55540555, 0x55555415,
+  0x5aaa9551, 0x55aaaa95, 0x555aaaaa, 0x95556a95, 0x6a5555a9, 0x55655556,
+  0xa9555545, 0x56aa5555, 0x0556aa95, 0x541555aa, 0x95505555, 0x6a955155,
+  0x556a9555, 0x59556a55, 0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556,
+  0xaaa55415, 0x55555550, 0x15555555, 0x00155555, 0x50000555, 0x54000000,
+  0x01555555, 0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xaaaaa955,
+  0x56aaaaa5, 0x555aaaaa, 0x9555556a, 0x55551555, 0xa9555055, 0x56a55540,
+  0x155a9550, 0x00156a55, 0x000055a9, 0x54000156, 0xa5500005, 0x5a954000,
+  0x156a5500, 0x0055a954, 0x000156a5, 0x5000055a, 0x95400015, 0x6a550000,
+  0x55555400, 0x00555540, 0x00015555, 0x00000055, 0x40000000, 0x01550155,
+  0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xa955a955, 0x56a556a5,
+  0x555a955a, 0x95556a55, 0x6a5555a9, 0x55a95556, 0xa556a555, 0x5a955a95,
+  0x556a556a, 0x5555a955, 0xa95556a5, 0x56a5555a, 0x955a9555, 0x6a556a55,
+  0x55aa56a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550,
+  0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x01550155, 0x00555555,
+  0x55415555, 0x55551555, 0x55555555, 0xa955a955, 0x56a556a5, 0x555a955a,
+  0x95556a55, 0x6a5555a9, 0x55a95556, 0xa556a555, 0x5a955a95, 0x556a95aa,
+  0x55556a56, 0xa55455aa, 0x6a954155, 0xa9a95501, 0x56aaa550, 0x0556aa55,
+  0x40055aa9, 0x5400155a, 0x95500015, 0x6a550000, 0x55555400, 0x00555540,
+  0x00015555, 0x00000055, 0x40000000, 0x01550155, 0x00555555, 0x55415555,
+  0x55551555, 0x55555555, 0xa955a955, 0x56a556a5, 0x555a955a, 0x95556a55,
+  0x6a5555a9, 0x55a95556, 0xa556a555, 0x5a955a95, 0x556a596a, 0x5555a965,
+  0xa95556a6, 0xa6a5555a, 0x9a9a9555, 0x6aaaaa55, 0x55aa9aa9, 0x5556aa6a,
+  0xa55556a5, 0x6a55455a, 0x95a95415, 0x55555550, 0x15555555, 0x00555555,
+  0x54001551, 0x55000000, 0x01550155, 0x00555555, 0x55415555, 0x55551555,
+  0x55555555, 0xa955a955, 0x56a556a5, 0x555aa56a, 0x95555a95, 0xa955156a,
+  0x9aa55055, 0x6a6a5540, 0x55aaa954, 0x0155aa95, 0x500556aa, 0x5540156a,
+  0xaa550155, 0xa9a95505, 0x5aa6a954, 0x556a56a5, 0x5556a95a, 0xa5555a95,
+  0x5a95556a, 0x556a5555, 0x55555554, 0x55555555, 0x41555555, 0x55005540,
+  0x55400000, 0x01550155, 0x00555555, 0x55415555, 0x55551555, 0x55555555,
+  0xa955a955, 0x56a556a5, 0x555a955a, 0x95556a55, 0x6a5555a9, 0x55a95556,
+  0xa95aa555, 0x5aaaaa95, 0x555aaaa9, 0x55155aaa, 0x95505556, 0xa5554055,
+  0x5a955400, 0x556a5540, 0x0055a954, 0x000156a5, 0x5000055a, 0x95400015,
+  0x6a550000, 0x55555400, 0x00555540, 0x00015555, 0x00000055, 0x40000000,
+  0x01555555, 0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xaaaaa955,
+  0x56aaaaa5, 0x555aaaaa, 0x95555555, 0x6a551555, 0x56a95455, 0x556a9550,
+  0x1556a955, 0x01556a95, 0x541556a9, 0x5540556a, 0x95540556, 0xa9555515,
+  0x6a955554, 0x55a95555, 0x5556aaaa, 0xa5555aaa, 0xaa95556a, 0xaaaa5555,
+  0x55555554, 0x55555555, 0x41555555, 0x55005555, 0x55400000, 0x01555540,
+  0x15555554, 0x15555554, 0x55555555, 0x55aaaa55, 0x55aaaa55, 0x55aaaa55,
+  0x55a95555, 0x55a95554, 0x55a95554, 0x55a95540, 0x55a95400, 0x55a95400,
+  0x55a95400, 0x55a95400, 0x55a95400, 0x55a95400, 0x55a95540, 0x55a95554,
+  0x55a95554, 0x55a95555, 0x55aaaa55, 0x55aaaa55, 0x55aaaa55, 0x55555555,
+  0x15555554, 0x15555554, 0x01555540, 0x01540000, 0x00555500, 0x00015555,
+  0x00001555, 0x54000055, 0xa5540001, 0x56a55000, 0x055a9550, 0x00155a95,
+  0x4000156a, 0x55400055, 0x6a550000, 0x55a95500, 0x0155a954, 0x000156a5,
+  0x54000556, 0xa5500005, 0x5a955000, 0x155a9540, 0x00156a55, 0x4000556a,
+  0x55000055, 0xa9550001, 0x55a95400, 0x0156a554, 0x000556a5, 0x5000055a,
+  0x95400015, 0x5a550000, 0x15555400, 0x00555540, 0x00005555, 0x00000015,
+  0x40000000, 0x01555540, 0x15555554, 0x15555554, 0x55555555, 0x55aaaa55,
+  0x55aaaa55, 0x55aaaa55, 0x55556a55, 0x15556a55, 0x15556a55, 0x01556a55,
+  0x00156a55, 0x00156a55, 0x00156a55, 0x00156a55, 0x00156a55, 0x00156a55,
+  0x01556a55, 0x15556a55, 0x15556a55, 0x55556a55, 0x55aaaa55, 0x55aaaa55,
+  0x55aaaa55, 0x55555555, 0x15555554, 0x15555554, 0x01555540, 0x00055400,
+  0x00155550, 0x00055554, 0x00055555, 0x400156a5, 0x500155a9, 0x550055aa,
+  0x9540556a, 0xa554156a, 0x6a55155a, 0x9a95555a, 0x95a95556, 0xa56a5555,
+  0x55555545, 0x55555541, 0x55555550, 0x05545540, 0x01555555, 0x00555555,
+  0x55415555, 0x55551555, 0x55555555, 0xaaaaa955, 0x56aaaaa5, 0x555aaaaa,
+  0x95555555, 0x55551555, 0x55555055, 0x55555540, 0x15555550, 0x00000000,
+  0x01554001, 0x55554015, 0x55540555, 0x555055aa, 0x55055aa5, 0x54556a95,
+  0x4155a955, 0x1556a550, 0x555a5501, 0x55555005, 0x55540015, 0x55400015,
+  0x40000000, 0x00155550, 0x00055555, 0x54001555, 0x55540155, 0x55555405,
+  0x5aaa9550, 0x156aaa95, 0x5055aaaa, 0x95455555, 0x6a55155a, 0xaaa95555,
+  0xaaaaa555, 0x5aaaaa95, 0x556a556a, 0x5555aaaa, 0xa95555aa, 0xaaa55155,
+  0xaa9a9545, 0x55555555, 0x05555555, 0x50055555, 0x55400155, 0x55500000,
+  0x01550000, 0x00555540, 0x00015555, 0x00001555, 0x55000055, 0xa9540001,
+  0x56a55540, 0x055a9555, 0x50156a55, 0x555055a9, 0x55555156, 0xa5aa5545,
+  0x5a9aaa55, 0x556aaaaa, 0x5555aa56, 0xa95556a5, 0x56a5555a, 0x955a9555,
+  0x6a556a55, 0x55aa56a9, 0x5556aaaa, 0xa5555a9a, 0xaa55556a, 0x5aa55455,
+  0x55555550, 0x55555555, 0x01555555, 0x50005555, 0x54000000, 0x00155550,
+  0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95,
+  0x555aaaaa, 0x95556a95, 0x695555a9, 0x55555156, 0xa5555545, 0x5a955555,
+  0x156a9569, 0x5555aaaa, 0xa95555aa, 0xaa955155, 0xaaa95505, 0x55555554,
+  0x05555555, 0x40055555, 0x54000155, 0x55000000, 0x00000155, 0x00000055,
+  0x55400001, 0x55550000, 0x15555500, 0x0055a954, 0x005556a5, 0x5015555a,
+  0x95415555, 0x6a551555, 0x55a95455, 0x6a96a555, 0x56aa9a95, 0x556aaaaa,
+  0x5555aa56, 0xa95556a5, 0x56a5555a, 0x955a9555, 0x6a556a55, 0x55aa56a9,
+  0x5556aaaa, 0xa55556aa, 0x9a954556, 0xa96a5515, 0x55555554, 0x15555555,
+  0x40155555, 0x55000555, 0x55400000, 0x00155550, 0x00055555, 0x54005555,
+  0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95, 0x555aaaaa, 0x95556a55,
+  0x6a5555aa, 0xaaa95556, 0xaaaaa555, 0x5aaaaa95, 0x556a5555, 0x5555aaaa,
+  0xa55155aa, 0xaa954155, 0xaaaa5505, 0x55555554, 0x05555555, 0x40055555,
+  0x55000155, 0x55400000, 0x00015550, 0x00005555, 0x54000555, 0x55540055,
+  0x55555401, 0x55aa9550, 0x155aaa95, 0x5055aaaa, 0x954156a9, 0x6955155a,
+  0x95555055, 0x6a555545, 0x55a95555, 0x156aaaa9, 0x5455aaaa, 0xa55156aa,
+  0xaa954555, 0xa9555505, 0x56a55550, 0x155a9555, 0x40156a55, 0x500055a9,
+  0x54000156, 0xa5500005, 0x55554000, 0x05555400, 0x00155550, 0x00000554,
+  0x00000000, 0x00155555, 0x00055555, 0x55405555, 0x55550555, 0x55555515,
+  0x5aa5a955, 0x55aaa6a5, 0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556,
+  0xa556a555, 0x5aa56a95, 0x556aaaaa, 0x55556aa9, 0xa954556a, 0x96a55155,
+  0x555a9555, 0x59556a55, 0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556,
+  0xaaa55415, 0x55555550, 0x15555555, 0x00155555, 0x50000555, 0x54000000,
+  0x01550000, 0x00555540, 0x00015555, 0x00001555, 0x55000055, 0xa9540001,
+  0x56a55540, 0x055a9555, 0x50156a55, 0x555055a9, 0x55555156, 0xa5aa5545,
+  0x5a9aaa55, 0x556aaaaa, 0x5555aa56, 0xa95556a5, 0x56a5555a, 0x955a9555,
+  0x6a556a55, 0x55a955a9, 0x5556a556, 0xa5555a95, 0x5a95556a, 0x556a5555,
+  0x55555554, 0x55555555, 0x41555555, 0x55005540, 0x55400000, 0x00055400,
+  0x05555400, 0x55554015, 0x55550156, 0xa550156a, 0x551556a5, 0x51555555,
+  0x55555555, 0x5aaa5555, 0xaaa5555a, 0xaa555556, 0xa551556a, 0x551556a5,
+  0x50156a55, 0x0156a550, 0x156a5501, 0x56a55015, 0x6a550155, 0x55500555,
+  0x54005555, 0x40005540, 0x00001550, 0x00005555, 0x40001555, 0x50001555,
+  0x5500055a, 0x95400156, 0xa5500555, 0xa9540155, 0x55550155, 0x55554055,
+  0xaaa55015, 0x6aa95405, 0x5aaa5501, 0x555a9540, 0x1556a550, 0x0555a954,
+  0x00156a55, 0x00555a95, 0x415556a5, 0x515555a9, 0x5455556a, 0x5555655a,
+  0x95556a5a, 0xa5555aaa, 0xa95555aa, 0xa955155a, 0xa9550555, 0x55554055,
+  0x55554005, 0x55554000, 0x15550000, 0x01550000, 0x00555540, 0x00015555,
+  0x00001555, 0x55000055, 0xa9540001, 0x56a55550, 0x055a9555, 0x54156a55,
+  0x555055a9, 0x55555156, 0xa56a9545, 0x5a96a955, 0x156a6a95, 0x5055aaa9,
+  0x554156aa, 0x9554055a, 0xaa555015, 0x6aaa5550, 0x55a9aa55, 0x5156a5aa,
+  0x55455a95, 0xaa55556a, 0x55aa5555, 0x55555554, 0x55555555, 0x41555555,
+  0x55005541, 0x55400000, 0x01550000, 0x55554001, 0x55550015, 0x55550055,
+  0xa9540156, 0xa550055a, 0x9540156a, 0x550055a9, 0x540156a5, 0x50055a95,
+  0x40156a55, 0x0055a954, 0x0156a554, 0x055a9555, 0x156a5554, 0x55aa5555,
+  0x56aaa555, 0x56aa9545, 0x56aa5515, 0x55555415, 0x55554015, 0x55550005,
+  0x55400000, 0x01555554, 0x00555555, 0x55015555, 0x55551555, 0x55555455,
+  0xa6a6a555, 0x56aaaaa5, 0x555aaaaa, 0x95556a6a, 0x6a5555a9, 0xa9a95556,
+  0xa6a6a555, 0x5a9a9a95, 0x556a6a6a, 0x5555a9a9, 0xa95556a6, 0xa6a5555a,
+  0x955a9555, 0x55555555, 0x15555555, 0x50555555, 0x55401550, 0x15500000,
+  0x01555550, 0x00555555, 0x54015555, 0x55541555, 0x55555455, 0xa96a9551,
+  0x56a6aa95, 0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555,
+  0x5a955a95, 0x556a556a, 0x5555a955, 0xa95556a5, 0x56a5555a, 0x955a9555,
+  0x55555555, 0x15555555, 0x50555555, 0x55401550, 0x15500000, 0x00155550,
+  0x00055555, 0x54005555, 0x55540555, 0x55555415, 0x5aaa9551, 0x55aaaa95,
+  0x555aaaaa, 0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5a955a95,
+  0x556a95aa, 0x5555aaaa, 0xa95555aa, 0xaa955155, 0xaaa95505, 0x55555554,
+  0x05555555, 0x40055555, 0x54000155, 0x55000000, 0x01555550, 0x00555555,
+  0x54015555, 0x55541555, 0x55555455, 0xa96a9551, 0x56a6aa95, 0x555aaaaa,
+  0x95556a95, 0xaa5555a9, 0x55a95556, 0xa556a555, 0x5aa56a95, 0x556aaaaa,
+  0x5555a9aa, 0xa55556a5, 0xaa55455a, 0x95555515, 0x6a555550, 0x55a95555,
+  0x0156a555, 0x40055a95, 0x4000156a, 0x55000055, 0x55540000, 0x55554000,
+  0x01555500, 0x00005540, 0x00000000, 0x00155555, 0x00055555, 0x55405555,
+  0x55550555, 0x55555515, 0x5aa5a955, 0x55aaa6a5, 0x555aaaaa, 0x95556a95,
+  0xaa5555a9, 0x55a95556, 0xa556a555, 0x5aa56a95, 0x556aaaaa, 0x55556aa9,
+  0xa954556a, 0x96a55155, 0x555a9541, 0x55556a55, 0x015555a9, 0x54005556,
+  0xa5500005, 0x5a954000, 0x156a5500, 0x00555554, 0x00005555, 0x40000155,
+  0x55000000, 0x55400000, 0x01555550, 0x00555555, 0x54015555, 0x55541555,
+  0x55555455, 0xa96a9551, 0x56a6aa95, 0x555aaaaa, 0x95556a95, 0x695555a9,
+  0x55555156, 0xa5555545, 0x5a955554, 0x156a5555, 0x0055a954, 0x000156a5,
+  0x5000055a, 0x95400015, 0x55550000, 0x15555000, 0x00555540, 0x00001550,
+  0x00000000, 0x00155550, 0x00055555, 0x54005555, 0x55540555, 0x55555415,
+  0x5aaa9551, 0x55aaaa95, 0x555aaaaa, 0x95556a55, 0x695555aa, 0xa9555155,
+  0xaaaa9551, 0x555aaa95, 0x555a556a, 0x5555aaaa, 0xa95555aa, 0xaa955155,
+  0xaaa95505, 0x55555554, 0x05555555, 0x40055555, 0x54000155, 0x55000000,
+  0x00155000, 0x00055554, 0x00001555, 0x50000155, 0x55550015, 0x5a955540,
+  0x556a5555, 0x0555a955, 0x55156aaa, 0xa95455aa, 0xaaa55156, 0xaaaa9545,
+  0x55a95555, 0x0556a555, 0x50155a95, 0x5550156a, 0x55554055, 0xaa5a5541,
+  0x56aaaa55, 0x0556aaa5, 0x540556aa, 0x55401555, 0x55550015, 0x55555000,
+  0x15555500, 0x00055540, 0x00000000, 0x01550155, 0x00555555, 0x55415555,
+  0x55551555, 0x55555555, 0xa955a955, 0x56a556a5, 0x555a955a, 0x95556a55,
+  0x6a5555a9, 0x55a95556, 0xa556a555, 0x5a955a95, 0x556a95aa, 0x5555aaaa,
+  0xa95555aa, 0xa6a55155, 0xaa5a9545, 0x55555555, 0x05555555, 0x50055555,
+  0x55400155, 0x55500000, 0x01550155, 0x00555555, 0x55415555, 0x55551555,
+  0x55555555, 0xa955a955, 0x56a556a5, 0x555aa56a, 0x95555a95, 0xa955156a,
+  0x56a55055, 0xaa6a9541, 0x55a9a955, 0x0156aaa5, 0x500556aa, 0x5540055a,
+  0xa9540015, 0x5a955000, 0x15555500, 0x00555554, 0x00005555, 0x40000015,
+  0x50000000, 0x01550155, 0x00555555, 0x55415555, 0x55551555, 0x55555555,
+  0xa955a955, 0x56a556a5, 0x555a955a, 0x95556a59, 0x6a5555a9, 0xa9a95556,
+  0xa6a6a555, 0x5aaaaa95, 0x556aa6aa, 0x5555aa9a, 0xa95555a9, 0x5a955156,
+  0xa56a5505, 0x55555554, 0x05555555, 0x40155555, 0x55000554, 0x55400000,
+  0x01550155, 0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xa955a955,
+  0x56a95aa5, 0x5556a9aa, 0x554556aa, 0xa5541556, 0xaa555015, 0x56a55501,
+  0x556aa555, 0x0556aaa5, 0x54556a9a, 0xa55556a9, 0x5aa5555a, 0x955a9555,
+  0x55555555, 0x15555555, 0x50555555, 0x55401550, 0x15500000, 0x01550155,
+  0x00555555, 0x55415555, 0x55551555, 0x55555555, 0xa955a955, 0x56a556a5,
+  0x555a955a, 0x95556a55, 0x6a5555a9, 0x55a95556, 0xa556a555, 0x5aa56a95,
+  0x556aaaaa, 0x55556aa9, 0xa954556a, 0x96a55155, 0x555a9555, 0x59556a55,
+  0x55a956a9, 0x5556aaaa, 0xa55556aa, 0xaa554556, 0xaaa55415, 0x55555550,
+  0x15555555, 0x00155555, 0x50000555, 0x54000000, 0x01555555, 0x00555555,
+  0x55415555, 0x55551555, 0x55555555, 0xaaaaa955, 0x56aaaaa5, 0x555aaaaa,
+  0x95555555, 0xaa551555, 0x6aa55455, 0x5aa95545, 0x56aa5555, 0x156a9555,
+  0x5555aaaa, 0xa95556aa, 0xaaa5555a, 0xaaaa9555, 0x55555555, 0x15555555,
+  0x50555555, 0x55401555, 0x55500000, 0x00005550, 0x00015555, 0x40015555,
+  0x50015555, 0x5500556a, 0x9540556a, 0xa550156a, 0xa954055a, 0xa5550156,
+  0xa5550055, 0xa9554155, 0x6a550055, 0x5a954055, 0x5aa55015, 0x6aa55405,
+  0x5aa95501, 0x556a9540, 0x1556a550, 0x0555a954, 0x00156a55, 0x50055a95,
+  0x540156a9, 0x554055aa, 0xa550155a, 0xa9540155, 0xaa550055, 0x55554005,
+  0x55554000, 0x55555000, 0x01554000, 0x01550055, 0x55415555, 0x15555555,
+  0xa95556a5, 0x555a9555, 0x6a5555a9, 0x5556a555, 0x5a95556a, 0x5555a955,
+  0x56a5555a, 0x95556a55, 0x55a95556, 0xa5555a95, 0x556a5555, 0xa95556a5,
+  0x555a9555, 0x6a555555, 0x54555541, 0x55550055, 0x40000000, 0x01554000,
+  0x05555500, 0x01555550, 0x01555555, 0x0055aa55, 0x40156aa5, 0x54055aaa,
+  0x5501556a, 0x95401556, 0xa5500555, 0xa9540015, 0x6a555005, 0x5a955401,
+  0x56a95540, 0x556aa550, 0x155aa954, 0x055aa555, 0x0156a555, 0x0055a955,
+  0x41556a55, 0x00555a95, 0x40555aa5, 0x50156aa9, 0x54055aa9, 0x550156a9,
+  0x55005555, 0x55400555, 0x55400155, 0x55400005, 0x55000000, 0x00155155,
+  0x00055555, 0x55405555, 0x55550555, 0x55555515, 0x5a95a955, 0x55aa96a5,
+  0x555aaa9a, 0x95556a6a, 0xaa5555a9, 0x6aa55556, 0xa56a5545, 0x55555555,
+  0x05555555, 0x50155555, 0x55000554, 0x55400000,
+  // Font Bytes: 9688
 
   0x00000000
 };
 
-// Total Size: 33168
+// Total Size: 52768
 
 #ifdef __cplusplus
 }
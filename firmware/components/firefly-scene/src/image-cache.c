@@ -0,0 +1,312 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+
+bool _ffx_sceneFlipbook_isValid(const uint16_t *data, size_t length);
+bool _ffx_sceneTileMap_isValid(const uint16_t *data, size_t length);
+
+
+// Registered images are kept in a list, moved to the front each time
+// they are drawn, so the back holds the least recently drawn. The
+// resident copies are only freed while sequencing, after the previous
+// renders are freed and before any new render can read them.
+
+//////////////////////////
+// Residency
+
+static void evictImage(Scene *scene, ImageEntry *entry) {
+    ffx_scene_memFree(scene, entry->copy);
+    entry->copy = NULL;
+
+    scene->imageStats.used -= entry->length;
+    scene->imageStats.resident--;
+    scene->imageStats.evictions++;
+}
+
+// Returns the entry to evict to make room for an image of %%priority%%;
+// the least recently drawn of the lowest priority which is not being
+// drawn this frame (or NULL if there is none)
+static ImageEntry* findVictim(Scene *scene, uint8_t priority) {
+    ImageEntry *victim = NULL;
+
+    for (ImageEntry *entry = scene->imageHead; entry;
+      entry = entry->nextEntry) {
+
+        if (entry->copy == NULL || entry->refs) { continue; }
+        if (entry->priority > priority) { continue; }
+
+        if (victim == NULL || entry->priority <= victim->priority) {
+            victim = entry;
+        }
+    }
+
+    return victim;
+}
+
+// Evict entries until %%length%% more bytes fit in %%budget%%, returning
+// false if they cannot
+static bool makeRoom(Scene *scene, size_t length, uint8_t priority,
+  size_t budget) {
+
+    if (length > budget) { return false; }
+
+    // Check the room can be made first, so nothing is evicted for an
+    // image which cannot be loaded anyway
+    size_t used = scene->imageStats.used;
+    size_t available = (used < budget) ? budget - used: 0;
+
+    if (available < length) {
+        size_t evictable = 0;
+        for (ImageEntry *entry = scene->imageHead; entry;
+          entry = entry->nextEntry) {
+            if (entry->copy == NULL || entry->refs) { continue; }
+            if (entry->priority > priority) { continue; }
+            evictable += entry->length;
+        }
+
+        if (available + evictable < length) { return false; }
+    }
+
+    while (scene->imageStats.used + length > budget) {
+        ImageEntry *victim = findVictim(scene, priority);
+        if (victim == NULL) { return false; }
+        evictImage(scene, victim);
+    }
+
+    return true;
+}
+
+static bool loadImage(Scene *scene, ImageEntry *entry) {
+    size_t budget = atomic_load_explicit(&scene->imageBudget,
+      memory_order_relaxed);
+
+    if (!makeRoom(scene, entry->length, entry->priority, budget)) {
+        return false;
+    }
+
+    uint16_t *copy = ffx_scene_memAlloc(scene, entry->length);
+    if (copy == NULL) { return false; }
+
+    memcpy(copy, entry->data, entry->length);
+
+    entry->copy = copy;
+    scene->imageStats.used += entry->length;
+    scene->imageStats.resident++;
+    scene->imageStats.loads++;
+
+    return true;
+}
+
+const uint16_t* ffx_sceneNode_acquireImage(FfxNode node,
+  const uint16_t *data) {
+
+    Scene *scene = ((Node*)node)->scene;
+
+    ImageEntry *prevEntry = NULL;
+    ImageEntry *entry = scene->imageHead;
+    while (entry && entry->data != data) {
+        prevEntry = entry;
+        entry = entry->nextEntry;
+    }
+
+    if (entry == NULL) { return data; }
+
+    // Move to the front; the most recently drawn
+    if (prevEntry) {
+        prevEntry->nextEntry = entry->nextEntry;
+        entry->nextEntry = scene->imageHead;
+        scene->imageHead = entry;
+    }
+
+    if (entry->copy == NULL && !loadImage(scene, entry)) {
+        scene->imageStats.misses++;
+        return data;
+    }
+
+    entry->refs++;
+    scene->imageStats.hits++;
+
+    return entry->copy;
+}
+
+
+//////////////////////////
+// Sequencing
+
+// Returns the entry for %%data%%, unlinking it from the list
+static ImageEntry* takeEntry(Scene *scene, const uint16_t *data) {
+    ImageEntry *prevEntry = NULL;
+
+    ImageEntry *entry = scene->imageHead;
+    while (entry) {
+        if (entry->data == data) {
+            if (prevEntry == NULL) {
+                scene->imageHead = entry->nextEntry;
+            } else {
+                prevEntry->nextEntry = entry->nextEntry;
+            }
+            return entry;
+        }
+
+        prevEntry = entry;
+        entry = entry->nextEntry;
+    }
+
+    return NULL;
+}
+
+static void freeEntry(Scene *scene, ImageEntry *entry) {
+    if (entry->copy) {
+        ffx_scene_memFree(scene, entry->copy);
+        scene->imageStats.used -= entry->length;
+        scene->imageStats.resident--;
+    }
+
+    scene->imageStats.registered--;
+
+    ffx_scene_memFree(scene, entry);
+}
+
+void ffx_scene_attachImages(Scene *scene) {
+
+    // The renders reading the copies have been freed
+    for (ImageEntry *entry = scene->imageHead; entry;
+      entry = entry->nextEntry) {
+        entry->refs = 0;
+    }
+
+    ImageEntry *entries = atomic_exchange_explicit(&scene->pendingImages,
+      NULL, memory_order_acquire);
+
+    // The stack is most-recent first; reverse it so the latest request
+    // for an image wins
+    ImageEntry *ordered = NULL;
+    while (entries) {
+        ImageEntry *nextEntry = entries->nextEntry;
+        entries->nextEntry = ordered;
+        ordered = entries;
+        entries = nextEntry;
+    }
+
+    while (ordered) {
+        ImageEntry *entry = ordered;
+        ordered = entry->nextEntry;
+
+        ImageEntry *existing = takeEntry(scene, entry->data);
+
+        if (entry->remove) {
+            if (existing) { freeEntry(scene, existing); }
+            ffx_scene_memFree(scene, entry);
+            continue;
+        }
+
+        // Re-registering keeps the copy, but moves to the back, as it
+        // is not drawn yet
+        if (existing) {
+            existing->priority = entry->priority;
+            ffx_scene_memFree(scene, entry);
+            entry = existing;
+        } else {
+            scene->imageStats.registered++;
+        }
+
+        ImageEntry **tail = &scene->imageHead;
+        while (*tail) { tail = &(*tail)->nextEntry; }
+        entry->nextEntry = NULL;
+        *tail = entry;
+    }
+
+    // The budget may have shrunk
+    size_t budget = atomic_load_explicit(&scene->imageBudget,
+      memory_order_relaxed);
+    while (scene->imageStats.used > budget) {
+        ImageEntry *victim = findVictim(scene, 0xff);
+        if (victim == NULL) { break; }
+        evictImage(scene, victim);
+    }
+
+    scene->imageStats.budget = budget;
+}
+
+void ffx_scene_freeImages(Scene *scene) {
+    ImageEntry *entry = scene->imageHead;
+    scene->imageHead = NULL;
+
+    while (entry) {
+        ImageEntry *nextEntry = entry->nextEntry;
+        freeEntry(scene, entry);
+        entry = nextEntry;
+    }
+
+    entry = atomic_exchange(&scene->pendingImages, NULL);
+    while (entry) {
+        ImageEntry *nextEntry = entry->nextEntry;
+        ffx_scene_memFree(scene, entry);
+        entry = nextEntry;
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool queueEntry(Scene *scene, const uint16_t *data, size_t length,
+  uint8_t priority, bool remove) {
+
+    ImageEntry *entry = ffx_scene_memAlloc(scene, sizeof(ImageEntry));
+    if (entry == NULL) { return false; }
+
+    entry->data = data;
+    entry->length = length;
+    entry->priority = priority;
+    entry->remove = remove;
+
+    ImageEntry *head = atomic_load_explicit(&scene->pendingImages,
+      memory_order_relaxed);
+    do {
+        entry->nextEntry = head;
+    } while (!atomic_compare_exchange_weak_explicit(&scene->pendingImages,
+      &head, entry, memory_order_release, memory_order_relaxed));
+
+    return true;
+}
+
+// Whether %%data%% is any data a node reads from a copy, holding every
+// byte its header implies, so the copy covers all of it
+static bool isValid(const uint16_t *data, size_t length) {
+    if (data == NULL) { return false; }
+    if (ffx_scene_getImageSize(data, length).width != 0) { return true; }
+    return _ffx_sceneFlipbook_isValid(data, length) ||
+      _ffx_sceneTileMap_isValid(data, length);
+}
+
+void ffx_scene_setImageCacheBudget(FfxScene _scene, size_t budget) {
+    Scene *scene = _scene;
+    atomic_store_explicit(&scene->imageBudget, budget, memory_order_relaxed);
+}
+
+bool ffx_scene_registerImage(FfxScene scene, const uint16_t *data,
+  size_t length, uint8_t priority) {
+
+    if (!isValid(data, length)) {
+        printf("image cache: invalid image\n");
+        return false;
+    }
+
+    return queueEntry(scene, data, length, priority, false);
+}
+
+void ffx_scene_unregisterImage(FfxScene scene, const uint16_t *data) {
+    if (data == NULL) { return; }
+    queueEntry(scene, data, 0, 0, true);
+}
+
+void ffx_scene_getImageCacheStats(FfxScene _scene,
+  FfxImageCacheStats *stats) {
+
+    Scene *scene = _scene;
+    *stats = scene->imageStats;
+}
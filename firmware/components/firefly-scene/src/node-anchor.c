@@ -39,7 +39,8 @@ static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
     if (enterFunc && !enterFunc(node, arg)) { return false; }
 
     AnchorNode *anchor = ffx_sceneNode_getState(node, &vtable);
-    if (!ffx_sceneNode_walk(anchor->child, enterFunc, exitFunc, arg)) {
+    if (anchor->child &&
+      !ffx_sceneNode_walk(anchor->child, enterFunc, exitFunc, arg)) {
         return false;
     }
 
@@ -74,7 +75,7 @@ static void dumpFunc(FfxNode node, int indent) {
 
     for (int i = 0; i < indent; i++) { printf("  "); }
     printf("<Anchor tag=%d data=%p>\n", anchor->tag, &anchor[1]);
-    ffx_sceneNode_dump(anchor->child, indent + 1);
+    if (anchor->child) { ffx_sceneNode_dump(anchor->child, indent + 1); }
 }
 
 
@@ -87,11 +88,11 @@ FfxNode ffx_scene_createAnchor(FfxScene scene, FfxNodeTag tag, size_t dataSize,
     FfxNode node = ffx_scene_createNode(scene, &vtable,
       sizeof(AnchorNode) + dataSize);
 
-    if (ffx_sceneNode_hasFlags(child, NodeFlagHasParent)) {
+    if (((Node*)child)->parent) {
         printf("child already has a parent; not added\n");
         child = NULL;
     } else {
-        ffx_sceneNode_setFlags(child, NodeFlagHasParent);
+        ((Node*)child)->parent = node;
     }
 
     AnchorNode *anchor = ffx_sceneNode_getState(node, &vtable);
@@ -105,6 +106,19 @@ bool ffx_scene_isAnchor(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneAnchor_stateSize() {
+    return sizeof(AnchorNode);
+}
+
+// See: node.c
+void _ffx_sceneAnchor_detachChild(FfxNode node, FfxNode child) {
+    AnchorNode *anchor = ffx_sceneNode_getState(node, &vtable);
+    if (anchor == NULL) { return; }
+    if (anchor->child == child) { anchor->child = NULL; }
+    ((Node*)child)->parent = NULL;
+}
+
 
 //////////////////////////
 // Properties
@@ -12,7 +12,7 @@ typedef struct BoxNode {
 typedef struct BoxRender {
     FfxPoint position;
     FfxSize size;
-    color_ffxt color;
+    FfxColorRGB565 color;
 } BoxRender;
 
 
@@ -54,7 +54,7 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     pos.x += worldPos.x;
     pos.y += worldPos.y;
 
-    if (pos.x >= 240 || pos.y >= 240) { return; }
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
 
     BoxNode *box = ffx_sceneNode_getState(node, &vtable);
 
@@ -63,26 +63,22 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
 
     BoxRender *render = ffx_scene_createRender(node, sizeof(BoxRender));
     render->size = box->size;
-    render->color = box->color;
+    render->color = ffx_color_parseRGB565(box->color);
     render->position = pos;
 }
 
-static void renderBoxBlend(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height, color_ffxt _color) {
-
-    FfxColorRGB color = ffx_color_parseRGB(_color);
-
-    // Pad alpha with 11 zeros (i.e. 0x20 => 0x10000; 1 in fixed-point)
-    fixed_ffxt alpha = color.opacity << 11;
-    fixed_ffxt alpha_1 = FM_1 - alpha;
+static void renderBoxBlend(uint16_t *frameBuffer, int32_t stride,
+  int32_t ox, int32_t oy, int32_t width, int32_t height,
+  const FfxColorRGB565 *color) {
 
-    // Get the premultiplied color components as fixed values
-    int r = (color.red * alpha) >> 3;
-    int g = (color.green * alpha) >> 2;
-    int b = (color.blue * alpha) >> 3;
+    // The premultiplied color components as fixed values
+    int r = color->red;
+    int g = color->green;
+    int b = color->blue;
+    fixed_ffxt alpha_1 = color->alpha_1;
 
     for (uint32_t y = 0; y < height; y++) {
-        uint16_t *output = &frameBuffer[240 * (oy + y) + ox];
+        uint16_t *output = &frameBuffer[stride * (oy + y) + ox];
         for (uint32_t x = 0; x < width; x++) {
 
             // Get the background RGB565 components
@@ -101,11 +97,11 @@ static void renderBoxBlend(uint16_t *frameBuffer, int32_t ox, int32_t oy,
     }
 }
 
-static void renderBoxDarker50(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height) {
+static void renderBoxDarker50(uint16_t *frameBuffer, int32_t stride,
+  int32_t ox, int32_t oy, int32_t width, int32_t height) {
 
     for (uint32_t y = 0; y < height; y++) {
-        uint16_t *output = &frameBuffer[240 * (oy + y) + ox];
+        uint16_t *output = &frameBuffer[stride * (oy + y) + ox];
         for (uint32_t x = 0; x < width; x++) {
             // (RRRR 0GGG G0BB BBB0) >> 1
             uint16_t darker = ((*output) & 0xf7be) >> 1;
@@ -114,11 +110,11 @@ static void renderBoxDarker50(uint16_t *frameBuffer, int32_t ox, int32_t oy,
     }
 }
 
-static void renderBoxDarker75(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height) {
+static void renderBoxDarker75(uint16_t *frameBuffer, int32_t stride,
+  int32_t ox, int32_t oy, int32_t width, int32_t height) {
 
     for (uint32_t y = 0; y < height; y++) {
-        uint16_t *output = &frameBuffer[240 * (oy + y) + ox];
+        uint16_t *output = &frameBuffer[stride * (oy + y) + ox];
         for (uint32_t x = 0; x < width; x++) {
             // (RRR0 0GGG G00B BB00) >> 2
             uint16_t darker = ((*output) & 0xe79c) >> 2;
@@ -127,38 +123,40 @@ static void renderBoxDarker75(uint16_t *frameBuffer, int32_t ox, int32_t oy,
     }
 }
 
-static void renderBoxOpaque(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height, color_ffxt _color) {
-
-    uint16_t color = ffx_color_rgb16(_color) & 0xffff;
+static void renderBoxOpaque(uint16_t *frameBuffer, int32_t stride,
+  int32_t ox, int32_t oy, int32_t width, int32_t height, uint16_t color) {
 
     for (uint32_t y = 0; y < height; y++) {
-        uint16_t *output = &frameBuffer[240 * (oy + y) + ox];
+        uint16_t *output = &frameBuffer[stride * (oy + y) + ox];
         for (uint32_t x = 0; x < width; x++) {
             *output++ = color;
         }
     }
 }
 
-void _ffx_renderBox(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height, color_ffxt color) {
+void _ffx_renderBox(uint16_t *frameBuffer, int32_t stride, int32_t ox,
+  int32_t oy, int32_t width, int32_t height, const FfxColorRGB565 *color) {
 
-    if (color == RGBA_DARKER50) {
-        renderBoxDarker50(frameBuffer, ox, oy, width, height);
-        return;
-    }
+    // Black at 50% and 25% opacity (i.e. RGBA_DARKER50 and RGBA_DARKER75)
+    if (color->rgb16 == 0) {
+        if (color->opacity == 16) {
+            renderBoxDarker50(frameBuffer, stride, ox, oy, width, height);
+            return;
+        }
 
-    if (color == RGBA_DARKER75) {
-        renderBoxDarker75(frameBuffer, ox, oy, width, height);
-        return;
+        if (color->opacity == 24) {
+            renderBoxDarker75(frameBuffer, stride, ox, oy, width, height);
+            return;
+        }
     }
 
-    if (ffx_color_getOpacity(color) == MAX_OPACITY) {
-        renderBoxOpaque(frameBuffer, ox, oy, width, height, color);
+    if (color->opacity == MAX_OPACITY) {
+        renderBoxOpaque(frameBuffer, stride, ox, oy, width, height,
+          color->rgb16);
         return;
     }
 
-    renderBoxBlend(frameBuffer, ox, oy, width, height, color);
+    renderBoxBlend(frameBuffer, stride, ox, oy, width, height, color);
 }
 
 static void renderFunc(void *_render, uint16_t *frameBuffer,
@@ -171,8 +169,8 @@ static void renderFunc(void *_render, uint16_t *frameBuffer,
 
     if (clip.width == 0) { return; }
 
-    _ffx_renderBox(frameBuffer, clip.vpX, clip.vpY, clip.width, clip.height,
-        render->color);
+    _ffx_renderBox(frameBuffer, size.width, clip.vpX, clip.vpY, clip.width,
+      clip.height, &render->color);
 }
 
 static void dumpFunc(FfxNode node, int indent) {
@@ -205,6 +203,11 @@ bool ffx_scene_isBox(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneBox_stateSize() {
+    return sizeof(BoxNode);
+}
+
 
 //////////////////////////
 // Properties
@@ -0,0 +1,450 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "firefly-scene-private.h"
+
+
+// Samples are kept in a ring buffer, along with a monotonic deque each
+// for the minimum and maximum, so an append is O(1) (amortized) and the
+// range is always at hand for scaling. Each sequence after an append
+// rebuilds the covered rows of each column, which fragments draw from.
+
+#define MAX_SAMPLES        (4096)
+
+// An empty column (see: ChartNode)
+#define EMPTY_TOP          (0x7fff)
+
+typedef struct Deque {
+    uint16_t *slots;
+    uint16_t head;
+    uint16_t count;
+} Deque;
+
+typedef struct ChartNode {
+    FfxSize size;
+    color_ffxt color;
+    FfxChartStyle style;
+
+    // The samples, oldest first from start
+    int32_t *values;
+    uint16_t capacity;
+    uint16_t start;
+    uint16_t count;
+
+    // Sample slots with increasing values (min) or decreasing values
+    // (max); the front is the extreme of the buffered samples
+    Deque min, max;
+
+    // Bumped by anything which changes the columns
+    uint32_t revision;
+    uint32_t builtRevision;
+
+    // The rows [top, bottom] covered in each column, from the last
+    // sequence; top is EMPTY_TOP if nothing is drawn
+    int16_t *top, *bottom;
+} ChartNode;
+
+// The columns are only rebuilt by the next sequence, which frees this
+// render first
+typedef struct ChartRender {
+    FfxPoint position;
+    FfxSize size;
+    FfxColorRGB565 color;
+    const int16_t *top, *bottom;
+} ChartRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "ChartNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+// See: node-box.c
+void _ffx_renderBox(uint16_t *frameBuffer, int32_t stride, int32_t ox,
+  int32_t oy, int32_t width, int32_t height, const FfxColorRGB565 *color);
+
+
+//////////////////////////
+// Samples
+
+static uint32_t getBack(ChartNode *chart, Deque *deque) {
+    return deque->slots[(deque->head + deque->count - 1) % chart->capacity];
+}
+
+// Drop the sample at %%slot%% from the front of %%deque%%, if it is there
+static void evict(ChartNode *chart, Deque *deque, uint32_t slot) {
+    if (deque->count == 0 || deque->slots[deque->head] != slot) { return; }
+    deque->head = (deque->head + 1) % chart->capacity;
+    deque->count--;
+}
+
+static void pushBack(ChartNode *chart, Deque *deque, uint32_t slot) {
+    deque->slots[(deque->head + deque->count) % chart->capacity] = slot;
+    deque->count++;
+}
+
+static void appendSample(ChartNode *chart, int32_t value) {
+    uint32_t capacity = chart->capacity;
+
+    uint32_t slot;
+    if (chart->count < capacity) {
+        slot = (chart->start + chart->count) % capacity;
+        chart->count++;
+
+    } else {
+        // Full; the oldest sample makes way
+        slot = chart->start;
+        chart->start = (slot + 1) % capacity;
+        evict(chart, &chart->min, slot);
+        evict(chart, &chart->max, slot);
+    }
+
+    chart->values[slot] = value;
+
+    // Samples which can no longer be the extreme are dropped; each is
+    // pushed and popped at most once
+    Deque *min = &chart->min;
+    while (min->count && chart->values[getBack(chart, min)] >= value) {
+        min->count--;
+    }
+    pushBack(chart, min, slot);
+
+    Deque *max = &chart->max;
+    while (max->count && chart->values[getBack(chart, max)] <= value) {
+        max->count--;
+    }
+    pushBack(chart, max, slot);
+}
+
+
+//////////////////////////
+// Columns
+
+static void addSpan(ChartNode *chart, int32_t column, int32_t y0,
+  int32_t y1) {
+
+    if (y0 > y1) {
+        int32_t t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+
+    if (chart->top[column] == EMPTY_TOP) {
+        chart->top[column] = y0;
+        chart->bottom[column] = y1;
+        return;
+    }
+
+    if (y0 < chart->top[column]) { chart->top[column] = y0; }
+    if (y1 > chart->bottom[column]) { chart->bottom[column] = y1; }
+}
+
+// Sample slot p of the capacity (the newest sample is always in the
+// last) spans the columns [p * width / capacity, (p + 1) * ...), or at
+// least one column
+static void buildColumns(ChartNode *chart) {
+    int32_t width = chart->size.width, height = chart->size.height;
+    uint32_t capacity = chart->capacity, count = chart->count;
+
+    for (int32_t x = 0; x < width; x++) {
+        chart->top[x] = EMPTY_TOP;
+        chart->bottom[x] = -1;
+    }
+    if (count == 0 || height <= 0) { return; }
+
+    int32_t lo = chart->values[chart->min.slots[chart->min.head]];
+    int32_t hi = chart->values[chart->max.slots[chart->max.head]];
+    int64_t range = (int64_t)hi - lo;
+
+    int32_t lastRow = height - 1;
+
+    int32_t prevX = 0, prevY = 0;
+    for (uint32_t k = 0; k < count; k++) {
+        int32_t value = chart->values[(chart->start + k) % capacity];
+
+        // A flat chart sits in the middle
+        int32_t y = lastRow / 2;
+        if (range) {
+            y = lastRow - ((((int64_t)value - lo) * lastRow + range / 2) /
+              range);
+        }
+
+        uint32_t p = capacity - count + k;
+        int32_t x0 = p * width / capacity;
+        int32_t x1 = (p + 1) * width / capacity;
+
+        // Samples sharing a column (more samples than columns) merge
+        if (x1 == x0) { x1 = x0 + 1; }
+
+        if (chart->style == FfxChartStyleColumn) {
+            for (int32_t x = x0; x < x1; x++) {
+                addSpan(chart, x, y, lastRow);
+            }
+            continue;
+        }
+
+        // Lines join the center of each sample's columns, running flat
+        // to the outer edge of the first and last sample's columns
+        int32_t x = (x0 + x1 - 1) / 2;
+
+        if (k == 0) {
+            for (int32_t c = x0; c <= x; c++) { addSpan(chart, c, y, y); }
+
+        } else {
+            // Each column covers the rows the line passes through,
+            // up to the midpoint of the next column
+            int32_t dx = x - prevX, dy = y - prevY;
+            int32_t lastY = prevY;
+            for (int32_t c = prevX; c <= x; c++) {
+                int32_t nextY = y;
+                if (c < x) {
+                    nextY = prevY + (2 * dy * (c - prevX) + dy) / (2 * dx);
+                }
+                addSpan(chart, c, lastY, nextY);
+                lastY = nextY;
+            }
+        }
+
+        if (k == count - 1) {
+            for (int32_t c = x + 1; c < x1; c++) { addSpan(chart, c, y, y); }
+        }
+
+        prevX = x;
+        prevY = y;
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+
+    // The buffers share one allocation
+    ffx_sceneNode_memFree(node, chart->values);
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
+
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+
+    if (pos.x + chart->size.width < 0 || pos.y + chart->size.height < 0 ||
+      chart->count == 0 || ffx_color_isTransparent(chart->color)) {
+        return;
+    }
+
+    // Snapshot the revision first, so values pushed while building are
+    // picked up by the next build
+    uint32_t revision = chart->revision;
+    if (chart->builtRevision != revision) {
+        buildColumns(chart);
+        chart->builtRevision = revision;
+    }
+
+    ChartRender *render = ffx_scene_createRender(node, sizeof(ChartRender));
+    render->position = pos;
+    render->size = chart->size;
+    render->color = ffx_color_parseRGB565(chart->color);
+    render->top = chart->top;
+    render->bottom = chart->bottom;
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    ChartRender *render = _render;
+
+    FfxClip clip = ffx_scene_clip(render->position, render->size, origin,
+      size);
+    if (clip.width <= 0 || clip.height <= 0) { return; }
+
+    const int16_t *top = render->top, *bottom = render->bottom;
+
+    int32_t clipTop = clip.y, clipBottom = clip.y + clip.height;
+    int32_t end = clip.x + clip.width;
+
+    int32_t x = clip.x;
+    while (x < end) {
+        int32_t y0 = top[x], y1 = bottom[x] + 1;
+        if (y0 < clipTop) { y0 = clipTop; }
+        if (y1 > clipBottom) { y1 = clipBottom; }
+
+        // Neighbouring columns covering the same rows draw as one box
+        int32_t run = x + 1;
+        while (run < end && top[run] == top[x] &&
+          bottom[run] == bottom[x]) {
+            run++;
+        }
+
+        if (y0 < y1) {
+            _ffx_renderBox(frameBuffer, size.width, clip.vpX + x - clip.x,
+              clip.vpY + y0 - clipTop, run - x, y1 - y0, &render->color);
+        }
+
+        x = run;
+    }
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+
+    char colorName[COLOR_STRING_LENGTH] = { 0 };
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Chart pos=%dx%d size=%dx%d samples=%d/%d color=%s>\n", pos.x,
+      pos.y, chart->size.width, chart->size.height, chart->count,
+      chart->capacity, ffx_color_sprintf(chart->color, colorName));
+}
+
+
+//////////////////////////
+// Life-cycle
+
+FfxNode ffx_scene_createChart(FfxScene scene, FfxSize size,
+  size_t capacity) {
+
+    if (capacity == 0 || capacity > MAX_SAMPLES) {
+        printf("chart: invalid capacity\n");
+        return NULL;
+    }
+
+    if (size.width <= 0 || size.height <= 0) {
+        printf("chart: invalid size\n");
+        return NULL;
+    }
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(ChartNode));
+    if (node == NULL) { return NULL; }
+
+    // The samples and two deques, then the top and bottom of each column
+    uint8_t *data = ffx_scene_memAlloc(scene, capacity * (sizeof(int32_t) +
+      2 * sizeof(uint16_t)) + size.width * 2 * sizeof(int16_t));
+    if (data == NULL) {
+        ffx_sceneNode_free(node);
+        return NULL;
+    }
+
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    chart->size = size;
+    chart->color = COLOR_WHITE;
+    chart->capacity = capacity;
+
+    chart->values = (int32_t*)data;
+    chart->min.slots = (uint16_t*)&chart->values[capacity];
+    chart->max.slots = &chart->min.slots[capacity];
+    chart->top = (int16_t*)&chart->max.slots[capacity];
+    chart->bottom = &chart->top[size.width];
+
+    return node;
+}
+
+bool ffx_scene_isChart(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+void ffx_sceneChart_append(FfxNode node, int32_t value) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return; }
+
+    appendSample(chart, value);
+    chart->revision++;
+}
+
+void ffx_sceneChart_clear(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return; }
+
+    chart->start = chart->count = 0;
+    chart->min.head = chart->min.count = 0;
+    chart->max.head = chart->max.count = 0;
+    chart->revision++;
+}
+
+size_t ffx_sceneChart_getCount(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return 0; }
+    return chart->count;
+}
+
+bool ffx_sceneChart_getRange(FfxNode node, int32_t *min, int32_t *max) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL || chart->count == 0) { return false; }
+
+    if (min) { *min = chart->values[chart->min.slots[chart->min.head]]; }
+    if (max) { *max = chart->values[chart->max.slots[chart->max.head]]; }
+
+    return true;
+}
+
+FfxSize ffx_sceneChart_getSize(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return (FfxSize){ }; }
+    return chart->size;
+}
+
+FfxChartStyle ffx_sceneChart_getStyle(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return FfxChartStyleLine; }
+    return chart->style;
+}
+
+void ffx_sceneChart_setStyle(FfxNode node, FfxChartStyle style) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return; }
+
+    if (style == chart->style) { return; }
+
+    chart->style = style;
+    chart->revision++;
+}
+
+color_ffxt ffx_sceneChart_getColor(FfxNode node) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return 0; }
+    return chart->color;
+}
+
+static void setColor(FfxNode node, color_ffxt color) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return; }
+    chart->color = color;
+}
+
+void ffx_sceneChart_setColor(FfxNode node, color_ffxt color) {
+    ChartNode *chart = ffx_sceneNode_getState(node, &vtable);
+    if (chart == NULL) { return; }
+    ffx_sceneNode_createColorAction(node, chart->color, color, setColor);
+}
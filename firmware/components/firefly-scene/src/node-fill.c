@@ -8,6 +8,11 @@ typedef struct FillNode {
     color_ffxt color;
 } FillNode;
 
+typedef struct FillRender {
+    // The RGB565 color in both halves
+    uint32_t color;
+} FillRender;
+
 
 static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
   FfxNodeVisitFunc exitFunc, void* arg);
@@ -43,25 +48,27 @@ static void destroyFunc(FfxNode node) { }
 static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     FillNode *fill = ffx_sceneNode_getState(node, &vtable);
 
-    FillNode *render = ffx_scene_createRender(node, sizeof(FillNode));
-    render->color = fill->color;
+    uint32_t c = ffx_color_rgb16(fill->color);
+
+    FillRender *render = ffx_scene_createRender(node, sizeof(FillRender));
+    render->color = ((c << 16) | c);
 }
 
 static void renderFunc(void *_render, uint16_t *_frameBuffer,
   FfxPoint origin, FfxSize size) {
 
-    FillNode *render = _render;
+    FillRender *render = _render;
 
-    uint32_t c = ffx_color_rgb16(render->color);
-    c = ((c << 16) | c);
-
-    uint32_t *frameBuffer = (uint32_t*)_frameBuffer;
+    uint32_t c = render->color;
 
-    // @TODO: this doesn't work in general anymore; render line-by-line
+    // The fragment is packed, so it is filled as one run of pixels; any
+    // pixel left over from the pairs is written on its own
+    uint32_t length = size.width * size.height;
 
-    uint32_t count = size.width * size.height / 2;
+    uint32_t *frameBuffer = (uint32_t*)_frameBuffer;
+    for (uint32_t i = length / 2; i; i--) { *frameBuffer++ = c; }
 
-    for (uint32_t i = 0; i < count; i++) { *frameBuffer++ = c; }
+    if (length & 1) { _frameBuffer[length - 1] = c; }
 }
 
 static void dumpFunc(FfxNode node, int indent) {
@@ -90,6 +97,11 @@ bool ffx_scene_isFill(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneFill_stateSize() {
+    return sizeof(FillNode);
+}
+
 
 //////////////////////////
 // Properties
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stddef.h>
+
+#include "scene.h"
+
+
+// Flipbook format (uint16_t words; see: tools/src.ts/flipbook.ts):
+//   - Header: (version << 8) | format, width, height, frameCount
+//   - Palette: 256 RGB565 colors, shared by all frames
+//   - Frames, each: duration (ms), flags, x, y, width, height and the
+//     byte offset (hi, lo) of its pixels within the pixel data
+//   - Pixel data: for each frame its rectangle of 8-bit palette indices,
+//     padded to a whole word
+//
+// A keyframe covers the entire image; every other frame only stores
+// the rectangle that changed since the previous frame. A frame is drawn
+// by replaying from its most recent keyframe, which the converter keeps
+// close enough that a frame costs at most about two full images.
+
+#define FORMAT_FLIPBOOK    (0x0146)
+
+#define HEADER_SIZE        (4)
+#define PALETTE_SIZE       (256)
+#define FRAME_SIZE         (8)
+
+#define FLAG_KEYFRAME      (1 << 0)
+
+// A duration of 0 would spin; treat it like GIF viewers do
+#define DEFAULT_DURATION   (100)
+
+typedef struct FlipbookNode {
+    const uint16_t *data;
+
+    uint16_t frame;
+
+    // The most recent keyframe at or before frame
+    uint16_t keyframe;
+
+    // The tick the current frame began
+    int32_t frameStart;
+
+    bool started;
+    bool playing;
+
+    // The region changed by the last sequence (world coordinates)
+    FfxPoint damageOrigin;
+    FfxSize damageSize;
+} FlipbookNode;
+
+typedef struct FlipbookRender {
+    FfxPoint position;
+    const uint16_t *data;
+    uint16_t keyframe, frame;
+} FlipbookRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "FlipbookNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+
+static const uint16_t* getFrame(const uint16_t *data, size_t frame) {
+    return &data[HEADER_SIZE + PALETTE_SIZE + frame * FRAME_SIZE];
+}
+
+static uint32_t getDuration(const uint16_t *data, size_t frame) {
+    uint32_t duration = getFrame(data, frame)[0];
+    return duration ? duration: DEFAULT_DURATION;
+}
+
+// The pixels of %%frame%%; each word holds two palette indices, the
+// first in the high byte
+static const uint16_t* getPixels(const uint16_t *data, size_t frame) {
+    const uint16_t *info = getFrame(data, frame);
+    const uint16_t *pixels = getFrame(data, data[3]);
+    return &pixels[(((uint32_t)info[6] << 16) | info[7]) / 2];
+}
+
+// Grows the damage region to include the rectangle of %%frame%%
+static void addDamage(FlipbookNode *flipbook, size_t frame) {
+    const uint16_t *info = getFrame(flipbook->data, frame);
+    if (info[4] == 0 || info[5] == 0) { return; }
+
+    int32_t x0 = info[2], y0 = info[3];
+    int32_t x1 = x0 + info[4], y1 = y0 + info[5];
+
+    if (flipbook->damageSize.width) {
+        int32_t dx0 = flipbook->damageOrigin.x;
+        int32_t dy0 = flipbook->damageOrigin.y;
+        int32_t dx1 = dx0 + flipbook->damageSize.width;
+        int32_t dy1 = dy0 + flipbook->damageSize.height;
+        if (dx0 < x0) { x0 = dx0; }
+        if (dy0 < y0) { y0 = dy0; }
+        if (dx1 > x1) { x1 = dx1; }
+        if (dy1 > y1) { y1 = dy1; }
+    }
+
+    flipbook->damageOrigin = ffx_point(x0, y0);
+    flipbook->damageSize = ffx_size(x1 - x0, y1 - y0);
+}
+
+
+//////////////////////////
+// Rasterizing
+
+static void renderFrame(FlipbookRender *render, size_t frame,
+  uint16_t *frameBuffer, FfxPoint origin, FfxSize size) {
+
+    const uint16_t *data = render->data;
+    const uint16_t *info = getFrame(data, frame);
+
+    int32_t stride = size.width;
+
+    int32_t width = info[4];
+
+    FfxClip clip = ffx_scene_clip(ffx_point(render->position.x + info[2],
+      render->position.y + info[3]), ffx_size(width, info[5]), origin, size);
+    if (clip.width == 0) { return; }
+
+    const uint16_t *palette = &data[HEADER_SIZE];
+    const uint16_t *pixels = getPixels(data, frame);
+
+    for (int32_t y = clip.height; y; y--) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y - 1)) +
+          clip.vpX];
+        uint32_t i = ((clip.y + y - 1) * width) + clip.x;
+        for (int32_t x = clip.width; x; x--, i++) {
+            *output++ = palette[(pixels[i / 2] >> ((i & 1) ? 0: 8)) & 0xff];
+        }
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    const uint16_t *data = flipbook->data;
+
+    int32_t now = ((Node*)node)->scene->tick;
+
+    flipbook->damageSize = ffx_size(0, 0);
+
+    if (!flipbook->started) {
+        flipbook->started = true;
+        flipbook->frameStart = now;
+        addDamage(flipbook, flipbook->keyframe);
+
+    } else if (flipbook->playing) {
+        uint32_t frameCount = data[3];
+
+        // Advance the frames whose time has elapsed; a long stall
+        // could skip many frames, so stop once the damage is full
+        while (now - flipbook->frameStart >= getDuration(data,
+          flipbook->frame)) {
+
+            flipbook->frameStart += getDuration(data, flipbook->frame);
+
+            flipbook->frame++;
+            if (flipbook->frame == frameCount) { flipbook->frame = 0; }
+
+            const uint16_t *info = getFrame(data, flipbook->frame);
+            if (info[1] & FLAG_KEYFRAME) {
+                flipbook->keyframe = flipbook->frame;
+            }
+
+            addDamage(flipbook, flipbook->frame);
+
+            if (flipbook->damageSize.width == data[1] &&
+              flipbook->damageSize.height == data[2]) {
+
+                // Resynchronize to the current time
+                if (now - flipbook->frameStart >= getDuration(data,
+                  flipbook->frame)) {
+                    flipbook->frameStart = now;
+                }
+                break;
+            }
+        }
+    }
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    flipbook->damageOrigin.x += pos.x;
+    flipbook->damageOrigin.y += pos.y;
+
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
+    if (pos.x + data[1] < 0 || pos.y + data[2] < 0) { return; }
+
+    FlipbookRender *render = ffx_scene_createRender(node,
+      sizeof(FlipbookRender));
+    render->position = pos;
+    render->data = ffx_sceneNode_acquireImage(node, data);
+    render->keyframe = flipbook->keyframe;
+    render->frame = flipbook->frame;
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    FlipbookRender *render = _render;
+
+    for (size_t frame = render->keyframe; frame <= render->frame; frame++) {
+        renderFrame(render, frame, frameBuffer, origin, size);
+    }
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Flipbook pos=%dx%d size=%dx%d frame=%d/%d keyframe=%d>\n",
+      pos.x, pos.y, flipbook->data[1], flipbook->data[2], flipbook->frame,
+      flipbook->data[3], flipbook->keyframe);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static bool validate(const uint16_t *data, size_t length) {
+    if (length < 2 * (HEADER_SIZE + PALETTE_SIZE)) { return false; }
+    if (data[0] != FORMAT_FLIPBOOK) { return false; }
+
+    uint32_t width = data[1], height = data[2], frameCount = data[3];
+    if (width == 0 || height == 0 || frameCount == 0) { return false; }
+
+    size_t pixelsOffset = 2 * (HEADER_SIZE + PALETTE_SIZE +
+      frameCount * FRAME_SIZE);
+    if (pixelsOffset > length) { return false; }
+
+    size_t pixelsLength = length - pixelsOffset;
+
+    for (int i = 0; i < frameCount; i++) {
+        const uint16_t *info = getFrame(data, i);
+
+        uint32_t x = info[2], y = info[3], w = info[4], h = info[5];
+        if (x + w > width || y + h > height) { return false; }
+
+        if (info[1] & FLAG_KEYFRAME) {
+            if (x != 0 || y != 0 || w != width || h != height) {
+                return false;
+            }
+        } else if (i == 0) {
+            return false;
+        }
+
+        // Each frame starts on a word, with its first index in the high
+        // byte; an odd offset would shift every pixel of the frame
+        size_t offset = ((uint32_t)info[6] << 16) | info[7];
+        if (offset & 1) { return false; }
+        if (offset + w * h > pixelsLength) { return false; }
+    }
+
+    return true;
+}
+
+FfxNode ffx_scene_createFlipbook(FfxScene scene, const uint16_t *data,
+  size_t dataLength) {
+
+    if (!validate(data, dataLength)) {
+        printf("flipbook: invalid data\n");
+        return NULL;
+    }
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(FlipbookNode));
+    if (node == NULL) { return NULL; }
+
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    flipbook->data = data;
+    flipbook->playing = true;
+
+    return node;
+}
+
+bool ffx_scene_isFlipbook(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+// See: image-cache.c
+bool _ffx_sceneFlipbook_isValid(const uint16_t *data, size_t length) {
+    return validate(data, length);
+}
+
+
+//////////////////////////
+// Properties
+
+const uint16_t* ffx_sceneFlipbook_getData(FfxNode node) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL) { return NULL; }
+    return flipbook->data;
+}
+
+size_t ffx_sceneFlipbook_getFrameCount(FfxNode node) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL) { return 0; }
+    return flipbook->data[3];
+}
+
+size_t ffx_sceneFlipbook_getFrame(FfxNode node) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL) { return 0; }
+    return flipbook->frame;
+}
+
+void ffx_sceneFlipbook_setFrame(FfxNode node, size_t frame) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL || frame >= flipbook->data[3]) { return; }
+
+    size_t keyframe = frame;
+    while (!(getFrame(flipbook->data, keyframe)[1] & FLAG_KEYFRAME)) {
+        keyframe--;
+    }
+
+    flipbook->frame = frame;
+    flipbook->keyframe = keyframe;
+
+    // Restart the timer (and damage the whole image) on the next sequence
+    flipbook->started = false;
+}
+
+bool ffx_sceneFlipbook_getPlaying(FfxNode node) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL) { return false; }
+    return flipbook->playing;
+}
+
+void ffx_sceneFlipbook_setPlaying(FfxNode node, bool playing) {
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL || flipbook->playing == playing) { return; }
+
+    flipbook->playing = playing;
+
+    // Resume the current frame from the start
+    if (playing) { flipbook->frameStart = ((Node*)node)->scene->tick; }
+}
+
+bool ffx_sceneFlipbook_getDamage(FfxNode node, FfxPoint *origin,
+  FfxSize *size) {
+
+    FlipbookNode *flipbook = ffx_sceneNode_getState(node, &vtable);
+    if (flipbook == NULL || flipbook->damageSize.width == 0) { return false; }
+
+    if (origin) { *origin = flipbook->damageOrigin; }
+    if (size) { *size = flipbook->damageSize; }
+
+    return true;
+}
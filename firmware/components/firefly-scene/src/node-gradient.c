@@ -0,0 +1,477 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-scene-private.h"
+
+
+// The ramp is sampled into this many entries each sequence; the last
+// entry is the final color stop
+#define RAMP_SIZE          (128)
+
+// The linear gradient value past the last ramp entry (fixed:15.16)
+#define LINEAR_MAX         (RAMP_SIZE << 16)
+
+// The squared radial gradient value past the last ramp entry, in ramp
+// entries squared (with a number of fractional bits per render)
+#define RADIAL_MAX(bits)   ((RAMP_SIZE * RAMP_SIZE) << (bits))
+
+typedef struct GradientNode {
+    FfxGradientType type;
+    FfxSize size;
+    FfxPoint start, end;
+    bool dither;
+
+    size_t colorCount;
+    color_ffxt colors[FFX_GRADIENT_MAX_COLORS];
+} GradientNode;
+
+typedef struct GradientRender {
+    FfxPoint position;
+    FfxSize size;
+
+    FfxGradientType type;
+    FfxPoint start;
+    bool dither;
+
+    // Linear: the change in gradient value per pixel (fixed:15.16)
+    // Radial: dtdx is the squared gradient value per pixel squared,
+    //         with dtdy fractional bits
+    int32_t dtdx, dtdy;
+
+    // Each entry holds the red, green and blue channels in RGB565 depth
+    // with 4 extra bits of precision for dithering, in 10-bit fields;
+    // see: getPixel
+    uint32_t ramp[RAMP_SIZE];
+} GradientRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "GradientNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+
+//////////////////////////
+// Rasterizing
+
+static const uint8_t bayer4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+static uint32_t packEntry(color_ffxt color) {
+    rgb24_ffxt rgb = ffx_color_rgb24(color);
+
+    uint32_t r = (((rgb >> 16) & 0xff) * (31 << 4) + 127) / 255;
+    uint32_t g = (((rgb >> 8) & 0xff) * (63 << 4) + 127) / 255;
+    uint32_t b = ((rgb & 0xff) * (31 << 4) + 127) / 255;
+
+    return (r << 20) | (g << 10) | b;
+}
+
+// Adding a threshold in [0, 15] to every field at once cannot carry
+// between fields, since each field is at most (63 << 4) + 15
+static inline uint16_t getPixel(uint32_t entry, uint32_t threshold) {
+    uint32_t v = entry + threshold;
+    return ((v >> 13) & 0xf800) | ((v >> 9) & 0x07e0) | ((v >> 4) & 0x001f);
+}
+
+static void fillSpan(uint16_t *output, int32_t x, int32_t count,
+  uint32_t entry, const uint32_t *thresholds) {
+
+    for (int32_t end = x + count; x < end; x++) {
+        output[x] = getPixel(entry, thresholds[x & 3]);
+    }
+}
+
+// Returns ceil(n / d), for n >= 0 and d > 0, clamped to [0, limit]
+static int32_t ceilDiv(int64_t n, int64_t d, int32_t limit) {
+    if (n <= 0) { return 0; }
+    int64_t v = (n + d - 1) / d;
+    return (v > limit) ? limit: v;
+}
+
+// The gradient value at the clipped row start is %%t%% and changes by
+// render->dtdx per pixel. Only the span within the ramp steps through
+// it; the pixels on either side are the end colors.
+static void renderLinearRow(GradientRender *render, uint16_t *output,
+  int32_t width, int64_t t, const uint32_t *thresholds) {
+
+    const uint32_t *ramp = render->ramp;
+    int32_t dtdx = render->dtdx;
+
+    if (dtdx == 0) {
+        int32_t index = (t < 0) ? 0: (t >= LINEAR_MAX) ? (RAMP_SIZE - 1):
+          (t >> 16);
+        fillSpan(output, 0, width, ramp[index], thresholds);
+        return;
+    }
+
+    // The span [a, b) lies within the ramp
+    int32_t a, b;
+    uint32_t before, after;
+    if (dtdx > 0) {
+        a = ceilDiv(-t, dtdx, width);
+        b = ceilDiv(LINEAR_MAX - t, dtdx, width);
+        before = ramp[0];
+        after = ramp[RAMP_SIZE - 1];
+    } else {
+        a = ceilDiv(t - LINEAR_MAX + 1, -dtdx, width);
+        b = ceilDiv(t + 1, -dtdx, width);
+        before = ramp[RAMP_SIZE - 1];
+        after = ramp[0];
+    }
+
+    fillSpan(output, 0, a, before, thresholds);
+
+    int32_t v = t + (int64_t)a * dtdx;
+    for (int32_t x = a; x < b; x++, v += dtdx) {
+        output[x] = getPixel(ramp[v >> 16], thresholds[x & 3]);
+    }
+
+    fillSpan(output, b, width - b, after, thresholds);
+}
+
+// The clipped row starts %%dx%% pixels from the center and the squared
+// vertical distance contributes %%dy2%%. Only the span within the
+// radius steps through the ramp, tracking the square root incrementally.
+static void renderRadialRow(GradientRender *render, uint16_t *output,
+  int32_t width, int32_t dx, int64_t dy2, const uint32_t *thresholds) {
+
+    const uint32_t *ramp = render->ramp;
+    int32_t scale = render->dtdx, bits = render->dtdy;
+    int32_t radialMax = RADIAL_MAX(bits);
+
+    uint32_t outside = ramp[RAMP_SIZE - 1];
+
+    if (dy2 >= radialMax) {
+        fillSpan(output, 0, width, outside, thresholds);
+        return;
+    }
+
+    // The largest horizontal distance still within the radius
+    int32_t reach = isqrt32((radialMax - dy2 - 1) / scale);
+
+    int32_t a = -dx - reach, b = -dx + reach + 1;
+    if (a < 0) { a = 0; }
+    if (b > width) { b = width; }
+    if (a >= b) {
+        fillSpan(output, 0, width, outside, thresholds);
+        return;
+    }
+
+    fillSpan(output, 0, a, outside, thresholds);
+
+    dx += a;
+    int32_t s = dx * dx * scale + dy2;
+    int32_t ds = (2 * dx + 1) * scale, dds = 2 * scale;
+
+    int32_t index = isqrt32(s >> bits);
+    for (int32_t x = a; x < b; x++) {
+        while (((index + 1) * (index + 1)) << bits <= s) { index++; }
+        while ((index * index) << bits > s) { index--; }
+
+        output[x] = getPixel(ramp[index], thresholds[x & 3]);
+
+        s += ds;
+        ds += dds;
+    }
+
+    fillSpan(output, b, width - b, outside, thresholds);
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    GradientRender *render = _render;
+
+    FfxClip clip = ffx_scene_clip(render->position, render->size, origin,
+      size);
+    if (clip.width == 0) { return; }
+
+    // The clipped top-left pixel, relative to the gradient start
+    int32_t dx = clip.x - render->start.x;
+    int32_t dy = clip.y - render->start.y;
+
+    // The dither is anchored to the screen, so it does not crawl as the
+    // gradient moves
+    int32_t screenX = origin.x + clip.vpX, screenY = origin.y + clip.vpY;
+
+    int32_t stride = size.width;
+
+    for (int32_t y = 0; y < clip.height; y++, dy++) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+
+        // The thresholds for this row, indexed by (x & 3) and spread
+        // across all three channel fields
+        uint32_t thresholds[4];
+        for (int i = 0; i < 4; i++) {
+            // Without dithering, round to the nearest color
+            uint32_t v = 8;
+            if (render->dither) {
+                v = bayer4[(screenY + y) & 3][(screenX + i) & 3];
+            }
+            thresholds[i] = (v << 20) | (v << 10) | v;
+        }
+
+        if (render->type == FfxGradientTypeRadial) {
+            int64_t dy2 = (int64_t)dy * dy * render->dtdx;
+            renderRadialRow(render, output, clip.width, dx, dy2, thresholds);
+        } else {
+            int64_t t = (int64_t)dx * render->dtdx +
+              (int64_t)dy * render->dtdy;
+            renderLinearRow(render, output, clip.width, t, thresholds);
+        }
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+}
+
+// Returns n / d (d > 0) rounded away from zero, so a step truncated
+// toward zero cannot leave the end point short of the last ramp entry
+static int32_t stepAway(int64_t n, int64_t d) {
+    return (n < 0) ? -((-n + d - 1) / d): ((n + d - 1) / d);
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    FfxSize size = gradient->size;
+
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
+    if (pos.x + size.width < 0 || pos.y + size.height < 0) { return; }
+
+    GradientRender *render = ffx_scene_createRender(node,
+      sizeof(GradientRender));
+    render->position = pos;
+    render->size = size;
+    render->type = gradient->type;
+    render->start = gradient->start;
+    render->dither = gradient->dither;
+
+    int32_t dx = gradient->end.x - gradient->start.x;
+    int32_t dy = gradient->end.y - gradient->start.y;
+    int64_t length2 = (int64_t)dx * dx + (int64_t)dy * dy;
+    if (length2 == 0) { length2 = 1; }
+
+    if (gradient->type == FfxGradientTypeRadial) {
+        // Scale the squared distance so the radius maps onto the last
+        // ramp entry (rounding up, so it is not left just short),
+        // adding fractional bits for larger radii to keep the scale
+        // precise; 8 bits keeps the per-pixel steps of small radii
+        // within range
+        int64_t steps2 = (RAMP_SIZE - 1) * (RAMP_SIZE - 1);
+        int32_t bits = 8;
+        while (bits < 16 && ((steps2 << bits) / length2) < 4096) { bits++; }
+
+        int64_t scale = ((steps2 << bits) + length2 - 1) / length2;
+        render->dtdx = (scale == 0) ? 1: scale;
+        render->dtdy = bits;
+    } else {
+        // Project onto the gradient axis, so the end point maps onto
+        // the last ramp entry
+        render->dtdx = stepAway((int64_t)(RAMP_SIZE - 1) * dx * 65536,
+          length2);
+        render->dtdy = stepAway((int64_t)(RAMP_SIZE - 1) * dy * 65536,
+          length2);
+    }
+
+    for (int i = 0; i < RAMP_SIZE; i++) {
+        color_ffxt color = ffx_color_lerpColorRamp(gradient->colors,
+          gradient->colorCount, ratiofx(i, RAMP_SIZE - 1));
+        render->ramp[i] = packEntry(color);
+    }
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Gradient type=%s pos=%dx%d size=%dx%d start=%dx%d end=%dx%d",
+      (gradient->type == FfxGradientTypeRadial) ? "radial": "linear",
+      pos.x, pos.y, gradient->size.width, gradient->size.height,
+      gradient->start.x, gradient->start.y, gradient->end.x,
+      gradient->end.y);
+
+    char colorName[COLOR_STRING_LENGTH] = { 0 };
+    for (int i = 0; i < gradient->colorCount; i++) {
+        printf(" color%d=%s", i, ffx_color_sprintf(gradient->colors[i],
+          colorName));
+    }
+
+    printf("%s>\n", gradient->dither ? " dither": "");
+}
+
+
+//////////////////////////
+// Life-cycle
+
+FfxNode ffx_scene_createGradient(FfxScene scene, FfxSize size,
+  FfxGradientType type) {
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable,
+      sizeof(GradientNode));
+    if (node == NULL) { return NULL; }
+
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    gradient->type = type;
+    gradient->size = size;
+    gradient->end = ffx_point(0, size.height);
+    gradient->dither = true;
+
+    gradient->colorCount = 2;
+    gradient->colors[0] = ffx_color_rgb(0, 0, 0);
+    gradient->colors[1] = ffx_color_rgb(255, 255, 255);
+
+    return node;
+}
+
+bool ffx_scene_isGradient(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+FfxGradientType ffx_sceneGradient_getType(FfxNode node) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return FfxGradientTypeLinear; }
+    return gradient->type;
+}
+
+void ffx_sceneGradient_setType(FfxNode node, FfxGradientType type) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    gradient->type = type;
+}
+
+FfxSize ffx_sceneGradient_getSize(FfxNode node) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return ffx_size(0, 0); }
+    return gradient->size;
+}
+
+static void setSize(FfxNode node, FfxSize size) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    gradient->size = size;
+}
+
+void ffx_sceneGradient_setSize(FfxNode node, FfxSize size) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    ffx_sceneNode_createSizeAction(node, gradient->size, size, setSize);
+}
+
+FfxPoint ffx_sceneGradient_getStart(FfxNode node) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return ffx_point(0, 0); }
+    return gradient->start;
+}
+
+static void setStart(FfxNode node, FfxPoint start) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    gradient->start = start;
+}
+
+void ffx_sceneGradient_setStart(FfxNode node, FfxPoint start) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    ffx_sceneNode_createPointAction(node, gradient->start, start, setStart);
+}
+
+FfxPoint ffx_sceneGradient_getEnd(FfxNode node) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return ffx_point(0, 0); }
+    return gradient->end;
+}
+
+static void setEnd(FfxNode node, FfxPoint end) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    gradient->end = end;
+}
+
+void ffx_sceneGradient_setEnd(FfxNode node, FfxPoint end) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    ffx_sceneNode_createPointAction(node, gradient->end, end, setEnd);
+}
+
+size_t ffx_sceneGradient_getColors(FfxNode node, color_ffxt *colors,
+  size_t count) {
+
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return 0; }
+
+    if (count > gradient->colorCount) { count = gradient->colorCount; }
+    memcpy(colors, gradient->colors, count * sizeof(color_ffxt));
+
+    return gradient->colorCount;
+}
+
+bool ffx_sceneGradient_setColors(FfxNode node, const color_ffxt *colors,
+  size_t count) {
+
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return false; }
+
+    if (count == 0 || count > FFX_GRADIENT_MAX_COLORS) {
+        printf("gradient: invalid color count: %d\n", (int)count);
+        return false;
+    }
+
+    memcpy(gradient->colors, colors, count * sizeof(color_ffxt));
+    gradient->colorCount = count;
+
+    return true;
+}
+
+bool ffx_sceneGradient_getDither(FfxNode node) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return false; }
+    return gradient->dither;
+}
+
+void ffx_sceneGradient_setDither(FfxNode node, bool dither) {
+    GradientNode *gradient = ffx_sceneNode_getState(node, &vtable);
+    if (gradient == NULL) { return; }
+    gradient->dither = dither;
+}
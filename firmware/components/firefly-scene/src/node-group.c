@@ -7,8 +7,18 @@
 typedef struct GroupNode {
     FfxNode firstChild;
     FfxNode lastChild;
+    uint8_t opacity;
 } GroupNode;
 
+// A group below full opacity brackets its children's renders with a
+// pair of layer renders; the first saves the fragment behind the group
+// and the second blends the children back over it
+typedef struct GroupRender {
+    Scene *scene;
+    bool close;
+    uint8_t opacity;
+} GroupRender;
+
 
 static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
   FfxNodeVisitFunc exitFunc, void* arg);
@@ -69,6 +79,13 @@ static void destroyFunc(FfxNode node) {
     }
 }
 
+static void createLayerRender(FfxNode node, uint8_t opacity, bool close) {
+    GroupRender *render = ffx_scene_createRender(node, sizeof(GroupRender));
+    render->scene = ((Node*)node)->scene;
+    render->opacity = opacity;
+    render->close = close;
+}
+
 // @TODO: migrate this to walk
 static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     FfxPoint pos = ffx_sceneNode_getPosition(node);
@@ -77,44 +94,127 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
 
     GroupNode *state = ffx_sceneNode_getState(node, &vtable);
 
+    // A fully transparent group draws nothing, but still needs to
+    // reap its removed children
+    uint8_t opacity = state->opacity;
+    bool layer = (opacity > 0 && opacity < MAX_OPACITY);
+
+    if (layer) { createLayerRender(node, opacity, false); }
+
     // I have children; visit them each
-    FfxNode *previousChild = NULL;
-    FfxNode *child = state->firstChild;
+    Node *child = state->firstChild;
     while (child) {
-        FfxNode *nextChild = ffx_sceneNode_getNextSibling(child);
+        Node *nextChild = child->nextSibling;
 
-        if (ffx_sceneNode_hasFlags(child, NodeFlagRemove)) {
-            // Remove child
+        if (child->flags & NodeFlagRemove) {
+            // Unlinks the child from the group
+            ffx_sceneNode_free(child);
 
-            // The tail is the child; point the tail to the previous child (NULL if firstChild)
-            if (state->lastChild == child) { state->lastChild = previousChild; }
+        } else if (opacity) {
+            ffx_sceneNode_sequence(child, worldPos);
+        }
 
-            if (previousChild) {
-                // Not the first child; remove from the middle
-                ((Node*)previousChild)->nextSibling = nextChild;
-            } else {
-               // First child
-                state->firstChild = nextChild;
-            }
+        child = nextChild;
+    }
 
-            ((Node*)child)->nextSibling = NULL;
+    if (layer) { createLayerRender(node, opacity, true); }
+}
 
-            if (ffx_sceneNode_hasFlags(child, NodeFlagRemove)) {
-                ffx_sceneNode_free(child);
-            }
 
-        } else {
-            // Sequence the child
-            ffx_sceneNode_sequence(child, worldPos);
-            previousChild = child;
-        }
+//////////////////////////
+// Children
 
-        child = nextChild;
+// Link %%child%% into the group before %%sibling%%, or last if NULL
+static void linkChild(FfxNode node, GroupNode *state, Node *child,
+  Node *sibling) {
+
+    Node *prevChild = sibling ? sibling->prevSibling: state->lastChild;
+
+    child->parent = node;
+    child->prevSibling = prevChild;
+    child->nextSibling = sibling;
+
+    if (prevChild) {
+        prevChild->nextSibling = child;
+    } else {
+        state->firstChild = child;
+    }
+
+    if (sibling) {
+        sibling->prevSibling = child;
+    } else {
+        state->lastChild = child;
+    }
+}
+
+static void unlinkChild(GroupNode *state, Node *child) {
+    Node *prevChild = child->prevSibling;
+    Node *nextChild = child->nextSibling;
+
+    if (prevChild) {
+        prevChild->nextSibling = nextChild;
+    } else {
+        state->firstChild = nextChild;
+    }
+
+    if (nextChild) {
+        nextChild->prevSibling = prevChild;
+    } else {
+        state->lastChild = prevChild;
     }
+
+    child->parent = NULL;
+    child->prevSibling = child->nextSibling = NULL;
+}
+
+// See: node.c
+void _ffx_sceneGroup_detachChild(FfxNode node, FfxNode child) {
+    GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+    if (state == NULL) { return; }
+    unlinkChild(state, child);
+}
+
+
+//////////////////////////
+// Rasterizing
+
+static inline uint32_t spread(uint16_t c) {
+    return ((c | ((uint32_t)c << 16)) & 0x07e0f81f);
+}
+
+static inline uint16_t unspread(uint32_t c) {
+    c &= 0x07e0f81f;
+    return (c | (c >> 16)) & 0xffff;
 }
 
 static void renderFunc(void *_render, uint16_t *frameBuffer,
   FfxPoint origin, FfxSize size) {
+
+    GroupRender *render = _render;
+
+    // Opening; the children render directly into the fragment, at full
+    // speed, over a saved copy of what was behind them
+    if (!render->close) {
+        ffx_scene_pushLayer(render->scene, frameBuffer, size);
+        return;
+    }
+
+    // No layer could be saved; the children remain fully opaque
+    const uint16_t *behind = ffx_scene_popLayer(render->scene);
+    if (behind == NULL) { return; }
+
+    // Blending the saved fragment with the composited children is the
+    // same as blending the layer at the group opacity, so only pixels
+    // the children changed need any work
+    uint32_t alpha = render->opacity, alpha_1 = MAX_OPACITY - alpha;
+
+    size_t length = size.width * size.height;
+    for (size_t i = 0; i < length; i++) {
+        uint16_t bg = behind[i], fg = frameBuffer[i];
+        if (bg == fg) { continue; }
+        frameBuffer[i] = unspread((spread(fg) * alpha +
+          spread(bg) * alpha_1) >> 5);
+    }
 }
 
 static void dumpFunc(FfxNode node, int indent) {
@@ -122,9 +222,9 @@ static void dumpFunc(FfxNode node, int indent) {
     FfxPoint pos = ffx_sceneNode_getPosition(node);
 
     for (int i = 0; i < indent; i++) { printf("  "); }
-    printf("<Group pos=%dx%d>\n", pos.x, pos.y);
-
     GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+
+    printf("<Group pos=%dx%d opacity=%d>\n", pos.x, pos.y, state->opacity);
     FfxNode *child = state->firstChild;
     while (child) {
         ffx_sceneNode_dump(child, indent + 1);
@@ -137,13 +237,24 @@ static void dumpFunc(FfxNode node, int indent) {
 // Life-cycle
 
 FfxNode ffx_scene_createGroup(FfxScene scene) {
-    return ffx_scene_createNode(scene, &vtable, sizeof(GroupNode));
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(GroupNode));
+    if (node == NULL) { return NULL; }
+
+    GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+    state->opacity = MAX_OPACITY;
+
+    return node;
 }
 
 bool ffx_scene_isGroup(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneGroup_stateSize() {
+    return sizeof(GroupNode);
+}
+
 
 //////////////////////////
 // Properties
@@ -155,21 +266,64 @@ FfxNode ffx_sceneGroup_getFirstChild(FfxNode node) {
 }
 
 void ffx_sceneGroup_appendChild(FfxNode node, FfxNode child) {
-    if (ffx_sceneNode_hasFlags(child, NodeFlagHasParent)) {
+    ffx_sceneGroup_insertBefore(node, child, NULL);
+}
+
+void ffx_sceneGroup_insertBefore(FfxNode node, FfxNode _child,
+  FfxNode _sibling) {
+
+    GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+    if (state == NULL) { return; }
+
+    Node *child = _child;
+    Node *sibling = _sibling;
+
+    if (sibling && sibling->parent != node) {
+        printf("sibling is not a child; not added\n");
+        return;
+    }
+
+    for (Node *parent = node; parent; parent = parent->parent) {
+        if (parent == child) {
+            printf("child contains the group; not added\n");
+            return;
+        }
+    }
+
+    if (child->parent == node) {
+        // Already a child; move it
+        if (child == sibling || child->nextSibling == sibling) { return; }
+        unlinkChild(state, child);
+
+    } else if (child->parent) {
         printf("child already has a parent; not added\n");
         return;
     }
-    ffx_sceneNode_setFlags(child, NodeFlagHasParent);
 
+    linkChild(node, state, child, sibling);
+}
+
+uint8_t ffx_sceneGroup_getOpacity(FfxNode node) {
+    GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+    if (state == NULL) { return 0; }
+    return state->opacity;
+}
+
+static void setOpacity(FfxNode node, fixed_ffxt opacity) {
     GroupNode *state = ffx_sceneNode_getState(node, &vtable);
     if (state == NULL) { return; }
 
-    if (state->firstChild == NULL) {
-        state->firstChild = state->lastChild = child;
-    } else {
-        FfxNode _lastChild = state->lastChild;
-        Node *lastChild = _lastChild;
-        lastChild->nextSibling = child;
-        state->lastChild = child;
-    }
+    int32_t value = (opacity + FM_1_2) >> 16;
+    if (value < 0) { value = 0; }
+    if (value > MAX_OPACITY) { value = MAX_OPACITY; }
+
+    state->opacity = value;
+}
+
+void ffx_sceneGroup_setOpacity(FfxNode node, uint8_t opacity) {
+    GroupNode *state = ffx_sceneNode_getState(node, &vtable);
+    if (state == NULL) { return; }
+    if (opacity > MAX_OPACITY) { opacity = MAX_OPACITY; }
+    ffx_sceneNode_createFixedAction(node, tofx(state->opacity),
+      tofx(opacity), setOpacity);
 }
@@ -44,6 +44,7 @@ static  void _renderRGB565(ImageRender *render, uint16_t *frameBuffer,
 
     const uint16_t *data = render->data;
     int16_t width = data[1];
+    int32_t stride = size.width;
 
     FfxClip clip = ffx_scene_clip(render->position, (FfxSize){
         .width = width, .height = data[2]
@@ -56,7 +57,8 @@ static  void _renderRGB565(ImageRender *render, uint16_t *frameBuffer,
     data += 3;
 
     for (int32_t y = clip.height; y; y--) {
-        uint16_t *output = &frameBuffer[(240 * (clip.vpY + y - 1)) + clip.vpX];
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y - 1)) +
+          clip.vpX];
         const uint16_t *input = &data[((clip.y + y - 1) * width) + clip.x];
         for (int32_t x = clip.width; x; x--) {
             *output++ = *input++;
@@ -71,6 +73,7 @@ static  void _renderRGB565_A4(ImageRender *render, uint16_t *frameBuffer,
 
     const uint16_t *data = render->data;
     int16_t width = data[1];
+    int32_t stride = size.width;
 
     FfxClip clip = ffx_scene_clip(render->position, (FfxSize){
         .width = width, .height = data[2]
@@ -89,7 +92,8 @@ static  void _renderRGB565_A4(ImageRender *render, uint16_t *frameBuffer,
     int32_t opacity = ffx_color_getOpacity(render->tint);
 
     for (int32_t y = clip.height; y; y--) {
-        uint16_t *output = &frameBuffer[(240 * (clip.vpY + y - 1)) + clip.vpX];
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y - 1)) +
+          clip.vpX];
 
         const uint16_t *input = &data[((clip.y + y - 1) * width) + clip.x];
         uint16_t ia = (((clip.y + y - 1) * width) + clip.x);
@@ -140,6 +144,7 @@ static  void _renderPal8(ImageRender *render, uint16_t *frameBuffer,
 
     const uint16_t *data = render->data;
     int16_t width = data[1];
+    int32_t stride = size.width;
 
     FfxClip clip = ffx_scene_clip(render->position, (FfxSize){
         .width = width, .height = data[2]
@@ -155,7 +160,8 @@ static  void _renderPal8(ImageRender *render, uint16_t *frameBuffer,
     data += 3 + 256;
 
     for (int32_t y = clip.height; y; y--) {
-        uint16_t *output = &frameBuffer[(240 * (clip.vpY + y - 1)) + clip.vpX];
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y - 1)) +
+          clip.vpX];
         const uint8_t *input = &pixels[((clip.y + y - 1) * width) + clip.x];
         for (int32_t x = clip.width; x; x--) {
             *output++ = palette[*input++];
@@ -204,7 +210,7 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     pos.y += worldPos.y;
 
     ImageRender *render = ffx_scene_createRender(node, sizeof(ImageRender));
-    render->data = state->data;
+    render->data = ffx_sceneNode_acquireImage(node, state->data);
     render->tint = state->tint;
     render->position = pos;
 }
@@ -229,11 +235,9 @@ static void dumpFunc(FfxNode node, int indent) {
 
     ImageNode *state = ffx_sceneNode_getState(node, &vtable);
 
-    FfxSize size = ffx_scene_getImageSize(state->data, 3);
-
     for (int i = 0; i < indent; i++) { printf("  "); }
     printf("<Image pos=%dx%d size=%dx%x image=%p>\n", pos.x, pos.y,
-      size.width, size.height, state->data);
+      state->data[1], state->data[2], state->data);
 }
 
 
@@ -258,6 +262,11 @@ bool ffx_scene_isImage(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneImage_stateSize() {
+    return sizeof(ImageNode);
+}
+
 
 //////////////////////////
 // Properties
@@ -302,12 +311,31 @@ void ffx_sceneImage_setTint(FfxNode node, color_ffxt tint) {
 // Static Methods
 
 FfxSize ffx_scene_getImageSize(const uint16_t *data, size_t length) {
-    FfxSize size;
-    size.width = data[1];
-    size.height = data[2];
+    if (data == NULL || length < 3 * sizeof(uint16_t)) {
+        return ffx_size(0, 0);
+    }
+
+    size_t pixels = (size_t)data[1] * data[2];
+
+    // The words implied by the header
+    size_t count = 3;
+    if ((data[0] & 0x0f) == 0x05) {
+        if (length < 4 * sizeof(uint16_t)) { return ffx_size(0, 0); }
+
+        // The renderer skips the alpha data by its stored length
+        size_t alphaCount = data[3];
+        if (alphaCount < (pixels + 3) / 4) { return ffx_size(0, 0); }
+        count += 1 + alphaCount + pixels;
+    } else if ((data[0] & 0x0f) == 0x04) {
+        count += pixels;
+    } else if ((data[0] & 0xff) == 0x38) {
+        count += 256 + ((pixels + 1) / 2);
+    } else {
+        return ffx_size(0, 0);
+    }
 
-    // @TODO validate image data
+    if (length < count * sizeof(uint16_t)) { return ffx_size(0, 0); }
 
-    return size;
+    return ffx_size(data[1], data[2]);
 }
 
@@ -1,5 +1,6 @@
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -20,8 +21,8 @@ typedef struct LabelNode {
 typedef struct LabelRender {
     FfxPoint position;
     FfxFont font;
-    color_ffxt textColor;
-    color_ffxt outlineColor;
+    FfxColorRGB565 textColor;
+    FfxColorRGB565 outlineColor;
     // Text goes here
 } LabelRender;
 
@@ -48,13 +49,23 @@ static const FfxNodeVTable vtable = {
 #define SPACE_WIDTH       (2)
 #define OUTLINE_WIDTH     (4)
 
+// Outlined text is drawn in bands of at most 240x24 pixels; the
+// most glyphs that can overlap a band is up to 4 lines of the small font,
+// including their outlines
+#define BAND_WIDTH          (240)
+#define BAND_HEIGHT         (24)
+#define MAX_VISIBLE_GLYPHS  (112)
+
 
 //////////////////////////
 // Utilities
 
 typedef struct FontInfo {
     const uint32_t *font;
-    const uint32_t *outlineFont;
+
+    // The outline and fill, combined at 2 bits per pixel
+    const uint32_t *combinedFont;
+
     uint32_t outlineWidth;
 } FontInfo;
 
@@ -67,30 +78,30 @@ FontInfo getFontInfo(FfxFont font) {
 
         case FfxFontSmall:
             result.font = font_small_normal;
-            result.outlineFont = font_small_normal_outline;
+            result.combinedFont = font_small_normal_combined;
             result.outlineWidth = 3;
             break;
         case FfxFontSmallBold:
             result.font = font_small_bold;
-            result.outlineFont = font_small_bold_outline;
+            result.combinedFont = font_small_bold_combined;
             break;
 
         case FfxFontMedium:
             result.font = font_medium_normal;
-            result.outlineFont = font_medium_normal_outline;
+            result.combinedFont = font_medium_normal_combined;
             break;
         case FfxFontMediumBold:
             result.font = font_medium_bold;
-            result.outlineFont = font_medium_bold_outline;
+            result.combinedFont = font_medium_bold_combined;
             break;
 
         case FfxFontLarge:
             result.font = font_large_normal;
-            result.outlineFont = font_large_normal_outline;
+            result.combinedFont = font_large_normal_combined;
             break;
         case FfxFontLargeBold:
             result.font = font_large_bold;
-            result.outlineFont = font_large_bold_outline;
+            result.combinedFont = font_large_bold_combined;
             break;
 
         default:
@@ -121,17 +132,16 @@ FfxFontMetrics ffx_scene_getFontMetrics(FfxFont font) {
 //////////////////////////
 // Rasterizing
 
-// NOTE: Alpha blending outlineColor is not currently supported as it
-//       requires memory allocated for a composite layer.
-
-static void renderGlyphOpaque(uint16_t *frameBuffer, int ox, int oy, int width,
-  int height, const uint32_t *data, color_ffxt _color) {
+static void renderGlyphOpaque(uint16_t *frameBuffer, int stride,
+  FfxSize size, int ox, int oy, int width, int height, const uint32_t *data,
+  const FfxColorRGB565 *color) {
 
     // Glyph is entirely outside the fragment; skip
-    if (ox < -width || ox > 240 || oy < -height || oy > 24) { return; }
+    if (ox < -width || ox > size.width || oy < -height || oy > size.height) {
+        return;
+    }
 
-    // Get the color, broken into its pre-multiplied components
-    uint16_t fg = ffx_color_rgb16(_color);
+    uint16_t fg = color->rgb16;
 
     int x = 0, y = 0;
     // @TODO: Use pointer math instead of multiply
@@ -141,8 +151,9 @@ static void renderGlyphOpaque(uint16_t *frameBuffer, int ox, int oy, int width,
         for (int i = 0; i < 32; i++) {
             int tx = ox + x, ty = oy + y;
             if (bitmap & (0x80000000 >> i)) {
-                if (tx >= 0 && tx < 240 && ty >= 0 && ty < 24) {
-                    frameBuffer[ty * 240 + tx] = fg;
+                if (tx >= 0 && tx < size.width && ty >= 0 &&
+                  ty < size.height) {
+                    frameBuffer[ty * stride + tx] = fg;
                 }
             }
 
@@ -156,24 +167,20 @@ static void renderGlyphOpaque(uint16_t *frameBuffer, int ox, int oy, int width,
     }
 }
 
-static void renderGlyphBlend(uint16_t *frameBuffer, int ox, int oy, int width,
-  int height, const uint32_t *data, color_ffxt _color) {
+static void renderGlyphBlend(uint16_t *frameBuffer, int stride,
+  FfxSize size, int ox, int oy, int width, int height, const uint32_t *data,
+  const FfxColorRGB565 *color) {
 
     // Glyph is entirely outside the fragment; skip
-    if (ox < -width || ox > 240 || oy < -height || oy > 24) { return; }
-
-    // Get the alpha and alpha inverse (ufixed:1.16)
-    uint32_t fga = FIXED_BITS_5(ffx_color_getOpacity(_color));
-    uint32_t fga_1 = FM_1 - fga;
+    if (ox < -width || ox > size.width || oy < -height || oy > size.height) {
+        return;
+    }
 
-    // Get the color, broken into its pre-multiplied components
-    uint16_t fg = ffx_color_rgb16(_color);
-    int fgpmR = fg >> 11;
-    fgpmR *= fga;
-    int fgpmG = (fg >> 5) & 0x3f;
-    fgpmG *= fga;
-    int fgpmB = fg & 0x1f;;
-    fgpmB *= fga;
+    // The alpha inverse and pre-multiplied components (ufixed:1.16)
+    uint32_t fga_1 = color->alpha_1;
+    int fgpmR = color->red;
+    int fgpmG = color->green;
+    int fgpmB = color->blue;
 
     int x = 0, y = 0;
     // @TODO: Use pointer math instead of multiply
@@ -183,28 +190,22 @@ static void renderGlyphBlend(uint16_t *frameBuffer, int ox, int oy, int width,
         for (int i = 0; i < 32; i++) {
             int tx = ox + x, ty = oy + y;
             if (bitmap & (0x80000000 >> i)) {
-                if (tx >= 0 && tx < 240 && ty >= 0 && ty < 24) {
-
-                    if (fga >= FM_1) {
-                        // 100% opaque
-                        frameBuffer[ty * 240 + tx] = fg;
-
-                    } else {
-
-                        // Get the current color...
-                        uint16_t bg = frameBuffer[ty * 240 + tx];
-                        int bgR = bg >> 11;
-                        int bgG = (bg >> 5) & 0x3f;
-                        int bgB = bg & 0x1f;
-
-                        // Blend the values and convert from fixed-point
-                        int blendR = (fgpmR + (fga_1 * bgR)) >> 16;
-                        int blendG = (fgpmG + (fga_1 * bgG)) >> 16;
-                        int blendB = (fgpmB + (fga_1 * bgB)) >> 16;
-
-                        frameBuffer[ty * 240 + tx] = (blendR << 11) |
-                          (blendG << 5) | blendB;
-                    }
+                if (tx >= 0 && tx < size.width && ty >= 0 &&
+                  ty < size.height) {
+
+                    // Get the current color...
+                    uint16_t bg = frameBuffer[ty * stride + tx];
+                    int bgR = bg >> 11;
+                    int bgG = (bg >> 5) & 0x3f;
+                    int bgB = bg & 0x1f;
+
+                    // Blend the values and convert from fixed-point
+                    int blendR = (fgpmR + (fga_1 * bgR)) >> 16;
+                    int blendG = (fgpmG + (fga_1 * bgG)) >> 16;
+                    int blendB = (fgpmB + (fga_1 * bgB)) >> 16;
+
+                    frameBuffer[ty * stride + tx] = (blendR << 11) |
+                      (blendG << 5) | blendB;
                 }
             }
 
@@ -218,11 +219,11 @@ static void renderGlyphBlend(uint16_t *frameBuffer, int ox, int oy, int width,
     }
 }
 
-static void renderText(uint16_t *frameBuffer, const char *text,
-  FfxPoint position, const uint32_t *font, int32_t strokeOffset,
-  color_ffxt color) {
+static void renderText(uint16_t *frameBuffer, FfxSize size,
+  const char *text, FfxPoint position, const uint32_t *font,
+  int32_t strokeOffset, const FfxColorRGB565 *color) {
 
-    uint8_t opacity = ffx_color_getOpacity(color);
+    uint8_t opacity = color->opacity;
 
     if (opacity == 0) { return; }
 
@@ -252,11 +253,188 @@ static void renderText(uint16_t *frameBuffer, const char *text,
         const uint32_t *data = &font[95 + offset];
 
         if (opacity == MAX_OPACITY) {
-            renderGlyphOpaque(frameBuffer, x + gpl, y + gpt, gw, gh, data, color);
+            renderGlyphOpaque(frameBuffer, size.width, size, x + gpl,
+              y + gpt, gw, gh, data, color);
         } else {
-            renderGlyphBlend(frameBuffer, x + gpl, y + gpt, gw, gh, data, color);
+            renderGlyphBlend(frameBuffer, size.width, size, x + gpl,
+              y + gpt, gw, gh, data, color);
+        }
+        x += width + SPACE_WIDTH;
+    }
+}
+
+typedef struct Glyph {
+    int16_t x, y;
+    uint8_t width, height;
+    const uint32_t *data;
+} Glyph;
+
+// Adds the glyphs of %%text%% at %%position%% which overlap a band of
+// %%size%% to %%glyphs%%, returning the new %%count%%
+static int collectGlyphs(Glyph *glyphs, int count, FfxSize size,
+  const char *text, FfxPoint position, const uint32_t *font) {
+
+    int32_t width = (font[0] >> 0) & 0xff;
+
+    int x = position.x, y = position.y;
+
+    int i = 0;
+    while (count < MAX_VISIBLE_GLYPHS && x < size.width + OUTLINE_WIDTH) {
+        char c = text[i++];
+
+        // NULL-termination
+        if (c == 0) { break; }
+
+        // non-printable character; @TODO: add placeholder
+        if (c <= ' ' || c > '~') {
+            x += width + SPACE_WIDTH;
+            continue;
         }
+
+        int index = (c - ' ');
+        int gw = (font[index] >> 27) & 0x1f;
+        int gh = (font[index] >> 22) & 0x1f;
+        int gx = x + ((font[index] >> 18) & 0x0f) - 6;
+        int gy = y + ((font[index] >> 13) & 0x1f) - 6;
+
         x += width + SPACE_WIDTH;
+
+        // Glyph is entirely outside the fragment; skip
+        if (gx < -gw || gx > size.width || gy < -gh || gy > size.height) {
+            continue;
+        }
+
+        Glyph *glyph = &glyphs[count++];
+        glyph->x = gx;
+        glyph->y = gy;
+        glyph->width = gw;
+        glyph->height = gh;
+        glyph->data = &font[95 + (font[index] & 0x1fff)];
+    }
+
+    return count;
+}
+
+// Each pixel of a combined glyph is none (0b00), outline (0b01) or fill
+// (0b10). Neighbouring glyph outlines overlap each other's fill, so the
+// codes for each row are merged (fill wins) and then every covered pixel
+// is written exactly once. The outline never lies under the fill, so
+// either color may be translucent.
+static void renderGlyphsCombined(uint16_t *frameBuffer, int stride,
+  FfxSize size, const Glyph *glyphs, int count,
+  const FfxColorRGB565 *outlineColor, const FfxColorRGB565 *textColor) {
+
+    if (count == 0) { return; }
+
+    const FfxColorRGB565 *colors[] = {
+        NULL, outlineColor, textColor, textColor
+    };
+
+    uint8_t codes[BAND_WIDTH] = { 0 };
+
+    for (int ty = 0; ty < size.height; ty++) {
+        int minX = size.width, maxX = 0;
+
+        // Merge the row of every glyph into the codes
+        for (int g = 0; g < count; g++) {
+            const Glyph *glyph = &glyphs[g];
+
+            int gy = ty - glyph->y;
+            if (gy < 0 || gy >= glyph->height) { continue; }
+
+            int x0 = (glyph->x < 0) ? -glyph->x: 0;
+            int x1 = glyph->width;
+            if (glyph->x + x1 > size.width) { x1 = size.width - glyph->x; }
+            if (x0 >= x1) { continue; }
+
+            if (glyph->x + x0 < minX) { minX = glyph->x + x0; }
+            if (glyph->x + x1 > maxX) { maxX = glyph->x + x1; }
+
+            int offset = gy * glyph->width + x0;
+            const uint32_t *word = &glyph->data[offset >> 4];
+            int remaining = 16 - (offset & 0xf);
+            uint32_t bitmap = *word++ << (2 * (offset & 0xf));
+
+            uint8_t *code = &codes[glyph->x + x0];
+            for (int gx = x0; gx < x1; gx++) {
+                if (remaining == 0) {
+                    bitmap = *word++;
+                    remaining = 16;
+                }
+
+                *code++ |= bitmap >> 30;
+                bitmap <<= 2;
+                remaining--;
+            }
+        }
+
+        // Write each covered pixel once, clearing the codes for the next row
+        uint16_t *output = &frameBuffer[ty * stride + minX];
+        for (int tx = minX; tx < maxX; tx++, output++) {
+            uint32_t code = codes[tx];
+            if (code == 0) { continue; }
+            codes[tx] = 0;
+
+            const FfxColorRGB565 *color = colors[code];
+            if (color->opacity == MAX_OPACITY) {
+                *output = color->rgb16;
+                continue;
+            }
+
+            if (color->opacity == 0) { continue; }
+
+            uint32_t fga_1 = color->alpha_1;
+
+            uint16_t bg = *output;
+            int blendR = (color->red + (fga_1 * (bg >> 11))) >> 16;
+            int blendG = (color->green + (fga_1 * ((bg >> 5) & 0x3f))) >> 16;
+            int blendB = (color->blue + (fga_1 * (bg & 0x1f))) >> 16;
+
+            *output = (blendR << 11) | (blendG << 5) | blendB;
+        }
+    }
+}
+
+// Renders %%count%% lines of text, each at its fragment-relative position.
+// All lines are merged when outlined, so an outline never covers the
+// fill of an adjacent line.
+// See: node-paragraph.c
+void _ffx_renderTextLines(uint16_t *frameBuffer, FfxSize size, FfxFont font,
+  const char **lines, const FfxPoint *positions, size_t count,
+  const FfxColorRGB565 *textColor, const FfxColorRGB565 *outlineColor) {
+
+    FontInfo fontInfo = getFontInfo(font);
+
+    // Without an outline, the plain font has far fewer bits to scan
+    if (outlineColor->opacity == 0) {
+        for (int i = 0; i < count; i++) {
+            renderText(frameBuffer, size, lines[i], positions[i],
+              fontInfo.font, 0, textColor);
+        }
+        return;
+    }
+
+    Glyph glyphs[MAX_VISIBLE_GLYPHS];
+
+    for (int32_t by = 0; by < size.height; by += BAND_HEIGHT) {
+        for (int32_t bx = 0; bx < size.width; bx += BAND_WIDTH) {
+            FfxSize band = ffx_size(size.width - bx, size.height - by);
+            if (band.width > BAND_WIDTH) { band.width = BAND_WIDTH; }
+            if (band.height > BAND_HEIGHT) { band.height = BAND_HEIGHT; }
+
+            int glyphCount = 0;
+            for (int i = 0; i < count; i++) {
+                FfxPoint position = positions[i];
+                position.x -= bx;
+                position.y -= by;
+                glyphCount = collectGlyphs(glyphs, glyphCount, band,
+                  lines[i], position, fontInfo.combinedFont);
+            }
+
+            renderGlyphsCombined(&frameBuffer[by * size.width + bx],
+              size.width, band, glyphs, glyphCount, outlineColor,
+              textColor);
+        }
     }
 }
 
@@ -313,7 +491,9 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
             break;
     }
 
-    if (pos.y >= 240 || pos.y + metrics.size.height < 0) { return; }
+    if (pos.y >= FFX_SCENE_HEIGHT || pos.y + metrics.size.height < 0) {
+        return;
+    }
 
     size_t strLen = strlen(label->text);
     if (strLen == 0) { return; }
@@ -330,13 +510,13 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
             break;
     }
 
-    if (pos.x > 240 || pos.x + width <= 0) { return; }
+    if (pos.x > FFX_SCENE_WIDTH || pos.x + width <= 0) { return; }
 
     LabelRender *render = ffx_scene_createRender(node, sizeof(LabelRender) +
       ((strLen + 1 + 3) & 0xfffffc)); // @TODO: move this to alloc?
     render->font = label->font;
-    render->textColor = label->textColor;
-    render->outlineColor = label->outlineColor;
+    render->textColor = ffx_color_parseRGB565(label->textColor);
+    render->outlineColor = ffx_color_parseRGB565(label->outlineColor);
     render->position = pos;
 
     strcpy((char*)&render[1], label->text);
@@ -353,7 +533,6 @@ static void renderFunc(void *_render, uint16_t *frameBuffer,
 
     FontInfo fontInfo = getFontInfo(render->font);
     const uint32_t *font = fontInfo.font;
-    const uint32_t *outlineFont = fontInfo.outlineFont;
 
     int32_t height = (font[0] >> 8) & 0xff;
     int32_t width = (font[0] >> 0) & 0xff;
@@ -362,22 +541,22 @@ static void renderFunc(void *_render, uint16_t *frameBuffer,
     pos.x += render->position.x;
     pos.y += render->position.y;
 
-    FfxClip clip = ffx_scene_clip(render->position, (FfxSize){
-        .width = (2 * OUTLINE_WIDTH) + ((length - 1) * (width + SPACE_WIDTH)),
+    // The outline extends past the text on every side
+    FfxClip clip = ffx_scene_clip(pos, (FfxSize){
+        .width = (2 * OUTLINE_WIDTH) + (length * (width + SPACE_WIDTH)) -
+          SPACE_WIDTH,
         .height = (2 * OUTLINE_WIDTH) + height
     }, origin, size);
 
     if (clip.width == 0) { return; }
 
     FfxPoint position = {
-        .x = render->position.x,
+        .x = render->position.x - origin.x,
         .y = render->position.y - origin.y
     };
 
-    renderText(frameBuffer, text, position, outlineFont, 0,
-      render->outlineColor);
-    renderText(frameBuffer, text, position, font, 0,
-      render->textColor);
+    _ffx_renderTextLines(frameBuffer, size, render->font, &text, &position,
+      1, &render->textColor, &render->outlineColor);
 }
 
 static void dumpFunc(FfxNode node, int indent) {
@@ -422,6 +601,11 @@ bool ffx_scene_isLabel(FfxNode node) {
     return ffx_scene_isNode(node, &vtable);
 }
 
+// See: blob.c
+size_t _ffx_sceneLabel_stateSize() {
+    return sizeof(LabelNode);
+}
+
 
 //////////////////////////
 // Properties
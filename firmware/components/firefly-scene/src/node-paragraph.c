@@ -0,0 +1,617 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firefly-scene-private.h"
+#include "firefly-color.h"
+
+
+// See: node-label.c
+#define SPACE_WIDTH         (2)
+#define OUTLINE_WIDTH       (4)
+#define BAND_HEIGHT         (24)
+
+// The most lines which can overlap a band, including their outlines, for
+// the smallest font
+#define MAX_FRAGMENT_LINES  (4)
+
+// Line offsets are stored as uint16_t
+#define MAX_TEXT_LENGTH     (0xffff)
+
+#define ELLIPSIS            "..."
+#define ELLIPSIS_LENGTH     (3)
+
+
+typedef struct Line {
+    uint16_t offset;
+    uint16_t length;
+} Line;
+
+typedef struct ParagraphNode {
+    FfxFont font;
+    FfxTextAlign align;
+    FfxTextWrap wrap;
+    FfxSize size;
+    color_ffxt textColor;
+    color_ffxt outlineColor;
+    char *text;
+    uint16_t textLength;
+
+    // The cached line breaks and the key they were computed for; the
+    // layout is only recomputed once the text is set or the width or
+    // height in characters or the wrap mode change
+    bool layoutValid;
+    uint16_t layoutColumns;
+    uint16_t layoutRows;
+    FfxTextWrap layoutWrap;
+
+    // Only replaced (never cleared part way) by the sequence, so other
+    // tasks may read them
+    bool truncated;
+    uint16_t lineCount;
+    Line *lines;
+} ParagraphNode;
+
+typedef struct RenderLine {
+    FfxPoint position;
+    uint16_t offset;
+} RenderLine;
+
+typedef struct ParagraphRender {
+    FfxFont font;
+    FfxColorRGB565 textColor;
+    FfxColorRGB565 outlineColor;
+    int16_t lineHeight;
+    uint16_t lineCount;
+    // RenderLine lines[lineCount], then each NULL-terminated line goes here
+} ParagraphRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "ParagraphNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+// See: node-label.c
+void _ffx_renderTextLines(uint16_t *frameBuffer, FfxSize size, FfxFont font,
+  const char **lines, const FfxPoint *positions, size_t count,
+  const FfxColorRGB565 *textColor, const FfxColorRGB565 *outlineColor);
+
+
+//////////////////////////
+// Layout
+
+// Breaks %%text%% into lines of at most %%columns%% characters, writing
+// up to %%maxLines%% into %%lines%% (which may be NULL to only count
+// them). Returns the line count, setting %%truncated%% if text remains.
+static size_t breakLines(const char *text, size_t columns, FfxTextWrap wrap,
+  Line *lines, size_t maxLines, bool *truncated) {
+
+    *truncated = false;
+    if (columns == 0) {
+        *truncated = (text[0] != 0);
+        return 0;
+    }
+
+    size_t count = 0;
+
+    size_t i = 0;
+    while (text[i]) {
+        if (count == maxLines) {
+            *truncated = true;
+            break;
+        }
+
+        size_t start = i, end = i;
+        size_t lastSpace = start;
+        while (text[end] && text[end] != '\n' && end - start < columns) {
+            if (text[end] == ' ') { lastSpace = end; }
+            end++;
+        }
+
+        size_t next = end;
+        bool wrapped = true;
+
+        if (text[end] == '\n') {
+            next = end + 1;
+            wrapped = false;
+
+        } else if (text[end] && text[end] != ' ' &&
+          wrap == FfxTextWrapWord && lastSpace > start) {
+            // The line ends part way through a word; move the word to
+            // the next line (words longer than a line are split)
+            end = lastSpace;
+            next = lastSpace + 1;
+        }
+
+        // Trailing spaces are not drawn, so do not count against alignment
+        while (end > start && text[end - 1] == ' ') { end--; }
+
+        if (lines) {
+            lines[count].offset = start;
+            lines[count].length = end - start;
+        }
+        count++;
+
+        // The spaces at a wrapped line break are dropped; indentation
+        // after an explicit newline is kept
+        if (wrapped) {
+            while (text[next] == ' ') { next++; }
+        }
+
+        i = next;
+    }
+
+    return count;
+}
+
+static void layout(FfxNode node, ParagraphNode *paragraph) {
+    FfxFontMetrics metrics = ffx_scene_getFontMetrics(paragraph->font);
+
+    size_t advance = metrics.size.width + SPACE_WIDTH;
+    uint16_t columns = (paragraph->size.width + SPACE_WIDTH) / advance;
+    uint16_t rows = paragraph->size.height / metrics.size.height;
+
+    const char *text = paragraph->text;
+
+    // The cached line breaks still apply
+    if (paragraph->layoutValid && paragraph->layoutRows == rows &&
+      paragraph->layoutColumns == columns &&
+      paragraph->layoutWrap == paragraph->wrap) {
+        return;
+    }
+
+    paragraph->layoutValid = true;
+    paragraph->layoutColumns = columns;
+    paragraph->layoutRows = rows;
+    paragraph->layoutWrap = paragraph->wrap;
+
+    Line *lines = NULL;
+    size_t count = 0;
+    bool truncated = false;
+
+    if (text) {
+        count = breakLines(text, columns, paragraph->wrap, NULL, rows,
+          &truncated);
+    }
+
+    if (count) {
+        lines = ffx_sceneNode_memAlloc(node, count * sizeof(Line));
+        if (lines == NULL) {
+            printf("failed to allocate paragraph lines: count=%d\n",
+              (int)count);
+            count = 0;
+        }
+    }
+
+    if (lines) {
+        breakLines(text, columns, paragraph->wrap, lines, rows, &truncated);
+
+        // Make room for the ellipsis on the last line
+        if (truncated) {
+            Line *last = &lines[count - 1];
+            size_t maxLength = (columns > ELLIPSIS_LENGTH) ?
+              (columns - ELLIPSIS_LENGTH): 0;
+            if (last->length > maxLength) { last->length = maxLength; }
+            while (last->length &&
+              text[last->offset + last->length - 1] == ' ') {
+                last->length--;
+            }
+        }
+    }
+
+    if (paragraph->lines) { ffx_sceneNode_memFree(node, paragraph->lines); }
+
+    paragraph->lines = lines;
+    paragraph->lineCount = count;
+    paragraph->truncated = truncated;
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+
+    ffx_sceneParagraph_setText(node, NULL);
+
+    if (paragraph->lines) {
+        ffx_sceneNode_memFree(node, paragraph->lines);
+        paragraph->lines = NULL;
+    }
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+
+    // Kept current even when not drawn, for the line count and truncated
+    // getters
+    layout(node, paragraph);
+    if (paragraph->lineCount == 0) { return; }
+
+    FfxSize size = paragraph->size;
+    if (pos.x - OUTLINE_WIDTH >= FFX_SCENE_WIDTH ||
+      pos.x + size.width + OUTLINE_WIDTH <= 0) {
+        return;
+    }
+
+    FfxFontMetrics metrics = ffx_scene_getFontMetrics(paragraph->font);
+    int lineHeight = metrics.size.height;
+    int advance = metrics.size.width + SPACE_WIDTH;
+
+    // Only the lines which overlap the screen are copied into the render
+    int first = -1, last = -1;
+    size_t textLength = 0;
+    for (int i = 0; i < paragraph->lineCount; i++) {
+        int y = pos.y + i * lineHeight;
+        if (y + lineHeight + OUTLINE_WIDTH <= 0) { continue; }
+        if (y - OUTLINE_WIDTH >= FFX_SCENE_HEIGHT) { break; }
+
+        if (first == -1) { first = i; }
+        last = i;
+        textLength += paragraph->lines[i].length + 1;
+    }
+
+    if (first == -1) { return; }
+
+    // A line too narrow for the whole ellipsis shows as much as fits
+    size_t ellipsisLength = 0;
+    if (paragraph->truncated && last == paragraph->lineCount - 1) {
+        ellipsisLength = paragraph->layoutColumns;
+        if (ellipsisLength > ELLIPSIS_LENGTH) {
+            ellipsisLength = ELLIPSIS_LENGTH;
+        }
+    }
+    textLength += ellipsisLength;
+
+    size_t lineCount = last - first + 1;
+    ParagraphRender *render = ffx_scene_createRender(node,
+      sizeof(ParagraphRender) + lineCount * sizeof(RenderLine) +
+      ((textLength + 3) & ~3));
+    render->font = paragraph->font;
+    render->textColor = ffx_color_parseRGB565(paragraph->textColor);
+    render->outlineColor = ffx_color_parseRGB565(paragraph->outlineColor);
+    render->lineHeight = lineHeight;
+    render->lineCount = lineCount;
+
+    RenderLine *renderLines = (RenderLine*)&render[1];
+    char *text = (char*)&renderLines[lineCount];
+
+    size_t offset = 0;
+    for (int i = first; i <= last; i++) {
+        const Line *line = &paragraph->lines[i];
+
+        size_t length = line->length;
+        if (i == last) { length += ellipsisLength; }
+
+        // Handle horizontal alignment
+        int width = advance * length - SPACE_WIDTH;
+        int x = pos.x;
+        switch (paragraph->align & (FfxTextAlignCenter | FfxTextAlignRight)) {
+            case FfxTextAlignCenter:
+                x += (size.width - width) / 2;
+                break;
+            case FfxTextAlignRight:
+                x += size.width - width;
+                break;
+            default:
+                break;
+        }
+
+        RenderLine *renderLine = &renderLines[i - first];
+        renderLine->position = (FfxPoint){
+            .x = x,
+            .y = pos.y + i * lineHeight
+        };
+        renderLine->offset = offset;
+
+        memcpy(&text[offset], &paragraph->text[line->offset], line->length);
+        offset += line->length;
+
+        if (i == last) {
+            memcpy(&text[offset], ELLIPSIS, ellipsisLength);
+            offset += ellipsisLength;
+        }
+
+        text[offset++] = 0;
+    }
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    ParagraphRender *render = _render;
+    const RenderLine *lines = (RenderLine*)&render[1];
+    const char *text = (char*)&lines[render->lineCount];
+
+    const char *visible[MAX_FRAGMENT_LINES];
+    FfxPoint positions[MAX_FRAGMENT_LINES];
+
+    // Taller fragments are drawn a band of rows at a time, so no more
+    // than MAX_FRAGMENT_LINES can overlap
+    for (int32_t by = 0; by < size.height; by += BAND_HEIGHT) {
+        FfxSize band = ffx_size(size.width, size.height - by);
+        if (band.height > BAND_HEIGHT) { band.height = BAND_HEIGHT; }
+
+        size_t count = 0;
+
+        // Cull the lines (and their outlines) which miss this band
+        for (int i = 0; i < render->lineCount; i++) {
+            int y = lines[i].position.y - origin.y - by;
+            if (y + render->lineHeight + OUTLINE_WIDTH <= 0) { continue; }
+            if (y - OUTLINE_WIDTH >= band.height) { break; }
+            if (count == MAX_FRAGMENT_LINES) { break; }
+
+            visible[count] = &text[lines[i].offset];
+            positions[count] = (FfxPoint){
+                .x = lines[i].position.x - origin.x,
+                .y = y
+            };
+            count++;
+        }
+
+        if (count == 0) { continue; }
+
+        _ffx_renderTextLines(&frameBuffer[by * size.width], band,
+          render->font, visible, positions, count, &render->textColor,
+          &render->outlineColor);
+    }
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+
+    char textColorName[COLOR_STRING_LENGTH] = { 0 };
+    ffx_color_sprintf(paragraph->textColor, textColorName);
+
+    int fontSize = paragraph->font & FfxFontSizeMask;
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Paragraph pos=%dx%d size=%dx%d font=%dpt%s color=%s lines=%d%s "
+      "text=\"%s\">\n",
+      pos.x, pos.y, paragraph->size.width, paragraph->size.height, fontSize,
+      (paragraph->font & FfxFontBoldMask) ? "-bold": "", textColorName,
+      paragraph->lineCount, paragraph->truncated ? " truncated": "",
+      paragraph->text ? paragraph->text: "");
+}
+
+
+//////////////////////////
+// Life-cycle
+
+FfxNode ffx_scene_createParagraph(FfxScene scene, FfxFont font,
+  FfxSize size, const char* text) {
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable,
+      sizeof(ParagraphNode));
+    if (node == NULL) { return NULL; }
+
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    paragraph->font = font;
+    paragraph->size = size;
+    paragraph->align = FfxTextAlignLeft;
+    paragraph->wrap = FfxTextWrapWord;
+    paragraph->textColor = ffx_color_rgb(255, 255, 255);
+    paragraph->outlineColor = ffx_color_rgba(0, 0, 0, 0);
+
+    ffx_sceneParagraph_setText(node, text);
+
+    return node;
+}
+
+bool ffx_scene_isParagraph(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+size_t ffx_sceneParagraph_getTextLength(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->textLength;
+}
+
+size_t ffx_sceneParagraph_copyText(FfxNode node, char* output,
+  size_t length) {
+
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL || length == 0) { return 0; }
+
+    const char *text = paragraph->text ? paragraph->text: "";
+
+    size_t i = 0;
+    while (text[i] && i < length - 1) {
+        output[i] = text[i];
+        i++;
+    }
+    output[i] = 0;
+
+    return i;
+}
+
+void ffx_sceneParagraph_setText(FfxNode node, const char* text) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+
+    size_t length = text ? strlen(text): 0;
+    if (length > MAX_TEXT_LENGTH) {
+        printf("paragraph text too long; not set: length=%d\n", (int)length);
+        return;
+    }
+
+    // Unchanged; keep the text and its layout
+    if (paragraph->text && text && strcmp(paragraph->text, text) == 0) {
+        return;
+    }
+
+    if (paragraph->text) {
+        ffx_sceneNode_memFree(node, paragraph->text);
+        paragraph->text = NULL;
+    }
+
+    paragraph->layoutValid = false;
+    paragraph->textLength = 0;
+
+    if (length == 0) { return; }
+
+    paragraph->text = ffx_sceneNode_memAlloc(node, length + 1);
+    if (paragraph->text == NULL) {
+        printf("failed to allocate paragraph text: length=%d\n", (int)length);
+        return;
+    }
+    strcpy(paragraph->text, text);
+    paragraph->textLength = length;
+}
+
+void ffx_sceneParagraph_setTextFormat(FfxNode node, const char* format,
+  ...) {
+
+    char *str = NULL;
+
+    va_list args;
+    va_start(args, format);
+    int length = vasprintf(&str, format, args);
+    va_end(args);
+
+    if (length == -1 || str == NULL) {
+        printf("failed to format paragraph text\n");
+        return;
+    }
+
+    ffx_sceneParagraph_setText(node, str);
+
+    free(str);
+}
+
+FfxFont ffx_sceneParagraph_getFont(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->font;
+}
+
+void ffx_sceneParagraph_setFont(FfxNode node, FfxFont font) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->font = font;
+}
+
+FfxSize ffx_sceneParagraph_getSize(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return (FfxSize){ }; }
+    return paragraph->size;
+}
+
+void ffx_sceneParagraph_setSize(FfxNode node, FfxSize size) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->size = size;
+}
+
+FfxTextAlign ffx_sceneParagraph_getAlign(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->align;
+}
+
+void ffx_sceneParagraph_setAlign(FfxNode node, FfxTextAlign align) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->align = align;
+}
+
+FfxTextWrap ffx_sceneParagraph_getWrap(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->wrap;
+}
+
+void ffx_sceneParagraph_setWrap(FfxNode node, FfxTextWrap wrap) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->wrap = wrap;
+}
+
+size_t ffx_sceneParagraph_getLineCount(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->lineCount;
+}
+
+bool ffx_sceneParagraph_getTruncated(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return false; }
+    return paragraph->truncated;
+}
+
+color_ffxt ffx_sceneParagraph_getTextColor(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->textColor;
+}
+
+static void setTextColor(FfxNode node, color_ffxt color) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->textColor = color;
+}
+
+void ffx_sceneParagraph_setTextColor(FfxNode node, color_ffxt color) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    if (paragraph->textColor == color) { return; }
+    ffx_sceneNode_createColorAction(node, paragraph->textColor, color,
+      setTextColor);
+}
+
+color_ffxt ffx_sceneParagraph_getOutlineColor(FfxNode node) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return 0; }
+    return paragraph->outlineColor;
+}
+
+static void setOutlineColor(FfxNode node, color_ffxt color) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    paragraph->outlineColor = color;
+}
+
+void ffx_sceneParagraph_setOutlineColor(FfxNode node, color_ffxt color) {
+    ParagraphNode *paragraph = ffx_sceneNode_getState(node, &vtable);
+    if (paragraph == NULL) { return; }
+    if (paragraph->outlineColor == color) { return; }
+    ffx_sceneNode_createColorAction(node, paragraph->outlineColor, color,
+      setOutlineColor);
+}
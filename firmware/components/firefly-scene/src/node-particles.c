@@ -0,0 +1,602 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "scene.h"
+
+
+// Particles are simulated as parallel arrays (rather than a node or
+// animation each), so a step is a tight loop over a few words per
+// particle, and each sequence builds a draw list sorted by top row, so
+// each fragment only visits the particles which overlap it.
+
+#define MAX_PARTICLES      (2048)
+#define MAX_POINT_SIZE     (4)
+
+#define IMAGE_RGB565       (0x04)
+#define IMAGE_RGB565_A4    (0x05)
+
+// A particle's life is tracked as a phase from 0 to PHASE_END, so the
+// color ramp can be indexed without a division
+#define PHASE_BITS         (24)
+#define PHASE_END          (1 << PHASE_BITS)
+
+#define RAMP_BITS          (4)
+#define RAMP_STEPS         (1 << RAMP_BITS)
+
+// A long stall would otherwise fling every particle; cap a step (ms)
+#define MAX_STEP           (100)
+
+typedef struct ParticlesNode {
+    FfxParticleEmitter emitter;
+    const uint16_t *sprite;
+
+    uint16_t capacity;
+    uint16_t count;
+
+    // Particles requested by ffx_sceneParticles_emit
+    uint16_t burst;
+
+    bool started;
+    int32_t lastTick;
+
+    // Particle-milliseconds owed to the emission rate; each 1000 is
+    // one particle
+    uint32_t owed;
+
+    uint32_t seed;
+
+    // The emitter color at each step of life
+    uint16_t rampColor[RAMP_STEPS];
+    uint8_t rampOpacity[RAMP_STEPS];
+
+    // The live particles, in world pixels and pixels per second
+    // (fixed:15.16)
+    fixed_ffxt *x, *y;
+    fixed_ffxt *vx, *vy;
+    uint32_t *phase, *phaseStep;
+
+    // The visible particles from the last sequence, by top row
+    uint16_t drawCount;
+    int16_t *drawX, *drawY;
+    uint8_t *drawRamp;
+} ParticlesNode;
+
+// The draw list is only rebuilt by the next sequence, which frees this
+// render first; the sprite the list was built for is kept in case it is
+// changed before then
+typedef struct ParticlesRender {
+    ParticlesNode *particles;
+    const uint16_t *sprite;
+    FfxSize size;
+} ParticlesRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "ParticlesNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+
+// xorshift32; returns 16 random bits
+static inline uint32_t random16(ParticlesNode *particles) {
+    uint32_t x = particles->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    particles->seed = x;
+    return x >> 16;
+}
+
+// A value in [value - jitter, value + jitter) (fixed:15.16); jitter
+// must be below 32768
+static inline fixed_ffxt jitterfx(ParticlesNode *particles, int32_t value,
+  uint32_t jitter) {
+    if (jitter == 0) { return tofx(value); }
+    return tofx(value) + (int32_t)(random16(particles) * (2 * jitter) -
+      (jitter << 16));
+}
+
+static inline fixed_ffxt stepfx(fixed_ffxt x, fixed_ffxt y) {
+    return ((int64_t)x * y) >> 16;
+}
+
+static FfxSize getExtent(ParticlesNode *particles) {
+    if (particles->sprite) {
+        return ffx_size(particles->sprite[1], particles->sprite[2]);
+    }
+
+    uint32_t size = particles->emitter.pointSize;
+    return ffx_size(size, size);
+}
+
+
+//////////////////////////
+// Rasterizing
+
+static inline uint32_t spread(uint16_t c) {
+    return ((c | ((uint32_t)c << 16)) & 0x07e0f81f);
+}
+
+static inline uint16_t unspread(uint32_t c) {
+    c &= 0x07e0f81f;
+    return (c | (c >> 16)) & 0xffff;
+}
+
+static void renderPoint(uint16_t *frameBuffer, FfxPoint origin,
+  FfxSize size, int32_t x0, int32_t y0, int32_t extent, uint16_t color,
+  uint32_t opacity) {
+
+    int32_t x1 = x0 + extent, y1 = y0 + extent;
+
+    x0 -= origin.x; x1 -= origin.x;
+    y0 -= origin.y; y1 -= origin.y;
+
+    if (x0 < 0) { x0 = 0; }
+    if (y0 < 0) { y0 = 0; }
+    if (x1 > size.width) { x1 = size.width; }
+    if (y1 > size.height) { y1 = size.height; }
+    if (x0 >= x1 || y0 >= y1) { return; }
+
+    if (opacity == MAX_OPACITY) {
+        for (int32_t y = y0; y < y1; y++) {
+            uint16_t *output = &frameBuffer[size.width * y];
+            for (int32_t x = x0; x < x1; x++) { output[x] = color; }
+        }
+        return;
+    }
+
+    uint32_t fg = spread(color) * opacity, alpha_1 = MAX_OPACITY - opacity;
+
+    for (int32_t y = y0; y < y1; y++) {
+        uint16_t *output = &frameBuffer[size.width * y];
+        for (int32_t x = x0; x < x1; x++) {
+            output[x] = unspread((fg + spread(output[x]) * alpha_1) >> 5);
+        }
+    }
+}
+
+static void renderSprite(uint16_t *frameBuffer, FfxPoint origin,
+  FfxSize size, const uint16_t *data, int32_t x0, int32_t y0,
+  uint32_t opacity) {
+
+    int32_t width = data[1];
+
+    FfxClip clip = ffx_scene_clip(ffx_point(x0, y0), ffx_size(width,
+      data[2]), origin, size);
+    if (clip.width == 0) { return; }
+
+    if ((data[0] & 0x0f) == IMAGE_RGB565) {
+        const uint16_t *pixels = &data[3];
+
+        for (int32_t y = 0; y < clip.height; y++) {
+            uint16_t *output = &frameBuffer[(size.width * (clip.vpY + y)) +
+              clip.vpX];
+            const uint16_t *input = &pixels[(clip.y + y) * width + clip.x];
+
+            if (opacity == MAX_OPACITY) {
+                memcpy(output, input, clip.width * sizeof(uint16_t));
+                continue;
+            }
+
+            uint32_t alpha_1 = MAX_OPACITY - opacity;
+            for (int32_t x = 0; x < clip.width; x++) {
+                output[x] = unspread((spread(input[x]) * opacity +
+                  spread(output[x]) * alpha_1) >> 5);
+            }
+        }
+
+        return;
+    }
+
+    // RGB565_A4; the alpha precedes the pixels
+    const uint16_t *alpha = &data[4];
+    const uint16_t *pixels = &data[4 + data[3]];
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        uint16_t *output = &frameBuffer[(size.width * (clip.vpY + y)) +
+          clip.vpX];
+        uint32_t i = (clip.y + y) * width + clip.x;
+
+        for (int32_t x = 0; x < clip.width; x++, i++) {
+            uint32_t a = (alpha[i / 4] >> (12 - 4 * (i % 4))) & 0x0f;
+            if (a == 0) { continue; }
+
+            // The 4-bit alpha scaled by the opacity; [0, 32]
+            a = (a * opacity * 273 + 2048) >> 12;
+
+            output[x] = unspread((spread(pixels[i]) * a +
+              spread(output[x]) * (MAX_OPACITY - a)) >> 5);
+        }
+    }
+}
+
+// Returns the first particle whose top row is at or below %%top%%. Tops
+// above the screen are sorted as row 0, which is before any %%top%% that
+// needs searching for.
+static size_t findParticle(ParticlesNode *particles, int32_t top) {
+    if (top <= 0) { return 0; }
+
+    const int16_t *drawY = particles->drawY;
+
+    size_t lo = 0, hi = particles->drawCount;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (drawY[mid] < top) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    ParticlesRender *render = _render;
+    ParticlesNode *particles = render->particles;
+
+    int32_t extent = render->size.height;
+    int32_t bottom = origin.y + size.height;
+
+    const int16_t *drawX = particles->drawX, *drawY = particles->drawY;
+    const uint8_t *drawRamp = particles->drawRamp;
+    size_t count = particles->drawCount;
+
+    size_t i = findParticle(particles, origin.y - extent + 1);
+
+    if (render->sprite) {
+        for (; i < count && drawY[i] < bottom; i++) {
+            renderSprite(frameBuffer, origin, size, render->sprite,
+              drawX[i], drawY[i], particles->rampOpacity[drawRamp[i]]);
+        }
+        return;
+    }
+
+    for (; i < count && drawY[i] < bottom; i++) {
+        uint32_t ramp = drawRamp[i];
+        renderPoint(frameBuffer, origin, size, drawX[i], drawY[i], extent,
+          particles->rampColor[ramp], particles->rampOpacity[ramp]);
+    }
+}
+
+
+//////////////////////////
+// Simulating
+
+static void emitParticles(ParticlesNode *particles, size_t count,
+  FfxPoint worldPos) {
+
+    const FfxParticleEmitter *emitter = &particles->emitter;
+
+    size_t available = particles->capacity - particles->count;
+    if (count > available) { count = available; }
+
+    FfxSize area = emitter->area;
+
+    for (size_t c = 0; c < count; c++) {
+        size_t i = particles->count++;
+
+        particles->x[i] = tofx(worldPos.x) + random16(particles) *
+          area.width - (area.width << 15);
+        particles->y[i] = tofx(worldPos.y) + random16(particles) *
+          area.height - (area.height << 15);
+
+        particles->vx[i] = jitterfx(particles, emitter->velocity.x,
+          emitter->velocityJitter.x);
+        particles->vy[i] = jitterfx(particles, emitter->velocity.y,
+          emitter->velocityJitter.y);
+
+        uint32_t life = emitter->life;
+        life += (random16(particles) * emitter->lifeJitter) >> 16;
+        if (life == 0) { life = 1; }
+
+        particles->phase[i] = 0;
+        particles->phaseStep[i] = PHASE_END / life;
+    }
+}
+
+static void stepParticles(ParticlesNode *particles, uint32_t dt) {
+    const FfxParticleEmitter *emitter = &particles->emitter;
+
+    // The step as a fraction of a second, and the change in velocity
+    fixed_ffxt k = (dt << 16) / 1000;
+    fixed_ffxt dvx = stepfx(tofx(emitter->gravity.x), k);
+    fixed_ffxt dvy = stepfx(tofx(emitter->gravity.y), k);
+
+    fixed_ffxt *x = particles->x, *y = particles->y;
+    fixed_ffxt *vx = particles->vx, *vy = particles->vy;
+    uint32_t *phase = particles->phase, *phaseStep = particles->phaseStep;
+
+    size_t count = particles->count;
+
+    size_t i = 0;
+    while (i < count) {
+        uint32_t p = phase[i] + phaseStep[i] * dt;
+
+        if (p >= PHASE_END) {
+            // Expired; move the last particle into its place
+            count--;
+            x[i] = x[count];
+            y[i] = y[count];
+            vx[i] = vx[count];
+            vy[i] = vy[count];
+            phase[i] = phase[count];
+            phaseStep[i] = phaseStep[count];
+            continue;
+        }
+
+        phase[i] = p;
+        x[i] += stepfx(vx[i], k);
+        y[i] += stepfx(vy[i], k);
+        vx[i] += dvx;
+        vy[i] += dvy;
+
+        i++;
+    }
+
+    particles->count = count;
+}
+
+// Counting sort the visible particles by their top row; tops above the
+// screen sort as row 0
+static void buildDrawList(ParticlesNode *particles) {
+    FfxSize extent = getExtent(particles);
+    int32_t halfWidth = extent.width / 2, halfHeight = extent.height / 2;
+
+    const fixed_ffxt *x = particles->x, *y = particles->y;
+    const uint32_t *phase = particles->phase;
+    size_t count = particles->count;
+
+    uint16_t rows[FFX_SCENE_HEIGHT + 1] = { 0 };
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t left = (x[i] >> 16) - halfWidth;
+        int32_t top = (y[i] >> 16) - halfHeight;
+        if (left >= FFX_SCENE_WIDTH || left + extent.width <= 0) { continue; }
+        if (top >= FFX_SCENE_HEIGHT || top + extent.height <= 0) { continue; }
+        rows[(top < 0 ? 0: top) + 1]++;
+    }
+
+    for (int r = 1; r <= FFX_SCENE_HEIGHT; r++) { rows[r] += rows[r - 1]; }
+
+    particles->drawCount = rows[FFX_SCENE_HEIGHT];
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t left = (x[i] >> 16) - halfWidth;
+        int32_t top = (y[i] >> 16) - halfHeight;
+        if (left >= FFX_SCENE_WIDTH || left + extent.width <= 0) { continue; }
+        if (top >= FFX_SCENE_HEIGHT || top + extent.height <= 0) { continue; }
+
+        size_t d = rows[top < 0 ? 0: top]++;
+        particles->drawX[d] = left;
+        particles->drawY[d] = top;
+        particles->drawRamp[d] = phase[i] >> (PHASE_BITS - RAMP_BITS);
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+
+    // The arrays share one allocation
+    ffx_sceneNode_memFree(node, particles->x);
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+
+    int32_t now = ((Node*)node)->scene->tick;
+
+    uint32_t dt = 0;
+    if (particles->started) {
+        int32_t elapsed = now - particles->lastTick;
+        if (elapsed > 0) { dt = elapsed; }
+        if (dt > MAX_STEP) { dt = MAX_STEP; }
+    }
+    particles->started = true;
+    particles->lastTick = now;
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    if (dt) { stepParticles(particles, dt); }
+
+    particles->owed += particles->emitter.rate * dt;
+    size_t count = particles->burst + particles->owed / 1000;
+    particles->owed %= 1000;
+    particles->burst = 0;
+
+    emitParticles(particles, count, pos);
+
+    buildDrawList(particles);
+    if (particles->drawCount == 0) { return; }
+
+    ParticlesRender *render = ffx_scene_createRender(node,
+      sizeof(ParticlesRender));
+    render->particles = particles;
+    render->sprite = NULL;
+    if (particles->sprite) {
+        render->sprite = ffx_sceneNode_acquireImage(node, particles->sprite);
+    }
+    render->size = getExtent(particles);
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Particles pos=%dx%d count=%d/%d rate=%ld sprite=%p>\n", pos.x,
+      pos.y, particles->count, particles->capacity,
+      (long)particles->emitter.rate, particles->sprite);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static void setRamp(ParticlesNode *particles) {
+    const FfxParticleEmitter *emitter = &particles->emitter;
+
+    for (int i = 0; i < RAMP_STEPS; i++) {
+        color_ffxt color = ffx_color_lerpfx(emitter->startColor,
+          emitter->endColor, (i << 16) / (RAMP_STEPS - 1));
+        particles->rampColor[i] = ffx_color_rgb16(color);
+        particles->rampOpacity[i] = ffx_color_getOpacity(color);
+    }
+}
+
+FfxNode ffx_scene_createParticles(FfxScene scene, size_t capacity) {
+    if (capacity == 0 || capacity > MAX_PARTICLES) {
+        printf("particles: invalid capacity\n");
+        return NULL;
+    }
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable,
+      sizeof(ParticlesNode));
+    if (node == NULL) { return NULL; }
+
+    // Each particle needs six simulation words and five bytes to draw
+    uint8_t *data = ffx_scene_memAlloc(scene, capacity *
+      (6 * sizeof(uint32_t) + 2 * sizeof(int16_t) + 1));
+    if (data == NULL) {
+        ffx_sceneNode_free(node);
+        return NULL;
+    }
+
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    particles->capacity = capacity;
+    particles->seed = 0x2545f491 ^ (uint32_t)(uintptr_t)node;
+
+    particles->x = (fixed_ffxt*)data;
+    particles->y = &particles->x[capacity];
+    particles->vx = &particles->y[capacity];
+    particles->vy = &particles->vx[capacity];
+    particles->phase = (uint32_t*)&particles->vy[capacity];
+    particles->phaseStep = &particles->phase[capacity];
+    particles->drawX = (int16_t*)&particles->phaseStep[capacity];
+    particles->drawY = &particles->drawX[capacity];
+    particles->drawRamp = (uint8_t*)&particles->drawY[capacity];
+
+    particles->emitter = (FfxParticleEmitter){
+        .life = 1000,
+        .startColor = COLOR_WHITE,
+        .endColor = ffx_color_setOpacity(COLOR_WHITE, 0),
+        .pointSize = 1
+    };
+    setRamp(particles);
+
+    return node;
+}
+
+bool ffx_scene_isParticles(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+void ffx_sceneParticles_getEmitter(FfxNode node,
+  FfxParticleEmitter *emitter) {
+
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return; }
+    *emitter = particles->emitter;
+}
+
+void ffx_sceneParticles_setEmitter(FfxNode node,
+  const FfxParticleEmitter *emitter) {
+
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return; }
+
+    particles->emitter = *emitter;
+
+    uint8_t pointSize = emitter->pointSize;
+    if (pointSize < 1) { pointSize = 1; }
+    if (pointSize > MAX_POINT_SIZE) { pointSize = MAX_POINT_SIZE; }
+    particles->emitter.pointSize = pointSize;
+
+    if (emitter->velocityJitter.x < 0) {
+        particles->emitter.velocityJitter.x = 0;
+    }
+    if (emitter->velocityJitter.y < 0) {
+        particles->emitter.velocityJitter.y = 0;
+    }
+
+    setRamp(particles);
+}
+
+const uint16_t* ffx_sceneParticles_getSprite(FfxNode node) {
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return NULL; }
+    return particles->sprite;
+}
+
+void ffx_sceneParticles_setSprite(FfxNode node, const uint16_t *data,
+  size_t length) {
+
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return; }
+
+    if (data == NULL) {
+        particles->sprite = NULL;
+        return;
+    }
+
+    FfxSize size = ffx_scene_getImageSize(data, length);
+    if (size.width == 0) { return; }
+
+    uint32_t format = data[0] & 0x0f;
+    if (format != IMAGE_RGB565 && format != IMAGE_RGB565_A4) {
+        printf("particles: unsupported sprite format\n");
+        return;
+    }
+
+    particles->sprite = data;
+}
+
+void ffx_sceneParticles_emit(FfxNode node, size_t count) {
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return; }
+
+    count += particles->burst;
+    if (count > particles->capacity) { count = particles->capacity; }
+    particles->burst = count;
+}
+
+size_t ffx_sceneParticles_getCount(FfxNode node) {
+    ParticlesNode *particles = ffx_sceneNode_getState(node, &vtable);
+    if (particles == NULL) { return 0; }
+    return particles->count;
+}
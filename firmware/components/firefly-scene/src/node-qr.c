@@ -1,3 +1,4 @@
+#include <assert.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -68,7 +69,7 @@ typedef struct QRRender {
 
     uint8_t quietZone, moduleSize;
 
-    color_ffxt fg, bg;
+    FfxColorRGB565 fg, bg;
 
     QRCode *qrCode;
 } QRRender;
@@ -110,7 +111,7 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     pos.x += worldPos.x;
     pos.y += worldPos.y;
 
-    if (pos.x >= 240 || pos.y >= 240) { return; }
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
 
     QRNode *qr = ffx_sceneNode_getState(node, &vtable);
 
@@ -123,14 +124,14 @@ static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
     render->position = pos;
     render->moduleSize = qr->moduleSize;
     render->quietZone = qr->quietZone;
-    render->fg = qr->fg;
-    render->bg = qr->bg;
+    render->fg = ffx_color_parseRGB565(qr->fg);
+    render->bg = ffx_color_parseRGB565(qr->bg);
     render->qrCode = &qr->qrCode;
 }
 
 // See: node-box.c
-void _ffx_renderBox(uint16_t *frameBuffer, int32_t ox, int32_t oy,
-  int32_t width, int32_t height, color_ffxt _color);
+void _ffx_renderBox(uint16_t *frameBuffer, int32_t stride, int32_t ox,
+  int32_t oy, int32_t width, int32_t height, const FfxColorRGB565 *color);
 
 static void renderFunc(void *_render, uint16_t *frameBuffer,
   FfxPoint origin, FfxSize size) {
@@ -146,8 +147,8 @@ static void renderFunc(void *_render, uint16_t *frameBuffer,
     if (clip.width == 0) { return; }
 
     // Color the background color
-    _ffx_renderBox(frameBuffer, clip.vpX, clip.vpY, clip.width, clip.height,
-      render->bg);
+    _ffx_renderBox(frameBuffer, size.width, clip.vpX, clip.vpY, clip.width,
+      clip.height, &render->bg);
 
     int32_t quiet = render->quietZone;
     FfxSize modSize = ffx_size(render->moduleSize, render->moduleSize);
@@ -166,8 +167,8 @@ static void renderFunc(void *_render, uint16_t *frameBuffer,
                   origin, size);
                 if (b.width == 0) { continue; }
 
-                _ffx_renderBox(frameBuffer, b.vpX, b.vpY, b.width, b.height,
-                  render->fg);
+                _ffx_renderBox(frameBuffer, size.width, b.vpX, b.vpY,
+                  b.width, b.height, &render->fg);
             }
         }
     }
@@ -294,6 +295,10 @@ FfxNode ffx_scene_createQRData(FfxScene scene, const uint8_t* data,
     return node;
 }
 
+bool ffx_scene_isQR(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
 
 ///////////////////////////////
 // Properties
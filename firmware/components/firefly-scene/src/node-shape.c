@@ -0,0 +1,745 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "firefly-scene-private.h"
+
+
+// Geometry is in sub-pixels of 1/16 pixel, and edge coverage is the
+// distance from a pixel center to the edge, in the range [0, 16]
+#define SUB_BITS           (4)
+#define SUB_1              (1 << SUB_BITS)
+#define SUB_1_2            (SUB_1 >> 1)
+
+// Keeps squared sub-pixel distances within 32 bits
+#define MAX_EXTENT         (2047)
+
+typedef enum ConvexType {
+    ConvexTypeNone = 0,
+    ConvexTypeCircle,
+    ConvexTypeRoundRect,
+    ConvexTypeCapsule
+} ConvexType;
+
+// A convex region, with all coordinates in sub-pixels relative to the
+// render bounds
+typedef struct Convex {
+    ConvexType type;
+
+    // Circle and RoundRect: the center; Capsule: the start
+    int32_t x, y;
+
+    // RoundRect: the half-extents of the rectangle less the radius
+    // Capsule: the vector from start to end
+    int32_t dx, dy;
+
+    int32_t radius;
+
+    // Capsule: the length of (dx, dy) and its reciprocal (ufixed:0.32)
+    int32_t length;
+    uint32_t inverseLength;
+} Convex;
+
+typedef struct ShapeNode {
+    FfxShapeType type;
+    FfxSize size;
+    FfxPoint end;
+    color_ffxt fillColor, strokeColor;
+    uint16_t strokeWidth, cornerRadius;
+    fixed_ffxt startAngle, endAngle;
+} ShapeNode;
+
+typedef struct ShapeRender {
+    FfxPoint position;
+    FfxSize size;
+
+    Convex fill;
+    FfxColorRGB565 fillColor;
+
+    // The stroke covers outer but not inner
+    Convex outer, inner;
+    FfxColorRGB565 strokeColor;
+
+    // Arc: the stroke is limited to the sector clockwise from the start
+    // direction to the end direction (unit vectors, fixed:1.14)
+    bool sector, wideSector;
+    int32_t startX, startY, endX, endY;
+} ShapeRender;
+
+// The pixels of a row covered by a convex region; [start, end) has any
+// coverage and [fullStart, fullEnd) is entirely covered
+typedef struct RowSpan {
+    int32_t start, fullStart, fullEnd, end;
+} RowSpan;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "ShapeNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+// See: node-box.c
+void _ffx_renderBox(uint16_t *frameBuffer, int32_t stride, int32_t ox,
+  int32_t oy, int32_t width, int32_t height, const FfxColorRGB565 *color);
+
+
+//////////////////////////
+// Geometry
+
+static int32_t length(int32_t x, int32_t y) {
+    return isqrt32((uint32_t)(x * x) + (uint32_t)(y * y));
+}
+
+static int32_t absi(int32_t value) {
+    return (value < 0) ? -value: value;
+}
+
+// Returns the signed distance from (%%px%%, %%py%%) to the edge of
+// %%shape%%, negative inside
+static int32_t getDistance(const Convex *shape, int32_t px, int32_t py) {
+    switch (shape->type) {
+        case ConvexTypeCircle:
+            return length(px - shape->x, py - shape->y) - shape->radius;
+
+        case ConvexTypeRoundRect: {
+            int32_t qx = absi(px - shape->x) - shape->dx;
+            int32_t qy = absi(py - shape->y) - shape->dy;
+            if (qx > 0 && qy > 0) {
+                return length(qx, qy) - shape->radius;
+            }
+            return ((qx > qy) ? qx: qy) - shape->radius;
+        }
+
+        case ConvexTypeCapsule: {
+            int32_t ax = px - shape->x, ay = py - shape->y;
+            int64_t dot = (int64_t)ax * shape->dx + (int64_t)ay * shape->dy;
+
+            if (dot <= 0) {
+                return length(ax, ay) - shape->radius;
+            }
+
+            int64_t length2 = (int64_t)shape->length * shape->length;
+            if (dot >= length2) {
+                return length(ax - shape->dx, ay - shape->dy) - shape->radius;
+            }
+
+            // The distance from the line is the cross product over the
+            // length of the line
+            int64_t cross = (int64_t)ax * shape->dy - (int64_t)ay * shape->dx;
+            if (cross < 0) { cross = -cross; }
+            return ((cross * shape->inverseLength) >> 32) - shape->radius;
+        }
+
+        case ConvexTypeNone:
+            break;
+    }
+
+    return SUB_1;
+}
+
+static int32_t getCoverage(int32_t distance) {
+    int32_t coverage = SUB_1_2 - distance;
+    if (coverage <= 0) { return 0; }
+    return (coverage >= SUB_1) ? SUB_1: coverage;
+}
+
+// Scans the pixels [x0, x1) of the row with centers at %%py%%. Moving one
+// pixel changes the distance by at most one pixel, so pixels far from
+// the edge can be stepped over.
+static void scanRow(const Convex *shape, int32_t py, int32_t x0, int32_t x1,
+  RowSpan *span) {
+
+    span->start = span->fullStart = span->fullEnd = span->end = x1;
+
+    if (shape->type == ConvexTypeNone) { return; }
+
+    int32_t x = x0, distance = 0;
+    while (x < x1) {
+        distance = getDistance(shape, (x << SUB_BITS) + SUB_1_2, py);
+        if (distance < SUB_1_2) { break; }
+        x += ((distance - SUB_1_2) >> SUB_BITS) + 1;
+    }
+    if (x >= x1) { return; }
+    span->start = x;
+
+    while (x < x1 && distance > -SUB_1_2) {
+        x++;
+        distance = getDistance(shape, (x << SUB_BITS) + SUB_1_2, py);
+    }
+
+    // Unless no pixel in the row is entirely covered, the last covered
+    // pixel is at or after the first entirely covered one
+    int32_t xMin = span->start;
+    if (x < x1) { xMin = span->fullStart = x; }
+
+    x = x1 - 1;
+    while (x >= xMin) {
+        distance = getDistance(shape, (x << SUB_BITS) + SUB_1_2, py);
+        if (distance < SUB_1_2) { break; }
+        x -= ((distance - SUB_1_2) >> SUB_BITS) + 1;
+    }
+    span->end = x + 1;
+
+    if (span->fullStart == x1) {
+        span->fullStart = span->fullEnd = span->end;
+        return;
+    }
+
+    while (distance > -SUB_1_2) {
+        x--;
+        distance = getDistance(shape, (x << SUB_BITS) + SUB_1_2, py);
+    }
+    span->fullEnd = x + 1;
+}
+
+
+//////////////////////////
+// Rasterizing
+
+// Spreads an RGB565 into 0x00000GGG GGG00000 RRRRR000 000BBBBB, which
+// leaves 5 bits of headroom above each component for a 5-bit weight
+static inline uint32_t spread(uint16_t c) {
+    return ((c | ((uint32_t)c << 16)) & 0x07e0f81f);
+}
+
+static inline uint16_t unspread(uint32_t c) {
+    c &= 0x07e0f81f;
+    return (c | (c >> 16)) & 0xffff;
+}
+
+// Returns the coverage of the arc sector at (%%px%%, %%py%%) relative to
+// the center
+static int32_t getSectorCoverage(const ShapeRender *render, int32_t px,
+  int32_t py) {
+
+    // Positive on the clockwise side of the start and on the
+    // counter-clockwise side of the end
+    int32_t s0 = (render->startX * py - render->startY * px) >> 14;
+    int32_t s1 = (render->endY * px - render->endX * py) >> 14;
+
+    int32_t inside;
+    if (render->wideSector) {
+        inside = (s0 > s1) ? s0: s1;
+    } else {
+        inside = (s0 < s1) ? s0: s1;
+    }
+
+    return getCoverage(-inside);
+}
+
+// Draws the pixels [x0, x1) of one row covered by %%outer%% less
+// %%inner%%, where (%%ox%%, %%oy%%) is the fragment offset of x = 0.
+static void renderRow(const ShapeRender *render, uint16_t *frameBuffer,
+  int32_t stride, int32_t ox, int32_t oy, int32_t py, int32_t x0,
+  int32_t x1,
+  const Convex *outer, const Convex *inner, bool sector,
+  const FfxColorRGB565 *color) {
+
+    RowSpan o, i;
+    scanRow(outer, py, x0, x1, &o);
+    if (o.start >= o.end) { return; }
+
+    if (inner) {
+        scanRow(inner, py, o.start, o.end, &i);
+    } else {
+        i.start = i.fullStart = i.fullEnd = i.end = o.end;
+    }
+
+    uint16_t *output = &frameBuffer[stride * oy + ox];
+
+    uint32_t fg = spread(color->rgb16);
+    int32_t opacity = color->opacity;
+
+    // The sector is relative to the circle center
+    int32_t cx = render->outer.x, cy = render->outer.y;
+
+    int32_t x = o.start;
+    while (x < o.end) {
+
+        // Entirely inside the hole
+        if (x >= i.fullStart && x < i.fullEnd) {
+            x = i.fullEnd;
+            continue;
+        }
+
+        // Entirely covered; draw the run using the box blending
+        if (!sector && x >= o.fullStart && x < o.fullEnd &&
+          (x < i.start || x >= i.end)) {
+
+            int32_t end = o.fullEnd;
+            if (i.start > x && i.start < end) { end = i.start; }
+
+            _ffx_renderBox(frameBuffer, stride, ox + x, oy, end - x, 1,
+              color);
+            x = end;
+            continue;
+        }
+
+        int32_t px = (x << SUB_BITS) + SUB_1_2;
+
+        int32_t coverage = SUB_1;
+        if (x < o.fullStart || x >= o.fullEnd) {
+            coverage = getCoverage(getDistance(outer, px, py));
+        }
+
+        if (x >= i.start && x < i.end) {
+            int32_t hole = getCoverage(getDistance(inner, px, py));
+            coverage = (coverage * (SUB_1 - hole)) >> SUB_BITS;
+        }
+
+        if (sector && coverage) {
+            int32_t c = getSectorCoverage(render, px - cx, py - cy);
+            coverage = (coverage * c) >> SUB_BITS;
+        }
+
+        // A 5-bit weight; [0, 32]
+        int32_t w = (coverage * opacity) >> SUB_BITS;
+
+        if (w == 32) {
+            output[x] = color->rgb16;
+        } else if (w) {
+            uint32_t bg = spread(output[x]);
+            output[x] = unspread((fg * w + bg * (32 - w)) >> 5);
+        }
+
+        x++;
+    }
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    ShapeRender *render = _render;
+
+    FfxClip clip = ffx_scene_clip(render->position, render->size, origin,
+      size);
+    if (clip.width == 0) { return; }
+
+    // The fragment offset of the pixel at x = 0 in render coordinates
+    int32_t ox = clip.vpX - clip.x;
+    int32_t x0 = clip.x, x1 = clip.x + clip.width;
+
+    bool fill = (render->fill.type != ConvexTypeNone);
+    bool stroke = (render->outer.type != ConvexTypeNone);
+    const Convex *inner = NULL;
+    if (render->inner.type != ConvexTypeNone) { inner = &render->inner; }
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        int32_t py = ((clip.y + y) << SUB_BITS) + SUB_1_2;
+        int32_t oy = clip.vpY + y;
+
+        if (fill) {
+            renderRow(render, frameBuffer, size.width, ox, oy, py, x0, x1,
+              &render->fill, NULL, false, &render->fillColor);
+        }
+
+        if (stroke) {
+            renderRow(render, frameBuffer, size.width, ox, oy, py, x0, x1,
+              &render->outer, inner, render->sector, &render->strokeColor);
+        }
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+}
+
+static void setCircle(Convex *shape, int32_t x, int32_t y, int32_t radius) {
+    if (radius <= 0) { return; }
+    shape->type = ConvexTypeCircle;
+    shape->x = x;
+    shape->y = y;
+    shape->radius = radius;
+}
+
+// Sets a rounded rectangle with half-extents %%hx%% and %%hy%%
+static void setRoundRect(Convex *shape, int32_t x, int32_t y, int32_t hx,
+  int32_t hy, int32_t radius) {
+
+    if (hx <= 0 || hy <= 0) { return; }
+
+    if (radius > hx) { radius = hx; }
+    if (radius > hy) { radius = hy; }
+    if (radius < 0) { radius = 0; }
+
+    shape->type = ConvexTypeRoundRect;
+    shape->x = x;
+    shape->y = y;
+    shape->dx = hx - radius;
+    shape->dy = hy - radius;
+    shape->radius = radius;
+}
+
+static void setCapsule(Convex *shape, int32_t x, int32_t y, int32_t dx,
+  int32_t dy, int32_t radius) {
+
+    if (radius <= 0) { return; }
+
+    shape->type = ConvexTypeCapsule;
+    shape->x = x;
+    shape->y = y;
+    shape->dx = dx;
+    shape->dy = dy;
+    shape->radius = radius;
+    shape->length = length(dx, dy);
+    shape->inverseLength = 0;
+    if (shape->length) {
+        shape->inverseLength = 0xffffffff / (uint32_t)shape->length;
+    }
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    bool fill = !ffx_color_isTransparent(shape->fillColor);
+    bool stroke = (shape->strokeWidth &&
+      !ffx_color_isTransparent(shape->strokeColor));
+
+    // Lines and arcs have no fill
+    if (shape->type == FfxShapeTypeLine || shape->type == FfxShapeTypeArc) {
+        fill = false;
+    }
+
+    if (!fill && !stroke) { return; }
+
+    // The bounds, relative to the node position
+    int32_t left = 0, top = 0;
+    int32_t width = shape->size.width, height = shape->size.height;
+
+    if (shape->type == FfxShapeTypeLine) {
+        // The line extends by half the stroke width around each end
+        int32_t r = (shape->strokeWidth + 1) / 2 + 1;
+        int32_t ex = shape->end.x, ey = shape->end.y;
+        left = ((ex < 0) ? ex: 0) - r;
+        top = ((ey < 0) ? ey: 0) - r;
+        width = absi(ex) + 2 * r;
+        height = absi(ey) + 2 * r;
+    }
+
+    if (width == 0 || height == 0) { return; }
+    if (width > MAX_EXTENT || height > MAX_EXTENT) { return; }
+
+    pos.x += left;
+    pos.y += top;
+
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
+    if (pos.x + width < 0 || pos.y + height < 0) { return; }
+
+    ShapeRender *render = ffx_scene_createRender(node, sizeof(ShapeRender));
+    render->position = pos;
+    render->size = ffx_size(width, height);
+
+    render->fill.type = ConvexTypeNone;
+    render->outer.type = ConvexTypeNone;
+    render->inner.type = ConvexTypeNone;
+    render->sector = false;
+
+    render->fillColor = ffx_color_parseRGB565(shape->fillColor);
+    render->strokeColor = ffx_color_parseRGB565(shape->strokeColor);
+
+    // The stroke is inside the bounds, so strokes never change the size
+    int32_t strokeWidth = stroke ? (shape->strokeWidth << SUB_BITS): 0;
+
+    // The half-extents and center, in sub-pixels
+    int32_t hx = width << (SUB_BITS - 1), hy = height << (SUB_BITS - 1);
+
+    switch (shape->type) {
+        case FfxShapeTypeLine:
+            setCapsule(&render->outer, -left * SUB_1, -top * SUB_1,
+              shape->end.x * SUB_1, shape->end.y * SUB_1,
+              strokeWidth / 2);
+            break;
+
+        case FfxShapeTypeCircle:
+        case FfxShapeTypeArc: {
+            int32_t radius = (hx < hy) ? hx: hy;
+            if (stroke) {
+                setCircle(&render->outer, hx, hy, radius);
+                setCircle(&render->inner, hx, hy, radius - strokeWidth);
+            }
+            if (fill) {
+                setCircle(&render->fill, hx, hy, radius - strokeWidth);
+            }
+            break;
+        }
+
+        case FfxShapeTypeRoundRect: {
+            int32_t radius = shape->cornerRadius << SUB_BITS;
+
+            // The inner edge of the stroke follows the corners inward
+            Convex inside = { .type = ConvexTypeNone };
+            setRoundRect(&inside, hx, hy, hx - strokeWidth, hy - strokeWidth,
+              radius - strokeWidth);
+
+            if (stroke) {
+                setRoundRect(&render->outer, hx, hy, hx, hy, radius);
+                render->inner = inside;
+            }
+            if (fill) { render->fill = inside; }
+            break;
+        }
+    }
+
+    if (shape->type == FfxShapeTypeArc) {
+        fixed_ffxt start = shape->startAngle, end = shape->endAngle;
+        if (end < start) {
+            fixed_ffxt swap = start;
+            start = end;
+            end = swap;
+        }
+
+        fixed_ffxt sweep = end - start;
+        if (sweep == 0) {
+            render->outer.type = ConvexTypeNone;
+        } else if (sweep < FM_2PI) {
+            // Angles are clockwise from up, with y down
+            render->sector = true;
+            render->wideSector = (sweep > FM_PI);
+            render->startX = sinfx(start) >> 2;
+            render->startY = -cosfx(start) >> 2;
+            render->endX = sinfx(end) >> 2;
+            render->endY = -cosfx(end) >> 2;
+        }
+    }
+}
+
+static const char* getTypeName(FfxShapeType type) {
+    switch (type) {
+        case FfxShapeTypeLine: return "line";
+        case FfxShapeTypeCircle: return "circle";
+        case FfxShapeTypeArc: return "arc";
+        case FfxShapeTypeRoundRect: return "roundrect";
+    }
+    return "unknown";
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+
+    char fillName[COLOR_STRING_LENGTH] = { 0 };
+    char strokeName[COLOR_STRING_LENGTH] = { 0 };
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Shape type=%s pos=%dx%d size=%dx%d fill=%s stroke=%s width=%d",
+      getTypeName(shape->type), pos.x, pos.y, shape->size.width,
+      shape->size.height, ffx_color_sprintf(shape->fillColor, fillName),
+      ffx_color_sprintf(shape->strokeColor, strokeName), shape->strokeWidth);
+
+    if (shape->type == FfxShapeTypeLine) {
+        printf(" end=%dx%d", shape->end.x, shape->end.y);
+    } else if (shape->type == FfxShapeTypeRoundRect) {
+        printf(" radius=%d", shape->cornerRadius);
+    } else if (shape->type == FfxShapeTypeArc) {
+        char startName[FIXED_STRING_LENGTH] = { 0 };
+        char endName[FIXED_STRING_LENGTH] = { 0 };
+        printf(" angles=%s:%s", ffx_sprintfx(shape->startAngle, startName),
+          ffx_sprintfx(shape->endAngle, endName));
+    }
+
+    printf(">\n");
+}
+
+
+//////////////////////////
+// Life-cycle
+
+FfxNode ffx_scene_createShape(FfxScene scene, FfxShapeType type,
+  FfxSize size) {
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(ShapeNode));
+    if (node == NULL) { return NULL; }
+
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    shape->type = type;
+    shape->size = size;
+    shape->end = ffx_point(size.width, size.height);
+    shape->fillColor = COLOR_BLACK;
+    shape->strokeColor = COLOR_BLACK;
+    shape->endAngle = FM_2PI;
+
+    // Lines and arcs are only drawn by their stroke
+    if (type == FfxShapeTypeLine || type == FfxShapeTypeArc) {
+        shape->strokeWidth = 1;
+    }
+
+    return node;
+}
+
+bool ffx_scene_isShape(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+FfxShapeType ffx_sceneShape_getType(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return FfxShapeTypeLine; }
+    return shape->type;
+}
+
+FfxSize ffx_sceneShape_getSize(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return ffx_size(0, 0); }
+    return shape->size;
+}
+
+static void setSize(FfxNode node, FfxSize size) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->size = size;
+}
+
+void ffx_sceneShape_setSize(FfxNode node, FfxSize size) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createSizeAction(node, shape->size, size, setSize);
+}
+
+FfxPoint ffx_sceneShape_getEnd(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return ffx_point(0, 0); }
+    return shape->end;
+}
+
+static void setEnd(FfxNode node, FfxPoint end) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->end = end;
+}
+
+void ffx_sceneShape_setEnd(FfxNode node, FfxPoint end) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createPointAction(node, shape->end, end, setEnd);
+}
+
+color_ffxt ffx_sceneShape_getFillColor(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->fillColor;
+}
+
+static void setFillColor(FfxNode node, color_ffxt color) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->fillColor = color;
+}
+
+void ffx_sceneShape_setFillColor(FfxNode node, color_ffxt color) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createColorAction(node, shape->fillColor, color,
+      setFillColor);
+}
+
+color_ffxt ffx_sceneShape_getStrokeColor(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->strokeColor;
+}
+
+static void setStrokeColor(FfxNode node, color_ffxt color) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->strokeColor = color;
+}
+
+void ffx_sceneShape_setStrokeColor(FfxNode node, color_ffxt color) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createColorAction(node, shape->strokeColor, color,
+      setStrokeColor);
+}
+
+uint16_t ffx_sceneShape_getStrokeWidth(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->strokeWidth;
+}
+
+void ffx_sceneShape_setStrokeWidth(FfxNode node, uint16_t width) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->strokeWidth = width;
+}
+
+uint16_t ffx_sceneShape_getCornerRadius(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->cornerRadius;
+}
+
+void ffx_sceneShape_setCornerRadius(FfxNode node, uint16_t radius) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->cornerRadius = radius;
+}
+
+fixed_ffxt ffx_sceneShape_getStartAngle(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->startAngle;
+}
+
+static void setStartAngle(FfxNode node, fixed_ffxt angle) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->startAngle = angle;
+}
+
+void ffx_sceneShape_setStartAngle(FfxNode node, fixed_ffxt angle) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createFixedAction(node, shape->startAngle, angle,
+      setStartAngle);
+}
+
+fixed_ffxt ffx_sceneShape_getEndAngle(FfxNode node) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return 0; }
+    return shape->endAngle;
+}
+
+static void setEndAngle(FfxNode node, fixed_ffxt angle) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    shape->endAngle = angle;
+}
+
+void ffx_sceneShape_setEndAngle(FfxNode node, fixed_ffxt angle) {
+    ShapeNode *shape = ffx_sceneNode_getState(node, &vtable);
+    if (shape == NULL) { return; }
+    ffx_sceneNode_createFixedAction(node, shape->endAngle, angle,
+      setEndAngle);
+}
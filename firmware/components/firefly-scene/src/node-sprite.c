@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <stddef.h>
+
+#include "firefly-scene-private.h"
+#include "firefly-fixed.h"
+
+
+// Scales outside this range are not rendered; smaller would overflow
+// the inverse steps and larger the bounding box
+#define MIN_SCALE          (FM_1_16)
+#define MAX_SCALE          (64 * FM_1)
+
+// fixed:15.16 for 0.5
+#define FIXED_HALF         (0x8000)
+
+#define UFIXED_1_16_ONE    (0x10000)
+
+typedef struct SpriteNode {
+    const uint16_t *data;
+    fixed_ffxt scale;
+    fixed_ffxt angle;
+    FfxSpriteSampling sampling;
+} SpriteNode;
+
+typedef struct SpriteRender {
+    // The bounding box of the transformed image
+    FfxPoint position;
+    FfxSize size;
+
+    const uint16_t *data;
+    FfxSpriteSampling sampling;
+
+    // The image coordinate of the center of the top-left pixel of the
+    // bounding box, and the change per pixel in x and y (fixed:15.16)
+    fixed_ffxt u, v;
+    fixed_ffxt dudx, dvdx;
+    fixed_ffxt dudy, dvdy;
+} SpriteRender;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "SpriteNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+
+//////////////////////////
+// Sprite Rasterizing
+
+// Each renderer walks the clipped bounding box, stepping the image
+// coordinate incrementally; pixels which map outside the image are
+// skipped, which is a single unsigned compare per axis.
+
+static void _renderRGB565(SpriteRender *render, uint16_t *frameBuffer,
+  int32_t stride, FfxClip clip) {
+
+    const uint16_t *data = render->data;
+    int32_t width = data[1];
+    uint32_t maxU = (uint32_t)data[1] << 16, maxV = (uint32_t)data[2] << 16;
+
+    // Skip the header bytes
+    data += 3;
+
+    fixed_ffxt rowU = render->u + clip.x * render->dudx + clip.y * render->dudy;
+    fixed_ffxt rowV = render->v + clip.x * render->dvdx + clip.y * render->dvdy;
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+        fixed_ffxt u = rowU, v = rowV;
+        for (int32_t x = clip.width; x; x--) {
+            if ((uint32_t)u < maxU && (uint32_t)v < maxV) {
+                *output = data[(v >> 16) * width + (u >> 16)];
+            }
+            output++;
+            u += render->dudx;
+            v += render->dvdx;
+        }
+        rowU += render->dudy;
+        rowV += render->dvdy;
+    }
+}
+
+// Spreads an RGB565 into 0x00000GGG GGG00000 RRRRR000 000BBBBB, which
+// leaves 5 bits of headroom above each component for a 5-bit weight
+static inline uint32_t spread(uint16_t c) {
+    return ((c | ((uint32_t)c << 16)) & 0x07e0f81f);
+}
+
+static inline uint16_t unspread(uint32_t c) {
+    c &= 0x07e0f81f;
+    return (c | (c >> 16)) & 0xffff;
+}
+
+static void _renderRGB565Bilinear(SpriteRender *render, uint16_t *frameBuffer,
+  int32_t stride, FfxClip clip) {
+
+    const uint16_t *data = render->data;
+    int32_t width = data[1], height = data[2];
+    uint32_t maxU = (uint32_t)width << 16, maxV = (uint32_t)height << 16;
+
+    // Skip the header bytes
+    data += 3;
+
+    fixed_ffxt rowU = render->u + clip.x * render->dudx + clip.y * render->dudy;
+    fixed_ffxt rowV = render->v + clip.x * render->dvdx + clip.y * render->dvdy;
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+        fixed_ffxt u = rowU, v = rowV;
+        for (int32_t x = clip.width; x; x--) {
+            if ((uint32_t)u < maxU && (uint32_t)v < maxV) {
+
+                // Sample relative to the pixel centers
+                fixed_ffxt su = u - FIXED_HALF, sv = v - FIXED_HALF;
+
+                int32_t x0 = su >> 16, y0 = sv >> 16;
+                int32_t x1 = x0 + 1, y1 = y0 + 1;
+
+                // 5-bit weights of the right and bottom pixels
+                uint32_t fx = (su >> 11) & 0x1f;
+                uint32_t fy = (sv >> 11) & 0x1f;
+
+                // Clamp to the edges
+                if (x0 < 0) { x0 = 0; }
+                if (y0 < 0) { y0 = 0; }
+                if (x1 >= width) { x1 = width - 1; }
+                if (y1 >= height) { y1 = height - 1; }
+
+                const uint16_t *r0 = &data[y0 * width];
+                const uint16_t *r1 = &data[y1 * width];
+
+                uint32_t top = (spread(r0[x0]) * (32 - fx) +
+                  spread(r0[x1]) * fx) >> 5;
+                uint32_t bottom = (spread(r1[x0]) * (32 - fx) +
+                  spread(r1[x1]) * fx) >> 5;
+
+                top &= 0x07e0f81f;
+                bottom &= 0x07e0f81f;
+
+                *output = unspread((top * (32 - fy) + bottom * fy) >> 5);
+            }
+            output++;
+            u += render->dudx;
+            v += render->dvdx;
+        }
+        rowU += render->dudy;
+        rowV += render->dvdy;
+    }
+}
+
+static void _renderRGB565_A4(SpriteRender *render, uint16_t *frameBuffer,
+  int32_t stride, FfxClip clip) {
+
+    const uint16_t *data = render->data;
+    int32_t width = data[1];
+    uint32_t maxU = (uint32_t)data[1] << 16, maxV = (uint32_t)data[2] << 16;
+
+    // Point to the alpha data
+    const uint16_t *alpha = &data[3];
+    uint16_t alphaCount = alpha[0];
+    alpha++;
+
+    // Point to the bitmap data (advance past the alpha data)
+    data += alphaCount + 3 + 1;
+
+    fixed_ffxt rowU = render->u + clip.x * render->dudx + clip.y * render->dudy;
+    fixed_ffxt rowV = render->v + clip.x * render->dvdx + clip.y * render->dvdy;
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+        fixed_ffxt u = rowU, v = rowV;
+        for (int32_t x = clip.width; x; x--) {
+            if ((uint32_t)u < maxU && (uint32_t)v < maxV) {
+                uint32_t i = (v >> 16) * width + (u >> 16);
+
+                uint32_t a = (alpha[i / 4] >> (12 - 4 * (i % 4))) & 0x0f;
+                uint16_t fg = data[i];
+
+                if (a == 0x0f) {
+                    // Fully opaque
+                    *output = fg;
+
+                } else if (a) {
+                    // Partially translucent (ufixed:1.16)
+                    uint32_t fga = FIXED_BITS_4(a);
+                    uint32_t fga_1 = UFIXED_1_16_ONE - fga;
+
+                    uint16_t bg = *output;
+
+                    // Blend the values and convert from fixed-point
+                    int blendR = ((fga * (fg >> 11)) +
+                      (fga_1 * (bg >> 11))) >> 16;
+                    int blendG = ((fga * ((fg >> 5) & 0x3f)) +
+                      (fga_1 * ((bg >> 5) & 0x3f))) >> 16;
+                    int blendB = ((fga * (fg & 0x1f)) +
+                      (fga_1 * (bg & 0x1f))) >> 16;
+
+                    *output = (blendR << 11) | (blendG << 5) | blendB;
+                }
+            }
+            output++;
+            u += render->dudx;
+            v += render->dvdx;
+        }
+        rowU += render->dudy;
+        rowV += render->dvdy;
+    }
+}
+
+static void _renderPal8(SpriteRender *render, uint16_t *frameBuffer,
+  int32_t stride, FfxClip clip) {
+
+    const uint16_t *data = render->data;
+    int32_t width = data[1];
+    uint32_t maxU = (uint32_t)data[1] << 16, maxV = (uint32_t)data[2] << 16;
+
+    // Each word holds two palette indices, the first in the high byte
+    const uint16_t *palette = &data[3];
+    const uint16_t *pixels = &data[3 + 256];
+
+    fixed_ffxt rowU = render->u + clip.x * render->dudx + clip.y * render->dudy;
+    fixed_ffxt rowV = render->v + clip.x * render->dvdx + clip.y * render->dvdy;
+
+    for (int32_t y = 0; y < clip.height; y++) {
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+        fixed_ffxt u = rowU, v = rowV;
+        for (int32_t x = clip.width; x; x--) {
+            if ((uint32_t)u < maxU && (uint32_t)v < maxV) {
+                uint32_t i = (v >> 16) * width + (u >> 16);
+                *output = palette[(pixels[i / 2] >> ((i & 1) ? 0: 8)) & 0xff];
+            }
+            output++;
+            u += render->dudx;
+            v += render->dvdx;
+        }
+        rowU += render->dudy;
+        rowV += render->dvdy;
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+}
+
+static fixed_ffxt absfx(fixed_ffxt value) {
+    return (value < 0) ? -value: value;
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+
+    fixed_ffxt scale = sprite->scale;
+    if (scale < MIN_SCALE || scale > MAX_SCALE) { return; }
+
+    // The center of the image is placed at the node position
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    int32_t width = sprite->data[1], height = sprite->data[2];
+
+    fixed_ffxt s = sinfx(sprite->angle), c = cosfx(sprite->angle);
+
+    // Half the extents of the rotated and scaled image, rounded up
+    int32_t ex = (mulfx(absfx(c) * width + absfx(s) * height, scale) >> 17) + 1;
+    int32_t ey = (mulfx(absfx(s) * width + absfx(c) * height, scale) >> 17) + 1;
+
+    if (pos.x - ex >= FFX_SCENE_WIDTH || pos.y - ey >= FFX_SCENE_HEIGHT) {
+        return;
+    }
+    if (pos.x + ex < 0 || pos.y + ey < 0) { return; }
+
+    SpriteRender *render = ffx_scene_createRender(node, sizeof(SpriteRender));
+
+    render->position = ffx_point(pos.x - ex, pos.y - ey);
+    render->size = ffx_size(2 * ex, 2 * ey);
+    render->data = ffx_sceneNode_acquireImage(node, sprite->data);
+    render->sampling = sprite->sampling;
+
+    // The inverse transform, mapping the screen onto the image
+    render->dudx = divfx(c, scale);
+    render->dvdx = divfx(-s, scale);
+    render->dudy = divfx(s, scale);
+    render->dvdy = divfx(c, scale);
+
+    // The offset from the center to the first pixel center
+    fixed_ffxt dx = FIXED_HALF - tofx(ex), dy = FIXED_HALF - tofx(ey);
+
+    render->u = (width << 15) + mulfx(dx, render->dudx) +
+      mulfx(dy, render->dudy);
+    render->v = (height << 15) + mulfx(dx, render->dvdx) +
+      mulfx(dy, render->dvdy);
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    SpriteRender *render = _render;
+
+    FfxClip clip = ffx_scene_clip(render->position, render->size, origin,
+      size);
+    if (clip.width == 0) { return; }
+
+    if ((render->data[0] & 0x0f) == 0x05) {
+        _renderRGB565_A4(render, frameBuffer, size.width, clip);
+    } else if ((render->data[0] & 0x0f) == 0x04) {
+        if (render->sampling == FfxSpriteSamplingBilinear) {
+            _renderRGB565Bilinear(render, frameBuffer, size.width, clip);
+        } else {
+            _renderRGB565(render, frameBuffer, size.width, clip);
+        }
+    } else if ((render->data[0] & 0xff) == 0x38) {
+        _renderPal8(render, frameBuffer, size.width, clip);
+    }
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+
+    char scale[FIXED_STRING_LENGTH], angle[FIXED_STRING_LENGTH];
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<Sprite pos=%dx%d scale=%s angle=%s image=%p>\n", pos.x, pos.y,
+      ffx_sprintfx(sprite->scale, scale), ffx_sprintfx(sprite->angle, angle),
+      sprite->data);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+FfxNode ffx_scene_createSprite(FfxScene scene, const uint16_t *data,
+  size_t dataLength) {
+
+    FfxSize size = ffx_scene_getImageSize(data, dataLength);
+    if (size.width == 0 || size.height == 0) { return NULL; }
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(SpriteNode));
+    if (node == NULL) { return NULL; }
+
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    sprite->data = data;
+    sprite->scale = FM_1;
+
+    return node;
+}
+
+bool ffx_scene_isSprite(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+
+//////////////////////////
+// Properties
+
+const uint16_t* ffx_sceneSprite_getData(FfxNode node) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return NULL; }
+    return sprite->data;
+}
+
+void ffx_sceneSprite_setData(FfxNode node, const uint16_t *data,
+  size_t length) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+
+    FfxSize size = ffx_scene_getImageSize(data, length);
+    if (size.width) {
+        sprite->data = data;
+    }
+}
+
+fixed_ffxt ffx_sceneSprite_getScale(FfxNode node) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return 0; }
+    return sprite->scale;
+}
+
+static void setScale(FfxNode node, fixed_ffxt scale) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+    sprite->scale = scale;
+}
+
+void ffx_sceneSprite_setScale(FfxNode node, fixed_ffxt scale) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+    ffx_sceneNode_createFixedAction(node, sprite->scale, scale, setScale);
+}
+
+fixed_ffxt ffx_sceneSprite_getAngle(FfxNode node) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return 0; }
+    return sprite->angle;
+}
+
+static void setAngle(FfxNode node, fixed_ffxt angle) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+    sprite->angle = angle;
+}
+
+void ffx_sceneSprite_setAngle(FfxNode node, fixed_ffxt angle) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+    ffx_sceneNode_createFixedAction(node, sprite->angle, angle, setAngle);
+}
+
+FfxSpriteSampling ffx_sceneSprite_getSampling(FfxNode node) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return FfxSpriteSamplingNearest; }
+    return sprite->sampling;
+}
+
+void ffx_sceneSprite_setSampling(FfxNode node, FfxSpriteSampling sampling) {
+    SpriteNode *sprite = ffx_sceneNode_getState(node, &vtable);
+    if (sprite == NULL) { return; }
+    sprite->sampling = sampling;
+}
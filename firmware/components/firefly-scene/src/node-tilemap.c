@@ -0,0 +1,382 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "firefly-scene-private.h"
+
+
+// Tile map format (uint16_t words; see: tools/src.ts/tilemap.ts):
+//   - Header: (version << 8) | format, tile format (0x04 for RGB565 or
+//     0x38 for 8-bit palette), tile size (8 or 16), tile count, columns
+//     and rows
+//   - Palette: 256 RGB565 colors (8-bit palette tiles only)
+//   - Tiles: each tile's pixels, row-major; 8-bit palette tiles hold
+//     two indices per word, the first in the high byte
+//   - Map: columns * rows tile indices, row-major
+
+#define FORMAT_TILEMAP     (0x014d)
+
+#define TILE_RGB565        (0x04)
+#define TILE_PALETTE8      (0x38)
+
+#define HEADER_SIZE        (6)
+#define PALETTE_SIZE       (256)
+
+// The most tile spans across a band of 240 pixels (31 tiles of 8
+// pixels, when the band begins and ends part way through a tile); wider
+// fragments are drawn a band at a time
+#define BAND_WIDTH         (240)
+#define MAX_SPANS          (32)
+
+typedef struct TileMapNode {
+    const uint16_t *data;
+    FfxSize size;
+    FfxPoint scroll;
+    bool wrap;
+} TileMapNode;
+
+typedef struct TileMapRender {
+    FfxPoint position;
+    FfxSize size;
+    FfxPoint scroll;
+    const uint16_t *data;
+    bool wrap;
+} TileMapRender;
+
+// A run of pixels within a single tile column
+typedef struct Span {
+    // The screen x offset within the clipped row
+    uint8_t x;
+
+    // The first pixel column within the tile, and the count
+    uint8_t tx, count;
+
+    // The tile index
+    uint16_t tile;
+} Span;
+
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg);
+static void destroyFunc(FfxNode node);
+static void sequenceFunc(FfxNode node, FfxPoint worldPos);
+static void renderFunc(void *_render, uint16_t *_frameBuffer,
+  FfxPoint origin, FfxSize size);
+static void dumpFunc(FfxNode node, int indent);
+
+static const char name[] = "TileMapNode";
+static const FfxNodeVTable vtable = {
+    .walkFunc = walkFunc,
+    .destroyFunc = destroyFunc,
+    .sequenceFunc = sequenceFunc,
+    .renderFunc = renderFunc,
+    .dumpFunc = dumpFunc,
+    .name = name
+};
+
+
+static size_t getTileWords(const uint16_t *data) {
+    size_t pixels = data[2] * data[2];
+    return (data[1] == TILE_PALETTE8) ? (pixels / 2): pixels;
+}
+
+static const uint16_t* getTiles(const uint16_t *data) {
+    size_t offset = HEADER_SIZE;
+    if (data[1] == TILE_PALETTE8) { offset += PALETTE_SIZE; }
+    return &data[offset];
+}
+
+static const uint16_t* getMap(const uint16_t *data) {
+    return &getTiles(data)[data[3] * getTileWords(data)];
+}
+
+// Returns %%value%% modulo %%m%%, in the range [0, m)
+static int32_t wrapValue(int32_t value, int32_t m) {
+    value %= m;
+    return (value < 0) ? (value + m): value;
+}
+
+
+//////////////////////////
+// Rasterizing
+
+// Computes the spans for the clipped row of map row %%row%%, starting at
+// map x coordinate %%mx%%. Returns the number of spans.
+static size_t resolveSpans(TileMapRender *render, int32_t row, int32_t mx,
+  int32_t width, Span *spans) {
+
+    const uint16_t *data = render->data;
+    const uint16_t *map = getMap(data);
+
+    int32_t tileSize = data[2], columns = data[4];
+    int32_t mapWidth = tileSize * columns;
+
+    size_t count = 0;
+
+    int32_t x = 0;
+    while (x < width && count < MAX_SPANS) {
+        if (render->wrap) {
+            mx = wrapValue(mx, mapWidth);
+        } else if (mx < 0) {
+            // Skip ahead to the left edge of the map
+            x -= mx;
+            mx = 0;
+            continue;
+        } else if (mx >= mapWidth) {
+            break;
+        }
+
+        int32_t tx = mx % tileSize;
+        int32_t run = tileSize - tx;
+        if (x + run > width) { run = width - x; }
+
+        spans[count++] = (Span){
+            .x = x, .tx = tx, .count = run,
+            .tile = map[row * columns + mx / tileSize]
+        };
+
+        x += run;
+        mx += run;
+    }
+
+    return count;
+}
+
+static void renderBand(TileMapRender *render, uint16_t *frameBuffer,
+  int32_t stride, FfxClip clip) {
+
+    const uint16_t *data = render->data;
+
+    int32_t tileSize = data[2], rows = data[5];
+    int32_t mapHeight = tileSize * rows;
+
+    bool palette8 = (data[1] == TILE_PALETTE8);
+    const uint16_t *palette = &data[HEADER_SIZE];
+    const uint16_t *tiles = getTiles(data);
+    size_t tileWords = getTileWords(data);
+
+    // The map coordinate of the top-left clipped pixel
+    int32_t mx = clip.x + render->scroll.x;
+    int32_t my = clip.y + render->scroll.y;
+
+    Span spans[MAX_SPANS];
+    size_t spanCount = 0;
+    int32_t spanRow = -1;
+
+    for (int32_t y = 0; y < clip.height; y++, my++) {
+        int32_t py = my;
+        if (render->wrap) {
+            py = wrapValue(py, mapHeight);
+        } else if (py < 0 || py >= mapHeight) {
+            continue;
+        }
+
+        // Only resolve the tile columns when entering a new tile row
+        int32_t row = py / tileSize;
+        if (row != spanRow) {
+            spanCount = resolveSpans(render, row, mx, clip.width, spans);
+            spanRow = row;
+        }
+
+        int32_t ty = py % tileSize;
+
+        uint16_t *output = &frameBuffer[(stride * (clip.vpY + y)) + clip.vpX];
+
+        for (int i = 0; i < spanCount; i++) {
+            const Span *span = &spans[i];
+            const uint16_t *tile = &tiles[span->tile * tileWords];
+
+            if (palette8) {
+                // Each word holds two indices, the first in the high byte
+                uint32_t p = ty * tileSize + span->tx;
+                uint16_t *o = &output[span->x];
+                for (int32_t x = span->count; x; x--, p++) {
+                    *o++ = palette[(tile[p / 2] >> ((p & 1) ? 0: 8)) & 0xff];
+                }
+            } else {
+                memcpy(&output[span->x], &tile[ty * tileSize + span->tx],
+                  span->count * sizeof(uint16_t));
+            }
+        }
+    }
+}
+
+static void renderFunc(void *_render, uint16_t *frameBuffer,
+  FfxPoint origin, FfxSize size) {
+
+    TileMapRender *render = _render;
+
+    FfxClip clip = ffx_scene_clip(render->position, render->size, origin,
+      size);
+    if (clip.width == 0) { return; }
+
+    for (int32_t x = 0; x < clip.width; x += BAND_WIDTH) {
+        FfxClip band = clip;
+        band.x += x;
+        band.vpX += x;
+        band.width = clip.width - x;
+        if (band.width > BAND_WIDTH) { band.width = BAND_WIDTH; }
+
+        renderBand(render, frameBuffer, size.width, band);
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static bool walkFunc(FfxNode node, FfxNodeVisitFunc enterFunc,
+  FfxNodeVisitFunc exitFunc, void* arg) {
+
+    if (enterFunc && !enterFunc(node, arg)) { return false; }
+    if (exitFunc && !exitFunc(node, arg)) { return false; }
+    return true;
+}
+
+static void destroyFunc(FfxNode node) {
+}
+
+static void sequenceFunc(FfxNode node, FfxPoint worldPos) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+    pos.x += worldPos.x;
+    pos.y += worldPos.y;
+
+    FfxSize size = tileMap->size;
+
+    if (pos.x >= FFX_SCENE_WIDTH || pos.y >= FFX_SCENE_HEIGHT) { return; }
+    if (pos.x + size.width < 0 || pos.y + size.height < 0) { return; }
+
+    TileMapRender *render = ffx_scene_createRender(node,
+      sizeof(TileMapRender));
+    render->position = pos;
+    render->size = size;
+    render->scroll = tileMap->scroll;
+    render->data = ffx_sceneNode_acquireImage(node, tileMap->data);
+    render->wrap = tileMap->wrap;
+}
+
+static void dumpFunc(FfxNode node, int indent) {
+    FfxPoint pos = ffx_sceneNode_getPosition(node);
+
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    const uint16_t *data = tileMap->data;
+
+    for (int i = 0; i < indent; i++) { printf("  "); }
+    printf("<TileMap pos=%dx%d size=%dx%d scroll=%dx%d map=%dx%d tiles=%d%s>\n",
+      pos.x, pos.y, tileMap->size.width, tileMap->size.height,
+      tileMap->scroll.x, tileMap->scroll.y, data[4], data[5], data[3],
+      tileMap->wrap ? " wrap": "");
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static bool validate(const uint16_t *data, size_t length) {
+    if (length < 2 * HEADER_SIZE || data[0] != FORMAT_TILEMAP) {
+        return false;
+    }
+
+    if (data[1] != TILE_RGB565 && data[1] != TILE_PALETTE8) { return false; }
+    if (data[2] != 8 && data[2] != 16) { return false; }
+
+    size_t tileCount = data[3], columns = data[4], rows = data[5];
+    if (tileCount == 0 || columns == 0 || rows == 0) { return false; }
+
+    size_t mapOffset = getMap(data) - data;
+    if (2 * (mapOffset + columns * rows) > length) { return false; }
+
+    const uint16_t *map = getMap(data);
+    for (int i = 0; i < columns * rows; i++) {
+        if (map[i] >= tileCount) { return false; }
+    }
+
+    return true;
+}
+
+FfxNode ffx_scene_createTileMap(FfxScene scene, const uint16_t *data,
+  size_t dataLength) {
+
+    if (!validate(data, dataLength)) {
+        printf("tilemap: invalid data\n");
+        return NULL;
+    }
+
+    FfxNode node = ffx_scene_createNode(scene, &vtable, sizeof(TileMapNode));
+    if (node == NULL) { return NULL; }
+
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    tileMap->data = data;
+    tileMap->size = ffx_size(data[2] * data[4], data[2] * data[5]);
+
+    return node;
+}
+
+bool ffx_scene_isTileMap(FfxNode node) {
+    return ffx_scene_isNode(node, &vtable);
+}
+
+// See: image-cache.c
+bool _ffx_sceneTileMap_isValid(const uint16_t *data, size_t length) {
+    return validate(data, length);
+}
+
+
+//////////////////////////
+// Properties
+
+const uint16_t* ffx_sceneTileMap_getData(FfxNode node) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return NULL; }
+    return tileMap->data;
+}
+
+FfxSize ffx_sceneTileMap_getSize(FfxNode node) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return ffx_size(0, 0); }
+    return tileMap->size;
+}
+
+static void setSize(FfxNode node, FfxSize size) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return; }
+    tileMap->size = size;
+}
+
+void ffx_sceneTileMap_setSize(FfxNode node, FfxSize size) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return; }
+    ffx_sceneNode_createSizeAction(node, tileMap->size, size, setSize);
+}
+
+FfxPoint ffx_sceneTileMap_getScroll(FfxNode node) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return ffx_point(0, 0); }
+    return tileMap->scroll;
+}
+
+static void setScroll(FfxNode node, FfxPoint scroll) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return; }
+    tileMap->scroll = scroll;
+}
+
+void ffx_sceneTileMap_setScroll(FfxNode node, FfxPoint scroll) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return; }
+    ffx_sceneNode_createPointAction(node, tileMap->scroll, scroll, setScroll);
+}
+
+bool ffx_sceneTileMap_getWrap(FfxNode node) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return false; }
+    return tileMap->wrap;
+}
+
+void ffx_sceneTileMap_setWrap(FfxNode node, bool wrap) {
+    TileMapNode *tileMap = ffx_sceneNode_getState(node, &vtable);
+    if (tileMap == NULL) { return; }
+    tileMap->wrap = wrap;
+}
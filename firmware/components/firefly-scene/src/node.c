@@ -20,28 +20,131 @@ FfxNode assertNode(FfxNode node) {
     return node;
 }
 
+// Push onto the scene's pending animations; lock-free, so any task may
+// request animations without blocking (or being blocked by) the
+// sequence, and unbounded, so no request is ever dropped
+static void queueAnimation(Node *node, Animation *animation) {
+    Scene *scene = node->scene;
+
+    Animation *head = atomic_load_explicit(&scene->pendingAnimations,
+      memory_order_relaxed);
+    do {
+        animation->nextAnimation = head;
+    } while (!atomic_compare_exchange_weak_explicit(
+      &scene->pendingAnimations, &head, animation, memory_order_release,
+      memory_order_relaxed));
+}
+
 static void queueStop(FfxNode _node, int32_t startTime, uint32_t stop) {
     Animation *animation = ffx_sceneNode_memAlloc(_node, sizeof(Animation));
+    if (animation == NULL) { return; }
 
     Node *node = _node;
     animation->node = node;
     animation->startTime = startTime;
     animation->stop = stop;
 
-    if (xQueueSendToBack(node->scene->animQueue, &animation, 0) != pdPASS) {
-        printf("FAILED TO QUEUE!\n");
+    queueAnimation(node, animation);
+}
+
+// An animation being captured; each lives on the stack of its
+// ffx_sceneNode_captureAnimation, innermost first
+typedef struct Capture {
+    struct Capture *prevCapture;
+    Node *node;
+    Animation *animation;
+} Capture;
+
+// Per-task, so only changes made by the task capturing an animation are
+// captured; this saves each node holding its own pending animation
+static _Thread_local Capture *activeCapture = NULL;
+
+static Animation* pendingAnimation(Node *node) {
+    for (Capture *capture = activeCapture; capture;
+      capture = capture->prevCapture) {
+        if (capture->node == node) { return capture->animation; }
     }
+    return NULL;
 }
 
+
 //////////////////////////
 // Life-cycle
 
+#define ARENA_ALIGN(v)     (((v) + 7) & ~7)
+
+// Per-task, so a blob being instantiated does not capture nodes
+// created concurrently on another task
+static _Thread_local Arena *activeArena = NULL;
+
+void ffx_scene_setArena(Arena *arena) {
+    activeArena = arena;
+}
+
+static Node* arenaAlloc(size_t size) {
+    Arena *arena = activeArena;
+    if (arena == NULL) { return NULL; }
+
+    size = ARENA_ALIGN(size);
+    if (arena->offset + size > arena->size) { return NULL; }
+
+    Node *node = (Node*)&arena->data[arena->offset];
+
+    // The first node is at the start of the allocation, so freeing it
+    // frees the arena
+    if (arena->offset) { node->flags |= NodeFlagArena; }
+
+    arena->offset += size;
+
+    return node;
+}
+
+// Every node type created so far, shared by all scenes, so a node holds
+// the index of its vtable rather than a pointer
+static _Atomic(const FfxNodeVTable*) nodeTypes[MAX_NODE_TYPES];
+
+// Returns the type of %%vtable%%, registering it if needed, or -1 if
+// every type is claimed by other vtables
+static int32_t findType(const FfxNodeVTable *vtable) {
+    for (int i = 0; i < MAX_NODE_TYPES; i++) {
+        const FfxNodeVTable *type = atomic_load_explicit(&nodeTypes[i],
+          memory_order_acquire);
+        if (type == NULL) {
+            atomic_compare_exchange_strong(&nodeTypes[i], &type, vtable);
+        }
+
+        if (type == NULL || type == vtable) { return i; }
+    }
+
+    return -1;
+}
+
+const FfxNodeVTable* ffx_sceneNode_getVTable(Node *node) {
+    // A node is only reachable once created, which registered its type
+    return atomic_load_explicit(&nodeTypes[node->type],
+      memory_order_relaxed);
+}
+
 FfxNode ffx_scene_createNode(FfxScene scene, const FfxNodeVTable *vtable,
   size_t stateSize) {
 
-    Node *node = ffx_scene_memAlloc(scene, sizeof(Node) + stateSize);
+    int32_t type = findType(vtable);
+    if (type == -1) {
+        printf("Error: too many node types; cannot create %s\n",
+          vtable->name);
+        return NULL;
+    }
+
+    Node *node = arenaAlloc(sizeof(Node) + stateSize);
+    if (node == NULL) {
+        node = ffx_scene_poolAlloc(scene, sizeof(Node) + stateSize);
+    }
+    if (node == NULL) {
+        node = ffx_scene_memAlloc(scene, sizeof(Node) + stateSize);
+    }
+    if (node == NULL) { return NULL; }
 
-    node->vtable = vtable;
+    node->type = type;
     node->scene = scene;
 
     return node;
@@ -49,43 +152,73 @@ FfxNode ffx_scene_createNode(FfxScene scene, const FfxNodeVTable *vtable,
 
 bool ffx_scene_isNode(FfxNode _node, const FfxNodeVTable *vtable) {
     Node *node = _node;
-    return (node->vtable == vtable);
+    return (ffx_sceneNode_getVTable(node) == vtable);
 }
 
 void* ffx_sceneNode_getState(FfxNode _node, const FfxNodeVTable *vtable) {
     Node *node = _node;
-    if (vtable != node->vtable) {
+    if (vtable != ffx_sceneNode_getVTable(node)) {
         printf("FfxNode mismatch; called wrong method on %s\n",
-          node->vtable->name);
+          ffx_sceneNode_getVTable(node)->name);
         esp_backtrace_print(5);
         return NULL;
     }
     return &node[1];
 }
 
-void ffx_sceneNode_free(FfxNode _node) {
+// See: node-group.c and node-anchor.c
+void _ffx_sceneGroup_detachChild(FfxNode node, FfxNode child);
+void _ffx_sceneAnchor_detachChild(FfxNode node, FfxNode child);
 
-    Node *node = _node;
-    node->flags |= NodeFlagRemove;
+static bool markRemove(FfxNode node, void *arg) {
+    ffx_sceneNode_setFlags(node, NodeFlagRemove);
+    return true;
+}
 
-    // <Critical Section>
-//    animationLock(node->scene);
+void ffx_sceneNode_free(FfxNode _node) {
+    Node *node = _node;
+    Scene *scene = node->scene;
 
-    // Clear all animations on this node; no onComplete is called
-    Animation *animation = node->scene->animationHead;
-    while (animation) {
-        if (animation->node == node) { animation->node = NULL; }
-        animation = animation->nextAnimation;
+    // Mark the entire subtree, so a single pass over the animations,
+    // tracks and batches releases every reference to it, rather than
+    // one pass per node as each destroyFunc frees its children
+    if (scene->freeDepth++ == 0) {
+        ffx_sceneNode_detach(node);
+        ffx_sceneNode_walk(node, markRemove, NULL, NULL);
+        ffx_scene_releaseNodes(scene);
     }
 
-//    animationUnlock(node->scene);
-    // <//Critical Section>
+    ffx_sceneNode_getVTable(node)->destroyFunc(node);
+
+    scene->freeDepth--;
 
-    node->vtable->destroyFunc(node);
+    // Released along with the blob root
+    if (node->flags & NodeFlagArena) { return; }
+
+    if (node->flags & NodeFlagPool) {
+        ffx_scene_poolFree(scene, node);
+        return;
+    }
 
     ffx_sceneNode_memFree(node, node);
 }
 
+void ffx_sceneNode_detach(FfxNode _node) {
+    Node *node = assertNode(_node);
+
+    // Detaching cancels a pending remove
+    node->flags &= ~NodeFlagRemove;
+
+    Node *parent = node->parent;
+    if (parent == NULL) { return; }
+
+    if (ffx_scene_isGroup(parent)) {
+        _ffx_sceneGroup_detachChild(parent, node);
+    } else if (ffx_scene_isAnchor(parent)) {
+        _ffx_sceneAnchor_detachChild(parent, node);
+    }
+}
+
 void ffx_sceneNode_remove(FfxNode _node) {
     Node *node = assertNode(_node);
 
@@ -133,23 +266,25 @@ bool ffx_sceneNode_walk(FfxNode _node, FfxNodeVisitFunc enterFunc,
   FfxNodeVisitFunc exitFunc, void* arg) {
 
     Node *node = _node;
-    return node->vtable->walkFunc(_node, enterFunc, exitFunc, arg);
+    return ffx_sceneNode_getVTable(node)->walkFunc(_node, enterFunc,
+      exitFunc, arg);
 }
 
 void ffx_sceneNode_sequence(FfxNode _node, FfxPoint worldPoint) {
     if (ffx_sceneNode_getHidden(_node)) { return; }
     Node *node = _node;
-    node->vtable->sequenceFunc(_node, worldPoint);
+    if (node->scene->trace) { node->scene->trace->worldPos = worldPoint; }
+    ffx_sceneNode_getVTable(node)->sequenceFunc(_node, worldPoint);
 }
 
 void ffx_sceneNode_dump(FfxNode _node, size_t indent) {
     Node *node = _node;
-    node->vtable->dumpFunc(_node, indent);
+    ffx_sceneNode_getVTable(node)->dumpFunc(_node, indent);
 }
 
 const char* ffx_sceneNode_getName(FfxNode _node) {
     Node *node = _node;
-    return node->vtable->name;
+    return ffx_sceneNode_getVTable(node)->name;
 }
 
 
@@ -161,6 +296,11 @@ FfxNode ffx_sceneNode_getScene(FfxNode _node) {
     return node->scene;
 }
 
+FfxNode ffx_sceneNode_getParent(FfxNode _node) {
+    Node *node = _node;
+    return node->parent;
+}
+
 FfxNode ffx_sceneNode_getNextSibling(FfxNode _node) {
     Node *node = _node;
     return node->nextSibling;
@@ -286,51 +426,84 @@ void ffx_sceneNode_runAnimation(FfxNode node,
 
 
 
-typedef struct ColorState {
-    color_ffxt v0;
-    color_ffxt v1;
-    FfxNodeActionSetColorFunc setFunc;
-} ColorState;
+// The built-in actions are typed, so the scene can apply them in bulk
+// from its ActionArrays each sequence (see: scene.c). Each animation
+// holds a few; beyond that they fall back onto an Action.
 
 static void animateColor(FfxNode node, fixed_ffxt t, void *_state) {
-    ColorState *state = _state;
-    state->setFunc(node, ffx_color_lerpfx(state->v0, state->v1, t));
+    TypedAction *state = _state;
+    state->setFunc.color(node, ffx_color_lerpfx(state->v0.color,
+      state->v1.color, t));
 }
 
-bool ffx_sceneNode_createColorAction(FfxNode node, color_ffxt v0,
-  color_ffxt v1, FfxNodeActionSetColorFunc setFunc) {
+static void animatePoint(FfxNode node, fixed_ffxt t, void *_state) {
+    TypedAction *state = _state;
+    FfxPoint v0 = state->v0.point;
+    FfxPoint v1 = state->v1.point;
 
-    if (!ffx_sceneNode_isCapturing(node)) {
-        setFunc(node, v1);
-        return false;
-    }
+    state->setFunc.point(node, (FfxPoint){
+        .x = v0.x + scalarfx(v1.x - v0.x, t),
+        .y = v0.y + scalarfx(v1.y - v0.y, t)
+    });
+}
+
+static void animateSize(FfxNode node, fixed_ffxt t, void *_state) {
+    TypedAction *state = _state;
+    FfxSize v0 = state->v0.size;
+    FfxSize v1 = state->v1.size;
+
+    state->setFunc.size(node, (FfxSize){
+        .width = v0.width + scalarfx(v1.width - v0.width, t),
+        .height = v0.height + scalarfx(v1.height - v0.height, t)
+    });
+}
+
+static void animateFixed(FfxNode node, fixed_ffxt t, void *_state) {
+    TypedAction *state = _state;
+    fixed_ffxt v0 = state->v0.fixed;
+    state->setFunc.fixed(node, v0 + mulfx(state->v1.fixed - v0, t));
+}
+
+static const FfxNodeActionFunc typedActionFuncs[] = {
+    [ActionTypePoint] = animatePoint,
+    [ActionTypeSize] = animateSize,
+    [ActionTypeColor] = animateColor,
+    [ActionTypeFixed] = animateFixed,
+};
+
+static void createTypedAction(FfxNode _node, ActionType type,
+  ActionValue v0, ActionValue v1, ActionSetFunc setFunc) {
+
+    Node *node = _node;
+    Animation *animation = pendingAnimation(node);
 
-    ColorState *state = ffx_sceneNode_createAction(node, sizeof(ColorState),
-      animateColor);
+    TypedAction *state = NULL;
+    if (animation->typedCount < MAX_TYPED_ACTIONS) {
+        state = &animation->typedActions[animation->typedCount++];
+    } else {
+        state = ffx_sceneNode_createAction(node, sizeof(TypedAction),
+          typedActionFuncs[type]);
+        if (state == NULL) { return; }
+    }
 
+    state->type = type;
     state->v0 = v0;
     state->v1 = v1;
     state->setFunc = setFunc;
-
-    return true;
 }
 
+bool ffx_sceneNode_createColorAction(FfxNode node, color_ffxt v0,
+  color_ffxt v1, FfxNodeActionSetColorFunc setFunc) {
 
-typedef struct PointState {
-    FfxPoint v0;
-    FfxPoint v1;
-    FfxNodeActionSetPointFunc setFunc;
-} PointState;
+    if (!ffx_sceneNode_isCapturing(node)) {
+        setFunc(node, v1);
+        return false;
+    }
 
-static void animatePoint(FfxNode node, fixed_ffxt t, void *_state) {
-    PointState *state = _state;
-    FfxPoint v0 = state->v0;
-    FfxPoint v1 = state->v1;
+    createTypedAction(node, ActionTypeColor, (ActionValue){ .color = v0 },
+      (ActionValue){ .color = v1 }, (ActionSetFunc){ .color = setFunc });
 
-    state->setFunc(node, (FfxPoint){
-        .x = v0.x + scalarfx(v1.x - v0.x, t),
-        .y = v0.y + scalarfx(v1.y - v0.y, t)
-    });
+    return true;
 }
 
 bool ffx_sceneNode_createPointAction(FfxNode node, FfxPoint v0, FfxPoint v1,
@@ -341,48 +514,36 @@ bool ffx_sceneNode_createPointAction(FfxNode node, FfxPoint v0, FfxPoint v1,
         return false;
     }
 
-    PointState *state = ffx_sceneNode_createAction(node, sizeof(PointState),
-      animatePoint);
-
-    state->v0 = v0;
-    state->v1 = v1;
-    state->setFunc = setFunc;
+    createTypedAction(node, ActionTypePoint, (ActionValue){ .point = v0 },
+      (ActionValue){ .point = v1 }, (ActionSetFunc){ .point = setFunc });
 
     return true;
 }
 
+bool ffx_sceneNode_createSizeAction(FfxNode node, FfxSize v0, FfxSize v1,
+  FfxNodeActionSetSizeFunc setFunc) {
 
-typedef struct SizeState {
-    FfxSize v0;
-    FfxSize v1;
-    FfxNodeActionSetSizeFunc setFunc;
-} SizeState;
+    if (!ffx_sceneNode_isCapturing(node)) {
+        setFunc(node, v1);
+        return false;
+    }
 
-static void animateSize(FfxNode node, fixed_ffxt t, void *_state) {
-    SizeState *state = _state;
-    FfxSize v0 = state->v0;
-    FfxSize v1 = state->v1;
+    createTypedAction(node, ActionTypeSize, (ActionValue){ .size = v0 },
+      (ActionValue){ .size = v1 }, (ActionSetFunc){ .size = setFunc });
 
-    state->setFunc(node, (FfxSize){
-        .width = v0.width + scalarfx(v1.width - v0.width, t),
-        .height = v0.height + scalarfx(v1.height - v0.height, t)
-    });
+    return true;
 }
 
-bool ffx_sceneNode_createSizeAction(FfxNode node, FfxSize v0, FfxSize v1,
-  FfxNodeActionSetSizeFunc setFunc) {
+bool ffx_sceneNode_createFixedAction(FfxNode node, fixed_ffxt v0,
+  fixed_ffxt v1, FfxNodeActionSetFixedFunc setFunc) {
 
     if (!ffx_sceneNode_isCapturing(node)) {
         setFunc(node, v1);
         return false;
     }
 
-    SizeState *state = ffx_sceneNode_createAction(node, sizeof(SizeState),
-      animateSize);
-
-    state->v0 = v0;
-    state->v1 = v1;
-    state->setFunc = setFunc;
+    createTypedAction(node, ActionTypeFixed, (ActionValue){ .fixed = v0 },
+      (ActionValue){ .fixed = v1 }, (ActionSetFunc){ .fixed = setFunc });
 
     return true;
 }
@@ -393,8 +554,7 @@ bool ffx_sceneNode_createSizeAction(FfxNode node, FfxSize v0, FfxSize v1,
 // Animation
 
 bool ffx_sceneNode_isCapturing(FfxNode _node) {
-    Node *node = _node;
-    return node->pendingAnimation != NULL;
+    return pendingAnimation(_node) != NULL;
 }
 
 void* ffx_sceneNode_createAction(FfxNode _node, size_t stateSize,
@@ -402,38 +562,46 @@ void* ffx_sceneNode_createAction(FfxNode _node, size_t stateSize,
 
     Node *node = _node;
 
-    if (node->pendingAnimation == NULL) {
+    Animation *animation = pendingAnimation(node);
+    if (animation == NULL) {
         printf("cannot add animations; not capturing\n");
         return NULL;
     }
 
     Action *action = ffx_sceneNode_memAlloc(node, sizeof(Action) + stateSize);
+    if (action == NULL) { return NULL; }
 
     action->actionFunc = actionFunc;
 
     // Prepend the action to the list of actions on the pending animation
-    action->nextAction = node->pendingAnimation->actions;
-    node->pendingAnimation->actions = action;
+    action->nextAction = animation->actions;
+    animation->actions = action;
 
     return &action[1];
 }
 
-void ffx_sceneNode_animate(FfxNode _node,
+Animation* ffx_sceneNode_captureAnimation(FfxNode _node,
   FfxNodeAnimationSetupFunc animationsFunc, void *arg) {
 
     Node *node = _node;
 
-    if (node->pendingAnimation != NULL) {
+    if (pendingAnimation(node) != NULL) {
         printf("already capturing animation\n");
-        return;
+        return NULL;
     }
 
     Animation *animation = ffx_sceneNode_memAlloc(_node, sizeof(Animation));
+    if (animation == NULL) { return NULL; }
 
     animation->node = node;
     animation->info.curve = FfxCurveLinear;
 
-    node->pendingAnimation = animation;
+    Capture capture = {
+        .prevCapture = activeCapture,
+        .node = node,
+        .animation = animation
+    };
+    activeCapture = &capture;
 
     // Setup the animation
     animationsFunc(_node, &(animation->info), arg);
@@ -445,11 +613,21 @@ void ffx_sceneNode_animate(FfxNode _node,
            scene->initArg);
     }
 
-    node->pendingAnimation = NULL;
+    activeCapture = capture.prevCapture;
 
-    if (xQueueSendToBack(scene->animQueue, &animation, 0) != pdPASS) {
-        printf("FAILED TO QUEUE!\n");
-    }
+    return animation;
+}
+
+void ffx_sceneNode_animate(FfxNode _node,
+  FfxNodeAnimationSetupFunc animationsFunc, void *arg) {
+
+    Node *node = _node;
+
+    Animation *animation = ffx_sceneNode_captureAnimation(_node,
+      animationsFunc, arg);
+    if (animation == NULL) { return; }
+
+    queueAnimation(node, animation);
 }
 
 void ffx_sceneNode_advanceAnimations(FfxNode node, uint32_t advance) {
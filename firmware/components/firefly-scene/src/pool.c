@@ -0,0 +1,165 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+
+#define POOL_ALIGN(v)      (((v) + 7) & ~7)
+
+// A slab whose slots are all free
+#define SLAB_FREE          (0xffffffff)
+
+
+//////////////////////////
+// Slabs
+
+static uint8_t* getSlot(NodePool *pool, uint32_t index) {
+    uint8_t *slab = atomic_load_explicit(
+      &pool->slabs[index / POOL_SLAB_SLOTS], memory_order_acquire);
+    return &slab[(index % POOL_SLAB_SLOTS) * pool->size];
+}
+
+// Claim the lowest free slot of slab %%s%%, returning its index in the
+// pool, or -1 if none are free
+static int32_t claimSlot(NodePool *pool, uint32_t s) {
+    uint32_t mask = atomic_load_explicit(&pool->freeMasks[s],
+      memory_order_acquire);
+
+    while (mask) {
+        uint32_t bit = __builtin_ctz(mask);
+        if (atomic_compare_exchange_weak_explicit(&pool->freeMasks[s], &mask,
+          mask & ~(1u << bit), memory_order_acquire, memory_order_acquire)) {
+            return s * POOL_SLAB_SLOTS + bit;
+        }
+    }
+
+    return -1;
+}
+
+// Add a slab to %%pool%%, keeping its first slot and freeing the rest,
+// returning the index of the kept slot or -1 if the pool is full
+static int32_t growPool(Scene *scene, NodePool *pool) {
+    uint8_t *data = ffx_scene_memAlloc(scene, POOL_SLAB_SLOTS * pool->size);
+    if (data == NULL) { return -1; }
+
+    for (uint32_t s = 0; s < MAX_POOL_SLABS; s++) {
+        uint8_t *slab = NULL;
+        if (!atomic_compare_exchange_strong(&pool->slabs[s], &slab, data)) {
+            continue;
+        }
+
+        uint32_t count = atomic_load(&pool->slabCount);
+        while (count <= s && !atomic_compare_exchange_weak(&pool->slabCount,
+          &count, s + 1)) { }
+
+        // Publishes the slab pointer to any task claiming from the mask
+        atomic_store_explicit(&pool->freeMasks[s], SLAB_FREE & ~1,
+          memory_order_release);
+
+        return s * POOL_SLAB_SLOTS;
+    }
+
+    ffx_scene_memFree(scene, data);
+    return -1;
+}
+
+
+//////////////////////////
+// Pools
+
+// Returns the pool for %%size%%, claiming an unused one if needed, or
+// NULL if every pool is claimed by other sizes
+static NodePool* findPool(Scene *scene, uint32_t size) {
+    for (int i = 0; i < MAX_NODE_POOLS; i++) {
+        NodePool *pool = &scene->nodePools[i];
+
+        uint32_t poolSize = atomic_load(&pool->size);
+        if (poolSize == 0) {
+            atomic_compare_exchange_strong(&pool->size, &poolSize, size);
+        }
+
+        if (poolSize == 0 || poolSize == size) { return pool; }
+    }
+
+    return NULL;
+}
+
+Node* ffx_scene_poolAlloc(Scene *scene, size_t _size) {
+    uint32_t size = POOL_ALIGN(_size);
+    if (size > MAX_POOL_NODE_SIZE) { return NULL; }
+
+    NodePool *pool = findPool(scene, size);
+    if (pool == NULL) { return NULL; }
+
+    // Lowest slab first, so nodes pack towards the front and the slabs
+    // at the end drain, to be trimmed
+    int32_t index = -1;
+    uint32_t count = atomic_load(&pool->slabCount);
+    for (uint32_t s = 0; s < count && index == -1; s++) {
+        index = claimSlot(pool, s);
+    }
+
+    if (index == -1) { index = growPool(scene, pool); }
+    if (index == -1) { return NULL; }
+
+    Node *node = (Node*)getSlot(pool, index);
+    memset(node, 0, size);
+
+    node->flags = NodeFlagPool;
+    node->slot = NODE_SLOT(pool - scene->nodePools, index);
+
+    return node;
+}
+
+void ffx_scene_poolFree(Scene *scene, Node *node) {
+    NodePool *pool = &scene->nodePools[NODE_SLOT_POOL(node->slot)];
+    uint32_t index = NODE_SLOT_INDEX(node->slot);
+
+    atomic_fetch_or_explicit(&pool->freeMasks[index / POOL_SLAB_SLOTS],
+      1u << (index % POOL_SLAB_SLOTS), memory_order_release);
+}
+
+void ffx_scene_poolTrim(Scene *scene) {
+    for (int i = 0; i < MAX_NODE_POOLS; i++) {
+        NodePool *pool = &scene->nodePools[i];
+
+        // Keep the lowest empty slab, which allocs reach first, so a
+        // node freed and created each frame does not churn the heap
+        bool spare = false;
+
+        uint32_t count = atomic_load(&pool->slabCount);
+        for (uint32_t s = 0; s < count; s++) {
+            uint32_t mask = atomic_load_explicit(&pool->freeMasks[s],
+              memory_order_relaxed);
+            if (mask != SLAB_FREE) { continue; }
+
+            if (!spare) {
+                spare = true;
+                continue;
+            }
+
+            // Emptying the mask first means no alloc can claim a slot
+            // once the slab is taken; if a slot was claimed meanwhile,
+            // the exchange fails and the slab stays
+            if (!atomic_compare_exchange_strong_explicit(&pool->freeMasks[s],
+              &mask, 0, memory_order_acquire, memory_order_relaxed)) {
+                continue;
+            }
+
+            uint8_t *slab = atomic_exchange(&pool->slabs[s], NULL);
+            ffx_scene_memFree(scene, slab);
+        }
+    }
+}
+
+void ffx_scene_poolDestroy(Scene *scene) {
+    for (int i = 0; i < MAX_NODE_POOLS; i++) {
+        NodePool *pool = &scene->nodePools[i];
+
+        for (int s = 0; s < MAX_POOL_SLABS; s++) {
+            uint8_t *slab = atomic_load(&pool->slabs[s]);
+            if (slab) { ffx_scene_memFree(scene, slab); }
+        }
+    }
+}
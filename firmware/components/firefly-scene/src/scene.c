@@ -19,7 +19,8 @@ void* ffx_scene_memAlloc(FfxScene _scene, size_t size) {
 
     void *ptr = scene->allocFunc(size, scene->initArg);
     if (ptr == NULL) {
-        printf("FAIL: could not allocate %d bytes\n", size);
+        printf("FAIL: could not allocate %zu bytes\n", size);
+        return NULL;
     }
     memset(ptr, 0, size);
 
@@ -61,9 +62,11 @@ FfxScene ffx_scene_init(FfxSceneAllocFunc allocFunc,
     scene->tick = xTaskGetTickCount();
     scene->root = ffx_scene_createGroup(scene);
 
-    scene->animQueue = xQueueCreateStatic(MAX_ANIMATION_BACKLOG,
-      sizeof(Animation*), scene->animQueueStorageBuffer,
-      &scene->animQueueBuffer);
+    atomic_init(&scene->commands, NULL);
+    atomic_init(&scene->pendingTracks, NULL);
+    atomic_init(&scene->pendingAnimations, NULL);
+    atomic_init(&scene->pendingImages, NULL);
+    atomic_init(&scene->imageBudget, 0);
 
     if (scene->root == NULL) {
         freeFunc((void*)scene, initArg);
@@ -73,10 +76,91 @@ FfxScene ffx_scene_init(FfxSceneAllocFunc allocFunc,
     return scene;
 }
 
+void ffx_scene_freeAnimation(Scene *scene, Animation *animation) {
+    // Hand back a setupFunc result which was never dispatched
+    if (animation->dispatchArg && scene->dispatchFunc) {
+        scene->dispatchFunc(animation->dispatchArg, NULL, animation->node,
+          animation->stop, animation->info.arg, scene->initArg);
+    }
+
+    Action *action = animation->actions;
+    while (action) {
+        Action *nextAction = action->nextAction;
+        ffx_scene_memFree(scene, action);
+        action = nextAction;
+    }
+
+    ffx_scene_memFree(scene, animation);
+}
+
+static void freeAnimations(Scene *scene, Animation *animation) {
+    while (animation) {
+        Animation *nextAnimation = animation->nextAnimation;
+        ffx_scene_freeAnimation(scene, animation);
+        animation = nextAnimation;
+    }
+}
+
+static void freeTracks(Scene *scene, Tracks *tracks) {
+    while (tracks) {
+        Tracks *nextTracks = tracks->nextTracks;
+        ffx_scene_memFree(scene, tracks);
+        tracks = nextTracks;
+    }
+}
+
+static void freeRenders(Scene *scene) {
+    Render *render = scene->renderHead;
+    scene->renderHead = scene->renderTail = NULL;
+
+    while (render) {
+        Render *nextRender = render->nextRender;
+        ffx_scene_memFree(scene, render);
+        render = nextRender;
+    }
+}
+
 void ffx_scene_free(FfxScene _scene) {
     Scene *scene = _scene;
 
-    // @TODO: free all children!
+    // Any detached nodes are owned by the caller and must already have
+    // been freed
+    ffx_sceneNode_free(scene->root);
+
+    freeRenders(scene);
+
+    freeAnimations(scene, scene->animationHead);
+    freeAnimations(scene, atomic_exchange(&scene->pendingAnimations, NULL));
+
+    freeTracks(scene, scene->tracksHead);
+    freeTracks(scene, atomic_exchange(&scene->pendingTracks, NULL));
+
+    ffx_scene_freeImages(scene);
+
+    Command *command = atomic_exchange(&scene->commands, NULL);
+    while (command) {
+        Command *nextCommand = command->nextCommand;
+        if (command->type == CommandTypeAnimate) {
+            ffx_scene_freeAnimation(scene, command->value.animation);
+        }
+        ffx_scene_memFree(scene, command);
+        command = nextCommand;
+    }
+
+    for (int i = 0; i < TYPED_ACTION_COUNT; i++) {
+        ActionArray *array = &scene->actionArrays[i];
+        if (array->animations) {
+            scene->freeFunc((void*)array->animations, scene->initArg);
+        }
+    }
+
+    ffx_scene_poolDestroy(scene);
+
+    for (int i = 0; i < MAX_LAYER_DEPTH; i++) {
+        if (scene->layers[i]) {
+            scene->freeFunc((void*)scene->layers[i], scene->initArg);
+        }
+    }
 
     scene->freeFunc((void*)scene, scene->initArg);
 }
@@ -145,55 +229,300 @@ FfxNode ffx_scene_root(FfxScene _scene) {
 //////////////////////////
 // Sequencing
 
-static void updateAnimations(Scene *scene) {
-    int32_t now = scene->tick;
+// Grow the parallel arrays, which share one allocation, by doubling
+static bool growActions(Scene *scene, ActionArray *array) {
+    size_t capacity = array->capacity ? (2 * array->capacity): 16;
+
+    size_t stride = sizeof(Animation*) + sizeof(ActionSetFunc) +
+      2 * sizeof(ActionValue);
+
+    uint8_t *data = ffx_scene_memAlloc(scene, capacity * stride);
+    if (data == NULL) { return false; }
+
+    Animation **animations = (Animation**)data;
+    ActionSetFunc *setFuncs = (ActionSetFunc*)&animations[capacity];
+    ActionValue *v0 = (ActionValue*)&setFuncs[capacity];
+    ActionValue *v1 = &v0[capacity];
+
+    size_t count = array->count;
+    if (array->animations) {
+        memcpy(animations, array->animations, count * sizeof(Animation*));
+        memcpy(setFuncs, array->setFuncs, count * sizeof(ActionSetFunc));
+        memcpy(v0, array->v0, count * sizeof(ActionValue));
+        memcpy(v1, array->v1, count * sizeof(ActionValue));
+        ffx_scene_memFree(scene, array->animations);
+    }
+
+    array->capacity = capacity;
+    array->animations = animations;
+    array->setFuncs = setFuncs;
+    array->v0 = v0;
+    array->v1 = v1;
+
+    return true;
+}
+
+static void pushAction(Scene *scene, Animation *animation,
+  TypedAction *action) {
+
+    ActionArray *array = &scene->actionArrays[action->type];
+    if (array->count == array->capacity && !growActions(scene, array)) {
+        // Better to jump to the end than to never get there
+        printf("FAILED TO START ACTION!\n");
+
+        Node *node = animation->node;
+        switch (action->type) {
+            case ActionTypePoint:
+                action->setFunc.point(node, action->v1.point);
+                break;
+            case ActionTypeSize:
+                action->setFunc.size(node, action->v1.size);
+                break;
+            case ActionTypeColor:
+                action->setFunc.color(node, action->v1.color);
+                break;
+            case ActionTypeFixed:
+                action->setFunc.fixed(node, action->v1.fixed);
+                break;
+        }
+        return;
+    }
+
+    size_t i = array->count++;
+    array->animations[i] = animation;
+    array->setFuncs[i] = action->setFunc;
+    array->v0[i] = action->v0;
+    array->v1[i] = action->v1;
+}
+
+void ffx_scene_appendAnimation(Scene *scene, Animation *animation) {
+    animation->startTime = scene->tick;
+    animation->order = scene->animationOrder++;
+
+    // Move the typed actions into the action arrays
+    for (int i = 0; i < animation->typedCount; i++) {
+        pushAction(scene, animation, &animation->typedActions[i]);
+    }
+
+    // Add the new animation to the animation list
+    if (scene->animationHead == NULL) {
+        scene->animationHead = scene->animationTail = animation;
+    } else {
+        scene->animationTail->nextAnimation = animation;
+        scene->animationTail = animation;
+    }
+}
+
+void ffx_scene_stopAnimations(Scene *scene, Node *node, uint32_t stop) {
+    Animation *animation = scene->animationHead;
+    while (animation) {
+        if (animation->node == node && !animation->stop) {
+            animation->stop = stop;
+        }
+        animation = animation->nextAnimation;
+    }
+}
 
-    // Add any queued animation actions
-    while (true) {
+static bool isRemoved(Node *node) {
+    return (node && (node->flags & NodeFlagRemove));
+}
 
-        Animation *anim = NULL;
-        BaseType_t result = xQueueReceive(scene->animQueue, &anim, 0);
-        if (result != pdPASS) { break; }
+void ffx_scene_releaseNodes(Scene *scene) {
+    Animation *animation = scene->animationHead;
+    while (animation) {
+        if (isRemoved(animation->node)) { animation->node = NULL; }
+        animation = animation->nextAnimation;
+    }
+
+    // Anything already pushed onto the pending stacks is left alone by
+    // the task that pushed it, so may be cleared in place even as other
+    // tasks push more
+
+    animation = atomic_load_explicit(&scene->pendingAnimations,
+      memory_order_acquire);
+    while (animation) {
+        if (isRemoved(animation->node)) { animation->node = NULL; }
+        animation = animation->nextAnimation;
+    }
+
+    Tracks *tracks = scene->tracksHead;
+    while (tracks) {
+        if (isRemoved(tracks->node)) { tracks->node = NULL; }
+        tracks = tracks->nextTracks;
+    }
+
+    tracks = atomic_load_explicit(&scene->pendingTracks,
+      memory_order_acquire);
+    while (tracks) {
+        if (isRemoved(tracks->node)) { tracks->node = NULL; }
+        tracks = tracks->nextTracks;
+    }
+
+    // A command is dropped if any node it involves is removed, except an
+    // animation, which still needs to be completed and freed
+    Command *command = atomic_load_explicit(&scene->commands,
+      memory_order_acquire);
+    while (command) {
+        bool removed = isRemoved(command->node);
+
+        switch (command->type) {
+            case CommandTypeAppendChild:
+                removed |= isRemoved(command->value.child);
+                break;
+            case CommandTypeInsertBefore:
+                removed |= isRemoved(command->value.insert.child);
+                removed |= isRemoved(command->value.insert.sibling);
+                break;
+            case CommandTypeAnimate:
+                if (removed) { command->value.animation->node = NULL; }
+                break;
+            default:
+                break;
+        }
+
+        if (removed) { command->node = NULL; }
+
+        command = command->nextCommand;
+    }
+}
+
+static void dequeueAnimations(Scene *scene) {
+
+    // Take every pending request at once; anything requested after this
+    // is picked up by the next sequence
+    Animation *anim = atomic_exchange_explicit(&scene->pendingAnimations,
+      NULL, memory_order_acquire);
+    if (anim == NULL) { return; }
+
+    // The stack is most-recent first; reverse it so requests are handled
+    // in the order they were made
+    Animation *ordered = NULL;
+    while (anim) {
+        Animation *nextAnim = anim->nextAnimation;
+        anim->nextAnimation = ordered;
+        ordered = anim;
+        anim = nextAnim;
+    }
+
+    anim = ordered;
+    while (anim) {
+        Animation *nextAnim = anim->nextAnimation;
+        anim->nextAnimation = NULL;
 
-        // Queued Advance Animations
         if (anim->stop == STOP_ADVANCE) {
+            // Queued Advance Animations
             Animation *animation = scene->animationHead;
             while (animation) {
                 if (animation->node == anim->node && !animation->stop) {
-                    animation->startTime -= anim->startTime;;
+                    animation->startTime -= anim->startTime;
                 }
                 animation = animation->nextAnimation;
             }
-            ffx_scene_memFree(scene, animation);
-            continue;
+            ffx_scene_memFree(scene, anim);
+
+        } else if (anim->stop) {
+            // Queued Stop Animations
+            ffx_scene_stopAnimations(scene, anim->node, anim->stop);
+            ffx_scene_memFree(scene, anim);
+
+        } else {
+            // Queued Animation
+            ffx_scene_appendAnimation(scene, anim);
         }
 
-        // Queued Stop Animations
-        if (anim->stop) {
-            Animation *animation = scene->animationHead;
-            while (animation) {
-                if (animation->node == anim->node && !animation->stop) {
-                    animation->stop = anim->stop;
+        anim = nextAnim;
+    }
+}
+
+// Apply each typed action in a tight loop over its array, dropping
+// any whose animation has completed. Removal keeps the remaining order,
+// so when two animations target the same property the newest still
+// wins, as it did when every action was run through its animation.
+//
+// If %%bounded%%, only the actions of animations up to and including
+// %%order%% are applied, and the next call resumes after them; the
+// unbounded call finishes the array.
+static inline void updateActions(ActionArray *array, ActionType type,
+  bool bounded, uint32_t order) {
+
+    size_t count = array->count;
+    Animation **animations = array->animations;
+    ActionSetFunc *setFuncs = array->setFuncs;
+    ActionValue *v0 = array->v0, *v1 = array->v1;
+
+    size_t i = array->next, j = array->kept;
+    for (; i < count; i++) {
+        Animation *animation = animations[i];
+
+        // Started after the animation being walked; its t is not known
+        if (bounded && (int32_t)(animation->order - order) > 0) { break; }
+
+        if (animation->apply) {
+            Node *node = animation->node;
+            fixed_ffxt t = animation->t;
+
+            switch (type) {
+                case ActionTypePoint: {
+                    FfxPoint a = v0[i].point, b = v1[i].point;
+                    setFuncs[i].point(node, (FfxPoint){
+                        .x = a.x + scalarfx(b.x - a.x, t),
+                        .y = a.y + scalarfx(b.y - a.y, t)
+                    });
+                    break;
+                }
+
+                case ActionTypeSize: {
+                    FfxSize a = v0[i].size, b = v1[i].size;
+                    setFuncs[i].size(node, (FfxSize){
+                        .width = a.width + scalarfx(b.width - a.width, t),
+                        .height = a.height + scalarfx(b.height - a.height, t)
+                    });
+                    break;
+                }
+
+                case ActionTypeColor:
+                    setFuncs[i].color(node, ffx_color_lerpfx(v0[i].color,
+                      v1[i].color, t));
+                    break;
+
+                case ActionTypeFixed: {
+                    fixed_ffxt a = v0[i].fixed;
+                    setFuncs[i].fixed(node, a + mulfx(v1[i].fixed - a, t));
+                    break;
                 }
-                animation = animation->nextAnimation;
             }
-            ffx_scene_memFree(scene, animation);
-            continue;
         }
 
-        // Queued Animation
-
-        anim->startTime = now;
+        if (animation->complete) { continue; }
 
-        // Add the new animation to the animation list
-        if (scene->animationHead == NULL) {
-            scene->animationHead = scene->animationTail = anim;
-        } else {
-            scene->animationTail->nextAnimation = anim;
-            scene->animationTail = anim;
+        if (i != j) {
+            animations[j] = animations[i];
+            setFuncs[j] = setFuncs[i];
+            v0[j] = v0[i];
+            v1[j] = v1[i];
         }
+        j++;
     }
 
+    array->next = i;
+    array->kept = j;
+
+    if (!bounded) { array->count = j; }
+}
+
+// Apply the typed actions of every animation up to %%order%%, or of
+// every animation if not %%bounded%%; each is inlined with its type,
+// so the loops carry no switch
+static void applyActions(Scene *scene, bool bounded, uint32_t order) {
+    ActionArray *arrays = scene->actionArrays;
+    updateActions(&arrays[ActionTypePoint], ActionTypePoint, bounded, order);
+    updateActions(&arrays[ActionTypeSize], ActionTypeSize, bounded, order);
+    updateActions(&arrays[ActionTypeColor], ActionTypeColor, bounded, order);
+    updateActions(&arrays[ActionTypeFixed], ActionTypeFixed, bounded, order);
+}
+
+static void updateAnimations(Scene *scene) {
+    int32_t now = scene->tick;
 
     // The list of completed animations; removed from the list by not freed
     Animation *completeHead = NULL;
@@ -201,6 +530,11 @@ static void updateAnimations(Scene *scene) {
 
     Animation *prevAnimation = NULL;
 
+    for (int i = 0; i < TYPED_ACTION_COUNT; i++) {
+        scene->actionArrays[i].next = 0;
+        scene->actionArrays[i].kept = 0;
+    }
+
     Animation *animation = scene->animationHead;
     while (animation) {
 
@@ -209,6 +543,7 @@ static void updateAnimations(Scene *scene) {
         FfxSceneActionStop stop = animation->stop;
 
         bool done = true;
+        animation->apply = false;
 
         // Make sure we cast this to a signed value or the below "common"
         // type for the comparison will be unsigned. Since startTime can
@@ -223,7 +558,8 @@ static void updateAnimations(Scene *scene) {
             // Still running, but is in the delay
             done = false;
 
-        } else if (animation->actions && stop != FfxSceneActionStopCurrent) {
+        } else if ((animation->actions || animation->typedCount) &&
+          stop != FfxSceneActionStopCurrent) {
             done = false;
 
             int32_t n = now - animation->info.delay;
@@ -241,6 +577,18 @@ static void updateAnimations(Scene *scene) {
 
             t = animation->info.curve(t);
 
+            // Typed actions are applied from the action arrays
+            animation->t = t;
+            animation->apply = true;
+            animation->complete = done;
+
+            // The typed actions of this and every older animation go
+            // first, so a newer animation's Actions (custom, or typed
+            // past MAX_TYPED_ACTIONS) still win over them
+            if (animation->actions) {
+                applyActions(scene, true, animation->order);
+            }
+
             Action *action = animation->actions;
             while (action) {
                 //printf("action: %p\n", action);
@@ -250,6 +598,8 @@ static void updateAnimations(Scene *scene) {
         }
 
         if (done || stop) {
+            animation->complete = true;
+
             if (prevAnimation == NULL) {
                 scene->animationHead = nextAnimation;
             } else {
@@ -276,6 +626,9 @@ static void updateAnimations(Scene *scene) {
     if (prevAnimation == NULL) { scene->animationHead = NULL; }
     scene->animationTail = prevAnimation;
 
+    // The typed actions of the animations after the last with Actions
+    applyActions(scene, false, 0);
+
     // Clean up complete animations
     animation = completeHead;
     while (animation) {
@@ -289,22 +642,14 @@ static void updateAnimations(Scene *scene) {
                 scene->dispatchFunc(animation->dispatchArg,
                   animation->info.onComplete, animation->node, stop,
                   animation->info.arg, scene->initArg);
+                animation->dispatchArg = NULL;
             } else {
                 animation->info.onComplete(animation->node, stop,
                   animation->info.arg);
             }
         }
 
-        // Remove the actions
-        Action *action = animation->actions;
-        while (action) {
-            Action *nextAction = action->nextAction;
-            ffx_scene_memFree(scene, action);
-            action = nextAction;
-        }
-
-        // Free the animation
-        ffx_scene_memFree(scene, animation);
+        ffx_scene_freeAnimation(scene, animation);
 
         animation = nextAnimation;
     }
@@ -315,23 +660,30 @@ void ffx_scene_sequence(FfxScene _scene) {
 
     scene->stats.seqCount++;
 
-    // Update all animations
+    // Pick up queued animations, then apply any committed batches so
+    // their mutations land together, before anything is stepped
+    dequeueAnimations(scene);
+    ffx_scene_applyBatches(scene);
+    ffx_scene_attachTracks(scene);
+
+    // Update all animations, then keyframe tracks
     updateAnimations(scene);
+    ffx_scene_updateTracks(scene);
 
     // Delete the last render data
-    if (scene->renderHead) {
-        Render *render = scene->renderHead;
-        scene->renderHead = scene->renderTail = NULL;
-
-        while (render) {
-            Render *nextRender = render->nextRender;
-            ffx_scene_memFree(scene, render);
-            render = nextRender;
-        }
-    }
+    freeRenders(scene);
+
+    // Return the slabs emptied by nodes freed since the last sequence
+    ffx_scene_poolTrim(scene);
+
+    // Nothing reads the resident images now, so registrations and the
+    // budget can be applied
+    ffx_scene_attachImages(scene);
 
     scene->tick = xTaskGetTickCount();
 
+    if (scene->trace) { ffx_scene_traceFrame(scene); }
+
     // Sequence all the nodes
     ffx_sceneNode_sequence(scene->root, ffx_point(0, 0));
 }
@@ -363,7 +715,9 @@ void* ffx_scene_createRender(FfxNode _node, size_t stateSize) {
         scene->renderTail = render;
     }
 
-    render->renderFunc = node->vtable->renderFunc;
+    render->renderFunc = ffx_sceneNode_getVTable(node)->renderFunc;
+
+    if (scene->trace) { ffx_scene_traceNode(scene, node); }
 
     return &render[1];
 }
@@ -374,6 +728,8 @@ void ffx_scene_render(FfxScene _scene, uint16_t *fragment, FfxPoint origin,
 
     Scene *scene = _scene;
 
+    scene->layerDepth = 0;
+
     Render *render = scene->renderHead;
     while (render) {
         render->renderFunc(&render[1], fragment, origin, size);
@@ -381,6 +737,49 @@ void ffx_scene_render(FfxScene _scene, uint16_t *fragment, FfxPoint origin,
     }
 }
 
+uint16_t* ffx_scene_pushLayer(Scene *scene, const uint16_t *fragment,
+  FfxSize size) {
+
+    // Layers beyond the maximum depth are still counted, so each pop
+    // matches its push, but are drawn without compositing
+    int depth = scene->layerDepth++;
+    if (depth >= MAX_LAYER_DEPTH) { return NULL; }
+
+    size_t length = size.width * size.height;
+
+    // The fragment grew; drop the buffers that are now too small
+    if (length > scene->layerLength) {
+        for (int i = 0; i < MAX_LAYER_DEPTH; i++) {
+            if (scene->layers[i] == NULL) { continue; }
+            scene->freeFunc((void*)scene->layers[i], scene->initArg);
+            scene->layers[i] = NULL;
+        }
+        scene->layerLength = length;
+    }
+
+    uint16_t *layer = scene->layers[depth];
+    if (layer == NULL) {
+        layer = (void*)scene->allocFunc(scene->layerLength * sizeof(uint16_t),
+          scene->initArg);
+        if (layer == NULL) {
+            printf("failed to allocate layer: depth=%d\n", depth);
+            return NULL;
+        }
+        scene->layers[depth] = layer;
+    }
+
+    memcpy(layer, fragment, length * sizeof(uint16_t));
+
+    return layer;
+}
+
+uint16_t* ffx_scene_popLayer(Scene *scene) {
+    if (scene->layerDepth == 0) { return NULL; }
+    int depth = --scene->layerDepth;
+    if (depth >= MAX_LAYER_DEPTH) { return NULL; }
+    return scene->layers[depth];
+}
+
 
 //////////////////////////
 // Debugging
@@ -402,6 +801,12 @@ void ffx_scene_dumpStats(FfxScene _scene) {
       scene->stats.totalRenderSize / scene->stats.seqCount
       );
 
+    FfxImageCacheStats *images = &scene->imageStats;
+    printf("  Image Cache: hits=%ld misses=%ld loads=%ld evictions=%ld "
+      "used=%ld/%ld resident=%ld/%ld\n", images->hits, images->misses,
+      images->loads, images->evictions, images->used, images->budget,
+      images->resident, images->registered);
+
     scene->stats.seqCount = 0;;
 
     scene->stats.renderCount = 0;;
@@ -5,13 +5,16 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <stdatomic.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "firefly-scene-private.h"
 
 
-#define MAX_ANIMATION_BACKLOG (32)
+// The maximum number of nested group layers composited at once
+#define MAX_LAYER_DEPTH       (4)
 
 #define STOP_ADVANCE          (0xff01)
 #define STOP_FREE             (0xff02)
@@ -23,9 +26,6 @@ struct Scene;
 typedef enum NodeFlag {
     NodeFlagNone           = 0,
 
-    // Node has a parent and cannot be added elsewhere
-    NodeFlagHasParent      = (1 << 0),
-
     // Node should be removed from the scene graph on the next sequence
     NodeFlagRemove         = (1 << 3),
 
@@ -34,14 +34,65 @@ typedef enum NodeFlag {
 //    NodeFlagCapturing       = (1 << 8),
     NodeFlagHidden         = (1 << 4),
 
+    // Node was carved from a blob arena, which is owned (and freed) by
+    // the blob root
+    NodeFlagArena          = (1 << 5),
+
+    // Node was carved from a node pool, with its pool and slot kept in
+    // the node slot (see: pool.c)
+    NodeFlagPool           = (1 << 6),
+
 } NodeFlag;
 
+// A node slot holds its pool index in the upper bits and its slot
+// index within that pool in the lower NODE_SLOT_BITS
+#define NODE_SLOT_BITS        (13)
+#define NODE_SLOT(p,i)        (((p) << NODE_SLOT_BITS) | (i))
+#define NODE_SLOT_POOL(s)     ((s) >> NODE_SLOT_BITS)
+#define NODE_SLOT_INDEX(s)    ((s) & ((1 << NODE_SLOT_BITS) - 1))
+
 
 NodeFlag ffx_sceneNode_hasFlags(FfxNode node, NodeFlag flags);
 void ffx_sceneNode_setFlags(FfxNode node, NodeFlag flags);
 void ffx_sceneNode_clearFlags(FfxNode node, NodeFlag flags);
 
 
+// The built-in property actions, which are stored in their animation
+// and moved into the scene's per-type ActionArray once it starts
+typedef enum ActionType {
+    ActionTypePoint = 0,
+    ActionTypeSize,
+    ActionTypeColor,
+    ActionTypeFixed,
+} ActionType;
+
+#define TYPED_ACTION_COUNT    (4)
+
+// The typed actions stored in an animation; any more are allocated as
+// an Action which runs through its actionFunc instead
+#define MAX_TYPED_ACTIONS     (4)
+
+typedef union ActionValue {
+    FfxPoint point;
+    FfxSize size;
+    color_ffxt color;
+    fixed_ffxt fixed;
+} ActionValue;
+
+typedef union ActionSetFunc {
+    FfxNodeActionSetPointFunc point;
+    FfxNodeActionSetSizeFunc size;
+    FfxNodeActionSetColorFunc color;
+    FfxNodeActionSetFixedFunc fixed;
+} ActionSetFunc;
+
+typedef struct TypedAction {
+    ActionType type;
+    ActionValue v0;
+    ActionValue v1;
+    ActionSetFunc setFunc;
+} TypedAction;
+
 typedef struct Action {
     struct Action *nextAction;
     FfxNodeActionFunc actionFunc;
@@ -53,11 +104,185 @@ typedef struct Animation {
     void *dispatchArg;
     Action *actions;
     struct Node *node;
+
+    // The curved time for this sequence, whether it is applied and
+    // whether the animation is complete; read by the ActionArrays, so
+    // kept beside the node
+    fixed_ffxt t;
+    bool apply;
+    bool complete;
+
     int32_t startTime;
     uint32_t stop;
     FfxNodeAnimation info;
+
+    // The order the animation started in, so its typed actions can be
+    // applied in step with the Actions of the other animations
+    uint32_t order;
+
+    size_t typedCount;
+    TypedAction typedActions[MAX_TYPED_ACTIONS];
 } Animation;
 
+// The running actions of one type, as parallel arrays sharing a single
+// allocation (see: scene.c)
+typedef struct ActionArray {
+    size_t count;
+    size_t capacity;
+
+    // The next entry to apply and the entries kept, while sequencing
+    size_t next;
+    size_t kept;
+
+    Animation **animations;
+    ActionSetFunc *setFuncs;
+    ActionValue *v0;
+    ActionValue *v1;
+} ActionArray;
+
+
+typedef enum CommandType {
+    CommandTypeSetPosition = 1,
+    CommandTypeSetColor,
+    CommandTypeSetText,
+    CommandTypeAppendChild,
+    CommandTypeRemove,
+    CommandTypeAnimate,
+    CommandTypeStop,
+    CommandTypeInsertBefore,
+    CommandTypeDetach,
+} CommandType;
+
+typedef struct Command {
+    struct Command *nextCommand;
+    CommandType type;
+    struct Node *node;
+    union {
+        FfxPoint position;
+        color_ffxt color;
+        struct Node *child;
+        struct {
+            struct Node *child;
+            struct Node *sibling;
+        } insert;
+        Animation *animation;
+        uint32_t stop;
+    } value;
+    // Command payload here (e.g. text)
+} Command;
+
+typedef struct Batch {
+    struct Scene *scene;
+
+    // The most recent command recorded, which links back to the oldest
+    Command *head;
+    Command *tail;
+
+    // A command could not be recorded; the batch is dropped on commit
+    bool failed;
+} Batch;
+
+
+// A single allocation that nodes are carved from (see: blob.c)
+typedef struct Arena {
+    uint8_t *data;
+    size_t offset;
+    size_t size;
+} Arena;
+
+
+// The most nested group layers a trace records
+#define MAX_TRACE_LAYERS      (16)
+
+// Records each frame's render list (see: trace.c)
+typedef struct Trace {
+    uint8_t *data;
+    size_t offset;
+    size_t length;
+
+    // Offset of the current frame's record count
+    size_t frameOffset;
+    uint16_t recordCount;
+
+    // Set once a record did not fit; nothing further is recorded
+    bool full;
+
+    // The world position of the node being sequenced
+    FfxPoint worldPos;
+
+    // The groups whose layers are open in the current frame
+    struct Node *layers[MAX_TRACE_LAYERS];
+    size_t layerDepth;
+} Trace;
+
+
+// A keyframe track, with the index of the keyframe it last evaluated
+typedef struct Track {
+    FfxTrack info;
+    size_t cursor;
+} Track;
+
+// Every track on a node, followed by a copy of their keyframes, in a
+// single allocation (see: tracks.c)
+typedef struct Tracks {
+    struct Tracks *nextTracks;
+    struct Node *node;
+    int32_t startTime;
+
+    // The time of the latest keyframe across all tracks
+    uint32_t period;
+    FfxTrackMode mode;
+
+    size_t count;
+    Track tracks[];
+} Tracks;
+
+
+// An image registered for residency in RAM (see: image-cache.c)
+typedef struct ImageEntry {
+    struct ImageEntry *nextEntry;
+    const uint16_t *data;
+    size_t length;
+
+    // Higher priority images are kept over lower ones
+    uint8_t priority;
+
+    // Set on a pending entry to unregister its image
+    bool remove;
+
+    // The resident copy (may be null)
+    uint16_t *copy;
+
+    // The number of renders from the current sequence reading the copy,
+    // which cannot be evicted until they are freed
+    uint16_t refs;
+} ImageEntry;
+
+
+// The most distinct node sizes pooled; nodes of any other size, or
+// larger than MAX_POOL_NODE_SIZE, are allocated individually
+#define MAX_NODE_POOLS        (8)
+#define MAX_POOL_NODE_SIZE    (128)
+
+// Nodes are carved from slabs of POOL_SLAB_SLOTS, one bit of a slab's
+// free mask per slot, so the slot index of a node fits NODE_SLOT_BITS
+#define POOL_SLAB_SLOTS       (32)
+#define MAX_POOL_SLABS        (32)
+
+// Equal-sized nodes, packed into slabs. Each slab has a mask of its free
+// slots, so a slot is claimed or freed by a single atomic op, and a slab
+// whose slots are all free can be returned to the heap by the sequence,
+// keeping one spare (see: pool.c)
+typedef struct NodePool {
+    _Atomic(uint32_t) size;
+
+    // The most slabs ever held at once; slabs past it are never scanned
+    _Atomic(uint32_t) slabCount;
+
+    _Atomic(uint32_t) freeMasks[MAX_POOL_SLABS];
+    _Atomic(uint8_t*) slabs[MAX_POOL_SLABS];
+} NodePool;
+
 
 typedef struct Render {
     struct Render *nextRender;
@@ -66,16 +291,27 @@ typedef struct Render {
 } Render;
 
 
+// The most distinct node types; each is registered the first time a
+// node of it is created (see: node.c)
+#define MAX_NODE_TYPES        (32)
+
 typedef struct Node {
-    const FfxNodeVTable* vtable;
+    // The index of the node vtable, so each node stores a byte rather
+    // than a pointer, and its NodeFlag
+    uint8_t type;
+    uint8_t flags;
+
+    // The NODE_SLOT of a NodeFlagPool node
+    uint16_t slot;
 
-    struct Scene *scene;
     FfxPoint position;
-    uint32_t flags;
-    FfxNode nextSibling;
+    struct Scene *scene;
 
-    // The current animation being populated with actions
-    Animation *pendingAnimation;
+    // The parent (NULL if detached) and the neighbouring children of
+    // the parent, so a node can be unlinked without a search
+    struct Node *parent;
+    struct Node *prevSibling;
+    struct Node *nextSibling;
 
     // Node State here
 } Node;
@@ -121,14 +357,60 @@ typedef struct Scene {
     Render *renderHead;
     Render *renderTail;
 
+    // The saved fragment behind each open group layer; allocated on
+    // first use and reused for every fragment after
+    // Guarded by renderLock
+    uint16_t *layers[MAX_LAYER_DEPTH];
+    size_t layerLength;
+    int layerDepth;
+
     // The head and tail of the animation list (may be null)
     // Guarded by animationLock
     Animation *animationHead;
     Animation *animationTail;
 
-    StaticQueue_t animQueueBuffer;
-    uint8_t animQueueStorageBuffer[MAX_ANIMATION_BACKLOG * sizeof(Animation*)];
-    QueueHandle_t animQueue;
+    // Animations, stops and advances requested by any task, most recent
+    // first and linked by nextAnimation, which are started by the next
+    // ffx_scene_sequence
+    _Atomic(Animation*) pendingAnimations;
+
+    // The typed actions of the running animations, by ActionType, in
+    // the order the animations started
+    // Guarded by animationLock
+    ActionArray actionArrays[TYPED_ACTION_COUNT];
+    uint32_t animationOrder;
+
+    // The playing keyframe tracks (may be null)
+    Tracks *tracksHead;
+
+    // Tracks set by any task, most recent first, which are attached by
+    // the next ffx_scene_sequence
+    _Atomic(Tracks*) pendingTracks;
+
+    // The stack of committed batch commands, most recent first. Pushed
+    // to lock-free by any task, and swapped out by ffx_scene_sequence
+    _Atomic(Command*) commands;
+
+    // The registered images, most recently drawn first; only touched
+    // while sequencing
+    ImageEntry *imageHead;
+    FfxImageCacheStats imageStats;
+
+    // Images registered or unregistered by any task, most recent first,
+    // which are attached by the next ffx_scene_sequence
+    _Atomic(ImageEntry*) pendingImages;
+    _Atomic(uint32_t) imageBudget;
+
+    // Nodes, by size (see: pool.c)
+    NodePool nodePools[MAX_NODE_POOLS];
+
+    // The depth of nested ffx_sceneNode_free calls; only the outermost
+    // releases references to the subtree
+    uint32_t freeDepth;
+
+    // The active trace recorder (may be null)
+    Trace *trace;
+
 
     StaticSemaphore_t renderLockData;
     SemaphoreHandle_t renderLock;
@@ -139,6 +421,61 @@ typedef struct Scene {
 void renderLock(Scene *scene);
 void renderUnlock(Scene *scene);
 
+Animation* ffx_sceneNode_captureAnimation(FfxNode node,
+  FfxNodeAnimationSetupFunc setupFunc, void *arg);
+
+// Free an animation and its actions, handing any setupFunc result which
+// was never dispatched back to the dispatchFunc
+void ffx_scene_freeAnimation(Scene *scene, Animation *animation);
+
+void ffx_scene_appendAnimation(Scene *scene, Animation *animation);
+void ffx_scene_stopAnimations(Scene *scene, Node *node, uint32_t stop);
+
+// Clear every animation, track and batch command reference to a node
+// marked NodeFlagRemove, before those nodes are freed
+void ffx_scene_releaseNodes(Scene *scene);
+
+void ffx_scene_applyBatches(Scene *scene);
+
+void ffx_scene_attachTracks(Scene *scene);
+void ffx_scene_updateTracks(Scene *scene);
+
+// Must only be called once the previous renders are freed, as it may
+// evict copies they read from
+void ffx_scene_attachImages(Scene *scene);
+void ffx_scene_freeImages(Scene *scene);
+
+// Open a layer over %%fragment%%, returning a copy of its contents to
+// composite against when closed (NULL if no buffer is available)
+uint16_t* ffx_scene_pushLayer(Scene *scene, const uint16_t *fragment,
+  FfxSize size);
+
+// Close the innermost layer, returning its saved fragment (may be NULL)
+uint16_t* ffx_scene_popLayer(Scene *scene);
+
+// The vtable of %%node%%, looked up by its type
+const FfxNodeVTable* ffx_sceneNode_getVTable(Node *node);
+
+void ffx_scene_traceFrame(Scene *scene);
+void ffx_scene_traceNode(Scene *scene, Node *node);
+
+// While set, nodes created on the calling task are carved from %%arena%%
+void ffx_scene_setArena(Arena *arena);
+
+// Allocate a zeroed node of %%size%% from the scene node pools, returning
+// NULL if the size is not pooled or the pool is full
+Node* ffx_scene_poolAlloc(Scene *scene, size_t size);
+
+// Return a node from ffx_scene_poolAlloc to its pool
+void ffx_scene_poolFree(Scene *scene, Node *node);
+
+// Return every slab with no nodes to the heap, keeping one spare per
+// pool; only called by the sequence
+void ffx_scene_poolTrim(Scene *scene);
+
+// Free every pool slab
+void ffx_scene_poolDestroy(Scene *scene);
+
 
 
 
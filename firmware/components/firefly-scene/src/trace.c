@@ -0,0 +1,959 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+// Trace format (multi-byte values are big-endian):
+//   - Header: version (0x01), format (0x54), reserved (u16)
+//   - Frames, each: tick (u32), recordCount (u16)
+//   - Records, in render order, each: kind (u8), x (i16), y (i16) of
+//     the node in world coordinates, followed by its payload (see:
+//     ffx_scene_traceNode)
+//
+// Nodes are recorded (rather than raw render state) so a trace is
+// portable; replaying a frame re-creates each node and sequences it,
+// which produces the same render list on any target.
+//
+// Nodes which draw external data (images, sprites, flipbooks and tile
+// maps) record its address, as a ref (u64) identifying repeated uses,
+// and its leading words (its format and dimensions); the data itself
+// is supplied by the replay.
+
+#define VERSION_TAG        (0x01)
+#define FORMAT_TRACE       (0x54)
+
+#define FRAME_SIZE         (6)
+
+// The leading words of node data which are recorded
+#define IMAGE_HEADER       (3)
+#define FLIPBOOK_HEADER    (4)
+#define TILEMAP_HEADER     (6)
+#define MAX_HEADER         (6)
+
+typedef enum TraceKind {
+    TraceKindFill      = 1,
+    TraceKindBox       = 2,
+    TraceKindLabel     = 3,
+    TraceKindImage     = 4,
+    TraceKindQR        = 5,
+    TraceKindSprite    = 6,
+    TraceKindFlipbook  = 7,
+    TraceKindTileMap   = 8,
+    TraceKindGradient  = 9,
+    TraceKindShape     = 10,
+    TraceKindParagraph = 11,
+    TraceKindParticles = 12,
+    TraceKindChart     = 13,
+
+    // A group drawn through a layer brackets the records of the
+    // children composited into it
+    TraceKindPushLayer = 14,
+    TraceKindPopLayer  = 15,
+
+    // Recorded by name only; cannot be replayed
+    TraceKindOther     = 0xff,
+} TraceKind;
+
+
+//////////////////////////
+// Recording
+
+static void writeValue(Trace *trace, uint32_t value, size_t width) {
+    if (trace->offset + width > trace->length) {
+        trace->full = true;
+        return;
+    }
+
+    for (int i = width - 1; i >= 0; i--) {
+        trace->data[trace->offset++] = value >> (8 * i);
+    }
+}
+
+static void writePoint(Trace *trace, FfxPoint point) {
+    writeValue(trace, (uint16_t)point.x, 2);
+    writeValue(trace, (uint16_t)point.y, 2);
+}
+
+static void writeSize(Trace *trace, FfxSize size) {
+    writeValue(trace, size.width, 2);
+    writeValue(trace, size.height, 2);
+}
+
+static void writeString(Trace *trace, const char *text) {
+    size_t length = strlen(text);
+    if (length > 255) { length = 255; }
+
+    writeValue(trace, length, 1);
+    if (trace->offset + length > trace->length) {
+        trace->full = true;
+        return;
+    }
+
+    memcpy(&trace->data[trace->offset], text, length);
+    trace->offset += length;
+}
+
+// The address of %%data%% (at full width) and its first %%count%% words
+static void writeData(Trace *trace, const uint16_t *data, size_t count) {
+    uint64_t ref = (uintptr_t)data;
+    writeValue(trace, ref >> 32, 4);
+    writeValue(trace, ref & 0xffffffff, 4);
+
+    for (int i = 0; i < count; i++) { writeValue(trace, data[i], 2); }
+}
+
+// Paragraph text is copied straight into the trace, as it may be long
+static void writeParagraphText(Trace *trace, FfxNode node) {
+    size_t length = ffx_sceneParagraph_getTextLength(node);
+    if (length > 0xffff) { length = 0xffff; }
+
+    writeValue(trace, length, 2);
+
+    // The copy is null-terminated, which the next value overwrites
+    if (trace->offset + length + 1 > trace->length) {
+        trace->full = true;
+        return;
+    }
+
+    trace->offset += ffx_sceneParagraph_copyText(node,
+      (char*)&trace->data[trace->offset], length + 1);
+}
+
+void ffx_scene_startTrace(FfxScene _scene, uint8_t *buffer, size_t length) {
+    Scene *scene = _scene;
+
+    if (scene->trace) { ffx_scene_stopTrace(scene); }
+
+    Trace *trace = ffx_scene_memAlloc(scene, sizeof(Trace));
+    if (trace == NULL) { return; }
+
+    trace->data = buffer;
+    trace->length = length;
+
+    writeValue(trace, VERSION_TAG, 1);
+    writeValue(trace, FORMAT_TRACE, 1);
+    writeValue(trace, 0, 2);
+
+    scene->trace = trace;
+}
+
+size_t ffx_scene_stopTrace(FfxScene _scene) {
+    Scene *scene = _scene;
+
+    Trace *trace = scene->trace;
+    if (trace == NULL) { return 0; }
+
+    scene->trace = NULL;
+
+    size_t length = trace->offset;
+    ffx_scene_memFree(scene, trace);
+
+    return length;
+}
+
+void ffx_scene_traceFrame(Scene *scene) {
+    Trace *trace = scene->trace;
+    if (trace->full) { return; }
+
+    size_t offset = trace->offset;
+
+    writeValue(trace, scene->tick, 4);
+    writeValue(trace, 0, 2);
+
+    if (trace->full) {
+        trace->offset = offset;
+        return;
+    }
+
+    trace->frameOffset = offset + 4;
+    trace->recordCount = 0;
+    trace->layerDepth = 0;
+}
+
+static TraceKind getKind(Trace *trace, Node *node) {
+    if (ffx_scene_isFill(node)) { return TraceKindFill; }
+    if (ffx_scene_isBox(node)) { return TraceKindBox; }
+    if (ffx_scene_isLabel(node)) { return TraceKindLabel; }
+    if (ffx_scene_isImage(node)) { return TraceKindImage; }
+    if (ffx_scene_isQR(node)) { return TraceKindQR; }
+    if (ffx_scene_isSprite(node)) { return TraceKindSprite; }
+    if (ffx_scene_isFlipbook(node)) { return TraceKindFlipbook; }
+    if (ffx_scene_isTileMap(node)) { return TraceKindTileMap; }
+    if (ffx_scene_isGradient(node)) { return TraceKindGradient; }
+    if (ffx_scene_isShape(node)) { return TraceKindShape; }
+    if (ffx_scene_isParagraph(node)) { return TraceKindParagraph; }
+    if (ffx_scene_isParticles(node)) { return TraceKindParticles; }
+    if (ffx_scene_isChart(node)) { return TraceKindChart; }
+
+    // A group only renders to open and close its layer, and layers nest,
+    // so it closes the layer if it opened the innermost one
+    if (ffx_scene_isGroup(node)) {
+        size_t depth = trace->layerDepth;
+        if (depth && trace->layers[depth - 1] == node) {
+            trace->layerDepth--;
+            return TraceKindPopLayer;
+        }
+
+        if (depth == MAX_TRACE_LAYERS) {
+            printf("trace: too many nested layers\n");
+            trace->full = true;
+            return TraceKindOther;
+        }
+
+        trace->layers[trace->layerDepth++] = node;
+        return TraceKindPushLayer;
+    }
+
+    return TraceKindOther;
+}
+
+void ffx_scene_traceNode(Scene *scene, Node *node) {
+    Trace *trace = scene->trace;
+    if (trace->full || trace->recordCount == 0xffff) { return; }
+
+    size_t offset = trace->offset;
+
+    FfxPoint pos = node->position;
+    pos.x += trace->worldPos.x;
+    pos.y += trace->worldPos.y;
+
+    TraceKind kind = getKind(trace, node);
+
+    writeValue(trace, kind, 1);
+    writePoint(trace, pos);
+
+    switch (kind) {
+        case TraceKindFill:
+            writeValue(trace, ffx_sceneFill_getColor(node), 4);
+            break;
+
+        case TraceKindBox:
+            writeSize(trace, ffx_sceneBox_getSize(node));
+            writeValue(trace, ffx_sceneBox_getColor(node), 4);
+            break;
+
+        case TraceKindLabel: {
+            char text[256];
+            ffx_sceneLabel_copyText(node, text, sizeof(text));
+            text[sizeof(text) - 1] = 0;
+
+            writeValue(trace, ffx_sceneLabel_getFont(node), 1);
+            writeValue(trace, ffx_sceneLabel_getAlign(node), 1);
+            writeValue(trace, ffx_sceneLabel_getTextColor(node), 4);
+            writeValue(trace, ffx_sceneLabel_getOutlineColor(node), 4);
+            writeString(trace, text);
+            break;
+        }
+
+        case TraceKindImage:
+            writeData(trace, ffx_sceneImage_getData(node), IMAGE_HEADER);
+            writeValue(trace, ffx_sceneImage_getTint(node), 4);
+            break;
+
+        case TraceKindQR:
+            writeValue(trace, ffx_sceneQR_getVersion(node), 1);
+            writeValue(trace, ffx_sceneQR_getModuleSize(node), 1);
+            writeValue(trace, ffx_sceneQR_getQuietZone(node), 1);
+            writeValue(trace, ffx_sceneQR_getForegroundColor(node), 4);
+            writeValue(trace, ffx_sceneQR_getBackgroundColor(node), 4);
+            break;
+
+        case TraceKindSprite:
+            writeData(trace, ffx_sceneSprite_getData(node), IMAGE_HEADER);
+            writeValue(trace, ffx_sceneSprite_getScale(node), 4);
+            writeValue(trace, ffx_sceneSprite_getAngle(node), 4);
+            writeValue(trace, ffx_sceneSprite_getSampling(node), 1);
+            break;
+
+        case TraceKindFlipbook:
+            writeData(trace, ffx_sceneFlipbook_getData(node),
+              FLIPBOOK_HEADER);
+            writeValue(trace, ffx_sceneFlipbook_getFrame(node), 2);
+            break;
+
+        case TraceKindTileMap:
+            writeData(trace, ffx_sceneTileMap_getData(node),
+              TILEMAP_HEADER);
+            writeSize(trace, ffx_sceneTileMap_getSize(node));
+            writePoint(trace, ffx_sceneTileMap_getScroll(node));
+            writeValue(trace, ffx_sceneTileMap_getWrap(node), 1);
+            break;
+
+        case TraceKindGradient: {
+            color_ffxt colors[FFX_GRADIENT_MAX_COLORS];
+            size_t count = ffx_sceneGradient_getColors(node, colors,
+              FFX_GRADIENT_MAX_COLORS);
+
+            writeValue(trace, ffx_sceneGradient_getType(node), 1);
+            writeSize(trace, ffx_sceneGradient_getSize(node));
+            writePoint(trace, ffx_sceneGradient_getStart(node));
+            writePoint(trace, ffx_sceneGradient_getEnd(node));
+            writeValue(trace, ffx_sceneGradient_getDither(node), 1);
+            writeValue(trace, count, 1);
+            for (int i = 0; i < count; i++) {
+                writeValue(trace, colors[i], 4);
+            }
+            break;
+        }
+
+        case TraceKindShape:
+            writeValue(trace, ffx_sceneShape_getType(node), 1);
+            writeSize(trace, ffx_sceneShape_getSize(node));
+            writePoint(trace, ffx_sceneShape_getEnd(node));
+            writeValue(trace, ffx_sceneShape_getFillColor(node), 4);
+            writeValue(trace, ffx_sceneShape_getStrokeColor(node), 4);
+            writeValue(trace, ffx_sceneShape_getStrokeWidth(node), 2);
+            writeValue(trace, ffx_sceneShape_getCornerRadius(node), 2);
+            writeValue(trace, ffx_sceneShape_getStartAngle(node), 4);
+            writeValue(trace, ffx_sceneShape_getEndAngle(node), 4);
+            break;
+
+        case TraceKindParagraph:
+            writeValue(trace, ffx_sceneParagraph_getFont(node), 1);
+            writeValue(trace, ffx_sceneParagraph_getAlign(node), 1);
+            writeValue(trace, ffx_sceneParagraph_getWrap(node), 1);
+            writeSize(trace, ffx_sceneParagraph_getSize(node));
+            writeValue(trace, ffx_sceneParagraph_getTextColor(node), 4);
+            writeValue(trace, ffx_sceneParagraph_getOutlineColor(node), 4);
+            writeParagraphText(trace, node);
+            break;
+
+        case TraceKindParticles: {
+            // The particles themselves are not recorded, only how many
+            // are live and how they are drawn
+            FfxParticleEmitter emitter;
+            ffx_sceneParticles_getEmitter(node, &emitter);
+            const uint16_t *sprite = ffx_sceneParticles_getSprite(node);
+
+            writeValue(trace, ffx_sceneParticles_getCount(node), 2);
+            writeValue(trace, emitter.life, 2);
+            writeSize(trace, emitter.area);
+            writePoint(trace, emitter.velocity);
+            writePoint(trace, emitter.velocityJitter);
+            writePoint(trace, emitter.gravity);
+            writeValue(trace, emitter.startColor, 4);
+            writeValue(trace, emitter.endColor, 4);
+            writeValue(trace, emitter.pointSize, 1);
+            writeValue(trace, sprite != NULL, 1);
+            if (sprite) { writeData(trace, sprite, IMAGE_HEADER); }
+            break;
+        }
+
+        case TraceKindChart: {
+            // Only the range of the samples is recorded
+            int32_t min = 0, max = 0;
+            ffx_sceneChart_getRange(node, &min, &max);
+
+            writeSize(trace, ffx_sceneChart_getSize(node));
+            writeValue(trace, ffx_sceneChart_getStyle(node), 1);
+            writeValue(trace, ffx_sceneChart_getColor(node), 4);
+            writeValue(trace, ffx_sceneChart_getCount(node), 2);
+            writeValue(trace, min, 4);
+            writeValue(trace, max, 4);
+            break;
+        }
+
+        case TraceKindPushLayer:
+            writeValue(trace, ffx_sceneGroup_getOpacity(node), 1);
+            break;
+
+        case TraceKindPopLayer:
+            break;
+
+        case TraceKindOther:
+            writeString(trace, ffx_sceneNode_getName(node));
+            break;
+    }
+
+    // Drop a partial record; the trace ends with the last complete one
+    if (trace->full) {
+        trace->offset = offset;
+        return;
+    }
+
+    trace->recordCount++;
+    trace->data[trace->frameOffset] = trace->recordCount >> 8;
+    trace->data[trace->frameOffset + 1] = trace->recordCount & 0xff;
+}
+
+void ffx_scene_dumpTrace(const uint8_t *trace, size_t length) {
+    printf("<Trace length=%zu>\n", length);
+    for (size_t i = 0; i < length; i++) {
+        if ((i % 32) == 0) { printf("  "); }
+        printf("%02x", trace[i]);
+        if ((i % 32) == 31 || i == length - 1) { printf("\n"); }
+    }
+    printf("</Trace>\n");
+}
+
+
+//////////////////////////
+// Replay
+
+typedef struct Reader {
+    const uint8_t *data;
+    size_t offset;
+    size_t length;
+    bool error;
+} Reader;
+
+// A record as read from a trace, before its node is created
+typedef struct Record {
+    TraceKind kind;
+    FfxPoint position;
+
+    // The node data, by ref and its leading words
+    uint64_t ref;
+    uint16_t header[MAX_HEADER];
+    size_t headerLength;
+
+    // Label and paragraph text, within the trace (not null-terminated)
+    const char *text;
+    size_t textLength;
+
+    union {
+        color_ffxt color;
+        struct {
+            FfxSize size;
+            color_ffxt color;
+        } box;
+        struct {
+            FfxFont font;
+            FfxTextAlign align;
+            color_ffxt textColor, outlineColor;
+        } label;
+        struct {
+            uint8_t version, moduleSize, quietZone;
+            color_ffxt fg, bg;
+        } qr;
+        struct {
+            fixed_ffxt scale, angle;
+            FfxSpriteSampling sampling;
+        } sprite;
+        size_t frame;
+        struct {
+            FfxSize size;
+            FfxPoint scroll;
+            bool wrap;
+        } tileMap;
+        struct {
+            FfxGradientType type;
+            FfxSize size;
+            FfxPoint start, end;
+            bool dither;
+            size_t count;
+            color_ffxt colors[FFX_GRADIENT_MAX_COLORS];
+        } gradient;
+        struct {
+            FfxShapeType type;
+            FfxSize size;
+            FfxPoint end;
+            color_ffxt fill, stroke;
+            uint16_t strokeWidth, cornerRadius;
+            fixed_ffxt startAngle, endAngle;
+        } shape;
+        struct {
+            FfxFont font;
+            FfxTextAlign align;
+            FfxTextWrap wrap;
+            FfxSize size;
+            color_ffxt textColor, outlineColor;
+        } paragraph;
+        struct {
+            size_t count;
+            FfxParticleEmitter emitter;
+            bool sprite;
+        } particles;
+        struct {
+            FfxSize size;
+            FfxChartStyle style;
+            color_ffxt color;
+            size_t count;
+            int32_t min, max;
+        } chart;
+        uint8_t opacity;
+    } value;
+} Record;
+
+static uint32_t readValue(Reader *reader, size_t width) {
+    if (reader->offset + width > reader->length) {
+        reader->error = true;
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (int i = 0; i < width; i++) {
+        value = (value << 8) | reader->data[reader->offset++];
+    }
+
+    return value;
+}
+
+static FfxPoint readPoint(Reader *reader) {
+    FfxPoint point = { .x = 0, .y = 0 };
+    point.x = (int16_t)readValue(reader, 2);
+    point.y = (int16_t)readValue(reader, 2);
+    return point;
+}
+
+static FfxSize readSize(Reader *reader) {
+    FfxSize size = { .width = 0, .height = 0 };
+    size.width = readValue(reader, 2);
+    size.height = readValue(reader, 2);
+    return size;
+}
+
+static void readText(Reader *reader, Record *record, size_t width) {
+    size_t length = readValue(reader, width);
+    if (reader->error || reader->offset + length > reader->length) {
+        reader->error = true;
+        return;
+    }
+
+    record->text = (const char*)&reader->data[reader->offset];
+    record->textLength = length;
+    reader->offset += length;
+}
+
+static void readData(Reader *reader, Record *record, size_t count) {
+    record->ref = (uint64_t)readValue(reader, 4) << 32;
+    record->ref |= readValue(reader, 4);
+
+    record->headerLength = count;
+    for (int i = 0; i < count; i++) {
+        record->header[i] = readValue(reader, 2);
+    }
+}
+
+static bool readRecord(Reader *reader, Record *record) {
+    memset(record, 0, sizeof(Record));
+
+    record->kind = readValue(reader, 1);
+    record->position = readPoint(reader);
+
+    switch (record->kind) {
+        case TraceKindFill:
+            record->value.color = readValue(reader, 4);
+            break;
+
+        case TraceKindBox:
+            record->value.box.size = readSize(reader);
+            record->value.box.color = readValue(reader, 4);
+            break;
+
+        case TraceKindLabel:
+            record->value.label.font = readValue(reader, 1);
+            record->value.label.align = readValue(reader, 1);
+            record->value.label.textColor = readValue(reader, 4);
+            record->value.label.outlineColor = readValue(reader, 4);
+            readText(reader, record, 1);
+            break;
+
+        case TraceKindImage:
+            readData(reader, record, IMAGE_HEADER);
+            record->value.color = readValue(reader, 4);
+            break;
+
+        case TraceKindQR:
+            record->value.qr.version = readValue(reader, 1);
+            record->value.qr.moduleSize = readValue(reader, 1);
+            record->value.qr.quietZone = readValue(reader, 1);
+            record->value.qr.fg = readValue(reader, 4);
+            record->value.qr.bg = readValue(reader, 4);
+            break;
+
+        case TraceKindSprite:
+            readData(reader, record, IMAGE_HEADER);
+            record->value.sprite.scale = readValue(reader, 4);
+            record->value.sprite.angle = readValue(reader, 4);
+            record->value.sprite.sampling = readValue(reader, 1);
+            break;
+
+        case TraceKindFlipbook:
+            readData(reader, record, FLIPBOOK_HEADER);
+            record->value.frame = readValue(reader, 2);
+            break;
+
+        case TraceKindTileMap:
+            readData(reader, record, TILEMAP_HEADER);
+            record->value.tileMap.size = readSize(reader);
+            record->value.tileMap.scroll = readPoint(reader);
+            record->value.tileMap.wrap = readValue(reader, 1);
+            break;
+
+        case TraceKindGradient: {
+            record->value.gradient.type = readValue(reader, 1);
+            record->value.gradient.size = readSize(reader);
+            record->value.gradient.start = readPoint(reader);
+            record->value.gradient.end = readPoint(reader);
+            record->value.gradient.dither = readValue(reader, 1);
+
+            size_t count = readValue(reader, 1);
+            if (count > FFX_GRADIENT_MAX_COLORS) { return false; }
+            record->value.gradient.count = count;
+            for (int i = 0; i < count; i++) {
+                record->value.gradient.colors[i] = readValue(reader, 4);
+            }
+            break;
+        }
+
+        case TraceKindShape:
+            record->value.shape.type = readValue(reader, 1);
+            record->value.shape.size = readSize(reader);
+            record->value.shape.end = readPoint(reader);
+            record->value.shape.fill = readValue(reader, 4);
+            record->value.shape.stroke = readValue(reader, 4);
+            record->value.shape.strokeWidth = readValue(reader, 2);
+            record->value.shape.cornerRadius = readValue(reader, 2);
+            record->value.shape.startAngle = readValue(reader, 4);
+            record->value.shape.endAngle = readValue(reader, 4);
+            break;
+
+        case TraceKindParagraph:
+            record->value.paragraph.font = readValue(reader, 1);
+            record->value.paragraph.align = readValue(reader, 1);
+            record->value.paragraph.wrap = readValue(reader, 1);
+            record->value.paragraph.size = readSize(reader);
+            record->value.paragraph.textColor = readValue(reader, 4);
+            record->value.paragraph.outlineColor = readValue(reader, 4);
+            readText(reader, record, 2);
+            break;
+
+        case TraceKindParticles: {
+            FfxParticleEmitter *emitter = &record->value.particles.emitter;
+            record->value.particles.count = readValue(reader, 2);
+            emitter->life = readValue(reader, 2);
+            emitter->area = readSize(reader);
+            emitter->velocity = readPoint(reader);
+            emitter->velocityJitter = readPoint(reader);
+            emitter->gravity = readPoint(reader);
+            emitter->startColor = readValue(reader, 4);
+            emitter->endColor = readValue(reader, 4);
+            emitter->pointSize = readValue(reader, 1);
+            record->value.particles.sprite = readValue(reader, 1);
+            if (record->value.particles.sprite) {
+                readData(reader, record, IMAGE_HEADER);
+            }
+            break;
+        }
+
+        case TraceKindChart:
+            record->value.chart.size = readSize(reader);
+            record->value.chart.style = readValue(reader, 1);
+            record->value.chart.color = readValue(reader, 4);
+            record->value.chart.count = readValue(reader, 2);
+            record->value.chart.min = readValue(reader, 4);
+            record->value.chart.max = readValue(reader, 4);
+            break;
+
+        case TraceKindPushLayer:
+            record->value.opacity = readValue(reader, 1);
+            break;
+
+        case TraceKindPopLayer:
+            break;
+
+        case TraceKindOther:
+            readText(reader, record, 1);
+            break;
+
+        default:
+            return false;
+    }
+
+    return !reader->error;
+}
+
+static const uint16_t* getData(const Record *record, size_t *length,
+  FfxTraceDataFunc dataFunc, void *arg) {
+
+    *length = 0;
+    if (dataFunc == NULL) { return NULL; }
+    return dataFunc(record->ref, record->header, record->headerLength,
+      length, arg);
+}
+
+// A QR Code of the recorded version; the content is not recorded, so it
+// is filled with digits, which only changes the modules drawn
+static FfxNode createQR(Scene *scene, uint8_t version) {
+    if (version < 1 || version > 40) { return NULL; }
+
+    static uint8_t digits[7089];
+    if (digits[0] == 0) { memset(digits, '0', sizeof(digits)); }
+
+    // The smallest length which needs the version
+    size_t lo = 1, hi = sizeof(digits);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        FfxQRMetrics metrics = ffx_scene_getQRMetricsData(digits, mid,
+          FfxQRCorrectionLow);
+        if (metrics.version < version) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    FfxQRMetrics metrics = ffx_scene_getQRMetricsData(digits, lo,
+      FfxQRCorrectionLow);
+    if (metrics.version != version) { return NULL; }
+
+    return ffx_scene_createQRData(scene, digits, lo, FfxQRCorrectionLow);
+}
+
+// Returns NULL if the node cannot be replayed
+static FfxNode createRecord(Scene *scene, const Record *record,
+  FfxTraceDataFunc dataFunc, void *arg) {
+
+    FfxNode node = NULL;
+
+    size_t length = 0;
+    const uint16_t *data = NULL;
+
+    switch (record->kind) {
+        case TraceKindFill:
+            node = ffx_scene_createFill(scene, record->value.color);
+            break;
+
+        case TraceKindBox:
+            node = ffx_scene_createBox(scene, record->value.box.size);
+            ffx_sceneBox_setColor(node, record->value.box.color);
+            break;
+
+        case TraceKindLabel: {
+            char text[256];
+            memcpy(text, record->text, record->textLength);
+            text[record->textLength] = 0;
+
+            node = ffx_scene_createLabel(scene, record->value.label.font,
+              text);
+            ffx_sceneLabel_setAlign(node, record->value.label.align);
+            ffx_sceneLabel_setTextColor(node, record->value.label.textColor);
+            ffx_sceneLabel_setOutlineColor(node,
+              record->value.label.outlineColor);
+            break;
+        }
+
+        case TraceKindImage:
+            data = getData(record, &length, dataFunc, arg);
+            if (data == NULL) { return NULL; }
+
+            node = ffx_scene_createImage(scene, data, length);
+            if (node) { ffx_sceneImage_setTint(node, record->value.color); }
+            break;
+
+        case TraceKindQR:
+            node = createQR(scene, record->value.qr.version);
+            if (node == NULL) { return NULL; }
+            ffx_sceneQR_setModuleSize(node, record->value.qr.moduleSize);
+            ffx_sceneQR_setQuietZone(node, record->value.qr.quietZone);
+            ffx_sceneQR_setForegroundColor(node, record->value.qr.fg);
+            ffx_sceneQR_setBackgroundColor(node, record->value.qr.bg);
+            break;
+
+        case TraceKindSprite:
+            data = getData(record, &length, dataFunc, arg);
+            if (data == NULL) { return NULL; }
+
+            node = ffx_scene_createSprite(scene, data, length);
+            if (node == NULL) { return NULL; }
+            ffx_sceneSprite_setScale(node, record->value.sprite.scale);
+            ffx_sceneSprite_setAngle(node, record->value.sprite.angle);
+            ffx_sceneSprite_setSampling(node, record->value.sprite.sampling);
+            break;
+
+        case TraceKindFlipbook:
+            data = getData(record, &length, dataFunc, arg);
+            if (data == NULL) { return NULL; }
+
+            // Held on the recorded frame
+            node = ffx_scene_createFlipbook(scene, data, length);
+            if (node == NULL) { return NULL; }
+            ffx_sceneFlipbook_setFrame(node, record->value.frame);
+            ffx_sceneFlipbook_setPlaying(node, false);
+            break;
+
+        case TraceKindTileMap:
+            data = getData(record, &length, dataFunc, arg);
+            if (data == NULL) { return NULL; }
+
+            node = ffx_scene_createTileMap(scene, data, length);
+            if (node == NULL) { return NULL; }
+            ffx_sceneTileMap_setSize(node, record->value.tileMap.size);
+            ffx_sceneTileMap_setScroll(node, record->value.tileMap.scroll);
+            ffx_sceneTileMap_setWrap(node, record->value.tileMap.wrap);
+            break;
+
+        case TraceKindGradient:
+            node = ffx_scene_createGradient(scene,
+              record->value.gradient.size, record->value.gradient.type);
+            ffx_sceneGradient_setStart(node, record->value.gradient.start);
+            ffx_sceneGradient_setEnd(node, record->value.gradient.end);
+            ffx_sceneGradient_setDither(node, record->value.gradient.dither);
+            ffx_sceneGradient_setColors(node, record->value.gradient.colors,
+              record->value.gradient.count);
+            break;
+
+        case TraceKindShape:
+            node = ffx_scene_createShape(scene, record->value.shape.type,
+              record->value.shape.size);
+            ffx_sceneShape_setEnd(node, record->value.shape.end);
+            ffx_sceneShape_setFillColor(node, record->value.shape.fill);
+            ffx_sceneShape_setStrokeColor(node, record->value.shape.stroke);
+            ffx_sceneShape_setStrokeWidth(node,
+              record->value.shape.strokeWidth);
+            ffx_sceneShape_setCornerRadius(node,
+              record->value.shape.cornerRadius);
+            ffx_sceneShape_setStartAngle(node,
+              record->value.shape.startAngle);
+            ffx_sceneShape_setEndAngle(node, record->value.shape.endAngle);
+            break;
+
+        case TraceKindParagraph: {
+            char *text = ffx_scene_memAlloc(scene, record->textLength + 1);
+            if (text == NULL) { return NULL; }
+            memcpy(text, record->text, record->textLength);
+
+            node = ffx_scene_createParagraph(scene,
+              record->value.paragraph.font, record->value.paragraph.size,
+              text);
+            ffx_scene_memFree(scene, text);
+            if (node == NULL) { return NULL; }
+
+            ffx_sceneParagraph_setAlign(node, record->value.paragraph.align);
+            ffx_sceneParagraph_setWrap(node, record->value.paragraph.wrap);
+            ffx_sceneParagraph_setTextColor(node,
+              record->value.paragraph.textColor);
+            ffx_sceneParagraph_setOutlineColor(node,
+              record->value.paragraph.outlineColor);
+            break;
+        }
+
+        case TraceKindParticles: {
+            size_t count = record->value.particles.count;
+
+            // The recorded count is emitted once and kept alive, so each
+            // replayed sequence simulates and draws the same number
+            FfxParticleEmitter emitter = record->value.particles.emitter;
+            emitter.rate = 0;
+            emitter.life = 0xffff;
+            emitter.lifeJitter = 0;
+
+            node = ffx_scene_createParticles(scene, count ? count: 1);
+            if (node == NULL) { return NULL; }
+            ffx_sceneParticles_setEmitter(node, &emitter);
+            ffx_sceneParticles_emit(node, count);
+
+            if (record->value.particles.sprite) {
+                data = getData(record, &length, dataFunc, arg);
+                if (data) {
+                    ffx_sceneParticles_setSprite(node, data, length);
+                }
+            }
+            break;
+        }
+
+        case TraceKindChart: {
+            size_t count = record->value.chart.count;
+            int32_t min = record->value.chart.min;
+            int32_t max = record->value.chart.max;
+
+            node = ffx_scene_createChart(scene, record->value.chart.size,
+              count ? count: 1);
+            if (node == NULL) { return NULL; }
+            ffx_sceneChart_setStyle(node, record->value.chart.style);
+            ffx_sceneChart_setColor(node, record->value.chart.color);
+
+            // Samples spanning the recorded range, which scale the same
+            uint32_t seed = count;
+            uint32_t span = (uint32_t)max - (uint32_t)min + 1;
+            for (int i = 0; i < count; i++) {
+                seed = seed * 1103515245 + 12345;
+                int32_t value = min + (span ? (seed >> 8) % span: 0);
+                if (i == 0) { value = min; }
+                if (i == 1) { value = max; }
+                ffx_sceneChart_append(node, value);
+            }
+            break;
+        }
+
+        default:
+            return NULL;
+    }
+
+    if (node) { ffx_sceneNode_setPosition(node, record->position); }
+
+    return node;
+}
+
+FfxNode ffx_scene_createTraceFrame(FfxScene _scene, const uint8_t *trace,
+  size_t length, size_t frame, FfxTraceDataFunc dataFunc, void *arg) {
+
+    Scene *scene = _scene;
+
+    Reader reader = { .data = trace, .offset = 0, .length = length };
+
+    if (readValue(&reader, 1) != VERSION_TAG ||
+      readValue(&reader, 1) != FORMAT_TRACE) {
+        printf("trace: unsupported format\n");
+        return NULL;
+    }
+    readValue(&reader, 2);
+
+    // The root, then the group of each open layer
+    FfxNode groups[1 + MAX_TRACE_LAYERS];
+    size_t depth = 0;
+
+    for (int f = 0; f <= frame; f++) {
+        if (reader.offset + FRAME_SIZE > length) { break; }
+
+        readValue(&reader, 4);
+        uint32_t count = readValue(&reader, 2);
+
+        if (f == frame) { groups[0] = ffx_scene_createGroup(scene); }
+
+        for (int i = 0; i < count; i++) {
+            Record record;
+            bool valid = readRecord(&reader, &record);
+
+            if (valid && f == frame) {
+                if (record.kind == TraceKindPushLayer) {
+                    if (depth == MAX_TRACE_LAYERS) {
+                        valid = false;
+                    } else {
+                        FfxNode layer = ffx_scene_createGroup(scene);
+                        ffx_sceneGroup_setOpacity(layer,
+                          record.value.opacity);
+                        ffx_sceneGroup_appendChild(groups[depth], layer);
+                        groups[++depth] = layer;
+                    }
+
+                } else if (record.kind == TraceKindPopLayer) {
+                    if (depth == 0) {
+                        valid = false;
+                    } else {
+                        depth--;
+                    }
+
+                } else {
+                    FfxNode node = createRecord(scene, &record, dataFunc,
+                      arg);
+                    if (node) {
+                        ffx_sceneGroup_appendChild(groups[depth], node);
+                    }
+                }
+            }
+
+            if (!valid) {
+                printf("trace: invalid record\n");
+                if (f == frame) { ffx_sceneNode_free(groups[0]); }
+                return NULL;
+            }
+        }
+
+        if (f == frame) { return groups[0]; }
+    }
+
+    return NULL;
+}
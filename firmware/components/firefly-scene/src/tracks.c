@@ -0,0 +1,308 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+
+
+//////////////////////////
+// Evaluating
+
+// Returns the index of the latest keyframe at or before %%time%% (or 0
+// if %%time%% preceeds every keyframe). Time is usually monotonic from
+// one sequence to the next, so the keyframe found last time and its
+// neighbours are checked before falling back onto a binary search.
+static size_t findKeyframe(Track *track, uint32_t time) {
+    const FfxKeyframe *keyframes = track->info.keyframes;
+    size_t last = track->info.count - 1;
+
+    size_t cursor = track->cursor;
+    if (keyframes[cursor].time <= time) {
+        if (cursor == last || time < keyframes[cursor + 1].time) {
+            return cursor;
+        }
+
+        cursor++;
+        if (cursor == last || time < keyframes[cursor + 1].time) {
+            return cursor;
+        }
+
+    } else if (cursor > 0 && keyframes[cursor - 1].time <= time) {
+        return cursor - 1;
+    }
+
+    size_t lo = 0, hi = last;
+    while (lo < hi) {
+        size_t mid = (lo + hi + 1) / 2;
+        if (keyframes[mid].time <= time) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    return lo;
+}
+
+static void applyTrack(Node *node, Track *track, uint32_t time) {
+    size_t index = findKeyframe(track, time);
+    track->cursor = index;
+
+    const FfxTrack *info = &track->info;
+    const FfxKeyframe *k0 = &info->keyframes[index];
+    const FfxKeyframe *k1 = k0;
+
+    fixed_ffxt t = 0;
+    if (index + 1 < info->count && time >= k0->time) {
+        k1 = &k0[1];
+
+        uint32_t dt = time - k0->time;
+        uint32_t span = k1->time - k0->time;
+
+        if (span <= 0x7fff) {
+            t = (dt << 16) / span;
+
+        } else {
+            // Divide in two steps so nothing overflows, which is exact
+            // for spans up to 24 bits (about 4.6 hours)
+            while (span > 0xffffff) {
+                dt >>= 1;
+                span >>= 1;
+            }
+
+            uint32_t n = dt << 8;
+            t = ((n / span) << 8) + (((n % span) << 8) / span);
+        }
+
+        if (k0->curve) { t = k0->curve(t); }
+    }
+
+    switch (info->type) {
+        case FfxTrackTypeFixed: {
+            fixed_ffxt v0 = k0->value.fixed;
+            info->setFunc.fixed(node, v0 + mulfx(k1->value.fixed - v0, t));
+            break;
+        }
+
+        case FfxTrackTypePoint: {
+            FfxPoint v0 = k0->value.point, v1 = k1->value.point;
+            info->setFunc.point(node, (FfxPoint){
+                .x = v0.x + scalarfx(v1.x - v0.x, t),
+                .y = v0.y + scalarfx(v1.y - v0.y, t)
+            });
+            break;
+        }
+
+        case FfxTrackTypeSize: {
+            FfxSize v0 = k0->value.size, v1 = k1->value.size;
+            info->setFunc.size(node, (FfxSize){
+                .width = v0.width + scalarfx(v1.width - v0.width, t),
+                .height = v0.height + scalarfx(v1.height - v0.height, t)
+            });
+            break;
+        }
+
+        case FfxTrackTypeColor:
+            info->setFunc.color(node, ffx_color_lerpfx(k0->value.color,
+              k1->value.color, t));
+            break;
+    }
+}
+
+// Returns false once the tracks have completed
+static bool applyTracks(Tracks *tracks, int32_t now) {
+    int32_t elapsed = now - tracks->startTime;
+    if (elapsed < 0) { elapsed = 0; }
+
+    uint32_t period = tracks->period;
+    uint32_t time = elapsed;
+
+    bool done = false;
+    if (period == 0 || (tracks->mode == FfxTrackModeOnce && time >= period)) {
+        time = period;
+        done = true;
+
+    } else if (tracks->mode == FfxTrackModeLoop) {
+        time %= period;
+
+    } else if (tracks->mode == FfxTrackModePingPong) {
+        time %= 2 * period;
+        if (time > period) { time = 2 * period - time; }
+    }
+
+    for (int i = 0; i < tracks->count; i++) {
+        applyTrack(tracks->node, &tracks->tracks[i], time);
+    }
+
+    return !done;
+}
+
+
+//////////////////////////
+// Sequencing
+
+static void freeTracks(Scene *scene, Node *node) {
+    Tracks *prevTracks = NULL;
+
+    Tracks *tracks = scene->tracksHead;
+    while (tracks) {
+        Tracks *nextTracks = tracks->nextTracks;
+
+        if (tracks->node == node) {
+            if (prevTracks == NULL) {
+                scene->tracksHead = nextTracks;
+            } else {
+                prevTracks->nextTracks = nextTracks;
+            }
+            ffx_scene_memFree(scene, tracks);
+
+        } else {
+            prevTracks = tracks;
+        }
+
+        tracks = nextTracks;
+    }
+}
+
+void ffx_scene_attachTracks(Scene *scene) {
+
+    // Take every pending set at once; anything set after this is picked
+    // up by the next sequence
+    Tracks *tracks = atomic_exchange_explicit(&scene->pendingTracks, NULL,
+      memory_order_acquire);
+    if (tracks == NULL) { return; }
+
+    // The stack is most-recent first; reverse it so the latest tracks
+    // set on a node replace any earlier ones
+    Tracks *ordered = NULL;
+    while (tracks) {
+        Tracks *nextTracks = tracks->nextTracks;
+        tracks->nextTracks = ordered;
+        ordered = tracks;
+        tracks = nextTracks;
+    }
+
+    tracks = ordered;
+    while (tracks) {
+        Tracks *nextTracks = tracks->nextTracks;
+
+        // The node may have been freed since (see: node.c)
+        if (tracks->node) { freeTracks(scene, tracks->node); }
+
+        if (tracks->node == NULL || tracks->count == 0) {
+            // Only clearing (or nothing left to play on)
+            ffx_scene_memFree(scene, tracks);
+
+        } else {
+            tracks->startTime += scene->tick;
+            tracks->nextTracks = scene->tracksHead;
+            scene->tracksHead = tracks;
+        }
+
+        tracks = nextTracks;
+    }
+}
+
+void ffx_scene_updateTracks(Scene *scene) {
+    int32_t now = scene->tick;
+
+    Tracks *prevTracks = NULL;
+
+    Tracks *tracks = scene->tracksHead;
+    while (tracks) {
+        Tracks *nextTracks = tracks->nextTracks;
+
+        bool running = false;
+        if (tracks->node && !(tracks->node->flags & NodeFlagRemove)) {
+            running = applyTracks(tracks, now);
+        }
+
+        if (running) {
+            prevTracks = tracks;
+
+        } else {
+            if (prevTracks == NULL) {
+                scene->tracksHead = nextTracks;
+            } else {
+                prevTracks->nextTracks = nextTracks;
+            }
+            ffx_scene_memFree(scene, tracks);
+        }
+
+        tracks = nextTracks;
+    }
+}
+
+
+//////////////////////////
+// Methods
+
+static void queueTracks(Node *node, Tracks *tracks) {
+    Scene *scene = node->scene;
+
+    Tracks *head = atomic_load_explicit(&scene->pendingTracks,
+      memory_order_relaxed);
+    do {
+        tracks->nextTracks = head;
+    } while (!atomic_compare_exchange_weak_explicit(&scene->pendingTracks,
+      &head, tracks, memory_order_release, memory_order_relaxed));
+}
+
+bool ffx_sceneNode_setTracks(FfxNode _node, const FfxTrack *tracks,
+  size_t count, FfxTrackMode mode, uint32_t offset) {
+
+    Node *node = _node;
+
+    size_t keyframeCount = 0;
+    uint32_t period = 0;
+
+    for (int i = 0; i < count; i++) {
+        const FfxTrack *track = &tracks[i];
+        if (track->count == 0 || track->keyframes == NULL) {
+            printf("track has no keyframes\n");
+            return false;
+        }
+
+        for (int k = 1; k < track->count; k++) {
+            if (track->keyframes[k].time < track->keyframes[k - 1].time) {
+                printf("track keyframes out of order\n");
+                return false;
+            }
+        }
+
+        uint32_t endTime = track->keyframes[track->count - 1].time;
+        if (endTime > period) { period = endTime; }
+
+        keyframeCount += track->count;
+    }
+
+    Tracks *result = ffx_sceneNode_memAlloc(node, sizeof(Tracks) +
+      count * sizeof(Track) + keyframeCount * sizeof(FfxKeyframe));
+    if (result == NULL) { return false; }
+
+    result->node = node;
+    result->startTime = -(int32_t)offset;
+    result->period = period;
+    result->mode = mode;
+    result->count = count;
+
+    FfxKeyframe *keyframes = (FfxKeyframe*)&result->tracks[count];
+    for (int i = 0; i < count; i++) {
+        const FfxTrack *track = &tracks[i];
+        memcpy(keyframes, track->keyframes,
+          track->count * sizeof(FfxKeyframe));
+
+        result->tracks[i].info = *track;
+        result->tracks[i].info.keyframes = keyframes;
+
+        keyframes += track->count;
+    }
+
+    queueTracks(node, result);
+
+    return true;
+}
+
+void ffx_sceneNode_clearTracks(FfxNode node) {
+    ffx_sceneNode_setTracks(node, NULL, 0, FfxTrackModeOnce, 0);
+}
@@ -0,0 +1,473 @@
+#include "test.h"
+#include "scene.h"
+
+// Property actions (see: ../../src/scene.c)
+//
+// - the typed point, size, color and fixed actions set the lerp of
+//   their values at the animation's curved t, end on their final
+//   value and allocate nothing beyond their animation
+// - when animations overlap on a property the newest wins, whether
+//   either action is typed, typed past MAX_TYPED_ACTIONS or custom
+// - completed, stopped and removed animations leave the arrays, which
+//   keep their order
+// - ns/animation/frame for 10, 100 and 1,000 concurrent animations,
+//   steady and with animations completing and restarting
+
+
+//////////////////////////
+// Recording
+
+#define MAX_NODES      (4)
+
+typedef struct Record {
+    FfxNode node;
+    int sets;
+    fixed_ffxt t;
+    FfxPoint point;
+    FfxSize size;
+    color_ffxt color;
+    fixed_ffxt fixed;
+} Record;
+
+static Record records[MAX_NODES];
+
+static Record* getRecord(FfxNode node) {
+    for (int i = 0; i < MAX_NODES; i++) {
+        if (records[i].node == node) { return &records[i]; }
+    }
+    check(false);
+    return NULL;
+}
+
+static void setPoint(FfxNode node, FfxPoint value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->point = value;
+}
+
+static void setSize(FfxNode node, FfxSize value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->size = value;
+}
+
+static void setColor(FfxNode node, color_ffxt value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->color = value;
+}
+
+static void setFixed(FfxNode node, fixed_ffxt value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->fixed = value;
+}
+
+// A group, which never renders, so only the animations are allocated
+static FfxNode addNode(FfxScene scene, int index) {
+    FfxNode node = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    memset(&records[index], 0, sizeof(Record));
+    records[index].node = node;
+    return node;
+}
+
+
+//////////////////////////
+// Actions
+
+// A custom action, which records its t and sets a point
+typedef struct CustomState {
+    FfxPoint v0, v1;
+} CustomState;
+
+static void customAction(FfxNode node, fixed_ffxt t, void *_state) {
+    CustomState *state = _state;
+    Record *record = getRecord(node);
+    record->t = t;
+    if (state->v0.x == state->v1.x && state->v0.y == state->v1.y) {
+        return;
+    }
+    setPoint(node, (FfxPoint){
+        .x = state->v0.x + scalarfx(state->v1.x - state->v0.x, t),
+        .y = state->v0.y + scalarfx(state->v1.y - state->v0.y, t)
+    });
+}
+
+typedef enum PointKind {
+    PointKindNone = 0,
+    PointKindTyped,
+    PointKindOverflow,
+    PointKindCustom,
+} PointKind;
+
+typedef struct Setup {
+    uint32_t duration;
+    FfxCurveFunc curve;
+    FfxNodeAnimationCompletionFunc onComplete;
+
+    PointKind kind;
+    FfxPoint p0, p1;
+
+    // Also animate the size, color and fixed, and record t
+    bool all;
+} Setup;
+
+static const FfxSize S0 = { 10, 200 }, S1 = { 90, 20 };
+static color_ffxt C0, C1;
+static const fixed_ffxt F0 = -0x30000, F1 = 0x123456;
+
+static void addCustom(FfxNode node, FfxPoint p0, FfxPoint p1) {
+    CustomState *state = ffx_sceneNode_createAction(node,
+      sizeof(CustomState), customAction);
+    check(state != NULL);
+    state->v0 = p0;
+    state->v1 = p1;
+}
+
+static void setup(FfxNode node, FfxNodeAnimation *animation, void *arg) {
+    Setup *s = arg;
+    animation->duration = s->duration;
+    if (s->curve) { animation->curve = s->curve; }
+    animation->onComplete = s->onComplete;
+
+    if (s->all) {
+        ffx_sceneNode_createSizeAction(node, S0, S1, setSize);
+        ffx_sceneNode_createColorAction(node, C0, C1, setColor);
+        ffx_sceneNode_createFixedAction(node, F0, F1, setFixed);
+        addCustom(node, ffx_point(0, 0), ffx_point(0, 0));
+    }
+
+    switch (s->kind) {
+        case PointKindNone:
+            break;
+        case PointKindTyped:
+            ffx_sceneNode_createPointAction(node, s->p0, s->p1, setPoint);
+            break;
+        case PointKindOverflow:
+            // Fill the inline actions, so the point falls back onto an
+            // allocated Action
+            for (int i = 0; i < MAX_TYPED_ACTIONS; i++) {
+                ffx_sceneNode_createSizeAction(node, S0, S0, setSize);
+            }
+            ffx_sceneNode_createPointAction(node, s->p0, s->p1, setPoint);
+            break;
+        case PointKindCustom:
+            addCustom(node, s->p0, s->p1);
+            break;
+    }
+}
+
+static int completions[4];
+
+static void onComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg) {
+    switch (stopType) {
+        case FfxSceneActionStopNormal: completions[0]++; break;
+        case FfxSceneActionStopCurrent: completions[1]++; break;
+        case FfxSceneActionStopFinal: completions[2]++; break;
+        default: completions[3]++; break;
+    }
+}
+
+static size_t arrayCount(FfxScene scene, ActionType type) {
+    return ((Scene*)scene)->actionArrays[type].count;
+}
+
+
+//////////////////////////
+// Typed
+
+static void testTyped(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addNode(scene, 0);
+    Record *record = getRecord(node);
+    memset(completions, 0, sizeof(completions));
+
+    // Colors lerp in HSV, so the final value is only exact for HSV
+    C0 = ffx_color_rgb2hsv(ffx_color_rgb(255, 0, 0));
+    C1 = ffx_color_rgb2hsv(ffx_color_rgba(0, 255, 128, 22));
+
+    FfxPoint p0 = ffx_point(-40, 300), p1 = ffx_point(200, -17);
+    Setup s = {
+        .duration = 500, .curve = FfxCurveEaseOutBack,
+        .onComplete = onComplete, .kind = PointKindTyped, .p0 = p0,
+        .p1 = p1, .all = true
+    };
+
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    ffx_sceneNode_animate(node, setup, &s);
+    testSequence(scene, 1);
+    checkEqual(arrayCount(scene, ActionTypePoint), 1);
+    checkEqual(arrayCount(scene, ActionTypeSize), 1);
+    checkEqual(arrayCount(scene, ActionTypeColor), 1);
+    checkEqual(arrayCount(scene, ActionTypeFixed), 1);
+
+    // The custom action records t, the typed actions set the lerp at
+    // that same t, each once per frame
+    int frames = 0;
+    while (completions[0] == 0) {
+        int sets = record->sets;
+        testSequence(scene, 7);
+        frames++;
+        check(frames < 200);
+
+        if (record->sets == sets) { continue; }
+        checkEqual(record->sets - sets, 4);
+
+        fixed_ffxt t = record->t;
+        checkEqual(record->point.x, p0.x + scalarfx(p1.x - p0.x, t));
+        checkEqual(record->point.y, p0.y + scalarfx(p1.y - p0.y, t));
+        checkEqual(record->size.width,
+          S0.width + scalarfx(S1.width - S0.width, t));
+        checkEqual(record->size.height,
+          S0.height + scalarfx(S1.height - S0.height, t));
+        checkEqual(record->color, ffx_color_lerpfx(C0, C1, t));
+        checkEqual(record->fixed, F0 + mulfx(F1 - F0, t));
+    }
+
+    // Ended on the final values, once, and left the arrays
+    checkEqual(record->t, FM_1);
+    checkEqual(record->point.x, p1.x);
+    checkEqual(record->point.y, p1.y);
+    checkEqual(record->size.width, S1.width);
+    checkEqual(record->color, C1);
+    checkEqual(record->fixed, F1);
+    checkEqual(completions[0], 1);
+    for (int i = 0; i < TYPED_ACTION_COUNT; i++) {
+        checkEqual(arrayCount(scene, i), 0);
+    }
+
+    // Only the animation (and its custom action) were allocated
+    uint32_t live = atomic_load(&testHeap.allocs) - allocs;
+    testSequence(scene, 7);
+    checkEqual(record->point.x, p1.x);
+
+    // Past the inline limit, one Action is allocated for the overflow
+    uint32_t before = atomic_load(&testHeap.allocs);
+    Setup typed = { .duration = 50, .kind = PointKindTyped };
+    ffx_sceneNode_animate(node, setup, &typed);
+    testSequence(scene, 1);
+    uint32_t typedAllocs = atomic_load(&testHeap.allocs) - before;
+
+    before = atomic_load(&testHeap.allocs);
+    Setup overflow = { .duration = 50, .kind = PointKindOverflow };
+    ffx_sceneNode_animate(node, setup, &overflow);
+    testSequence(scene, 1);
+    checkEqual(atomic_load(&testHeap.allocs) - before, typedAllocs + 1);
+    check(live >= typedAllocs);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Ordering
+
+// The point of each animation set on the same node; the older animation
+// is started first and both run for the rest of the test
+static void checkNewest(PointKind older, PointKind newer) {
+    FfxScene scene = testScene();
+    FfxNode node = addNode(scene, 0);
+    Record *record = getRecord(node);
+
+    Setup a = {
+        .duration = 1000, .kind = older,
+        .p0 = ffx_point(0, 0), .p1 = ffx_point(100, 100)
+    };
+    ffx_sceneNode_animate(node, setup, &a);
+    testSequence(scene, 10);
+    testSequence(scene, 10);
+    check(record->point.x > 0 && record->point.x <= 100);
+
+    Setup b = {
+        .duration = 1200, .kind = newer,
+        .p0 = ffx_point(200, 200), .p1 = ffx_point(300, 300)
+    };
+    ffx_sceneNode_animate(node, setup, &b);
+
+    // The newer animation is set last every frame, while the older one
+    // is still running and after it completes
+    for (int i = 0; i < 130; i++) {
+        testSequence(scene, 10);
+        if (i == 0) { continue; }
+        check(record->point.x >= 200 && record->point.x <= 300);
+    }
+    checkEqual(record->point.x, 300);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testNewestWins(void) {
+    const PointKind kinds[] = {
+        PointKindTyped, PointKindOverflow, PointKindCustom
+    };
+    for (int older = 0; older < 3; older++) {
+        for (int newer = 0; newer < 3; newer++) {
+            checkNewest(kinds[older], kinds[newer]);
+        }
+    }
+
+    // Interleaved across several nodes; each animation's actions still
+    // keep their own order within each array
+    FfxScene scene = testScene();
+    FfxNode nodes[3];
+    for (int i = 0; i < 3; i++) { nodes[i] = addNode(scene, i); }
+
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 3; i++) {
+            Setup s = {
+                .duration = 300 + 100 * i,
+                .kind = kinds[(round + i) % 3],
+                .p0 = ffx_point(1000 * round, 0),
+                .p1 = ffx_point(1000 * round + 500, 0)
+            };
+            ffx_sceneNode_animate(nodes[i], setup, &s);
+        }
+        testSequence(scene, 10);
+        testSequence(scene, 10);
+
+        for (int i = 0; i < 3; i++) {
+            check(getRecord(nodes[i])->point.x >= 1000 * round);
+        }
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Completion
+
+static void testCompletion(void) {
+    FfxScene scene = testScene();
+    memset(completions, 0, sizeof(completions));
+
+    FfxNode nodes[MAX_NODES];
+    for (int i = 0; i < MAX_NODES; i++) {
+        nodes[i] = addNode(scene, i);
+        Setup s = {
+            .duration = 100 + 100 * i, .onComplete = onComplete,
+            .kind = PointKindTyped, .p0 = ffx_point(0, 0),
+            .p1 = ffx_point(10 * (i + 1), 0), .all = true
+        };
+        ffx_sceneNode_animate(nodes[i], setup, &s);
+    }
+    testSequence(scene, 1);
+    checkEqual(arrayCount(scene, ActionTypePoint), MAX_NODES);
+
+    // Stopped at the current and final values; removed entirely
+    testSequence(scene, 50);
+    ffx_sceneNode_stopAnimations(nodes[1], false);
+    ffx_sceneNode_stopAnimations(nodes[2], true);
+    testSequence(scene, 1);
+    checkEqual(arrayCount(scene, ActionTypePoint), MAX_NODES - 2);
+    checkEqual(completions[1], 1);
+    checkEqual(completions[2], 1);
+    check(getRecord(nodes[1])->point.x < 20);
+    checkEqual(getRecord(nodes[2])->point.x, 30);
+
+    int sets = getRecord(nodes[3])->sets;
+    ffx_sceneNode_remove(nodes[3]);
+    testSequence(scene, 1);
+    testSequence(scene, 1);
+    checkEqual(getRecord(nodes[3])->sets, sets);
+    checkEqual(arrayCount(scene, ActionTypePoint), 1);
+
+    // There is no cancelled reason yet, so removal completes normally
+    checkEqual(completions[0], 1);
+
+    // The last ends normally
+    testSequence(scene, 100);
+    testSequence(scene, 1);
+    checkEqual(arrayCount(scene, ActionTypePoint), 0);
+    checkEqual(arrayCount(scene, ActionTypeFixed), 0);
+    checkEqual(getRecord(nodes[0])->point.x, 10);
+    checkEqual(completions[0], 2);
+    checkEqual(completions[3], 0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAMES   (1000)
+
+static void benchComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg);
+
+static void benchSetup(FfxNode node, FfxNodeAnimation *animation,
+  void *arg) {
+    uint32_t duration = (uintptr_t)arg;
+    animation->duration = duration;
+    animation->onComplete = duration ? benchComplete: NULL;
+    // Steady animations outlast the benchmark (which is 16s)
+    if (!duration) { animation->duration = 30000; }
+
+    // Captured as typed actions, from the current values
+    ffx_sceneNode_setPosition(node, ffx_point(200, 100));
+    ffx_sceneBox_setSize(node, ffx_size(100, 50));
+    ffx_sceneBox_setColor(node, ffx_color_rgb(255, 0, 128));
+}
+
+static void benchComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg) {
+    if (stopType != FfxSceneActionStopNormal) { return; }
+    ffx_sceneNode_animate(node, benchSetup, arg);
+}
+
+// Boxes which are never added to the scene, so only the animations are
+// measured, either running throughout or completing every 600ms and
+// restarting from their onComplete
+static double benchmarkAnimations(int count, bool churn) {
+    FfxScene scene = testScene();
+    FfxNode *boxes = malloc(count * sizeof(FfxNode));
+    check(boxes != NULL);
+
+    uint32_t duration = churn ? 600: 0;
+    for (int i = 0; i < count; i++) {
+        boxes[i] = ffx_scene_createBox(scene, ffx_size(10, 10));
+        ffx_sceneNode_animate(boxes[i], benchSetup,
+          (void*)(uintptr_t)(duration + i % 64));
+    }
+    testSequence(scene, 16);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) { testSequence(scene, 16); }
+    double duration_us = testNow() - start;
+
+    checkEqual(arrayCount(scene, ActionTypePoint), count);
+
+    for (int i = 0; i < count; i++) { ffx_sceneNode_free(boxes[i]); }
+    free(boxes);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return 1000 * duration_us / BENCH_FRAMES / count;
+}
+
+static void benchmark(void) {
+    const int counts[] = { 10, 100, 1000 };
+    for (int i = 0; i < 3; i++) {
+        double steady = benchmarkAnimations(counts[i], false);
+        double churn = benchmarkAnimations(counts[i], true);
+        printf("bench: N=%-4d steady %.1fns, churn %.1fns "
+          "(per animation per frame, 3 properties)\n", counts[i], steady,
+          churn);
+    }
+}
+
+
+int main(void) {
+    testTyped();
+    testNewestWins();
+    testCompletion();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,303 @@
+#include <pthread.h>
+
+#include "test.h"
+
+// Batches (see: ../../src/batch.c)
+//
+// - commands apply at the next sequence, in commit order
+// - a batch whose animate fails to record releases the animation
+// - a batch with any command which fails to record applies nothing
+// - producers committing from many threads never tear a batch
+// - the cost to record, commit and apply a batch
+
+
+//////////////////////////
+// Ordering
+
+static void testOrdering(void) {
+    FfxScene scene = testScene();
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(10, 10));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), box);
+
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_setPosition(batch, box, ffx_point(1, 1));
+    ffx_sceneBatch_setPosition(batch, box, ffx_point(2, 2));
+    ffx_sceneBatch_commit(batch);
+
+    batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_setPosition(batch, box, ffx_point(3, 4));
+    ffx_sceneBatch_commit(batch);
+
+    // Nothing applies until the scene is sequenced
+    checkEqual(ffx_sceneNode_getPosition(box).x, 0);
+
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneNode_getPosition(box).x, 3);
+    checkEqual(ffx_sceneNode_getPosition(box).y, 4);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Failed recording
+
+static _Atomic(uint32_t) setupCount, dispatchCount, releaseCount;
+
+static void* setup(FfxNode node, FfxNodeAnimation animation, void *initArg) {
+    atomic_fetch_add(&setupCount, 1);
+    return malloc(16);
+}
+
+static void dispatch(void *setupArg, FfxNodeAnimationCompletionFunc callFunc,
+  FfxNode node, FfxSceneActionStop stopType, void *arg, void *initArg) {
+
+    if (callFunc) {
+        atomic_fetch_add(&dispatchCount, 1);
+        callFunc(node, stopType, arg);
+    } else {
+        atomic_fetch_add(&releaseCount, 1);
+    }
+    free(setupArg);
+}
+
+static void onComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg) { }
+
+static void testFailedAnimate(void) {
+    FfxScene scene = ffx_scene_init(testAlloc, testFree, setup, dispatch,
+      NULL);
+    check(scene != NULL);
+
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(10, 10));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), box);
+
+    // The animation is captured, then its command cannot be allocated
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+    atomic_store(&testHeap.failIn, 2);
+    ffx_sceneBatch_animatePosition(batch, box, ffx_point(50, 50), 0, 100,
+      FfxCurveLinear, onComplete, NULL);
+    checkEqual(atomic_load(&testHeap.failIn), 0);
+    checkEqual(ffx_sceneBatch_commit(batch), false);
+
+    checkEqual(setupCount, 1);
+    checkEqual(releaseCount, 1);
+
+    // A recorded animation is dispatched once complete
+    batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_animatePosition(batch, box, ffx_point(50, 50), 0, 100,
+      FfxCurveLinear, onComplete, NULL);
+    checkEqual(ffx_sceneBatch_commit(batch), true);
+
+    for (int i = 0; i < 20; i++) { testSequence(scene, 10); }
+    checkEqual(ffx_sceneNode_getPosition(box).x, 50);
+    checkEqual(setupCount, 2);
+    checkEqual(dispatchCount, 1);
+
+    // A committed animation dropped with the scene is released
+    batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_animatePosition(batch, box, ffx_point(0, 0), 0, 100,
+      FfxCurveLinear, onComplete, NULL);
+    ffx_sceneBatch_commit(batch);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+    checkEqual(setupCount, 3);
+    checkEqual(dispatchCount + releaseCount, 3);
+}
+
+static void testFailedCommand(void) {
+    FfxScene scene = ffx_scene_init(testAlloc, testFree, setup, dispatch,
+      NULL);
+    check(scene != NULL);
+
+    FfxNode root = ffx_scene_root(scene);
+    FfxNode panel = ffx_scene_createBox(scene, ffx_size(10, 10));
+    FfxNode other = ffx_scene_createBox(scene, ffx_size(10, 10));
+    ffx_sceneGroup_appendChild(root, panel);
+    ffx_sceneGroup_appendChild(root, other);
+
+    atomic_store(&setupCount, 0);
+    atomic_store(&dispatchCount, 0);
+    atomic_store(&releaseCount, 0);
+
+    // A pop; the remove cannot be allocated, so neither it nor the
+    // move or animation recorded before it may apply
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_setPosition(batch, other, ffx_point(5, 5));
+    ffx_sceneBatch_animatePosition(batch, other, ffx_point(50, 50), 0, 100,
+      FfxCurveLinear, onComplete, NULL);
+    atomic_store(&testHeap.failIn, 1);
+    ffx_sceneBatch_remove(batch, panel);
+    checkEqual(atomic_load(&testHeap.failIn), 0);
+
+    // Recording continues after a failure, but is dropped with the rest
+    ffx_sceneBatch_setText(batch, other, "ignored");
+
+    int live = testLive();
+    checkEqual(ffx_sceneBatch_commit(batch), false);
+    check(testLive() < live);
+    checkEqual(setupCount, 1);
+    checkEqual(releaseCount, 1);
+
+    for (int i = 0; i < 20; i++) { testSequence(scene, 10); }
+    checkEqual(ffx_sceneNode_getPosition(other).x, 0);
+    check(ffx_sceneNode_getParent(panel) == root);
+    checkEqual(dispatchCount, 0);
+
+    // A batch which could not begin fails to commit
+    atomic_store(&testHeap.failIn, 1);
+    batch = ffx_scene_beginBatch(scene);
+    check(batch == NULL);
+    ffx_sceneBatch_setPosition(batch, other, ffx_point(5, 5));
+    ffx_sceneBatch_animatePosition(batch, other, ffx_point(50, 50), 0, 100,
+      FfxCurveLinear, onComplete, NULL);
+    checkEqual(ffx_sceneBatch_commit(batch), false);
+    checkEqual(setupCount, 1);
+
+    // And once memory is available, the same batch applies in full
+    batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_setPosition(batch, other, ffx_point(5, 5));
+    ffx_sceneBatch_remove(batch, panel);
+    checkEqual(ffx_sceneBatch_commit(batch), true);
+
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneNode_getPosition(other).x, 5);
+    check(ffx_sceneGroup_getFirstChild(root) == other);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Stress
+
+#define PRODUCERS       (4)
+#define BOXES           (16)
+#define COMMITS         (20000)
+
+typedef struct Stress {
+    FfxScene scene;
+    FfxNode boxes[BOXES];
+    _Atomic(uint32_t) running;
+} Stress;
+
+// Each batch moves every box to the same (v, v); a torn batch would
+// leave some box with x != y, or boxes at different positions
+static void* produce(void *arg) {
+    Stress *stress = arg;
+
+    uint32_t seed = (uintptr_t)&seed;
+    for (int i = 0; i < COMMITS; i++) {
+        int32_t v = testRandom(&seed) % 1000;
+
+        FfxSceneBatch batch = ffx_scene_beginBatch(stress->scene);
+        for (int b = 0; b < BOXES; b++) {
+            ffx_sceneBatch_setPosition(batch, stress->boxes[b],
+              ffx_point(v, 0));
+        }
+        for (int b = 0; b < BOXES; b++) {
+            ffx_sceneBatch_setPosition(batch, stress->boxes[b],
+              ffx_point(v, v));
+        }
+        ffx_sceneBatch_commit(batch);
+    }
+
+    atomic_fetch_sub(&stress->running, 1);
+
+    return NULL;
+}
+
+static void testStress(void) {
+    Stress stress = { 0 };
+    stress.scene = testScene();
+    for (int b = 0; b < BOXES; b++) {
+        stress.boxes[b] = ffx_scene_createBox(stress.scene,
+          ffx_size(4, 4));
+        ffx_sceneGroup_appendChild(ffx_scene_root(stress.scene),
+          stress.boxes[b]);
+    }
+
+    atomic_store(&stress.running, PRODUCERS);
+
+    pthread_t threads[PRODUCERS];
+    for (int i = 0; i < PRODUCERS; i++) {
+        check(pthread_create(&threads[i], NULL, produce, &stress) == 0);
+    }
+
+    // Sequence concurrently with the producers, checking every frame
+    uint32_t frames = 0;
+    bool done = false;
+    while (!done) {
+        done = (atomic_load(&stress.running) == 0);
+
+        testSequence(stress.scene, 1);
+        frames++;
+
+        FfxPoint first = ffx_sceneNode_getPosition(stress.boxes[0]);
+        checkEqual(first.x, first.y);
+        for (int b = 1; b < BOXES; b++) {
+            FfxPoint pos = ffx_sceneNode_getPosition(stress.boxes[b]);
+            checkEqual(pos.x, first.x);
+            checkEqual(pos.y, first.y);
+        }
+    }
+
+    for (int i = 0; i < PRODUCERS; i++) { pthread_join(threads[i], NULL); }
+
+    printf("stress: %d producers, %d commits, %d frames\n", PRODUCERS,
+      PRODUCERS * COMMITS, frames);
+
+    ffx_scene_free(stress.scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_BATCHES   (10000)
+
+static void benchmark(void) {
+    FfxScene scene = testScene();
+    FfxNode boxes[BOXES];
+    for (int b = 0; b < BOXES; b++) {
+        boxes[b] = ffx_scene_createBox(scene, ffx_size(4, 4));
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), boxes[b]);
+    }
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_BATCHES; i++) {
+        FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+        for (int b = 0; b < BOXES; b++) {
+            ffx_sceneBatch_setPosition(batch, boxes[b], ffx_point(i, b));
+        }
+        ffx_sceneBatch_commit(batch);
+    }
+    double record = testNow() - start;
+
+    start = testNow();
+    testSequence(scene, 1);
+    double apply = testNow() - start;
+
+    checkEqual(ffx_sceneNode_getPosition(boxes[3]).x, BENCH_BATCHES - 1);
+
+    printf("bench: record+commit %.3fus/batch, apply %.1fns/command "
+      "(%d commands)\n", record / BENCH_BATCHES,
+      apply * 1000 / (BENCH_BATCHES * BOXES), BENCH_BATCHES * BOXES);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testOrdering();
+    testFailedAnimate();
+    testFailedCommand();
+    testStress();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include "test.h"
+
+// Blobs (see: ../../src/blob.c)
+//
+// - a blob renders the same as the equivalent tree built node by node
+// - every truncation, and labels with an unknown font or alignment,
+//   are rejected
+// - the cost to instantiate a blob against building the same tree
+
+
+//////////////////////////
+// Writing
+
+typedef struct Writer {
+    uint8_t data[4096];
+    size_t length;
+} Writer;
+
+static void writeValue(Writer *writer, uint32_t value, size_t width) {
+    check(writer->length + width <= sizeof(writer->data));
+    for (int i = width - 1; i >= 0; i--) {
+        writer->data[writer->length++] = value >> (8 * i);
+    }
+}
+
+static void writeNode(Writer *writer, uint32_t type, int x, int y) {
+    writeValue(writer, type, 1);
+    writeValue(writer, 0, 1);
+    writeValue(writer, (uint16_t)x, 2);
+    writeValue(writer, (uint16_t)y, 2);
+}
+
+static void writeBox(Writer *writer, int x, int y, int width, int height,
+  color_ffxt color) {
+
+    writeNode(writer, 2, x, y);
+    writeValue(writer, width, 2);
+    writeValue(writer, height, 2);
+    writeValue(writer, color, 4);
+}
+
+static void writeLabel(Writer *writer, int x, int y, uint32_t font,
+  uint32_t align, const char *text) {
+
+    writeNode(writer, 4, x, y);
+    writeValue(writer, font, 1);
+    writeValue(writer, align, 1);
+    writeValue(writer, ffx_color_rgb(255, 255, 255), 4);
+    writeValue(writer, ffx_color_rgb(0, 0, 0), 4);
+    writeValue(writer, strlen(text), 1);
+    for (int i = 0; text[i]; i++) { writeValue(writer, text[i], 1); }
+}
+
+#define ROWS      (12)
+
+// A panel of rows, each a box with a label, and one anchor
+static void writePanel(Writer *writer, uint32_t font, uint32_t align) {
+    writer->length = 0;
+
+    writeValue(writer, 0x01, 1);
+    writeValue(writer, 0x53, 1);
+    writeValue(writer, 2 + 2 * ROWS + 1, 2);
+    writeValue(writer, 1, 2);
+
+    writeNode(writer, 1, 0, 0);
+    writeValue(writer, 2 * ROWS + 1, 2);
+
+    for (int i = 0; i < ROWS; i++) {
+        writeBox(writer, 10, 20 * i, 220, 18, ffx_color_rgb(0, 0, 30 + i));
+        writeLabel(writer, 20, 20 * i + 9, font, align, "Row");
+    }
+
+    // Anchor
+    writeNode(writer, 6, 0, 0);
+    writeValue(writer, 0x1234, 4);
+    writeValue(writer, 0, 2);
+    writeBox(writer, 100, 100, 8, 8, ffx_color_rgb(255, 0, 0));
+}
+
+static FfxNode buildPanel(FfxScene scene, FfxNode *anchor) {
+    FfxNode group = ffx_scene_createGroup(scene);
+    for (int i = 0; i < ROWS; i++) {
+        FfxNode box = ffx_scene_createBox(scene, ffx_size(220, 18));
+        ffx_sceneBox_setColor(box, ffx_color_rgb(0, 0, 30 + i));
+        ffx_sceneNode_setPosition(box, ffx_point(10, 20 * i));
+        ffx_sceneGroup_appendChild(group, box);
+
+        FfxNode label = ffx_scene_createLabel(scene, FfxFontMedium, "Row");
+        ffx_sceneLabel_setAlign(label, FfxTextAlignMiddle |
+          FfxTextAlignLeft);
+        ffx_sceneLabel_setTextColor(label, ffx_color_rgb(255, 255, 255));
+        ffx_sceneLabel_setOutlineColor(label, ffx_color_rgb(0, 0, 0));
+        ffx_sceneNode_setPosition(label, ffx_point(20, 20 * i + 9));
+        ffx_sceneGroup_appendChild(group, label);
+    }
+
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(8, 8));
+    ffx_sceneBox_setColor(box, ffx_color_rgb(255, 0, 0));
+    ffx_sceneNode_setPosition(box, ffx_point(100, 100));
+    *anchor = ffx_scene_createAnchor(scene, 0x1234, 0, box);
+    ffx_sceneGroup_appendChild(group, *anchor);
+
+    return group;
+}
+
+
+//////////////////////////
+// Tests
+
+static uint16_t frame[WIDTH * HEIGHT];
+
+static uint32_t renderPanel(FfxNode panel, FfxScene scene) {
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), panel);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    return testHash(frame, WIDTH * HEIGHT);
+}
+
+static void testEquivalent(void) {
+    Writer writer;
+    writePanel(&writer, FfxFontMedium, FfxTextAlignMiddle |
+      FfxTextAlignLeft);
+
+    FfxScene scene = testScene();
+    FfxNode anchor = NULL;
+    FfxNode blob = ffx_scene_createBlob(scene, writer.data, writer.length,
+      NULL, 0, &anchor, 1);
+    check(blob != NULL);
+    check(anchor != NULL);
+    checkEqual(ffx_sceneAnchor_getTag(anchor), 0x1234);
+    uint32_t blobHash = renderPanel(blob, scene);
+    ffx_scene_free(scene);
+
+    scene = testScene();
+    uint32_t builtHash = renderPanel(buildPanel(scene, &anchor), scene);
+    ffx_scene_free(scene);
+
+    checkEqual(blobHash, builtHash);
+    checkEqual(testLive(), 0);
+}
+
+static void testInvalid(void) {
+    FfxScene scene = testScene();
+    FfxNode anchor;
+    Writer writer;
+
+    // Every truncation is rejected
+    writePanel(&writer, FfxFontSmall, 0);
+    for (size_t length = 0; length < writer.length; length++) {
+        check(ffx_scene_createBlob(scene, writer.data, length, NULL, 0,
+          &anchor, 1) == NULL);
+    }
+    FfxNode blob = ffx_scene_createBlob(scene, writer.data, writer.length,
+      NULL, 0, &anchor, 1);
+    check(blob != NULL);
+    ffx_sceneNode_free(blob);
+
+    // Fonts outside FfxFont
+    const uint32_t fonts[] = { 0x00, 0x10, 0x18 | 0x40, 0x99, 0xff };
+    for (int i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        writePanel(&writer, fonts[i], 0);
+        check(ffx_scene_createBlob(scene, writer.data, writer.length, NULL,
+          0, &anchor, 1) == NULL);
+    }
+
+    // Alignments combining two vertical or two horizontal alignments
+    const uint32_t aligns[] = {
+        FfxTextAlignTop | FfxTextAlignBottom,
+        FfxTextAlignLeft | FfxTextAlignRight,
+        0xff
+    };
+    for (int i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+        writePanel(&writer, FfxFontSmall, aligns[i]);
+        check(ffx_scene_createBlob(scene, writer.data, writer.length, NULL,
+          0, &anchor, 1) == NULL);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_PANELS   (2000)
+
+static void benchmark(void) {
+    Writer writer;
+    writePanel(&writer, FfxFontMedium, FfxTextAlignMiddle |
+      FfxTextAlignLeft);
+
+    FfxScene scene = testScene();
+    FfxNode anchor;
+
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    double start = testNow();
+    for (int i = 0; i < BENCH_PANELS; i++) {
+        FfxNode panel = ffx_scene_createBlob(scene, writer.data,
+          writer.length, NULL, 0, &anchor, 1);
+        ffx_sceneNode_free(panel);
+    }
+    double blob = testNow() - start;
+    uint32_t blobAllocs = atomic_load(&testHeap.allocs) - allocs;
+
+    allocs = atomic_load(&testHeap.allocs);
+    start = testNow();
+    for (int i = 0; i < BENCH_PANELS; i++) {
+        ffx_sceneNode_free(buildPanel(scene, &anchor));
+    }
+    double built = testNow() - start;
+    uint32_t builtAllocs = atomic_load(&testHeap.allocs) - allocs;
+
+    // The nodes share a single allocation; only label text is separate
+    checkEqual(blobAllocs, BENCH_PANELS * (1 + ROWS));
+
+    printf("bench: %d nodes; blob %.2fus (%d allocs), built %.2fus "
+      "(%d allocs)\n", 2 + 2 * ROWS + 1, blob / BENCH_PANELS,
+      blobAllocs / BENCH_PANELS, built / BENCH_PANELS,
+      builtAllocs / BENCH_PANELS);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testEquivalent();
+    testInvalid();
+    benchmark();
+    return 0;
+}
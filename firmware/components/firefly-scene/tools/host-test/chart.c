@@ -0,0 +1,376 @@
+#include <limits.h>
+
+#include "test.h"
+
+// Charts (see: ../../src/node-chart.c)
+//
+// - the range matches a brute-force min and max after every append,
+//   for many capacities, and clearing empties the chart
+// - a line chart leaves no gaps between columns, spans the full height
+//   and keeps the newest sample at the right edge; a flat chart sits in
+//   the middle row
+// - a column chart fills every sample's columns down to the bottom row
+// - rendering in fragments of any size matches a full-frame render,
+//   with the chart partly off-screen
+// - an invalid capacity or size creates nothing
+// - the append, rebuild and render cost, against a chart built from
+//   resized boxes
+
+
+#define CHART_X          (0)
+#define CHART_Y          (60)
+#define CHART_WIDTH      (240)
+#define CHART_HEIGHT     (120)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t fragmented[WIDTH * HEIGHT];
+
+static FfxNode addChart(FfxScene scene, size_t capacity,
+  FfxChartStyle style) {
+
+    FfxNode chart = ffx_scene_createChart(scene,
+      ffx_size(CHART_WIDTH, CHART_HEIGHT), capacity);
+    check(chart != NULL);
+    ffx_sceneNode_setPosition(chart, ffx_point(CHART_X, CHART_Y));
+    ffx_sceneChart_setStyle(chart, style);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), chart);
+    return chart;
+}
+
+// The rows [top, bottom] lit in chart column %%x%% of the last frame,
+// returning false if none are
+static bool litRows(int x, int *top, int *bottom) {
+    *top = *bottom = -1;
+    for (int y = 0; y < CHART_HEIGHT; y++) {
+        uint16_t pixel = frame[(CHART_Y + y) * WIDTH + CHART_X + x];
+        if (pixel == 0) { continue; }
+        checkEqual(pixel, ffx_color_rgb16(COLOR_WHITE));
+        if (*top == -1) { *top = y; }
+        *bottom = y;
+    }
+    return (*top != -1);
+}
+
+// A value for sample %%i%%; noise, with rising and falling runs and
+// the extremes of int32 mixed in
+static int32_t sampleValue(uint32_t *seed, int i) {
+    switch ((i / 50) % 4) {
+        case 0: return (int32_t)testRandom(seed) - (1 << 23);
+        case 1: return i * 1000;
+        case 2: return -i * 1000;
+    }
+    uint32_t r = testRandom(seed) % 8;
+    if (r == 0) { return INT32_MIN; }
+    if (r == 1) { return INT32_MAX; }
+    return r;
+}
+
+
+//////////////////////////
+// Range
+
+static void testRange(void) {
+    static const size_t capacities[] = { 1, 2, 3, 7, 64, 240, 1000 };
+
+    #define APPENDS   (5000)
+    static int32_t values[APPENDS];
+
+    FfxScene scene = testScene();
+
+    for (int c = 0; c < sizeof(capacities) / sizeof(capacities[0]); c++) {
+        size_t capacity = capacities[c];
+        FfxNode chart = addChart(scene, capacity, FfxChartStyleLine);
+
+        int32_t lo, hi;
+        check(!ffx_sceneChart_getRange(chart, &lo, &hi));
+
+        uint32_t seed = 7 + c;
+        for (int i = 0; i < APPENDS; i++) {
+            values[i] = sampleValue(&seed, i);
+            ffx_sceneChart_append(chart, values[i]);
+
+            size_t count = (i + 1 < capacity) ? i + 1: capacity;
+            checkEqual(ffx_sceneChart_getCount(chart), count);
+
+            int32_t expLo = INT32_MAX, expHi = INT32_MIN;
+            for (int j = i + 1 - count; j <= i; j++) {
+                if (values[j] < expLo) { expLo = values[j]; }
+                if (values[j] > expHi) { expHi = values[j]; }
+            }
+
+            check(ffx_sceneChart_getRange(chart, &lo, &hi));
+            checkEqual(lo, expLo);
+            checkEqual(hi, expHi);
+
+            // Building the columns with any range stays in the chart
+            if (i % 97 == 0) { testSequence(scene, 1); }
+        }
+
+        ffx_sceneChart_clear(chart);
+        checkEqual(ffx_sceneChart_getCount(chart), 0);
+        check(!ffx_sceneChart_getRange(chart, &lo, &hi));
+
+        ffx_sceneChart_append(chart, 5);
+        check(ffx_sceneChart_getRange(chart, &lo, &hi));
+        checkEqual(lo, 5);
+        checkEqual(hi, 5);
+
+        ffx_sceneNode_free(chart);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Columns
+
+static void checkLine(size_t capacity, size_t count) {
+    FfxScene scene = testScene();
+    FfxNode chart = addChart(scene, capacity, FfxChartStyleLine);
+
+    uint32_t seed = 11;
+    for (int i = 0; i < count; i++) {
+        ffx_sceneChart_append(chart, testRandom(&seed) % 1000);
+    }
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    // The samples end at the right edge; with fewer samples than the
+    // capacity, the left is empty
+    int top, bottom, prevTop = 0, prevBottom = 0;
+    int minTop = CHART_HEIGHT, maxBottom = -1;
+    bool started = false;
+    for (int x = 0; x < CHART_WIDTH; x++) {
+        if (!litRows(x, &top, &bottom)) {
+            check(!started);
+            continue;
+        }
+
+        // Neighbouring columns touch, so the line is unbroken
+        if (started) {
+            check(top <= prevBottom + 1);
+            check(bottom >= prevTop - 1);
+        }
+
+        if (top < minTop) { minTop = top; }
+        if (bottom > maxBottom) { maxBottom = bottom; }
+
+        started = true;
+        prevTop = top;
+        prevBottom = bottom;
+    }
+    check(started);
+    check(litRows(CHART_WIDTH - 1, &top, &bottom));
+    if (count > 1) {
+        checkEqual(minTop, 0);
+        checkEqual(maxBottom, CHART_HEIGHT - 1);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testLine(void) {
+    checkLine(240, 240);
+    checkLine(240, 10);
+    checkLine(60, 60);
+    checkLine(1000, 1000);
+    checkLine(1000, 3000);
+    checkLine(1, 1);
+
+    // A flat chart is a single row, in the middle
+    FfxScene scene = testScene();
+    FfxNode chart = addChart(scene, 100, FfxChartStyleLine);
+    for (int i = 0; i < 100; i++) { ffx_sceneChart_append(chart, 42); }
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    int top, bottom;
+    for (int x = 0; x < CHART_WIDTH; x++) {
+        if (!litRows(x, &top, &bottom)) { continue; }
+        checkEqual(top, (CHART_HEIGHT - 1) / 2);
+        checkEqual(bottom, (CHART_HEIGHT - 1) / 2);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testColumns(void) {
+    FfxScene scene = testScene();
+    FfxNode chart = addChart(scene, 80, FfxChartStyleColumn);
+
+    // Each sample covers three columns, reaching down from its value
+    for (int i = 0; i < 80; i++) { ffx_sceneChart_append(chart, i % 9); }
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    for (int x = 0; x < CHART_WIDTH; x++) {
+        int top, bottom;
+        check(litRows(x, &top, &bottom));
+        checkEqual(bottom, CHART_HEIGHT - 1);
+
+        int value = (x / 3) % 9;
+        int lastRow = CHART_HEIGHT - 1;
+        checkEqual(top, lastRow - (value * lastRow + 4) / 8);
+    }
+
+    // Switching back to a line rebuilds the columns; the line starts
+    // flat at the first sample
+    ffx_sceneChart_setStyle(chart, FfxChartStyleLine);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    int top, bottom;
+    check(litRows(0, &top, &bottom));
+    checkEqual(top, CHART_HEIGHT - 1);
+    checkEqual(bottom, CHART_HEIGHT - 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Fragments
+
+static void testFragments(void) {
+    static const FfxSize sizes[] = {
+        { WIDTH, 24 }, { WIDTH, 10 }, { 64, 17 }, { 7, 240 }
+    };
+
+    FfxScene scene = testScene();
+
+    FfxNode chart = ffx_scene_createChart(scene, ffx_size(300, 150), 500);
+    check(chart != NULL);
+    ffx_sceneNode_setPosition(chart, ffx_point(-30, 130));
+    ffx_sceneChart_setColor(chart, ffx_color_rgb(40, 200, 90));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), chart);
+
+    uint32_t seed = 13;
+    for (int f = 0; f < 40; f++) {
+        for (int i = 0; i < 37; i++) {
+            ffx_sceneChart_append(chart, testRandom(&seed) % 5000);
+        }
+        if (f == 20) { ffx_sceneChart_setStyle(chart, FfxChartStyleColumn); }
+
+        testSequence(scene, 1);
+
+        testRenderAt(scene, frame, ffx_size(WIDTH, HEIGHT));
+        for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+            testRenderAt(scene, fragmented, sizes[i]);
+            check(memcmp(frame, fragmented, sizeof(frame)) == 0);
+        }
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static void testCreate(void) {
+    FfxScene scene = testScene();
+
+    check(ffx_scene_createChart(scene, ffx_size(10, 10), 0) == NULL);
+    check(ffx_scene_createChart(scene, ffx_size(10, 10), 4097) == NULL);
+    check(ffx_scene_createChart(scene, ffx_size(0, 10), 10) == NULL);
+    check(ffx_scene_createChart(scene, ffx_size(10, 0), 10) == NULL);
+
+    FfxNode chart = ffx_scene_createChart(scene, ffx_size(10, 10), 4096);
+    check(chart != NULL);
+    check(ffx_scene_isChart(chart));
+    checkEqual(ffx_sceneChart_getSize(chart).width, 10);
+    ffx_sceneNode_free(chart);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_SAMPLES    (240)
+#define BENCH_APPENDS    (1000000)
+#define BENCH_FRAMES     (200)
+
+static void benchmark(void) {
+    FfxScene scene = testScene();
+    FfxNode chart = addChart(scene, BENCH_SAMPLES, FfxChartStyleLine);
+
+    uint32_t seed = 17;
+    double start = testNow();
+    for (int i = 0; i < BENCH_APPENDS; i++) {
+        ffx_sceneChart_append(chart, testRandom(&seed) % 100000);
+    }
+    double append = 1000 * (testNow() - start) / BENCH_APPENDS;
+
+    // A sample each frame, so every sequence rebuilds the columns
+    double sequence = 0, render = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        ffx_sceneChart_append(chart, testRandom(&seed) % 100000);
+
+        start = testNow();
+        testSequence(scene, 1);
+        sequence += testNow() - start;
+
+        start = testNow();
+        testRender(scene, frame);
+        render += testNow() - start;
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    // The same chart as a column of boxes, resized for each sample
+    scene = testScene();
+    FfxNode boxes[BENCH_SAMPLES];
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        boxes[i] = ffx_scene_createBox(scene, ffx_size(1, 1));
+        ffx_sceneNode_setPosition(boxes[i], ffx_point(i, CHART_Y));
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), boxes[i]);
+    }
+
+    int32_t samples[BENCH_SAMPLES] = { 0 };
+    double boxSequence = 0, boxRender = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        start = testNow();
+        memmove(samples, &samples[1], (BENCH_SAMPLES - 1) * 4);
+        samples[BENCH_SAMPLES - 1] = testRandom(&seed) % CHART_HEIGHT;
+        for (int i = 0; i < BENCH_SAMPLES; i++) {
+            ffx_sceneNode_setPosition(boxes[i],
+              ffx_point(i, CHART_Y + CHART_HEIGHT - samples[i]));
+            ffx_sceneBox_setSize(boxes[i], ffx_size(1, samples[i] + 1));
+        }
+        testSequence(scene, 1);
+        boxSequence += testNow() - start;
+
+        start = testNow();
+        testRender(scene, frame);
+        boxRender += testNow() - start;
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    printf("bench: append %.1fns; %d samples in %dx%d, rebuild+sequence "
+      "%.1fus, render %.1fus; as boxes, update+sequence %.1fus, render "
+      "%.1fus\n", append, BENCH_SAMPLES, CHART_WIDTH, CHART_HEIGHT,
+      sequence / BENCH_FRAMES, render / BENCH_FRAMES,
+      boxSequence / BENCH_FRAMES, boxRender / BENCH_FRAMES);
+}
+
+
+int main(void) {
+    testRange();
+    testLine();
+    testColumns();
+    testFragments();
+    testCreate();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <math.h>
+
+#include "test.h"
+
+// Colors (see: ../../src/color.c)
+//
+// - HSV to RGB is exact for primary hues and within 5/255 of the float
+//   conversion everywhere else
+// - a prepared RGB565 color blends the same as the float reference
+// - the cost of preparing a color once vs on every fragment
+
+void _ffx_renderBox(uint16_t *frameBuffer, int32_t stride, int32_t ox,
+  int32_t oy, int32_t width, int32_t height, const FfxColorRGB565 *color);
+
+
+//////////////////////////
+// HSV
+
+static void referenceHSV(int h, int s, int v, int *rgb) {
+    double sat = s / 63.0, val = v / 63.0;
+    double c = val * sat;
+    double hp = (h % 360) / 60.0;
+    double x = c * (1 - fabs(fmod(hp, 2) - 1));
+    double m = val - c;
+
+    double r = 0, g = 0, b = 0;
+    switch ((int)hp) {
+        case 0: r = c; g = x; break;
+        case 1: r = x; g = c; break;
+        case 2: g = c; b = x; break;
+        case 3: g = x; b = c; break;
+        case 4: r = x; b = c; break;
+        default: r = c; b = x; break;
+    }
+
+    rgb[0] = lround((r + m) * 255);
+    rgb[1] = lround((g + m) * 255);
+    rgb[2] = lround((b + m) * 255);
+}
+
+static void testHSV(void) {
+    // Primary and secondary hues are exact
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(0, 63, 63)), COLOR_RED);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(120, 63, 63)), COLOR_GREEN);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(240, 63, 63)), COLOR_BLUE);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(60, 63, 63)), 0x00ffff00);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(180, 63, 63)), 0x0000ffff);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(300, 63, 63)), 0x00ff00ff);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_hsv(0, 0, 63)), COLOR_WHITE);
+
+    int worst = 0;
+    for (int h = 0; h < 360; h++) {
+        for (int s = 0; s <= 63; s++) {
+            for (int v = 0; v <= 63; v++) {
+                color_ffxt color = ffx_color_hsv2rgb(ffx_color_hsv(h, s, v));
+
+                int rgb[3];
+                referenceHSV(h, s, v, rgb);
+
+                for (int i = 0; i < 3; i++) {
+                    int value = (color >> (16 - 8 * i)) & 0xff;
+                    int error = abs(value - rgb[i]);
+                    if (error > worst) { worst = error; }
+                }
+            }
+        }
+    }
+
+    check(worst <= 5);
+
+    // A ramp through HSV colors lands on each stop
+    color_ffxt ramp[] = {
+        ffx_color_hsv(0, 63, 63), ffx_color_hsv(120, 63, 63),
+        ffx_color_hsv(240, 63, 63)
+    };
+    checkEqual(ffx_color_hsv2rgb(ffx_color_lerpColorRamp(ramp, 3, 0)),
+      COLOR_RED);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_lerpColorRamp(ramp, 3, FM_1 / 2)),
+      COLOR_GREEN);
+    checkEqual(ffx_color_hsv2rgb(ffx_color_lerpColorRamp(ramp, 3, FM_1)),
+      COLOR_BLUE);
+}
+
+
+//////////////////////////
+// Blending
+
+#define SPAN      (16)
+
+static void testBlend(void) {
+    uint16_t fragment[SPAN];
+
+    uint32_t seed = 29;
+    for (int i = 0; i < 2000; i++) {
+        color_ffxt color = ffx_color_rgba(testRandom(&seed) & 0xff,
+          testRandom(&seed) & 0xff, testRandom(&seed) & 0xff,
+          testRandom(&seed) % (MAX_OPACITY + 1));
+        uint16_t bg = testRandom(&seed);
+
+        FfxColorRGB565 prepared = ffx_color_parseRGB565(color);
+        checkEqual(prepared.rgb16, ffx_color_rgb16(color));
+        checkEqual(prepared.opacity, ffx_color_getOpacity(color));
+
+        for (int x = 0; x < SPAN; x++) { fragment[x] = bg; }
+        _ffx_renderBox(fragment, SPAN, 0, 0, SPAN, 1, &prepared);
+
+        // Every pixel of the span is the same blend
+        for (int x = 1; x < SPAN; x++) {
+            checkEqual(fragment[x], fragment[0]);
+        }
+
+        // Each channel, in RGB565 depth, is within one of the float blend
+        double alpha = prepared.opacity / (double)MAX_OPACITY;
+        double fg[3] = {
+            ((color >> 16) & 0xff) / 8.0, ((color >> 8) & 0xff) / 4.0,
+            (color & 0xff) / 8.0
+        };
+        int back[3] = { bg >> 11, (bg >> 5) & 0x3f, bg & 0x1f };
+        int out[3] = {
+            fragment[0] >> 11, (fragment[0] >> 5) & 0x3f, fragment[0] & 0x1f
+        };
+
+        for (int c = 0; c < 3; c++) {
+            double expected = fg[c] * alpha + back[c] * (1 - alpha);
+            check(fabs(out[c] - expected) <= 1.0);
+        }
+    }
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAGMENTS   (200000)
+
+static void benchmark(void) {
+    static uint16_t fragment[WIDTH * FRAGMENT_HEIGHT];
+
+    // A small partially transparent HSV box, which is the worst case for
+    // a per-fragment conversion; the box spans one fragment row
+    color_ffxt color = ffx_color_hsva(200, 40, 50, 20);
+    const int32_t width = 8, height = 1;
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAGMENTS; i++) {
+        FfxColorRGB565 prepared = ffx_color_parseRGB565(color + (i & 1));
+        _ffx_renderBox(fragment, WIDTH, i % 200, 0, width, height,
+          &prepared);
+    }
+    double converted = testNow() - start;
+
+    FfxColorRGB565 prepared = ffx_color_parseRGB565(color);
+    start = testNow();
+    for (int i = 0; i < BENCH_FRAGMENTS; i++) {
+        _ffx_renderBox(fragment, WIDTH, i % 200, 0, width, height,
+          &prepared);
+    }
+    double cached = testNow() - start;
+
+    start = testNow();
+    uint32_t sum = 0;
+    for (int h = 0; h < 360; h++) {
+        for (int s = 0; s <= 63; s++) {
+            for (int v = 0; v <= 63; v++) {
+                sum += ffx_color_hsv2rgb(ffx_color_hsv(h, s, v));
+            }
+        }
+    }
+    double hsv = testNow() - start;
+    check(sum != 0);
+
+    printf("bench: per fragment; converted %.1fns, prepared %.1fns; "
+      "hsv2rgb %.1fns\n", converted * 1000 / BENCH_FRAGMENTS,
+      cached * 1000 / BENCH_FRAGMENTS, hsv * 1000 / (360 * 64 * 64));
+}
+
+
+int main(void) {
+    testHSV();
+    testBlend();
+    benchmark();
+    return 0;
+}
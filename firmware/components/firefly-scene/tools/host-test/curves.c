@@ -0,0 +1,317 @@
+#include <math.h>
+
+#include "test.h"
+
+// Curves (see: ../../src/curves.c)
+//
+// - every built-in curve is within its bound of the double-precision
+//   formula at every fixed-point t in [0, 1], and exact at both ends
+// - cubic-bezier curves match a double-precision solve, identical
+//   control points share a curve, and invalid or too many curves are
+//   rejected
+// - the error and ns/eval of each curve, and the cost of creating a
+//   cubic-bezier curve
+
+
+//////////////////////////
+// Reference
+
+// See: https://easings.net/
+static double bounceOut(double t) {
+    const double n1 = 7.5625, d1 = 2.75;
+    if (t < 1 / d1) { return n1 * t * t; }
+    if (t < 2 / d1) { t -= 1.5 / d1; return n1 * t * t + 0.75; }
+    if (t < 2.5 / d1) { t -= 2.25 / d1; return n1 * t * t + 0.9375; }
+    t -= 2.625 / d1;
+    return n1 * t * t + 0.984375;
+}
+
+static double inSine(double t) { return 1 - cos(t * M_PI / 2); }
+static double outSine(double t) { return sin(t * M_PI / 2); }
+static double inOutSine(double t) { return -(cos(M_PI * t) - 1) / 2; }
+
+static double inQuad(double t) { return t * t; }
+static double outQuad(double t) { return 1 - (1 - t) * (1 - t); }
+static double inOutQuad(double t) {
+    return (t < 0.5) ? 2 * t * t: 1 - pow(-2 * t + 2, 2) / 2;
+}
+
+static double inCubic(double t) { return t * t * t; }
+static double outCubic(double t) { return 1 - pow(1 - t, 3); }
+static double inOutCubic(double t) {
+    return (t < 0.5) ? 4 * t * t * t: 1 - pow(-2 * t + 2, 3) / 2;
+}
+
+static double inQuart(double t) { return pow(t, 4); }
+static double outQuart(double t) { return 1 - pow(1 - t, 4); }
+static double inOutQuart(double t) {
+    return (t < 0.5) ? 8 * pow(t, 4): 1 - pow(-2 * t + 2, 4) / 2;
+}
+
+static double inQuint(double t) { return pow(t, 5); }
+static double outQuint(double t) { return 1 - pow(1 - t, 5); }
+static double inOutQuint(double t) {
+    return (t < 0.5) ? 16 * pow(t, 5): 1 - pow(-2 * t + 2, 5) / 2;
+}
+
+static double inExpo(double t) {
+    return (t == 0) ? 0: pow(2, 10 * t - 10);
+}
+static double outExpo(double t) {
+    return (t == 1) ? 1: 1 - pow(2, -10 * t);
+}
+static double inOutExpo(double t) {
+    if (t == 0 || t == 1) { return t; }
+    return (t < 0.5) ? pow(2, 20 * t - 10) / 2:
+      (2 - pow(2, -20 * t + 10)) / 2;
+}
+
+static double inBack(double t) {
+    const double c1 = 1.70158, c3 = c1 + 1;
+    return c3 * t * t * t - c1 * t * t;
+}
+static double outBack(double t) {
+    const double c1 = 1.70158, c3 = c1 + 1;
+    return 1 + c3 * pow(t - 1, 3) + c1 * pow(t - 1, 2);
+}
+
+static double inElastic(double t) {
+    const double c4 = (2 * M_PI) / 3;
+    if (t == 0 || t == 1) { return t; }
+    return -pow(2, 10 * t - 10) * sin((t * 10 - 10.75) * c4);
+}
+static double outElastic(double t) {
+    const double c4 = (2 * M_PI) / 3;
+    if (t == 0 || t == 1) { return t; }
+    return pow(2, -10 * t) * sin((t * 10 - 0.75) * c4) + 1;
+}
+static double inOutElastic(double t) {
+    const double c5 = (2 * M_PI) / 4.5;
+    if (t == 0 || t == 1) { return t; }
+    if (t < 0.5) {
+        return -(pow(2, 20 * t - 10) * sin((20 * t - 11.125) * c5)) / 2;
+    }
+    return (pow(2, -20 * t + 10) * sin((20 * t - 11.125) * c5)) / 2 + 1;
+}
+
+static double inBounce(double t) { return 1 - bounceOut(1 - t); }
+static double inOutBounce(double t) {
+    return (t < 0.5) ? (1 - bounceOut(1 - 2 * t)) / 2:
+      (1 + bounceOut(2 * t - 1)) / 2;
+}
+
+static double linear(double t) { return t; }
+
+// Tables are 256 segments of 2.14 samples, so the curves with the
+// sharpest bends are furthest off; the polynomials are computed
+static const struct {
+    const char *name;
+    FfxCurveFunc curve;
+    double (*reference)(double t);
+    double bound;
+} curves[] = {
+    { "Linear", FfxCurveLinear, linear, 0 },
+    { "InSine", FfxCurveEaseInSine, inSine, 0.0001 },
+    { "OutSine", FfxCurveEaseOutSine, outSine, 0.0001 },
+    { "InOutSine", FfxCurveEaseInOutSine, inOutSine, 0.0001 },
+    { "InQuad", FfxCurveEaseInQuad, inQuad, 0.0001 },
+    { "OutQuad", FfxCurveEaseOutQuad, outQuad, 0.0001 },
+    { "InOutQuad", FfxCurveEaseInOutQuad, inOutQuad, 0.0001 },
+    { "InCubic", FfxCurveEaseInCubic, inCubic, 0.0001 },
+    { "OutCubic", FfxCurveEaseOutCubic, outCubic, 0.0001 },
+    { "InOutCubic", FfxCurveEaseInOutCubic, inOutCubic, 0.0001 },
+    { "InQuart", FfxCurveEaseInQuart, inQuart, 0.0001 },
+    { "OutQuart", FfxCurveEaseOutQuart, outQuart, 0.0001 },
+    { "InOutQuart", FfxCurveEaseInOutQuart, inOutQuart, 0.0001 },
+    { "InQuint", FfxCurveEaseInQuint, inQuint, 0.0001 },
+    { "OutQuint", FfxCurveEaseOutQuint, outQuint, 0.0001 },
+    { "InOutQuint", FfxCurveEaseInOutQuint, inOutQuint, 0.0003 },
+    { "InExpo", FfxCurveEaseInExpo, inExpo, 0.001 },
+    { "OutExpo", FfxCurveEaseOutExpo, outExpo, 0.001 },
+    { "InOutExpo", FfxCurveEaseInOutExpo, inOutExpo, 0.001 },
+    { "InBack", FfxCurveEaseInBack, inBack, 0.0001 },
+    { "OutBack", FfxCurveEaseOutBack, outBack, 0.0001 },
+    { "InElastic", FfxCurveEaseInElastic, inElastic, 0.001 },
+    { "OutElastic", FfxCurveEaseOutElastic, outElastic, 0.001 },
+    { "InOutElastic", FfxCurveEaseInOutElastic, inOutElastic, 0.001 },
+    { "InBounce", FfxCurveEaseInBounce, inBounce, 0.0001 },
+    { "OutBounce", FfxCurveEaseOutBounce, bounceOut, 0.0001 },
+    { "InOutBounce", FfxCurveEaseInOutBounce, inOutBounce, 0.0001 },
+};
+
+#define CURVE_COUNT    (sizeof(curves) / sizeof(curves[0]))
+
+// The largest error of %%curve%% over every t in [0, 1]
+static double maxError(FfxCurveFunc curve, double (*reference)(double t)) {
+    double error = 0;
+    for (fixed_ffxt t = 0; t <= FM_1; t++) {
+        double e = fabs(curve(t) / 65536.0 - reference(t / 65536.0));
+        if (e > error) { error = e; }
+    }
+    return error;
+}
+
+
+//////////////////////////
+// Built-in
+
+static double errors[CURVE_COUNT];
+
+static void testBuiltIn(void) {
+    for (int i = 0; i < CURVE_COUNT; i++) {
+        errors[i] = maxError(curves[i].curve, curves[i].reference);
+        check(errors[i] <= curves[i].bound);
+
+        checkEqual(curves[i].curve(0), 0);
+        checkEqual(curves[i].curve(FM_1), FM_1);
+    }
+}
+
+
+//////////////////////////
+// Cubic-Bezier
+
+typedef struct Bezier {
+    double x1, y1, x2, y2;
+} Bezier;
+
+static double cubic(double p1, double p2, double s) {
+    return 3 * (1 - s) * (1 - s) * s * p1 + 3 * (1 - s) * s * s * p2 +
+      s * s * s;
+}
+
+// Bisects x for the curve parameter, which is monotonic in x
+static double bezierAt(const Bezier *bezier, double x) {
+    double lo = 0, hi = 1;
+    for (int i = 0; i < 60; i++) {
+        double s = (lo + hi) / 2;
+        if (cubic(bezier->x1, bezier->x2, s) < x) {
+            lo = s;
+        } else {
+            hi = s;
+        }
+    }
+    return cubic(bezier->y1, bezier->y2, (lo + hi) / 2);
+}
+
+static const Bezier *currentBezier;
+static double bezierReference(double t) {
+    return bezierAt(currentBezier, t);
+}
+
+static FfxCurveFunc createBezier(const Bezier *bezier) {
+    return ffx_curve_createCubicBezier(lround(bezier->x1 * 65536),
+      lround(bezier->y1 * 65536), lround(bezier->x2 * 65536),
+      lround(bezier->y2 * 65536));
+}
+
+static const struct {
+    const char *name;
+    Bezier bezier;
+    double bound;
+} beziers[] = {
+    { "ease", { 0.25, 0.1, 0.25, 1 }, 0.0002 },
+    { "ease-in", { 0.42, 0, 1, 1 }, 0.0002 },
+    { "ease-out", { 0, 0, 0.58, 1 }, 0.0002 },
+    { "ease-in-out", { 0.42, 0, 0.58, 1 }, 0.0002 },
+    { "back", { 0.68, -0.6, 0.32, 1.6 }, 0.0005 },
+
+    // Vertical tangents make a step, which the table rounds off
+    { "step", { 1, 0, 0, 1 }, 0.08 },
+};
+
+#define BEZIER_COUNT   (sizeof(beziers) / sizeof(beziers[0]))
+
+static FfxCurveFunc bezierCurves[BEZIER_COUNT];
+
+// Curves are never freed, so each is only created once; creation is
+// timed here for the benchmark
+static double createCost;
+
+static void testBezier(void) {
+    for (int i = 0; i < BEZIER_COUNT; i++) {
+        double start = testNow();
+        bezierCurves[i] = createBezier(&beziers[i].bezier);
+        createCost += (testNow() - start) / BEZIER_COUNT;
+        check(bezierCurves[i] != NULL);
+
+        currentBezier = &beziers[i].bezier;
+        check(maxError(bezierCurves[i], bezierReference) <=
+          beziers[i].bound);
+
+        checkEqual(bezierCurves[i](0), 0);
+        checkEqual(bezierCurves[i](FM_1), FM_1);
+
+        // Clamped outside [0, 1]
+        checkEqual(bezierCurves[i](-5), 0);
+        checkEqual(bezierCurves[i](FM_1 + 5), FM_1);
+    }
+
+    // The same control points share a curve
+    check(createBezier(&beziers[1].bezier) == bezierCurves[1]);
+
+    // x outside [0, 1]
+    check(ffx_curve_createCubicBezier(-1, 0, FM_1, FM_1) == NULL);
+    check(ffx_curve_createCubicBezier(0, 0, FM_1 + 1, FM_1) == NULL);
+
+    // Only 8 distinct curves
+    for (int i = BEZIER_COUNT; i < 8; i++) {
+        check(ffx_curve_createCubicBezier(i * 0x1000, 0, FM_1, FM_1));
+    }
+    check(ffx_curve_createCubicBezier(0x123, 0, FM_1, FM_1) == NULL);
+    check(createBezier(&beziers[0].bezier) == bezierCurves[0]);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_EVALS    (4 * 1024 * 1024)
+
+// Accumulated so the evaluations are not optimized away
+static volatile fixed_ffxt sink;
+
+static double benchmarkCurve(FfxCurveFunc curve) {
+    uint32_t sum = 0;
+    double start = testNow();
+    for (int i = 0; i < BENCH_EVALS; i++) { sum += curve(i & 0xffff); }
+    double duration = testNow() - start;
+    sink = sum;
+    return 1000 * duration / BENCH_EVALS;
+}
+
+static double benchmarkReference(double (*reference)(double t)) {
+    double sum = 0;
+    double start = testNow();
+    for (int i = 0; i < BENCH_EVALS; i++) {
+        sum += reference((i & 0xffff) / 65536.0);
+    }
+    double duration = testNow() - start;
+    sink = sum;
+    return 1000 * duration / BENCH_EVALS;
+}
+
+static void benchmark(void) {
+    for (int i = 0; i < CURVE_COUNT; i++) {
+        printf("bench: %-12s max error %.6f; %.1fns/eval (double %.1fns)\n",
+          curves[i].name, errors[i], benchmarkCurve(curves[i].curve),
+          benchmarkReference(curves[i].reference));
+    }
+
+    for (int i = 0; i < BEZIER_COUNT; i++) {
+        currentBezier = &beziers[i].bezier;
+        printf("bench: bezier %-11s max error %.6f; %.1fns/eval\n",
+          beziers[i].name, maxError(bezierCurves[i], bezierReference),
+          benchmarkCurve(bezierCurves[i]));
+    }
+
+    printf("bench: create cubic-bezier %.1fus\n", createCost);
+}
+
+
+int main(void) {
+    testBuiltIn();
+    testBezier();
+    benchmark();
+    return 0;
+}
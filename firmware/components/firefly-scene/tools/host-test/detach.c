@@ -0,0 +1,358 @@
+#include "test.h"
+
+// Detach and reattach (see: ../../src/node.c and ../../src/node-group.c)
+//
+// - append, insertBefore and moving an existing child keep the sibling
+//   links in order, and a group is never added into its own subtree
+// - a detached subtree keeps running its animations and is added back
+//   intact; detaching cancels a pending remove
+// - an anchor with its child detached still walks and sequences
+// - freeing a subtree releases its running and pending animations and
+//   the batch commands which reference it
+// - the batch insertBefore and detach commands
+// - allocations and time to recycle a list row, removed and recreated
+//   versus moved
+
+
+static FfxNode createBox(FfxScene scene) {
+    FfxNode node = ffx_scene_createBox(scene, ffx_size(10, 10));
+    check(node != NULL);
+    return node;
+}
+
+// Check the children of %%group%% are exactly %%children%%, in order,
+// both forward and through their parent link
+static void checkChildren(FfxNode group, FfxNode *children, int count) {
+    FfxNode child = ffx_sceneGroup_getFirstChild(group);
+    for (int i = 0; i < count; i++) {
+        check(child == children[i]);
+        check(ffx_sceneNode_getParent(child) == group);
+        child = ffx_sceneNode_getNextSibling(child);
+    }
+    check(child == NULL);
+}
+
+
+//////////////////////////
+// Lists
+
+static void testOrder(void) {
+    FfxScene scene = testScene();
+    FfxNode group = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), group);
+
+    FfxNode a = createBox(scene), b = createBox(scene);
+    FfxNode c = createBox(scene), d = createBox(scene);
+
+    ffx_sceneGroup_appendChild(group, a);
+    ffx_sceneGroup_appendChild(group, c);
+    ffx_sceneGroup_insertBefore(group, b, c);
+    ffx_sceneGroup_insertBefore(group, d, NULL);
+    checkChildren(group, (FfxNode[]){ a, b, c, d }, 4);
+
+    // Moving existing children
+    ffx_sceneGroup_appendChild(group, a);
+    checkChildren(group, (FfxNode[]){ b, c, d, a }, 4);
+    ffx_sceneGroup_insertBefore(group, d, b);
+    checkChildren(group, (FfxNode[]){ d, b, c, a }, 4);
+    ffx_sceneGroup_insertBefore(group, c, a);
+    checkChildren(group, (FfxNode[]){ d, b, c, a }, 4);
+
+    // Detaching the first, middle and last
+    ffx_sceneNode_detach(d);
+    ffx_sceneNode_detach(c);
+    ffx_sceneNode_detach(a);
+    check(ffx_sceneNode_getParent(a) == NULL);
+    check(ffx_sceneNode_getNextSibling(a) == NULL);
+    checkChildren(group, (FfxNode[]){ b }, 1);
+
+    // Detaching a detached node does nothing
+    ffx_sceneNode_detach(a);
+
+    // Moving between groups; a child of another group is refused until
+    // it is detached
+    FfxNode other = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), other);
+    ffx_sceneGroup_appendChild(other, a);
+    ffx_sceneGroup_appendChild(other, b);
+    checkChildren(group, (FfxNode[]){ b }, 1);
+    ffx_sceneNode_detach(b);
+    ffx_sceneGroup_appendChild(other, b);
+    checkChildren(group, NULL, 0);
+    checkChildren(other, (FfxNode[]){ a, b }, 2);
+
+    // A group cannot be added below itself
+    ffx_sceneNode_detach(group);
+    ffx_sceneGroup_appendChild(other, group);
+    ffx_sceneNode_detach(other);
+    ffx_sceneGroup_appendChild(group, other);
+    check(ffx_sceneNode_getParent(other) == NULL);
+    checkChildren(other, (FfxNode[]){ a, b, group }, 3);
+    checkChildren(group, NULL, 0);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), other);
+
+    // The scene frees what is attached, the rest is freed directly
+    ffx_sceneNode_free(c);
+    ffx_sceneNode_free(d);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Parking
+
+static void setupMove(FfxNode node, FfxNodeAnimation *animation,
+  void *arg) {
+    animation->duration = 100;
+    ffx_sceneNode_setPosition(node, ffx_point(100, 0));
+}
+
+static int completions;
+
+static void onComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg) {
+    checkEqual(stopType, FfxSceneActionStopNormal);
+    completions++;
+}
+
+static void setupCounted(FfxNode node, FfxNodeAnimation *animation,
+  void *arg) {
+    setupMove(node, animation, arg);
+    animation->onComplete = onComplete;
+}
+
+static void testPark(void) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+
+    FfxNode row = ffx_scene_createGroup(scene);
+    FfxNode box = createBox(scene);
+    ffx_sceneGroup_appendChild(row, box);
+    ffx_sceneGroup_appendChild(root, row);
+
+    // Each sequence steps animations to the time of the one before
+    completions = 0;
+    ffx_sceneNode_animate(box, setupCounted, NULL);
+    testSequence(scene, 1);
+    testSequence(scene, 40);
+    testSequence(scene, 0);
+    int16_t x = ffx_sceneNode_getPosition(box).x;
+    check(x > 0 && x < 100);
+
+    // Parked, the animation keeps running and nothing is freed
+    uint32_t live = testLive();
+    ffx_sceneNode_detach(row);
+    testSequence(scene, 20);
+    testSequence(scene, 0);
+    checkEqual(ffx_sceneNode_getPosition(box).x, x + 20);
+    checkEqual(completions, 0);
+
+    // Added back, it finishes where it would have
+    ffx_sceneGroup_appendChild(root, row);
+    testSequence(scene, 100);
+    testSequence(scene, 0);
+    checkEqual(ffx_sceneNode_getPosition(box).x, 100);
+    checkEqual(completions, 1);
+    check(ffx_sceneGroup_getFirstChild(row) == box);
+    check(testLive() <= live);
+
+    // A pending remove is cancelled by detaching
+    ffx_sceneNode_remove(row);
+    ffx_sceneNode_detach(row);
+    testSequence(scene, 1);
+    ffx_sceneGroup_appendChild(root, row);
+    testSequence(scene, 1);
+    check(ffx_sceneNode_getParent(row) == root);
+
+    // Removed for real
+    ffx_sceneNode_remove(row);
+    testSequence(scene, 1);
+    check(ffx_sceneGroup_getFirstChild(root) == NULL);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testAnchor(void) {
+    FfxScene scene = testScene();
+    FfxNode box = createBox(scene);
+    FfxNode anchor = ffx_scene_createAnchor(scene, 1, 4, box);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), anchor);
+
+    check(ffx_sceneNode_getParent(box) == anchor);
+    ffx_sceneNode_detach(box);
+    check(ffx_sceneAnchor_getChild(anchor) == NULL);
+    check(ffx_sceneNode_getParent(box) == NULL);
+
+    // An empty anchor still sequences and renders
+    static uint16_t frame[WIDTH * HEIGHT];
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), box);
+    testSequence(scene, 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Freeing
+
+static void testFreeSubtree(void) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+
+    FfxNode row = ffx_scene_createGroup(scene);
+    FfxNode box = createBox(scene);
+    FfxNode label = ffx_scene_createLabel(scene, FfxFontMedium, "row");
+    ffx_sceneGroup_appendChild(row, box);
+    ffx_sceneGroup_appendChild(row, label);
+    ffx_sceneGroup_appendChild(root, row);
+
+    // A running animation, a pending one and batch commands all refer
+    // to the subtree when it is freed
+    completions = 0;
+    ffx_sceneNode_animate(box, setupCounted, NULL);
+    testSequence(scene, 10);
+    ffx_sceneNode_animate(label, setupCounted, NULL);
+
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_setPosition(batch, box, ffx_point(5, 5));
+    ffx_sceneBatch_detach(batch, label);
+    ffx_sceneBatch_commit(batch);
+
+    ffx_sceneNode_free(row);
+    check(ffx_sceneGroup_getFirstChild(root) == NULL);
+
+    // Nothing left references the freed nodes (ASan would catch it)
+    testSequence(scene, 200);
+
+    // Both the running and pending animation complete once, as their
+    // nodes were removed
+    checkEqual(completions, 2);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Batches
+
+static void testBatch(void) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+
+    FfxNode a = createBox(scene), b = createBox(scene);
+    ffx_sceneGroup_appendChild(root, a);
+
+    FfxSceneBatch batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_insertBefore(batch, root, b, a);
+    ffx_sceneBatch_detach(batch, a);
+    ffx_sceneBatch_commit(batch);
+
+    // Nothing applies until the scene is sequenced
+    checkChildren(root, (FfxNode[]){ a }, 1);
+    testSequence(scene, 1);
+    checkChildren(root, (FfxNode[]){ b }, 1);
+    check(ffx_sceneNode_getParent(a) == NULL);
+
+    batch = ffx_scene_beginBatch(scene);
+    ffx_sceneBatch_insertBefore(batch, root, a, b);
+    ffx_sceneBatch_commit(batch);
+    testSequence(scene, 1);
+    checkChildren(root, (FfxNode[]){ a, b }, 2);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define ROWS             (20)
+#define SCROLLS          (2000)
+
+static FfxNode createRow(FfxScene scene) {
+    FfxNode row = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(row, createBox(scene));
+    ffx_sceneGroup_appendChild(row,
+      ffx_scene_createLabel(scene, FfxFontMedium, "row"));
+    return row;
+}
+
+// Scroll a list by one row per sequence, either removing the first row
+// and creating a new one, or moving the first row to the end; the cost
+// of the sequence itself is not counted
+static void benchmarkScroll(bool recycle, double *allocs, double *ns) {
+    FfxScene scene = testScene();
+    FfxNode list = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), list);
+
+    for (int i = 0; i < ROWS; i++) {
+        ffx_sceneGroup_appendChild(list, createRow(scene));
+    }
+
+    // Grow the pools before counting
+    for (int i = 0; i < ROWS; i++) {
+        ffx_sceneNode_remove(ffx_sceneGroup_getFirstChild(list));
+        ffx_sceneGroup_appendChild(list, createRow(scene));
+        testSequence(scene, 1);
+    }
+
+    // Each sequence allocates its renders; count those alone first
+    uint32_t before = atomic_load(&testHeap.allocs);
+    double start = testNow();
+    for (int i = 0; i < SCROLLS; i++) { testSequence(scene, 1); }
+    double base = testNow() - start;
+    uint32_t baseAllocs = atomic_load(&testHeap.allocs) - before;
+
+    before = atomic_load(&testHeap.allocs);
+    start = testNow();
+
+    for (int i = 0; i < SCROLLS; i++) {
+        FfxNode first = ffx_sceneGroup_getFirstChild(list);
+        if (recycle) {
+            ffx_sceneGroup_appendChild(list, first);
+        } else {
+            ffx_sceneNode_remove(first);
+            ffx_sceneGroup_appendChild(list, createRow(scene));
+        }
+        testSequence(scene, 1);
+    }
+
+    *ns = 1000 * (testNow() - start - base) / SCROLLS;
+    *allocs = (double)(atomic_load(&testHeap.allocs) - before -
+      baseAllocs) / SCROLLS;
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void benchmark(void) {
+    double recreateAllocs, recreateNs, moveAllocs, moveNs;
+    benchmarkScroll(false, &recreateAllocs, &recreateNs);
+    benchmarkScroll(true, &moveAllocs, &moveNs);
+
+    // Moving allocates nothing at all
+    checkEqual(moveAllocs, 0);
+
+    printf("bench: %d-row list, per row scrolled: remove+recreate %.2f "
+      "heap allocs, %.0fns; move to end %.2f allocs, %.0fns\n", ROWS,
+      recreateAllocs, recreateNs, moveAllocs, moveNs);
+}
+
+
+int main(void) {
+    testOrder();
+    testPark();
+    testAnchor();
+    testFreeSubtree();
+    testBatch();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,308 @@
+#include <math.h>
+
+#include "test.h"
+
+// Fixed-point math (see: ../../src/fixed.c)
+//
+// - the max and mean error, in ULPs of 2^-16, of sinfx, cosfx, log2fx,
+//   exp2fx, sqrtfx and atan2fx against libm across each input range;
+//   exhaustively where feasible and strided across the rest
+// - sqrtfx is correctly rounded and isqrt32 is exact
+// - the edges: non-positive log2 and sqrt, exp2 under and overflow
+//   and atan2 of the origin and each axis
+// - the lerp and vector helpers, including lengths near overflow
+// - the ns/call of each function against its libm equivalent
+
+#define ULP     (65536.0)
+
+static double fromfx(fixed_ffxt x) { return x / ULP; }
+
+
+//////////////////////////
+// Error
+
+typedef struct Error {
+    double max;
+    double total;
+    uint64_t count;
+} Error;
+
+static void addError(Error *error, double e) {
+    e = fabs(e);
+    if (e > error->max) { error->max = e; }
+    error->total += e;
+    error->count++;
+}
+
+static double meanError(const Error *error) {
+    return error->count ? error->total / error->count: 0;
+}
+
+// The errors measured, reported by the benchmark
+static Error sinError, sinWideError, cosError, log2Error, exp2Error;
+static Error sqrtError, atan2Error;
+
+// Walks every x in [lo, hi] by %%step%%
+#define forRange(x, lo, hi, step) \
+    for (int64_t x = (lo); x <= (hi); x += (step))
+
+
+//////////////////////////
+// Trigonometry
+
+static void testTrig(void) {
+    // Every input within two turns either way
+    forRange(x, -7 * 65536, 7 * 65536, 1) {
+        addError(&sinError, sinfx(x) - sin(fromfx(x)) * ULP);
+        addError(&cosError, cosfx(x) - cos(fromfx(x)) * ULP);
+    }
+    check(sinError.max < 1.5);
+    check(meanError(&sinError) < 0.5);
+    check(cosError.max < 1.5);
+    check(meanError(&cosError) < 0.5);
+
+    // The whole range; the reduction to a turn adds a little
+    forRange(x, INT32_MIN, INT32_MAX, 4099) {
+        addError(&sinWideError, sinfx(x) - sin(fromfx(x)) * ULP);
+    }
+    check(sinWideError.max < 3);
+    check(meanError(&sinWideError) < 1);
+
+    // Exact at the quadrants of each turn
+    checkEqual(sinfx(0), 0);
+    checkEqual(cosfx(0), FM_1);
+    checkEqual(sinfx(FM_PI_2), FM_1);
+    checkEqual(cosfx(FM_PI), -FM_1);
+    checkEqual(sinfx(FM_3PI_2), -FM_1);
+}
+
+static void testAtan2(void) {
+    // Points on rings of every magnitude, around the whole circle
+    uint32_t seed = 11;
+    for (int bits = 1; bits < 31; bits++) {
+        for (int i = 0; i < 20000; i++) {
+            int64_t scale = 1 << bits;
+            int32_t x = (int64_t)(testRandom(&seed) % (2 * scale)) - scale;
+            int32_t y = (int64_t)(testRandom(&seed) % (2 * scale)) - scale;
+            if (x == 0 && y == 0) { continue; }
+            addError(&atan2Error, atan2fx(y, x) - atan2(y, x) * ULP);
+        }
+    }
+    check(atan2Error.max < 2.5);
+    check(meanError(&atan2Error) < 0.75);
+
+    checkEqual(atan2fx(0, 0), 0);
+    checkEqual(atan2fx(0, FM_1), 0);
+    checkEqual(atan2fx(FM_1, 0), FM_PI_2);
+    checkEqual(atan2fx(-FM_1, 0), -FM_PI_2);
+    checkEqual(atan2fx(0, -FM_1), FM_PI);
+    checkEqual(atan2fx(INT32_MIN, INT32_MIN), -FM_PI + FM_PI_2 / 2);
+}
+
+
+//////////////////////////
+// Logarithms
+
+static void testLog2(void) {
+    // Every input below 16, then every 97th to the largest
+    forRange(x, 1, 16 * 65536, 1) {
+        addError(&log2Error, log2fx(x) - log2(fromfx(x)) * ULP);
+    }
+    forRange(x, 16 * 65536, INT32_MAX, 97) {
+        addError(&log2Error, log2fx(x) - log2(fromfx(x)) * ULP);
+    }
+    addError(&log2Error, log2fx(INT32_MAX) - log2(fromfx(INT32_MAX)) * ULP);
+    check(log2Error.max < 0.6);
+    check(meanError(&log2Error) < 0.3);
+
+    checkEqual(log2fx(FM_1), 0);
+    checkEqual(log2fx(tofx(1024)), tofx(10));
+    checkEqual(log2fx(0), FM_MIN);
+    checkEqual(log2fx(-FM_1), FM_MIN);
+}
+
+static void testExp2(void) {
+    // Every input which neither underflows nor overflows; results
+    // above 1 are only as precise as the 32-bit approximation, so
+    // they are measured in ULPs relative to themselves (i.e. 2^-16 of
+    // the result)
+    forRange(x, -16 * 65536, 15 * 65536 - 1, 1) {
+        double expected = exp2(fromfx(x)) * ULP;
+        double ulp = (expected > ULP) ? expected / ULP: 1;
+        addError(&exp2Error, (exp2fx(x) - expected) / ulp);
+    }
+    check(exp2Error.max < 1);
+    check(meanError(&exp2Error) < 0.2);
+
+    checkEqual(exp2fx(0), FM_1);
+    checkEqual(exp2fx(tofx(10)), tofx(1024));
+    checkEqual(exp2fx(-FM_1), FM_1_2);
+    checkEqual(exp2fx(tofx(-17)), 0);
+    checkEqual(exp2fx(tofx(15)), FM_MAX);
+    checkEqual(exp2fx(FM_MAX), FM_MAX);
+    checkEqual(exp2fx(FM_MIN), 0);
+
+    // Composed from both
+    check(abs(powfx(tofx(3), FM_1_2) - (fixed_ffxt)(sqrt(3) * ULP)) < 4);
+}
+
+
+//////////////////////////
+// Roots
+
+static void checkSqrt(fixed_ffxt x) {
+    double expected = sqrt(fromfx(x)) * ULP;
+    fixed_ffxt actual = sqrtfx(x);
+    addError(&sqrtError, actual - expected);
+
+    // Correctly rounded: (r - 1/2)^2 <= x < (r + 1/2)^2
+    uint64_t square = (uint64_t)x << 16;
+    uint64_t r2 = (uint64_t)actual * actual;
+    check(r2 - actual < square);
+    check(r2 + actual >= square);
+}
+
+static void testSqrt(void) {
+    forRange(x, 1, 16 * 65536, 1) { checkSqrt(x); }
+    forRange(x, 16 * 65536, INT32_MAX, 89) { checkSqrt(x); }
+    checkSqrt(INT32_MAX);
+    check(sqrtError.max <= 0.5);
+
+    checkEqual(sqrtfx(0), 0);
+    checkEqual(sqrtfx(-FM_1), 0);
+    checkEqual(sqrtfx(tofx(4)), tofx(2));
+    checkEqual(sqrtfx(FM_1_4), FM_1_2);
+
+    // Exact integer roots, either side of every square
+    uint32_t seed = 5;
+    for (int i = 0; i < 1000000; i++) {
+        uint32_t value = testRandom(&seed);
+        uint32_t root = isqrt32(value);
+        check((uint64_t)root * root <= value);
+        check((uint64_t)(root + 1) * (root + 1) > value);
+    }
+    for (uint32_t r = 1; r < 65536; r += 7) {
+        checkEqual(isqrt32(r * r), r);
+        checkEqual(isqrt32(r * r - 1), r - 1);
+    }
+    checkEqual(isqrt32(0), 0);
+    checkEqual(isqrt32(UINT32_MAX), 65535);
+}
+
+
+//////////////////////////
+// Vectors
+
+static void testVectors(void) {
+    checkEqual(lerpfx(tofx(10), tofx(20), FM_1_4), tofx(10) + tofx(10) / 4);
+    checkEqual(lerpfx(tofx(20), tofx(10), 0), tofx(20));
+    checkEqual(lerpfx(tofx(20), tofx(10), FM_1), tofx(10));
+
+    vec2_ffxt a = vec2fx(tofx(-4), tofx(8));
+    vec2_ffxt b = vec2fx(tofx(4), tofx(0));
+    vec2_ffxt mid = lerp2fx(a, b, FM_1_2);
+    checkEqual(mid.x, 0);
+    checkEqual(mid.y, tofx(4));
+
+    checkEqual(dot2fx(a, b), tofx(-16));
+    checkEqual(length2fx(vec2fx(tofx(3), tofx(-4))), tofx(5));
+
+    // Lengths whose squares would overflow; scaling down drops up to
+    // 2^-21 of the larger component
+    uint32_t seed = 3;
+    for (int i = 0; i < 100000; i++) {
+        fixed_ffxt x = (int32_t)testRandom(&seed) >> (testRandom(&seed) % 3);
+        fixed_ffxt y = (int32_t)testRandom(&seed) >> (testRandom(&seed) % 3);
+        double expected = hypot(x, y);
+        if (expected >= INT32_MAX) { continue; }
+        double error = fabs(length2fx(vec2fx(x, y)) - expected);
+        check(error <= 2 + expected / (1 << 20));
+    }
+
+    // A quarter turn, and back
+    vec2_ffxt v = rotate2fx(vec2fx(tofx(100), tofx(50)), FM_PI_2);
+    check(abs(v.x + tofx(50)) < 4 && abs(v.y - tofx(100)) < 4);
+    v = rotate2fx(v, -FM_PI_2);
+    check(abs(v.x - tofx(100)) < 8 && abs(v.y - tofx(50)) < 8);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_CALLS    (4 * 1024 * 1024)
+
+// Accumulated so the calls are not optimized away
+static volatile int32_t sink;
+static volatile double sinkDouble;
+
+// The ns/call of %%func%%, across inputs spread over [lo, hi]
+#define benchmarkFixed(func, lo, hi) ({ \
+    uint32_t sum = 0; \
+    uint32_t span = (uint32_t)(hi) - (uint32_t)(lo); \
+    double start = testNow(); \
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) { \
+        uint32_t offset = (uint64_t)span * i / BENCH_CALLS; \
+        sum += func((fixed_ffxt)((uint32_t)(lo) + offset)); \
+    } \
+    sink = sum; \
+    1000 * (testNow() - start) / BENCH_CALLS; \
+})
+
+#define benchmarkDouble(func, lo, hi) ({ \
+    double sum = 0; \
+    double span = (double)(hi) - (double)(lo); \
+    double start = testNow(); \
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) { \
+        sum += func(fromfx(lo) + fromfx(span * i / BENCH_CALLS)); \
+    } \
+    sinkDouble = sum; \
+    1000 * (testNow() - start) / BENCH_CALLS; \
+})
+
+static fixed_ffxt atan2Ring(fixed_ffxt t) {
+    return atan2fx(sinfx(t), cosfx(t));
+}
+
+static double atan2RingDouble(double t) { return atan2(sin(t), cos(t)); }
+
+static void report(const char *name, const Error *error, double fixed,
+  double reference) {
+    printf("bench: %-6s max %.2f, mean %.2f ULP; %.1fns/call (libm "
+      "%.1fns)\n", name, error->max, meanError(error), fixed, reference);
+}
+
+static void benchmark(void) {
+    const fixed_ffxt TRIG = 7 * 65536, LOG = INT32_MAX, EXP = 15 * 65536;
+
+    report("sin", &sinError, benchmarkFixed(sinfx, -TRIG, TRIG),
+      benchmarkDouble(sin, -TRIG, TRIG));
+    report("sin*", &sinWideError, benchmarkFixed(sinfx, INT32_MIN,
+      INT32_MAX), benchmarkDouble(sin, INT32_MIN, INT32_MAX));
+    report("cos", &cosError, benchmarkFixed(cosfx, -TRIG, TRIG),
+      benchmarkDouble(cos, -TRIG, TRIG));
+    report("log2", &log2Error, benchmarkFixed(log2fx, 1, LOG),
+      benchmarkDouble(log2, 1, LOG));
+    report("exp2", &exp2Error, benchmarkFixed(exp2fx, -16 * 65536, EXP),
+      benchmarkDouble(exp2, -16 * 65536, EXP));
+    report("sqrt", &sqrtError, benchmarkFixed(sqrtfx, 1, INT32_MAX),
+      benchmarkDouble(sqrt, 1, INT32_MAX));
+
+    // Includes the sin and cos for each point
+    report("atan2", &atan2Error, benchmarkFixed(atan2Ring, -TRIG, TRIG),
+      benchmarkDouble(atan2RingDouble, -TRIG, TRIG));
+
+    printf("bench: (sin* is the whole input range)\n");
+}
+
+
+int main(void) {
+    testTrig();
+    testAtan2();
+    testLog2();
+    testExp2();
+    testSqrt();
+    testVectors();
+    benchmark();
+    return 0;
+}
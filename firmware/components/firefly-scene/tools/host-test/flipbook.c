@@ -0,0 +1,284 @@
+#include "test.h"
+
+// Flipbooks (see: ../../src/node-flipbook.c)
+//
+// - frames advance with the clock, and each frame draws the keyframe
+//   with every delta since applied
+// - the damage is the changed rectangle, or the whole image at a
+//   keyframe or after a stall
+// - malformed data, including a frame at an odd byte offset, is rejected
+// - the size and per-frame cost of deltas against keyframes only
+
+#define SIZE        (64)
+#define FRAMES      (24)
+#define DELTA       (12)
+#define DURATION    (50)
+
+#define FORMAT      (0x0146)
+
+
+//////////////////////////
+// Building
+
+typedef struct Flipbook {
+    uint16_t data[4 + 256 + 8 * FRAMES + FRAMES * SIZE * SIZE / 2];
+    size_t length;
+
+    // The palette indices of the image as shown at each frame
+    uint8_t shown[FRAMES][SIZE * SIZE];
+
+    // The changed rectangle of each frame
+    int x[FRAMES], y[FRAMES], w[FRAMES], h[FRAMES];
+} Flipbook;
+
+// Every %%interval%% frames is a keyframe; the others change a square
+// which moves across the image
+static void buildFlipbook(Flipbook *book, int interval, uint32_t seed) {
+    uint16_t *data = book->data;
+
+    data[0] = FORMAT;
+    data[1] = SIZE;
+    data[2] = SIZE;
+    data[3] = FRAMES;
+    for (int i = 0; i < 256; i++) { data[4 + i] = testRandom(&seed); }
+
+    uint16_t *pixels = &data[4 + 256 + 8 * FRAMES];
+    uint32_t offset = 0;
+
+    uint8_t image[SIZE * SIZE] = { 0 };
+
+    for (int f = 0; f < FRAMES; f++) {
+        bool keyframe = (f % interval) == 0;
+
+        int x = 0, y = 0, w = SIZE, h = SIZE;
+        if (!keyframe) {
+            x = (f * 5) % (SIZE - DELTA);
+            y = (f * 3) % (SIZE - DELTA);
+            w = DELTA;
+            h = DELTA - (f & 1);
+        }
+
+        uint16_t *info = &data[4 + 256 + 8 * f];
+        info[0] = DURATION;
+        info[1] = keyframe ? 1: 0;
+        info[2] = x;
+        info[3] = y;
+        info[4] = w;
+        info[5] = h;
+        info[6] = offset >> 16;
+        info[7] = offset & 0xffff;
+
+        // Pack the indices two per word, the first in the high byte
+        for (int i = 0; i < w * h; i++) {
+            uint8_t index = testRandom(&seed);
+            image[(y + i / w) * SIZE + x + i % w] = index;
+
+            uint16_t *word = &pixels[(offset + i) / 2];
+            if ((offset + i) & 1) {
+                *word = (*word & 0xff00) | index;
+            } else {
+                *word = index << 8;
+            }
+        }
+
+        // Pad to a whole word
+        offset += (w * h + 1) & ~1;
+
+        memcpy(book->shown[f], image, sizeof(image));
+        book->x[f] = x;
+        book->y[f] = y;
+        book->w[f] = w;
+        book->h[f] = h;
+    }
+
+    book->length = 2 * (4 + 256 + 8 * FRAMES) + offset;
+}
+
+
+//////////////////////////
+// Playback
+
+static uint16_t frame[WIDTH * HEIGHT];
+
+static void checkShown(Flipbook *book, int f, int left, int top) {
+    const uint16_t *palette = &book->data[4];
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            checkEqual(frame[(top + y) * WIDTH + left + x],
+              palette[book->shown[f][y * SIZE + x]]);
+        }
+    }
+}
+
+static void checkDamage(FfxNode node, int x, int y, int w, int h) {
+    FfxPoint origin;
+    FfxSize size;
+    check(ffx_sceneFlipbook_getDamage(node, &origin, &size));
+    checkEqual(origin.x, x);
+    checkEqual(origin.y, y);
+    checkEqual(size.width, w);
+    checkEqual(size.height, h);
+}
+
+static void testPlayback(void) {
+    static Flipbook book;
+    buildFlipbook(&book, 8, 31);
+
+    FfxScene scene = testScene();
+    FfxNode node = ffx_scene_createFlipbook(scene, book.data, book.length);
+    check(node != NULL);
+    checkEqual(ffx_sceneFlipbook_getFrameCount(node), FRAMES);
+    ffx_sceneNode_setPosition(node, ffx_point(30, 40));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+
+    // The first sequence shows the first frame, all of it damaged
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneFlipbook_getFrame(node), 0);
+    checkDamage(node, 30, 40, SIZE, SIZE);
+    testRender(scene, frame);
+    checkShown(&book, 0, 30, 40);
+
+    // Nothing changes until the frame duration elapses
+    testSequence(scene, DURATION - 1);
+    checkEqual(ffx_sceneFlipbook_getFrame(node), 0);
+    check(!ffx_sceneFlipbook_getDamage(node, NULL, NULL));
+
+    // Twice through, so the loop back to the first frame is covered
+    for (int i = 1; i <= 2 * FRAMES; i++) {
+        int f = i % FRAMES;
+        testSequence(scene, DURATION);
+        checkEqual(ffx_sceneFlipbook_getFrame(node), f);
+        checkDamage(node, 30 + book.x[f], 40 + book.y[f], book.w[f],
+          book.h[f]);
+
+        testRender(scene, frame);
+        checkShown(&book, f, 30, 40);
+    }
+
+    // A stall skips frames, damaging everything
+    testSequence(scene, 20 * DURATION);
+    int f = ffx_sceneFlipbook_getFrame(node);
+    checkDamage(node, 30, 40, SIZE, SIZE);
+    testRender(scene, frame);
+    checkShown(&book, f, 30, 40);
+
+    // Paused, the frame holds; a set frame is shown
+    ffx_sceneFlipbook_setPlaying(node, false);
+    testSequence(scene, 10 * DURATION);
+    checkEqual(ffx_sceneFlipbook_getFrame(node), f);
+    ffx_sceneFlipbook_setFrame(node, 13);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    checkShown(&book, 13, 30, 40);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Validation
+
+static void testInvalid(void) {
+    static Flipbook book;
+    FfxScene scene = testScene();
+
+    buildFlipbook(&book, 8, 32);
+    FfxNode node = ffx_scene_createFlipbook(scene, book.data, book.length);
+    check(node != NULL);
+    ffx_sceneNode_free(node);
+
+    // Truncated anywhere
+    for (size_t length = 0; length < book.length; length += 7) {
+        check(ffx_scene_createFlipbook(scene, book.data, length) == NULL);
+    }
+    check(ffx_scene_createFlipbook(scene, book.data,
+      book.length - 1) == NULL);
+
+    // A frame at an odd byte offset
+    uint16_t *info = &book.data[4 + 256 + 8 * 3];
+    info[7] += 1;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    info[7] -= 1;
+
+    // A rectangle outside the image
+    info[2] = SIZE - DELTA + 1;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    info[2] = 0;
+
+    // A keyframe which does not cover the image
+    info = &book.data[4 + 256 + 8 * 8];
+    info[4] = SIZE - 1;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    info[4] = SIZE;
+
+    // The first frame is not a keyframe
+    info = &book.data[4 + 256];
+    info[1] = 0;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    info[1] = 1;
+
+    // Unknown format, empty image
+    book.data[0] = FORMAT + 1;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    book.data[0] = FORMAT;
+    book.data[3] = 0;
+    check(ffx_scene_createFlipbook(scene, book.data, book.length) == NULL);
+    book.data[3] = FRAMES;
+
+    node = ffx_scene_createFlipbook(scene, book.data, book.length);
+    check(node != NULL);
+    ffx_sceneNode_free(node);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_LOOPS   (20)
+
+static double benchmarkBook(Flipbook *book) {
+    FfxScene scene = testScene();
+    FfxNode node = ffx_scene_createFlipbook(scene, book->data, book->length);
+    check(node != NULL);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    testSequence(scene, 1);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_LOOPS * FRAMES; i++) {
+        testSequence(scene, DURATION);
+        testRender(scene, frame);
+    }
+    double duration = testNow() - start;
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return duration / (BENCH_LOOPS * FRAMES);
+}
+
+static void benchmark(void) {
+    static Flipbook keyframes, deltas;
+    buildFlipbook(&keyframes, 1, 33);
+    buildFlipbook(&deltas, 8, 33);
+
+    check(deltas.length * 4 < keyframes.length);
+
+    double keyframeCost = benchmarkBook(&keyframes);
+    double deltaCost = benchmarkBook(&deltas);
+
+    printf("bench: %d frames of %dx%d; keyframes %zu bytes %.1fus/frame, "
+      "deltas %zu bytes %.1fus/frame\n", FRAMES, SIZE, SIZE,
+      keyframes.length, keyframeCost, deltas.length, deltaCost);
+}
+
+
+int main(void) {
+    testPlayback();
+    testInvalid();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,307 @@
+#include "test.h"
+
+// Fragment geometry (see: ../../src/scene.c and every node renderFunc)
+//
+// - a scene using every node type, animated so nodes cross every
+//   fragment edge and the screen edges, renders identically as
+//   fragments of any width and height (including 1-pixel strips and
+//   sizes which do not divide the screen) as in a single full frame
+// - the time to render a frame at each geometry
+
+
+#define FRAMES           (24)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t fragmented[WIDTH * HEIGHT];
+
+static const FfxSize geometries[] = {
+    { WIDTH, 24 }, { WIDTH, 1 }, { WIDTH, 7 }, { WIDTH, 40 },
+    { WIDTH, 120 }, { 120, 24 }, { 64, 17 }, { 100, 100 }, { 13, 240 },
+    { 1, 240 }
+};
+
+#define GEOMETRY_COUNT   (sizeof(geometries) / sizeof(geometries[0]))
+
+typedef struct Demo {
+    FfxScene scene;
+
+    uint16_t *rgb;
+    uint16_t *palette;
+    uint16_t *alpha;
+    uint16_t *book;
+    uint16_t *map;
+
+    FfxNode moving[8];
+    FfxNode sprite;
+    FfxNode tileMap;
+    FfxNode chart;
+    FfxNode layer;
+} Demo;
+
+// An RGB565 image with a 4-bit alpha, which precedes the pixels
+static uint16_t* createAlphaImage(size_t width, size_t height,
+  uint32_t seed, size_t *length) {
+
+    size_t pixels = width * height;
+    size_t alphaWords = (pixels + 3) / 4;
+    size_t count = 4 + alphaWords + pixels;
+
+    uint16_t *data = malloc(count * 2);
+    check(data != NULL);
+    for (int i = 4; i < count; i++) { data[i] = testRandom(&seed); }
+
+    data[0] = 0x05;
+    data[1] = width;
+    data[2] = height;
+    data[3] = alphaWords;
+
+    *length = count * 2;
+    return data;
+}
+
+static FfxNode add(FfxNode parent, FfxNode node, int x, int y) {
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, ffx_point(x, y));
+    ffx_sceneGroup_appendChild(parent, node);
+    return node;
+}
+
+// A busy panel, in the spirit of the demo scenes
+static void createDemo(Demo *demo) {
+    memset(demo, 0, sizeof(Demo));
+
+    FfxScene scene = testScene();
+    demo->scene = scene;
+    FfxNode root = ffx_scene_root(scene);
+
+    size_t rgbLength, paletteLength, alphaLength, bookLength, mapLength;
+    demo->rgb = testImage(0x04, 37, 29, 100, &rgbLength);
+    demo->palette = testImage(0x38, 31, 23, 101, &paletteLength);
+    demo->alpha = createAlphaImage(27, 19, 102, &alphaLength);
+    demo->book = testFlipbook(33, 21, 4, 103, &bookLength);
+    demo->map = testTileMap(0x04, 16, 6, 12, 9, 104, &mapLength);
+
+    add(root, ffx_scene_createFill(scene, ffx_color_rgb(20, 30, 40)), 0, 0);
+
+    FfxNode gradient = add(root, ffx_scene_createGradient(scene,
+      ffx_size(180, 90), FfxGradientTypeRadial), -20, 150);
+    color_ffxt colors[] = {
+        ffx_color_rgb(255, 0, 80), ffx_color_rgb(0, 80, 255),
+        ffx_color_rgb(240, 240, 0)
+    };
+    check(ffx_sceneGradient_setColors(gradient, colors, 3));
+    ffx_sceneGradient_setEnd(gradient, ffx_point(140, 70));
+    ffx_sceneGradient_setDither(gradient, true);
+
+    demo->tileMap = add(root, ffx_scene_createTileMap(scene, demo->map,
+      mapLength), 130, 100);
+    ffx_sceneTileMap_setSize(demo->tileMap, ffx_size(130, 70));
+    ffx_sceneTileMap_setWrap(demo->tileMap, true);
+
+    // Nodes which move across the fragment and screen edges
+    demo->moving[0] = add(root, ffx_scene_createImage(scene, demo->rgb,
+      rgbLength), 0, 0);
+    demo->moving[1] = add(root, ffx_scene_createImage(scene, demo->palette,
+      paletteLength), 0, 0);
+    demo->moving[2] = add(root, ffx_scene_createImage(scene, demo->alpha,
+      alphaLength), 0, 0);
+    ffx_sceneImage_setTint(demo->moving[2], ffx_color_rgba(0, 0, 0, 40));
+
+    FfxNode book = add(root, ffx_scene_createFlipbook(scene, demo->book,
+      bookLength), 0, 0);
+    ffx_sceneFlipbook_setPlaying(book, true);
+    demo->moving[3] = book;
+
+    FfxNode box = add(root, ffx_scene_createBox(scene, ffx_size(23, 11)),
+      0, 0);
+    ffx_sceneBox_setColor(box, ffx_color_rgba(255, 128, 0, 20));
+    demo->moving[4] = box;
+
+    FfxNode label = add(root, ffx_scene_createLabel(scene, FfxFontLarge,
+      "Firefly 42"), 0, 0);
+    ffx_sceneLabel_setOutlineColor(label, COLOR_BLACK);
+    demo->moving[5] = label;
+
+    FfxNode small = add(root, ffx_scene_createLabel(scene,
+      FfxFontSmallBold, "fragments"), 0, 0);
+    ffx_sceneLabel_setTextColor(small, ffx_color_rgb(0, 255, 128));
+    demo->moving[6] = small;
+
+    FfxNode circle = add(root, ffx_scene_createShape(scene,
+      FfxShapeTypeCircle, ffx_size(41, 41)), 0, 0);
+    ffx_sceneShape_setFillColor(circle, ffx_color_rgba(80, 200, 255, 24));
+    ffx_sceneShape_setStrokeColor(circle, COLOR_WHITE);
+    ffx_sceneShape_setStrokeWidth(circle, 2);
+    demo->moving[7] = circle;
+
+    FfxNode arc = add(root, ffx_scene_createShape(scene, FfxShapeTypeArc,
+      ffx_size(60, 60)), 170, 10);
+    ffx_sceneShape_setStrokeColor(arc, COLOR_RED);
+    ffx_sceneShape_setStrokeWidth(arc, 5);
+    ffx_sceneShape_setEndAngle(arc, FM_PI);
+
+    FfxNode rect = add(root, ffx_scene_createShape(scene,
+      FfxShapeTypeRoundRect, ffx_size(70, 30)), 5, 205);
+    ffx_sceneShape_setFillColor(rect, ffx_color_rgb(60, 60, 60));
+    ffx_sceneShape_setCornerRadius(rect, 9);
+
+    FfxNode line = add(root, ffx_scene_createShape(scene, FfxShapeTypeLine,
+      ffx_size(1, 1)), 10, 10);
+    ffx_sceneShape_setEnd(line, ffx_point(230, 190));
+    ffx_sceneShape_setStrokeColor(line, COLOR_GREEN);
+    ffx_sceneShape_setStrokeWidth(line, 3);
+
+    FfxNode paragraph = add(root, ffx_scene_createParagraph(scene,
+      FfxFontSmall, ffx_size(110, 80), "The quick brown fox jumps over "
+      "the lazy dog, across every fragment edge."), 120, 40);
+    ffx_sceneParagraph_setOutlineColor(paragraph, COLOR_BLACK);
+
+    add(root, ffx_scene_createQR(scene, "https://firefly.dev",
+      FfxQRCorrectionLow), 190, 180);
+
+    demo->chart = add(root, ffx_scene_createChart(scene, ffx_size(100, 40),
+      50), 70, 60);
+    for (int i = 0; i < 50; i++) {
+        ffx_sceneChart_append(demo->chart, (i * 37) % 23);
+    }
+
+    demo->sprite = add(root, ffx_scene_createSprite(scene, demo->alpha,
+      alphaLength), 120, 120);
+    ffx_sceneSprite_setScale(demo->sprite, 2 * FM_1);
+    ffx_sceneSprite_setSampling(demo->sprite, FfxSpriteSamplingBilinear);
+
+    FfxParticleEmitter emitter = {
+        .rate = 300,
+        .life = 1500,
+        .area = ffx_size(20, 10),
+        .velocity = ffx_point(0, -60),
+        .velocityJitter = ffx_point(80, 40),
+        .gravity = ffx_point(0, 60),
+        .startColor = COLOR_WHITE,
+        .endColor = ffx_color_setOpacity(COLOR_BLUE, 0),
+        .pointSize = 2
+    };
+    FfxNode particles = add(root, ffx_scene_createParticles(scene, 400),
+      60, 140);
+    ffx_sceneParticles_setEmitter(particles, &emitter);
+
+    // A faded panel of overlapping children, composited as a layer
+    demo->layer = add(root, ffx_scene_createGroup(scene), 30, 95);
+    ffx_sceneGroup_setOpacity(demo->layer, 20);
+    FfxNode panel = add(demo->layer, ffx_scene_createBox(scene,
+      ffx_size(90, 45)), 0, 0);
+    ffx_sceneBox_setColor(panel, ffx_color_rgb(0, 0, 128));
+    add(demo->layer, ffx_scene_createLabel(scene, FfxFontMediumBold,
+      "Layer"), 8, 30);
+}
+
+// Moves the nodes and scrolls the views for %%f%%
+static void animateDemo(Demo *demo, int f) {
+    for (int i = 0; i < 8; i++) {
+        int x = ((f * (7 + 3 * i) + i * 53) % 300) - 30;
+        int y = ((f * (5 + 2 * i) + i * 41) % 300) - 30;
+        ffx_sceneNode_setPosition(demo->moving[i], ffx_point(x, y));
+    }
+
+    ffx_sceneTileMap_setScroll(demo->tileMap, ffx_point(f * 5, f * 3));
+    ffx_sceneSprite_setAngle(demo->sprite, f * FM_1 / 5);
+    ffx_sceneChart_append(demo->chart, (f * 13) % 29);
+    ffx_sceneNode_setPosition(demo->layer, ffx_point(30 + 3 * f,
+      95 - 2 * f));
+}
+
+static void freeDemo(Demo *demo) {
+    ffx_scene_free(demo->scene);
+    free(demo->rgb);
+    free(demo->palette);
+    free(demo->alpha);
+    free(demo->book);
+    free(demo->map);
+}
+
+
+//////////////////////////
+// Geometry
+
+static void testGeometry(void) {
+    Demo demo;
+    createDemo(&demo);
+
+    uint32_t lit = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        animateDemo(&demo, f);
+        testSequence(demo.scene, 50);
+
+        testRenderAt(demo.scene, frame, ffx_size(WIDTH, HEIGHT));
+        for (int g = 0; g < GEOMETRY_COUNT; g++) {
+            testRenderAt(demo.scene, fragmented, geometries[g]);
+            if (memcmp(frame, fragmented, sizeof(frame)) == 0) { continue; }
+
+            for (int i = 0; i < WIDTH * HEIGHT; i++) {
+                if (frame[i] == fragmented[i]) { continue; }
+                printf("frame %d, %dx%d: first mismatch at (%d, %d)\n", f,
+                  geometries[g].width, geometries[g].height, i % WIDTH,
+                  i / WIDTH);
+                break;
+            }
+            check(false);
+        }
+
+        // The common geometry matches testRender too
+        testRender(demo.scene, fragmented);
+        check(memcmp(frame, fragmented, sizeof(frame)) == 0);
+
+        uint16_t background = frame[0];
+        for (int i = 0; i < WIDTH * HEIGHT; i++) {
+            lit += (frame[i] != background);
+        }
+    }
+
+    // Most of the screen is covered by something other than the fill
+    check(lit > FRAMES * WIDTH * HEIGHT / 4);
+
+    freeDemo(&demo);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_ROUNDS     (20)
+
+static void benchmark(void) {
+    Demo demo;
+    createDemo(&demo);
+    animateDemo(&demo, 10);
+    testSequence(demo.scene, 50);
+
+    printf("bench: render of the demo scene per fragment geometry\n");
+
+    for (int g = -1; g < (int)GEOMETRY_COUNT; g++) {
+        FfxSize size = (g < 0) ? ffx_size(WIDTH, HEIGHT): geometries[g];
+
+        double best = 1e30;
+        for (int r = 0; r < BENCH_ROUNDS; r++) {
+            double start = testNow();
+            testRenderAt(demo.scene, frame, size);
+            double duration = testNow() - start;
+            if (duration < best) { best = duration; }
+        }
+
+        int fragments = ((WIDTH + size.width - 1) / size.width) *
+          ((HEIGHT + size.height - 1) / size.height);
+        printf("bench:   %3dx%-3d %4d fragments %8.0fus\n", size.width,
+          size.height, fragments, best);
+    }
+
+    freeDemo(&demo);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testGeometry();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <math.h>
+
+#include "test.h"
+
+// Gradients (see: ../../src/node-gradient.c)
+//
+// - isqrt32 is exact across the 32-bit range
+// - linear and radial gradients follow the float gradient, with stops
+//   at their points
+// - the dither averages to the exact color, and is anchored to the
+//   screen so every fragment geometry draws the same pixels
+// - the per-pixel throughput of each type, with and without dither
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t other[WIDTH * HEIGHT];
+
+
+//////////////////////////
+// Square root
+
+static void checkRoot(uint32_t value) {
+    uint64_t root = isqrt32(value);
+    check(root * root <= value);
+    check((root + 1) * (root + 1) > value);
+}
+
+static void testIsqrt(void) {
+    for (uint32_t v = 0; v < 0x20000; v++) { checkRoot(v); }
+
+    // Either side of every perfect square
+    for (uint64_t r = 1; r <= 0xffff; r++) {
+        checkRoot(r * r);
+        checkRoot(r * r - 1);
+        checkRoot(r * r + 1);
+    }
+    checkRoot(0xffffffff);
+
+    uint32_t seed = 33;
+    for (int i = 0; i < 1000000; i++) { checkRoot(testRandom(&seed) << 8); }
+}
+
+
+//////////////////////////
+// Accuracy
+
+static FfxNode addGradient(FfxScene scene, FfxGradientType type,
+  FfxPoint start, FfxPoint end, const color_ffxt *colors, size_t count) {
+
+    FfxNode node = ffx_scene_createGradient(scene, ffx_size(WIDTH, HEIGHT),
+      type);
+    check(node != NULL);
+    ffx_sceneGradient_setStart(node, start);
+    ffx_sceneGradient_setEnd(node, end);
+    check(ffx_sceneGradient_setColors(node, colors, count));
+    check(ffx_sceneGradient_getDither(node));
+    ffx_sceneGradient_setDither(node, false);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    return node;
+}
+
+// The green channel (6 bits) of every pixel is close to the float
+// gradient value %%t%% in [0, 1] at that pixel. The ramp is sampled from
+// ffx_color_lerpColorRamp, which interpolates in HSV with a 6-bit value,
+// so an entry may be almost a step low, besides the ramp step and the
+// rounding to RGB565.
+static void checkGreen(double (*value)(int x, int y)) {
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            double t = value(x, y);
+            if (t < 0) { t = 0; }
+            if (t > 1) { t = 1; }
+
+            int green = (frame[y * WIDTH + x] >> 5) & 0x3f;
+            check(fabs(green - t * 63) <= 1.5);
+        }
+    }
+}
+
+static double linearValue(int x, int y) {
+    // Along (200, 100) from (20, 10)
+    return ((x - 20) * 200.0 + (y - 10) * 100.0) / 50000.0;
+}
+
+static double radialValue(int x, int y) {
+    return sqrt((x - 120.0) * (x - 120) + (y - 100.0) * (y - 100)) / 90.0;
+}
+
+static void testAccuracy(void) {
+    const color_ffxt colors[] = { COLOR_BLACK, COLOR_WHITE };
+
+    FfxScene scene = testScene();
+    addGradient(scene, FfxGradientTypeLinear, ffx_point(20, 10),
+      ffx_point(220, 110), colors, 2);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    checkGreen(linearValue);
+    ffx_scene_free(scene);
+
+    scene = testScene();
+    addGradient(scene, FfxGradientTypeRadial, ffx_point(120, 100),
+      ffx_point(210, 100), colors, 2);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    checkGreen(radialValue);
+    ffx_scene_free(scene);
+
+    checkEqual(testLive(), 0);
+}
+
+static void testStops(void) {
+    const color_ffxt colors[] = { COLOR_RED, COLOR_GREEN, COLOR_BLUE };
+
+    FfxScene scene = testScene();
+    addGradient(scene, FfxGradientTypeLinear, ffx_point(20, 0),
+      ffx_point(220, 0), colors, 3);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    // Before, at and after each end stop
+    checkEqual(frame[5], 0xf800);
+    checkEqual(frame[20], 0xf800);
+    checkEqual(frame[220], 0x001f);
+    checkEqual(frame[239], 0x001f);
+
+    // The middle stop falls between two ramp entries
+    check((frame[120] >> 11) <= 1);
+    check(((frame[120] >> 5) & 0x3f) >= 60);
+    check((frame[120] & 0x1f) <= 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Dithering
+
+static void testDither(void) {
+    // Red 130 is 15.8 of 31; between two RGB565 levels
+    const color_ffxt colors[] = {
+        ffx_color_rgb(130, 0, 0), ffx_color_rgb(130, 0, 0)
+    };
+    double ideal = 130 * 31 / 255.0;
+
+    FfxScene scene = testScene();
+    FfxNode node = addGradient(scene, FfxGradientTypeLinear,
+      ffx_point(0, 0), ffx_point(100, 0), colors, 2);
+
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    for (int i = 0; i < WIDTH * HEIGHT; i++) {
+        checkEqual(frame[i] >> 11, 16);
+    }
+
+    ffx_sceneGradient_setDither(node, true);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    // Every 4x4 block averages to the ideal level
+    for (int by = 0; by < HEIGHT; by += 4) {
+        for (int bx = 0; bx < WIDTH; bx += 4) {
+            int sum = 0;
+            for (int i = 0; i < 16; i++) {
+                sum += frame[(by + i / 4) * WIDTH + bx + i % 4] >> 11;
+            }
+            check(fabs(sum / 16.0 - ideal) <= 1.0 / 16);
+        }
+    }
+
+    // The same pixels for every fragment geometry, including those
+    // whose origin is not a multiple of 4
+    const FfxSize geometries[] = {
+        { 240, 240 }, { 37, 13 }, { 240, 7 }, { 1, 240 }
+    };
+    for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]); g++) {
+        testRenderAt(scene, other, geometries[g]);
+        check(memcmp(frame, other, sizeof(frame)) == 0);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAMES   (300)
+
+static void benchmarkGradient(FfxGradientType type, bool dither,
+  const char *name) {
+
+    const color_ffxt colors[] = {
+        ffx_color_rgb(20, 30, 90), ffx_color_rgb(200, 90, 40),
+        ffx_color_rgb(250, 240, 200)
+    };
+
+    FfxScene scene = testScene();
+    FfxNode node = addGradient(scene, type, ffx_point(120, 120),
+      ffx_point(240, 200), colors, 3);
+    ffx_sceneGradient_setDither(node, dither);
+    testSequence(scene, 1);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) { testRender(scene, frame); }
+    double duration = testNow() - start;
+
+    printf("bench: %s %.1f Mpixel/s\n", name,
+      (double)WIDTH * HEIGHT * BENCH_FRAMES / duration);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testIsqrt();
+    testAccuracy();
+    testStops();
+    testDither();
+
+    benchmarkGradient(FfxGradientTypeLinear, false, "linear");
+    benchmarkGradient(FfxGradientTypeLinear, true, "linear dithered");
+    benchmarkGradient(FfxGradientTypeRadial, false, "radial");
+    benchmarkGradient(FfxGradientTypeRadial, true, "radial dithered");
+    return 0;
+}
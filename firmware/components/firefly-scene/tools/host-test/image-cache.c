@@ -0,0 +1,513 @@
+#include <pthread.h>
+
+#include "test.h"
+
+// Image cache (see: ../../src/image-cache.c)
+//
+// - without a budget, registered images are drawn from their data
+// - the least recently drawn image is evicted first, and never one of
+//   a higher priority than the image being loaded
+// - images drawn this frame are pinned; when they do not all fit, the
+//   rest miss every frame rather than swapping
+// - re-registering changes the priority and keeps the copy, while
+//   unregistering or shrinking the budget frees copies
+// - renders read the copy, and match renders without the cache
+// - registrations from other threads are applied by the sequence
+// - an invalid image, or one shorter than its header implies, is
+//   refused and nothing leaks when the scene is freed with copies and
+//   pending registrations
+// - the cost of a sequence with the cache on and off
+
+
+#define IMAGE_SIZE       (16)
+#define IMAGE_COUNT      (8)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t expected[WIDTH * HEIGHT];
+
+static uint16_t *images[IMAGE_COUNT];
+static size_t imageBytes;
+
+static void createImages(void) {
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        images[i] = testImage(0x04, IMAGE_SIZE, IMAGE_SIZE, 50 + i,
+          &imageBytes);
+    }
+}
+
+static void freeImages(void) {
+    for (int i = 0; i < IMAGE_COUNT; i++) { free(images[i]); }
+}
+
+// An image node for each image, side by side along the top; all hidden
+static void addNodes(FfxScene scene, FfxNode *nodes, int count) {
+    for (int i = 0; i < count; i++) {
+        nodes[i] = ffx_scene_createImage(scene, images[i], imageBytes);
+        check(nodes[i] != NULL);
+        ffx_sceneNode_setPosition(nodes[i], ffx_point(i * IMAGE_SIZE, 0));
+        ffx_sceneNode_setHidden(nodes[i], true);
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), nodes[i]);
+    }
+}
+
+// Sequences a frame drawing only the nodes in %%mask%%
+static void drawOnly(FfxScene scene, FfxNode *nodes, int count,
+  uint32_t mask) {
+
+    for (int i = 0; i < count; i++) {
+        ffx_sceneNode_setHidden(nodes[i], !(mask & (1 << i)));
+    }
+    testSequence(scene, 1);
+}
+
+static FfxImageCacheStats getStats(FfxScene scene) {
+    FfxImageCacheStats stats;
+    ffx_scene_getImageCacheStats(scene, &stats);
+    return stats;
+}
+
+
+//////////////////////////
+// Residency
+
+static void testDisabled(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[2];
+    addNodes(scene, nodes, 2);
+    check(ffx_scene_registerImage(scene, images[0], imageBytes, 1));
+    check(ffx_scene_registerImage(scene, images[1], imageBytes, 1));
+
+    for (int i = 0; i < 3; i++) { drawOnly(scene, nodes, 2, 0x3); }
+
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.registered, 2);
+    checkEqual(stats.resident, 0);
+    checkEqual(stats.loads, 0);
+    checkEqual(stats.hits, 0);
+    checkEqual(stats.misses, 6);
+    checkEqual(stats.used, 0);
+    checkEqual(stats.budget, 0);
+
+    ffx_scene_free(scene);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+static void testLRU(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[3];
+    addNodes(scene, nodes, 3);
+    ffx_scene_setImageCacheBudget(scene, 2 * imageBytes + 10);
+    for (int i = 0; i < 3; i++) {
+        check(ffx_scene_registerImage(scene, images[i], imageBytes, 1));
+    }
+
+    // A then B; both fit
+    drawOnly(scene, nodes, 3, 0x3);
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.resident, 2);
+    checkEqual(stats.used, 2 * imageBytes);
+
+    // C evicts A, drawn before B
+    drawOnly(scene, nodes, 3, 0x4);
+    stats = getStats(scene);
+    checkEqual(stats.loads, 3);
+    checkEqual(stats.evictions, 1);
+    drawOnly(scene, nodes, 3, 0x2);
+    checkEqual(getStats(scene).loads, 3);
+
+    // A evicts C, which is now older than B
+    drawOnly(scene, nodes, 3, 0x1);
+    checkEqual(getStats(scene).loads, 4);
+    drawOnly(scene, nodes, 3, 0x2);
+    drawOnly(scene, nodes, 3, 0x1);
+    stats = getStats(scene);
+    checkEqual(stats.loads, 4);
+    checkEqual(stats.evictions, 2);
+    checkEqual(stats.misses, 0);
+    checkEqual(stats.hits, 7);
+
+    ffx_scene_free(scene);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+static void testPriority(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[3];
+    addNodes(scene, nodes, 3);
+    ffx_scene_setImageCacheBudget(scene, imageBytes);
+    check(ffx_scene_registerImage(scene, images[0], imageBytes, 5));
+    check(ffx_scene_registerImage(scene, images[1], imageBytes, 1));
+    check(ffx_scene_registerImage(scene, images[2], imageBytes, 9));
+
+    drawOnly(scene, nodes, 3, 0x1);
+    checkEqual(getStats(scene).loads, 1);
+
+    // A lower priority never evicts a higher one, however stale
+    for (int i = 0; i < 5; i++) { drawOnly(scene, nodes, 3, 0x2); }
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.loads, 1);
+    checkEqual(stats.misses, 5);
+    checkEqual(stats.evictions, 0);
+
+    // A higher one does
+    drawOnly(scene, nodes, 3, 0x4);
+    stats = getStats(scene);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.evictions, 1);
+
+    // An image larger than the whole budget evicts nothing
+    ffx_scene_setImageCacheBudget(scene, imageBytes + 1);
+    size_t length;
+    uint16_t *large = testImage(0x04, IMAGE_SIZE, IMAGE_SIZE + 1, 60,
+      &length);
+    check(ffx_scene_registerImage(scene, large, length, 0xff));
+    ffx_sceneImage_setData(nodes[0], large, length);
+    drawOnly(scene, nodes, 3, 0x1);
+    stats = getStats(scene);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.resident, 1);
+
+    ffx_scene_free(scene);
+    free(large);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+static void testPinned(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[3];
+    addNodes(scene, nodes, 3);
+    ffx_scene_setImageCacheBudget(scene, 2 * imageBytes);
+    for (int i = 0; i < 3; i++) {
+        check(ffx_scene_registerImage(scene, images[i], imageBytes, 1));
+    }
+
+    // Three drawn every frame with room for two; the third misses
+    // instead of evicting one being drawn
+    for (int i = 0; i < 10; i++) { drawOnly(scene, nodes, 3, 0x7); }
+
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.evictions, 0);
+    checkEqual(stats.hits, 20);
+    checkEqual(stats.misses, 10);
+
+    // The same image drawn twice in a frame holds one copy
+    ffx_sceneImage_setData(nodes[1], images[0], imageBytes);
+    drawOnly(scene, nodes, 3, 0x3);
+    stats = getStats(scene);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.hits, 22);
+
+    ffx_scene_free(scene);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Registration
+
+static void testRegister(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[2];
+    addNodes(scene, nodes, 2);
+    drawOnly(scene, nodes, 2, 0x0);
+    uint32_t live = testLive();
+
+    ffx_scene_setImageCacheBudget(scene, imageBytes);
+    check(ffx_scene_registerImage(scene, images[0], imageBytes, 1));
+    check(ffx_scene_registerImage(scene, images[1], imageBytes, 1));
+    drawOnly(scene, nodes, 2, 0x1);
+
+    // Re-registered at a higher priority, the copy is kept and can no
+    // longer be evicted by the other
+    check(ffx_scene_registerImage(scene, images[0], imageBytes, 7));
+    drawOnly(scene, nodes, 2, 0x2);
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.registered, 2);
+    checkEqual(stats.loads, 1);
+    checkEqual(stats.misses, 1);
+    checkEqual(stats.evictions, 0);
+
+    // Unregistered, the copy is freed and the other loads
+    ffx_scene_unregisterImage(scene, images[0]);
+    drawOnly(scene, nodes, 2, 0x3);
+    stats = getStats(scene);
+    checkEqual(stats.registered, 1);
+    checkEqual(stats.resident, 1);
+    checkEqual(stats.loads, 2);
+    checkEqual(stats.evictions, 0);
+
+    // A shrunk budget evicts at the next sequence
+    ffx_scene_setImageCacheBudget(scene, imageBytes - 1);
+    drawOnly(scene, nodes, 2, 0x0);
+    stats = getStats(scene);
+    checkEqual(stats.resident, 0);
+    checkEqual(stats.used, 0);
+    checkEqual(stats.evictions, 1);
+    checkEqual(stats.budget, imageBytes - 1);
+
+    // Registered and unregistered between sequences; the latest wins
+    check(ffx_scene_registerImage(scene, images[2], imageBytes, 1));
+    ffx_scene_unregisterImage(scene, images[2]);
+    ffx_scene_unregisterImage(scene, images[1]);
+    check(ffx_scene_registerImage(scene, images[1], imageBytes, 1));
+    drawOnly(scene, nodes, 2, 0x0);
+    checkEqual(getStats(scene).registered, 1);
+
+    ffx_scene_unregisterImage(scene, images[1]);
+    drawOnly(scene, nodes, 2, 0x0);
+    checkEqual(getStats(scene).registered, 0);
+    checkEqual(testLive(), live);
+
+    // Invalid images are refused
+    check(!ffx_scene_registerImage(scene, NULL, imageBytes, 1));
+    check(!ffx_scene_registerImage(scene, images[0], 5, 1));
+    check(!ffx_scene_registerImage(scene, images[0], imageBytes - 1, 1));
+    ffx_scene_unregisterImage(scene, NULL);
+
+    // As are a flipbook and a tile map cut short
+    size_t bookLength, mapLength;
+    uint16_t *book = testFlipbook(8, 8, 2, 70, &bookLength);
+    uint16_t *map = testTileMap(0x04, 8, 2, 3, 3, 71, &mapLength);
+    check(!ffx_scene_registerImage(scene, book, bookLength - 2, 1));
+    check(!ffx_scene_registerImage(scene, map, mapLength - 2, 1));
+    checkEqual(testLive(), live);
+
+    // A failed allocation is reported
+    atomic_store(&testHeap.failIn, 1);
+    check(!ffx_scene_registerImage(scene, images[0], imageBytes, 1));
+
+    // Freed with resident copies and pending registrations
+    ffx_scene_setImageCacheBudget(scene, 4 * imageBytes);
+    check(ffx_scene_registerImage(scene, images[0], imageBytes, 1));
+    check(ffx_scene_registerImage(scene, images[1], imageBytes, 1));
+    drawOnly(scene, nodes, 2, 0x3);
+    checkEqual(getStats(scene).resident, 2);
+    check(ffx_scene_registerImage(scene, images[2], imageBytes, 1));
+    check(ffx_scene_registerImage(scene, book, bookLength, 1));
+    check(ffx_scene_registerImage(scene, map, mapLength, 1));
+    ffx_scene_unregisterImage(scene, images[0]);
+
+    ffx_scene_free(scene);
+    free(book);
+    free(map);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Rendering
+
+static void testRendering(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[IMAGE_COUNT];
+    addNodes(scene, nodes, IMAGE_COUNT);
+
+    // A tinted image and a scaled, rotated sprite of the same data
+    ffx_sceneImage_setTint(nodes[1], ffx_color_rgba(255, 0, 0, 20));
+    FfxNode sprite = ffx_scene_createSprite(scene, images[2], imageBytes);
+    ffx_sceneSprite_setScale(sprite, 3 * FM_1);
+    ffx_sceneSprite_setAngle(sprite, FM_1 / 3);
+    ffx_sceneNode_setPosition(sprite, ffx_point(120, 120));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), sprite);
+
+    uint32_t all = (1 << IMAGE_COUNT) - 1;
+    drawOnly(scene, nodes, IMAGE_COUNT, all);
+    testRender(scene, expected);
+
+    // Every image resident
+    ffx_scene_setImageCacheBudget(scene, IMAGE_COUNT * imageBytes);
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        check(ffx_scene_registerImage(scene, images[i], imageBytes, 1));
+    }
+    drawOnly(scene, nodes, IMAGE_COUNT, all);
+    testRender(scene, frame);
+    check(memcmp(frame, expected, sizeof(frame)) == 0);
+    checkEqual(getStats(scene).resident, IMAGE_COUNT);
+    checkEqual(getStats(scene).hits, IMAGE_COUNT + 1);
+
+    // Renders read the copy, not the original
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        memset(&images[i][3], 0, imageBytes - 6);
+    }
+    drawOnly(scene, nodes, IMAGE_COUNT, all);
+    testRender(scene, frame);
+    check(memcmp(frame, expected, sizeof(frame)) == 0);
+
+    // Until the copies are dropped
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        ffx_scene_unregisterImage(scene, images[i]);
+    }
+    drawOnly(scene, nodes, IMAGE_COUNT, all);
+    testRender(scene, frame);
+    check(memcmp(frame, expected, sizeof(frame)) != 0);
+
+    ffx_scene_free(scene);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Concurrency
+
+#define THREADS          (4)
+#define THREAD_ROUNDS    (20000)
+
+static _Atomic(int) workersDone;
+
+typedef struct Worker {
+    FfxScene scene;
+    uint32_t seed;
+} Worker;
+
+static void* work(void *arg) {
+    Worker *worker = arg;
+
+    for (int i = 0; i < THREAD_ROUNDS; i++) {
+        uint32_t value = testRandom(&worker->seed);
+        uint16_t *image = images[value % IMAGE_COUNT];
+        if (value & 0x100) {
+            ffx_scene_unregisterImage(worker->scene, image);
+        } else {
+            check(ffx_scene_registerImage(worker->scene, image, imageBytes,
+              (value >> 9) & 0x3));
+        }
+    }
+
+    atomic_fetch_add(&workersDone, 1);
+
+    return NULL;
+}
+
+static void testConcurrent(void) {
+    createImages();
+    FfxScene scene = testScene();
+
+    FfxNode nodes[IMAGE_COUNT];
+    addNodes(scene, nodes, IMAGE_COUNT);
+    ffx_scene_setImageCacheBudget(scene, 3 * imageBytes);
+
+    uint32_t all = (1 << IMAGE_COUNT) - 1;
+    drawOnly(scene, nodes, IMAGE_COUNT, all);
+    testRender(scene, expected);
+
+    atomic_store(&workersDone, 0);
+
+    pthread_t threads[THREADS];
+    Worker workers[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        workers[i] = (Worker){ .scene = scene, .seed = 70 + i };
+        check(pthread_create(&threads[i], NULL, work, &workers[i]) == 0);
+    }
+
+    // Every frame draws the same, whatever is resident
+    uint32_t seed = 80;
+    while (atomic_load(&workersDone) < THREADS) {
+        drawOnly(scene, nodes, IMAGE_COUNT, testRandom(&seed) & all);
+        drawOnly(scene, nodes, IMAGE_COUNT, all);
+        testRender(scene, frame);
+        check(memcmp(frame, expected, sizeof(frame)) == 0);
+
+        FfxImageCacheStats stats = getStats(scene);
+        check(stats.used <= 3 * imageBytes);
+        checkEqual(stats.used, stats.resident * imageBytes);
+    }
+
+    for (int i = 0; i < THREADS; i++) {
+        check(pthread_join(threads[i], NULL) == 0);
+    }
+
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        ffx_scene_unregisterImage(scene, images[i]);
+    }
+    testSequence(scene, 1);
+    FfxImageCacheStats stats = getStats(scene);
+    checkEqual(stats.registered, 0);
+    checkEqual(stats.resident, 0);
+    checkEqual(stats.used, 0);
+
+    ffx_scene_free(scene);
+    freeImages();
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_NODES      (30)
+#define BENCH_FRAMES     (2000)
+
+// The ns per sequence of %%BENCH_NODES%% image nodes sharing five images
+static double benchmarkSequence(size_t budget) {
+    FfxScene scene = testScene();
+
+    for (int i = 0; i < BENCH_NODES; i++) {
+        FfxNode node = ffx_scene_createImage(scene, images[i % 5],
+          imageBytes);
+        ffx_sceneNode_setPosition(node, ffx_point((i % 10) * 20,
+          (i / 10) * 20));
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    }
+
+    ffx_scene_setImageCacheBudget(scene, budget);
+    for (int i = 0; i < 5; i++) {
+        check(ffx_scene_registerImage(scene, images[i], imageBytes, 1));
+    }
+    testSequence(scene, 1);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) { testSequence(scene, 1); }
+    double duration = testNow() - start;
+
+    if (budget) { checkEqual(getStats(scene).resident, 5); }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return 1000 * duration / BENCH_FRAMES;
+}
+
+static void benchmark(void) {
+    createImages();
+
+    double off = benchmarkSequence(0);
+    double on = benchmarkSequence(5 * imageBytes);
+
+    freeImages();
+
+    printf("bench: sequence of %d images (5 registered) %.0fns without "
+      "the cache, %.0fns with\n", BENCH_NODES, off, on);
+}
+
+
+int main(void) {
+    testDisabled();
+    testLRU();
+    testPriority();
+    testPinned();
+    testRegister();
+    testRendering();
+    testConcurrent();
+    benchmark();
+    return 0;
+}
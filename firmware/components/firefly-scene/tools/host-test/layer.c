@@ -0,0 +1,269 @@
+#include "test.h"
+#include "scene.h"
+
+// Group opacity layers (see: ../../src/node-group.c)
+//
+// - a faded group composites its children as one layer, so overlapping
+//   children do not show through each other, including nested layers
+// - opacity 0 draws nothing and full opacity uses no layer
+// - one fragment-sized buffer per nesting level, allocated once; levels
+//   past the maximum draw without compositing
+// - the time and memory of fading a panel against per-child alpha
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t other[WIDTH * HEIGHT];
+
+#define BLUE      (0x001f)
+#define RED       (0xf800)
+#define GREEN     (0x07e0)
+
+
+//////////////////////////
+// Reference
+
+// Blend RGB565 %%fg%% over %%bg%% at %%opacity%% (of 32)
+static uint16_t blend(uint16_t fg, uint16_t bg, int opacity) {
+    int r = ((fg >> 11) * opacity + (bg >> 11) * (32 - opacity)) / 32;
+    int g = (((fg >> 5) & 0x3f) * opacity +
+      ((bg >> 5) & 0x3f) * (32 - opacity)) / 32;
+    int b = ((fg & 0x1f) * opacity + (bg & 0x1f) * (32 - opacity)) / 32;
+    return (r << 11) | (g << 5) | b;
+}
+
+// Each channel is within one step
+static void checkNear(uint16_t actual, uint16_t expected) {
+    check(abs((actual >> 11) - (expected >> 11)) <= 1);
+    check(abs(((actual >> 5) & 0x3f) - ((expected >> 5) & 0x3f)) <= 1);
+    check(abs((actual & 0x1f) - (expected & 0x1f)) <= 1);
+}
+
+// The allocations made while rendering %%scene%% as fragments of %%size%%
+static uint32_t renderAllocs(FfxScene scene, FfxSize size) {
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    testRenderAt(scene, other, size);
+    return atomic_load(&testHeap.allocs) - allocs;
+}
+
+static FfxNode addBox(FfxNode parent, int x, int y, int width, int height,
+  color_ffxt color) {
+
+    FfxScene scene = ((Node*)parent)->scene;
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(width, height));
+    ffx_sceneBox_setColor(box, color);
+    ffx_sceneNode_setPosition(box, ffx_point(x, y));
+    ffx_sceneGroup_appendChild(parent, box);
+    return box;
+}
+
+static FfxNode addGroup(FfxNode parent, uint8_t opacity) {
+    FfxScene scene = ((Node*)parent)->scene;
+    FfxNode group = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_setOpacity(group, opacity);
+    checkEqual(ffx_sceneGroup_getOpacity(group), opacity);
+    ffx_sceneGroup_appendChild(parent, group);
+    return group;
+}
+
+// A blue background, with a group of a red box overlapped by a green
+// box, which is overlapped by a nested group of a red box
+static FfxScene createPanel(uint8_t opacity, uint8_t nestedOpacity) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+    ffx_sceneGroup_appendChild(root, ffx_scene_createFill(scene,
+      ffx_color_rgb(0, 0, 255)));
+
+    FfxNode group = addGroup(root, opacity);
+    addBox(group, 20, 20, 100, 100, ffx_color_rgb(255, 0, 0));
+    addBox(group, 60, 60, 100, 100, ffx_color_rgb(0, 255, 0));
+
+    FfxNode nested = addGroup(group, nestedOpacity);
+    addBox(nested, 140, 140, 60, 60, ffx_color_rgb(255, 0, 0));
+
+    testSequence(scene, 1);
+    return scene;
+}
+
+
+//////////////////////////
+// Compositing
+
+static void testComposite(void) {
+    FfxScene scene = createPanel(16, 8);
+    testRender(scene, frame);
+
+    // Outside the group
+    checkEqual(frame[5 * WIDTH + 5], BLUE);
+
+    // The red box alone, and the green box over it, which does not show
+    // the red through
+    checkNear(frame[30 * WIDTH + 30], blend(RED, BLUE, 16));
+    checkNear(frame[80 * WIDTH + 80], blend(GREEN, BLUE, 16));
+    checkNear(frame[150 * WIDTH + 100], blend(GREEN, BLUE, 16));
+
+    // The nested layer composites into the group layer, then the group
+    // layer onto the background
+    checkNear(frame[150 * WIDTH + 150],
+      blend(blend(RED, GREEN, 8), BLUE, 16));
+    checkNear(frame[190 * WIDTH + 190], blend(blend(RED, BLUE, 8), BLUE, 16));
+
+    // Every fragment geometry composites alike
+    const FfxSize geometries[] = {
+        { 240, 240 }, { 37, 13 }, { 240, 7 }, { 1, 240 }
+    };
+    for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]); g++) {
+        testRenderAt(scene, other, geometries[g]);
+        check(memcmp(frame, other, sizeof(frame)) == 0);
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testLimits(void) {
+    // Hidden; nothing of the group is drawn
+    FfxScene scene = createPanel(0, 8);
+    testRender(scene, frame);
+    for (int i = 0; i < WIDTH * HEIGHT; i++) { checkEqual(frame[i], BLUE); }
+    ffx_scene_free(scene);
+
+    // Opaque; the children draw exactly, and no layer is allocated
+    // for either group
+    scene = createPanel(MAX_OPACITY, MAX_OPACITY);
+    checkEqual(renderAllocs(scene, ffx_size(WIDTH, FRAGMENT_HEIGHT)), 0);
+    testRender(scene, frame);
+    checkEqual(frame[30 * WIDTH + 30], RED);
+    checkEqual(frame[80 * WIDTH + 80], GREEN);
+    checkEqual(frame[150 * WIDTH + 150], RED);
+    ffx_scene_free(scene);
+
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Memory
+
+static void testBuffers(void) {
+    FfxScene scene = createPanel(16, 8);
+
+    // One buffer per level, allocated on the first render
+    checkEqual(renderAllocs(scene, ffx_size(WIDTH, FRAGMENT_HEIGHT)), 2);
+    for (int i = 0; i < 5; i++) {
+        testSequence(scene, 1);
+        checkEqual(renderAllocs(scene, ffx_size(WIDTH, FRAGMENT_HEIGHT)), 0);
+    }
+
+    // A larger fragment replaces them
+    uint32_t frees = atomic_load(&testHeap.frees);
+    checkEqual(renderAllocs(scene, ffx_size(WIDTH, 2 * FRAGMENT_HEIGHT)), 2);
+    checkEqual(atomic_load(&testHeap.frees) - frees, 2);
+    checkEqual(renderAllocs(scene, ffx_size(WIDTH, FRAGMENT_HEIGHT)), 0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    // Nested past the maximum depth; the deepest draw opaquely, and
+    // the pushes and pops still pair up
+    scene = testScene();
+    FfxNode parent = ffx_scene_root(scene);
+    ffx_sceneGroup_appendChild(parent, ffx_scene_createFill(scene,
+      ffx_color_rgb(0, 0, 255)));
+    for (int i = 0; i < MAX_LAYER_DEPTH + 2; i++) {
+        parent = addGroup(parent, 31);
+    }
+    addBox(parent, 0, 0, 10, 10, ffx_color_rgb(255, 0, 0));
+
+    // A sibling after the nesting is drawn at its own position
+    addBox(ffx_scene_root(scene), 50, 0, 10, 10, ffx_color_rgb(0, 255, 0));
+
+    testSequence(scene, 1);
+    checkEqual(renderAllocs(scene, ffx_size(WIDTH, FRAGMENT_HEIGHT)),
+      MAX_LAYER_DEPTH);
+    testRender(scene, frame);
+    checkEqual(frame[55], GREEN);
+    check(frame[5] != BLUE);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_BOXES    (8)
+#define BENCH_FRAMES   (200)
+
+// A panel of overlapping boxes sliding and fading out, either as a
+// group layer or by fading each box
+static double benchmarkFade(bool layer, uint32_t *memory) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+    ffx_sceneGroup_appendChild(root, ffx_scene_createFill(scene,
+      ffx_color_rgb(0, 0, 80)));
+
+    FfxNode panel = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(root, panel);
+
+    FfxNode boxes[BENCH_BOXES];
+    for (int i = 0; i < BENCH_BOXES; i++) {
+        boxes[i] = addBox(panel, 20, 20 + 20 * i, 200, 40,
+          ffx_color_rgb(30 * i, 200, 100));
+    }
+
+    uint32_t allocs = 0;
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        int opacity = MAX_OPACITY - 1 - (i * (MAX_OPACITY - 1)) /
+          BENCH_FRAMES;
+
+        ffx_sceneNode_setPosition(panel, ffx_point(i % 40, 0));
+        if (layer) {
+            ffx_sceneGroup_setOpacity(panel, opacity);
+        } else {
+            for (int b = 0; b < BENCH_BOXES; b++) {
+                ffx_sceneBox_setColor(boxes[b], ffx_color_rgba(30 * b, 200,
+                  100, opacity));
+            }
+        }
+
+        testSequence(scene, 1);
+
+        uint32_t before = atomic_load(&testHeap.allocs);
+        testRender(scene, frame);
+        allocs += atomic_load(&testHeap.allocs) - before;
+    }
+    double duration = (testNow() - start) / BENCH_FRAMES;
+
+    // Layers allocated while rendering; each is one fragment
+    *memory = allocs *
+      WIDTH * FRAGMENT_HEIGHT * 2;
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return duration;
+}
+
+static void benchmark(void) {
+    uint32_t layerMemory, childMemory;
+    double layer = benchmarkFade(true, &layerMemory);
+    double child = benchmarkFade(false, &childMemory);
+
+    checkEqual(layerMemory, WIDTH * FRAGMENT_HEIGHT * 2);
+    checkEqual(childMemory, 0);
+
+    printf("bench: fade %d boxes; layer %.1fus/frame (%d bytes), "
+      "per-child alpha %.1fus/frame\n", BENCH_BOXES, layer, layerMemory,
+      child);
+}
+
+
+int main(void) {
+    testComposite();
+    testLimits();
+    testBuffers();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,319 @@
+#include "test.h"
+
+// Outlined text (see: ../../src/node-label.c)
+//
+// - the fill of every combined glyph matches the 1-bit glyph
+// - outlined labels draw exactly as outline-then-fill, with each pixel
+//   written once, so translucent outlines under a neighbouring fill or
+//   outline are not blended twice; for any fragment geometry and for
+//   labels partially offscreen
+// - the atlas size and render time of each font, single-pass against
+//   the two-pass reference
+
+// Generated into node-label.c (see: ../../src/fonts.h)
+extern const uint32_t font_small_normal[], font_small_normal_combined[];
+extern const uint32_t font_small_bold[], font_small_bold_combined[];
+extern const uint32_t font_medium_normal[], font_medium_normal_combined[];
+extern const uint32_t font_medium_bold[], font_medium_bold_combined[];
+extern const uint32_t font_large_normal[], font_large_normal_combined[];
+extern const uint32_t font_large_bold[], font_large_bold_combined[];
+
+static const struct {
+    FfxFont font;
+    const char *name;
+    const uint32_t *plain, *combined;
+} fonts[] = {
+    { FfxFontSmall, "small", font_small_normal, font_small_normal_combined },
+    { FfxFontSmallBold, "small-bold", font_small_bold,
+      font_small_bold_combined },
+    { FfxFontMedium, "medium", font_medium_normal,
+      font_medium_normal_combined },
+    { FfxFontMediumBold, "medium-bold", font_medium_bold,
+      font_medium_bold_combined },
+    { FfxFontLarge, "large", font_large_normal, font_large_normal_combined },
+    { FfxFontLargeBold, "large-bold", font_large_bold,
+      font_large_bold_combined },
+};
+
+#define FONT_COUNT     (sizeof(fonts) / sizeof(fonts[0]))
+
+// See: node-label.c
+#define SPACE_WIDTH    (2)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t expected[WIDTH * HEIGHT];
+
+
+//////////////////////////
+// Reference
+
+// The code (0, 1 or 2 for the 1-bit font; 0 none, 1 outline, 2 fill
+// for the combined font) of each pixel of a label
+static uint8_t codes[HEIGHT][WIDTH];
+
+// Pixel %%i%% of a glyph at %%bits%% per pixel; glyphs are packed
+// without row padding, the first pixel in the high bits
+static int glyphPixel(const uint32_t *data, int i, int bits) {
+    int perWord = 32 / bits;
+    uint32_t word = data[i / perWord];
+    return (word >> (32 - bits * (1 + i % perWord))) & ((1 << bits) - 1);
+}
+
+// Merges the codes of %%text%% at %%position%% (fill wins), as the
+// plain (1 bit) or combined (2 bit) font draws it
+static void drawCodes(const uint32_t *font, int bits, const char *text,
+  FfxPoint position) {
+
+    memset(codes, 0, sizeof(codes));
+
+    int32_t advance = (font[0] & 0xff) + SPACE_WIDTH;
+
+    int x = position.x;
+    for (int i = 0; text[i]; i++, x += advance) {
+        char c = text[i];
+        if (c <= ' ' || c > '~') { continue; }
+
+        uint32_t info = font[c - ' '];
+        int gw = (info >> 27) & 0x1f, gh = (info >> 22) & 0x1f;
+        int gx = x + ((info >> 18) & 0x0f) - 6;
+        int gy = position.y + ((info >> 13) & 0x1f) - 6;
+        const uint32_t *data = &font[95 + (info & 0x1fff)];
+
+        for (int p = 0; p < gw * gh; p++) {
+            int px = gx + p % gw, py = gy + p / gw;
+            if (px < 0 || py < 0 || px >= WIDTH || py >= HEIGHT) { continue; }
+
+            int code = glyphPixel(data, p, bits);
+            if (bits == 1) { code <<= 1; }
+            codes[py][px] |= code;
+        }
+    }
+}
+
+static uint16_t blend(uint16_t bg, const FfxColorRGB565 *color) {
+    if (color->opacity == MAX_OPACITY) { return color->rgb16; }
+    if (color->opacity == 0) { return bg; }
+
+    uint32_t fga_1 = color->alpha_1;
+    int r = (color->red + (fga_1 * (bg >> 11))) >> 16;
+    int g = (color->green + (fga_1 * ((bg >> 5) & 0x3f))) >> 16;
+    int b = (color->blue + (fga_1 * (bg & 0x1f))) >> 16;
+    return (r << 11) | (g << 5) | b;
+}
+
+// Draws a label into %%expected%%, writing each covered pixel once
+static void drawLabel(int f, const char *text, FfxPoint position,
+  color_ffxt textColor, color_ffxt outlineColor) {
+
+    FfxColorRGB565 fill = ffx_color_parseRGB565(textColor);
+    FfxColorRGB565 outline = ffx_color_parseRGB565(outlineColor);
+
+    // The fill drawn by the plain font, which every combined glyph
+    // must match
+    static uint8_t plain[HEIGHT][WIDTH];
+    drawCodes(fonts[f].plain, 1, text, position);
+    memcpy(plain, codes, sizeof(codes));
+
+    if (outline.opacity != 0) {
+        drawCodes(fonts[f].combined, 2, text, position);
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                checkEqual(codes[y][x] >> 1, plain[y][x] >> 1);
+            }
+        }
+    }
+
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            uint16_t *pixel = &expected[y * WIDTH + x];
+            if (plain[y][x]) {
+                *pixel = blend(*pixel, &fill);
+            } else if (outline.opacity != 0 && codes[y][x]) {
+                *pixel = blend(*pixel, &outline);
+            }
+        }
+    }
+}
+
+
+//////////////////////////
+// Rendering
+
+// Every printable character, a few per label so the large fonts fit
+static const char *text[] = {
+    "!\"#$%&'()*", "+,-./01234", "56789:;<=>", "?@ABCDEFGH",
+    "IJKLMNOPQR", "STUVWXYZ[\\", "]^_`abcdef", "ghijklmnop",
+    "qrstuvwxyz", "{|}~ ~ ~ X"
+};
+
+#define TEXT_COUNT     (sizeof(text) / sizeof(text[0]))
+
+static const FfxSize geometries[] = {
+    { 240, 24 }, { 240, 240 }, { 37, 13 }, { 1, 240 }, { 120, 7 }
+};
+
+#define BACKGROUND     (ffx_color_rgb(20, 60, 120))
+
+static FfxNode addLabel(FfxScene scene, int f, const char *text,
+  FfxPoint position, color_ffxt textColor, color_ffxt outlineColor) {
+
+    FfxNode node = ffx_scene_createLabel(scene, fonts[f].font, text);
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, position);
+    ffx_sceneLabel_setTextColor(node, textColor);
+    ffx_sceneLabel_setOutlineColor(node, outlineColor);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    return node;
+}
+
+// Each chunk of text twice: once on screen, then overlapping it and
+// partially off an edge, so the second outline covers the first fill
+static void testFont(int f, color_ffxt textColor, color_ffxt outlineColor) {
+    FfxColorRGB565 background = ffx_color_parseRGB565(BACKGROUND);
+
+    for (int t = 0; t < TEXT_COUNT; t++) {
+        FfxScene scene = testScene();
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene),
+          ffx_scene_createFill(scene, BACKGROUND));
+
+        for (int i = 0; i < WIDTH * HEIGHT; i++) {
+            expected[i] = background.rgb16;
+        }
+
+        const FfxPoint positions[] = {
+            { 7 + 3 * t, 20 * t + 2 },
+            { (t & 1) ? -13: 140, (t & 2) ? 222: 20 * t - 9 }
+        };
+
+        for (int i = 0; i < 2; i++) {
+            addLabel(scene, f, text[t], positions[i], textColor,
+              outlineColor);
+            drawLabel(f, text[t], positions[i], textColor, outlineColor);
+        }
+
+        testSequence(scene, 1);
+        for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]);
+          g++) {
+            testRenderAt(scene, frame, geometries[g]);
+            for (int i = 0; i < WIDTH * HEIGHT; i++) {
+                checkEqual(frame[i], expected[i]);
+            }
+        }
+
+        ffx_scene_free(scene);
+    }
+
+    checkEqual(testLive(), 0);
+}
+
+static void testFonts(void) {
+    for (int f = 0; f < FONT_COUNT; f++) {
+        FfxFontMetrics metrics = ffx_scene_getFontMetrics(fonts[f].font);
+        checkEqual(metrics.size.width, fonts[f].plain[0] & 0xff);
+        checkEqual(metrics.size.width, fonts[f].combined[0] & 0xff);
+
+        // Opaque, translucent and without an outline
+        testFont(f, COLOR_WHITE, COLOR_BLACK);
+        testFont(f, ffx_color_rgba(255, 200, 0, 20),
+          ffx_color_rgba(200, 0, 80, 12));
+        testFont(f, ffx_color_rgba(255, 200, 0, 20), COLOR_TRANSPARENT);
+    }
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_RUNS     (2000)
+
+static const char *benchText = "The quick brown fox jumps";
+
+// The bytes of bitmap data of %%font%% at %%bits%% per pixel
+static size_t atlasSize(const uint32_t *font, int bits) {
+    size_t words = 0;
+    for (int i = 1; i < 95; i++) {
+        uint32_t info = font[i];
+        int pixels = ((info >> 27) & 0x1f) * ((info >> 22) & 0x1f);
+        size_t end = (info & 0x1fff) + (pixels * bits + 31) / 32;
+        if (end > words) { words = end; }
+    }
+    return 4 * words;
+}
+
+// The previous renderer; the outline glyph, then the fill glyph over
+// it, clipping each pixel to the fragment
+static void renderTwoPass(uint16_t *fragment, int f, const char *text,
+  FfxPoint position, uint16_t outline, uint16_t fill) {
+
+    for (int pass = 0; pass < 2; pass++) {
+        const uint32_t *font = pass ? fonts[f].plain: fonts[f].combined;
+        int bits = pass ? 1: 2;
+        uint16_t color = pass ? fill: outline;
+        int32_t advance = (font[0] & 0xff) + SPACE_WIDTH;
+
+        int x = position.x;
+        for (int i = 0; text[i]; i++, x += advance) {
+            char c = text[i];
+            if (c <= ' ' || c > '~') { continue; }
+
+            uint32_t info = font[c - ' '];
+            int gw = (info >> 27) & 0x1f, gh = (info >> 22) & 0x1f;
+            int gx = x + ((info >> 18) & 0x0f) - 6;
+            int gy = position.y + ((info >> 13) & 0x1f) - 6;
+            const uint32_t *data = &font[95 + (info & 0x1fff)];
+
+            for (int p = 0; p < gw * gh; p++) {
+                if (glyphPixel(data, p, bits) == 0) { continue; }
+                int px = gx + p % gw, py = gy + p / gw;
+                if (px < 0 || py < 0 || px >= WIDTH ||
+                  py >= FRAGMENT_HEIGHT) {
+                    continue;
+                }
+                fragment[py * WIDTH + px] = color;
+            }
+        }
+    }
+}
+
+static void benchmark(void) {
+    static uint16_t fragment[WIDTH * FRAGMENT_HEIGHT];
+    FfxPoint position = ffx_point(4, 4);
+
+    for (int f = 0; f < FONT_COUNT; f++) {
+        FfxScene scene = testScene();
+        addLabel(scene, f, benchText, position, COLOR_WHITE, COLOR_BLACK);
+        testSequence(scene, 1);
+
+        double start = testNow();
+        for (int i = 0; i < BENCH_RUNS; i++) {
+            ffx_scene_render(scene, fragment, ffx_point(0, 0),
+              ffx_size(WIDTH, FRAGMENT_HEIGHT));
+        }
+        double single = (testNow() - start) / BENCH_RUNS;
+
+        ffx_scene_free(scene);
+
+        start = testNow();
+        for (int i = 0; i < BENCH_RUNS; i++) {
+            renderTwoPass(fragment, f, benchText, position, 0x0000, 0xffff);
+        }
+        double twoPass = (testNow() - start) / BENCH_RUNS;
+
+        size_t plain = atlasSize(fonts[f].plain, 1);
+        size_t combined = atlasSize(fonts[f].combined, 2);
+        check(combined > plain);
+
+        printf("bench: %-11s 1-bit %5zu bytes, combined %5zu bytes; "
+          "one pass %.2fus, two pass %.2fus\n", fonts[f].name, plain,
+          combined, single, twoPass);
+    }
+
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testFonts();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,313 @@
+#include "test.h"
+
+// Paragraphs (see: ../../src/node-paragraph.c)
+//
+// - word and character wrapping, newlines, alignment and the ellipsis
+//   draw each line as a label of that line would
+// - the line count and truncated flag are those of the last sequence,
+//   including a paragraph too short for a single line
+// - line breaks are cached until the text, wrap or fitting size change
+// - lines are culled per fragment for any fragment geometry
+// - the time to lay out and draw a long text
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t expected[WIDTH * HEIGHT];
+
+// The small font is 8x15, so each character advances 10 pixels and a
+// width of 100 fits 10 characters
+#define FONT          (FfxFontSmall)
+#define ADVANCE       (10)
+#define LINE_HEIGHT   (15)
+
+
+//////////////////////////
+// Reference
+
+static FfxNode addParagraph(FfxScene scene, FfxPoint position, FfxSize size,
+  const char *text) {
+
+    FfxNode node = ffx_scene_createParagraph(scene, FONT, size, text);
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, position);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    return node;
+}
+
+// The paragraph draws exactly %%lines%% (NULL-terminated), each as a
+// label of that line, aligned within %%width%%
+static void checkLines(FfxScene scene, FfxPoint position, int width,
+  FfxTextAlign align, const char **lines) {
+
+    FfxScene reference = testScene();
+    for (int i = 0; lines[i]; i++) {
+        int x = position.x;
+        int lineWidth = ADVANCE * strlen(lines[i]) - 2;
+        if (align == FfxTextAlignCenter) { x += (width - lineWidth) / 2; }
+        if (align == FfxTextAlignRight) { x += width - lineWidth; }
+
+        FfxNode label = ffx_scene_createLabel(reference, FONT, lines[i]);
+        ffx_sceneNode_setPosition(label, ffx_point(x,
+          position.y + i * LINE_HEIGHT));
+        ffx_sceneGroup_appendChild(ffx_scene_root(reference), label);
+    }
+    testSequence(reference, 0);
+    testRender(reference, expected);
+    ffx_scene_free(reference);
+
+    const FfxSize geometries[] = {
+        { 240, 24 }, { 240, 240 }, { 37, 13 }, { 1, 240 }, { 240, 7 }
+    };
+    for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]); g++) {
+        testRenderAt(scene, frame, geometries[g]);
+        check(memcmp(frame, expected, sizeof(frame)) == 0);
+    }
+}
+
+// Lays out %%text%% in a paragraph 100 pixels wide and %%rows%% lines
+// tall, checking the lines drawn
+static void checkLayout(const char *text, FfxTextWrap wrap, int rows,
+  FfxTextAlign align, bool truncated, const char **lines) {
+
+    FfxScene scene = testScene();
+    FfxPoint position = ffx_point(30, 40);
+    FfxNode node = addParagraph(scene, position,
+      ffx_size(100, rows * LINE_HEIGHT), text);
+    ffx_sceneParagraph_setWrap(node, wrap);
+    ffx_sceneParagraph_setAlign(node, align);
+    testSequence(scene, 1);
+
+    size_t count = 0;
+    while (lines[count]) { count++; }
+    checkEqual(ffx_sceneParagraph_getLineCount(node), count);
+    checkEqual(ffx_sceneParagraph_getTruncated(node), truncated);
+
+    checkLines(scene, position, 100, align, lines);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Layout
+
+static void testWrapping(void) {
+    // Words move to the next line, and the spaces at the break are
+    // dropped; a word longer than a line is split
+    checkLayout("The quick brown fox   jumps overthelazydog", FfxTextWrapWord,
+      8, FfxTextAlignLeft, false, (const char*[]){
+        "The quick", "brown fox", "jumps", "overthelaz", "ydog", NULL
+      });
+
+    checkLayout("The quick brown fox", FfxTextWrapCharacter, 8,
+      FfxTextAlignLeft, false, (const char*[]){
+        "The quick", "brown fox", NULL
+      });
+    checkLayout("The quickbrown fox", FfxTextWrapCharacter, 8,
+      FfxTextAlignLeft, false, (const char*[]){
+        "The quickb", "rown fox", NULL
+      });
+
+    // Newlines break, keeping indentation and empty lines
+    checkLayout("one\n  two\n\nthree", FfxTextWrapWord, 8, FfxTextAlignLeft,
+      false, (const char*[]){ "one", "  two", "", "three", NULL });
+}
+
+static void testAlignment(void) {
+    const char *lines[] = { "centered", "text", NULL };
+    checkLayout("centered text", FfxTextWrapWord, 8, FfxTextAlignCenter,
+      false, lines);
+    checkLayout("centered text", FfxTextWrapWord, 8, FfxTextAlignRight,
+      false, lines);
+}
+
+static void testTruncation(void) {
+    // The last line is cut short to make room for the ellipsis
+    checkLayout("The quick brown fox jumps over", FfxTextWrapWord, 2,
+      FfxTextAlignLeft, true, (const char*[]){
+        "The quick", "brown f...", NULL
+      });
+    checkLayout("one\ntwo\nthree", FfxTextWrapWord, 2, FfxTextAlignRight,
+      true, (const char*[]){ "one", "two...", NULL });
+
+    // Too narrow for the whole ellipsis; only what fits is drawn
+    FfxScene scene = testScene();
+    FfxNode node = addParagraph(scene, ffx_point(30, 40), ffx_size(20, 15),
+      "hello");
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 1);
+    check(ffx_sceneParagraph_getTruncated(node));
+    checkLines(scene, ffx_point(30, 40), 20, FfxTextAlignLeft,
+      (const char*[]){ "..", NULL });
+    ffx_scene_free(scene);
+
+    // Too short for a line; nothing is drawn, but the text is truncated
+    checkLayout("hello", FfxTextWrapWord, 0, FfxTextAlignLeft, true,
+      (const char*[]){ NULL });
+
+    // Too narrow for a character
+    scene = testScene();
+    node = addParagraph(scene, ffx_point(0, 0), ffx_size(5, 100),
+      "hello");
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 0);
+    check(ffx_sceneParagraph_getTruncated(node));
+    ffx_scene_free(scene);
+
+    // Nothing to truncate
+    checkLayout("", FfxTextWrapWord, 0, FfxTextAlignLeft, false,
+      (const char*[]){ NULL });
+
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Caching
+
+// The allocations made by a sequence
+static uint32_t sequenceAllocs(FfxScene scene) {
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    testSequence(scene, 1);
+    return atomic_load(&testHeap.allocs) - allocs;
+}
+
+static void testCache(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addParagraph(scene, ffx_point(0, 0), ffx_size(100, 150),
+      "alpha beta gamma delta");
+
+    // The getters only change with a sequence
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 0);
+    uint32_t allocs = sequenceAllocs(scene);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 3);
+
+    // Unchanged, or the same text set again; only the render is allocated
+    uint32_t renderAllocs = sequenceAllocs(scene);
+    checkEqual(renderAllocs, allocs - 1);
+    ffx_sceneParagraph_setText(node, "alpha beta gamma delta");
+    checkEqual(sequenceAllocs(scene), renderAllocs);
+
+    // A width or height fitting the same characters keeps the layout
+    ffx_sceneParagraph_setSize(node, ffx_size(107, 158));
+    checkEqual(sequenceAllocs(scene), renderAllocs);
+
+    // New text of the same length is laid out again
+    ffx_sceneParagraph_setText(node, "alphabeta gamma delta ");
+    checkEqual(sequenceAllocs(scene), renderAllocs + 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 3);
+
+    // As are changes to the wrap and the characters which fit
+    ffx_sceneParagraph_setWrap(node, FfxTextWrapCharacter);
+    checkEqual(sequenceAllocs(scene), renderAllocs + 1);
+    ffx_sceneParagraph_setSize(node, ffx_size(60, 158));
+    checkEqual(sequenceAllocs(scene), renderAllocs + 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 4);
+
+    // Offscreen, the getters are still current
+    ffx_sceneNode_setPosition(node, ffx_point(300, 0));
+    ffx_sceneParagraph_setText(node, "a\nb");
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 2);
+
+    ffx_sceneParagraph_setText(node, NULL);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 0);
+    check(!ffx_sceneParagraph_getTruncated(node));
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Culling
+
+static void testCulling(void) {
+    // Taller than the screen and starting above it
+    char text[40 * 4 + 1] = { 0 };
+    const char *lines[41] = { NULL };
+    static char storage[40][12];
+    for (int i = 0; i < 40; i++) {
+        snprintf(storage[i], sizeof(storage[i]), "%03d", i);
+        lines[i] = storage[i];
+        strcat(text, storage[i]);
+        strcat(text, "\n");
+    }
+
+    FfxScene scene = testScene();
+    FfxPoint position = ffx_point(-5, -97);
+    FfxNode node = addParagraph(scene, position,
+      ffx_size(100, 40 * LINE_HEIGHT), text);
+    ffx_sceneParagraph_setOutlineColor(node, COLOR_TRANSPARENT);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParagraph_getLineCount(node), 40);
+    checkLines(scene, position, 100, FfxTextAlignLeft, lines);
+    ffx_scene_free(scene);
+
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_RUNS     (200)
+
+static void benchmark(void) {
+    // About 2kb of prose
+    static char text[2048];
+    const char *words[] = {
+        "signing", "a", "transaction", "to", "0x8ba1f109551bD432803012",
+        "for", "the", "amount", "of", "12.5", "ether", "with", "fee"
+    };
+    uint32_t seed = 37;
+    text[0] = 0;
+    while (strlen(text) < sizeof(text) - 32) {
+        strcat(text, words[testRandom(&seed) % 13]);
+        strcat(text, " ");
+    }
+
+    FfxScene scene = testScene();
+    FfxNode node = addParagraph(scene, ffx_point(8, 0),
+      ffx_size(224, 240), text);
+    ffx_sceneParagraph_setOutlineColor(node, COLOR_BLACK);
+
+    // Alternate the last character so every sequence lays out again
+    size_t last = strlen(text) - 1;
+    double start = testNow();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        text[last] = (i & 1) ? '.': ' ';
+        ffx_sceneParagraph_setText(node, text);
+        testSequence(scene, 1);
+    }
+    double layoutCost = (testNow() - start) / BENCH_RUNS;
+    check(ffx_sceneParagraph_getTruncated(node));
+
+    start = testNow();
+    for (int i = 0; i < BENCH_RUNS; i++) { testSequence(scene, 1); }
+    double cachedCost = (testNow() - start) / BENCH_RUNS;
+
+    start = testNow();
+    for (int i = 0; i < BENCH_RUNS; i++) { testRender(scene, frame); }
+    double renderCost = (testNow() - start) / BENCH_RUNS;
+
+    printf("bench: %zu characters, %zu lines; layout %.1fus, cached "
+      "%.1fus, render %.1fus/frame (outlined)\n", strlen(text),
+      ffx_sceneParagraph_getLineCount(node), layoutCost, cachedCost,
+      renderCost);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testWrapping();
+    testAlignment();
+    testTruncation();
+    testCache();
+    testCulling();
+    benchmark();
+    return 0;
+}
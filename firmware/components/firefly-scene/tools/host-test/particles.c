@@ -0,0 +1,340 @@
+#include "test.h"
+
+// Particles (see: ../../src/node-particles.c)
+//
+// - a still point draws exactly its square, in the ramp color, and
+//   moves by its velocity
+// - particles expire after their life; bursts and the rate clamp to the
+//   capacity, a long stall is capped and nothing runs while hidden
+// - rendering in fragments of any size matches a single full-frame
+//   render, for every point size and both sprite formats, including
+//   particles leaving the screen
+// - an invalid capacity or a failed allocation creates nothing
+// - the cost per particle of a frame, for points and sprites
+
+
+#define SPRITE_SIZE      (8)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t fragmented[WIDTH * HEIGHT];
+
+static FfxNode addParticles(FfxScene scene, size_t capacity, int x, int y,
+  const FfxParticleEmitter *emitter) {
+
+    FfxNode node = ffx_scene_createParticles(scene, capacity);
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, ffx_point(x, y));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    if (emitter) { ffx_sceneParticles_setEmitter(node, emitter); }
+    return node;
+}
+
+// An RGB565 image with a 4-bit alpha, which precedes the pixels
+static uint16_t* createSprite(uint32_t seed, size_t *length) {
+    size_t pixels = SPRITE_SIZE * SPRITE_SIZE;
+    size_t alphaWords = (pixels + 3) / 4;
+    size_t count = 4 + alphaWords + pixels;
+
+    uint16_t *data = malloc(count * 2);
+    check(data != NULL);
+    for (int i = 4; i < count; i++) { data[i] = testRandom(&seed); }
+
+    data[0] = 0x05;
+    data[1] = SPRITE_SIZE;
+    data[2] = SPRITE_SIZE;
+    data[3] = alphaWords;
+
+    *length = count * 2;
+    return data;
+}
+
+// The columns lit in row %%y%%, as [left, right), or right == left
+static void litColumns(int y, int *left, int *right) {
+    *left = *right = 0;
+    for (int x = 0; x < WIDTH; x++) {
+        if (frame[y * WIDTH + x] == 0) { continue; }
+        if (*left == *right) { *left = x; }
+        *right = x + 1;
+    }
+}
+
+
+//////////////////////////
+// Points
+
+static void testPoint(void) {
+    FfxScene scene = testScene();
+
+    FfxParticleEmitter emitter = {
+        .life = 1000,
+        .startColor = COLOR_RED,
+        .endColor = COLOR_RED,
+        .pointSize = 3
+    };
+    FfxNode node = addParticles(scene, 4, 50, 60, &emitter);
+
+    ffx_sceneParticles_emit(node, 1);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParticles_getCount(node), 1);
+
+    testRender(scene, frame);
+    uint16_t red = ffx_color_rgb16(COLOR_RED);
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            bool lit = (x >= 49 && x < 52 && y >= 59 && y < 62);
+            checkEqual(frame[y * WIDTH + x], lit ? red: 0);
+        }
+    }
+
+    // Moving at 100px/s, a 100ms step moves 10px (within rounding)
+    ffx_sceneNode_free(node);
+    emitter.velocity = ffx_point(100, -50);
+    node = addParticles(scene, 4, 50, 60, &emitter);
+    ffx_sceneParticles_emit(node, 1);
+    testSequence(scene, 1);
+    testSequence(scene, 100);
+    testRender(scene, frame);
+
+    int left, right;
+    litColumns(55, &left, &right);
+    checkEqual(right - left, 3);
+    check(left >= 58 && left <= 59);
+    litColumns(60, &left, &right);
+    checkEqual(right - left, 0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Life
+
+static void testLife(void) {
+    FfxScene scene = testScene();
+
+    FfxParticleEmitter emitter = {
+        .life = 200,
+        .area = ffx_size(40, 40),
+        .velocityJitter = ffx_point(30, 30),
+        .startColor = COLOR_WHITE,
+        .endColor = COLOR_BLUE,
+        .pointSize = 1
+    };
+    FfxNode node = addParticles(scene, 64, 120, 120, &emitter);
+
+    // Bursts add up, to the capacity
+    ffx_sceneParticles_emit(node, 30);
+    ffx_sceneParticles_emit(node, 20);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParticles_getCount(node), 50);
+
+    testSequence(scene, 100);
+    testSequence(scene, 50);
+    checkEqual(ffx_sceneParticles_getCount(node), 50);
+
+    // Past their life, every particle has expired
+    testSequence(scene, 100);
+    checkEqual(ffx_sceneParticles_getCount(node), 0);
+
+    ffx_sceneParticles_emit(node, 1000);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParticles_getCount(node), 64);
+    testSequence(scene, 100);
+    testSequence(scene, 100);
+    testSequence(scene, 100);
+    checkEqual(ffx_sceneParticles_getCount(node), 0);
+
+    // The rate is owed across sequences
+    emitter.rate = 50;
+    emitter.life = 10000;
+    ffx_sceneParticles_setEmitter(node, &emitter);
+    for (int i = 0; i < 40; i++) { testSequence(scene, 25); }
+    checkEqual(ffx_sceneParticles_getCount(node), 50);
+
+    // A long stall is capped, rather than emitting (or moving) a burst
+    testSequence(scene, 5000);
+    checkEqual(ffx_sceneParticles_getCount(node), 55);
+
+    // Nothing happens while hidden
+    ffx_sceneNode_setHidden(node, true);
+    for (int i = 0; i < 10; i++) { testSequence(scene, 100); }
+    checkEqual(ffx_sceneParticles_getCount(node), 55);
+
+    // Nor is the time hidden owed afterwards
+    ffx_sceneNode_setHidden(node, false);
+    testSequence(scene, 100);
+    checkEqual(ffx_sceneParticles_getCount(node), 60);
+
+    // The rate fills to the capacity
+    for (int i = 0; i < 20; i++) { testSequence(scene, 100); }
+    checkEqual(ffx_sceneParticles_getCount(node), 64);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Fragments
+
+static void checkFragments(FfxScene scene) {
+    static const FfxSize sizes[] = {
+        { WIDTH, 24 }, { WIDTH, 10 }, { 64, 17 }, { 7, 240 }
+    };
+
+    testRenderAt(scene, frame, ffx_size(WIDTH, HEIGHT));
+    for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        testRenderAt(scene, fragmented, sizes[i]);
+        check(memcmp(frame, fragmented, sizeof(frame)) == 0);
+    }
+}
+
+static void testFragments(void) {
+    size_t spriteLength, opaqueLength;
+    uint16_t *sprite = createSprite(45, &spriteLength);
+    uint16_t *opaque = testImage(0x04, 5, 7, 46, &opaqueLength);
+
+    FfxScene scene = testScene();
+
+    // A fountain near the edge, so particles leave on every side
+    FfxParticleEmitter emitter = {
+        .rate = 800,
+        .life = 1500,
+        .lifeJitter = 500,
+        .area = ffx_size(30, 10),
+        .velocity = ffx_point(40, -120),
+        .velocityJitter = ffx_point(150, 80),
+        .gravity = ffx_point(0, 200),
+        .startColor = ffx_color_rgb(255, 200, 0),
+        .endColor = ffx_color_setOpacity(ffx_color_rgb(0, 40, 255), 0),
+        .pointSize = 1
+    };
+    FfxNode node = addParticles(scene, 2000, 220, 200, &emitter);
+
+    uint32_t drawn = 0;
+    for (int f = 0; f < 160; f++) {
+        if (f % 20 == 0) {
+            emitter.pointSize = 1 + (f / 20) % 4;
+            ffx_sceneParticles_setEmitter(node, &emitter);
+        }
+        switch (f / 40) {
+            case 1:
+                ffx_sceneParticles_setSprite(node, sprite, spriteLength);
+                break;
+            case 2:
+                ffx_sceneParticles_setSprite(node, opaque, opaqueLength);
+                break;
+            default:
+                ffx_sceneParticles_setSprite(node, NULL, 0);
+                break;
+        }
+        if (f == 80) { ffx_sceneNode_setPosition(node, ffx_point(10, 20)); }
+
+        testSequence(scene, 16);
+        checkFragments(scene);
+
+        for (int i = 0; i < WIDTH * HEIGHT; i++) { drawn += (frame[i] != 0); }
+    }
+    check(drawn > 0);
+    check(ffx_sceneParticles_getCount(node) > 100);
+
+    ffx_scene_free(scene);
+    free(sprite);
+    free(opaque);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Life-cycle
+
+static void testCreate(void) {
+    FfxScene scene = testScene();
+
+    check(ffx_scene_createParticles(scene, 0) == NULL);
+    check(ffx_scene_createParticles(scene, 2049) == NULL);
+
+    FfxNode node = ffx_scene_createParticles(scene, 2048);
+    check(node != NULL);
+    check(ffx_scene_isParticles(node));
+    ffx_sceneNode_free(node);
+
+    // The node's slot is held, so the next alloc is the arrays
+    uint32_t live = testLive();
+    atomic_store(&testHeap.failIn, 1);
+    check(ffx_scene_createParticles(scene, 100) == NULL);
+    checkEqual(testLive(), live);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_COUNT      (2000)
+#define BENCH_FRAMES     (20)
+
+// The best ns per particle of a frame; a sequence and ten fragments
+static double benchmarkFrame(const uint16_t *sprite, size_t length,
+  uint8_t pointSize) {
+
+    FfxScene scene = testScene();
+
+    FfxParticleEmitter emitter = {
+        .life = 60000,
+        .area = ffx_size(WIDTH, HEIGHT),
+        .velocityJitter = ffx_point(10, 10),
+        .startColor = COLOR_WHITE,
+        .endColor = ffx_color_setOpacity(COLOR_WHITE, 0),
+        .pointSize = pointSize
+    };
+    FfxNode node = addParticles(scene, BENCH_COUNT, WIDTH / 2, HEIGHT / 2,
+      &emitter);
+    if (sprite) { ffx_sceneParticles_setSprite(node, sprite, length); }
+
+    ffx_sceneParticles_emit(node, BENCH_COUNT);
+    testSequence(scene, 1);
+    checkEqual(ffx_sceneParticles_getCount(node), BENCH_COUNT);
+
+    double best = 1e30;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        double start = testNow();
+        testSequence(scene, 16);
+        testRender(scene, frame);
+        double duration = testNow() - start;
+        if (duration < best) { best = duration; }
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return 1000 * best / BENCH_COUNT;
+}
+
+static void benchmark(void) {
+    size_t length;
+    uint16_t *sprite = createSprite(47, &length);
+
+    double points = benchmarkFrame(NULL, 0, 2);
+    double sprites = benchmarkFrame(sprite, length, 1);
+
+    free(sprite);
+
+    printf("bench: %d particles per frame; 2x2 points %.1fns/particle "
+      "(%.0fus), %dx%d A4 sprites %.1fns/particle (%.0fus)\n",
+      BENCH_COUNT, points, points * BENCH_COUNT / 1000, SPRITE_SIZE,
+      SPRITE_SIZE, sprites, sprites * BENCH_COUNT / 1000);
+}
+
+
+int main(void) {
+    testPoint();
+    testLife();
+    testFragments();
+    testCreate();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,315 @@
+#include <pthread.h>
+#include <stddef.h>
+
+#include "test.h"
+
+#include "scene.h"
+
+// Node pools and types (see: ../../src/pool.c and ../../src/node.c)
+//
+// - the node header packs its type, flags and slot into one word
+// - each vtable is registered once and found again by its type
+// - freed slots are reused without touching the heap
+// - slabs emptied by a mass free are returned by the next sequence,
+//   keeping one spare, and a full pool falls back onto the heap
+// - slots claimed and freed from many threads while the sequence trims
+//   are never handed out twice
+// - bytes per node, create and free cost and the traversal cost
+
+
+#define SLAB_NODES       (POOL_SLAB_SLOTS * 10)
+
+static FfxNode createBox(FfxScene scene) {
+    FfxNode node = ffx_scene_createBox(scene, ffx_size(10, 10));
+    check(node != NULL);
+    return node;
+}
+
+
+//////////////////////////
+// Types
+
+static void testHeader(void) {
+    // The type, flags and slot share the first word; the position fills
+    // the rest of the first pointer on 64-bit
+    checkEqual(offsetof(Node, position), 4);
+    checkEqual(offsetof(Node, scene), sizeof(void*));
+    checkEqual(sizeof(Node), (sizeof(void*) == 4) ? 24: 40);
+
+    check(NodeFlagPool < 0x100);
+    check(MAX_NODE_POOLS <= (1 << (16 - NODE_SLOT_BITS)));
+    check(MAX_POOL_SLABS * POOL_SLAB_SLOTS <= (1 << NODE_SLOT_BITS));
+}
+
+static void testTypes(void) {
+    FfxScene scene = testScene();
+
+    FfxNode box = createBox(scene);
+    FfxNode other = createBox(scene);
+    FfxNode group = ffx_scene_createGroup(scene);
+
+    // Each type is registered once
+    checkEqual(((Node*)box)->type, ((Node*)other)->type);
+    check(((Node*)box)->type != ((Node*)group)->type);
+    checkEqual(((Node*)ffx_scene_root(scene))->type, ((Node*)group)->type);
+
+    check(ffx_scene_isBox(box));
+    check(!ffx_scene_isBox(group));
+    check(ffx_scene_isGroup(group));
+    check(strcmp(ffx_sceneNode_getName(box), "BoxNode") == 0);
+    check(strcmp(ffx_sceneNode_getName(group), "GroupNode") == 0);
+
+    // The wrong method is refused
+    check(ffx_sceneNode_getState(group, ffx_sceneNode_getVTable(box)) ==
+      NULL);
+
+    ffx_sceneNode_free(box);
+    ffx_sceneNode_free(other);
+    ffx_sceneNode_free(group);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Slabs
+
+static FfxNode nodes[MAX_POOL_SLABS * POOL_SLAB_SLOTS + 10];
+
+static void testReuse(void) {
+    FfxScene scene = testScene();
+
+    for (int i = 0; i < SLAB_NODES; i++) { nodes[i] = createBox(scene); }
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+
+    // Freed and created again, without a sequence between; every node
+    // lands in a slot already held
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < SLAB_NODES; i++) {
+            ffx_sceneNode_free(nodes[i]);
+        }
+        for (int i = 0; i < SLAB_NODES; i++) {
+            nodes[i] = createBox(scene);
+            check(ffx_sceneNode_hasFlags(nodes[i], NodeFlagPool));
+        }
+    }
+    checkEqual(atomic_load(&testHeap.allocs), allocs);
+
+    // Every slot is distinct
+    for (int i = 0; i < SLAB_NODES; i++) {
+        for (int j = i + 1; j < SLAB_NODES; j++) {
+            check(((Node*)nodes[i])->slot != ((Node*)nodes[j])->slot);
+        }
+    }
+
+    for (int i = 0; i < SLAB_NODES; i++) { ffx_sceneNode_free(nodes[i]); }
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testTrim(void) {
+    FfxScene scene = testScene();
+    testSequence(scene, 1);
+    uint32_t live = testLive();
+
+    for (int i = 0; i < SLAB_NODES; i++) { nodes[i] = createBox(scene); }
+    uint32_t grown = testLive();
+    check(grown >= live + SLAB_NODES / POOL_SLAB_SLOTS);
+
+    // Nothing is returned while nodes remain
+    ffx_sceneNode_free(nodes[0]);
+    testSequence(scene, 1);
+    checkEqual(testLive(), grown);
+
+    // Emptied slabs are returned by the sequence, but one is kept
+    for (int i = 1; i < SLAB_NODES; i++) { ffx_sceneNode_free(nodes[i]); }
+    checkEqual(testLive(), grown);
+    testSequence(scene, 1);
+    checkEqual(testLive(), live + 1);
+
+    // The spare is used first, then the pool grows again
+    for (int i = 0; i < SLAB_NODES; i++) { nodes[i] = createBox(scene); }
+    checkEqual(testLive(), grown);
+    for (int i = 0; i < SLAB_NODES; i++) { ffx_sceneNode_free(nodes[i]); }
+    testSequence(scene, 1);
+    checkEqual(testLive(), live + 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testFull(void) {
+    FfxScene scene = testScene();
+
+    // Once every slab is in use, nodes come from the heap
+    int count = sizeof(nodes) / sizeof(nodes[0]);
+    int pooled = 0;
+    for (int i = 0; i < count; i++) {
+        nodes[i] = createBox(scene);
+        if (ffx_sceneNode_hasFlags(nodes[i], NodeFlagPool)) { pooled++; }
+    }
+    check(pooled <= MAX_POOL_SLABS * POOL_SLAB_SLOTS);
+    check(pooled > count - 10 - POOL_SLAB_SLOTS);
+
+    // Pooled nodes go back to their slab and the rest to the heap
+    for (int i = count - 1; i >= 0; i--) { ffx_sceneNode_free(nodes[i]); }
+    testSequence(scene, 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    // A pool which fails to grow falls back onto the heap as well
+    scene = testScene();
+    atomic_store(&testHeap.failIn, 1);
+    FfxNode node = createBox(scene);
+    checkEqual(atomic_load(&testHeap.failIn), 0);
+    check(!ffx_sceneNode_hasFlags(node, NodeFlagPool));
+    ffx_sceneNode_free(node);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Concurrency
+
+#define THREADS          (4)
+#define THREAD_NODES     (100)
+#define THREAD_ROUNDS    (2000)
+#define THREAD_SIZE      (sizeof(Node) + 24)
+
+typedef struct Worker {
+    Scene *scene;
+    int index;
+} Worker;
+
+static _Atomic(int) workersDone;
+
+// Claims a burst of slots, tags each, checks nobody else wrote over the
+// tags, then frees them
+static void* work(void *arg) {
+    Worker *worker = arg;
+    Node *held[THREAD_NODES];
+
+    for (int round = 0; round < THREAD_ROUNDS; round++) {
+        int count = 1 + (round * 7 + worker->index) % THREAD_NODES;
+
+        for (int i = 0; i < count; i++) {
+            held[i] = ffx_scene_poolAlloc(worker->scene, THREAD_SIZE);
+            check(held[i] != NULL);
+            check(held[i]->flags & NodeFlagPool);
+            held[i]->position = ffx_point(worker->index, i);
+        }
+
+        for (int i = 0; i < count; i++) {
+            checkEqual(held[i]->position.x, worker->index);
+            checkEqual(held[i]->position.y, i);
+            ffx_scene_poolFree(worker->scene, held[i]);
+        }
+    }
+
+    atomic_fetch_add(&workersDone, 1);
+
+    return NULL;
+}
+
+static void testConcurrent(void) {
+    FfxScene scene = testScene();
+    testSequence(scene, 1);
+    uint32_t live = testLive();
+
+    atomic_store(&workersDone, 0);
+
+    pthread_t threads[THREADS];
+    Worker workers[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        workers[i] = (Worker){ .scene = scene, .index = i };
+        check(pthread_create(&threads[i], NULL, work, &workers[i]) == 0);
+    }
+
+    // Trim continuously while the workers grow and drain the pool
+    while (atomic_load(&workersDone) < THREADS) {
+        ffx_scene_poolTrim(scene);
+    }
+
+    for (int i = 0; i < THREADS; i++) {
+        check(pthread_join(threads[i], NULL) == 0);
+    }
+
+    ffx_scene_poolTrim(scene);
+    checkEqual(testLive(), live + 1);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_NODES      (1000)
+#define BENCH_ROUNDS     (200)
+
+static void benchmark(void) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+
+    // Create and free, once the pool has grown
+    for (int i = 0; i < BENCH_NODES; i++) { nodes[i] = createBox(scene); }
+    for (int i = 0; i < BENCH_NODES; i++) { ffx_sceneNode_free(nodes[i]); }
+
+    double start = testNow();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int i = 0; i < BENCH_NODES; i++) {
+            nodes[i] = createBox(scene);
+        }
+        for (int i = 0; i < BENCH_NODES; i++) {
+            ffx_sceneNode_free(nodes[i]);
+        }
+    }
+    double churn = 1000 * (testNow() - start) / (BENCH_ROUNDS * BENCH_NODES);
+
+    // Sequence a flat list of off-screen boxes
+    for (int i = 0; i < BENCH_NODES; i++) {
+        nodes[i] = createBox(scene);
+        ffx_sceneNode_setPosition(nodes[i], ffx_point(1000, 1000));
+        ffx_sceneGroup_appendChild(root, nodes[i]);
+    }
+    testSequence(scene, 1);
+
+    start = testNow();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        testSequence(scene, 1);
+    }
+    double walk = 1000 * (testNow() - start) / (BENCH_ROUNDS * BENCH_NODES);
+
+    // The heap held by the box pool, per box
+    uint32_t slabs = 0;
+    NodePool *pool = &((Scene*)scene)->nodePools[
+      NODE_SLOT_POOL(((Node*)nodes[0])->slot)];
+    for (int s = 0; s < MAX_POOL_SLABS; s++) {
+        if (atomic_load(&pool->slabs[s])) { slabs++; }
+    }
+    double perNode = (double)(slabs * POOL_SLAB_SLOTS * pool->size) /
+      BENCH_NODES;
+
+    printf("bench: node header %zu bytes, box %u bytes (%.1f with slack); "
+      "create+free %.1fns; sequence %.1fns/node\n", sizeof(Node),
+      (uint32_t)pool->size, perNode, churn, walk);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testHeader();
+    testTypes();
+    testReuse();
+    testTrim();
+    testFull();
+    testConcurrent();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,293 @@
+#include <pthread.h>
+
+#include "test.h"
+
+// Animation requests (see: ../../src/node.c and ../../src/scene.c)
+//
+// - producer threads animate, advance and stop their nodes while
+//   another thread sequences; every request is handled, each onComplete
+//   fires exactly once, in the order requested for its node
+// - a burst of requests between two sequences is never dropped
+// - requests pending when the scene is freed are released
+// - enqueue latency, alone and contended, and the round-trip throughput
+
+
+//////////////////////////
+// Requests
+
+#define PRODUCERS      (4)
+#define NODES          (4)
+
+// Each node is animated by one producer; completions run on the
+// sequencing thread
+typedef struct Track {
+    FfxNode node;
+    uint32_t requested;
+    _Atomic(uint32_t) completed;
+    uint32_t outOfOrder;
+    uint32_t stopped;
+} Track;
+
+static Track tracks[PRODUCERS * NODES];
+static _Atomic(uint32_t) totalCompleted;
+
+static void setFixed(FfxNode node, fixed_ffxt value) { }
+
+static void onComplete(FfxNode node, FfxSceneActionStop stopType,
+  void *arg) {
+    Track *track = NULL;
+    for (int i = 0; i < PRODUCERS * NODES; i++) {
+        if (tracks[i].node == node) { track = &tracks[i]; }
+    }
+    check(track != NULL);
+
+    // The arg is the request's index on its node
+    uint32_t index = (uintptr_t)arg;
+    if (index != atomic_load(&track->completed)) { track->outOfOrder++; }
+    if (stopType != FfxSceneActionStopNormal) { track->stopped++; }
+
+    atomic_fetch_add(&track->completed, 1);
+    atomic_fetch_add(&totalCompleted, 1);
+}
+
+static void setup(FfxNode node, FfxNodeAnimation *animation, void *arg) {
+    animation->duration = 40;
+    animation->onComplete = onComplete;
+    animation->arg = arg;
+    ffx_sceneNode_createFixedAction(node, 0, FM_1, setFixed);
+}
+
+static void request(Track *track) {
+    ffx_sceneNode_animate(track->node, setup,
+      (void*)(uintptr_t)track->requested++);
+}
+
+typedef struct Producer {
+    int index;
+    uint32_t count;
+} Producer;
+
+static void* produce(void *arg) {
+    Producer *producer = arg;
+    uint32_t seed = 17 + producer->index;
+
+    for (uint32_t i = 0; i < producer->count; i++) {
+        Track *track = &tracks[producer->index * NODES + (i % NODES)];
+
+        // Each stop and advance walks every running animation, so keep
+        // the backlog to a busy panel's rather than growing without end
+        while (track->requested - atomic_load(&track->completed) > 64) {
+            sched_yield();
+        }
+
+        request(track);
+
+        // Mix in advances and stops of both kinds
+        switch (testRandom(&seed) % 16) {
+            case 0:
+                ffx_sceneNode_advanceAnimations(track->node, 25);
+                break;
+            case 1:
+                ffx_sceneNode_stopAnimations(track->node, false);
+                break;
+            case 2:
+                ffx_sceneNode_stopAnimations(track->node, true);
+                break;
+        }
+    }
+
+    return NULL;
+}
+
+static FfxScene createScene(void) {
+    FfxScene scene = testScene();
+    memset(tracks, 0, sizeof(tracks));
+    atomic_store(&totalCompleted, 0);
+
+    for (int i = 0; i < PRODUCERS * NODES; i++) {
+        tracks[i].node = ffx_scene_createGroup(scene);
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), tracks[i].node);
+    }
+
+    return scene;
+}
+
+static void checkTracks(void) {
+    for (int i = 0; i < PRODUCERS * NODES; i++) {
+        checkEqual(atomic_load(&tracks[i].completed), tracks[i].requested);
+        checkEqual(tracks[i].outOfOrder, 0);
+    }
+}
+
+
+//////////////////////////
+// Stress
+
+#define STRESS_COUNT   (20000)
+
+static void testStress(void) {
+    FfxScene scene = createScene();
+
+    pthread_t threads[PRODUCERS];
+    Producer producers[PRODUCERS];
+    for (int i = 0; i < PRODUCERS; i++) {
+        producers[i] = (Producer){ .index = i, .count = STRESS_COUNT };
+        check(pthread_create(&threads[i], NULL, produce,
+          &producers[i]) == 0);
+    }
+
+    // Sequence until every request has completed; the animations are
+    // 40ms, so 10ms frames always leave some running
+    uint32_t total = PRODUCERS * STRESS_COUNT;
+    for (int frames = 0; atomic_load(&totalCompleted) < total; frames++) {
+        testSequence(scene, 10);
+        check(frames < 10000000);
+    }
+
+    for (int i = 0; i < PRODUCERS; i++) {
+        check(pthread_join(threads[i], NULL) == 0);
+    }
+
+    // Nothing completed twice, nor out of order
+    testSequence(scene, 100);
+    checkEqual(atomic_load(&totalCompleted), total);
+    checkTracks();
+
+    // Some were cut short by stops and advances
+    uint32_t stopped = 0;
+    for (int i = 0; i < PRODUCERS * NODES; i++) {
+        stopped += tracks[i].stopped;
+    }
+    check(stopped > 0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Bursts
+
+static void testBurst(void) {
+    FfxScene scene = createScene();
+
+    // Far past the old limit of 32, between two sequences
+    for (int i = 0; i < 1000; i++) { request(&tracks[i % 3]); }
+    ffx_sceneNode_stopAnimations(tracks[0].node, true);
+    for (int i = 0; i < 100; i++) {
+        ffx_sceneNode_advanceAnimations(tracks[1].node, 1);
+    }
+
+    // The stop and advances apply to those requested before them
+    testSequence(scene, 1);
+    checkEqual(atomic_load(&tracks[0].completed), tracks[0].requested);
+    checkEqual(tracks[0].stopped, tracks[0].requested);
+
+    testSequence(scene, 10);
+    checkEqual(atomic_load(&tracks[1].completed), tracks[1].requested);
+    checkEqual(atomic_load(&tracks[2].completed), 0);
+
+    testSequence(scene, 100);
+    testSequence(scene, 1);
+    checkEqual(atomic_load(&totalCompleted), 1000);
+    checkTracks();
+
+    // Pending at free; released without completing
+    for (int i = 0; i < 100; i++) { request(&tracks[3]); }
+    ffx_sceneNode_stopAnimations(tracks[3].node, false);
+    ffx_scene_free(scene);
+    checkEqual(atomic_load(&totalCompleted), 1000);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_REQUESTS     (200000)
+#define BENCH_PER_FRAME    (30)
+
+static FfxNode benchNode;
+static _Atomic(bool) benchGo;
+
+static void* enqueueStops(void *arg) {
+    while (!atomic_load(&benchGo)) { }
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_REQUESTS; i++) {
+        ffx_sceneNode_stopAnimations(benchNode, false);
+    }
+    *(double*)arg = 1000 * (testNow() - start) / BENCH_REQUESTS;
+
+    return NULL;
+}
+
+// The ns to enqueue a stop, with %%threads%% enqueueing at once
+static double benchmarkEnqueue(int threads) {
+    FfxScene scene = testScene();
+    benchNode = ffx_scene_createGroup(scene);
+    atomic_store(&benchGo, false);
+
+    pthread_t ids[PRODUCERS];
+    double latency[PRODUCERS];
+    for (int i = 0; i < threads; i++) {
+        check(pthread_create(&ids[i], NULL, enqueueStops, &latency[i]) == 0);
+    }
+    atomic_store(&benchGo, true);
+
+    double worst = 0;
+    for (int i = 0; i < threads; i++) {
+        check(pthread_join(ids[i], NULL) == 0);
+        if (latency[i] > worst) { worst = latency[i]; }
+    }
+
+    // Drains every request
+    testSequence(scene, 1);
+
+    ffx_sceneNode_free(benchNode);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return worst;
+}
+
+// The ns per request to enqueue and drain, at a panel-like rate of
+// requests per sequence
+static double benchmarkRoundTrip(void) {
+    FfxScene scene = testScene();
+    FfxNode node = ffx_scene_createGroup(scene);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_REQUESTS / BENCH_PER_FRAME; i++) {
+        for (int j = 0; j < BENCH_PER_FRAME; j++) {
+            ffx_sceneNode_stopAnimations(node, false);
+        }
+        testSequence(scene, 1);
+    }
+    double duration = testNow() - start;
+
+    ffx_sceneNode_free(node);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    int requests = (BENCH_REQUESTS / BENCH_PER_FRAME) * BENCH_PER_FRAME;
+    return 1000 * duration / requests;
+}
+
+static void benchmark(void) {
+    double alone = benchmarkEnqueue(1);
+    double contended = benchmarkEnqueue(PRODUCERS);
+    double roundTrip = benchmarkRoundTrip();
+
+    printf("bench: enqueue %.1fns alone, %.1fns with %d threads; round "
+      "trip %.1fns/request at %d/sequence\n", alone, contended, PRODUCERS,
+      roundTrip, BENCH_PER_FRAME);
+}
+
+
+int main(void) {
+    testBurst();
+    testStress();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,59 @@
+#!/bin/sh
+
+# Builds and runs the host tests against the firefly-scene sources.
+#
+# Usage (from any folder):
+#   ./run.sh [ TEST ... ]
+#
+# Each TEST is a file in this folder, without the .c (e.g. batch); by
+# default every test is run. Tests are built with ASan, LSan and UBSan
+# and stop at the first failed check, which fails the run.
+#
+# Tests which include a benchmark print their timings. Set BENCH=1 to
+# build at -O2 without the sanitizers when comparing timings.
+
+cd "$(dirname "$0")" || exit 1
+
+BUILD=build
+INCLUDES="-I ../replay/shim -I ../../include -I ../../src"
+
+if [ -n "$BENCH" ]; then
+    FLAGS="-O2"
+else
+    FLAGS="-O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all"
+fi
+
+CFLAGS="-std=gnu17 -D_GNU_SOURCE $FLAGS $INCLUDES"
+
+if [ $# -eq 0 ]; then
+    set -- $(ls *.c | sed 's/\.c$//')
+fi
+
+mkdir -p "$BUILD/obj"
+
+# The scene sources are built once and shared by every test
+for source in ../../src/*.c ../replay/shim/shim.c; do
+    object="$BUILD/obj/$(basename "$source" .c).o"
+    gcc $CFLAGS -c -o "$object" "$source" || exit 1
+done
+
+failed=""
+for test in "$@"; do
+    echo "== $test"
+    if ! gcc $CFLAGS -Wall -o "$BUILD/$test" "$test.c" "$BUILD"/obj/*.o \
+      -lm -lpthread; then
+        failed="$failed $test"
+        continue
+    fi
+
+    if ! "./$BUILD/$test"; then
+        failed="$failed $test"
+    fi
+done
+
+if [ -n "$failed" ]; then
+    echo "FAILED:$failed"
+    exit 1
+fi
+
+echo "PASSED"
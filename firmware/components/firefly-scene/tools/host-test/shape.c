@@ -0,0 +1,249 @@
+#include <math.h>
+
+#include "test.h"
+
+// Shapes (see: ../../src/node-shape.c)
+//
+// - each pixel's coverage is close to the analytic coverage of circles,
+//   rounded rectangles, lines and arcs, with the interior exact
+// - strokes are drawn inside the edge, with the fill inside the stroke
+// - every fragment geometry draws the same pixels
+// - how many shapes fit in a frame at 60 fps
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t other[WIDTH * HEIGHT];
+
+
+//////////////////////////
+// Reference
+
+// The coverage in [0, 1] of the pixel whose center is %%distance%% from
+// an edge (negative inside), approximating the pixel as a box across it
+static double coverage(double distance) {
+    double c = 0.5 - distance;
+    return (c < 0) ? 0: (c > 1) ? 1: c;
+}
+
+// Coverage is in 1/16 pixel steps and distances are in 1/16 pixels, so
+// a pixel may be a few sixteenths off
+#define TOLERANCE     (3.0 / 16)
+
+// The green channel of white drawn over black, in [0, 1]
+static double drawn(int x, int y) {
+    return ((frame[y * WIDTH + x] >> 5) & 0x3f) / 63.0;
+}
+
+// Every pixel is within tolerance of the coverage for its signed
+// %%distance%% from the edge, and the summed coverage is within 1% of
+// %%area%%
+static void checkCoverage(double (*distance)(int x, int y), double area) {
+    double total = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            double e = distance(x, y);
+            double d = drawn(x, y);
+            check(fabs(d - coverage(e)) <= TOLERANCE);
+
+            // Pixels a pixel or more from the edge are exact
+            if (e <= -1) { check(d == 1); }
+            if (e >= 1) { check(d == 0); }
+
+            total += d;
+        }
+    }
+
+    check(fabs(total - area) <= area * 0.01);
+}
+
+static FfxNode addShape(FfxScene scene, FfxShapeType type, int x, int y,
+  int width, int height) {
+
+    FfxNode node = ffx_scene_createShape(scene, type, ffx_size(width, height));
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, ffx_point(x, y));
+    ffx_sceneShape_setFillColor(node, COLOR_WHITE);
+    ffx_sceneShape_setStrokeColor(node, COLOR_WHITE);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    return node;
+}
+
+static void renderScene(FfxScene scene) {
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    // Drawn alike in fragments of any geometry
+    const FfxSize geometries[] = { { 240, 240 }, { 37, 13 }, { 1, 240 } };
+    for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]); g++) {
+        testRenderAt(scene, other, geometries[g]);
+        check(memcmp(frame, other, sizeof(frame)) == 0);
+    }
+}
+
+
+//////////////////////////
+// Shapes
+
+// A circle of radius 50.5 centered at (120.5, 100.5)
+static double circle(int x, int y) {
+    double dx = x - 120, dy = y - 100;
+    return sqrt(dx * dx + dy * dy) - 50.5;
+}
+
+static void testCircle(void) {
+    FfxScene scene = testScene();
+    addShape(scene, FfxShapeTypeCircle, 70, 50, 101, 101);
+    renderScene(scene);
+    checkCoverage(circle, M_PI * 50.5 * 50.5);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+// A 160x100 rectangle at (40, 70) with corners of radius 24
+static double roundRect(int x, int y) {
+    double cx = x + 0.5 - 120, cy = y + 0.5 - 120;
+    double qx = fabs(cx) - (80 - 24), qy = fabs(cy) - (50 - 24);
+    double distance;
+    if (qx > 0 && qy > 0) {
+        distance = sqrt(qx * qx + qy * qy) - 24;
+    } else {
+        distance = ((qx > qy) ? qx: qy) - 24;
+    }
+    return distance;
+}
+
+static void testRoundRect(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addShape(scene, FfxShapeTypeRoundRect, 40, 70, 160, 100);
+    ffx_sceneShape_setCornerRadius(node, 24);
+    checkEqual(ffx_sceneShape_getCornerRadius(node), 24);
+    renderScene(scene);
+    checkCoverage(roundRect, 160 * 100 - (4 - M_PI) * 24 * 24);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+// A line from (30, 40) to (210, 130), 9 pixels wide with round caps
+static double line(int x, int y) {
+    double px = x + 0.5 - 30, py = y + 0.5 - 40;
+    double dx = 180, dy = 90, length2 = dx * dx + dy * dy;
+
+    double t = (px * dx + py * dy) / length2;
+    if (t < 0) { t = 0; }
+    if (t > 1) { t = 1; }
+
+    double ex = px - t * dx, ey = py - t * dy;
+    return sqrt(ex * ex + ey * ey) - 4.5;
+}
+
+static void testLine(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addShape(scene, FfxShapeTypeLine, 30, 40, 0, 0);
+    ffx_sceneShape_setEnd(node, ffx_point(180, 90));
+    ffx_sceneShape_setStrokeWidth(node, 9);
+    renderScene(scene);
+    checkCoverage(line, sqrt(180 * 180 + 90 * 90) * 9 + M_PI * 4.5 * 4.5);
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Strokes
+
+static void testStroke(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addShape(scene, FfxShapeTypeCircle, 70, 50, 101, 101);
+    ffx_sceneShape_setFillColor(node, COLOR_RED);
+    ffx_sceneShape_setStrokeColor(node, COLOR_GREEN);
+    ffx_sceneShape_setStrokeWidth(node, 6);
+    renderScene(scene);
+
+    // Along the horizontal through the center: outside, the stroke just
+    // inside the edge, then the fill
+    checkEqual(frame[100 * WIDTH + 60], 0);
+    checkEqual(frame[100 * WIDTH + 72], 0x07e0);
+    checkEqual(frame[100 * WIDTH + 75], 0x07e0);
+    checkEqual(frame[100 * WIDTH + 80], 0xf800);
+    checkEqual(frame[100 * WIDTH + 120], 0xf800);
+    checkEqual(frame[100 * WIDTH + 168], 0x07e0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testArc(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addShape(scene, FfxShapeTypeArc, 70, 50, 101, 101);
+    ffx_sceneShape_setStrokeWidth(node, 10);
+    ffx_sceneShape_setEndAngle(node, FM_PI_2);
+    renderScene(scene);
+
+    // A quarter, clockwise from the top; only the top-right is drawn
+    double total = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            if (frame[y * WIDTH + x] == 0) { continue; }
+            check(x >= 119 && y <= 101);
+            total += drawn(x, y);
+        }
+    }
+
+    // Midway along the quarter, the stroke is entirely covered
+    double r = 50 - 5;
+    int mx = 120 + lround(r * M_SQRT1_2), my = 100 - lround(r * M_SQRT1_2);
+    checkEqual(frame[my * WIDTH + mx], 0xffff);
+
+    // The area of a quarter ring, outer radius 50.5 and inner 40.5
+    double area = M_PI * (50.5 * 50.5 - 40.5 * 40.5) / 4;
+    check(fabs(total - area) <= area * 0.01);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_SHAPES   (64)
+#define BENCH_FRAMES   (50)
+
+static void benchmark(void) {
+    FfxScene scene = testScene();
+
+    // A mix of small stroked shapes, like a gauge-heavy screen
+    uint32_t seed = 34;
+    for (int i = 0; i < BENCH_SHAPES; i++) {
+        FfxShapeType type = i % 4;
+        int x = testRandom(&seed) % 200, y = testRandom(&seed) % 200;
+        FfxNode node = addShape(scene, type, x, y, 40, 40);
+        ffx_sceneShape_setFillColor(node, ffx_color_rgba(200, 80, 40, 24));
+        ffx_sceneShape_setStrokeWidth(node, 3);
+        ffx_sceneShape_setCornerRadius(node, 8);
+        ffx_sceneShape_setEndAngle(node, FM_PI);
+    }
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        testSequence(scene, 1);
+        testRender(scene, frame);
+    }
+    double duration = (testNow() - start) / BENCH_FRAMES;
+
+    printf("bench: %d shapes %.1fus/frame; %.0f shapes per 60fps frame\n",
+      BENCH_SHAPES, duration, BENCH_SHAPES * (1e6 / 60) / duration);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testCircle();
+    testRoundRect();
+    testLine();
+    testStroke();
+    testArc();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "test.h"
+
+// Sprites (see: ../../src/node-sprite.c)
+//
+// - unscaled and unrotated, a sprite draws its image pixel for pixel,
+//   for RGB565 and 8-bit palette images
+// - scaling by 2 and rotating by a quarter turn move each image pixel
+//   to where the transform puts it
+// - bilinear sampling of a flat image is flat
+// - sprites outside the panel are culled, edges are clipped
+// - the throughput of each sampling mode at an arbitrary transform
+
+#define SIZE      (32)
+
+
+//////////////////////////
+// Reference
+
+// The color of the image pixel (x, y); palette indices are read from
+// their word, the first in the high byte
+static uint16_t imagePixel(const uint16_t *data, int x, int y) {
+    size_t i = y * data[1] + x;
+    if (data[0] == 0x38) {
+        const uint16_t *pixels = &data[3 + 256];
+        return data[3 + ((pixels[i / 2] >> ((i & 1) ? 0: 8)) & 0xff)];
+    }
+    return data[3 + i];
+}
+
+static uint16_t frame[WIDTH * HEIGHT];
+
+static FfxNode addSprite(FfxScene scene, const uint16_t *data,
+  size_t length, int x, int y) {
+
+    FfxNode sprite = ffx_scene_createSprite(scene, data, length);
+    check(sprite != NULL);
+    ffx_sceneNode_setPosition(sprite, ffx_point(x, y));
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), sprite);
+    return sprite;
+}
+
+
+//////////////////////////
+// Transforms
+
+static void testIdentity(uint16_t format) {
+    size_t length;
+    uint16_t *data = testImage(format, SIZE, SIZE, 30, &length);
+
+    FfxScene scene = testScene();
+    addSprite(scene, data, length, 100, 80);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    int left = 100 - SIZE / 2, top = 80 - SIZE / 2;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            int ix = x - left, iy = y - top;
+            if (ix < 0 || iy < 0 || ix >= SIZE || iy >= SIZE) {
+                checkEqual(frame[y * WIDTH + x], 0);
+            } else {
+                checkEqual(frame[y * WIDTH + x], imagePixel(data, ix, iy));
+            }
+        }
+    }
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+static void testScaled(void) {
+    size_t length;
+    uint16_t *data = testImage(0x04, SIZE, SIZE, 31, &length);
+
+    FfxScene scene = testScene();
+    FfxNode sprite = addSprite(scene, data, length, 120, 120);
+    ffx_sceneSprite_setScale(sprite, 2 * FM_1);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    int left = 120 - SIZE, top = 120 - SIZE;
+    for (int y = 0; y < 2 * SIZE; y++) {
+        for (int x = 0; x < 2 * SIZE; x++) {
+            checkEqual(frame[(top + y) * WIDTH + left + x],
+              imagePixel(data, x / 2, y / 2));
+        }
+    }
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+static void testRotated(void) {
+    size_t length;
+    uint16_t *data = testImage(0x04, SIZE, SIZE, 32, &length);
+
+    FfxScene scene = testScene();
+    FfxNode sprite = addSprite(scene, data, length, 120, 120);
+    ffx_sceneSprite_setAngle(sprite, FM_PI_2);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    // A quarter turn clockwise; the left column becomes the top row
+    int left = 120 - SIZE / 2, top = 120 - SIZE / 2;
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            checkEqual(frame[(top + y) * WIDTH + left + x],
+              imagePixel(data, y, SIZE - 1 - x));
+        }
+    }
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+static void testBilinear(void) {
+    size_t length;
+    uint16_t *data = testImage(0x04, SIZE, SIZE, 33, &length);
+    for (int i = 3; i < length / 2; i++) { data[i] = 0x5aeb; }
+
+    FfxScene scene = testScene();
+    FfxNode sprite = addSprite(scene, data, length, 120, 120);
+    ffx_sceneSprite_setSampling(sprite, FfxSpriteSamplingBilinear);
+    ffx_sceneSprite_setScale(sprite, 3 * FM_1 + FM_1_16);
+    ffx_sceneSprite_setAngle(sprite, FM_PI / 5);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+
+    int drawn = 0;
+    for (int i = 0; i < WIDTH * HEIGHT; i++) {
+        if (frame[i] == 0) { continue; }
+        checkEqual(frame[i], 0x5aeb);
+        drawn++;
+    }
+    check(drawn > SIZE * SIZE * 8);
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Culling
+
+static void testCulling(void) {
+    size_t length;
+    uint16_t *data = testImage(0x04, SIZE, SIZE, 34, &length);
+
+    // Just beyond each edge of the panel; nothing is drawn
+    FfxScene scene = testScene();
+    int half = SIZE / 2 + 1;
+    addSprite(scene, data, length, -half, 120);
+    addSprite(scene, data, length, WIDTH + half, 120);
+    addSprite(scene, data, length, 120, -half);
+    addSprite(scene, data, length, 120, HEIGHT + half);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    for (int i = 0; i < WIDTH * HEIGHT; i++) { checkEqual(frame[i], 0); }
+    ffx_scene_free(scene);
+
+    // Straddling the bottom-right corner; the visible quarter is drawn
+    scene = testScene();
+    addSprite(scene, data, length, WIDTH, HEIGHT);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    for (int y = 0; y < SIZE / 2; y++) {
+        for (int x = 0; x < SIZE / 2; x++) {
+            int fx = WIDTH - SIZE / 2 + x, fy = HEIGHT - SIZE / 2 + y;
+            checkEqual(frame[fy * WIDTH + fx], imagePixel(data, x, y));
+        }
+    }
+    ffx_scene_free(scene);
+
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAMES   (200)
+
+static void benchmarkSampling(uint16_t format, FfxSpriteSampling sampling,
+  const char *name) {
+
+    size_t length;
+    uint16_t *data = testImage(format, 64, 64, 35, &length);
+
+    FfxScene scene = testScene();
+    FfxNode sprite = addSprite(scene, data, length, 120, 120);
+    ffx_sceneSprite_setSampling(sprite, sampling);
+    ffx_sceneSprite_setScale(sprite, 3 * FM_1);
+    ffx_sceneSprite_setAngle(sprite, FM_PI / 7);
+    testSequence(scene, 1);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) { testRender(scene, frame); }
+    double duration = testNow() - start;
+
+    // The panel is covered by the bounding box, so every pixel is visited
+    printf("bench: %s %.1f Mpixel/s\n", name,
+      (double)WIDTH * HEIGHT * BENCH_FRAMES / duration);
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testIdentity(0x04);
+    testIdentity(0x38);
+    testScaled();
+    testRotated();
+    testBilinear();
+    testCulling();
+
+    benchmarkSampling(0x04, FfxSpriteSamplingNearest, "rgb565 nearest");
+    benchmarkSampling(0x04, FfxSpriteSamplingBilinear, "rgb565 bilinear");
+    benchmarkSampling(0x38, FfxSpriteSamplingNearest, "pal8 nearest");
+    return 0;
+}
@@ -0,0 +1,236 @@
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+// Helpers shared by the host tests. Each test is a single file, built
+// with every scene source and the replay shim (see: run.sh).
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "firefly-scene.h"
+#include "firefly-scene-private.h"
+
+
+#define WIDTH            (240)
+#define HEIGHT           (240)
+#define FRAGMENT_HEIGHT  (24)
+
+// The scene clock, in ticks (see: ../replay/shim/shim.c)
+extern uint32_t replayTick;
+
+
+//////////////////////////
+// Checks
+
+#define check(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        exit(1); \
+    } \
+} while (0)
+
+#define checkEqual(a, b) do { \
+    long long _a = (long long)(a), _b = (long long)(b); \
+    if (_a != _b) { \
+        printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", \
+          __FILE__, __LINE__, #a, #b, _a, _b); \
+        exit(1); \
+    } \
+} while (0)
+
+
+//////////////////////////
+// Heap
+
+// Counts every scene allocation, so tests can check for leaks and
+// allocation counts; setting failIn to N fails the Nth allocation after
+typedef struct TestHeap {
+    _Atomic(uint32_t) allocs;
+    _Atomic(uint32_t) frees;
+    _Atomic(int32_t) failIn;
+} TestHeap;
+
+static TestHeap testHeap;
+
+static inline uint8_t* testAlloc(size_t size, void *arg) {
+    if (atomic_load(&testHeap.failIn) > 0 &&
+      atomic_fetch_sub(&testHeap.failIn, 1) == 1) {
+        return NULL;
+    }
+    atomic_fetch_add(&testHeap.allocs, 1);
+    return malloc(size);
+}
+
+static inline void testFree(uint8_t *ptr, void *arg) {
+    if (ptr) { atomic_fetch_add(&testHeap.frees, 1); }
+    free(ptr);
+}
+
+static inline uint32_t testLive(void) {
+    return atomic_load(&testHeap.allocs) - atomic_load(&testHeap.frees);
+}
+
+static inline FfxScene testScene(void) {
+    FfxScene scene = ffx_scene_init(testAlloc, testFree, NULL, NULL, NULL);
+    check(scene != NULL);
+    return scene;
+}
+
+
+//////////////////////////
+// Frames
+
+// Advance the scene clock by %%ticks%% and sequence
+static inline void testSequence(FfxScene scene, uint32_t ticks) {
+    replayTick += ticks;
+    ffx_scene_sequence(scene);
+}
+
+// Render the whole screen into %%frame%% (WIDTH x HEIGHT), as fragments
+// of %%size%%, which need not divide the screen evenly
+static inline void testRenderAt(FfxScene scene, uint16_t *frame, FfxSize size) {
+    uint16_t *fragment = malloc(size.width * size.height * 2);
+    check(fragment != NULL);
+
+    for (int y = 0; y < HEIGHT; y += size.height) {
+        for (int x = 0; x < WIDTH; x += size.width) {
+            memset(fragment, 0, size.width * size.height * 2);
+            ffx_scene_render(scene, fragment, ffx_point(x, y), size);
+
+            for (int row = 0; row < size.height; row++) {
+                if (y + row >= HEIGHT) { break; }
+
+                int width = size.width;
+                if (x + width > WIDTH) { width = WIDTH - x; }
+                memcpy(&frame[(y + row) * WIDTH + x],
+                  &fragment[row * size.width], width * 2);
+            }
+        }
+    }
+
+    free(fragment);
+}
+
+static inline void testRender(FfxScene scene, uint16_t *frame) {
+    memset(frame, 0, WIDTH * HEIGHT * 2);
+    for (int y = 0; y < HEIGHT; y += FRAGMENT_HEIGHT) {
+        ffx_scene_render(scene, &frame[y * WIDTH], ffx_point(0, y),
+          ffx_size(WIDTH, FRAGMENT_HEIGHT));
+    }
+}
+
+static inline uint32_t testHash(const uint16_t *pixels, size_t count) {
+    uint32_t hash = 0x811c9dc5;
+    for (size_t i = 0; i < count; i++) {
+        hash = (hash ^ (pixels[i] & 0xff)) * 0x01000193;
+        hash = (hash ^ (pixels[i] >> 8)) * 0x01000193;
+    }
+    return hash;
+}
+
+
+//////////////////////////
+// Assets
+
+// A deterministic pseudo-random stream
+static inline uint32_t testRandom(uint32_t *seed) {
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+// An image of noise; %%format%% is 0x04 (RGB565) or 0x38 (8-bit palette)
+static inline uint16_t* testImage(uint16_t format, size_t width,
+  size_t height, uint32_t seed, size_t *length) {
+
+    size_t pixels = width * height;
+    size_t count = 3 + ((format == 0x38) ? 256 + (pixels + 1) / 2: pixels);
+
+    uint16_t *data = malloc(count * 2);
+    check(data != NULL);
+    for (int i = 3; i < count; i++) { data[i] = testRandom(&seed); }
+
+    data[0] = format;
+    data[1] = width;
+    data[2] = height;
+
+    *length = count * 2;
+    return data;
+}
+
+// A flipbook of %%frameCount%% keyframes of noise (see: node-flipbook.c)
+static inline uint16_t* testFlipbook(size_t width, size_t height,
+  size_t frameCount, uint32_t seed, size_t *length) {
+
+    size_t frameWords = (width * height + 1) / 2;
+    size_t count = 4 + 256 + 8 * frameCount + frameCount * frameWords;
+
+    uint16_t *data = malloc(count * 2);
+    check(data != NULL);
+    for (int i = 4; i < count; i++) { data[i] = testRandom(&seed); }
+
+    data[0] = 0x0146;
+    data[1] = width;
+    data[2] = height;
+    data[3] = frameCount;
+
+    for (int i = 0; i < frameCount; i++) {
+        uint16_t *frame = &data[4 + 256 + 8 * i];
+        uint32_t offset = i * frameWords * 2;
+        frame[0] = 100;
+        frame[1] = 1;
+        frame[2] = frame[3] = 0;
+        frame[4] = width;
+        frame[5] = height;
+        frame[6] = offset >> 16;
+        frame[7] = offset & 0xffff;
+    }
+
+    *length = count * 2;
+    return data;
+}
+
+// A tile map of noise tiles, placed at random (see: node-tilemap.c)
+static inline uint16_t* testTileMap(uint16_t tileFormat, size_t tileSize,
+  size_t tileCount, size_t columns, size_t rows, uint32_t seed,
+  size_t *length) {
+
+    bool palette = (tileFormat == 0x38);
+    size_t tileWords = tileSize * tileSize / (palette ? 2: 1);
+    size_t mapOffset = 6 + (palette ? 256: 0) + tileCount * tileWords;
+    size_t count = mapOffset + columns * rows;
+
+    uint16_t *data = malloc(count * 2);
+    check(data != NULL);
+    for (int i = 6; i < mapOffset; i++) { data[i] = testRandom(&seed); }
+    for (int i = mapOffset; i < count; i++) {
+        data[i] = testRandom(&seed) % tileCount;
+    }
+
+    data[0] = 0x014d;
+    data[1] = tileFormat;
+    data[2] = tileSize;
+    data[3] = tileCount;
+    data[4] = columns;
+    data[5] = rows;
+
+    *length = count * 2;
+    return data;
+}
+
+
+//////////////////////////
+// Timing
+
+// Microseconds
+static inline double testNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3;
+}
+
+#endif /* __HOST_TEST_H__ */
@@ -0,0 +1,237 @@
+#include "test.h"
+
+// Tile maps (see: ../../src/node-tilemap.c)
+//
+// - every tile format and size draws the map as the reference does, at
+//   any scroll, with and without wrapping, for any fragment geometry
+// - malformed data is rejected
+// - the size and render cost of a tiled background against a full
+//   background image
+
+static uint16_t frame[WIDTH * HEIGHT];
+
+
+//////////////////////////
+// Reference
+
+// The pixel of map coordinate (mx, my), or 0 outside an unwrapped map
+static uint16_t mapPixel(const uint16_t *data, int32_t mx, int32_t my,
+  bool wrap) {
+
+    bool palette = (data[1] == 0x38);
+    int32_t tileSize = data[2], columns = data[4], rows = data[5];
+    int32_t width = tileSize * columns, height = tileSize * rows;
+
+    if (wrap) {
+        mx = ((mx % width) + width) % width;
+        my = ((my % height) + height) % height;
+    } else if (mx < 0 || my < 0 || mx >= width || my >= height) {
+        return 0;
+    }
+
+    size_t tileWords = tileSize * tileSize / (palette ? 2: 1);
+    const uint16_t *tiles = &data[6 + (palette ? 256: 0)];
+    const uint16_t *map = &tiles[data[3] * tileWords];
+
+    const uint16_t *tile = &tiles[map[(my / tileSize) * columns +
+      mx / tileSize] * tileWords];
+    size_t p = (my % tileSize) * tileSize + (mx % tileSize);
+
+    if (!palette) { return tile[p]; }
+    return data[6 + ((tile[p / 2] >> ((p & 1) ? 0: 8)) & 0xff)];
+}
+
+static void checkFrame(const uint16_t *data, FfxPoint pos, FfxSize size,
+  FfxPoint scroll, bool wrap) {
+
+    for (int32_t y = 0; y < HEIGHT; y++) {
+        for (int32_t x = 0; x < WIDTH; x++) {
+            uint16_t expected = 0;
+            if (x >= pos.x && y >= pos.y && x < pos.x + size.width &&
+              y < pos.y + size.height) {
+                expected = mapPixel(data, x - pos.x + scroll.x,
+                  y - pos.y + scroll.y, wrap);
+            }
+            checkEqual(frame[y * WIDTH + x], expected);
+        }
+    }
+}
+
+
+//////////////////////////
+// Rendering
+
+static const FfxSize geometries[] = {
+    { 240, 24 }, { 240, 240 }, { 37, 13 }, { 1, 240 }, { 120, 7 }
+};
+
+static void testRendering(uint16_t format, size_t tileSize) {
+    size_t length;
+    uint16_t *data = testTileMap(format, tileSize, 12, 9, 7, 32, &length);
+
+    const FfxPoint scrolls[] = {
+        { 0, 0 }, { 3, 5 }, { -20, -9 }, { 1000, -1000 },
+        { tileSize * 9 - 1, tileSize * 7 - 1 }
+    };
+
+    for (int wrap = 0; wrap < 2; wrap++) {
+        for (int s = 0; s < sizeof(scrolls) / sizeof(scrolls[0]); s++) {
+            FfxScene scene = testScene();
+            FfxNode node = ffx_scene_createTileMap(scene, data, length);
+            check(node != NULL);
+
+            // Larger than the map, and off the left edge
+            FfxPoint pos = ffx_point(-7, 11);
+            FfxSize size = ffx_size(200, 180);
+            ffx_sceneNode_setPosition(node, pos);
+            ffx_sceneTileMap_setSize(node, size);
+            ffx_sceneTileMap_setScroll(node, scrolls[s]);
+            ffx_sceneTileMap_setWrap(node, wrap);
+            ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+            testSequence(scene, 1);
+
+            checkEqual(ffx_sceneTileMap_getScroll(node).x, scrolls[s].x);
+            checkEqual(ffx_sceneTileMap_getWrap(node), wrap);
+
+            for (int g = 0; g < sizeof(geometries) / sizeof(geometries[0]);
+              g++) {
+                testRenderAt(scene, frame, geometries[g]);
+                checkFrame(data, pos, size, scrolls[s], wrap);
+            }
+
+            ffx_scene_free(scene);
+        }
+    }
+
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+static void testDefaultSize(void) {
+    size_t length;
+    uint16_t *data = testTileMap(0x04, 16, 4, 20, 3, 33, &length);
+
+    FfxScene scene = testScene();
+    FfxNode node = ffx_scene_createTileMap(scene, data, length);
+    check(node != NULL);
+    checkEqual(ffx_sceneTileMap_getSize(node).width, 16 * 20);
+    checkEqual(ffx_sceneTileMap_getSize(node).height, 16 * 3);
+
+    // The map is wider than the panel, so drawn in more than one band
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    checkFrame(data, ffx_point(0, 0), ffx_size(16 * 20, 16 * 3),
+      ffx_point(0, 0), false);
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Validation
+
+static void testInvalid(void) {
+    size_t length;
+    uint16_t *data = testTileMap(0x38, 8, 5, 4, 4, 34, &length);
+
+    FfxScene scene = testScene();
+
+    for (size_t l = 0; l < length; l++) {
+        check(ffx_scene_createTileMap(scene, data, l) == NULL);
+    }
+
+    // A map entry past the last tile
+    size_t last = length / 2 - 1;
+    data[last] = 5;
+    check(ffx_scene_createTileMap(scene, data, length) == NULL);
+    data[last] = 4;
+
+    const struct { int index; uint16_t value; } bad[] = {
+        { 0, 0x014e }, { 1, 0x05 }, { 2, 12 }, { 3, 0 }, { 4, 0 }, { 5, 0 }
+    };
+    for (int i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        uint16_t value = data[bad[i].index];
+        data[bad[i].index] = bad[i].value;
+        check(ffx_scene_createTileMap(scene, data, length) == NULL);
+        data[bad[i].index] = value;
+    }
+
+    FfxNode node = ffx_scene_createTileMap(scene, data, length);
+    check(node != NULL);
+    ffx_sceneNode_free(node);
+
+    ffx_scene_free(scene);
+    free(data);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAMES   (500)
+
+static double benchmarkNode(FfxScene scene, FfxNode node, bool scroll) {
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        if (scroll) { ffx_sceneTileMap_setScroll(node, ffx_point(i, i / 2)); }
+        testSequence(scene, 1);
+        testRender(scene, frame);
+    }
+    return (testNow() - start) / BENCH_FRAMES;
+}
+
+static void benchmark(void) {
+    // A 240x240 background from 64 unique 16x16 tiles
+    size_t imageLength, rgbLength, palLength;
+    uint16_t *image = testImage(0x04, WIDTH, HEIGHT, 35, &imageLength);
+    uint16_t *rgb = testTileMap(0x04, 16, 64, 15, 15, 35, &rgbLength);
+    uint16_t *pal = testTileMap(0x38, 16, 64, 15, 15, 35, &palLength);
+
+    FfxScene scene = testScene();
+    double imageCost = benchmarkNode(scene,
+      ffx_scene_createImage(scene, image, imageLength), false);
+    ffx_scene_free(scene);
+
+    scene = testScene();
+    FfxNode node = ffx_scene_createTileMap(scene, rgb, rgbLength);
+    ffx_sceneTileMap_setWrap(node, true);
+    double rgbCost = benchmarkNode(scene, node, true);
+    ffx_scene_free(scene);
+
+    scene = testScene();
+    node = ffx_scene_createTileMap(scene, pal, palLength);
+    ffx_sceneTileMap_setWrap(node, true);
+    double palCost = benchmarkNode(scene, node, true);
+    ffx_scene_free(scene);
+
+    check(rgbLength * 3 < imageLength);
+    check(palLength * 6 < imageLength);
+
+    printf("bench: 240x240 background; image %zu bytes %.1fus/frame, "
+      "rgb565 tiles %zu bytes %.1fus/frame, palette tiles %zu bytes "
+      "%.1fus/frame (scrolling)\n", imageLength, imageCost,
+      rgbLength, rgbCost, palLength, palCost);
+
+    free(image);
+    free(rgb);
+    free(pal);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    testRendering(0x04, 8);
+    testRendering(0x04, 16);
+    testRendering(0x38, 8);
+    testRendering(0x38, 16);
+    testDefaultSize();
+    testInvalid();
+    benchmark();
+    return 0;
+}
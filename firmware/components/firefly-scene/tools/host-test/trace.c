@@ -0,0 +1,354 @@
+#include "test.h"
+
+// Traces (see: ../../src/trace.c)
+//
+// - every node type and group layer is recorded, and a replayed frame
+//   renders the same as the original
+// - data refs are recorded at full pointer width
+// - nodes whose content is not recorded (QR, particles, chart) replay
+//   with the same size and cost
+// - a truncated or full trace never replays past its end
+// - the cost of tracing a sequence
+
+
+#define TRACE_SIZE     (64 * 1024)
+
+static uint8_t traceData[TRACE_SIZE];
+
+typedef struct Asset {
+    uint16_t *data;
+    size_t length;
+} Asset;
+
+static Asset assets[4];
+
+// Returns the original data, which only resolves if the ref was kept
+// at full width
+static const uint16_t* getData(uint64_t ref, const uint16_t *header,
+  size_t headerLength, size_t *length, void *arg) {
+
+    for (int i = 0; i < sizeof(assets) / sizeof(assets[0]); i++) {
+        if ((uintptr_t)assets[i].data != ref) { continue; }
+        for (int j = 0; j < headerLength; j++) {
+            checkEqual(header[j], assets[i].data[j]);
+        }
+        *length = assets[i].length;
+        return assets[i].data;
+    }
+
+    printf("unknown ref: 0x%llx\n", (unsigned long long)ref);
+    exit(1);
+}
+
+static void createAssets(void) {
+    assets[0].data = testImage(0x04, 16, 16, 1, &assets[0].length);
+    assets[1].data = testImage(0x38, 24, 20, 2, &assets[1].length);
+    assets[2].data = testFlipbook(32, 24, 4, 3, &assets[2].length);
+    assets[3].data = testTileMap(0x04, 8, 6, 8, 8, 4, &assets[3].length);
+}
+
+static void freeAssets(void) {
+    for (int i = 0; i < sizeof(assets) / sizeof(assets[0]); i++) {
+        free(assets[i].data);
+    }
+}
+
+static void add(FfxNode parent, FfxNode node, int x, int y) {
+    check(node != NULL);
+    ffx_sceneNode_setPosition(node, ffx_point(x, y));
+    ffx_sceneGroup_appendChild(parent, node);
+}
+
+static const char *longText = "A paragraph longer than a label can hold, "
+  "which is recorded with a 16-bit length, so it replays in full. "
+  "It keeps going to pass 255 bytes, wrapping onto many lines, and "
+  "the lines past the bottom of the paragraph are dropped with an "
+  "ellipsis on the last line which is visible in the paragraph.";
+
+// Every deterministic node type, with two nested layers
+static void createDeterministic(FfxScene scene) {
+    FfxNode root = ffx_scene_root(scene);
+
+    add(root, ffx_scene_createFill(scene, ffx_color_rgb(10, 20, 30)), 0, 0);
+
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(50, 30));
+    ffx_sceneBox_setColor(box, ffx_color_rgb(200, 0, 0));
+    add(root, box, 5, 5);
+
+    FfxNode label = ffx_scene_createLabel(scene, FfxFontLargeBold, "Trace");
+    ffx_sceneLabel_setOutlineColor(label, ffx_color_rgb(0, 0, 255));
+    add(root, label, 60, 10);
+
+    FfxNode image = ffx_scene_createImage(scene, assets[0].data,
+      assets[0].length);
+    ffx_sceneImage_setTint(image, ffx_color_rgba(0, 255, 0, 16));
+    add(root, image, 150, 5);
+
+    FfxNode sprite = ffx_scene_createSprite(scene, assets[1].data,
+      assets[1].length);
+    ffx_sceneSprite_setScale(sprite, FM_1 * 2);
+    ffx_sceneSprite_setAngle(sprite, FM_PI / 6);
+    add(root, sprite, 200, 40);
+
+    FfxNode flipbook = ffx_scene_createFlipbook(scene, assets[2].data,
+      assets[2].length);
+    ffx_sceneFlipbook_setFrame(flipbook, 2);
+    ffx_sceneFlipbook_setPlaying(flipbook, false);
+    add(root, flipbook, 10, 60);
+
+    FfxNode tileMap = ffx_scene_createTileMap(scene, assets[3].data,
+      assets[3].length);
+    ffx_sceneTileMap_setSize(tileMap, ffx_size(40, 40));
+    ffx_sceneTileMap_setScroll(tileMap, ffx_point(13, -5));
+    ffx_sceneTileMap_setWrap(tileMap, true);
+    add(root, tileMap, 50, 60);
+
+    color_ffxt colors[] = {
+        ffx_color_rgb(255, 0, 0), ffx_color_rgb(0, 255, 0),
+        ffx_color_rgb(0, 0, 255)
+    };
+    FfxNode gradient = ffx_scene_createGradient(scene, ffx_size(60, 40),
+      FfxGradientTypeRadial);
+    ffx_sceneGradient_setColors(gradient, colors, 3);
+    ffx_sceneGradient_setStart(gradient, ffx_point(30, 20));
+    ffx_sceneGradient_setEnd(gradient, ffx_point(60, 20));
+    add(root, gradient, 100, 60);
+
+    FfxNode shape = ffx_scene_createShape(scene, FfxShapeTypeRoundRect,
+      ffx_size(50, 30));
+    ffx_sceneShape_setFillColor(shape, ffx_color_rgb(255, 255, 0));
+    ffx_sceneShape_setStrokeColor(shape, ffx_color_rgb(0, 0, 0));
+    ffx_sceneShape_setStrokeWidth(shape, 3);
+    ffx_sceneShape_setCornerRadius(shape, 8);
+    add(root, shape, 170, 60);
+
+    FfxNode paragraph = ffx_scene_createParagraph(scene, FfxFontSmall,
+      ffx_size(200, 60), longText);
+    ffx_sceneParagraph_setTextColor(paragraph, ffx_color_rgb(255, 255, 255));
+    add(root, paragraph, 10, 110);
+
+    FfxNode layer = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_setOpacity(layer, 16);
+    add(root, layer, 20, 170);
+
+    box = ffx_scene_createBox(scene, ffx_size(100, 40));
+    ffx_sceneBox_setColor(box, ffx_color_rgb(0, 200, 200));
+    add(layer, box, 0, 0);
+
+    FfxNode inner = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_setOpacity(inner, 24);
+    add(layer, inner, 10, 10);
+
+    label = ffx_scene_createLabel(scene, FfxFontMedium, "Layer");
+    add(inner, label, 0, 0);
+}
+
+static size_t countChildren(FfxNode group) {
+    size_t count = 0;
+    FfxNode child = ffx_sceneGroup_getFirstChild(group);
+    while (child) {
+        count++;
+        child = ffx_sceneNode_getNextSibling(child);
+    }
+    return count;
+}
+
+static FfxNode getChild(FfxNode group, size_t index) {
+    FfxNode child = ffx_sceneGroup_getFirstChild(group);
+    while (child && index--) { child = ffx_sceneNode_getNextSibling(child); }
+    check(child != NULL);
+    return child;
+}
+
+
+//////////////////////////
+// Tests
+
+static uint16_t frame[WIDTH * HEIGHT];
+
+static void testReplay(void) {
+    FfxScene scene = testScene();
+    createDeterministic(scene);
+
+    ffx_scene_startTrace(scene, traceData, sizeof(traceData));
+    testSequence(scene, 1);
+    testSequence(scene, 1);
+    size_t length = ffx_scene_stopTrace(scene);
+    check(length > 0);
+
+    testRender(scene, frame);
+    uint32_t original = testHash(frame, WIDTH * HEIGHT);
+    ffx_scene_free(scene);
+
+    // Replay the second frame into a fresh scene
+    scene = testScene();
+    FfxNode replay = ffx_scene_createTraceFrame(scene, traceData, length, 1,
+      getData, NULL);
+    check(replay != NULL);
+
+    // The two layers are re-created, nested, around their children; no
+    // record is dropped
+    checkEqual(countChildren(replay), 11);
+    FfxNode layer = getChild(replay, 10);
+    check(ffx_scene_isGroup(layer));
+    checkEqual(ffx_sceneGroup_getOpacity(layer), 16);
+    checkEqual(countChildren(layer), 2);
+    FfxNode inner = getChild(layer, 1);
+    checkEqual(ffx_sceneGroup_getOpacity(inner), 24);
+    check(ffx_scene_isLabel(getChild(inner, 0)));
+
+    check(ffx_scene_isQR(getChild(replay, 0)) == false);
+    check(ffx_scene_isSprite(getChild(replay, 4)));
+    check(ffx_scene_isParagraph(getChild(replay, 9)));
+    checkEqual(ffx_sceneParagraph_getTextLength(getChild(replay, 9)),
+      strlen(longText));
+
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), replay);
+    testSequence(scene, 1);
+    testRender(scene, frame);
+    checkEqual(testHash(frame, WIDTH * HEIGHT), original);
+
+    // There is no third frame
+    check(ffx_scene_createTraceFrame(scene, traceData, length, 2, getData,
+      NULL) == NULL);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testSubstituted(void) {
+    FfxScene scene = testScene();
+    FfxNode root = ffx_scene_root(scene);
+
+    FfxNode qr = ffx_scene_createQR(scene, "https://firefly.example/trace",
+      FfxQRCorrectionMedium);
+    ffx_sceneQR_setModuleSize(qr, 2);
+    add(root, qr, 10, 10);
+
+    FfxNode particles = ffx_scene_createParticles(scene, 64);
+    FfxParticleEmitter emitter;
+    ffx_sceneParticles_getEmitter(particles, &emitter);
+    emitter.life = 5000;
+    emitter.area = ffx_size(20, 20);
+    ffx_sceneParticles_setEmitter(particles, &emitter);
+    ffx_sceneParticles_emit(particles, 20);
+    add(root, particles, 120, 120);
+
+    FfxNode chart = ffx_scene_createChart(scene, ffx_size(100, 40), 64);
+    for (int i = 0; i < 50; i++) { ffx_sceneChart_append(chart, i * i - 300); }
+    add(root, chart, 100, 180);
+
+    ffx_scene_startTrace(scene, traceData, sizeof(traceData));
+    testSequence(scene, 1);
+    size_t length = ffx_scene_stopTrace(scene);
+
+    checkEqual(ffx_sceneParticles_getCount(particles), 20);
+    uint8_t version = ffx_sceneQR_getVersion(qr);
+    uint16_t size = ffx_sceneQR_getSize(qr);
+    ffx_scene_free(scene);
+
+    scene = testScene();
+    FfxNode replay = ffx_scene_createTraceFrame(scene, traceData, length, 0,
+      getData, NULL);
+    check(replay != NULL);
+    checkEqual(countChildren(replay), 3);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), replay);
+
+    qr = getChild(replay, 0);
+    check(ffx_scene_isQR(qr));
+    checkEqual(ffx_sceneQR_getVersion(qr), version);
+    checkEqual(ffx_sceneQR_getSize(qr), size);
+
+    // The particles are emitted on the first sequence and then persist
+    particles = getChild(replay, 1);
+    check(ffx_scene_isParticles(particles));
+    for (int i = 0; i < 10; i++) {
+        testSequence(scene, 100);
+        checkEqual(ffx_sceneParticles_getCount(particles), 20);
+    }
+
+    chart = getChild(replay, 2);
+    check(ffx_scene_isChart(chart));
+    checkEqual(ffx_sceneChart_getCount(chart), 50);
+    int32_t min, max;
+    check(ffx_sceneChart_getRange(chart, &min, &max));
+    checkEqual(min, -300);
+    checkEqual(max, 49 * 49 - 300);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testTruncated(void) {
+    FfxScene scene = testScene();
+    createDeterministic(scene);
+
+    // A trace which fills up keeps only complete records
+    ffx_scene_startTrace(scene, traceData, 300);
+    testSequence(scene, 1);
+    size_t length = ffx_scene_stopTrace(scene);
+    check(length <= 300);
+
+    FfxNode replay = ffx_scene_createTraceFrame(scene, traceData, length, 0,
+      getData, NULL);
+    check(replay != NULL);
+    check(countChildren(replay) < 11);
+    ffx_sceneNode_free(replay);
+
+    // Every truncation of a full trace is either rejected or stops at a
+    // frame boundary
+    ffx_scene_startTrace(scene, traceData, sizeof(traceData));
+    testSequence(scene, 1);
+    length = ffx_scene_stopTrace(scene);
+
+    for (size_t i = 0; i < length; i++) {
+        replay = ffx_scene_createTraceFrame(scene, traceData, i, 0, getData,
+          NULL);
+        if (replay) { ffx_sceneNode_free(replay); }
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_FRAMES   (2000)
+
+static void benchmark(void) {
+    FfxScene scene = testScene();
+    createDeterministic(scene);
+
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) { testSequence(scene, 1); }
+    double plain = testNow() - start;
+
+    start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        ffx_scene_startTrace(scene, traceData, sizeof(traceData));
+        testSequence(scene, 1);
+        ffx_scene_stopTrace(scene);
+    }
+    double traced = testNow() - start;
+
+    printf("bench: sequence %.2fus, traced %.2fus (16 records)\n",
+      plain / BENCH_FRAMES, traced / BENCH_FRAMES);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+int main(void) {
+    createAssets();
+
+    testReplay();
+    testSubstituted();
+    testTruncated();
+    benchmark();
+
+    freeAssets();
+    return 0;
+}
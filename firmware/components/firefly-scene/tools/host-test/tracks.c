@@ -0,0 +1,487 @@
+#include "test.h"
+
+// Keyframe tracks (see: ../../src/tracks.c)
+//
+// - every track type matches a brute-force reference, for each mode,
+//   with offsets, eased segments, long spans, shorter tracks and
+//   repeated keyframe times, for monotonic and jumping times
+// - the latest tracks set on a node replace earlier ones; clearing
+//   holds the current values
+// - tracks are released when a Once track completes, on clearing, when
+//   the node is freed and with the scene, and the steady state never
+//   allocates
+// - malformed tracks are rejected without allocating
+// - 128 looping sprites, tracks against chaining onComplete
+
+
+//////////////////////////
+// Recording
+
+// The tracks drive these, so each value set can be compared exactly
+#define MAX_NODES      (8)
+
+typedef struct Record {
+    FfxNode node;
+    int sets;
+    fixed_ffxt fixed;
+    FfxPoint point;
+    FfxSize size;
+    color_ffxt color;
+} Record;
+
+static Record records[MAX_NODES];
+
+static Record* getRecord(FfxNode node) {
+    for (int i = 0; i < MAX_NODES; i++) {
+        if (records[i].node == node) { return &records[i]; }
+    }
+    check(false);
+    return NULL;
+}
+
+static void setFixed(FfxNode node, fixed_ffxt value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->fixed = value;
+}
+
+static void setPoint(FfxNode node, FfxPoint value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->point = value;
+}
+
+static void setSize(FfxNode node, FfxSize value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->size = value;
+}
+
+static void setColor(FfxNode node, color_ffxt value) {
+    Record *record = getRecord(node);
+    record->sets++;
+    record->color = value;
+}
+
+// A group, which never renders, so only the tracks are allocated
+static FfxNode addNode(FfxScene scene, int index) {
+    FfxNode node = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+    memset(&records[index], 0, sizeof(Record));
+    records[index].node = node;
+    return node;
+}
+
+
+//////////////////////////
+// Reference
+
+static uint32_t referencePeriod(const FfxTrack *tracks, size_t count) {
+    uint32_t period = 0;
+    for (int i = 0; i < count; i++) {
+        uint32_t end = tracks[i].keyframes[tracks[i].count - 1].time;
+        if (end > period) { period = end; }
+    }
+    return period;
+}
+
+// The time into the tracks after %%elapsed%% ms
+static uint32_t referenceTime(FfxTrackMode mode, uint32_t period,
+  uint32_t elapsed) {
+
+    if (period == 0) { return 0; }
+    switch (mode) {
+        case FfxTrackModeOnce:
+            return (elapsed > period) ? period: elapsed;
+        case FfxTrackModeLoop:
+            return elapsed % period;
+        case FfxTrackModePingPong:
+            elapsed %= 2 * period;
+            return (elapsed > period) ? 2 * period - elapsed: elapsed;
+    }
+    return 0;
+}
+
+// Checks the recorded value of %%track%% at %%time%%, finding the
+// keyframe by a linear scan and the ratio with 64-bit math
+static void checkTrack(Record *record, const FfxTrack *track,
+  uint32_t time) {
+
+    size_t index = 0;
+    for (size_t k = 0; k < track->count; k++) {
+        if (track->keyframes[k].time <= time) { index = k; }
+    }
+
+    const FfxKeyframe *k0 = &track->keyframes[index], *k1 = k0;
+    fixed_ffxt t = 0;
+    if (index + 1 < track->count && time >= k0->time) {
+        k1 = &k0[1];
+        t = ((uint64_t)(time - k0->time) << 16) / (k1->time - k0->time);
+        if (k0->curve) { t = k0->curve(t); }
+    }
+
+    switch (track->type) {
+        case FfxTrackTypeFixed:
+            checkEqual(record->fixed, k0->value.fixed +
+              mulfx(k1->value.fixed - k0->value.fixed, t));
+            break;
+        case FfxTrackTypePoint:
+            checkEqual(record->point.x, k0->value.point.x +
+              scalarfx(k1->value.point.x - k0->value.point.x, t));
+            checkEqual(record->point.y, k0->value.point.y +
+              scalarfx(k1->value.point.y - k0->value.point.y, t));
+            break;
+        case FfxTrackTypeSize:
+            checkEqual(record->size.width, k0->value.size.width +
+              scalarfx(k1->value.size.width - k0->value.size.width, t));
+            checkEqual(record->size.height, k0->value.size.height +
+              scalarfx(k1->value.size.height - k0->value.size.height, t));
+            break;
+        case FfxTrackTypeColor:
+            checkEqual(record->color, ffx_color_lerpfx(k0->value.color,
+              k1->value.color, t));
+            break;
+    }
+}
+
+
+//////////////////////////
+// Evaluation
+
+// FM_1, as a constant for the keyframe initializers
+#define FIXED_ONE      (0x10000)
+
+static const FfxKeyframe fixedKeys[] = {
+    { .time = 0, .value.fixed = (-3 * FIXED_ONE) },
+    { .time = 100, .value.fixed = (5 * FIXED_ONE),
+      .curve = FfxCurveEaseInOutQuad },
+    { .time = 100, .value.fixed = (2 * FIXED_ONE) },
+    { .time = 350, .value.fixed = (2 * FIXED_ONE),
+      .curve = FfxCurveEaseOutBounce },
+    { .time = 400, .value.fixed = (-3 * FIXED_ONE) },
+};
+
+static const FfxKeyframe pointKeys[] = {
+    { .time = 20, .value.point = { 10, 20 } },
+    { .time = 90, .value.point = { 200, -20 },
+      .curve = FfxCurveEaseInSine },
+    { .time = 250, .value.point = { -40, 230 } },
+    { .time = 400, .value.point = { 10, 20 } },
+};
+
+// Ends early, so holds for the rest of the period
+static const FfxKeyframe sizeKeys[] = {
+    { .time = 0, .value.size = { 1, 1 }, .curve = FfxCurveEaseOutCubic },
+    { .time = 300, .value.size = { 240, 120 } },
+};
+
+static const FfxKeyframe colorKeys[] = {
+    { .time = 0, .value.color = COLOR_RED },
+    { .time = 130, .value.color = COLOR_BLUE, .curve = FfxCurveEaseInExpo },
+    { .time = 400, .value.color = 0x1400ff00 },
+};
+
+static const FfxTrack tracks[] = {
+    { FfxTrackTypeFixed, { .fixed = setFixed }, fixedKeys, 5 },
+    { FfxTrackTypePoint, { .point = setPoint }, pointKeys, 4 },
+    { FfxTrackTypeSize, { .size = setSize }, sizeKeys, 2 },
+    { FfxTrackTypeColor, { .color = setColor }, colorKeys, 3 },
+};
+
+#define TRACK_COUNT    (sizeof(tracks) / sizeof(tracks[0]))
+
+// Plays %%tracks%% with %%mode%% and %%offset%%, advancing the clock by
+// %%steps%% each sequence (cycling), checking every value
+static void checkTracks(const FfxTrack *tracks, size_t count,
+  FfxTrackMode mode, uint32_t offset, const uint32_t *steps,
+  size_t stepCount, int sequences) {
+
+    FfxScene scene = testScene();
+    FfxNode node = addNode(scene, 0);
+    Record *record = &records[0];
+
+    uint32_t live = testLive();
+    check(ffx_sceneNode_setTracks(node, tracks, count, mode, offset));
+    checkEqual(testLive(), live + 1);
+
+    uint32_t period = referencePeriod(tracks, count);
+
+    // As with animations, a sequence evaluates at the clock read by the
+    // previous sequence, so each step lands a sequence later
+    uint32_t elapsed = offset, lastStep = 0;
+
+    testSequence(scene, 0);
+    for (int s = 0; s < sequences; s++) {
+        uint32_t time = referenceTime(mode, period, elapsed);
+        for (int i = 0; i < count; i++) {
+            checkTrack(record, &tracks[i], time);
+        }
+        checkEqual(record->sets, count * (s + 1));
+
+        // Once completes at the end of the period, and is released
+        if (mode == FfxTrackModeOnce && elapsed >= period) {
+            checkEqual(testLive(), live);
+            break;
+        }
+        checkEqual(testLive(), live + 1);
+
+        uint32_t step = steps[s % stepCount];
+        testSequence(scene, step);
+        elapsed += lastStep;
+        lastStep = step;
+    }
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testModes(void) {
+    const uint32_t frames[] = { 16, 17, 16 };
+    const uint32_t jumps[] = { 1, 399, 401, 2, 57, 1000, 3, 799, 123457 };
+
+    for (FfxTrackMode mode = FfxTrackModeOnce;
+      mode <= FfxTrackModePingPong; mode++) {
+        // Monotonic through a few periods, then jumping about
+        checkTracks(tracks, TRACK_COUNT, mode, 0, frames, 3, 120);
+        checkTracks(tracks, TRACK_COUNT, mode, 250, frames, 3, 120);
+        checkTracks(tracks, TRACK_COUNT, mode, 0, jumps, 9, 200);
+
+        // Every ms, so every keyframe boundary is hit exactly
+        const uint32_t one = 1;
+        checkTracks(tracks, TRACK_COUNT, mode, 0, &one, 1, 900);
+
+        // A single keyframe holds its value; an empty period completes
+        const FfxTrack single = {
+            FfxTrackTypePoint, { .point = setPoint }, &pointKeys[1], 1
+        };
+        checkTracks(&single, 1, mode, 0, frames, 3, 10);
+    }
+}
+
+static void testLongSpans(void) {
+    // Spans past 15 bits take the two-step division, exact to 24 bits
+    static const FfxKeyframe keys[] = {
+        { .time = 0, .value.fixed = (-1000 * FIXED_ONE) },
+        { .time = 0x40000, .value.fixed = (1000 * FIXED_ONE) },
+        { .time = 0xfff000, .value.fixed = (-1000 * FIXED_ONE),
+          .curve = FfxCurveEaseInOutSine },
+        { .time = 0xfff001, .value.fixed = 0 },
+    };
+    const FfxTrack track = {
+        FfxTrackTypeFixed, { .fixed = setFixed }, keys, 4
+    };
+    const uint32_t steps[] = { 12345, 0x3fff, 99991, 0x7fff, 0x8001 };
+
+    checkTracks(&track, 1, FfxTrackModeLoop, 0, steps, 5, 4000);
+    checkTracks(&track, 1, FfxTrackModePingPong, 77, steps, 5, 4000);
+}
+
+
+//////////////////////////
+// Lifetime
+
+static void testReplace(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addNode(scene, 0);
+    Record *record = &records[0];
+    uint32_t base = testLive();
+
+    // Set twice before a sequence; only the latest plays, and the
+    // earlier is freed
+    check(ffx_sceneNode_setTracks(node, tracks, 2, FfxTrackModeLoop, 0));
+    check(ffx_sceneNode_setTracks(node, &tracks[2], 1, FfxTrackModeLoop,
+      0));
+    testSequence(scene, 0);
+    checkEqual(record->sets, 1);
+    checkEqual(testLive(), base + 1);
+
+    // Replacing frees the earlier tracks at the next sequence
+    uint32_t live = testLive();
+    check(ffx_sceneNode_setTracks(node, tracks, TRACK_COUNT,
+      FfxTrackModeLoop, 0));
+    testSequence(scene, 10);
+    checkEqual(testLive(), live);
+    checkEqual(record->sets, 1 + TRACK_COUNT);
+
+    // The steady state never allocates
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    for (int i = 0; i < 100; i++) { testSequence(scene, 16); }
+    checkEqual(atomic_load(&testHeap.allocs), allocs);
+
+    // Clearing holds the current values and frees the tracks
+    int sets = record->sets;
+    FfxPoint point = record->point;
+    ffx_sceneNode_clearTracks(node);
+    testSequence(scene, 16);
+    testSequence(scene, 16);
+    checkEqual(record->sets, sets);
+    checkEqual(record->point.x, point.x);
+    checkEqual(testLive(), base);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testRelease(void) {
+    FfxScene scene = testScene();
+
+    // Freed while playing, and freed before its tracks were attached
+    FfxNode playing = addNode(scene, 0);
+    FfxNode pending = addNode(scene, 1);
+    FfxNode kept = addNode(scene, 2);
+
+    check(ffx_sceneNode_setTracks(playing, tracks, TRACK_COUNT,
+      FfxTrackModeLoop, 0));
+    check(ffx_sceneNode_setTracks(kept, tracks, TRACK_COUNT,
+      FfxTrackModePingPong, 0));
+    testSequence(scene, 16);
+
+    check(ffx_sceneNode_setTracks(pending, tracks, TRACK_COUNT,
+      FfxTrackModeLoop, 0));
+    ffx_sceneNode_free(playing);
+    ffx_sceneNode_free(pending);
+
+    int sets = records[2].sets;
+    testSequence(scene, 16);
+    checkEqual(records[0].sets, TRACK_COUNT);
+    checkEqual(records[1].sets, 0);
+    checkEqual(records[2].sets, sets + TRACK_COUNT);
+
+    // The scene frees any tracks still playing, and any still pending
+    check(ffx_sceneNode_setTracks(kept, tracks, 1, FfxTrackModeOnce, 0));
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+static void testInvalid(void) {
+    FfxScene scene = testScene();
+    FfxNode node = addNode(scene, 0);
+
+    const FfxKeyframe unordered[] = {
+        { .time = 10 }, { .time = 20 }, { .time = 19 }
+    };
+    const FfxTrack bad[] = {
+        { FfxTrackTypeFixed, { .fixed = setFixed }, unordered, 3 },
+        { FfxTrackTypeFixed, { .fixed = setFixed }, unordered, 0 },
+        { FfxTrackTypeFixed, { .fixed = setFixed }, NULL, 3 },
+    };
+
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    for (int i = 0; i < 3; i++) {
+        const FfxTrack list[] = { tracks[0], bad[i] };
+        check(!ffx_sceneNode_setTracks(node, list, 2, FfxTrackModeLoop, 0));
+    }
+    checkEqual(atomic_load(&testHeap.allocs), allocs);
+
+    // An allocation failure
+    atomic_store(&testHeap.failIn, 1);
+    check(!ffx_sceneNode_setTracks(node, tracks, 1, FfxTrackModeLoop, 0));
+
+    testSequence(scene, 16);
+    checkEqual(records[0].sets, 0);
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+}
+
+
+//////////////////////////
+// Benchmark
+
+#define BENCH_SPRITES   (128)
+#define BENCH_FRAMES    (2000)
+
+static const FfxPoint path[] = {
+    { 20, 20 }, { 200, 40 }, { 180, 200 }, { 40, 180 }, { 20, 20 }
+};
+
+static void chain(FfxNode node, FfxSceneActionStop stopType, void *arg) {
+    if (stopType != FfxSceneActionStopNormal) { return; }
+
+    uintptr_t step = (uintptr_t)arg + 1;
+    ffx_sceneNode_animatePosition(node, path[step % 4], 0, 400,
+      FfxCurveEaseInOutQuad, chain, (void*)step);
+}
+
+static double benchmarkPixies(bool useTracks, double *allocsPerFrame) {
+    FfxScene scene = testScene();
+
+    FfxKeyframe keys[5];
+    for (int k = 0; k < 5; k++) {
+        keys[k] = (FfxKeyframe){
+            .time = 400 * k,
+            .value.point = path[k],
+            .curve = FfxCurveEaseInOutQuad
+        };
+    }
+    const FfxTrack track = {
+        FfxTrackTypePoint, { .point = ffx_sceneNode_setPosition }, keys, 5
+    };
+
+    FfxNode first = NULL;
+    for (int i = 0; i < BENCH_SPRITES; i++) {
+        FfxNode node = ffx_scene_createBox(scene, ffx_size(4, 4));
+        if (first == NULL) { first = node; }
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+
+        if (useTracks) {
+            check(ffx_sceneNode_setTracks(node, &track, 1,
+              FfxTrackModeLoop, 13 * i));
+        } else {
+            chain(node, FfxSceneActionStopNormal, (void*)(uintptr_t)i);
+        }
+    }
+
+    // Let every sprite start, so only the steady state is measured
+    testSequence(scene, 1);
+    testSequence(scene, 1);
+
+    uint32_t allocs = atomic_load(&testHeap.allocs);
+    int moves = 0;
+    double start = testNow();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        FfxPoint position = ffx_sceneNode_getPosition(first);
+        testSequence(scene, 16);
+
+        FfxPoint moved = ffx_sceneNode_getPosition(first);
+        if (moved.x != position.x || moved.y != position.y) { moves++; }
+    }
+    double duration = (testNow() - start) / BENCH_FRAMES;
+
+    // Both keep moving (pausing only as they ease through a corner)
+    check(moves > BENCH_FRAMES * 3 / 4);
+
+    // Less the render of each sprite, which both allocate
+    *allocsPerFrame = (double)(atomic_load(&testHeap.allocs) - allocs) /
+      BENCH_FRAMES - BENCH_SPRITES;
+
+    ffx_scene_free(scene);
+    checkEqual(testLive(), 0);
+
+    return duration;
+}
+
+static void benchmark(void) {
+    double trackAllocs, chainAllocs;
+    double trackCost = benchmarkPixies(true, &trackAllocs);
+    double chainCost = benchmarkPixies(false, &chainAllocs);
+
+    check(trackAllocs == 0);
+    check(chainAllocs > 0);
+
+    printf("bench: %d looping sprites; tracks %.1fus/sequence "
+      "(%.2f allocs/frame), onComplete chain %.1fus/sequence "
+      "(%.2f allocs/frame)\n", BENCH_SPRITES, trackCost, trackAllocs,
+      chainCost, chainAllocs);
+}
+
+
+int main(void) {
+    testModes();
+    testLongSpans();
+    testReplace();
+    testRelease();
+    testInvalid();
+    benchmark();
+    return 0;
+}
@@ -0,0 +1,2 @@
+export {};
+//# sourceMappingURL=cli-scene-blob.d.ts.map
\ No newline at end of file
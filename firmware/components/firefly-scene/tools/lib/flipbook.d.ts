@@ -1,2 +1,24 @@
-export {};
+import type { JimpInstance } from "jimp";
+export interface FlipbookFrame {
+    image: JimpInstance;
+    duration: number;
+}
+export type FlipbookOptions = {
+    keyframeInterval?: number;
+};
+export type FlipbookStats = {
+    frames: number;
+    keyframes: number;
+    bytes: number;
+    imageBytes: number;
+    maxPixels: number;
+};
+export declare class Flipbook {
+    #private;
+    readonly width: number;
+    readonly height: number;
+    constructor(frames: Array<FlipbookFrame>, options?: FlipbookOptions);
+    get stats(): FlipbookStats;
+    get bytes(): Uint8Array;
+}
 //# sourceMappingURL=flipbook.d.ts.map
\ No newline at end of file
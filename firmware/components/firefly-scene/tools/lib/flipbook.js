@@ -1,16 +1,208 @@
-// Transitions
-// - 0; immediate
-// - 1; crossfade
-// - 2: cross disolve
-export {};
-// VERSION,
-// FORMAT,
-// width,
-// height,
-// frame count
-// Frame Info
-//   - duration (number of frames)
-//   - offset (3 bytes) ; up to 32Mb!
-//   - transition
-// Frame Data
+var __classPrivateFieldSet = (this && this.__classPrivateFieldSet) || function (receiver, state, value, kind, f) {
+    if (kind === "m") throw new TypeError("Private method is not writable");
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a setter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot write private member to an object whose class did not declare it");
+    return (kind === "a" ? f.call(receiver, value) : f ? f.value = value : state.set(receiver, value)), value;
+};
+var __classPrivateFieldGet = (this && this.__classPrivateFieldGet) || function (receiver, state, kind, f) {
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a getter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot read private member from an object whose class did not declare it");
+    return kind === "m" ? f : kind === "a" ? f.call(receiver) : f ? f.value : state.get(receiver);
+};
+var _Flipbook_palette, _Flipbook_frames;
+import { Jimp } from "jimp";
+import { rgb565 } from "./color.js";
+import { VERSION_TAG, getPixels } from "./image.js";
+// See: firefly-scene/src/node-flipbook.c
+const FORMAT_FLIPBOOK = 0x46;
+const PALETTE_SIZE = 256;
+const FLAG_KEYFRAME = (1 << 0);
+// Returns the bounding rectangle of the indices which differ
+function getChanged(width, height, a, b) {
+    let x0 = width, y0 = height, x1 = -1, y1 = -1;
+    for (let y = 0; y < height; y++) {
+        for (let x = 0; x < width; x++) {
+            const i = y * width + x;
+            if (a[i] === b[i]) {
+                continue;
+            }
+            if (x < x0) {
+                x0 = x;
+            }
+            if (x > x1) {
+                x1 = x;
+            }
+            if (y < y0) {
+                y0 = y;
+            }
+            if (y > y1) {
+                y1 = y;
+            }
+        }
+    }
+    if (x1 === -1) {
+        return { x: 0, y: 0, w: 0, h: 0 };
+    }
+    return { x: x0, y: y0, w: x1 - x0 + 1, h: y1 - y0 + 1 };
+}
+function getRect(width, indices, rect) {
+    const result = [];
+    for (let y = rect.y; y < rect.y + rect.h; y++) {
+        for (let x = rect.x; x < rect.x + rect.w; x++) {
+            result.push(indices[y * width + x]);
+        }
+    }
+    return result;
+}
+// Maps each frame onto a single shared palette, quantizing all the
+// frames together if there are too many colors
+function getIndices(images) {
+    const palette = [];
+    const lookup = new Map();
+    const indices = [];
+    for (const image of images) {
+        const { pixels } = getPixels(image);
+        const frame = new Uint8Array(pixels.length);
+        for (let i = 0; i < pixels.length; i++) {
+            const _c = rgb565(pixels[i]);
+            const c = (_c[0] << 8) | _c[1];
+            let index = lookup.get(c);
+            if (index == null) {
+                index = palette.length;
+                palette.push(c);
+                lookup.set(c, index);
+            }
+            frame[i] = index;
+        }
+        if (palette.length > PALETTE_SIZE) {
+            break;
+        }
+        indices.push(frame);
+    }
+    if (indices.length === images.length) {
+        while (palette.length < PALETTE_SIZE) {
+            palette.push(0);
+        }
+        return { palette, indices };
+    }
+    // Stack the frames to quantize them against one palette
+    const { width, height } = images[0].bitmap;
+    const stack = new Jimp({ width, height: height * images.length, color: 0 });
+    images.forEach((image, index) => {
+        stack.composite(image, 0, index * height);
+    });
+    stack.quantize({ colors: PALETTE_SIZE - 1 });
+    return getIndices(images.map((image, index) => {
+        return (stack.clone().crop({
+            x: 0, y: index * height, w: width, h: height
+        }));
+    }));
+}
+export class Flipbook {
+    constructor(frames, options) {
+        _Flipbook_palette.set(this, void 0);
+        _Flipbook_frames.set(this, void 0);
+        if (frames.length === 0 || frames.length > 0xffff) {
+            throw new Error("invalid frame count");
+        }
+        const { width, height } = frames[0].image.bitmap;
+        for (const { image } of frames) {
+            if (image.bitmap.width !== width || image.bitmap.height !== height) {
+                throw new Error("frames must be the same size");
+            }
+        }
+        const keyframeInterval = (options && options.keyframeInterval) || 0;
+        this.width = width;
+        this.height = height;
+        const { palette, indices } = getIndices(frames.map((f) => f.image));
+        __classPrivateFieldSet(this, _Flipbook_palette, palette, "f");
+        const full = { x: 0, y: 0, w: width, h: height };
+        const area = width * height;
+        __classPrivateFieldSet(this, _Flipbook_frames, [], "f");
+        // The pixels drawn since the last keyframe; drawing a frame
+        // replays from its keyframe, so a new keyframe is added once
+        // that cost would exceed a whole image
+        let replay = 0;
+        let sinceKeyframe = 0;
+        frames.forEach(({ duration }, index) => {
+            let rect = full, keyframe = true;
+            if (index > 0) {
+                const changed = getChanged(width, height, indices[index - 1], indices[index]);
+                const cost = changed.w * changed.h;
+                keyframe = (replay + cost > area);
+                if (keyframeInterval && sinceKeyframe + 1 >= keyframeInterval) {
+                    keyframe = true;
+                }
+                if (!keyframe) {
+                    rect = changed;
+                    replay += cost;
+                    sinceKeyframe++;
+                }
+            }
+            if (keyframe) {
+                replay = 0;
+                sinceKeyframe = 0;
+            }
+            __classPrivateFieldGet(this, _Flipbook_frames, "f").push({
+                duration: Math.min(Math.max(0, Math.round(duration)), 0xffff),
+                keyframe, rect,
+                pixels: getRect(width, indices[index], rect)
+            });
+        });
+    }
+    get stats() {
+        let maxPixels = 0, pixels = 0;
+        for (const frame of __classPrivateFieldGet(this, _Flipbook_frames, "f")) {
+            if (frame.keyframe) {
+                pixels = 0;
+            }
+            pixels += frame.rect.w * frame.rect.h;
+            if (pixels > maxPixels) {
+                maxPixels = pixels;
+            }
+        }
+        return {
+            frames: __classPrivateFieldGet(this, _Flipbook_frames, "f").length,
+            keyframes: __classPrivateFieldGet(this, _Flipbook_frames, "f").filter((f) => f.keyframe).length,
+            bytes: this.bytes.length,
+            // As individual palette images (see: image-palette.ts)
+            imageBytes: __classPrivateFieldGet(this, _Flipbook_frames, "f").length * (6 + 2 * PALETTE_SIZE +
+                this.width * this.height),
+            maxPixels
+        };
+    }
+    get bytes() {
+        const data = [];
+        const push16 = (v) => { data.push((v >> 8) & 0xff, v & 0xff); };
+        data.push(VERSION_TAG, FORMAT_FLIPBOOK);
+        push16(this.width);
+        push16(this.height);
+        push16(__classPrivateFieldGet(this, _Flipbook_frames, "f").length);
+        for (const c of __classPrivateFieldGet(this, _Flipbook_palette, "f")) {
+            push16(c);
+        }
+        let offset = 0;
+        for (const frame of __classPrivateFieldGet(this, _Flipbook_frames, "f")) {
+            push16(frame.duration);
+            push16(frame.keyframe ? FLAG_KEYFRAME : 0);
+            push16(frame.rect.x);
+            push16(frame.rect.y);
+            push16(frame.rect.w);
+            push16(frame.rect.h);
+            push16(Math.floor(offset / 0x10000));
+            push16(offset % 0x10000);
+            offset += frame.pixels.length + (frame.pixels.length % 2);
+        }
+        for (const frame of __classPrivateFieldGet(this, _Flipbook_frames, "f")) {
+            for (const index of frame.pixels) {
+                data.push(index);
+            }
+            if (frame.pixels.length % 2) {
+                data.push(0);
+            }
+        }
+        return new Uint8Array(data);
+    }
+}
+_Flipbook_palette = new WeakMap(), _Flipbook_frames = new WeakMap();
 //# sourceMappingURL=flipbook.js.map
\ No newline at end of file
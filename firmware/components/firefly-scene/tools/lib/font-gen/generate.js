@@ -124,7 +124,12 @@ function getValue(v) {
         for (let i = 33; i < 127; i++) {
             // Compute the glyph bitmap
             let bitmap = font.getBitmap(String.fromCharCode(i));
+            // An outlined font is combined with its fill, so the glyph
+            // can be rendered in a single pass; the fill always lies
+            // within the outline bounds, so trimming the outline is safe
+            let fill = null;
             if (outline) {
+                fill = bitmap.expanded(outline);
                 bitmap = bitmap.outlined(outline);
             }
             bitmap = bitmap.trimmed();
@@ -160,7 +165,8 @@ function getValue(v) {
             if (bitmap.padTop > maxPadTop) {
                 maxPadTop = bitmap.padTop;
             }
-            // Compute bitmap data
+            // Compute bitmap data; combined glyphs use 2 bits per pixel
+            // (0b00 = none, 0b01 = outline, 0b10 = fill)
             let v = '';
             for (let y = 0; y < bitmap.height; y++) {
                 for (let x = 0; x < bitmap.width; x++) {
@@ -168,7 +174,19 @@ function getValue(v) {
                         data.push(getValue(v));
                         v = '';
                     }
-                    v += bitmap.getBit(x, y) ? "1" : "0";
+                    if (fill) {
+                        const fx = x + bitmap.padLeft - fill.padLeft;
+                        const fy = y + bitmap.padTop - fill.padTop;
+                        if (fill.getBit(fx, fy)) {
+                            v += "10";
+                        }
+                        else {
+                            v += bitmap.getBit(x, y) ? "01" : "00";
+                        }
+                    }
+                    else {
+                        v += bitmap.getBit(x, y) ? "1" : "0";
+                    }
                 }
             }
             if (v.length > 0) {
@@ -214,8 +232,8 @@ function getValue(v) {
                     }
                 }
                 doth.push("");
-                doth.push(`/\/ Font: ${size.toLowerCase()}-${weight.toLowerCase()}${outline ? "-outline" : ""} (${font.filename})`);
-                doth.push(`const uint32_t font_${size.toLowerCase()}_${weight.toLowerCase()}${outline ? "_outline" : ""}[] = {`);
+                doth.push(`/\/ Font: ${size.toLowerCase()}-${weight.toLowerCase()}${outline ? "-combined" : ""} (${font.filename})`);
+                doth.push(`const uint32_t font_${size.toLowerCase()}_${weight.toLowerCase()}${outline ? "_combined" : ""}[] = {`);
                 generateFont(font, outline);
                 doth.push("");
                 doth.push(`  ${toHex(0)}`);
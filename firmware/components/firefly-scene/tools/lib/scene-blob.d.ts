@@ -0,0 +1,29 @@
+export type SceneNodeDescription = {
+    type: string;
+    position?: [number, number];
+    hidden?: boolean;
+    children?: Array<SceneNodeDescription>;
+    size?: [number, number];
+    color?: string;
+    font?: string;
+    text?: string;
+    align?: Array<string>;
+    outline?: string;
+    image?: string;
+    name?: string;
+    tag?: number;
+    dataSize?: number;
+    child?: SceneNodeDescription;
+};
+export type SceneDescription = {
+    images?: Array<string>;
+    root: SceneNodeDescription;
+};
+export type SceneBlob = {
+    bytes: Uint8Array;
+    images: Array<string>;
+    anchors: Array<string>;
+};
+export declare function compileScene(scene: SceneDescription): SceneBlob;
+export declare function toSceneDotH(blob: SceneBlob, tag: string): string;
+//# sourceMappingURL=scene-blob.d.ts.map
\ No newline at end of file
@@ -0,0 +1,254 @@
+// See: firefly-scene/src/blob.c
+var __classPrivateFieldSet = (this && this.__classPrivateFieldSet) || function (receiver, state, value, kind, f) {
+    if (kind === "m") throw new TypeError("Private method is not writable");
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a setter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot write private member to an object whose class did not declare it");
+    return (kind === "a" ? f.call(receiver, value) : f ? f.value = value : state.set(receiver, value)), value;
+};
+var __classPrivateFieldGet = (this && this.__classPrivateFieldGet) || function (receiver, state, kind, f) {
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a getter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot read private member from an object whose class did not declare it");
+    return kind === "m" ? f : kind === "a" ? f.call(receiver) : f ? f.value : state.get(receiver);
+};
+var _Writer_data;
+const VERSION_TAG = 0x01;
+const FORMAT_SCENE = 0x53;
+const NodeType = {
+    group: 1,
+    box: 2,
+    fill: 3,
+    label: 4,
+    image: 5,
+    anchor: 6,
+};
+const FLAG_HIDDEN = (1 << 0);
+const Fonts = {
+    "large": 0x18,
+    "large-bold": 0x98,
+    "medium": 0x14,
+    "medium-bold": 0x94,
+    "small": 0x0f,
+    "small-bold": 0x8f,
+};
+const Aligns = {
+    "top": (1 << 0),
+    "middle": (1 << 1),
+    "bottom": (1 << 2),
+    "middle-baseline": (1 << 3),
+    "baseline": (1 << 4),
+    "left": (1 << 5),
+    "center": (1 << 6),
+    "right": (1 << 7),
+};
+// Colors are "#rrggbb", "#rrggbbaa" or "transparent"; encoded as a
+// color_ffxt RGBA (see: firefly-color.h)
+function getColor(value, defaultValue) {
+    if (value == null) {
+        return defaultValue;
+    }
+    if (value === "transparent") {
+        return 0x20000000;
+    }
+    const match = value.match(/^#([0-9a-f]{6})([0-9a-f]{2})?$/i);
+    if (!match) {
+        throw new Error(`invalid color: ${value}`);
+    }
+    const rgb = parseInt(match[1], 16);
+    const a = (match[2] == null) ? 255 : parseInt(match[2], 16);
+    const opacity = Math.round(a * 32 / 255);
+    return (((32 - opacity) << 24) | rgb) >>> 0;
+}
+class Writer {
+    constructor() {
+        _Writer_data.set(this, void 0);
+        __classPrivateFieldSet(this, _Writer_data, [], "f");
+    }
+    get bytes() { return new Uint8Array(__classPrivateFieldGet(this, _Writer_data, "f")); }
+    uint8(value) {
+        if (value < 0 || value > 0xff || value !== Math.trunc(value)) {
+            throw new Error(`invalid uint8: ${value}`);
+        }
+        __classPrivateFieldGet(this, _Writer_data, "f").push(value);
+    }
+    uint16(value) {
+        if (value < 0 || value > 0xffff || value !== Math.trunc(value)) {
+            throw new Error(`invalid uint16: ${value}`);
+        }
+        __classPrivateFieldGet(this, _Writer_data, "f").push(value >> 8, value & 0xff);
+    }
+    int16(value) {
+        if (value < -0x8000 || value > 0x7fff) {
+            throw new Error(`invalid int16: ${value}`);
+        }
+        this.uint16(value & 0xffff);
+    }
+    uint32(value) {
+        this.uint16((value >>> 16) & 0xffff);
+        this.uint16(value & 0xffff);
+    }
+    string(value) {
+        const bytes = new TextEncoder().encode(value);
+        this.uint8(bytes.length);
+        for (const b of bytes) {
+            __classPrivateFieldGet(this, _Writer_data, "f").push(b);
+        }
+    }
+}
+_Writer_data = new WeakMap();
+export function compileScene(scene) {
+    const images = (scene.images || []).slice();
+    const anchors = [];
+    let nodeCount = 0;
+    const body = new Writer();
+    const writeNode = (node) => {
+        const type = NodeType[node.type];
+        if (type == null) {
+            throw new Error(`unknown node type: ${node.type}`);
+        }
+        if (node.name != null && node.type !== "anchor") {
+            throw new Error(`only anchors may be named: ${node.name}`);
+        }
+        nodeCount++;
+        const position = node.position || [0, 0];
+        body.uint8(type);
+        body.uint8(node.hidden ? FLAG_HIDDEN : 0);
+        body.int16(position[0]);
+        body.int16(position[1]);
+        switch (node.type) {
+            case "group": {
+                const children = node.children || [];
+                body.uint16(children.length);
+                for (const child of children) {
+                    writeNode(child);
+                }
+                break;
+            }
+            case "box": {
+                const size = node.size || [0, 0];
+                body.uint16(size[0]);
+                body.uint16(size[1]);
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+            }
+            case "fill":
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+            case "label": {
+                const font = Fonts[node.font || "medium"];
+                if (font == null) {
+                    throw new Error(`unknown font: ${node.font}`);
+                }
+                let align = 0;
+                for (const name of (node.align || [])) {
+                    const value = Aligns[name];
+                    if (value == null) {
+                        throw new Error(`unknown align: ${name}`);
+                    }
+                    align |= value;
+                }
+                body.uint8(font);
+                body.uint8(align);
+                body.uint32(getColor(node.color, 0x00ffffff));
+                body.uint32(getColor(node.outline, 0x20000000));
+                body.string(node.text || "");
+                break;
+            }
+            case "image": {
+                const index = images.indexOf(node.image || "");
+                if (index === -1) {
+                    throw new Error(`unknown image: ${node.image}`);
+                }
+                body.uint8(index);
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+            }
+            case "anchor":
+                if (node.child == null) {
+                    throw new Error("anchor missing child");
+                }
+                if (node.name != null) {
+                    if (anchors.indexOf(node.name) >= 0) {
+                        throw new Error(`duplicate anchor: ${node.name}`);
+                    }
+                    anchors.push(node.name);
+                }
+                else {
+                    anchors.push("");
+                }
+                body.uint32(node.tag || 0);
+                body.uint16(node.dataSize || 0);
+                writeNode(node.child);
+                break;
+        }
+    };
+    // The runtime carves the root first and uses it to own the whole
+    // allocation, which requires a group
+    let root = scene.root;
+    if (root.type !== "group") {
+        root = { type: "group", children: [root] };
+    }
+    writeNode(root);
+    if (images.length > 0xff) {
+        throw new Error("too many images");
+    }
+    const header = new Writer();
+    header.uint8(VERSION_TAG);
+    header.uint8(FORMAT_SCENE);
+    header.uint16(nodeCount);
+    header.uint16(anchors.length);
+    const bytes = new Uint8Array(6 + body.bytes.length);
+    bytes.set(header.bytes, 0);
+    bytes.set(body.bytes, 6);
+    return { bytes, images, anchors };
+}
+function defineName(value) {
+    return value.toUpperCase().replace(/[^A-Z0-9]/g, "_");
+}
+export function toSceneDotH(blob, tag) {
+    const output = [];
+    const prefix = `SCENE_${defineName(tag)}`;
+    output.push(`#ifndef __SCENE_${tag}_H__`);
+    output.push(`#define __SCENE_${tag}_H__`);
+    output.push("");
+    output.push("#ifdef __cplusplus");
+    output.push("extern \"C\" {");
+    output.push("#endif  /* __cplusplus */");
+    output.push("#include <stdint.h>");
+    output.push("");
+    output.push(`#define ${prefix}_IMAGE_COUNT  (${blob.images.length})`);
+    blob.images.forEach((name, index) => {
+        output.push(`#define ${prefix}_IMAGE_${defineName(name)}  (${index})`);
+    });
+    output.push("");
+    output.push(`#define ${prefix}_ANCHOR_COUNT  (${blob.anchors.length})`);
+    blob.anchors.forEach((name, index) => {
+        if (name === "") {
+            return;
+        }
+        output.push(`#define ${prefix}_ANCHOR_${defineName(name)}  (${index})`);
+    });
+    output.push("");
+    output.push(`const uint8_t scene_${tag}[] = {`);
+    const data = blob.bytes;
+    let offset = 0;
+    while (offset < data.length) {
+        const line = [];
+        while (offset < data.length && line.length < 12) {
+            let v = data[offset++].toString(16);
+            if (v.length < 2) {
+                v = "0" + v;
+            }
+            line.push(`0x${v}`);
+        }
+        output.push("  " + line.join(", ") + ",");
+    }
+    output.push("};");
+    output.push("");
+    output.push("#ifdef __cplusplus");
+    output.push("}");
+    output.push("#endif  /* __cplusplus */");
+    output.push("");
+    output.push(`#endif  /* __SCENE_${tag}_H__ */`);
+    return output.join("\n");
+}
+//# sourceMappingURL=scene-blob.js.map
\ No newline at end of file
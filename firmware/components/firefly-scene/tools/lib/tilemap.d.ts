@@ -0,0 +1,24 @@
+import type { JimpInstance } from "jimp";
+export type TileMapOptions = {
+    tileSize?: number;
+    palette?: boolean;
+};
+export type TileMapStats = {
+    columns: number;
+    rows: number;
+    tiles: number;
+    uniqueTiles: number;
+    bytes: number;
+    imageBytes: number;
+};
+export declare class TileMap {
+    #private;
+    readonly tileSize: number;
+    readonly columns: number;
+    readonly rows: number;
+    constructor(tileSize: number, columns: number, rows: number, palette: null | Array<number>, tiles: Array<Array<number>>, map: Array<number>);
+    get stats(): TileMapStats;
+    get bytes(): Uint8Array;
+    static fromImage(jimp: JimpInstance, options?: TileMapOptions): TileMap;
+}
+//# sourceMappingURL=tilemap.d.ts.map
\ No newline at end of file
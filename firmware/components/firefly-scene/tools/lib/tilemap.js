@@ -0,0 +1,154 @@
+var __classPrivateFieldSet = (this && this.__classPrivateFieldSet) || function (receiver, state, value, kind, f) {
+    if (kind === "m") throw new TypeError("Private method is not writable");
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a setter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot write private member to an object whose class did not declare it");
+    return (kind === "a" ? f.call(receiver, value) : f ? f.value = value : state.set(receiver, value)), value;
+};
+var __classPrivateFieldGet = (this && this.__classPrivateFieldGet) || function (receiver, state, kind, f) {
+    if (kind === "a" && !f) throw new TypeError("Private accessor was defined without a getter");
+    if (typeof state === "function" ? receiver !== state || !f : !state.has(receiver)) throw new TypeError("Cannot read private member from an object whose class did not declare it");
+    return kind === "m" ? f : kind === "a" ? f.call(receiver) : f ? f.value : state.get(receiver);
+};
+var _TileMap_palette, _TileMap_tiles, _TileMap_map;
+import { rgb565 } from "./color.js";
+import { VERSION_TAG, FORMAT_PALETTE8, FORMAT_RGB565, getPixels } from "./image.js";
+// See: firefly-scene/src/node-tilemap.c
+const FORMAT_TILEMAP = 0x4d;
+const PALETTE_SIZE = 256;
+// Returns the RGB565 value of every pixel
+function getColors(jimp) {
+    return getPixels(jimp).pixels.map((color) => {
+        const c = rgb565(color);
+        return (c[0] << 8) | c[1];
+    });
+}
+export class TileMap {
+    constructor(tileSize, columns, rows, palette, tiles, map) {
+        _TileMap_palette.set(this, void 0);
+        // Each unique tile's pixels (RGB565 colors or palette indices)
+        _TileMap_tiles.set(this, void 0);
+        _TileMap_map.set(this, void 0);
+        if (tileSize !== 8 && tileSize !== 16) {
+            throw new Error(`unsupported tile size: ${tileSize}`);
+        }
+        if (tiles.length === 0 || tiles.length > 0xffff) {
+            throw new Error("invalid tile count");
+        }
+        if (map.length !== columns * rows) {
+            throw new Error("invalid map length");
+        }
+        if (palette && palette.length > PALETTE_SIZE) {
+            throw new Error("palette too large");
+        }
+        this.tileSize = tileSize;
+        this.columns = columns;
+        this.rows = rows;
+        __classPrivateFieldSet(this, _TileMap_palette, palette, "f");
+        __classPrivateFieldSet(this, _TileMap_tiles, tiles, "f");
+        __classPrivateFieldSet(this, _TileMap_map, map, "f");
+    }
+    get stats() {
+        const width = this.columns * this.tileSize;
+        const height = this.rows * this.tileSize;
+        return {
+            columns: this.columns,
+            rows: this.rows,
+            tiles: __classPrivateFieldGet(this, _TileMap_map, "f").length,
+            uniqueTiles: __classPrivateFieldGet(this, _TileMap_tiles, "f").length,
+            bytes: this.bytes.length,
+            // As a single RGB565 image (see: image-rgb.ts)
+            imageBytes: 6 + 2 * width * height
+        };
+    }
+    get bytes() {
+        const data = [];
+        const push16 = (v) => { data.push((v >> 8) & 0xff, v & 0xff); };
+        data.push(VERSION_TAG, FORMAT_TILEMAP);
+        push16(__classPrivateFieldGet(this, _TileMap_palette, "f") ? FORMAT_PALETTE8 : FORMAT_RGB565);
+        push16(this.tileSize);
+        push16(__classPrivateFieldGet(this, _TileMap_tiles, "f").length);
+        push16(this.columns);
+        push16(this.rows);
+        if (__classPrivateFieldGet(this, _TileMap_palette, "f")) {
+            const palette = __classPrivateFieldGet(this, _TileMap_palette, "f").slice();
+            while (palette.length < PALETTE_SIZE) {
+                palette.push(0);
+            }
+            for (const c of palette) {
+                push16(c);
+            }
+            // Tiles always hold an even number of pixels, so indices
+            // pair up within each word
+            for (const tile of __classPrivateFieldGet(this, _TileMap_tiles, "f")) {
+                for (const index of tile) {
+                    data.push(index);
+                }
+            }
+        }
+        else {
+            for (const tile of __classPrivateFieldGet(this, _TileMap_tiles, "f")) {
+                for (const c of tile) {
+                    push16(c);
+                }
+            }
+        }
+        for (const index of __classPrivateFieldGet(this, _TileMap_map, "f")) {
+            push16(index);
+        }
+        return new Uint8Array(data);
+    }
+    // Cuts %%jimp%% into tiles, storing each distinct tile once. The
+    // image is cropped to a whole number of tiles.
+    static fromImage(jimp, options) {
+        const tileSize = (options && options.tileSize) || 16;
+        const usePalette = !!(options && options.palette);
+        const columns = Math.floor(jimp.bitmap.width / tileSize);
+        const rows = Math.floor(jimp.bitmap.height / tileSize);
+        if (columns === 0 || rows === 0) {
+            throw new Error("image smaller than a tile");
+        }
+        const width = jimp.bitmap.width;
+        let colors = getColors(jimp);
+        let palette = null;
+        if (usePalette) {
+            let unique = new Set(colors);
+            if (unique.size > PALETTE_SIZE) {
+                const quantized = (jimp.clone());
+                quantized.quantize({ colors: PALETTE_SIZE });
+                colors = getColors(quantized);
+                unique = new Set(colors);
+            }
+            palette = Array.from(unique);
+        }
+        const lookup = new Map();
+        if (palette) {
+            palette.forEach((c, index) => { lookup.set(c, index); });
+        }
+        const tiles = [];
+        const tileIndex = new Map();
+        const map = [];
+        for (let row = 0; row < rows; row++) {
+            for (let col = 0; col < columns; col++) {
+                const tile = [];
+                for (let y = 0; y < tileSize; y++) {
+                    for (let x = 0; x < tileSize; x++) {
+                        const c = colors[(row * tileSize + y) * width +
+                            col * tileSize + x];
+                        tile.push(palette ? (lookup.get(c)) : c);
+                    }
+                }
+                const key = tile.join(",");
+                let index = tileIndex.get(key);
+                if (index == null) {
+                    index = tiles.length;
+                    tiles.push(tile);
+                    tileIndex.set(key, index);
+                }
+                map.push(index);
+            }
+        }
+        return new TileMap(tileSize, columns, rows, palette, tiles, map);
+    }
+}
+_TileMap_palette = new WeakMap(), _TileMap_tiles = new WeakMap(), _TileMap_map = new WeakMap();
+//# sourceMappingURL=tilemap.js.map
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+/**
+ *  Generates the lookup tables for the built-in curves which are too
+ *  expensive to evaluate in fixed-point each animation step.
+ *
+ *  To run:
+ *    gcc generate-curves.c -lm && ./a.out > ../../src/curve-tables.h
+ *
+ *  Each table holds CURVE_SEGMENTS + 1 samples of the curve, from t=0
+ *  to t=1 inclusive, as signed 2.14 fixed-point (so overshooting curves
+ *  may reach [-2, 2)), which are linearly interpolated between.
+ *
+ *  See: https://easings.net/
+ */
+
+#define CURVE_SEGMENTS    (256)
+
+static double curve(int index, double t) {
+    const double c4 = (2.0 * M_PI) / 3.0;
+    const double c5 = (2.0 * M_PI) / 4.5;
+
+    switch (index) {
+        case 0: return 1.0 - cos((t * M_PI) / 2.0);
+        case 1: return sin((t * M_PI) / 2.0);
+        case 2: return -(cos(M_PI * t) - 1.0) / 2.0;
+
+        case 3: return (t == 0.0) ? 0.0: pow(2.0, 10.0 * t - 10.0);
+        case 4: return (t == 1.0) ? 1.0: 1.0 - pow(2.0, -10.0 * t);
+        case 5:
+            if (t == 0.0) { return 0.0; }
+            if (t == 1.0) { return 1.0; }
+            if (t < 0.5) { return pow(2.0, 20.0 * t - 10.0) / 2.0; }
+            return (2.0 - pow(2.0, -20.0 * t + 10.0)) / 2.0;
+
+        case 6:
+            if (t == 0.0) { return 0.0; }
+            if (t == 1.0) { return 1.0; }
+            return -pow(2.0, 10.0 * t - 10.0) * sin((t * 10.0 - 10.75) * c4);
+        case 7:
+            if (t == 0.0) { return 0.0; }
+            if (t == 1.0) { return 1.0; }
+            return pow(2.0, -10.0 * t) * sin((t * 10.0 - 0.75) * c4) + 1.0;
+        case 8:
+            if (t == 0.0) { return 0.0; }
+            if (t == 1.0) { return 1.0; }
+            if (t < 0.5) {
+                return -(pow(2.0, 20.0 * t - 10.0) *
+                  sin((20.0 * t - 11.125) * c5)) / 2.0;
+            }
+            return (pow(2.0, -20.0 * t + 10.0) *
+              sin((20.0 * t - 11.125) * c5)) / 2.0 + 1.0;
+    }
+
+    return t;
+}
+
+static const char *names[] = {
+    "easeInSine", "easeOutSine", "easeInOutSine",
+    "easeInExpo", "easeOutExpo", "easeInOutExpo",
+    "easeInElastic", "easeOutElastic", "easeInOutElastic",
+};
+
+int main() {
+    printf("#ifndef __CURVE_TABLES_H__\n");
+    printf("#define __CURVE_TABLES_H__\n");
+    printf("\n");
+    printf("#ifdef __cplusplus\n");
+    printf("extern \"C\" {\n");
+    printf("#endif  /* __cplusplus */\n");
+    printf("#include <stdint.h>\n");
+    printf("\n");
+    printf("// Generated by: tools/reference/generate-curves.c\n");
+    printf("\n");
+    printf("#define CURVE_SEGMENTS    (%d)\n", CURVE_SEGMENTS);
+
+    for (int i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        printf("\n");
+        printf("static const int16_t curve_%s[] = {", names[i]);
+        for (int s = 0; s <= CURVE_SEGMENTS; s++) {
+            double v = curve(i, (double)s / CURVE_SEGMENTS);
+            int32_t q = lround(v * 16384.0);
+            if (q < -32768) { q = -32768; }
+            if (q > 32767) { q = 32767; }
+            printf("%s%6d,", (s % 10) ? " ": "\n ", q);
+        }
+        printf("\n};\n");
+    }
+
+    printf("\n");
+    printf("#ifdef __cplusplus\n");
+    printf("}\n");
+    printf("#endif  /* __cplusplus */\n");
+    printf("\n");
+    printf("#endif  /* __CURVE_TABLES_H__ */\n");
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+/**
+ *  Generates the lookup tables used by the fixed-point maths library
+ *  (see: src/fixed.c).
+ *
+ *  To run:
+ *    gcc generate-fixed.c -lm && ./a.out > ../../src/fixed-tables.h
+ */
+
+static void dump(const char *type, const char *name, int count,
+  double (*func)(int), double scale) {
+
+    printf("\n");
+    printf("static const %s %s[] = {", type, name);
+    for (int i = 0; i < count; i++) {
+        double v = round(func(i) * scale);
+        if (v > 4294967295.0) { v = 4294967295.0; }
+        printf("%s0x%08lx,", (i % 6) ? " ": "\n  ", (unsigned long)v);
+    }
+    printf("\n};\n");
+}
+
+// Quarter sine wave, in 256 steps; Q16
+static double sine(int i) { return sin((M_PI / 2.0) * i / 256.0); }
+
+// atan over [0, 1], in 256 steps; Q16
+static double atan1(int i) { return atan(i / 256.0); }
+
+// 2^(k/32); Q31
+static double exp2k(int k) { return exp2(k / 32.0); }
+
+// log2(1 + k/32) and its reciprocal 1 / (1 + k/32); Q32
+static double log2k(int k) { return log2(1.0 + k / 32.0); }
+static double recipk(int k) { return 1.0 / (1.0 + k / 32.0); }
+
+// 1 / sqrt(m) at the middle of each [(16 + j) / 64, (17 + j) / 64);
+// Q30
+static double rsqrtj(int j) { return 1.0 / sqrt((16.5 + j) / 64.0); }
+
+int main() {
+    printf("#ifndef __FIXED_TABLES_H__\n");
+    printf("#define __FIXED_TABLES_H__\n");
+    printf("\n");
+    printf("#ifdef __cplusplus\n");
+    printf("extern \"C\" {\n");
+    printf("#endif  /* __cplusplus */\n");
+    printf("#include <stdint.h>\n");
+    printf("\n");
+    printf("// Generated by: tools/reference/generate-fixed.c\n");
+
+    dump("uint32_t", "sineTable", 257, sine, 65536.0);
+    dump("uint32_t", "atanTable", 257, atan1, 65536.0);
+    dump("uint32_t", "exp2Table", 32, exp2k, 2147483648.0);
+    dump("uint32_t", "log2Table", 32, log2k, 4294967296.0);
+    dump("uint32_t", "recipTable", 32, recipk, 4294967296.0);
+    dump("uint32_t", "rsqrtTable", 48, rsqrtj, 1073741824.0);
+
+    printf("\n");
+    printf("#ifdef __cplusplus\n");
+    printf("}\n");
+    printf("#endif  /* __cplusplus */\n");
+    printf("\n");
+    printf("#endif  /* __FIXED_TABLES_H__ */\n");
+
+    return 0;
+}
@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "firefly-scene.h"
+
+// Replays a trace captured with ffx_scene_startTrace through the real
+// render kernels, reporting the time to sequence and render each frame
+// and optionally writing each frame as a PPM.
+//
+// To run (from this folder, as a single command):
+//   gcc -O2 -D_GNU_SOURCE -I shim -I ../../include -I ../../src
+//     -o replay replay.c shim/shim.c ../../src/*.c -lm
+//   ./replay capture.log [ --repeat N ] [ --ppm PREFIX ]
+//
+// The input is a serial log containing the output of ffx_scene_dumpTrace.
+// Node data is not captured, so each image, flipbook and tile map is
+// replaced by deterministic noise in the same format and size, which
+// renders in about the same time (flipbook frames are all keyframes).
+//
+// Timing is host timing; it is meant for comparing a change against a
+// baseline on the same machine, not as an estimate of device time.
+
+#define WIDTH            (240)
+#define HEIGHT           (240)
+#define FRAGMENT_HEIGHT  (24)
+
+#define MAX_DATA         (64)
+
+extern uint32_t replayTick;
+
+// The data substituted for each ref
+typedef struct Data {
+    uint64_t ref;
+    uint16_t *data;
+    size_t length;
+} Data;
+
+static Data datas[MAX_DATA];
+static size_t dataCount = 0;
+
+
+static uint8_t* allocFunc(size_t size, void *arg) {
+    return malloc(size);
+}
+
+static void freeFunc(uint8_t *ptr, void *arg) {
+    free(ptr);
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3;
+}
+
+static uint16_t* createNoise(size_t count, uint64_t ref) {
+    uint16_t *data = malloc(count * sizeof(uint16_t));
+    if (data == NULL) { return NULL; }
+
+    uint32_t seed = ref ^ (ref >> 32);
+    for (int i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = seed >> 16;
+    }
+
+    return data;
+}
+
+// See: node-image.c
+static uint16_t* createImage(const uint16_t *header, uint64_t ref,
+  size_t *length) {
+
+    uint16_t format = header[0];
+    size_t pixels = header[1] * header[2];
+
+    size_t count = 3;
+    if ((format & 0x0f) == 0x05) {
+        count += 1 + ((pixels + 3) / 4) + pixels;
+    } else if ((format & 0x0f) == 0x04) {
+        count += pixels;
+    } else if ((format & 0xff) == 0x38) {
+        count += 256 + ((pixels + 1) / 2);
+    } else {
+        printf("unknown image format: 0x%04x\n", format);
+        return NULL;
+    }
+
+    uint16_t *data = createNoise(count, ref);
+    if (data == NULL) { return NULL; }
+
+    memcpy(data, header, 3 * sizeof(uint16_t));
+    if ((format & 0x0f) == 0x05) { data[3] = (pixels + 3) / 4; }
+
+    *length = count * sizeof(uint16_t);
+    return data;
+}
+
+// Every frame is a keyframe (see: node-flipbook.c)
+static uint16_t* createFlipbook(const uint16_t *header, uint64_t ref,
+  size_t *length) {
+
+    size_t width = header[1], height = header[2], frameCount = header[3];
+    size_t frameWords = (width * height + 1) / 2;
+
+    size_t count = 4 + 256 + 8 * frameCount + frameCount * frameWords;
+    uint16_t *data = createNoise(count, ref);
+    if (data == NULL) { return NULL; }
+
+    memcpy(data, header, 4 * sizeof(uint16_t));
+
+    for (int i = 0; i < frameCount; i++) {
+        uint16_t *frame = &data[4 + 256 + 8 * i];
+        uint32_t offset = i * frameWords * 2;
+        frame[0] = 100;
+        frame[1] = 1;
+        frame[2] = frame[3] = 0;
+        frame[4] = width;
+        frame[5] = height;
+        frame[6] = offset >> 16;
+        frame[7] = offset & 0xffff;
+    }
+
+    *length = count * sizeof(uint16_t);
+    return data;
+}
+
+// See: node-tilemap.c
+static uint16_t* createTileMap(const uint16_t *header, uint64_t ref,
+  size_t *length) {
+
+    bool palette = (header[1] == 0x38);
+    size_t tileSize = header[2], tileCount = header[3];
+    size_t cells = header[4] * header[5];
+
+    size_t tileWords = tileSize * tileSize;
+    if (palette) { tileWords /= 2; }
+
+    size_t mapOffset = 6 + (palette ? 256: 0) + tileCount * tileWords;
+    size_t count = mapOffset + cells;
+
+    uint16_t *data = createNoise(count, ref);
+    if (data == NULL) { return NULL; }
+
+    memcpy(data, header, 6 * sizeof(uint16_t));
+    for (int i = 0; i < cells; i++) {
+        data[mapOffset + i] %= tileCount;
+    }
+
+    *length = count * sizeof(uint16_t);
+    return data;
+}
+
+static const uint16_t* getData(uint64_t ref, const uint16_t *header,
+  size_t headerLength, size_t *length, void *arg) {
+
+    for (int i = 0; i < dataCount; i++) {
+        if (datas[i].ref != ref) { continue; }
+        *length = datas[i].length;
+        return datas[i].data;
+    }
+
+    if (dataCount == MAX_DATA) { return NULL; }
+
+    uint16_t *data = NULL;
+    if (headerLength == 4 && header[0] == 0x0146) {
+        data = createFlipbook(header, ref, length);
+    } else if (headerLength == 6 && header[0] == 0x014d) {
+        if (header[3] == 0) { return NULL; }
+        data = createTileMap(header, ref, length);
+    } else if (headerLength == 3) {
+        data = createImage(header, ref, length);
+    }
+
+    if (data == NULL) { return NULL; }
+
+    datas[dataCount++] = (Data){ .ref = ref, .data = data,
+      .length = *length };
+
+    return data;
+}
+
+// Extracts the first trace dumped in %%log%%
+static uint8_t* readTrace(FILE *log, size_t *length) {
+    char line[1024];
+
+    size_t size = 0;
+    while (fgets(line, sizeof(line), log)) {
+        char *start = strstr(line, "<Trace length=");
+        if (start == NULL) { continue; }
+        size = strtoul(&start[14], NULL, 10);
+        break;
+    }
+
+    if (size == 0) { return NULL; }
+
+    uint8_t *trace = malloc(size);
+    if (trace == NULL) { return NULL; }
+
+    size_t offset = 0;
+    while (offset < size && fgets(line, sizeof(line), log)) {
+        if (strstr(line, "</Trace>")) { break; }
+
+        const char *hex = line;
+        while (*hex == ' ') { hex++; }
+
+        while (offset < size) {
+            unsigned int value;
+            if (sscanf(hex, "%2x", &value) != 1) { break; }
+            trace[offset++] = value;
+            hex += 2;
+        }
+    }
+
+    *length = offset;
+    return trace;
+}
+
+static void writePPM(const char *prefix, int frame, const uint16_t *pixels) {
+    char filename[1024];
+    snprintf(filename, sizeof(filename), "%s-%04d.ppm", prefix, frame);
+
+    FILE *f = fopen(filename, "wb");
+    if (f == NULL) {
+        printf("could not write: %s\n", filename);
+        return;
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+    for (int i = 0; i < WIDTH * HEIGHT; i++) {
+        uint16_t c = pixels[i];
+        uint8_t rgb[3] = {
+            ((c >> 11) & 0x1f) << 3,
+            ((c >> 5) & 0x3f) << 2,
+            (c & 0x1f) << 3
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+
+    fclose(f);
+}
+
+int main(int argc, char **argv) {
+    const char *filename = NULL;
+    const char *ppm = NULL;
+    int repeat = 100;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc) {
+            ppm = argv[++i];
+        } else if (filename == NULL) {
+            filename = argv[i];
+        } else {
+            printf("unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (filename == NULL || repeat < 1) {
+        printf("Usage: replay LOG [ --repeat N ] [ --ppm PREFIX ]\n");
+        return 1;
+    }
+
+    FILE *log = fopen(filename, "r");
+    if (log == NULL) {
+        printf("could not open: %s\n", filename);
+        return 1;
+    }
+
+    size_t length = 0;
+    uint8_t *trace = readTrace(log, &length);
+    fclose(log);
+
+    if (trace == NULL) {
+        printf("no trace found\n");
+        return 1;
+    }
+
+    FfxScene scene = ffx_scene_init(allocFunc, freeFunc, NULL, NULL, NULL);
+
+    static uint16_t pixels[WIDTH * HEIGHT];
+
+    double totalSequence = 0, totalRender = 0;
+
+    int frame = 0;
+    while (true) {
+        FfxNode node = ffx_scene_createTraceFrame(scene, trace, length, frame,
+          getData, NULL);
+        if (node == NULL) { break; }
+
+        ffx_sceneGroup_appendChild(ffx_scene_root(scene), node);
+
+        double sequenceTime = 0, renderTime = 0;
+        for (int r = 0; r < repeat; r++) {
+            double t0 = now();
+            replayTick++;
+            ffx_scene_sequence(scene);
+
+            double t1 = now();
+            for (int y = 0; y < HEIGHT; y += FRAGMENT_HEIGHT) {
+                ffx_scene_render(scene, &pixels[y * WIDTH],
+                  ffx_point(0, y), ffx_size(WIDTH, FRAGMENT_HEIGHT));
+            }
+
+            double t2 = now();
+            sequenceTime += t1 - t0;
+            renderTime += t2 - t1;
+        }
+
+        sequenceTime /= repeat;
+        renderTime /= repeat;
+        totalSequence += sequenceTime;
+        totalRender += renderTime;
+
+        printf("frame=%d sequence=%.1fus render=%.1fus\n", frame,
+          sequenceTime, renderTime);
+
+        if (ppm) { writePPM(ppm, frame, pixels); }
+
+        ffx_sceneNode_remove(node);
+        frame++;
+    }
+
+    if (frame == 0) {
+        printf("no frames found\n");
+        return 1;
+    }
+
+    printf("frames=%d avg-sequence=%.1fus avg-render=%.1fus\n", frame,
+      totalSequence / frame, totalRender / frame);
+
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef __REPLAY_SHIM_ESP_DEBUG_HELPERS_H__
+#define __REPLAY_SHIM_ESP_DEBUG_HELPERS_H__
+
+void esp_backtrace_print(int depth);
+
+#endif /* __REPLAY_SHIM_ESP_DEBUG_HELPERS_H__ */
@@ -0,0 +1,28 @@
+#ifndef __REPLAY_SHIM_FREERTOS_H__
+#define __REPLAY_SHIM_FREERTOS_H__
+
+// Just enough of FreeRTOS to build firefly-scene on the host; the
+// scene is only ever sequenced from a single thread (see: shim.c), and
+// requests from other threads are lock-free, so no queues are needed
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+typedef void* SemaphoreHandle_t;
+
+typedef struct StaticSemaphore_t {
+    int unused;
+} StaticSemaphore_t;
+
+#define pdPASS          (1)
+#define pdFAIL          (0)
+#define pdTRUE          (1)
+#define pdFALSE         (0)
+
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+
+#endif /* __REPLAY_SHIM_FREERTOS_H__ */
@@ -0,0 +1,23 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_debug_helpers.h"
+
+// The scene sources use vasprintf, which glibc only declares with
+// _GNU_SOURCE; it must be defined on the command line (-D_GNU_SOURCE),
+// as each source includes libc before these shim headers
+
+// Advanced by the replay tool, one tick per frame
+TickType_t replayTick = 0;
+
+TickType_t xTaskGetTickCount(void) {
+    return replayTick;
+}
+
+// Only used to halt on a fatal error
+void vTaskDelay(TickType_t ticks) {
+    exit(1);
+}
+
+void esp_backtrace_print(int depth) { }
@@ -1,32 +1,57 @@
 import { readFileSync } from "fs";
 
 import { toDotH } from "./dot-h.js"
+import { Flipbook } from "./flipbook.js";
 import { readGif } from "./gif.js";
-import { ImagePalette } from "./image-palette.js";
 
 import type { JimpInstance } from "jimp";
 
 
-const filename = process.argv[2];//"../examples/flipbook/demo-images/giphy.gif";
-
 (async function() {
+    let filename = "";
+    let tag = "flipbook";
+    let size = 240;
+    let keyframeInterval = 0;
+
+    let i = 2;
+    while (i < process.argv.length) {
+        const arg = process.argv[i++];
+        if (arg.startsWith("--")) {
+            if (arg === "--tag") {
+                tag = process.argv[i++];
+            } else if (arg === "--size") {
+                size = parseInt(process.argv[i++]);
+            } else if (arg === "--keyframe") {
+                keyframeInterval = parseInt(process.argv[i++]);
+            } else {
+                throw new Error(`unknown flag: ${ arg }`);
+            }
+            continue;
+        }
+
+        if (filename == "") {
+            filename = arg;
+        } else {
+            throw new Error("already has filename");
+        }
+    }
+
     const imgs = await readGif(readFileSync(filename));
 
-    const frames = imgs.map(({ image, duration }, index) => {
-        console.log({ duration });
-        //const { width, height } = image.bitmap;
-        //const y = Math.trunc(height * 0.2);
-        //image = <JimpInstance>image.crop({
-        //    x: 0, y, w: width, h: height - y
-        //});
-        return ImagePalette.fromImage(<JimpInstance>image.cover({
-            w: 240, h: 240 //, align: 2 | 16
-        }));
+    const frames = imgs.map(({ image, duration }) => {
+        return {
+            image: <JimpInstance>image.cover({ w: size, h: size }),
+            duration
+        };
     });
 
-    const output: Array<string> = [ ];
-    frames.forEach((image, index) => {
-        output.push(toDotH(image.bytes, `nyan_${ index }`));
-    });
-    console.log(output.join("\n\n"));
+    const flipbook = new Flipbook(frames, { keyframeInterval });
+
+    // Statistics go to stderr, so stdout is the header only
+    const stats = flipbook.stats;
+    console.error(`// frames=${ stats.frames } keyframes=${ stats.keyframes }`);
+    console.error(`// bytes=${ stats.bytes } (as images: ${ stats.imageBytes })`);
+    console.error(`// max pixels drawn per frame=${ stats.maxPixels }`);
+
+    console.log(toDotH(flipbook.bytes, tag));
 })();
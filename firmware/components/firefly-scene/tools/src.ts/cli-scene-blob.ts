@@ -0,0 +1,32 @@
+import fs from "fs";
+
+import { compileScene, toSceneDotH } from "./scene-blob.js";
+
+
+(async function() {
+    let filename = "";
+    let tag = "tag";
+
+    let i = 2;
+    while (i < process.argv.length) {
+        const arg = process.argv[i++];
+        if (arg.startsWith("--")) {
+            if (arg === "--tag") {
+                tag = process.argv[i++];
+            } else {
+                throw new Error(`unknown flag: ${ arg }`);
+            }
+            continue;
+        }
+
+        if (filename == "") {
+            filename = arg;
+        } else {
+            throw new Error("already has filename");
+        }
+    }
+
+    const scene = JSON.parse(fs.readFileSync(filename).toString());
+    const output = toSceneDotH(compileScene(scene), tag);
+    console.log(output);
+})();
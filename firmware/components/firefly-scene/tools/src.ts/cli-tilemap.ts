@@ -0,0 +1,50 @@
+import { readFileSync } from "fs";
+
+import { Jimp } from "jimp";
+
+import { toDotH } from "./dot-h.js"
+import { TileMap } from "./tilemap.js";
+
+import type { JimpInstance } from "jimp";
+
+
+(async function() {
+    let filename = "";
+    let tag = "tilemap";
+    let tileSize = 16;
+    let palette = false;
+
+    let i = 2;
+    while (i < process.argv.length) {
+        const arg = process.argv[i++];
+        if (arg.startsWith("--")) {
+            if (arg === "--tag") {
+                tag = process.argv[i++];
+            } else if (arg === "--tile") {
+                tileSize = parseInt(process.argv[i++]);
+            } else if (arg === "--palette") {
+                palette = true;
+            } else {
+                throw new Error(`unknown flag: ${ arg }`);
+            }
+            continue;
+        }
+
+        if (filename == "") {
+            filename = arg;
+        } else {
+            throw new Error("already has filename");
+        }
+    }
+
+    const jimp = <JimpInstance>(await Jimp.read(readFileSync(filename)));
+
+    const tileMap = TileMap.fromImage(jimp, { tileSize, palette });
+
+    // Statistics go to stderr, so stdout is the header only
+    const stats = tileMap.stats;
+    console.error(`// map=${ stats.columns }x${ stats.rows } tiles=${ stats.tiles } unique=${ stats.uniqueTiles }`);
+    console.error(`// bytes=${ stats.bytes } (as image: ${ stats.imageBytes })`);
+
+    console.log(toDotH(tileMap.bytes, tag));
+})();
@@ -0,0 +1,251 @@
+import { Jimp } from "jimp";
+
+import { rgb565 } from "./color.js";
+import { VERSION_TAG, getPixels } from "./image.js";
+
+import type { JimpInstance } from "jimp";
+
+// See: firefly-scene/src/node-flipbook.c
+
+const FORMAT_FLIPBOOK = 0x46;
+
+const PALETTE_SIZE = 256;
+
+const FLAG_KEYFRAME = (1 << 0);
+
+export interface FlipbookFrame {
+    image: JimpInstance;
+    duration: number;
+}
+
+export type FlipbookOptions = {
+    // The maximum number of frames between keyframes; if 0 (default),
+    // keyframes are only added to bound the cost of drawing a frame
+    keyframeInterval?: number;
+};
+
+export type FlipbookStats = {
+    frames: number;
+    keyframes: number;
+
+    // The encoded size, and the size of the frames as whole images
+    bytes: number;
+    imageBytes: number;
+
+    // The largest number of pixels drawn for any one frame
+    maxPixels: number;
+};
+
+type Rect = { x: number, y: number, w: number, h: number };
+
+type EncodedFrame = {
+    duration: number;
+    keyframe: boolean;
+    rect: Rect;
+    pixels: Array<number>;
+};
+
+// Returns the bounding rectangle of the indices which differ
+function getChanged(width: number, height: number, a: Uint8Array,
+  b: Uint8Array): Rect {
+
+    let x0 = width, y0 = height, x1 = -1, y1 = -1;
+    for (let y = 0; y < height; y++) {
+        for (let x = 0; x < width; x++) {
+            const i = y * width + x;
+            if (a[i] === b[i]) { continue; }
+            if (x < x0) { x0 = x; }
+            if (x > x1) { x1 = x; }
+            if (y < y0) { y0 = y; }
+            if (y > y1) { y1 = y; }
+        }
+    }
+
+    if (x1 === -1) { return { x: 0, y: 0, w: 0, h: 0 }; }
+
+    return { x: x0, y: y0, w: x1 - x0 + 1, h: y1 - y0 + 1 };
+}
+
+function getRect(width: number, indices: Uint8Array, rect: Rect): Array<number> {
+    const result: Array<number> = [ ];
+    for (let y = rect.y; y < rect.y + rect.h; y++) {
+        for (let x = rect.x; x < rect.x + rect.w; x++) {
+            result.push(indices[y * width + x]);
+        }
+    }
+    return result;
+}
+
+// Maps each frame onto a single shared palette, quantizing all the
+// frames together if there are too many colors
+function getIndices(images: Array<JimpInstance>): { palette: Array<number>, indices: Array<Uint8Array> } {
+    const palette: Array<number> = [ ];
+    const lookup: Map<number, number> = new Map();
+
+    const indices: Array<Uint8Array> = [ ];
+    for (const image of images) {
+        const { pixels } = getPixels(image);
+
+        const frame = new Uint8Array(pixels.length);
+        for (let i = 0; i < pixels.length; i++) {
+            const _c = rgb565(pixels[i]);
+            const c = (_c[0] << 8) | _c[1];
+
+            let index = lookup.get(c);
+            if (index == null) {
+                index = palette.length;
+                palette.push(c);
+                lookup.set(c, index);
+            }
+            frame[i] = index;
+        }
+
+        if (palette.length > PALETTE_SIZE) { break; }
+        indices.push(frame);
+    }
+
+    if (indices.length === images.length) {
+        while (palette.length < PALETTE_SIZE) { palette.push(0); }
+        return { palette, indices };
+    }
+
+    // Stack the frames to quantize them against one palette
+    const { width, height } = images[0].bitmap;
+    const stack = new Jimp({ width, height: height * images.length, color: 0 });
+    images.forEach((image, index) => {
+        stack.composite(image, 0, index * height);
+    });
+    stack.quantize({ colors: PALETTE_SIZE - 1 });
+
+    return getIndices(images.map((image, index) => {
+        return <JimpInstance>(stack.clone().crop({
+            x: 0, y: index * height, w: width, h: height
+        }));
+    }));
+}
+
+export class Flipbook {
+    readonly width: number;
+    readonly height: number;
+
+    readonly #palette: Array<number>;
+    readonly #frames: Array<EncodedFrame>;
+
+    constructor(frames: Array<FlipbookFrame>, options?: FlipbookOptions) {
+        if (frames.length === 0 || frames.length > 0xffff) {
+            throw new Error("invalid frame count");
+        }
+
+        const { width, height } = frames[0].image.bitmap;
+        for (const { image } of frames) {
+            if (image.bitmap.width !== width || image.bitmap.height !== height) {
+                throw new Error("frames must be the same size");
+            }
+        }
+
+        const keyframeInterval = (options && options.keyframeInterval) || 0;
+
+        this.width = width;
+        this.height = height;
+
+        const { palette, indices } = getIndices(frames.map((f) => f.image));
+        this.#palette = palette;
+
+        const full = { x: 0, y: 0, w: width, h: height };
+        const area = width * height;
+
+        this.#frames = [ ];
+
+        // The pixels drawn since the last keyframe; drawing a frame
+        // replays from its keyframe, so a new keyframe is added once
+        // that cost would exceed a whole image
+        let replay = 0;
+        let sinceKeyframe = 0;
+
+        frames.forEach(({ duration }, index) => {
+            let rect = full, keyframe = true;
+
+            if (index > 0) {
+                const changed = getChanged(width, height, indices[index - 1],
+                  indices[index]);
+                const cost = changed.w * changed.h;
+
+                keyframe = (replay + cost > area);
+                if (keyframeInterval && sinceKeyframe + 1 >= keyframeInterval) {
+                    keyframe = true;
+                }
+
+                if (!keyframe) {
+                    rect = changed;
+                    replay += cost;
+                    sinceKeyframe++;
+                }
+            }
+
+            if (keyframe) {
+                replay = 0;
+                sinceKeyframe = 0;
+            }
+
+            this.#frames.push({
+                duration: Math.min(Math.max(0, Math.round(duration)), 0xffff),
+                keyframe, rect,
+                pixels: getRect(width, indices[index], rect)
+            });
+        });
+    }
+
+    get stats(): FlipbookStats {
+        let maxPixels = 0, pixels = 0;
+        for (const frame of this.#frames) {
+            if (frame.keyframe) { pixels = 0; }
+            pixels += frame.rect.w * frame.rect.h;
+            if (pixels > maxPixels) { maxPixels = pixels; }
+        }
+
+        return {
+            frames: this.#frames.length,
+            keyframes: this.#frames.filter((f) => f.keyframe).length,
+            bytes: this.bytes.length,
+
+            // As individual palette images (see: image-palette.ts)
+            imageBytes: this.#frames.length * (6 + 2 * PALETTE_SIZE +
+              this.width * this.height),
+
+            maxPixels
+        };
+    }
+
+    get bytes(): Uint8Array {
+        const data: Array<number> = [ ];
+        const push16 = (v: number) => { data.push((v >> 8) & 0xff, v & 0xff); };
+
+        data.push(VERSION_TAG, FORMAT_FLIPBOOK);
+        push16(this.width);
+        push16(this.height);
+        push16(this.#frames.length);
+
+        for (const c of this.#palette) { push16(c); }
+
+        let offset = 0;
+        for (const frame of this.#frames) {
+            push16(frame.duration);
+            push16(frame.keyframe ? FLAG_KEYFRAME: 0);
+            push16(frame.rect.x);
+            push16(frame.rect.y);
+            push16(frame.rect.w);
+            push16(frame.rect.h);
+            push16(Math.floor(offset / 0x10000));
+            push16(offset % 0x10000);
+
+            offset += frame.pixels.length + (frame.pixels.length % 2);
+        }
+
+        for (const frame of this.#frames) {
+            for (const index of frame.pixels) { data.push(index); }
+            if (frame.pixels.length % 2) { data.push(0); }
+        }
+
+        return new Uint8Array(data);
+    }
+}
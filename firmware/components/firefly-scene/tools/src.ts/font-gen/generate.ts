@@ -5,7 +5,7 @@ import { loadFont, resolveFontPath, FontSizes, FontWeights } from "./fonts.js";
 
 
 import type { JimpInstance } from "jimp";
-import type { Font } from "./bdf.js";
+import type { Bitmap, Font } from "./bdf.js";
 
 
 
@@ -157,7 +157,13 @@ function getValue(v: string): number {
         for (let i = 33; i < 127; i++) {
             // Compute the glyph bitmap
             let bitmap = font.getBitmap(String.fromCharCode(i));
+
+            // An outlined font is combined with its fill, so the glyph
+            // can be rendered in a single pass; the fill always lies
+            // within the outline bounds, so trimming the outline is safe
+            let fill: null | Bitmap = null;
             if (outline) {
+                fill = bitmap.expanded(outline);
                 bitmap = bitmap.outlined(outline);
             }
             bitmap = bitmap.trimmed();
@@ -190,7 +196,8 @@ function getValue(v: string): number {
             if (bitmap.padTop < minPadTop) { minPadTop = bitmap.padTop; }
             if (bitmap.padTop > maxPadTop) { maxPadTop = bitmap.padTop; }
 
-            // Compute bitmap data
+            // Compute bitmap data; combined glyphs use 2 bits per pixel
+            // (0b00 = none, 0b01 = outline, 0b10 = fill)
             let v = '';
             for (let y = 0; y < bitmap.height; y++) {
                 for (let x = 0; x < bitmap.width; x++) {
@@ -198,7 +205,17 @@ function getValue(v: string): number {
                         data.push(getValue(v));
                         v = '';
                     }
-                    v += bitmap.getBit(x, y) ? "1": "0";
+                    if (fill) {
+                        const fx = x + bitmap.padLeft - fill.padLeft;
+                        const fy = y + bitmap.padTop - fill.padTop;
+                        if (fill.getBit(fx, fy)) {
+                            v += "10";
+                        } else {
+                            v += bitmap.getBit(x, y) ? "01": "00";
+                        }
+                    } else {
+                        v += bitmap.getBit(x, y) ? "1": "0";
+                    }
                 }
             }
             if (v.length > 0) { data.push(getValue(v)); }
@@ -248,8 +265,8 @@ function getValue(v: string): number {
                 }
 
                 doth.push("");
-                doth.push(`/\/ Font: ${ size.toLowerCase() }-${ weight.toLowerCase() }${ outline ? "-outline": ""} (${ font.filename })`);
-                doth.push(`const uint32_t font_${ size.toLowerCase() }_${ weight.toLowerCase() }${ outline ? "_outline": "" }[] = {`);
+                doth.push(`/\/ Font: ${ size.toLowerCase() }-${ weight.toLowerCase() }${ outline ? "-combined": ""} (${ font.filename })`);
+                doth.push(`const uint32_t font_${ size.toLowerCase() }_${ weight.toLowerCase() }${ outline ? "_combined": "" }[] = {`);
 
                 generateFont(font, outline);
 
@@ -0,0 +1,302 @@
+
+// See: firefly-scene/src/blob.c
+
+const VERSION_TAG = 0x01;
+const FORMAT_SCENE = 0x53;
+
+const NodeType: Record<string, number> = {
+    group: 1,
+    box: 2,
+    fill: 3,
+    label: 4,
+    image: 5,
+    anchor: 6,
+};
+
+const FLAG_HIDDEN = (1 << 0);
+
+const Fonts: Record<string, number> = {
+    "large": 0x18,
+    "large-bold": 0x98,
+    "medium": 0x14,
+    "medium-bold": 0x94,
+    "small": 0x0f,
+    "small-bold": 0x8f,
+};
+
+const Aligns: Record<string, number> = {
+    "top": (1 << 0),
+    "middle": (1 << 1),
+    "bottom": (1 << 2),
+    "middle-baseline": (1 << 3),
+    "baseline": (1 << 4),
+    "left": (1 << 5),
+    "center": (1 << 6),
+    "right": (1 << 7),
+};
+
+export type SceneNodeDescription = {
+    type: string;
+    position?: [ number, number ];
+    hidden?: boolean;
+
+    // Group
+    children?: Array<SceneNodeDescription>;
+
+    // Box
+    size?: [ number, number ];
+
+    // Box, Fill, Label (text color), Image (tint)
+    color?: string;
+
+    // Label
+    font?: string;
+    text?: string;
+    align?: Array<string>;
+    outline?: string;
+
+    // Image; the name of an image slot
+    image?: string;
+
+    // Anchor
+    name?: string;
+    tag?: number;
+    dataSize?: number;
+    child?: SceneNodeDescription;
+};
+
+export type SceneDescription = {
+    images?: Array<string>;
+    root: SceneNodeDescription;
+};
+
+export type SceneBlob = {
+    bytes: Uint8Array;
+
+    // The image slot names, in slot order
+    images: Array<string>;
+
+    // The anchor names, in the order they are returned
+    anchors: Array<string>;
+};
+
+// Colors are "#rrggbb", "#rrggbbaa" or "transparent"; encoded as a
+// color_ffxt RGBA (see: firefly-color.h)
+function getColor(value: undefined | string, defaultValue: number): number {
+    if (value == null) { return defaultValue; }
+    if (value === "transparent") { return 0x20000000; }
+
+    const match = value.match(/^#([0-9a-f]{6})([0-9a-f]{2})?$/i);
+    if (!match) { throw new Error(`invalid color: ${ value }`); }
+
+    const rgb = parseInt(match[1], 16);
+    const a = (match[2] == null) ? 255: parseInt(match[2], 16);
+    const opacity = Math.round(a * 32 / 255);
+
+    return (((32 - opacity) << 24) | rgb) >>> 0;
+}
+
+class Writer {
+    readonly #data: Array<number>;
+
+    constructor() {
+        this.#data = [ ];
+    }
+
+    get bytes(): Uint8Array { return new Uint8Array(this.#data); }
+
+    uint8(value: number): void {
+        if (value < 0 || value > 0xff || value !== Math.trunc(value)) {
+            throw new Error(`invalid uint8: ${ value }`);
+        }
+        this.#data.push(value);
+    }
+
+    uint16(value: number): void {
+        if (value < 0 || value > 0xffff || value !== Math.trunc(value)) {
+            throw new Error(`invalid uint16: ${ value }`);
+        }
+        this.#data.push(value >> 8, value & 0xff);
+    }
+
+    int16(value: number): void {
+        if (value < -0x8000 || value > 0x7fff) {
+            throw new Error(`invalid int16: ${ value }`);
+        }
+        this.uint16(value & 0xffff);
+    }
+
+    uint32(value: number): void {
+        this.uint16((value >>> 16) & 0xffff);
+        this.uint16(value & 0xffff);
+    }
+
+    string(value: string): void {
+        const bytes = new TextEncoder().encode(value);
+        this.uint8(bytes.length);
+        for (const b of bytes) { this.#data.push(b); }
+    }
+}
+
+export function compileScene(scene: SceneDescription): SceneBlob {
+    const images = (scene.images || [ ]).slice();
+    const anchors: Array<string> = [ ];
+
+    let nodeCount = 0;
+
+    const body = new Writer();
+
+    const writeNode = (node: SceneNodeDescription) => {
+        const type = NodeType[node.type];
+        if (type == null) { throw new Error(`unknown node type: ${ node.type }`); }
+
+        if (node.name != null && node.type !== "anchor") {
+            throw new Error(`only anchors may be named: ${ node.name }`);
+        }
+
+        nodeCount++;
+
+        const position = node.position || [ 0, 0 ];
+        body.uint8(type);
+        body.uint8(node.hidden ? FLAG_HIDDEN: 0);
+        body.int16(position[0]);
+        body.int16(position[1]);
+
+        switch (node.type) {
+            case "group": {
+                const children = node.children || [ ];
+                body.uint16(children.length);
+                for (const child of children) { writeNode(child); }
+                break;
+            }
+
+            case "box": {
+                const size = node.size || [ 0, 0 ];
+                body.uint16(size[0]);
+                body.uint16(size[1]);
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+            }
+
+            case "fill":
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+
+            case "label": {
+                const font = Fonts[node.font || "medium"];
+                if (font == null) { throw new Error(`unknown font: ${ node.font }`); }
+                let align = 0;
+                for (const name of (node.align || [ ])) {
+                    const value = Aligns[name];
+                    if (value == null) { throw new Error(`unknown align: ${ name }`); }
+                    align |= value;
+                }
+                body.uint8(font);
+                body.uint8(align);
+                body.uint32(getColor(node.color, 0x00ffffff));
+                body.uint32(getColor(node.outline, 0x20000000));
+                body.string(node.text || "");
+                break;
+            }
+
+            case "image": {
+                const index = images.indexOf(node.image || "");
+                if (index === -1) { throw new Error(`unknown image: ${ node.image }`); }
+                body.uint8(index);
+                body.uint32(getColor(node.color, 0x00000000));
+                break;
+            }
+
+            case "anchor":
+                if (node.child == null) { throw new Error("anchor missing child"); }
+                if (node.name != null) {
+                    if (anchors.indexOf(node.name) >= 0) {
+                        throw new Error(`duplicate anchor: ${ node.name }`);
+                    }
+                    anchors.push(node.name);
+                } else {
+                    anchors.push("");
+                }
+                body.uint32(node.tag || 0);
+                body.uint16(node.dataSize || 0);
+                writeNode(node.child);
+                break;
+        }
+    };
+
+    // The runtime carves the root first and uses it to own the whole
+    // allocation, which requires a group
+    let root = scene.root;
+    if (root.type !== "group") { root = { type: "group", children: [ root ] }; }
+    writeNode(root);
+
+    if (images.length > 0xff) { throw new Error("too many images"); }
+
+    const header = new Writer();
+    header.uint8(VERSION_TAG);
+    header.uint8(FORMAT_SCENE);
+    header.uint16(nodeCount);
+    header.uint16(anchors.length);
+
+    const bytes = new Uint8Array(6 + body.bytes.length);
+    bytes.set(header.bytes, 0);
+    bytes.set(body.bytes, 6);
+
+    return { bytes, images, anchors };
+}
+
+function defineName(value: string): string {
+    return value.toUpperCase().replace(/[^A-Z0-9]/g, "_");
+}
+
+export function toSceneDotH(blob: SceneBlob, tag: string): string {
+    const output: Array<string> = [ ];
+
+    const prefix = `SCENE_${ defineName(tag) }`;
+
+    output.push(`#ifndef __SCENE_${ tag }_H__`);
+    output.push(`#define __SCENE_${ tag }_H__`);
+    output.push("");
+    output.push("#ifdef __cplusplus");
+    output.push("extern \"C\" {");
+    output.push("#endif  /* __cplusplus */");
+    output.push("#include <stdint.h>");
+    output.push("");
+
+    output.push(`#define ${ prefix }_IMAGE_COUNT  (${ blob.images.length })`);
+    blob.images.forEach((name, index) => {
+        output.push(`#define ${ prefix }_IMAGE_${ defineName(name) }  (${ index })`);
+    });
+    output.push("");
+
+    output.push(`#define ${ prefix }_ANCHOR_COUNT  (${ blob.anchors.length })`);
+    blob.anchors.forEach((name, index) => {
+        if (name === "") { return; }
+        output.push(`#define ${ prefix }_ANCHOR_${ defineName(name) }  (${ index })`);
+    });
+    output.push("");
+
+    output.push(`const uint8_t scene_${ tag }[] = {`);
+
+    const data = blob.bytes;
+    let offset = 0;
+    while (offset < data.length) {
+        const line: Array<string> = [ ];
+        while (offset < data.length && line.length < 12) {
+            let v = data[offset++].toString(16);
+            if (v.length < 2) { v = "0" + v; }
+            line.push(`0x${ v }`);
+        }
+        output.push("  " + line.join(", ") + ",");
+    }
+
+    output.push("};");
+    output.push("");
+    output.push("#ifdef __cplusplus");
+    output.push("}");
+    output.push("#endif  /* __cplusplus */");
+    output.push("");
+    output.push(`#endif  /* __SCENE_${ tag }_H__ */`);
+
+    return output.join("\n");
+}
@@ -0,0 +1,193 @@
+import { rgb565 } from "./color.js";
+import {
+    VERSION_TAG, FORMAT_PALETTE8, FORMAT_RGB565,
+    getPixels
+} from "./image.js";
+
+import type { JimpInstance } from "jimp";
+
+// See: firefly-scene/src/node-tilemap.c
+
+const FORMAT_TILEMAP = 0x4d;
+
+const PALETTE_SIZE = 256;
+
+export type TileMapOptions = {
+    // The tile width and height; 8 or 16 (default: 16)
+    tileSize?: number;
+
+    // Store tiles as 8-bit palette indices, quantizing if needed
+    palette?: boolean;
+};
+
+export type TileMapStats = {
+    columns: number;
+    rows: number;
+
+    // The number of tiles in the map, and the number after removing
+    // duplicates
+    tiles: number;
+    uniqueTiles: number;
+
+    // The encoded size, and the size as a single RGB565 image
+    bytes: number;
+    imageBytes: number;
+};
+
+// Returns the RGB565 value of every pixel
+function getColors(jimp: JimpInstance): Array<number> {
+    return getPixels(jimp).pixels.map((color) => {
+        const c = rgb565(color);
+        return (c[0] << 8) | c[1];
+    });
+}
+
+export class TileMap {
+    readonly tileSize: number;
+    readonly columns: number;
+    readonly rows: number;
+
+    readonly #palette: null | Array<number>;
+
+    // Each unique tile's pixels (RGB565 colors or palette indices)
+    readonly #tiles: Array<Array<number>>;
+    readonly #map: Array<number>;
+
+    constructor(tileSize: number, columns: number, rows: number,
+      palette: null | Array<number>, tiles: Array<Array<number>>,
+      map: Array<number>) {
+
+        if (tileSize !== 8 && tileSize !== 16) {
+            throw new Error(`unsupported tile size: ${ tileSize }`);
+        }
+
+        if (tiles.length === 0 || tiles.length > 0xffff) {
+            throw new Error("invalid tile count");
+        }
+
+        if (map.length !== columns * rows) {
+            throw new Error("invalid map length");
+        }
+
+        if (palette && palette.length > PALETTE_SIZE) {
+            throw new Error("palette too large");
+        }
+
+        this.tileSize = tileSize;
+        this.columns = columns;
+        this.rows = rows;
+        this.#palette = palette;
+        this.#tiles = tiles;
+        this.#map = map;
+    }
+
+    get stats(): TileMapStats {
+        const width = this.columns * this.tileSize;
+        const height = this.rows * this.tileSize;
+
+        return {
+            columns: this.columns,
+            rows: this.rows,
+            tiles: this.#map.length,
+            uniqueTiles: this.#tiles.length,
+            bytes: this.bytes.length,
+
+            // As a single RGB565 image (see: image-rgb.ts)
+            imageBytes: 6 + 2 * width * height
+        };
+    }
+
+    get bytes(): Uint8Array {
+        const data: Array<number> = [ ];
+        const push16 = (v: number) => { data.push((v >> 8) & 0xff, v & 0xff); };
+
+        data.push(VERSION_TAG, FORMAT_TILEMAP);
+        push16(this.#palette ? FORMAT_PALETTE8: FORMAT_RGB565);
+        push16(this.tileSize);
+        push16(this.#tiles.length);
+        push16(this.columns);
+        push16(this.rows);
+
+        if (this.#palette) {
+            const palette = this.#palette.slice();
+            while (palette.length < PALETTE_SIZE) { palette.push(0); }
+            for (const c of palette) { push16(c); }
+
+            // Tiles always hold an even number of pixels, so indices
+            // pair up within each word
+            for (const tile of this.#tiles) {
+                for (const index of tile) { data.push(index); }
+            }
+
+        } else {
+            for (const tile of this.#tiles) {
+                for (const c of tile) { push16(c); }
+            }
+        }
+
+        for (const index of this.#map) { push16(index); }
+
+        return new Uint8Array(data);
+    }
+
+    // Cuts %%jimp%% into tiles, storing each distinct tile once. The
+    // image is cropped to a whole number of tiles.
+    static fromImage(jimp: JimpInstance, options?: TileMapOptions): TileMap {
+        const tileSize = (options && options.tileSize) || 16;
+        const usePalette = !!(options && options.palette);
+
+        const columns = Math.floor(jimp.bitmap.width / tileSize);
+        const rows = Math.floor(jimp.bitmap.height / tileSize);
+        if (columns === 0 || rows === 0) {
+            throw new Error("image smaller than a tile");
+        }
+
+        const width = jimp.bitmap.width;
+        let colors = getColors(jimp);
+
+        let palette: null | Array<number> = null;
+        if (usePalette) {
+            let unique = new Set(colors);
+            if (unique.size > PALETTE_SIZE) {
+                const quantized = <JimpInstance>(jimp.clone());
+                quantized.quantize({ colors: PALETTE_SIZE });
+                colors = getColors(quantized);
+                unique = new Set(colors);
+            }
+            palette = Array.from(unique);
+        }
+
+        const lookup: Map<number, number> = new Map();
+        if (palette) {
+            palette.forEach((c, index) => { lookup.set(c, index); });
+        }
+
+        const tiles: Array<Array<number>> = [ ];
+        const tileIndex: Map<string, number> = new Map();
+        const map: Array<number> = [ ];
+
+        for (let row = 0; row < rows; row++) {
+            for (let col = 0; col < columns; col++) {
+                const tile: Array<number> = [ ];
+                for (let y = 0; y < tileSize; y++) {
+                    for (let x = 0; x < tileSize; x++) {
+                        const c = colors[(row * tileSize + y) * width +
+                          col * tileSize + x];
+                        tile.push(palette ? <number>(lookup.get(c)): c);
+                    }
+                }
+
+                const key = tile.join(",");
+                let index = tileIndex.get(key);
+                if (index == null) {
+                    index = tiles.length;
+                    tiles.push(tile);
+                    tileIndex.set(key, index);
+                }
+                map.push(index);
+            }
+        }
+
+        return new TileMap(tileSize, columns, rows, palette, tiles, map);
+    }
+}